@@ -0,0 +1,213 @@
+
+#include "Esd_AsyncLoad.h"
+
+#include "Esd_Context.h"
+
+#include <string.h>
+
+extern ESD_CORE_EXPORT Esd_GpuAlloc *Esd_GAlloc;
+
+typedef struct
+{
+	Esd_BitmapInfo *Info;
+	Esd_GpuHandle GpuHandle;
+	uint32_t Size; // Number of bytes to upload
+	uint32_t FileOffset; // Position of the data in the file
+	uint32_t RequestFrame; // Last frame in which the bitmap was requested
+	bool Inflate; // Compressed file, fed to CMD_INFLATE
+} Esd_AsyncLoadJob;
+
+static Esd_AsyncLoadJob s_Jobs[ESD_ASYNCLOAD_QUEUE];
+static uint32_t s_JobCount = 0;
+
+// File of the job at the head of the queue
+static EVE_Asset s_Asset;
+static bool s_AssetOpen = false;
+static uint32_t s_Offset = 0;
+static bool s_Inflating = false;
+
+static int findJob(Esd_BitmapInfo *bitmapInfo)
+{
+	uint32_t i;
+	for (i = 0; i < s_JobCount; ++i)
+	{
+		if (s_Jobs[i].Info == bitmapInfo)
+			return (int)i;
+	}
+	return -1;
+}
+
+static void removeJob(uint32_t idx, bool loaded)
+{
+	EVE_HalContext *phost = Esd_GetHost();
+	Esd_AsyncLoadJob *job = &s_Jobs[idx];
+
+	if (idx == 0 && s_Inflating)
+	{
+		// CMD_INFLATE cannot be cancelled, feed it the rest of the stream to get the command buffer back
+		if (!phost->CmdFault && s_Offset < job->Size)
+			EVE_Util_inflateAssetRegion(phost, &s_Asset, s_Offset, job->Size - s_Offset);
+		s_Inflating = false;
+		if (!loaded)
+			EVE_Cmd_waitFlush(phost); // Done writing before the space is released
+	}
+	if (idx == 0 && s_AssetOpen)
+	{
+		EVE_Util_closeAsset(phost, &s_Asset);
+		s_AssetOpen = false;
+	}
+	if (!loaded)
+	{
+		// Release the space, the bitmap is loaded again when requested
+		Esd_GpuAlloc_Free(Esd_GAlloc, job->GpuHandle);
+	}
+	else
+	{
+		// Show the bitmap now that it is complete
+		Esd_GpuAlloc_Seal(Esd_GAlloc, job->GpuHandle);
+		Esd_Invalidate();
+	}
+	job->Info->Loading = false;
+
+	--s_JobCount;
+	memmove(&s_Jobs[idx], &s_Jobs[idx + 1], (s_JobCount - idx) * sizeof(Esd_AsyncLoadJob));
+}
+
+ESD_CORE_EXPORT bool Esd_AsyncLoad_Queue(Esd_BitmapInfo *bitmapInfo)
+{
+	return Esd_AsyncLoad_QueueRegion(bitmapInfo, 0);
+}
+
+ESD_CORE_EXPORT bool Esd_AsyncLoad_QueueRegion(Esd_BitmapInfo *bitmapInfo, uint32_t fileOffset)
+{
+	Esd_AsyncLoadJob *job;
+
+	if (s_JobCount >= ESD_ASYNCLOAD_QUEUE)
+		return false;
+
+	job = &s_Jobs[s_JobCount++];
+	job->Info = bitmapInfo;
+	job->GpuHandle = bitmapInfo->GpuHandle;
+	job->Size = bitmapInfo->Size;
+	job->FileOffset = fileOffset;
+	job->RequestFrame = Esd_CurrentContext->Frame;
+	job->Inflate = bitmapInfo->Compressed;
+	bitmapInfo->Loading = true;
+	return true;
+}
+
+ESD_CORE_EXPORT void Esd_AsyncLoad_Touch(Esd_BitmapInfo *bitmapInfo)
+{
+	int idx = findJob(bitmapInfo);
+	if (idx >= 0)
+		s_Jobs[idx].RequestFrame = Esd_CurrentContext->Frame;
+}
+
+ESD_CORE_EXPORT uint32_t Esd_AsyncLoad_Uploaded(Esd_BitmapInfo *bitmapInfo)
+{
+	// Only the job at the head of the queue is being uploaded
+	if (!s_JobCount || s_Jobs[0].Info != bitmapInfo || !s_AssetOpen || s_Jobs[0].Inflate)
+		return 0;
+	return s_Offset;
+}
+
+ESD_CORE_EXPORT uint32_t Esd_AsyncLoad_Pending()
+{
+	return s_JobCount;
+}
+
+ESD_CORE_EXPORT void Esd_AsyncLoad_Update()
+{
+	EVE_HalContext *phost = Esd_GetHost();
+	uint32_t start = EVE_millis();
+	uint32_t i;
+
+	// Drop bitmaps which are no longer on screen
+	for (i = 0; i < s_JobCount;)
+	{
+		if (Esd_CurrentContext->Frame - s_Jobs[i].RequestFrame > 2)
+			removeJob(i, false);
+		else
+			++i;
+	}
+
+	while (s_JobCount && (EVE_millis() - start) < ESD_ASYNCLOAD_SLICE_MS)
+	{
+		Esd_AsyncLoadJob *job = &s_Jobs[0];
+		uint32_t addr = Esd_GpuAlloc_Get(Esd_GAlloc, job->GpuHandle);
+		uint32_t size;
+
+		if (addr == GA_INVALID || phost->CmdFault)
+		{
+			removeJob(0, false);
+			continue;
+		}
+
+		// Resume once defragmentation has moved the bitmap
+		if (Esd_GpuAlloc_IsMoving(Esd_GAlloc, job->GpuHandle))
+			break;
+
+		if (!s_AssetOpen)
+		{
+			if (!EVE_Util_openAsset(phost, &s_Asset, job->Info->File))
+			{
+				removeJob(0, false);
+				continue;
+			}
+			s_AssetOpen = true;
+			s_Offset = 0;
+			if (job->Inflate)
+			{
+				// Upload the compressed stream, the allocation holds the inflated bitmap
+				job->Size = s_Asset.Size;
+				EVE_CoCmd_inflate(phost, addr);
+				s_Inflating = true;
+			}
+			else if (s_Asset.Size < job->FileOffset + job->Size)
+			{
+				if (s_Asset.Size <= job->FileOffset)
+				{
+					removeJob(0, false);
+					continue;
+				}
+				job->Size = s_Asset.Size - job->FileOffset;
+			}
+		}
+
+		size = min(job->Size - s_Offset, ESD_ASYNCLOAD_CHUNK);
+		if (size && !(job->Inflate
+		                     ? EVE_Util_inflateAssetRegion(phost, &s_Asset, s_Offset, size)
+		                     : EVE_Util_loadAssetRegion(phost, &s_Asset, job->FileOffset + s_Offset, addr + s_Offset, size)))
+		{
+			eve_printf_debug("Failed to load bitmap from file\n");
+			removeJob(0, false);
+			continue;
+		}
+
+		s_Offset += size;
+		if (s_Offset >= job->Size)
+			removeJob(0, true);
+#if ESD_ASYNCLOAD_PROGRESSIVE
+		else if (!job->Inflate)
+			Esd_Invalidate(); // Show the new rows
+#endif
+	}
+}
+
+ESD_CORE_EXPORT bool Esd_AsyncLoad_Inflating()
+{
+	return s_Inflating;
+}
+
+ESD_CORE_EXPORT void Esd_AsyncLoad_Reset()
+{
+	while (s_JobCount)
+		removeJob(s_JobCount - 1, false);
+	if (s_AssetOpen)
+	{
+		EVE_Util_closeAsset(Esd_GetHost(), &s_Asset);
+		s_AssetOpen = false;
+	}
+}
+
+/* end of file */
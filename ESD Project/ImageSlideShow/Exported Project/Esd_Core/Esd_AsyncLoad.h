@@ -0,0 +1,90 @@
+
+#ifndef ESD_ASYNCLOAD__H
+#define ESD_ASYNCLOAD__H
+
+#include "Esd_Base.h"
+#include "Esd_BitmapInfo.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+Background bitmap loader.
+When AsyncLoad is set in the context, Esd_LoadBitmap queues uncompressed bitmaps stored
+on the SD card instead of loading them synchronously. The RAM_G space is allocated right
+away, and Esd_Update uploads the queued files in slices of at most ESD_ASYNCLOAD_SLICE_MS
+per frame. Until the upload completes, the bitmap is flagged as Loading and Esd_LoadBitmap
+returns GA_INVALID, so widgets skip drawing it, or draw a placeholder instead.
+A queued bitmap that is no longer requested by any widget is dropped.
+With ESD_ASYNCLOAD_PROGRESSIVE, Esd_Render_Bitmap draws the rows of an uncompressed bitmap
+that have been uploaded so far, so the image fills in from the top while it streams.
+
+With ESD_ASYNCLOAD_INFLATE, compressed bitmaps are queued as well. Their CMD_INFLATE
+stays open in the command buffer across frames while the compressed data is fed, so
+meanwhile Esd_Loop keeps the previous frame on screen instead of rendering, and skips
+defragmentation. Idle and Update callbacks must not send coprocessor commands while
+Esd_AsyncLoad_Inflating returns true. Custom loops must skip Esd_Render likewise.
+
+While Preloading is set in the context, Esd_LoadBitmap queues regardless of AsyncLoad.
+Ft_Esd_Widget_RenderPreload uses this to load the next page while the current one is shown.
+
+Esd_AsyncLoad_QueueRegion uploads a part of a file instead, such as a tile of Esd_TiledImage.h.
+*/
+
+#ifndef ESD_ASYNCLOAD_QUEUE
+#define ESD_ASYNCLOAD_QUEUE 8
+#endif
+
+/* Time budget for uploading in each frame */
+#ifndef ESD_ASYNCLOAD_SLICE_MS
+#define ESD_ASYNCLOAD_SLICE_MS 4
+#endif
+
+/* Size of each upload step, a multiple of 4 bytes */
+#ifndef ESD_ASYNCLOAD_CHUNK
+#define ESD_ASYNCLOAD_CHUNK 4096
+#endif
+
+/* Draw the uploaded rows of uncompressed bitmaps while loading, renders a frame after each slice */
+#ifndef ESD_ASYNCLOAD_PROGRESSIVE
+#define ESD_ASYNCLOAD_PROGRESSIVE 1
+#endif
+
+/* Also load compressed bitmaps in the background, holding rendering while inflating */
+#ifndef ESD_ASYNCLOAD_INFLATE
+#define ESD_ASYNCLOAD_INFLATE 0
+#endif
+
+// Queues the upload of a bitmap that has its RAM_G space allocated, returns false if the queue is full
+ESD_CORE_EXPORT bool Esd_AsyncLoad_Queue(Esd_BitmapInfo *bitmapInfo);
+
+// Queues the upload of Size bytes of the file, starting at fileOffset, returns false if the queue is full.
+// The region is uploaded as is, Compressed must not be set
+ESD_CORE_EXPORT bool Esd_AsyncLoad_QueueRegion(Esd_BitmapInfo *bitmapInfo, uint32_t fileOffset);
+
+// Keeps a queued bitmap alive, called whenever the bitmap is requested while loading
+ESD_CORE_EXPORT void Esd_AsyncLoad_Touch(Esd_BitmapInfo *bitmapInfo);
+
+// Number of bytes of an uncompressed bitmap in RAM_G so far, 0 when its upload has not started or is inflating
+ESD_CORE_EXPORT uint32_t Esd_AsyncLoad_Uploaded(Esd_BitmapInfo *bitmapInfo);
+
+// Number of bitmaps queued or uploading
+ESD_CORE_EXPORT uint32_t Esd_AsyncLoad_Pending();
+
+// Uploads queued bitmaps within the time budget, called from Esd_Update
+ESD_CORE_EXPORT void Esd_AsyncLoad_Update();
+
+// Drops all queued bitmaps
+ESD_CORE_EXPORT void Esd_AsyncLoad_Reset();
+
+// Whether a CMD_INFLATE is open in the command buffer, no other coprocessor command may be sent
+ESD_CORE_EXPORT bool Esd_AsyncLoad_Inflating();
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* #ifndef ESD_ASYNCLOAD__H */
+
+/* end of file */
@@ -0,0 +1,237 @@
+
+#include "Esd_Audio.h"
+
+#include "Esd_Context.h"
+
+#include <string.h>
+
+extern ESD_CORE_EXPORT Esd_GpuAlloc *Esd_GAlloc;
+
+// Playback start address and length must be a multiple of 8 bytes, allocations are only aligned to 4
+#define ESD_AUDIO_ALIGN 8
+
+// Refills are made of whole sectors, one sector stays free ahead of the read pointer
+#define ESD_AUDIO_SECTOR 512
+
+static Esd_GpuHandle s_Handle = GA_HANDLE_INIT;
+static EVE_Asset s_Asset;
+static bool s_AssetOpen = false;
+static bool s_Playing = false;
+static bool s_Looped = false; // Streaming through the ring, otherwise the whole file is in RAM_G
+static uint8_t s_SilenceValue;
+
+static uint32_t s_Offset; // Next file offset to load
+static uint32_t s_End; // End of the samples in the file
+static uint32_t s_Read; // Ring position of the read pointer at the last update
+static uint32_t s_Write; // Ring position of the next refill
+static uint32_t s_Buffered; // Bytes written behind the read pointer that have not been played yet
+static uint32_t s_Silence; // Bytes of silence at the end of the buffered bytes
+
+static uint32_t ringAddress()
+{
+	uint32_t addr = Esd_GpuAlloc_Get(Esd_GAlloc, s_Handle);
+	if (addr == GA_INVALID)
+		return GA_INVALID;
+	return (addr + ESD_AUDIO_ALIGN - 1) & ~(ESD_AUDIO_ALIGN - 1);
+}
+
+static void writeSilence(EVE_HalContext *phost, uint32_t addr, uint32_t size)
+{
+	uint8_t buffer[64];
+	memset(buffer, s_SilenceValue, sizeof(buffer));
+	while (size)
+	{
+		uint32_t blocklen = size < sizeof(buffer) ? size : sizeof(buffer);
+		EVE_Hal_wrMem(phost, addr, buffer, blocklen);
+		addr += blocklen;
+		size -= blocklen;
+	}
+}
+
+// Fill the free part of the ring, up to size bytes
+static bool fill(EVE_HalContext *phost, uint32_t ring, uint32_t size)
+{
+	while (size)
+	{
+		uint32_t chunk = ESD_AUDIO_RING_SIZE - s_Write;
+		if (chunk > size)
+			chunk = size;
+		if (s_Offset < s_End)
+		{
+			if (chunk > s_End - s_Offset)
+				chunk = s_End - s_Offset;
+			if (!EVE_Util_loadAssetRegion(phost, &s_Asset, s_Offset, ring + s_Write, chunk))
+				return false;
+			s_Offset += chunk;
+		}
+		else
+		{
+			writeSilence(phost, ring + s_Write, chunk);
+			s_Silence += chunk;
+		}
+		s_Write += chunk;
+		if (s_Write == ESD_AUDIO_RING_SIZE)
+			s_Write = 0;
+		s_Buffered += chunk;
+		size -= chunk;
+	}
+	return true;
+}
+
+ESD_CORE_EXPORT bool Esd_Audio_Play(const char *file, uint32_t offset, uint8_t format, uint16_t frequency, uint8_t volume)
+{
+	EVE_HalContext *phost = Esd_GetHost();
+	uint32_t ring;
+	uint32_t length;
+
+	Esd_Audio_Stop();
+
+	if (!EVE_Util_openAsset(phost, &s_Asset, file))
+		return false;
+	s_AssetOpen = true;
+	if (offset >= s_Asset.Size)
+	{
+		EVE_Util_closeAsset(phost, &s_Asset);
+		s_AssetOpen = false;
+		return false;
+	}
+
+	s_Handle = Esd_GpuAlloc_Alloc(Esd_GAlloc, ESD_AUDIO_RING_SIZE + ESD_AUDIO_ALIGN, GA_FIXED_FLAG);
+	ring = ringAddress();
+	if (ring == GA_INVALID)
+	{
+		eve_printf_debug("Not enough RAM_G for the audio ring buffer\n");
+		EVE_Util_closeAsset(phost, &s_Asset);
+		s_AssetOpen = false;
+		return false;
+	}
+
+	s_Offset = offset;
+	s_End = s_Asset.Size;
+	s_Read = 0;
+	s_Write = 0;
+	s_Buffered = 0;
+	s_Silence = 0;
+	s_SilenceValue = format == ULAW_SAMPLES ? 0xFF : 0x00;
+	s_Looped = (s_End - s_Offset) > (ESD_AUDIO_RING_SIZE - ESD_AUDIO_SECTOR);
+	s_Playing = true;
+
+	// Prefill the ring, leaving the guard sector
+	length = s_Looped ? ESD_AUDIO_RING_SIZE - ESD_AUDIO_SECTOR : (s_End - s_Offset);
+	if (!fill(phost, ring, length))
+	{
+		Esd_Audio_Stop();
+		return false;
+	}
+	if (!s_Looped)
+	{
+		// Done with the file
+		EVE_Util_closeAsset(phost, &s_Asset);
+		s_AssetOpen = false;
+		length &= ~(ESD_AUDIO_ALIGN - 1);
+	}
+	else
+	{
+		length = ESD_AUDIO_RING_SIZE;
+	}
+
+	EVE_Hal_wr32(phost, REG_PLAYBACK_START, ring);
+	EVE_Hal_wr32(phost, REG_PLAYBACK_LENGTH, length);
+	EVE_Hal_wr16(phost, REG_PLAYBACK_FREQ, frequency);
+	EVE_Hal_wr8(phost, REG_PLAYBACK_FORMAT, format);
+	EVE_Hal_wr8(phost, REG_PLAYBACK_LOOP, s_Looped ? 1 : 0);
+	EVE_Hal_wr8(phost, REG_VOL_PB, volume);
+	EVE_Hal_wr8(phost, REG_PLAYBACK_PLAY, 1);
+	return true;
+}
+
+ESD_CORE_EXPORT void Esd_Audio_Stop()
+{
+	EVE_HalContext *phost = Esd_GetHost();
+
+	if (!s_Playing)
+		return;
+
+	// Zero length playback stops the current one
+	s_Playing = false;
+	EVE_Hal_wr32(phost, REG_PLAYBACK_LENGTH, 0);
+	EVE_Hal_wr8(phost, REG_PLAYBACK_LOOP, 0);
+	EVE_Hal_wr8(phost, REG_PLAYBACK_PLAY, 1);
+	if (s_AssetOpen)
+		EVE_Util_closeAsset(phost, &s_Asset);
+	s_AssetOpen = false;
+	s_Looped = false;
+	Esd_GpuAlloc_Free(Esd_GAlloc, s_Handle);
+	s_Handle = GA_HANDLE_INVALID;
+}
+
+ESD_CORE_EXPORT bool Esd_Audio_IsPlaying()
+{
+	return s_Playing;
+}
+
+ESD_CORE_EXPORT void Esd_Audio_Update()
+{
+	EVE_HalContext *phost = Esd_GetHost();
+	uint32_t ring;
+	uint32_t pos;
+	uint32_t played;
+	uint32_t free;
+
+	if (!s_Playing)
+		return;
+
+	ring = ringAddress();
+	if (ring == GA_INVALID)
+	{
+		// RAM_G was reset
+		Esd_Audio_Stop();
+		return;
+	}
+
+	if (!s_Looped)
+	{
+		if (!EVE_Hal_rd8(phost, REG_PLAYBACK_PLAY))
+			Esd_Audio_Stop();
+		return;
+	}
+
+	pos = EVE_Hal_rd32(phost, REG_PLAYBACK_READPTR) - ring;
+	if (pos >= ESD_AUDIO_RING_SIZE)
+		pos = s_Read; // Not ours, or not started yet
+	played = (pos - s_Read + ESD_AUDIO_RING_SIZE) % ESD_AUDIO_RING_SIZE;
+	s_Read = pos;
+	if (played > s_Buffered)
+	{
+		// Underrun, the ring was played through older samples. Continue at the next sector, the old samples up to it count as silence
+		eve_printf_debug("Audio ring buffer underrun\n");
+		s_Write = ((pos + ESD_AUDIO_SECTOR - 1) & ~(ESD_AUDIO_SECTOR - 1)) % ESD_AUDIO_RING_SIZE;
+		s_Buffered = (s_Write - pos + ESD_AUDIO_RING_SIZE) % ESD_AUDIO_RING_SIZE;
+		s_Silence = s_Buffered;
+	}
+	else
+	{
+		s_Buffered -= played;
+		if (s_Silence > s_Buffered)
+			s_Silence = s_Buffered;
+	}
+
+	if (s_Offset >= s_End && s_Buffered <= s_Silence)
+	{
+		// Only silence left
+		Esd_Audio_Stop();
+		return;
+	}
+
+	free = ESD_AUDIO_RING_SIZE - ESD_AUDIO_SECTOR - s_Buffered;
+	if (free > ESD_AUDIO_FILL_MAX)
+		free = ESD_AUDIO_FILL_MAX;
+	free &= ~(ESD_AUDIO_SECTOR - 1);
+	if (free && !fill(phost, ring, free))
+	{
+		eve_printf_debug("Audio file read failed\n");
+		Esd_Audio_Stop();
+	}
+}
+
+/* end of file */
@@ -0,0 +1,56 @@
+
+#ifndef ESD_AUDIO__H
+#define ESD_AUDIO__H
+
+#include "Esd_Base.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+Streamed audio playback.
+Plays a PCM or ADPCM sample file from the SD card of any length through a ring buffer in
+RAM_G. The ring is played by the audio engine in a loop, while Esd_Update refills the part
+behind REG_PLAYBACK_READPTR from the file, in whole sectors so the asset loader reads them
+straight from the card. After the end of the file the ring is filled with silence, and the
+playback is stopped once the last samples have been played.
+A file which fits in the ring is loaded at once and played without looping.
+The ring is a fixed allocation, it is released when the playback stops.
+*/
+
+// Size of the ring buffer in bytes, a multiple of 512.
+// Covers ESD_AUDIO_RING_SIZE / frequency seconds of 8 bit samples, twice as long for ADPCM
+#ifndef ESD_AUDIO_RING_SIZE
+#define ESD_AUDIO_RING_SIZE 16384
+#endif
+
+// Maximum number of bytes loaded in each update, a multiple of 512
+#ifndef ESD_AUDIO_FILL_MAX
+#define ESD_AUDIO_FILL_MAX 4096
+#endif
+
+#if (ESD_AUDIO_RING_SIZE & 511) || (ESD_AUDIO_FILL_MAX & 511)
+#error ESD_AUDIO_RING_SIZE and ESD_AUDIO_FILL_MAX must be a multiple of 512
+#endif
+
+// Start playing the samples from offset to the end of the file, stops the playback before.
+// Format is LINEAR_SAMPLES, ULAW_SAMPLES or ADPCM_SAMPLES, frequency in Hz. Returns false when the file cannot be played
+ESD_CORE_EXPORT bool Esd_Audio_Play(const char *file, uint32_t offset, uint8_t format, uint16_t frequency, uint8_t volume);
+
+// Stop the playback and release the ring buffer, called from Esd_Stop
+ESD_CORE_EXPORT void Esd_Audio_Stop();
+
+// True until the last samples of the file have been played
+ESD_CORE_EXPORT bool Esd_Audio_IsPlaying();
+
+// Refill the ring buffer, called from Esd_Update
+ESD_CORE_EXPORT void Esd_Audio_Update();
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* #ifndef ESD_AUDIO__H */
+
+/* end of file */
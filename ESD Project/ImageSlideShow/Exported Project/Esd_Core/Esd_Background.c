@@ -0,0 +1,103 @@
+
+#include "Esd_Background.h"
+#include "Esd_Context.h"
+#include "Esd_GpuAlloc.h"
+
+extern ESD_CORE_EXPORT Esd_GpuAlloc *Esd_GAlloc;
+
+#define ESD_BACKGROUND_NONE 0
+#define ESD_BACKGROUND_PENDING 1 // Rendered alone in BackgroundFrame, captured once that frame is on screen
+#define ESD_BACKGROUND_READY 2
+#define ESD_BACKGROUND_DIRECT 3 // No RAM_G for the snapshot, rendered every frame until invalidated
+
+static void releaseSnapshot(Esd_Context *ec)
+{
+	Esd_DeferredGpuFree(ec->BackgroundHandle); // May still be on screen
+	ec->BackgroundHandle = GA_HANDLE_INVALID;
+	ec->BackgroundState = ESD_BACKGROUND_NONE;
+}
+
+ESD_CORE_EXPORT void Esd_Background_Set(Esd_Callback render, void *context)
+{
+	Esd_Context *ec = Esd_CurrentContext;
+	releaseSnapshot(ec);
+	ec->RenderBackground = render;
+	ec->BackgroundContext = context;
+	Esd_Invalidate();
+}
+
+ESD_CORE_EXPORT void Esd_Background_Invalidate()
+{
+	Esd_Context *ec = Esd_CurrentContext;
+	if (ec->BackgroundState == ESD_BACKGROUND_NONE)
+		return;
+	releaseSnapshot(ec);
+	Esd_Invalidate();
+}
+
+ESD_CORE_EXPORT bool Esd_Background_Render()
+{
+	Esd_Context *ec = Esd_CurrentContext;
+	EVE_HalContext *phost = Esd_GetHost();
+	uint32_t addr;
+
+	if (!ec->RenderBackground)
+		return true;
+	if (EVE_CHIPID < EVE_FT810)
+	{
+		ec->RenderBackground(ec->BackgroundContext);
+		return true;
+	}
+
+	if (ec->BackgroundState == ESD_BACKGROUND_PENDING && ec->Frame != ec->BackgroundFrame)
+	{
+		// The previous frame showed the background alone, read it back before this frame is swapped in
+		ec->BackgroundHandle = Esd_GpuAlloc_Alloc(Esd_GAlloc, (uint32_t)phost->Width * phost->Height * 2, GA_GC_FLAG);
+		addr = Esd_GpuAlloc_Get(Esd_GAlloc, ec->BackgroundHandle);
+		if (addr == GA_INVALID)
+		{
+			eve_printf_debug("No RAM_G for the background snapshot\n");
+			ec->BackgroundState = ESD_BACKGROUND_DIRECT;
+		}
+		else
+		{
+			EVE_CoCmd_snapshot2(phost, RGB565, addr, 0, 0, phost->Width, phost->Height);
+			ec->BackgroundState = ESD_BACKGROUND_READY;
+		}
+	}
+
+	if (ec->BackgroundState == ESD_BACKGROUND_DIRECT)
+	{
+		ec->RenderBackground(ec->BackgroundContext);
+		return true;
+	}
+
+	if (ec->BackgroundState == ESD_BACKGROUND_READY)
+	{
+		addr = Esd_GpuAlloc_Get(Esd_GAlloc, ec->BackgroundHandle);
+		if (addr != GA_INVALID)
+		{
+			EVE_CoDl_saveContext(phost);
+			EVE_CoDl_bitmapHandle(phost, ESD_CO_SCRATCH_HANDLE);
+			EVE_CoCmd_setBitmap(phost, addr, RGB565, phost->Width, phost->Height);
+			EVE_CoDl_colorArgb_ex(phost, 0xFFFFFFFF);
+			EVE_CoDl_begin(phost, BITMAPS);
+			EVE_CoDl_vertexFormat(phost, 0);
+			EVE_CoDl_vertex2f(phost, 0, 0);
+			EVE_CoDl_end(phost);
+			EVE_CoDl_restoreContext(phost);
+			return true;
+		}
+		// Evicted
+		ec->BackgroundState = ESD_BACKGROUND_NONE;
+	}
+
+	// Render the background alone, and capture it on the next frame
+	ec->RenderBackground(ec->BackgroundContext);
+	ec->BackgroundState = ESD_BACKGROUND_PENDING;
+	ec->BackgroundFrame = ec->Frame;
+	Esd_Invalidate();
+	return false;
+}
+
+/* end of file */
@@ -0,0 +1,41 @@
+
+#ifndef ESD_BACKGROUND__H
+#define ESD_BACKGROUND__H
+
+#include "Esd_Base.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+Static background layer.
+The background callback set with Esd_Background_Set draws the static part of the screen, such as gradients,
+panels and logos. It is rendered once, captured full screen into RAM_G with CMD_SNAPSHOT2, and from then on
+drawn as a single RGB565 bitmap right after the clear, with the Render callback of the context drawn above it.
+The cost of a frame then no longer depends on how complex the background is.
+
+The capture reads back the frame on screen, so the frame in which the background is rendered for it shows
+the background alone, the overlay is drawn again from the next frame. Call Esd_Background_Invalidate when
+the background changes, it is captured again from the next frame. The snapshot takes width * height * 2 bytes
+of RAM_G, and is captured again if it is evicted. Without RAM_G for it, the background is rendered in every
+frame until Esd_Background_Invalidate. FT80x lacks CMD_SNAPSHOT2, there the callback renders the
+background in every frame. Ft_Esd_Widget_SetBackgroundLayer uses a widget subtree as the background.
+*/
+
+// Sets the callback drawing the background layer, NULL to remove the layer and release its snapshot
+ESD_CORE_EXPORT void Esd_Background_Set(Esd_Callback render, void *context);
+
+// Captures the background again, such as after it changed
+ESD_CORE_EXPORT void Esd_Background_Invalidate();
+
+// Draws the background layer, called by Esd_Render after the clear. Returns false when the overlay is not to be drawn in this frame
+ESD_CORE_EXPORT bool Esd_Background_Render();
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* #ifndef ESD_BACKGROUND__H */
+
+/* end of file */
@@ -6,4 +6,10 @@ ESD_CORE_EXPORT void Esd_Noop(void *context)
 	// no-op
 }
 
+ESD_CORE_EXPORT void Esd_ConstantInput(void *context)
+{
+	// Only compared against, constant inputs are read with ESD_INPUT_VALUE
+	eve_assert_ex(false, "Constant input called as a property function");
+}
+
 /* end of file */
@@ -198,6 +198,26 @@ typedef const char *cstring;
 #define ESD_CORE_EXPORT
 #endif
 
+/* Count host heap usage, see Esd_HostMem.h. Enabled by default in debug builds */
+#if !defined(ESD_HOSTMEM)
+#if defined(_DEBUG)
+#define ESD_HOSTMEM 1
+#else
+#define ESD_HOSTMEM 0
+#endif
+#endif
+
+/* Host heap underneath esd_malloc and the memory pool */
+#if ESD_HOSTMEM
+ESD_CORE_EXPORT void *Esd_HostMem_Alloc(size_t size);
+ESD_CORE_EXPORT void Esd_HostMem_Free(void *ptr);
+#define esd_heap_alloc(size) Esd_HostMem_Alloc(size)
+#define esd_heap_free(ptr) Esd_HostMem_Free(ptr)
+#else
+#define esd_heap_alloc(size) malloc(size)
+#define esd_heap_free(ptr) free(ptr)
+#endif
+
 #ifdef ESD_MEMORYPOOL_ALLOCATOR
 #ifndef esd_malloc
 #define esd_malloc(size) Esd_MemoryPool_Alloc(Esd_MP, size)
@@ -212,10 +232,10 @@ typedef const char *cstring;
 #endif
 
 #ifndef esd_malloc
-#define esd_malloc(size) malloc(size)
+#define esd_malloc(size) esd_heap_alloc(size)
 #endif
 #ifndef esd_free
-#define esd_free(ptr) free(ptr)
+#define esd_free(ptr) esd_heap_free(ptr)
 #endif
 
 #ifndef esd_scope
@@ -235,6 +255,26 @@ ESD_FUNCTION(Esd_Noop, Attributes = ESD_CORE_EXPORT, Category = _GroupHidden)
 ESD_PARAMETER(context, Type = void *)
 ESD_CORE_EXPORT void Esd_Noop(void *context);
 
+/* Emit a signal from the update, render or idle path of a widget.
+Signals nobody connected are left at Esd_Noop by the generated initializer,
+and are skipped here instead of making the indirect call */
+#define ESD_SIGNAL_EMIT(object, name, owner) \
+	do                                       \
+	{                                        \
+		if ((object)->name != Esd_Noop)      \
+			(object)->name(owner);           \
+	} while (0)
+
+/* Marker for an input bound to a constant.
+The value is stored in the <name>__Value field next to the input, and read
+by ESD_INPUT_VALUE without calling through the property function pointer.
+Inputs not set with ESD_INPUT_CONSTANT are called as usual */
+ESD_CORE_EXPORT void Esd_ConstantInput(void *context);
+#define ESD_INPUT_CONSTANT(object, name, value) \
+	(*(Esd_Callback *)&(object)->name = Esd_ConstantInput, (object)->name##__Value = (value))
+#define ESD_INPUT_VALUE(object, name, owner) \
+	((*(Esd_Callback *)&(object)->name == Esd_ConstantInput) ? (object)->name##__Value : (object)->name(owner))
+
 #define ESD_LOOPSTATE_NONE 0
 #define ESD_LOOPSTATE_IDLE 1
 #define ESD_LOOPSTATE_UPDATE 2
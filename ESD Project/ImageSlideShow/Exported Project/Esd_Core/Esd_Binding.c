@@ -0,0 +1,102 @@
+
+#include "Esd_Binding.h"
+#include "Esd_Context.h"
+
+static Esd_BindingCell *s_Cells = NULL;
+
+ESD_CORE_EXPORT void Esd_Binding_Register(Esd_BindingCell *cell, uint8_t type)
+{
+	Esd_BindingCell *registered = s_Cells;
+	while (registered && registered != cell)
+		registered = registered->Next;
+
+	cell->Value.Int = 0;
+	if (type == ESD_BINDING_FLOAT)
+		cell->Value.Float = 0.0f;
+	cell->Type = type;
+	cell->Version = 0;
+	cell->Notified = 0;
+	if (registered)
+		return; // Keeps its subscriptions
+	cell->Subscribers = NULL;
+	cell->Next = s_Cells;
+	s_Cells = cell;
+}
+
+ESD_CORE_EXPORT void Esd_Binding_Unregister(Esd_BindingCell *cell)
+{
+	Esd_BindingCell **link = &s_Cells;
+	while (*link && *link != cell)
+		link = &(*link)->Next;
+	if (!*link)
+		return;
+	*link = cell->Next;
+	cell->Next = NULL;
+
+	while (cell->Subscribers)
+	{
+		Esd_BindingSubscription *subscription = cell->Subscribers;
+		cell->Subscribers = subscription->Next;
+		subscription->Next = NULL;
+		subscription->Cell = NULL;
+	}
+}
+
+ESD_CORE_EXPORT void Esd_Binding_UnregisterAll()
+{
+	while (s_Cells)
+		Esd_Binding_Unregister(s_Cells);
+}
+
+ESD_CORE_EXPORT void Esd_Binding_Subscribe(Esd_BindingSubscription *subscription, Esd_BindingCell *cell, void (*changed)(void *context), void *context)
+{
+	Esd_Binding_Unsubscribe(subscription);
+	subscription->Changed = changed;
+	subscription->Context = context;
+	subscription->Cell = cell;
+	subscription->Next = cell->Subscribers;
+	cell->Subscribers = subscription;
+}
+
+ESD_CORE_EXPORT void Esd_Binding_Unsubscribe(Esd_BindingSubscription *subscription)
+{
+	Esd_BindingSubscription **link;
+	if (!subscription->Cell)
+		return;
+
+	link = &subscription->Cell->Subscribers;
+	while (*link && *link != subscription)
+		link = &(*link)->Next;
+	if (*link)
+		*link = subscription->Next;
+	subscription->Next = NULL;
+	subscription->Cell = NULL;
+}
+
+ESD_CORE_EXPORT void Esd_Binding_Update()
+{
+	bool notified = false;
+
+	for (Esd_BindingCell *cell = s_Cells; cell; cell = cell->Next)
+	{
+		// Read once, a setter may increment it meanwhile and is then seen on the next update
+		uint32_t version = cell->Version;
+		if (version == cell->Notified)
+			continue;
+		cell->Notified = version;
+
+		// The callback may unsubscribe itself
+		for (Esd_BindingSubscription *subscription = cell->Subscribers, *next; subscription; subscription = next)
+		{
+			next = subscription->Next;
+			subscription->Changed(subscription->Context);
+			notified = true;
+		}
+	}
+
+	// Subscribers other than widgets may only update state that gets rendered
+	if (notified)
+		Esd_Invalidate();
+}
+
+/* end of file */
@@ -0,0 +1,117 @@
+
+#ifndef ESD_BINDING__H
+#define ESD_BINDING__H
+
+#include "Esd_Base.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+Data binding.
+An Esd_BindingCell holds one typed value coming from outside the UI, such as a Modbus holding
+register, with a version counter that the setters increment only when the value actually changes.
+Widgets subscribe to the cells they display. Once per frame, after the Update callback, Esd_Update
+compares the version of each registered cell against the version last notified, and calls Changed
+on the subscriptions of the cells which differ, Ft_Esd_Widget_Bind damages the bound widget.
+Widgets bound to cells that did not change are left alone, so cached subtrees keep replaying and
+with SkipIdleFrames the frame is not rendered at all.
+
+The setters only store the value and increment the version, so they can be called from the
+on_write hook of the Modbus engine, or from an interrupt for a single 32 bit cell.
+Cells and subscriptions are owned by the caller and must stay valid while registered,
+subscriptions start out zero initialized.
+*/
+
+#define ESD_BINDING_INT 0
+#define ESD_BINDING_FLOAT 1
+#define ESD_BINDING_BOOL 2
+
+struct Esd_BindingSubscription;
+
+typedef struct Esd_BindingCell
+{
+	struct Esd_BindingCell *Next;
+	struct Esd_BindingSubscription *Subscribers;
+	volatile uint32_t Version; // Incremented by the setters on every change
+	uint32_t Notified; // Version the subscribers were last called for
+	union
+	{
+		int32_t Int;
+		float Float;
+	} Value;
+	uint8_t Type;
+} Esd_BindingCell;
+
+typedef struct Esd_BindingSubscription
+{
+	struct Esd_BindingSubscription *Next;
+	Esd_BindingCell *Cell; // NULL when not subscribed
+	void (*Changed)(void *context);
+	void *Context;
+} Esd_BindingSubscription;
+
+// Resets the cell to a zero value of the given type and adds it to the cells checked by Esd_Update
+ESD_CORE_EXPORT void Esd_Binding_Register(Esd_BindingCell *cell, uint8_t type);
+
+// Removes the cell from the checked cells and drops its subscriptions
+ESD_CORE_EXPORT void Esd_Binding_Unregister(Esd_BindingCell *cell);
+
+// Calls changed with context on every change of the cell, from Esd_Update. Resubscribes when already subscribed
+ESD_CORE_EXPORT void Esd_Binding_Subscribe(Esd_BindingSubscription *subscription, Esd_BindingCell *cell, void (*changed)(void *context), void *context);
+
+// Does nothing when not subscribed
+ESD_CORE_EXPORT void Esd_Binding_Unsubscribe(Esd_BindingSubscription *subscription);
+
+// Removes all cells and their subscriptions, called from Esd_Stop
+ESD_CORE_EXPORT void Esd_Binding_UnregisterAll();
+
+// Notifies the subscribers of cells that changed since the last update, called from Esd_Update
+ESD_CORE_EXPORT void Esd_Binding_Update();
+
+static inline void Esd_Binding_SetInt(Esd_BindingCell *cell, int32_t value)
+{
+	if (cell->Value.Int != value)
+	{
+		cell->Value.Int = value;
+		++cell->Version;
+	}
+}
+
+static inline void Esd_Binding_SetFloat(Esd_BindingCell *cell, float value)
+{
+	if (cell->Value.Float != value)
+	{
+		cell->Value.Float = value;
+		++cell->Version;
+	}
+}
+
+static inline void Esd_Binding_SetBool(Esd_BindingCell *cell, bool value)
+{
+	Esd_Binding_SetInt(cell, value ? 1 : 0);
+}
+
+static inline int32_t Esd_Binding_GetInt(Esd_BindingCell *cell)
+{
+	return cell->Type == ESD_BINDING_FLOAT ? (int32_t)cell->Value.Float : cell->Value.Int;
+}
+
+static inline float Esd_Binding_GetFloat(Esd_BindingCell *cell)
+{
+	return cell->Type == ESD_BINDING_FLOAT ? cell->Value.Float : (float)cell->Value.Int;
+}
+
+static inline bool Esd_Binding_GetBool(Esd_BindingCell *cell)
+{
+	return Esd_Binding_GetInt(cell) != 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* #ifndef ESD_BINDING__H */
+
+/* end of file */
@@ -5,6 +5,7 @@ Author: Jan Boon <jan.boon@kaetemi.be>
 */
 
 #include "Esd_BitmapHandle.h"
+#include "Esd_AsyncLoad.h"
 #include "Esd_Context.h"
 
 // Number of bitmap handles to use (and also the scratch handle)
@@ -27,47 +28,33 @@ Author: Jan Boon <jan.boon@kaetemi.be>
 #define ESD_ROMFONT_MIN 16UL // Min, rom font handle, inclusive
 #define ESD_ROMFONT_NBCAP (ESD_ROMFONT_CAP - ESD_ROMFONT_MIN)
 #define ESD_ROMFONT_NB (ESD_ROMFONT_MAX - ESD_ROMFONT_MIN)
-#if defined(_MSC_VER) && (_MSC_VER < 1800)
-/* Designated initializers not supported in older Visual Studio versions */
-static Esd_RomFontInfo s_RomFonts[ESD_ROMFONT_NBCAP] = {
-	{ 0, ESD_FONT_ROM, 16UL, 0, 0, 0 },
-	{ 0, ESD_FONT_ROM, 17UL, 0, 0, 0 },
-	{ 0, ESD_FONT_ROM, 18UL, 0, 0, 0 },
-	{ 0, ESD_FONT_ROM, 19UL, 0, 0, 0 },
-	{ 0, ESD_FONT_ROM, 20UL, 0, 0, 0 },
-	{ 0, ESD_FONT_ROM, 21UL, 0, 0, 0 },
-	{ 0, ESD_FONT_ROM, 22UL, 0, 0, 0 },
-	{ 0, ESD_FONT_ROM, 23UL, 0, 0, 0 },
-	{ 0, ESD_FONT_ROM, 24UL, 0, 0, 0 },
-	{ 0, ESD_FONT_ROM, 25UL, 0, 0, 0 },
-	{ 0, ESD_FONT_ROM, 26UL, 0, 0, 0 },
-	{ 0, ESD_FONT_ROM, 27UL, 0, 0, 0 },
-	{ 0, ESD_FONT_ROM, 28UL, 0, 0, 0 },
-	{ 0, ESD_FONT_ROM, 29UL, 0, 0, 0 },
-	{ 0, ESD_FONT_ROM, 30UL, 0, 0, 0 },
-	{ 0, ESD_FONT_ROM, 31UL, 0, 0, 0 },
-};
+#if EVE_SINGLE_TARGET_FT811
+// Heights of the FT811 ROM fonts as found in its font metric blocks. These are fixed per chip, so the
+// single target build does not read them at boot, and the metrics are valid before the first frame
+#define ESD_ROMFONT_INIT(font, height) { 0, ESD_FONT_ROM, font, height, height, height, 0 }
 #else
+#define ESD_ROMFONT_INIT(font, height) { 0, ESD_FONT_ROM, font, 0, 0, 0, 0 }
+#endif
 static Esd_RomFontInfo s_RomFonts[ESD_ROMFONT_NBCAP] = {
-	{ .Type = ESD_FONT_ROM, .RomFont = 16UL },
-	{ .Type = ESD_FONT_ROM, .RomFont = 17UL },
-	{ .Type = ESD_FONT_ROM, .RomFont = 18UL },
-	{ .Type = ESD_FONT_ROM, .RomFont = 19UL },
-	{ .Type = ESD_FONT_ROM, .RomFont = 20UL },
-	{ .Type = ESD_FONT_ROM, .RomFont = 21UL },
-	{ .Type = ESD_FONT_ROM, .RomFont = 22UL },
-	{ .Type = ESD_FONT_ROM, .RomFont = 23UL },
-	{ .Type = ESD_FONT_ROM, .RomFont = 24UL },
-	{ .Type = ESD_FONT_ROM, .RomFont = 25UL },
-	{ .Type = ESD_FONT_ROM, .RomFont = 26UL },
-	{ .Type = ESD_FONT_ROM, .RomFont = 27UL },
-	{ .Type = ESD_FONT_ROM, .RomFont = 28UL },
-	{ .Type = ESD_FONT_ROM, .RomFont = 29UL },
-	{ .Type = ESD_FONT_ROM, .RomFont = 30UL },
-	{ .Type = ESD_FONT_ROM, .RomFont = 31UL },
+	ESD_ROMFONT_INIT(16UL, 8),
+	ESD_ROMFONT_INIT(17UL, 8),
+	ESD_ROMFONT_INIT(18UL, 16),
+	ESD_ROMFONT_INIT(19UL, 16),
+	ESD_ROMFONT_INIT(20UL, 13),
+	ESD_ROMFONT_INIT(21UL, 17),
+	ESD_ROMFONT_INIT(22UL, 20),
+	ESD_ROMFONT_INIT(23UL, 22),
+	ESD_ROMFONT_INIT(24UL, 29),
+	ESD_ROMFONT_INIT(25UL, 38),
+	ESD_ROMFONT_INIT(26UL, 16),
+	ESD_ROMFONT_INIT(27UL, 20),
+	ESD_ROMFONT_INIT(28UL, 25),
+	ESD_ROMFONT_INIT(29UL, 28),
+	ESD_ROMFONT_INIT(30UL, 36),
+	ESD_ROMFONT_INIT(31UL, 49),
 };
-#endif
 
+#if !EVE_SINGLE_TARGET_FT811
 static void Esd_InitRomFontHeight()
 {
 	int i;
@@ -82,6 +69,7 @@ static void Esd_InitRomFontHeight()
 		s_RomFonts[i].CapsHeight = s_RomFonts[i].FontHeight;
 	}
 }
+#endif
 
 ESD_CORE_EXPORT uint16_t Esd_GetFontHeight(Esd_FontInfo *fontInfo)
 {
@@ -114,7 +102,9 @@ ESD_CORE_EXPORT uint16_t Esd_GetFontXOffset(Esd_FontInfo *fontInfo)
 void Esd_BitmapHandle_Initialize()
 {
 	// memset(Esd_BitmapHandleGpuHandle, 0, sizeof(Esd_BitmapHandleGpuHandle));
+#if !EVE_SINGLE_TARGET_FT811
 	Esd_InitRomFontHeight();
+#endif
 }
 
 ESD_CORE_EXPORT void Esd_BitmapHandle_FrameStart(Esd_HandleState *handleState)
@@ -168,6 +158,42 @@ ESD_CORE_EXPORT uint32_t Esd_BitmapHandle_GetTotal()
 	return ESD_BITMAPHANDLE_NB - 1; // NB minus one used for scratch
 }
 
+ESD_CORE_EXPORT uint32_t Esd_BitmapHandle_GetHits()
+{
+	return Esd_CurrentContext->HandleState.Hits;
+}
+
+ESD_CORE_EXPORT uint32_t Esd_BitmapHandle_GetMisses()
+{
+	return Esd_CurrentContext->HandleState.Misses;
+}
+
+/// Find the free handle that was least recently used, so bitmaps which were on screen recently keep their setup. Returns the scratch handle when none are free
+static uint32_t Esd_BitmapHandle_FindFree(Esd_HandleState *handleState)
+{
+	EVE_HalContext *phost = Esd_GetHost();
+	uint32_t handle = ESD_SCRATCHHANDLE; // Fallback to scratch handle
+	uint32_t age = 0;
+	uint32_t i;
+
+	for (i = 0; i < ESD_BITMAPHANDLE_NB; ++i)
+	{
+		if ((i != ESD_SCRATCHHANDLE) && (!handleState->Use[i]))
+		{
+			uint32_t a = Esd_CurrentContext->Frame - handleState->LastUse[i];
+			if (!handleState->Info[i])
+				a = UINT32_MAX; // Never used
+			if (handle == ESD_SCRATCHHANDLE || a > age)
+			{
+				handle = i;
+				age = a;
+			}
+		}
+	}
+
+	return handle;
+}
+
 ESD_CORE_EXPORT Esd_FontInfo *Esd_GetRomFont(uint8_t font)
 {
 	EVE_HalContext *phost = Esd_GetHost();
@@ -209,6 +235,43 @@ ESD_CORE_EXPORT void Esd_CoDl_PagedCell(uint8_t handle, uint16_t cell)
 	EVE_CoDl_cell(phost, cell & 0x7F);
 }
 
+#if ESD_BITMAP_SETUP_APPEND
+/// Set the bitmap on the current handle, replaying the recorded setup when the bitmap has not moved
+static void Esd_CoDl_AppendSetBitmap(EVE_HalContext *phost, Esd_BitmapInfo *bitmapInfo, uint32_t addr, uint32_t format)
+{
+	uint32_t setupAddr = Esd_GpuAlloc_Get(Esd_GAlloc, bitmapInfo->SetupGpuHandle);
+	uint16_t start, end;
+
+	if (setupAddr != GA_INVALID && bitmapInfo->SetupAddress == addr)
+	{
+		EVE_CoCmd_append(phost, setupAddr, bitmapInfo->SetupSize);
+		return;
+	}
+
+	/* Record, the coprocessor must have caught up to find where the setup starts */
+	Esd_GpuAlloc_Free(Esd_GAlloc, bitmapInfo->SetupGpuHandle);
+	bitmapInfo->SetupGpuHandle = GA_HANDLE_INVALID;
+	EVE_Cmd_waitFlush(phost);
+	start = EVE_Hal_rd16(phost, REG_CMD_DL);
+	EVE_CoCmd_setBitmap(phost, addr, format, bitmapInfo->Width, bitmapInfo->Height);
+	EVE_Cmd_waitFlush(phost);
+	if (phost->CmdFault)
+		return;
+	end = EVE_Hal_rd16(phost, REG_CMD_DL);
+	if (end <= start)
+		return;
+
+	bitmapInfo->SetupGpuHandle = Esd_GpuAlloc_Alloc(Esd_GAlloc, end - start, GA_GC_FLAG);
+	setupAddr = Esd_GpuAlloc_Get(Esd_GAlloc, bitmapInfo->SetupGpuHandle);
+	if (setupAddr == GA_INVALID)
+		return; /* Out of RAM_G, keep using CMD_SETBITMAP */
+
+	EVE_CoCmd_memCpy(phost, setupAddr, RAM_DL + start, end - start);
+	bitmapInfo->SetupAddress = addr;
+	bitmapInfo->SetupSize = end - start;
+}
+#endif
+
 ESD_CORE_EXPORT uint8_t Esd_CoDl_SetupBitmap(Esd_BitmapInfo *bitmapInfo)
 {
 	// Get bitmap address
@@ -227,7 +290,6 @@ ESD_CORE_EXPORT uint8_t Esd_CoDl_SetupBitmap(Esd_BitmapInfo *bitmapInfo)
 	        && (Esd_CurrentContext->HandleState.GpuHandle[handle].Id == bitmapInfo->GpuHandle.Id)
 	        && (Esd_CurrentContext->HandleState.GpuHandle[handle].Seq == bitmapInfo->GpuHandle.Seq)))
 	{
-		uint32_t i;
 		uint32_t format;
 
 		// Bitmap is loaded but no handle is setup, create a new handle for this bitmap
@@ -240,18 +302,14 @@ ESD_CORE_EXPORT uint8_t Esd_CoDl_SetupBitmap(Esd_BitmapInfo *bitmapInfo)
 		}
 
 		// Find a free handle
-		handle = ESD_SCRATCHHANDLE; // Fallback to scratch handle
-		for (i = 0; i < ESD_BITMAPHANDLE_NB; ++i)
+		++Esd_CurrentContext->HandleState.Misses;
+		handle = Esd_BitmapHandle_FindFree(&Esd_CurrentContext->HandleState);
+		if (handle != ESD_SCRATCHHANDLE)
 		{
-			if ((i != ESD_SCRATCHHANDLE) && (!Esd_CurrentContext->HandleState.Use[i]))
-			{
-				// Attach this handle to the bitmap info
-				handle = i;
-				Esd_CurrentContext->HandleState.Info[i] = bitmapInfo;
-				Esd_CurrentContext->HandleState.Address[i] = addr;
-				Esd_CurrentContext->HandleState.GpuHandle[i] = bitmapInfo->GpuHandle;
-				break;
-			}
+			// Attach this handle to the bitmap info
+			Esd_CurrentContext->HandleState.Info[handle] = bitmapInfo;
+			Esd_CurrentContext->HandleState.Address[handle] = addr;
+			Esd_CurrentContext->HandleState.GpuHandle[handle] = bitmapInfo->GpuHandle;
 		}
 
 #ifdef ESD_LITTLEFS_FLASH
@@ -302,7 +360,12 @@ ESD_CORE_EXPORT uint8_t Esd_CoDl_SetupBitmap(Esd_BitmapInfo *bitmapInfo)
 		}
 		if (EVE_CHIPID >= EVE_FT810)
 		{
-			EVE_CoCmd_setBitmap(phost, addr, format, bitmapInfo->Width, bitmapInfo->Height); // Only support padded (rounded up) stride as calculated by CMD_SETBITMAP
+#if ESD_BITMAP_SETUP_APPEND
+			if (bitmapInfo->Persistent)
+				Esd_CoDl_AppendSetBitmap(phost, bitmapInfo, addr, format);
+			else
+#endif
+				EVE_CoCmd_setBitmap(phost, addr, format, bitmapInfo->Width, bitmapInfo->Height); // Only support padded (rounded up) stride as calculated by CMD_SETBITMAP
 		}
 			
 		else
@@ -315,6 +378,10 @@ ESD_CORE_EXPORT uint8_t Esd_CoDl_SetupBitmap(Esd_BitmapInfo *bitmapInfo)
 		Esd_CurrentContext->HandleState.Resized[handle] = 0;
 		Esd_CurrentContext->HandleState.Page[handle] = 0;
 	}
+	else
+	{
+		++Esd_CurrentContext->HandleState.Hits;
+	}
 
 	// TEMPORARY WORKAROUND: SetBitmap not correctly being applied some frames... Need to check!
 	// EVE_CoDl_bitmapHandle(handle);
@@ -328,6 +395,7 @@ ESD_CORE_EXPORT uint8_t Esd_CoDl_SetupBitmap(Esd_BitmapInfo *bitmapInfo)
 	if (ESD_BITMAPHANDLE_VALID(handle) && (handle != ESD_SCRATCHHANDLE)) // When valid and not using scratch handle
 	{
 		Esd_CurrentContext->HandleState.Use[handle] = 2; // In use
+		Esd_CurrentContext->HandleState.LastUse[handle] = Esd_CurrentContext->Frame;
 	}
 
 	if (EVE_CHIPID >= EVE_FT810)
@@ -358,6 +426,50 @@ ESD_CORE_EXPORT uint8_t Esd_CoDl_SetupBitmap(Esd_BitmapInfo *bitmapInfo)
 	return handle;
 }
 
+ESD_CORE_EXPORT uint8_t Esd_CoDl_SetupLoadingBitmap(Esd_BitmapInfo *bitmapInfo, uint16_t cell)
+{
+#if ESD_ASYNCLOAD_PROGRESSIVE
+	EVE_HalContext *phost = Esd_GetHost();
+	uint32_t addr;
+	uint32_t uploaded;
+	uint32_t cellSize;
+	uint32_t rows;
+
+	// Only formats drawn directly from a single handle, with the rows stored top to bottom
+	if (!bitmapInfo->Loading || bitmapInfo->AdditionalInfo || bitmapInfo->Stride <= 0
+	    || ESD_IS_FORMAT_PALETTED(bitmapInfo->Format) || ESD_IS_FORMAT_ASTC(bitmapInfo->Format)
+	    || bitmapInfo->Format == DXT1 || bitmapInfo->Format == DXT1L2
+	    || bitmapInfo->Format == JPEG || bitmapInfo->Format == PNG)
+		return ESD_BITMAPHANDLE_INVALID;
+
+	if (Esd_CurrentContext->LoopState != ESD_LOOPSTATE_RENDER || EVE_CHIPID < EVE_FT810)
+		return ESD_BITMAPHANDLE_INVALID;
+
+	uploaded = Esd_AsyncLoad_Uploaded(bitmapInfo);
+	cellSize = (uint32_t)bitmapInfo->Stride * bitmapInfo->Height;
+	if (uploaded <= cell * cellSize || Esd_GpuAlloc_IsMoving(Esd_GAlloc, bitmapInfo->GpuHandle))
+		return ESD_BITMAPHANDLE_INVALID;
+	addr = Esd_GpuAlloc_Get(Esd_GAlloc, bitmapInfo->GpuHandle);
+	if (addr == GA_INVALID)
+		return ESD_BITMAPHANDLE_INVALID;
+
+	rows = min((uploaded - cell * cellSize) / (uint32_t)bitmapInfo->Stride, (uint32_t)bitmapInfo->Height);
+	if (!rows)
+		return ESD_BITMAPHANDLE_INVALID;
+
+	// The layout height is clamped to the uploaded rows, the rest of the bitmap is not drawn
+	EVE_CoDl_bitmapHandle(phost, ESD_SCRATCHHANDLE);
+	EVE_CoCmd_setBitmap(phost, addr + cell * cellSize, bitmapInfo->Format, bitmapInfo->Width, (uint16_t)rows);
+	Esd_CurrentContext->HandleState.Resized[ESD_SCRATCHHANDLE] = 0;
+	Esd_CurrentContext->HandleState.Page[ESD_SCRATCHHANDLE] = 0;
+	return ESD_SCRATCHHANDLE;
+#else
+	(void)bitmapInfo;
+	(void)cell;
+	return ESD_BITMAPHANDLE_INVALID;
+#endif
+}
+
 ESD_CORE_EXPORT uint8_t Esd_CoDl_SetupRomFont(uint8_t font)
 {
 	return Esd_CoDl_SetupFont(Esd_GetRomFont(font));
@@ -390,7 +502,6 @@ ESD_CORE_EXPORT uint8_t Esd_CoDl_SetupFont(Esd_FontInfo *fontInfo)
 			    || (Esd_CurrentContext->HandleState.GpuHandle[handle].Id != MAX_NUM_ALLOCATIONS)
 			    || (Esd_CurrentContext->HandleState.GpuHandle[handle].Seq != font))
 			{
-				uint32_t i;
 				// The handle is no longer valid, make a new one
 
 				if (Esd_CurrentContext->LoopState != ESD_LOOPSTATE_RENDER)
@@ -400,6 +511,7 @@ ESD_CORE_EXPORT uint8_t Esd_CoDl_SetupFont(Esd_FontInfo *fontInfo)
 				}
 
 				// Find a free handle
+				++Esd_CurrentContext->HandleState.Misses;
 				handle = font;
 				if (handle < ESD_BITMAPHANDLE_NB && (handle != ESD_SCRATCHHANDLE) && (!Esd_CurrentContext->HandleState.Use[handle]))
 				{
@@ -409,18 +521,13 @@ ESD_CORE_EXPORT uint8_t Esd_CoDl_SetupFont(Esd_FontInfo *fontInfo)
 				}
 				else
 				{
-					handle = ESD_SCRATCHHANDLE; // Fallback to scratch handle
-					for (i = 0; i < ESD_BITMAPHANDLE_NB; ++i)
+					handle = Esd_BitmapHandle_FindFree(&Esd_CurrentContext->HandleState);
+					if (handle != ESD_SCRATCHHANDLE)
 					{
-						if ((i != ESD_SCRATCHHANDLE) && (!Esd_CurrentContext->HandleState.Use[i]))
-						{
-							// Attach this handle to the bitmap info
-							handle = i;
-							Esd_CurrentContext->HandleState.Info[i] = romFontInfo;
-							Esd_CurrentContext->HandleState.GpuHandle[i].Id = MAX_NUM_ALLOCATIONS;
-							Esd_CurrentContext->HandleState.GpuHandle[i].Seq = font;
-							break;
-						}
+						// Attach this handle to the bitmap info
+						Esd_CurrentContext->HandleState.Info[handle] = romFontInfo;
+						Esd_CurrentContext->HandleState.GpuHandle[handle].Id = MAX_NUM_ALLOCATIONS;
+						Esd_CurrentContext->HandleState.GpuHandle[handle].Seq = font;
 					}
 				}
 
@@ -435,6 +542,10 @@ ESD_CORE_EXPORT uint8_t Esd_CoDl_SetupFont(Esd_FontInfo *fontInfo)
 				Esd_CurrentContext->HandleState.Resized[handle] = 0;
 				Esd_CurrentContext->HandleState.Page[handle] = 0;
 			}
+			else
+			{
+				++Esd_CurrentContext->HandleState.Hits;
+			}
 		}
 		else
 		{
@@ -456,7 +567,6 @@ ESD_CORE_EXPORT uint8_t Esd_CoDl_SetupFont(Esd_FontInfo *fontInfo)
 		    || (Esd_CurrentContext->HandleState.GpuHandle[handle].Id != fontInfo->FontResource.GpuHandle.Id)
 		    || (Esd_CurrentContext->HandleState.GpuHandle[handle].Seq != fontInfo->FontResource.GpuHandle.Seq))
 		{
-			uint32_t i;
 
 			// The handle is no longer valid, make a new one
 
@@ -467,18 +577,14 @@ ESD_CORE_EXPORT uint8_t Esd_CoDl_SetupFont(Esd_FontInfo *fontInfo)
 			}
 
 			// Find a free handle
-			handle = ESD_SCRATCHHANDLE; // Fallback to scratch handle
-			for (i = 0; i < ESD_BITMAPHANDLE_NB; ++i)
+			++Esd_CurrentContext->HandleState.Misses;
+			handle = Esd_BitmapHandle_FindFree(&Esd_CurrentContext->HandleState);
+			if (handle != ESD_SCRATCHHANDLE)
 			{
-				if ((i != ESD_SCRATCHHANDLE) && (!Esd_CurrentContext->HandleState.Use[i]))
-				{
-					// Attach this handle to the font info
-					handle = i;
-					Esd_CurrentContext->HandleState.Info[i] = fontInfo;
-					Esd_CurrentContext->HandleState.Address[i] = addr;
-					Esd_CurrentContext->HandleState.GpuHandle[i] = fontInfo->FontResource.GpuHandle;
-					break;
-				}
+				// Attach this handle to the font info
+				Esd_CurrentContext->HandleState.Info[handle] = fontInfo;
+				Esd_CurrentContext->HandleState.Address[handle] = addr;
+				Esd_CurrentContext->HandleState.GpuHandle[handle] = fontInfo->FontResource.GpuHandle;
 			}
 
 #ifdef ESD_LITTLEFS_FLASH
@@ -512,11 +618,16 @@ ESD_CORE_EXPORT uint8_t Esd_CoDl_SetupFont(Esd_FontInfo *fontInfo)
 			Esd_CurrentContext->HandleState.Resized[handle] = 0;
 			Esd_CurrentContext->HandleState.Page[handle] = 0;
 		}
+		else
+		{
+			++Esd_CurrentContext->HandleState.Hits;
+		}
 	}
 
 	if (ESD_BITMAPHANDLE_VALID(handle) && (handle != ESD_SCRATCHHANDLE)) // When valid and not using scratch handle
 	{
 		Esd_CurrentContext->HandleState.Use[handle] = 2; // In use
+		Esd_CurrentContext->HandleState.LastUse[handle] = Esd_CurrentContext->Frame;
 	}
 
 	return handle;
@@ -548,4 +659,93 @@ ESD_CORE_EXPORT void Esd_CoDl_BitmapSizeReset(uint8_t handle)
 	}
 }
 
+// Words of the identity transform, as after CMD_LOADIDENTITY and CMD_SETMATRIX
+static const uint32_t s_IdentityTransform[6] = {
+	BITMAP_TRANSFORM_A(256), BITMAP_TRANSFORM_B(0), BITMAP_TRANSFORM_C(0),
+	BITMAP_TRANSFORM_D(0), BITMAP_TRANSFORM_E(256), BITMAP_TRANSFORM_F(0)
+};
+
+ESD_CORE_EXPORT void Esd_CoDl_BeginTransform(Esd_TransformState *state)
+{
+	EVE_HalContext *phost = Esd_GetHost();
+	int i;
+#if EVE_DL_OPTIMIZE
+	if (!EVE_DL_STATE.BitmapTransform)
+	{
+		for (i = 0; i < 6; ++i)
+			state->Words[i] = s_IdentityTransform[i];
+		state->Saved = false;
+		return;
+	}
+#endif
+	// Unknown transform, written in full
+	EVE_CoDl_saveContext(phost);
+	for (i = 0; i < 6; ++i)
+		state->Words[i] = ~0UL;
+	state->Saved = true;
+}
+
+static void Esd_CoDl_TransformWords(Esd_TransformState *state, const uint32_t *words)
+{
+	EVE_HalContext *phost = Esd_GetHost();
+	int i;
+	for (i = 0; i < 6; ++i)
+	{
+		if (state->Words[i] != words[i])
+		{
+			EVE_CoCmd_dl(phost, words[i]);
+			state->Words[i] = words[i];
+		}
+	}
+}
+
+ESD_CORE_EXPORT void Esd_CoDl_Transform(Esd_TransformState *state, const Esd_Transform *transform)
+{
+	EVE_HalContext *phost = Esd_GetHost();
+	const int32_t *abde[4] = { &transform->A, &transform->B, &transform->D, &transform->E };
+	uint32_t v[4];
+	uint32_t words[6];
+	bool precise = EVE_CHIPID >= EVE_BT815;
+	int i;
+	(void)phost;
+
+	// Use the 1.15 format of BT815 when the scale allows, as CMD_SETMATRIX does, otherwise 8.8
+	for (i = 0; i < 4; ++i)
+	{
+		if (*abde[i] < -131072L || *abde[i] > 131071L)
+			precise = false;
+	}
+	for (i = 0; i < 4; ++i)
+	{
+		int32_t q = precise ? ((*abde[i] + 1) >> 1) : ((*abde[i] + 128) >> 8);
+		v[i] = (uint32_t)Esd_Int32_ClampedValue(q, -65536L, 65535L);
+	}
+	words[0] = BITMAP_TRANSFORM_A_EXT(precise, v[0]);
+	words[1] = BITMAP_TRANSFORM_B_EXT(precise, v[1]);
+	words[2] = BITMAP_TRANSFORM_C((transform->C + 128) >> 8);
+	words[3] = BITMAP_TRANSFORM_D_EXT(precise, v[2]);
+	words[4] = BITMAP_TRANSFORM_E_EXT(precise, v[3]);
+	words[5] = BITMAP_TRANSFORM_F((transform->F + 128) >> 8);
+	Esd_CoDl_TransformWords(state, words);
+#if EVE_DL_OPTIMIZE
+	EVE_DL_STATE.BitmapTransform = true;
+#endif
+}
+
+ESD_CORE_EXPORT void Esd_CoDl_EndTransform(Esd_TransformState *state)
+{
+	EVE_HalContext *phost = Esd_GetHost();
+	(void)phost;
+	if (state->Saved)
+	{
+		EVE_CoDl_restoreContext(phost);
+		return;
+	}
+	// Only undo the entries which were changed
+	Esd_CoDl_TransformWords(state, s_IdentityTransform);
+#if EVE_DL_OPTIMIZE
+	EVE_DL_STATE.BitmapTransform = false;
+#endif
+}
+
 /* end of file */
@@ -10,6 +10,7 @@ Author: Jan Boon <jan.boon@kaetemi.be>
 #include "Esd_Base.h"
 #include "Esd_BitmapInfo.h"
 #include "Esd_FontInfo.h"
+#include "Esd_Math.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -26,6 +27,13 @@ typedef struct
 	bool Resized[ESD_BITMAPHANDLE_CAP];
 	uint8_t Page[ESD_BITMAPHANDLE_CAP];
 
+	// Frame in which the handle was last used, free handles are reassigned least recently used first
+	uint32_t LastUse[ESD_BITMAPHANDLE_CAP];
+
+	// Number of setups which were skipped because the handle was still set up, and which had to be sent
+	uint32_t Hits;
+	uint32_t Misses;
+
 } Esd_HandleState;
 
 /// Initialize bitmap handle tracking globally
@@ -40,6 +48,10 @@ ESD_CORE_EXPORT void Esd_BitmapHandle_Reset(Esd_HandleState *state);
 ESD_CORE_EXPORT uint32_t Esd_BitmapHandle_GetTotalUsed();
 ESD_CORE_EXPORT uint32_t Esd_BitmapHandle_GetTotal();
 
+/// Number of bitmap and font setups that were skipped, or sent, since the handle state was reset
+ESD_CORE_EXPORT uint32_t Esd_BitmapHandle_GetHits();
+ESD_CORE_EXPORT uint32_t Esd_BitmapHandle_GetMisses();
+
 ESD_FUNCTION(Esd_GetRomFont, Type = Esd_FontInfo *, Attributes = ESD_CORE_EXPORT, DisplayName = "Get ROM Font", Category = EsdUtilities)
 ESD_PARAMETER(i, Type = uint8_t, DisplayName = "ROM Font", Default = 0, Min = 16, Max = 34)
 ESD_CORE_EXPORT Esd_FontInfo *Esd_GetRomFont(uint8_t font);
@@ -55,6 +67,10 @@ ESD_FUNCTION(Esd_CoDl_SetupBitmap, Type = uint8_t, Attributes = ESD_CORE_EXPORT,
 ESD_PARAMETER(bitmapInfo, Type = Esd_BitmapInfo *)
 ESD_CORE_EXPORT uint8_t Esd_CoDl_SetupBitmap(Esd_BitmapInfo *bitmapInfo);
 
+// Sets up the scratch handle with the rows of a cell uploaded so far by the background loader, see ESD_ASYNCLOAD_PROGRESSIVE.
+// Returns an invalid handle when nothing can be drawn yet. The cell is selected by the bitmap source, draw it as cell 0
+ESD_CORE_EXPORT uint8_t Esd_CoDl_SetupLoadingBitmap(Esd_BitmapInfo *bitmapInfo, uint16_t cell);
+
 // Prepares a valid handle for a font. Call during render to get font handle. Does not necessarily change the current bitmap handle, but may change it
 ESD_FUNCTION(Esd_CoDl_SetupRomFont, Type = uint8_t, Attributes = ESD_CORE_EXPORT, DisplayName = "Setup ROM Font", Category = EveRenderFunctions, Include = "Esd_Core.h")
 ESD_PARAMETER(font, Type = uint8_t)
@@ -69,6 +85,22 @@ ESD_CORE_EXPORT void Esd_CoDl_BitmapWidthHeight(uint8_t handle, uint16_t width,
 ESD_CORE_EXPORT void Esd_CoDl_BitmapSize(uint8_t handle, uint8_t filter, uint8_t wrapx, uint8_t wrapy, uint16_t width, uint16_t height);
 ESD_CORE_EXPORT void Esd_CoDl_BitmapSizeReset(uint8_t handle);
 
+// BITMAP_TRANSFORM_A to F written between Esd_CoDl_BeginTransform and Esd_CoDl_EndTransform, as display list commands
+typedef struct
+{
+	uint32_t Words[6];
+	bool Saved; // Transform was unknown, restored with RESTORE_CONTEXT
+} Esd_TransformState;
+
+// Start writing transforms, replaces SAVE_CONTEXT when the current transform is the identity
+ESD_CORE_EXPORT void Esd_CoDl_BeginTransform(Esd_TransformState *state);
+
+// Write the transform computed on the host, instead of CMD_SETMATRIX. Only the entries which differ are written
+ESD_CORE_EXPORT void Esd_CoDl_Transform(Esd_TransformState *state, const Esd_Transform *transform);
+
+// Return to the transform from before Esd_CoDl_BeginTransform
+ESD_CORE_EXPORT void Esd_CoDl_EndTransform(Esd_TransformState *state);
+
 ESD_FUNCTION(Esd_GetFontHeight, Type = uint16_t, Attributes = ESD_CORE_EXPORT, DisplayName = "Get Font Height", Category = EsdUtilities)
 ESD_PARAMETER(fontInfo, Type = Esd_FontInfo *)
 ESD_CORE_EXPORT uint16_t Esd_GetFontHeight(Esd_FontInfo *fontInfo);
@@ -3,6 +3,7 @@
 #include "Esd_Context.h"
 
 #include "Esd_GpuAlloc.h"
+#include "Esd_AsyncLoad.h"
 
 #ifndef NDEBUG
 #define ESD_BITMAPINFO_DEBUG
@@ -257,6 +258,13 @@ ESD_CORE_EXPORT uint32_t Esd_LoadBitmapEx(Esd_BitmapInfo *bitmapInfo, uint8_t *m
 		return GA_INVALID;
 	}
 
+	if (bitmapInfo->Loading)
+	{
+		// Still being uploaded in the background
+		Esd_AsyncLoad_Touch(bitmapInfo);
+		return GA_INVALID;
+	}
+
 	// Get address of specified handle
 	// eve_printf_debug("%i: %i\n", bitmapInfo->GpuHandle.Id, bitmapInfo->GpuHandle.Seq);
 	addr = Esd_GpuAlloc_Get(Esd_GAlloc, bitmapInfo->GpuHandle);
@@ -318,8 +326,11 @@ ESD_CORE_EXPORT uint32_t Esd_LoadBitmapEx(Esd_BitmapInfo *bitmapInfo, uint8_t *m
 		Esd_LoadBitmapMetadata(bitmapInfo, metadata);
 
 		// Not loaded, load this bitmap
-		bitmapInfo->GpuHandle = Esd_GpuAlloc_Alloc(Esd_GAlloc, bitmapInfo->Size,
-		    (bitmapInfo->Persistent ? 0 : GA_GC_FLAG) | ((ESD_RESOURCE_IS_FLASH(bitmapInfo->Type) && ESD_RESOURCE_IS_PREFERRAM(bitmapInfo->Type)) ? GA_LOW_FLAG : 0));
+		if (bitmapInfo->Static)
+			bitmapInfo->GpuHandle = Esd_GpuAlloc_AllocStatic(Esd_GAlloc, bitmapInfo->StaticAddress, bitmapInfo->Size);
+		else
+			bitmapInfo->GpuHandle = Esd_GpuAlloc_Alloc(Esd_GAlloc, bitmapInfo->Size,
+			    (bitmapInfo->Persistent ? 0 : GA_GC_FLAG) | ((ESD_RESOURCE_IS_FLASH(bitmapInfo->Type) && ESD_RESOURCE_IS_PREFERRAM(bitmapInfo->Type)) ? GA_LOW_FLAG : 0));
 		addr = Esd_GpuAlloc_Get(Esd_GAlloc, bitmapInfo->GpuHandle);
 		if (addr != GA_INVALID)
 		{
@@ -344,6 +355,17 @@ ESD_CORE_EXPORT uint32_t Esd_LoadBitmapEx(Esd_BitmapInfo *bitmapInfo, uint8_t *m
 			eve_printf_debug("Allocated space for bitmap\n");
 #endif
 
+			// Plain file data can be uploaded in the background, the bitmap is not usable until done
+			if ((Esd_CurrentContext->AsyncLoad || Esd_CurrentContext->Preloading) && !video && !coLoad && (ESD_ASYNCLOAD_INFLATE || !bitmapInfo->Compressed)
+			    && bitmapInfo->Type == ESD_RESOURCE_FILE
+#ifdef ESD_COMPATIBILITY_ADDITIONALFILE
+			    && !bitmapInfo->AdditionalFile
+#endif
+			    && Esd_AsyncLoad_Queue(bitmapInfo))
+			{
+				return GA_INVALID;
+			}
+
 			// Allocation space OK
 			if (
 			    video ? (
@@ -387,6 +409,10 @@ ESD_CORE_EXPORT uint32_t Esd_LoadBitmapEx(Esd_BitmapInfo *bitmapInfo, uint8_t *m
 				}
 			}
 #endif
+
+			// Video frames are rewritten, other bitmaps are static once loaded
+			if (addr != GA_INVALID && !video)
+				Esd_GpuAlloc_Seal(Esd_GAlloc, bitmapInfo->GpuHandle);
 		}
 		else
 		{
@@ -411,6 +437,134 @@ ESD_CORE_EXPORT uint32_t Esd_LoadBitmap(Esd_BitmapInfo *bitmapInfo)
 	return Esd_LoadBitmapEx(bitmapInfo, metadata);
 }
 
+#if ESD_PALETTE_SHARED
+typedef struct
+{
+	uint32_t Hash;
+	uint32_t Size;
+	Esd_GpuHandle GpuHandle;
+	bool Persistent;
+} Esd_SharedPalette;
+
+static Esd_SharedPalette s_SharedPalettes[ESD_PALETTE_SHARED];
+static uint32_t s_SharedPaletteNext = 0;
+static uint8_t s_PaletteBuffer[256 * 4];
+#endif
+
+static Esd_ResourceInfo *s_PaletteSwap = NULL;
+
+ESD_CORE_EXPORT void Esd_PaletteSwap_Begin(Esd_ResourceInfo *palette)
+{
+	s_PaletteSwap = palette;
+}
+
+ESD_CORE_EXPORT void Esd_PaletteSwap_End()
+{
+	s_PaletteSwap = NULL;
+}
+
+// Load a palette from file or program memory, sharing RAM_G with a loaded palette of the same content
+static uint32_t Esd_LoadPaletteData(uint32_t type, eve_progmem_const uint8_t *progMem, const char *file, uint32_t size, bool persistent, Esd_GpuHandle *gpuHandle)
+{
+	EVE_HalContext *phost = Esd_GetHost();
+	uint32_t addr;
+	(void)phost;
+
+#if ESD_PALETTE_SHARED
+	Esd_SharedPalette *shared = NULL;
+	uint32_t hash = 2166136261UL;
+	uint32_t i;
+
+	// Hash the content, files are read once into the host buffer and written from there
+	if (type == ESD_RESOURCE_PROGMEM)
+	{
+		for (i = 0; i < size; ++i)
+		{
+			hash ^= progMem[i];
+			hash *= 16777619UL;
+		}
+	}
+	else
+	{
+		size = (uint32_t)EVE_Util_readFile(phost, s_PaletteBuffer, size, file);
+		if (!size)
+		{
+#ifdef ESD_BITMAPINFO_DEBUG
+			eve_printf_debug("Failed to load palette from file\n");
+#endif
+			return GA_INVALID;
+		}
+		for (i = 0; i < size; ++i)
+		{
+			hash ^= s_PaletteBuffer[i];
+			hash *= 16777619UL;
+		}
+	}
+
+	for (i = 0; i < ESD_PALETTE_SHARED; ++i)
+	{
+		Esd_SharedPalette *entry = &s_SharedPalettes[i];
+		if (Esd_GpuAlloc_Get(Esd_GAlloc, entry->GpuHandle) == GA_INVALID)
+		{
+			if (!shared)
+				shared = entry;
+			continue;
+		}
+		// A persistent bitmap cannot use a palette that may be garbage collected
+		if (entry->Hash == hash && entry->Size == size && (entry->Persistent || !persistent))
+		{
+			*gpuHandle = entry->GpuHandle;
+			return Esd_GpuAlloc_Get(Esd_GAlloc, entry->GpuHandle);
+		}
+	}
+	if (!shared)
+	{
+		// Table full, forget the oldest entry, its palette stays loaded for the bitmaps using it
+		shared = &s_SharedPalettes[s_SharedPaletteNext];
+		s_SharedPaletteNext = (s_SharedPaletteNext + 1) % ESD_PALETTE_SHARED;
+	}
+#endif
+
+	*gpuHandle = Esd_GpuAlloc_Alloc(Esd_GAlloc, size, persistent ? 0 : GA_GC_FLAG);
+	addr = Esd_GpuAlloc_Get(Esd_GAlloc, *gpuHandle);
+	if (addr == GA_INVALID)
+	{
+#ifdef ESD_BITMAPINFO_DEBUG
+		eve_printf_debug("Unable to allocate space for bitmap palette\n");
+#endif
+		return GA_INVALID;
+	}
+
+#ifdef ESD_BITMAPINFO_DEBUG
+	eve_printf_debug("Allocated space for bitmap palette\n");
+#endif
+	if (type == ESD_RESOURCE_PROGMEM)
+	{
+		EVE_Hal_wrProgMem(phost, addr, progMem, size); // Always succeeds
+	}
+#if ESD_PALETTE_SHARED
+	else
+	{
+		EVE_Hal_wrMem(phost, addr, s_PaletteBuffer, size);
+	}
+	shared->Hash = hash;
+	shared->Size = size;
+	shared->GpuHandle = *gpuHandle;
+	shared->Persistent = persistent;
+#else
+	else if (!EVE_Util_loadRawFile(phost, addr, file))
+	{
+#ifdef ESD_BITMAPINFO_DEBUG
+		eve_printf_debug("Failed to load palette from file\n");
+#endif
+		// Failed to load from file
+		Esd_GpuAlloc_Free(Esd_GAlloc, *gpuHandle);
+		addr = GA_INVALID;
+	}
+#endif
+	return addr;
+}
+
 ESD_CORE_EXPORT uint32_t Esd_LoadPalette(Esd_BitmapInfo *bitmapInfo)
 {
 	// eve_printf("Esd_LoadPalette %d\n", bitmapInfo->Type);
@@ -442,16 +596,21 @@ ESD_CORE_EXPORT uint32_t Esd_LoadPalette(Esd_BitmapInfo *bitmapInfo)
 
 	if (EVE_CHIPID >= EVE_FT810)
 	{
-		// Don't load if no palette file
-#ifndef ESD_LITTLEFS_FLASH
-		if (ESD_RESOURCE_IS_FLASH(bitmapInfo->Type))
+		static const uint32_t sizes[PALETTED8 - PALETTED565 + 1] = { 256 * 2, 256 * 2, 256 * 4 }; // Assume palettes are full-sized, fair assumption for now
+		uint32_t size = sizes[bitmapInfo->Format - PALETTED565];
+
+		// Swapped palette replaces the palette of the bitmap
+		if (s_PaletteSwap)
 		{
-			if (bitmapInfo->PaletteFlashAddress < EVE_FLASH_FIRMWARE_SIZE)
-				return GA_INVALID;
+			Esd_ResourceInfo *swap = s_PaletteSwap;
+			addr = Esd_GpuAlloc_Get(Esd_GAlloc, swap->GpuHandle);
+			if (addr == GA_INVALID && swap->File && (swap->Type == ESD_RESOURCE_FILE || swap->Type == ESD_RESOURCE_PROGMEM))
+				addr = Esd_LoadPaletteData(swap->Type, swap->ProgMem, swap->File, size, swap->Persistent, &swap->GpuHandle);
+			return addr != GA_INVALID ? ESD_DL_RAM_G_ADDRESS(addr) : GA_INVALID;
 		}
-		else
-#endif
-		    if (!bitmapInfo->PaletteFile)
+
+		// Don't load if no palette file
+		if (!bitmapInfo->PaletteFile) // PaletteFile is union with PaletteProgMem
 		{
 			return GA_INVALID;
 		}
@@ -460,49 +619,8 @@ ESD_CORE_EXPORT uint32_t Esd_LoadPalette(Esd_BitmapInfo *bitmapInfo)
 		addr = Esd_GpuAlloc_Get(Esd_GAlloc, bitmapInfo->PaletteGpuHandle);
 		if (addr == GA_INVALID)
 		{
-			static const uint32_t sizes[PALETTED8 - PALETTED565 + 1] = { 256 * 2, 256 * 2, 256 * 4 }; // Assume palettes are full-sized, fair assumption for now
-			uint32_t size = sizes[bitmapInfo->Format - PALETTED565];
-
-			// Verify if there is a file name or flash address specified, or if the flash address can be found in the flash filesystem
-			int32_t paletteFlashAddr = ESD_RESOURCE_IS_FLASH(bitmapInfo->Type) ? Esd_LittleFs_LoadFlashAddress(&bitmapInfo->PaletteFlashAddress, bitmapInfo->PaletteFile, NULL) : FA_INVALID;
-			if (ESD_RESOURCE_IS_FLASH(bitmapInfo->Type) ? (paletteFlashAddr == FA_INVALID) : (!bitmapInfo->PaletteFile)) // PaletteFile is union with PaletteProgMem
-			{
-#ifdef ESD_BITMAPINFO_DEBUG
-				// eve_printf_debug("Bitmap info palette is NULL, cannot auto-load\n");
-#endif
-				return GA_INVALID;
-			}
-
 			// Not loaded, load this bitmap palette
-			bitmapInfo->PaletteGpuHandle = Esd_GpuAlloc_Alloc(Esd_GAlloc, size, bitmapInfo->Persistent ? 0 : GA_GC_FLAG);
-			addr = Esd_GpuAlloc_Get(Esd_GAlloc, bitmapInfo->PaletteGpuHandle);
-			if (addr != GA_INVALID)
-			{
-#ifdef ESD_BITMAPINFO_DEBUG
-				eve_printf_debug("Allocated space for bitmap palette\n");
-#endif
-				// Allocation space OK
-				if (bitmapInfo->Type == ESD_RESOURCE_PROGMEM)
-				{
-					EVE_Hal_wrProgMem(phost, addr, bitmapInfo->PaletteProgMem, size); // Always succeeds
-				}
-				else if (
-				                                            !EVE_Util_loadRawFile(Esd_Host, addr, bitmapInfo->PaletteFile))
-				{
-#ifdef ESD_BITMAPINFO_DEBUG
-					eve_printf_debug(ESD_RESOURCE_IS_FLASH(bitmapInfo->Type) ? "Failed to load palette from flash\n" : "Failed to load palette from file\n");
-#endif
-					// Failed to load from file
-					Esd_GpuAlloc_Free(Esd_GAlloc, bitmapInfo->PaletteGpuHandle);
-					addr = GA_INVALID;
-				}
-			}
-			else
-			{
-#ifdef ESD_BITMAPINFO_DEBUG
-				eve_printf_debug("Unable to allocate space for bitmap palette\n");
-#endif
-			}
+			addr = Esd_LoadPaletteData(bitmapInfo->Type, bitmapInfo->PaletteProgMem, bitmapInfo->PaletteFile, size, bitmapInfo->Persistent, &bitmapInfo->PaletteGpuHandle);
 		}
 	}
 	else // FT_80X_ENABLE
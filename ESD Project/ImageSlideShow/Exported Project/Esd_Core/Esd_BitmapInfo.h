@@ -10,9 +10,20 @@ Bitmap info structure
 #include "Esd_ResourceInfo.h"
 #include "Esd_LittleFS.h"
 
+// Number of palettes shared by content between bitmaps, a bitmap whose palette matches a loaded one uses the same RAM_G copy.
+// Set to 0 to load a separate palette for each bitmap
+#ifndef ESD_PALETTE_SHARED
+#define ESD_PALETTE_SHARED 16
+#endif
+
 // #define ESD_COMPATIBILITY_ADDITIONALFILE // Compatibility with deprecated AdditionalFile field for old DXT1 structure format
 #define ESD_COMPATIBILITY_FLASHPREFERRAM // Compatibility with deprecated Flash and PreferRam fields replaced by Type field
 
+// Record the handle setup of persistent bitmaps in RAM_G, and replay it using CMD_APPEND
+#ifndef ESD_BITMAP_SETUP_APPEND
+#define ESD_BITMAP_SETUP_APPEND 1
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -85,6 +96,12 @@ typedef struct Esd_BitmapInfo
 
 	// Used for DXT1 format
 	struct Esd_BitmapInfo *AdditionalInfo;
+	// Next smaller resolution variant of the same cells, as generated by Tools/esd_imageconv.py --thumbnails.
+	// Esd_Render_Bitmap_Scaled draws the smallest variant that still covers the scaled size on screen
+	struct Esd_BitmapInfo *Thumbnail;
+	// Image stored as fixed size tiles, as generated by Tools/esd_imageconv.py --tiles, see Esd_TiledImage.h.
+	// Esd_Render_Bitmap_Scaled draws the tiles which are on screen, the bitmap itself has no File
+	struct Esd_TiledImage *Tiled;
 
 	// Used for paletted format
 	union
@@ -131,8 +148,25 @@ typedef struct Esd_BitmapInfo
 	// Flagged at runtime whenever Format is AVI
 	uint16_t Video : 1;
 
-	// 4x3 + 4x1 = 16 bits
-	// + 16 bits (cells) = 32 bits (aligned)
+	// (Runtime) The bitmap data is being uploaded in the background, see Esd_AsyncLoad.h
+	uint16_t Loading : 1;
+
+	// Load the bitmap at StaticAddress in the build time RAM_G layout, instead of allocating the space.
+	// Set together with StaticAddress by Tools/esd_ramg_layout.py
+	uint16_t Static : 1;
+
+	// 4x3 + 5x1 = 17 bits
+	// + 16 bits (cells) = 33 bits
+
+	// Address assigned in the build time RAM_G layout, valid with Static
+	uint32_t StaticAddress;
+
+#if ESD_BITMAP_SETUP_APPEND
+	// (Runtime) Recorded handle setup for persistent bitmaps, valid while the bitmap remains at SetupAddress
+	Esd_GpuHandle SetupGpuHandle;
+	uint32_t SetupAddress;
+	uint32_t SetupSize;
+#endif
 
 } Esd_BitmapInfo;
 
@@ -159,6 +193,12 @@ ESD_FUNCTION(Esd_LoadPalette, Type = uint32_t, Attributes = ESD_CORE_EXPORT, Inc
 ESD_PARAMETER(bitmapInfo, Type = Esd_BitmapInfo *)
 ESD_CORE_EXPORT uint32_t Esd_LoadPalette(Esd_BitmapInfo *bitmapInfo);
 
+/// Draw paletted bitmaps with another palette until Esd_PaletteSwap_End, to recolour them without storing another copy of the bitmap.
+/// The palette resource must be in the palette format of the bitmaps drawn, it is loaded as a raw file or program memory resource,
+/// and shares RAM_G with bitmap palettes of the same content
+ESD_CORE_EXPORT void Esd_PaletteSwap_Begin(Esd_ResourceInfo *palette);
+ESD_CORE_EXPORT void Esd_PaletteSwap_End();
+
 ESD_ENUM(_BitmapResourceFormat, DisplayName = "Bitmap Format")
 // Hardware bitmap formats
 ESD_IDENTIFIER(ARGB1555)
@@ -194,6 +234,14 @@ static inline Esd_BitmapCell Esd_BitmapCell_Switched(Esd_BitmapCell bitmapCell,
 	return bitmapCell;
 }
 
+/// Check whether a bitmap is still being uploaded in the background, to render a placeholder meanwhile
+ESD_FUNCTION(Esd_BitmapInfo_IsLoading, Type = bool, DisplayName = "Is Bitmap Loading", Category = EsdUtilities, Inline)
+ESD_PARAMETER(bitmapInfo, Type = Esd_BitmapInfo *)
+static inline bool Esd_BitmapInfo_IsLoading(Esd_BitmapInfo *bitmapInfo)
+{
+	return bitmapInfo && bitmapInfo->Loading;
+}
+
 /// A function to make bitmap persistent in memory by reloading the data if necessary, called during the Update cycle of each frame
 ESD_UPDATE(Esd_BitmapCell_Persist, DisplayName = "Persist Bitmap", Category = EsdUtilities)
 ESD_PARAMETER(bitmapCell, Type = Esd_BitmapCell)
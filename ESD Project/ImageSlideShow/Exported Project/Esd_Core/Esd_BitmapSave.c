@@ -0,0 +1,180 @@
+
+#include "Esd_BitmapSave.h"
+
+#if ESD_BITMAPSAVE
+
+#include "Esd_Context.h"
+#include "EVE_LoadFile.h"
+
+extern ESD_CORE_EXPORT Esd_GpuAlloc *Esd_GAlloc;
+
+#define ESD_BITMAPSAVE_HEADER_WORDS 6
+
+// Shorter runs are cheaper as part of a literal
+#define ESD_BITMAPSAVE_MIN_RUN 3
+
+// Encoded bytes collected before writing to the card
+#define ESD_BITMAPSAVE_WRITE_BYTES 512
+
+static uint8_t s_Status = ESD_BITMAPSAVE_IDLE;
+static bool s_Snapshot; // Reading the scratch copy rather than the bitmap itself
+static uint32_t s_Frame;
+static uint32_t s_Offset; // Next byte to read back
+static uint32_t s_Size;
+static Esd_GpuHandle s_Handle = GA_HANDLE_INIT; // Scratch copy, or the bitmap
+static EVE_WriteFile s_File;
+
+static uint8_t s_Stripe[ESD_BITMAPSAVE_STRIPE_BYTES];
+
+// A stripe never takes more than one token per 128 bytes over its size
+static uint8_t s_Encoded[ESD_BITMAPSAVE_WRITE_BYTES + ESD_BITMAPSAVE_STRIPE_BYTES + (ESD_BITMAPSAVE_STRIPE_BYTES / 128) + 1];
+static uint32_t s_EncodedSize;
+
+// Appends a stripe, runs and literals do not continue across stripes
+static void encode(uint32_t size)
+{
+	uint8_t *out = &s_Encoded[s_EncodedSize];
+	uint8_t *literal = NULL; // Token of the literal being extended
+	uint32_t i = 0;
+
+	while (i < size)
+	{
+		uint32_t run = 1;
+		while (i + run < size && run < 128 && s_Stripe[i + run] == s_Stripe[i])
+			++run;
+
+		if (run >= ESD_BITMAPSAVE_MIN_RUN)
+		{
+			*out++ = (uint8_t)(0x80 | (run - 1));
+			*out++ = s_Stripe[i];
+			literal = NULL;
+			i += run;
+		}
+		else
+		{
+			if (!literal || *literal == 0x7F)
+			{
+				literal = out++;
+				*literal = 0xFF; // Incremented to 0 by the first byte
+			}
+			++*literal;
+			*out++ = s_Stripe[i++];
+		}
+	}
+
+	s_EncodedSize = (uint32_t)(out - s_Encoded);
+}
+
+static void finish(uint8_t status)
+{
+	if (!EVE_Util_closeWriteFile(Esd_GetHost(), &s_File))
+		status = ESD_BITMAPSAVE_FAILED;
+	if (s_Snapshot)
+		Esd_GpuAlloc_Free(Esd_GAlloc, s_Handle); // Only read back, never drawn
+	s_Handle = GA_HANDLE_INVALID;
+	s_Status = status;
+	if (status == ESD_BITMAPSAVE_FAILED)
+		eve_printf_debug("Bitmap save failed\n");
+}
+
+ESD_CORE_EXPORT bool Esd_BitmapSave_Start(Esd_BitmapInfo *info, const char *filename)
+{
+	EVE_HalContext *phost = Esd_GetHost();
+	uint16_t header[ESD_BITMAPSAVE_HEADER_WORDS];
+	uint32_t src, addr;
+	uint32_t height;
+
+	if (s_Status == ESD_BITMAPSAVE_BUSY || !info || !info->Stride)
+		return false;
+	src = Esd_GpuAlloc_Get(Esd_GAlloc, info->GpuHandle);
+	if (src == GA_INVALID || !info->Size)
+		return false;
+	if (!EVE_Util_openWriteFile(phost, &s_File, filename))
+		return false;
+
+	// Fixed, so defragmentation does not move it while the coprocessor writes
+	s_Size = info->Size;
+	s_Handle = Esd_GpuAlloc_Alloc(Esd_GAlloc, s_Size, GA_FIXED_FLAG);
+	addr = Esd_GpuAlloc_Get(Esd_GAlloc, s_Handle);
+	s_Snapshot = addr != GA_INVALID;
+	if (s_Snapshot)
+	{
+		// Drawing may go on while the copy is read back
+		EVE_CoCmd_memCpy(phost, addr, src, s_Size);
+	}
+	else
+	{
+		eve_printf_debug("Not enough RAM_G for a bitmap snapshot, saving in place\n");
+		s_Handle = info->GpuHandle;
+	}
+
+	height = s_Size / info->Stride;
+	header[0] = (uint16_t)ESD_BITMAPSAVE_MAGIC;
+	header[1] = (uint16_t)(ESD_BITMAPSAVE_MAGIC >> 16);
+	header[2] = (uint16_t)info->Width;
+	header[3] = (uint16_t)height;
+	header[4] = (uint16_t)info->Stride;
+	header[5] = (uint16_t)info->Format;
+	memcpy(s_Encoded, header, sizeof(header));
+	s_EncodedSize = sizeof(header);
+
+	s_Offset = 0;
+	s_Frame = Esd_CurrentContext->Frame;
+	s_Status = ESD_BITMAPSAVE_BUSY;
+	return true;
+}
+
+ESD_CORE_EXPORT uint8_t Esd_BitmapSave_Status()
+{
+	return s_Status;
+}
+
+ESD_CORE_EXPORT void Esd_BitmapSave_Idle()
+{
+	EVE_HalContext *phost;
+	uint32_t addr;
+	uint32_t size;
+
+	if (s_Status != ESD_BITMAPSAVE_BUSY)
+		return;
+
+	// The copy is queued in the frame that started the save
+	if (Esd_CurrentContext->CompletedFrame <= s_Frame)
+		return;
+
+	phost = Esd_GetHost();
+	addr = Esd_GpuAlloc_Get(Esd_GAlloc, s_Handle);
+	if (addr == GA_INVALID)
+	{
+		// Lost to a coprocessor fault, or the bitmap was freed
+		finish(ESD_BITMAPSAVE_FAILED);
+		return;
+	}
+
+	if (s_Offset < s_Size)
+	{
+		size = s_Size - s_Offset;
+		if (size > ESD_BITMAPSAVE_STRIPE_BYTES)
+			size = ESD_BITMAPSAVE_STRIPE_BYTES;
+		EVE_Hal_rdMem(phost, s_Stripe, addr + s_Offset, size);
+		encode(size);
+		s_Offset += size;
+	}
+
+	if (s_EncodedSize >= ESD_BITMAPSAVE_WRITE_BYTES || s_Offset >= s_Size)
+	{
+		if (!EVE_Util_writeFile(phost, &s_File, s_Encoded, s_EncodedSize))
+		{
+			finish(ESD_BITMAPSAVE_FAILED);
+			return;
+		}
+		s_EncodedSize = 0;
+	}
+
+	if (s_Offset >= s_Size)
+		finish(ESD_BITMAPSAVE_DONE);
+}
+
+#endif /* #if ESD_BITMAPSAVE */
+
+/* end of file */
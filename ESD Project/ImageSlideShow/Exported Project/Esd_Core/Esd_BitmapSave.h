@@ -0,0 +1,68 @@
+
+#ifndef ESD_BITMAPSAVE__H
+#define ESD_BITMAPSAVE__H
+
+#include "Esd_Base.h"
+#include "Esd_BitmapInfo.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+Background bitmap saving.
+Esd_BitmapSave_Start copies a RAM_G bitmap, such as the canvas of Ft_Esd_Sketch, into a scratch
+allocation with CMD_MEMCPY, so drawing can continue meanwhile. Once the copy has been processed, the
+idle points of the loop read it back ESD_BITMAPSAVE_STRIPE_BYTES at a time, run length encode it,
+and write it to the SD card, so a save never holds up a frame for the whole readback.
+When there is no RAM_G for the scratch copy, the bitmap is read back in place instead.
+Tools/esd_bitmap.py converts the file to PGM. One bitmap is saved at a time.
+
+The file is little endian:
+	uint32_t ESD_BITMAPSAVE_MAGIC
+	uint16_t width, height, stride
+	uint16_t format, L8 or L1 as used by the sketch
+Followed by the encoded stride * height bytes. A token byte with bit 7 set is followed
+by one byte repeated (token & 0x7F) + 1 times, otherwise (token + 1) literal bytes follow.
+*/
+
+#ifndef ESD_BITMAPSAVE
+#define ESD_BITMAPSAVE 0
+#endif
+
+// Bytes read back per idle call
+#ifndef ESD_BITMAPSAVE_STRIPE_BYTES
+#define ESD_BITMAPSAVE_STRIPE_BYTES 1024
+#endif
+
+#define ESD_BITMAPSAVE_MAGIC 0x424B5345UL // "ESKB"
+
+#define ESD_BITMAPSAVE_IDLE 0
+#define ESD_BITMAPSAVE_BUSY 1
+#define ESD_BITMAPSAVE_DONE 2
+#define ESD_BITMAPSAVE_FAILED 3
+
+#if ESD_BITMAPSAVE
+
+// Starts saving the bitmap to a file on the SD card, returns false when a save is in progress or the bitmap is not loaded
+ESD_CORE_EXPORT bool Esd_BitmapSave_Start(Esd_BitmapInfo *info, const char *filename);
+
+// One of ESD_BITMAPSAVE_IDLE, ESD_BITMAPSAVE_BUSY, ESD_BITMAPSAVE_DONE or ESD_BITMAPSAVE_FAILED, for the last save
+ESD_CORE_EXPORT uint8_t Esd_BitmapSave_Status();
+
+// Reads back and writes the next stripe, called while idle
+ESD_CORE_EXPORT void Esd_BitmapSave_Idle();
+
+#else
+
+#define Esd_BitmapSave_Idle() eve_noop()
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* #ifndef ESD_BITMAPSAVE__H */
+
+/* end of file */
@@ -0,0 +1,235 @@
+
+#include "Esd_Capture.h"
+
+#if ESD_CAPTURE
+
+#include "Esd_Context.h"
+
+extern ESD_CORE_EXPORT Esd_GpuAlloc *Esd_GAlloc;
+
+ESD_CORE_EXPORT Esd_CaptureSinkCallback Esd_CaptureSink = NULL;
+ESD_CORE_EXPORT Esd_CaptureReadyCallback Esd_CaptureReady = NULL;
+
+#define ESD_CAPTURE_STATE_NONE 0
+#define ESD_CAPTURE_STATE_SNAPSHOT 1 // Snapshot queued in s_Frame, read back once that frame is swapped
+#define ESD_CAPTURE_STATE_READING 2
+
+#define ESD_CAPTURE_HEADER_WORDS 8
+#define ESD_CAPTURE_ROW_HEADER_WORDS 2
+
+// Shorter runs are cheaper as part of a literal
+#define ESD_CAPTURE_MIN_RUN 3
+
+static uint8_t s_State = ESD_CAPTURE_STATE_NONE;
+static bool s_Requested = false;
+static bool s_KeyRequested = false;
+static bool s_KeyFrame;
+static bool s_HashValid = false; // Row hashes describe the image the host has
+static uint32_t s_Millis = 0;
+static uint32_t s_Frame;
+static uint32_t s_Count = 0; // Captures since the last key frame
+static uint16_t s_Width;
+static uint16_t s_Height;
+static uint16_t s_Row; // Next row to read back
+static Esd_GpuHandle s_Handle = GA_HANDLE_INIT;
+
+static uint32_t s_RowHash[ESD_CAPTURE_MAX_HEIGHT];
+static uint16_t s_Pixels[ESD_CAPTURE_MAX_WIDTH];
+
+// A row never takes more than one token per pixel plus one
+static uint16_t s_Encoded[ESD_CAPTURE_ROW_HEADER_WORDS + ESD_CAPTURE_MAX_WIDTH + 1];
+
+// FNV-1a over the pixels of a row
+static uint32_t hashRow(uint16_t width)
+{
+	uint32_t hash = 2166136261UL;
+	for (uint16_t x = 0; x < width; ++x)
+	{
+		hash ^= s_Pixels[x];
+		hash *= 16777619UL;
+	}
+	return hash;
+}
+
+// Returns the size of the row record in bytes
+static uint32_t encodeRow(uint16_t y, uint16_t width)
+{
+	uint16_t *out = &s_Encoded[ESD_CAPTURE_ROW_HEADER_WORDS];
+	uint16_t *literal = NULL; // Token of the literal being extended
+	uint16_t x = 0;
+
+	while (x < width)
+	{
+		uint16_t run = 1;
+		while (x + run < width && run < 0x7FFF && s_Pixels[x + run] == s_Pixels[x])
+			++run;
+
+		if (run >= ESD_CAPTURE_MIN_RUN)
+		{
+			*out++ = 0x8000 | run;
+			*out++ = s_Pixels[x];
+			literal = NULL;
+			x += run;
+		}
+		else
+		{
+			if (!literal || *literal == 0x7FFF)
+			{
+				literal = out++;
+				*literal = 0;
+			}
+			++*literal;
+			*out++ = s_Pixels[x++];
+		}
+	}
+
+	s_Encoded[0] = y;
+	s_Encoded[1] = (uint16_t)((out - &s_Encoded[ESD_CAPTURE_ROW_HEADER_WORDS]) * 2);
+	return (uint32_t)(out - s_Encoded) * 2;
+}
+
+static bool ready(uint32_t size)
+{
+	return !Esd_CaptureReady || Esd_CaptureReady(size);
+}
+
+static void finish()
+{
+	Esd_GpuAlloc_Free(Esd_GAlloc, s_Handle); // Only read back, never drawn
+	s_Handle = GA_HANDLE_INVALID;
+	s_State = ESD_CAPTURE_STATE_NONE;
+}
+
+ESD_CORE_EXPORT void Esd_Capture_Request(bool keyFrame)
+{
+	s_Requested = true;
+	s_KeyRequested = s_KeyRequested || keyFrame;
+}
+
+ESD_CORE_EXPORT bool Esd_Capture_Busy()
+{
+	return s_State != ESD_CAPTURE_STATE_NONE;
+}
+
+ESD_CORE_EXPORT void Esd_Capture_Update()
+{
+	EVE_HalContext *phost = Esd_GetHost();
+	uint32_t ms = EVE_millis();
+	uint32_t addr;
+
+	if (!Esd_CaptureSink || s_State != ESD_CAPTURE_STATE_NONE)
+		return;
+	if (!s_Requested && (!ESD_CAPTURE_INTERVAL_MS || (ms - s_Millis) < ESD_CAPTURE_INTERVAL_MS))
+		return;
+	s_Millis = ms;
+	s_Requested = false;
+
+	// CMD_SNAPSHOT on FT80X needs the display to be stopped
+	if (EVE_CHIPID < EVE_FT810 || phost->Width > ESD_CAPTURE_MAX_WIDTH || phost->Height > ESD_CAPTURE_MAX_HEIGHT)
+	{
+		eve_printf_debug_once("Screen capture is not supported on this display\n");
+		return;
+	}
+
+	// Fixed, so defragmentation does not move it while the coprocessor writes
+	s_Handle = Esd_GpuAlloc_Alloc(Esd_GAlloc, phost->Width * phost->Height * 2, GA_FIXED_FLAG);
+	addr = Esd_GpuAlloc_Get(Esd_GAlloc, s_Handle);
+	if (addr == GA_INVALID)
+	{
+		eve_printf_debug("Not enough RAM_G for a screen capture\n");
+		s_Handle = GA_HANDLE_INVALID;
+		return;
+	}
+
+	// Captures the frame on screen, the frame being built is not displayed yet
+	EVE_CoCmd_snapshot2(phost, RGB565, addr, 0, 0, (int16_t)phost->Width, (int16_t)phost->Height);
+
+	s_KeyFrame = s_KeyRequested || !s_HashValid
+	    || s_Width != phost->Width || s_Height != phost->Height
+	    || ++s_Count >= ESD_CAPTURE_KEYFRAME_INTERVAL;
+	if (s_KeyFrame)
+		s_Count = 0;
+	s_KeyRequested = false;
+	s_Width = (uint16_t)phost->Width;
+	s_Height = (uint16_t)phost->Height;
+	s_Frame = Esd_CurrentContext->Frame;
+	s_State = ESD_CAPTURE_STATE_SNAPSHOT;
+}
+
+ESD_CORE_EXPORT void Esd_Capture_Idle()
+{
+	EVE_HalContext *phost;
+	uint32_t addr;
+	uint32_t size;
+
+	if (s_State == ESD_CAPTURE_STATE_NONE)
+		return;
+
+	if (s_State == ESD_CAPTURE_STATE_SNAPSHOT)
+	{
+		uint16_t header[ESD_CAPTURE_HEADER_WORDS];
+
+		// The snapshot runs ahead of the swap of the frame it was queued in
+		if (Esd_CurrentContext->CompletedFrame <= s_Frame || !ready(sizeof(header)))
+			return;
+
+		header[0] = (uint16_t)ESD_CAPTURE_MAGIC;
+		header[1] = (uint16_t)(ESD_CAPTURE_MAGIC >> 16);
+		header[2] = (uint16_t)s_Millis;
+		header[3] = (uint16_t)(s_Millis >> 16);
+		header[4] = s_Width;
+		header[5] = s_Height;
+		header[6] = RGB565;
+		header[7] = s_KeyFrame ? ESD_CAPTURE_KEYFRAME_FLAG : 0;
+		Esd_CaptureSink((const uint8_t *)header, sizeof(header));
+		s_Row = 0;
+		s_State = ESD_CAPTURE_STATE_READING;
+	}
+
+	phost = Esd_GetHost();
+	addr = Esd_GpuAlloc_Get(Esd_GAlloc, s_Handle);
+	if (addr != GA_INVALID)
+	{
+		for (uint16_t n = 0; n < ESD_CAPTURE_STRIPE_ROWS && s_Row < s_Height; ++n)
+		{
+			uint32_t hash;
+
+			EVE_Hal_rdMem(phost, (uint8_t *)s_Pixels, addr + (uint32_t)s_Row * s_Width * 2, s_Width * 2);
+			hash = hashRow(s_Width);
+			if (!s_KeyFrame && hash == s_RowHash[s_Row])
+			{
+				++s_Row;
+				continue;
+			}
+
+			// Read again on the next call when the sink is full
+			size = encodeRow(s_Row, s_Width);
+			if (!ready(size))
+				return;
+			Esd_CaptureSink((const uint8_t *)s_Encoded, size);
+			s_RowHash[s_Row] = hash;
+			++s_Row;
+		}
+		if (s_Row < s_Height)
+			return;
+	}
+	else
+	{
+		// Lost to a coprocessor fault, the host gets every row of the next capture
+		s_HashValid = false;
+		finish();
+		return;
+	}
+
+	if (!ready(ESD_CAPTURE_ROW_HEADER_WORDS * 2))
+		return;
+	s_Encoded[0] = ESD_CAPTURE_END;
+	s_Encoded[1] = 0;
+	Esd_CaptureSink((const uint8_t *)s_Encoded, ESD_CAPTURE_ROW_HEADER_WORDS * 2);
+	s_HashValid = true;
+	finish();
+}
+
+#endif /* #if ESD_CAPTURE */
+
+/* end of file */
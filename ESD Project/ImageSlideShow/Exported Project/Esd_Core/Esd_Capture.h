@@ -0,0 +1,102 @@
+
+#ifndef ESD_CAPTURE__H
+#define ESD_CAPTURE__H
+
+#include "Esd_Base.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+Remote screen capture.
+Every ESD_CAPTURE_INTERVAL_MS, or on request, Esd_Update takes a CMD_SNAPSHOT2 of the displayed
+frame into a scratch allocation in RAM_G. The capture is read back ESD_CAPTURE_STRIPE_ROWS rows
+at a time from the idle points of the loop and the coprocessor waits, so it never holds up a frame.
+Rows which are the same as in the previous capture are left out, the others are run length encoded,
+and the records are passed to Esd_CaptureSink, on FT9XX typically the usbdbg CDC endpoint.
+When the sink is congested, Esd_CaptureReady holds off the readback until there is room.
+Tools/esd_capture.py decodes the stream. Requires FT81X or newer.
+
+The stream is little endian. Each capture starts with a header:
+	uint32_t ESD_CAPTURE_MAGIC
+	uint32_t millis
+	uint16_t width, height
+	uint16_t format, RGB565
+	uint16_t flags, ESD_CAPTURE_KEYFRAME_FLAG when every row follows
+Followed by the changed rows:
+	uint16_t y
+	uint16_t size of the encoded row in bytes
+	uint16_t tokens, with bit 15 set a run of (token & 0x7FFF) copies of the next pixel,
+	         otherwise (token) literal pixels follow
+Terminated by a row with y ESD_CAPTURE_END and size 0.
+*/
+
+#ifndef ESD_CAPTURE
+#define ESD_CAPTURE 0
+#endif
+
+// Time between periodic captures, 0 to capture on request only
+#ifndef ESD_CAPTURE_INTERVAL_MS
+#define ESD_CAPTURE_INTERVAL_MS 1000
+#endif
+
+// Rows read back per idle call
+#ifndef ESD_CAPTURE_STRIPE_ROWS
+#define ESD_CAPTURE_STRIPE_ROWS 8
+#endif
+
+// Every so many captures all rows are sent, so a host which joins late catches up
+#ifndef ESD_CAPTURE_KEYFRAME_INTERVAL
+#define ESD_CAPTURE_KEYFRAME_INTERVAL 30
+#endif
+
+// Largest screen that can be captured, sizes the row buffers
+#ifndef ESD_CAPTURE_MAX_WIDTH
+#define ESD_CAPTURE_MAX_WIDTH 800
+#endif
+#ifndef ESD_CAPTURE_MAX_HEIGHT
+#define ESD_CAPTURE_MAX_HEIGHT 800
+#endif
+
+#define ESD_CAPTURE_MAGIC 0x50435345UL // "ESCP"
+#define ESD_CAPTURE_KEYFRAME_FLAG 0x0001
+#define ESD_CAPTURE_END 0xFFFF
+
+typedef void (*Esd_CaptureSinkCallback)(const uint8_t *data, uint32_t size);
+typedef bool (*Esd_CaptureReadyCallback)(uint32_t size);
+
+#if ESD_CAPTURE
+
+// Receives the capture records, no captures are taken when not set
+extern ESD_CORE_EXPORT Esd_CaptureSinkCallback Esd_CaptureSink;
+
+// Optional, returns whether the sink takes size more bytes now
+extern ESD_CORE_EXPORT Esd_CaptureReadyCallback Esd_CaptureReady;
+
+// Take a capture on the next update, keyFrame sends every row
+ESD_CORE_EXPORT void Esd_Capture_Request(bool keyFrame);
+
+// True while a capture is being taken or sent
+ESD_CORE_EXPORT bool Esd_Capture_Busy();
+
+// Takes the snapshot when due, called from Esd_Update
+ESD_CORE_EXPORT void Esd_Capture_Update();
+
+// Reads back and sends the next stripe, called while idle
+ESD_CORE_EXPORT void Esd_Capture_Idle();
+
+#else
+
+#define Esd_Capture_Update() eve_noop()
+#define Esd_Capture_Idle() eve_noop()
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* #ifndef ESD_CAPTURE__H */
+
+/* end of file */
@@ -1,6 +1,14 @@
 
 #include "Esd_CoWidget.h"
 #include "Esd_Context.h"
+#include "Esd_Utility.h"
+
+/* Background video frame chunk offsets from the AVI idx1 index, parsed once when playback starts */
+static uint32_t s_BgVideoIndex[ESD_BGVIDEO_INDEX_SIZE];
+static uint32_t s_BgVideoIndexCount; //< Number of indexed frames, 0 if the video has no usable index
+static uint32_t s_BgVideoIndexStride; //< Frames per index entry
+static uint32_t s_BgVideoFrames; //< Number of frames in the video
+static uint32_t s_BgVideoEnd; //< End of the movi list, the trailing idx1 chunk is never fed to the decoder
 
 void Esd_CoWidget_Spinner(void *owner, int16_t x, int16_t y, uint16_t style, uint16_t scale)
 {
@@ -35,6 +43,118 @@ void Esd_CoWidget_PopupSpinner()
 	Esd_CurrentContext->SpinnerPopup = true;
 }
 
+/* Read the idx1 index of an AVI file into the frame offset table.
+Only the video chunks (##dc and ##db) are kept, with absolute file offsets of the chunk headers */
+static bool Esd_CoWidget_indexBgVideo(EVE_HalContext *phost, const char *file)
+{
+	EVE_Asset asset;
+	uint32_t buf[64];
+	uint32_t pos = 12;
+	uint32_t movi = 0;
+	uint32_t idx = 0;
+	uint32_t idxSize = 0;
+	uint32_t base = 0;
+
+	s_BgVideoIndexCount = 0;
+	s_BgVideoFrames = 0;
+	s_BgVideoEnd = 0;
+
+	if (!EVE_Util_openAsset(phost, &asset, file))
+		return false;
+
+	/* Walk the top level chunks for the movi list and the index behind it */
+	if (EVE_Util_readAsset(phost, &asset, 0, (uint8_t *)buf, 12) == 12
+	    && !memcmp(&buf[0], "RIFF", 4) && !memcmp(&buf[2], "AVI ", 4))
+	{
+		while (pos + 8 <= asset.Size && EVE_Util_readAsset(phost, &asset, pos, (uint8_t *)buf, 12) >= 8)
+		{
+			uint32_t size = buf[1];
+			if (!memcmp(&buf[0], "LIST", 4) && !memcmp(&buf[2], "movi", 4))
+			{
+				movi = pos + 8;
+				s_BgVideoEnd = movi + size;
+			}
+			else if (!memcmp(&buf[0], "idx1", 4))
+			{
+				idx = pos + 8;
+				idxSize = size;
+				break;
+			}
+			pos += 8 + ((size + 1) & ~1UL);
+		}
+	}
+
+	if (movi && idxSize)
+	{
+		uint32_t entries = idxSize >> 4;
+		uint32_t i;
+		s_BgVideoIndexStride = entries / ESD_BGVIDEO_INDEX_SIZE + 1;
+		for (i = 0; i < entries; i += 16)
+		{
+			uint32_t n = min(entries - i, 16);
+			uint32_t e;
+			if (EVE_Util_readAsset(phost, &asset, idx + (i << 4), (uint8_t *)buf, n << 4) != (n << 4))
+			{
+				s_BgVideoIndexCount = 0;
+				break;
+			}
+			for (e = 0; e < n; ++e)
+			{
+				/* AVIINDEXENTRY: ckid, dwFlags, dwChunkOffset, dwChunkLength */
+				const uint8_t *ckid = (const uint8_t *)&buf[e << 2];
+				uint32_t offset = buf[(e << 2) + 2];
+				if (ckid[2] != 'd' || (ckid[3] != 'c' && ckid[3] != 'b'))
+					continue;
+				/* Offsets are usually relative to the movi fourcc, some writers store them absolute */
+				if (!s_BgVideoFrames)
+					base = (offset < movi) ? movi : 0;
+				if (!(s_BgVideoFrames % s_BgVideoIndexStride))
+					s_BgVideoIndex[s_BgVideoIndexCount++] = base + offset;
+				++s_BgVideoFrames;
+			}
+		}
+	}
+
+	EVE_Util_closeAsset(phost, &asset);
+	if (!s_BgVideoIndexCount)
+		eve_printf_debug("No usable AVI index, background video cannot seek or loop\n");
+	return s_BgVideoIndexCount > 0;
+}
+
+/* Feed the media FIFO from the first frame again once the movi list has been fed to the end */
+static void Esd_CoWidget_wrapBgVideo(EVE_HalContext *phost)
+{
+	if (Esd_CurrentContext->BgVideoLoop && s_BgVideoIndexCount && !phost->LoadFileRemaining)
+		EVE_Util_seekMediaFile(phost, s_BgVideoIndex[0], s_BgVideoEnd - s_BgVideoIndex[0]);
+}
+
+void Esd_CoWidget_LoopBgVideo(bool loop)
+{
+	Esd_CurrentContext->BgVideoLoop = loop;
+}
+
+bool Esd_CoWidget_SeekBgVideo(uint32_t frame)
+{
+	Esd_Context *ec = Esd_CurrentContext;
+	EVE_HalContext *phost = Esd_GetHost();
+	uint32_t offset;
+
+	if (!ec->BgVideoInfo || !s_BgVideoIndexCount || frame >= s_BgVideoFrames)
+		return false;
+
+	/* Frames are decoded one at a time by Esd_CoWidget_LoadBgVideoFrame, the decoder is between chunks once idle */
+	if (!EVE_Cmd_waitFlush(phost))
+		return false;
+
+	offset = s_BgVideoIndex[frame / s_BgVideoIndexStride];
+	EVE_MediaFifo_discard(phost);
+	if (!EVE_Util_seekMediaFile(phost, offset, s_BgVideoEnd - offset))
+		return false;
+
+	ec->bAllFramePlayed = false;
+	return true;
+}
+
 void Esd_CoWidget_StopBgVideo()
 {
 	Esd_Context *ec = Esd_CurrentContext;
@@ -51,6 +171,8 @@ void Esd_CoWidget_StopBgVideo()
 
 		Esd_GpuAlloc_Free(ga, ec->MediaFifoHandle);
 		ec->MediaFifoHandle = GA_HANDLE_INVALID;
+		Esd_DeferredGpuFree(ec->BgVideoBackHandle); // Holds the frame on screen when swapped
+		ec->BgVideoBackHandle = GA_HANDLE_INVALID;
 	}
 }
 
@@ -97,10 +219,26 @@ static void Esd_CoWidget_LoadBgVideoFrame()
 			return;
 		}
 
-		/* Load the next frame */
+		/* The file may have been read to the end ahead of playback, play out what is left in the media FIFO */
 		uint32_t ptr = fifoAddr + phost->MediaFifoSize;
-		EVE_CoCmd_videoFrame(phost, addr, ptr);
-		bool loadRes = EVE_Util_loadMediaFile(phost, NULL, &ec->BgVideoTransfered);
+		Esd_CoWidget_wrapBgVideo(phost);
+		if (!phost->LoadFileRemaining && EVE_MediaFifo_space(phost) >= phost->MediaFifoSize - 4)
+		{
+			/* End of video, stop */
+			eve_printf_debug("Background video completed, end of file\n");
+			Esd_CoWidget_StopBgVideo();
+			return;
+		}
+
+		/* Decode into the back bitmap while the display list still shows the previous frame.
+		Without one, for lack of RAM_G, the frame decodes in place */
+		uint32_t backAddr = Esd_GpuAlloc_Get(ga, ec->BgVideoBackHandle);
+
+		/* Load the next frame */
+		EVE_CoCmd_videoFrame(phost, (backAddr != GA_INVALID) ? backAddr : addr, ptr);
+		bool loadRes = phost->LoadFileRemaining
+		    ? EVE_Util_loadMediaFile(phost, NULL, &ec->BgVideoTransfered)
+		    : EVE_Cmd_waitFlush(phost);
 		if (!loadRes)
 		{
 			/* Video frame failed, stop the video. */
@@ -115,31 +253,90 @@ static void Esd_CoWidget_LoadBgVideoFrame()
 		}
 
 		ec->bAllFramePlayed = !(EVE_Hal_rd32(phost, ptr));
+		if (ec->bAllFramePlayed && ec->BgVideoLoop && s_BgVideoIndexCount)
+		{
+			/* The decoder stopped at the end of the stream, restart it from the header of the file that is still open */
+			EVE_MediaFifo_discard(phost);
+			EVE_CoCmd_videoStart(phost);
+			if (EVE_Util_seekMediaFile(phost, 0, s_BgVideoEnd))
+			{
+				ec->bAllFramePlayed = false;
+				return;
+			}
+		}
+		if (!ec->bAllFramePlayed && backAddr != GA_INVALID)
+		{
+			/* Frame complete, render from it. Switching handles makes Esd_BitmapHandle set the new source up */
+			Esd_GpuHandle front = ec->BgVideoInfo->GpuHandle;
+			ec->BgVideoInfo->GpuHandle = ec->BgVideoBackHandle;
+			ec->BgVideoBackHandle = front;
+		}
 		if (ec->bAllFramePlayed)
 		{
 			/* End of video, stop */
-			/* TODO: Add a looping flag for background video? */
 			/* TODO: Add a media fifo lock flag to avoid background video interruption? */
 			eve_printf_debug("Background video completed\n");
 			Esd_CoWidget_StopBgVideo();
 			return;
 		}
-
-		if (!phost->LoadFileRemaining)
-		{
-			/* End of video, stop */
-			eve_printf_debug("Background video completed, end of file\n");
-			Esd_CoWidget_StopBgVideo();
-			return;
-		}
 	}
 }
 
+/* Keep the background video media FIFO topped up from idle time, so frames do not wait on the SD card */
+void Esd_CoWidget_FillBgVideo()
+{
+	Esd_Context *ec = Esd_CurrentContext;
+	EVE_HalContext *phost;
+
+	if (!ec || !ec->BgVideoInfo || ESD_RESOURCE_IS_FLASH(ec->BgVideoInfo->Type))
+		return;
+
+	phost = Esd_GetHost();
+	if (Esd_GpuAlloc_Get(Esd_GAlloc, ec->MediaFifoHandle) != phost->MediaFifoAddress)
+		return;
+
+	Esd_CoWidget_wrapBgVideo(phost);
+	EVE_Util_fillMediaFile(phost, phost->MediaFifoSize / 100 * ESD_BGVIDEO_WATERMARK);
+}
+
 void Esd_CoWidget_Render()
 {
 	Esd_CoWidget_LoadBgVideoFrame();
 }
 
+/* Size of the media FIFO for an AVI file, derived from the data rate in its main header.
+Holds ESD_VIDEO_FIFO_FRAMES frames, clamped to the configured range */
+static uint32_t Esd_CoWidget_videoFifoSize(EVE_HalContext *phost, const char *file)
+{
+	uint32_t hdr[16];
+	uint32_t size = ESD_VIDEO_FIFO_MIN;
+
+	/* RIFF AVI hdrl LIST with the avih chunk first, see MainAVIHeader */
+	if (EVE_Util_readFile(phost, (uint8_t *)hdr, sizeof(hdr), file) == sizeof(hdr)
+	    && !memcmp(&hdr[0], "RIFF", 4) && !memcmp(&hdr[2], "AVI ", 4) && !memcmp(&hdr[6], "avih", 4))
+	{
+		uint32_t usPerFrame = hdr[8];
+		uint32_t maxBytesPerSec = hdr[9];
+		uint32_t frameBytes = hdr[15]; /* dwSuggestedBufferSize */
+		if (usPerFrame && maxBytesPerSec)
+		{
+			uint32_t rateBytes = (uint32_t)(((uint64_t)maxBytesPerSec * usPerFrame) / 1000000);
+			if (rateBytes > frameBytes)
+				frameBytes = rateBytes;
+		}
+		if (frameBytes && frameBytes < ESD_VIDEO_FIFO_MAX)
+			size = frameBytes * ESD_VIDEO_FIFO_FRAMES;
+		else if (frameBytes)
+			size = ESD_VIDEO_FIFO_MAX;
+	}
+
+	if (size < ESD_VIDEO_FIFO_MIN)
+		size = ESD_VIDEO_FIFO_MIN;
+	if (size > ESD_VIDEO_FIFO_MAX)
+		size = ESD_VIDEO_FIFO_MAX;
+	return (size + 4095) & ~4095UL;
+}
+
 /* Plays the specified Esd_BitmapInfo video in the background.
 Video only, not applicable to bitmap cell animation.
 Only one video can play in the background at a time.
@@ -205,9 +402,16 @@ bool Esd_CoWidget_PlayBgVideo(Esd_BitmapCell video)
 	else
 	{
 		/* Allocate RAM_G space for FIFO and completion pointer */
-		uint32_t fifoSize = 16 * 1024; /* TODO: What's an ideal FIFO size? */
-		fifoHandle = Esd_GpuAlloc_Alloc(Esd_GAlloc, fifoSize + 4, GA_FIXED_FLAG);
-		fifoAddr = Esd_GpuAlloc_Get(Esd_GAlloc, fifoHandle);
+		/* Fall back to smaller sizes when RAM_G is tight */
+		uint32_t fifoSize = Esd_CoWidget_videoFifoSize(phost, info->File);
+		for (;;)
+		{
+			fifoHandle = Esd_GpuAlloc_Alloc(Esd_GAlloc, fifoSize + 4, GA_FIXED_FLAG);
+			fifoAddr = Esd_GpuAlloc_Get(Esd_GAlloc, fifoHandle);
+			if (fifoAddr != GA_INVALID || fifoSize <= ESD_VIDEO_FIFO_MIN)
+				break;
+			fifoSize = (fifoSize >> 1) < ESD_VIDEO_FIFO_MIN ? ESD_VIDEO_FIFO_MIN : (fifoSize >> 1);
+		}
 		if (fifoAddr == GA_INVALID)
 		{
 			eve_printf_debug("Not enough RAM_G available to allocate media FIFO for video\n");
@@ -266,6 +470,7 @@ bool Esd_CoWidget_PlayBgVideo(Esd_BitmapCell video)
 	}
 
 	bool res;
+	ec->BgVideoLoop = false;
 	if (ESD_RESOURCE_IS_FLASH(info->Type))
 	{
 		res = false;
@@ -273,13 +478,21 @@ bool Esd_CoWidget_PlayBgVideo(Esd_BitmapCell video)
 	else
 	{
 		uint32_t transfered = 0;
+		bool indexed = Esd_CoWidget_indexBgVideo(phost, info->File);
 		EVE_CoCmd_videoStart(phost);
 		EVE_CoCmd_videoFrame(phost, addr, ptr);
 		res = EVE_Util_loadMediaFile(phost, info->File, &transfered);
 		if (res)
+		{
 			ec->BgVideoTransfered = transfered;
+			/* Keep the file open past the movi list, so seeking and looping never reopen it */
+			if (indexed && transfered < s_BgVideoEnd)
+				EVE_Util_seekMediaFile(phost, transfered, s_BgVideoEnd - transfered);
+		}
 		else
+		{
 			EVE_Util_closeFile(phost);
+		}
 	}
 
 	if (res)
@@ -287,6 +500,9 @@ bool Esd_CoWidget_PlayBgVideo(Esd_BitmapCell video)
 		/* Store */
 		ec->BgVideoInfo = info;
 		ec->MediaFifoHandle = fifoHandle;
+		ec->BgVideoBackHandle = Esd_GpuAlloc_Alloc(ga, info->Size, GA_GC_FLAG);
+		if (Esd_GpuAlloc_Get(ga, ec->BgVideoBackHandle) == GA_INVALID)
+			eve_printf_debug("Not enough RAM_G available for a second video bitmap, frames decode in place\n");
 		return true;
 	}
 	else
@@ -354,8 +570,8 @@ bool Esd_CoWidget_PlayVideoFile(const char *filename, uint16_t options)
 	Esd_GpuAlloc_Alloc(Esd_GAlloc, RAM_G_SIZE, GA_GC_FLAG); /* Block allocation */
 	Esd_BitmapHandle_Reset(&ec->HandleState);
 
-	/* FIFO at end of RAM_G */
-	uint32_t fifoSize = 16 * 1024; /* TODO: What's an ideal FIFO size? */
+	/* FIFO at end of RAM_G, playback decodes into RAM_G from address 0 */
+	uint32_t fifoSize = Esd_CoWidget_videoFifoSize(phost, filename);
 	uint32_t fifoAddr = RAM_G_SIZE - fifoSize;
 
 	EVE_MediaFifo_set(phost, fifoAddr, fifoSize);
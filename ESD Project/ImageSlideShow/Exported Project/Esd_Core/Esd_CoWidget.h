@@ -58,6 +58,18 @@ ESD_CORE_EXPORT bool Esd_CoWidget_PlayBgVideo(Esd_BitmapCell video);
 ESD_FUNCTION(Esd_CoWidget_StopBgVideo, Type = void, Attributes = ESD_CORE_EXPORT, Category = EsdUtilities, Include = "Esd_Core.h", Buffered)
 ESD_CORE_EXPORT void Esd_CoWidget_StopBgVideo();
 
+/* Continue the background video from its first frame when it reaches the end,
+without reopening the file. Requires the AVI idx1 index */
+ESD_FUNCTION(Esd_CoWidget_LoopBgVideo, Type = void, Attributes = ESD_CORE_EXPORT, Category = EsdUtilities, Include = "Esd_Core.h", Buffered)
+ESD_PARAMETER(loop, Type = bool, Default = true)
+ESD_CORE_EXPORT void Esd_CoWidget_LoopBgVideo(bool loop);
+
+/* Continue the background video at the specified frame, using the AVI idx1 index.
+Snaps back to the nearest indexed frame for videos longer than ESD_BGVIDEO_INDEX_SIZE frames */
+ESD_FUNCTION(Esd_CoWidget_SeekBgVideo, Type = bool, Attributes = ESD_CORE_EXPORT, Category = EsdUtilities, Include = "Esd_Core.h", Buffered)
+ESD_PARAMETER(frame, Type = uint32_t)
+ESD_CORE_EXPORT bool Esd_CoWidget_SeekBgVideo(uint32_t frame);
+
 ESD_ENUM(Esd_Opt_PlayVideo, Type = uint16_t, Include = "Esd_Core.h", Flags)
 ESD_IDENTIFIER(OPT_FULLSCREEN)
 ESD_IDENTIFIER(OPT_MEDIAFIFO)
@@ -34,10 +34,31 @@
 
 #include "Esd_GpuAlloc.h"
 #include "Esd_LittleFS.h"
+#include "Esd_ResourceInfo.h"
 #include "Esd_Scissor.h"
 #include "Esd_BitmapHandle.h"
 #include "Esd_TouchTag.h"
+#include "Esd_HitTest.h"
 #include "Esd_CoWidget.h"
+#include "Esd_Profile.h"
+#include "Esd_AsyncLoad.h"
+#include "Esd_PerfGate.h"
+#include "Esd_Telemetry.h"
+#include "Esd_Timer.h"
+#include "Esd_Binding.h"
+#include "Esd_Sprite.h"
+#include "Esd_Audio.h"
+#include "Esd_Preview.h"
+#include "Esd_Capture.h"
+#include "Esd_BitmapSave.h"
+#include "Esd_Power.h"
+#include "Esd_SysClk.h"
+#include "Esd_HostMem.h"
+#include "Esd_Settings.h"
+#include "Esd_SpiTune.h"
+#include "Esd_Thermal.h"
+#include "Esd_Quality.h"
+#include "Esd_Background.h"
 
 
 //
@@ -59,6 +80,7 @@ void Esd_CheckTypeSizes();
 #endif
 
 void Esd_CoWidget_Render();
+void Esd_CoWidget_FillBgVideo();
 
 // When not in the simulation, use the Esd_Main__Start etc symbols
 // as exported by the single Application logic document included
@@ -99,6 +121,12 @@ bool cbCmdWait(struct EVE_HalContext *phost)
 	/* Loop an idle task instead of doing nothing */
 	if (ec->Idle)
 		ec->Idle(ec->UserContext);
+	EVE_Log_flush(ESD_LOG_FLUSH_MAX);
+	Esd_CoWidget_FillBgVideo();
+	Esd_Capture_Idle();
+	Esd_BitmapSave_Idle();
+	Esd_Settings_Idle();
+	Esd_TouchTag_Poll();
 	/* EVE_Hal_idle(&ec->HalContext); */ /* Already called by EVE HAL */
 	ec->SwapIdled = true;
 
@@ -107,6 +135,7 @@ bool cbCmdWait(struct EVE_HalContext *phost)
 
 ESD_CORE_EXPORT void Esd_Initialize()
 {
+	Esd_HostMem_PaintStack(); // Before the timer interrupts are set up
 	EVE_Hal_initialize();
 
 	eve_printf_debug(FT_WELCOME_MESSAGE);
@@ -117,11 +146,23 @@ ESD_CORE_EXPORT void Esd_Initialize()
 }
 
 
+// Display refresh period, every frame takes REG_HCYCLE * REG_VCYCLE * REG_PCLK clocks
+static void updateRefresh(Esd_Context *ec)
+{
+	EVE_HalContext *phost = &ec->HalContext;
+	uint64_t clocks = (uint64_t)EVE_Hal_rd16(phost, REG_HCYCLE) * EVE_Hal_rd16(phost, REG_VCYCLE) * EVE_Hal_rd8(phost, REG_PCLK);
+	uint32_t freq = EVE_Hal_rd32(phost, REG_FREQUENCY);
+	ec->RefreshMicros = freq ? (uint32_t)((clocks * 1000000UL) / freq) : 0;
+}
+
 ESD_CORE_EXPORT bool Esd_Open(Esd_Context *ec, Esd_Parameters *ep)
 {
 	EVE_HalContext *phost;
 	EVE_CHIPID_T chipId;
 	size_t deviceIdx;
+#if ESD_SPLASH
+	bool splash;
+#endif
 
 	memset(ec, 0, sizeof(Esd_Context));
 	ec->ClearColor = 0x212121;
@@ -131,8 +172,14 @@ ESD_CORE_EXPORT bool Esd_Open(Esd_Context *ec, Esd_Parameters *ep)
 	ec->Idle = ep->Idle;
 	ec->End = ep->End;
 	ec->UserContext = ep->UserContext;
+	ec->Pipelined = ep->Pipelined;
+	ec->AsyncLoad = ep->AsyncLoad;
+	ec->SkipIdleFrames = ep->SkipIdleFrames;
+	ec->SharedClock = ep->SharedClock;
 
 	ec->MediaFifoHandle = GA_HANDLE_INVALID;
+	ec->BgVideoBackHandle = GA_HANDLE_INVALID;
+	ec->BackgroundHandle = GA_HANDLE_INVALID;
 	Esd_SetCurrent(ec);
 
 
@@ -176,6 +223,15 @@ ESD_CORE_EXPORT bool Esd_Open(Esd_Context *ec, Esd_Parameters *ep)
 		return false;
 	}
 
+	ec->GpuAlloc.RamGSize = RAM_G_SIZE;
+	ec->GpuAlloc.StaticSize = GA_STATIC_SIZE;
+	Esd_GpuAlloc_Reset(&ec->GpuAlloc);
+
+#if ESD_SPLASH
+	/* Put something on screen before anything else that takes time */
+	splash = Esd_Splash_Show(ep->Splash);
+#endif
+
 	{
 		// TODO: Store calibration somewhere
 		if (!Esd_Calibrate())
@@ -184,6 +240,31 @@ ESD_CORE_EXPORT bool Esd_Open(Esd_Context *ec, Esd_Parameters *ep)
 		}
 	}
 
+	updateRefresh(ec);
+	Esd_SetTargetFps(ec, ep->TargetFps);
+
+#if EVE_CMD_PEEPHOLE
+	EVE_CoCmd_peepholeEnable(phost);
+#endif
+
+#if ESD_TOUCHTAG_MULTITOUCH
+	/* Report all contacts of the capacitive touch controller, calibration is done in compatibility mode */
+	Esd_TouchTag_SetMultiTouch(true);
+#endif
+
+#if EVE_INTERRUPT
+	/* Touch is sampled on INT_N, idle frames skip reading the touch registers */
+	EVE_Hal_enableInterrupts(phost, INT_TOUCH);
+#endif
+
+#if ESD_SPLASH
+	if (splash)
+	{
+		/* Calibration drew over the splash, keep it up instead of the spinner */
+		Esd_Splash_Show(ep->Splash);
+	}
+	else
+#endif
 	esd_scope()
 	{
 		/* Show spinner at startup */
@@ -197,9 +278,6 @@ ESD_CORE_EXPORT bool Esd_Open(Esd_Context *ec, Esd_Parameters *ep)
 		ec->SpinnerPopped = true;
 	}
 
-	ec->GpuAlloc.RamGSize = RAM_G_SIZE;
-	Esd_GpuAlloc_Reset(&ec->GpuAlloc);
-
 #ifdef ESD_MEMORYPOOL_ALLOCATOR
 	eve_printf_debug("[Esd MemoryPool] use user config mem allocation, config as max %d, ideal %d\n",
 	    (int)ep->MaxPoolMemory, ep->IdealPoolMemory < ep->MaxPoolMemory ? (int)ep->IdealPoolMemory : (int)ep->MaxPoolMemory);
@@ -214,7 +292,11 @@ ESD_CORE_EXPORT bool Esd_Open(Esd_Context *ec, Esd_Parameters *ep)
 
 ESD_CORE_EXPORT void Esd_Close(Esd_Context *ec)
 {
+	Esd_AsyncLoad_Reset();
 	Esd_ProcessFree();
+#if ESD_SETTINGS
+	Esd_Settings_Commit();
+#endif
 #ifdef ESD_LITTLEFS_FLASH
 	Esd_LittleFS_Unmount();
 #endif
@@ -236,6 +318,122 @@ ESD_CORE_EXPORT void Esd_Release()
 	EVE_Hal_release();
 }
 
+ESD_CORE_EXPORT void Esd_SetTargetFps(Esd_Context *ec, uint8_t fps)
+{
+	uint32_t period;
+	ec->TargetFps = fps;
+	if (ec->MaxFps && (!fps || fps > ec->MaxFps))
+		fps = ec->MaxFps; // TargetFps still holds the requested rate, for when the ceiling is lifted
+	if (!fps)
+	{
+		ec->FrameMicros = 0;
+		return;
+	}
+	period = 1000000UL / fps;
+	if (ec->RefreshMicros)
+	{
+		// Swaps only happen at the end of a refresh, round to the nearest number of refreshes
+		uint32_t refreshes = (period + (ec->RefreshMicros >> 1)) / ec->RefreshMicros;
+		period = (refreshes ? refreshes : 1) * ec->RefreshMicros;
+	}
+	ec->FrameMicros = period;
+	eve_printf_debug("Frame rate target %u Hz, %u us per frame\n", (unsigned int)fps, (unsigned int)period);
+}
+
+ESD_CORE_EXPORT bool Esd_SetPclk(Esd_Context *ec, uint8_t pclk)
+{
+	if (!EVE_Util_setPclk(&ec->HalContext, pclk))
+		return false;
+	updateRefresh(ec);
+	Esd_SysClk_PclkChanged();
+	if (ec->TargetFps)
+		Esd_SetTargetFps(ec, ec->TargetFps); // Rounded to the new refresh period
+	ec->SwapMicros = EVE_micros(); // Not a missed frame
+	eve_printf_debug("REG_PCLK set to %u, %u us per refresh\n", (unsigned int)pclk, (unsigned int)ec->RefreshMicros);
+	return true;
+}
+
+ESD_CORE_EXPORT void Esd_SetLowRefresh(Esd_Context *ec, bool low)
+{
+	uint32_t pclk = ec->HalContext.PCLK;
+	if (low == ec->LowRefresh || !pclk)
+		return;
+	if (low)
+	{
+		pclk *= ESD_LOW_REFRESH_FACTOR;
+		if (pclk > 255)
+		{
+			eve_printf_debug("REG_PCLK cannot be lowered by ESD_LOW_REFRESH_FACTOR\n");
+			return;
+		}
+	}
+	else
+	{
+		pclk /= ESD_LOW_REFRESH_FACTOR;
+	}
+	if (Esd_SetPclk(ec, (uint8_t)pclk))
+		ec->LowRefresh = low;
+}
+
+// Position of a local time in microseconds within the frame period on the shared clock
+static uint32_t sharedPhase(Esd_Context *ec, uint32_t micros)
+{
+	int64_t shared = (int64_t)(uint32_t)(EVE_millis() + (uint32_t)ec->SharedOffset) * 1000 + (int32_t)(micros - EVE_micros());
+	int64_t phase = shared % ec->FrameMicros;
+	return (uint32_t)(phase < 0 ? phase + ec->FrameMicros : phase);
+}
+
+// Sleep until the next frame is due. The swap lands on the first refresh after it is issued,
+// so the frame starts one refresh period before the target swap time
+static void paceFrame(Esd_Context *ec)
+{
+	uint32_t target, deadline;
+	int32_t wait;
+
+	if (!ec->FrameMicros || !ec->Frame)
+		return;
+
+	target = ec->SwapMicros + ec->FrameMicros;
+	if (ec->SharedSynced && ec->FrameMicros > ec->RefreshMicros)
+	{
+		// Below the refresh rate, move the swap to the refresh nearest to the shared frame grid, so all
+		// panels show a frame on the same refresh. The refreshes themselves are not locked between panels,
+		// so within half a refresh is as close as it gets
+		uint32_t phase = sharedPhase(ec, target);
+		uint32_t margin = ec->RefreshMicros >> 1;
+		if (phase > margin && phase < ec->FrameMicros - margin)
+		{
+			if (phase < (ec->FrameMicros >> 1))
+				target -= phase;
+			else
+				target += ec->FrameMicros - phase;
+			ec->SwapMicros = target - ec->FrameMicros; // Not a missed frame
+		}
+	}
+
+	deadline = target - ec->RefreshMicros;
+	wait = (int32_t)(deadline - EVE_micros());
+	if (wait >= 1000)
+		EVE_sleep((uint32_t)wait / 1000);
+}
+
+ESD_CORE_EXPORT void Esd_Invalidate()
+{
+	Esd_CurrentContext->Invalidated = true;
+}
+
+// Whether anything may have changed on screen since the last Render
+static bool renderNeeded(Esd_Context *ec)
+{
+	if (!ec->SkipIdleFrames || ec->Invalidated || !ec->Frame)
+		return true;
+	if (ec->ShowLogo || ec->ShowingLogo || ec->SpinnerPopup || ec->SpinnerPopped)
+		return true;
+	if (ec->HasReset || ec->HalContext.CmdFault || ec->BgVideoInfo || ec->AnimationChannelsActive)
+		return true;
+	return (ec->Millis - ec->RenderMillis) >= ESD_IDLE_REFRESH_MS;
+}
+
 ESD_CORE_EXPORT void Esd_Loop(Esd_Context *ec)
 {
 	EVE_HalContext *phost = &ec->HalContext;
@@ -249,11 +447,33 @@ ESD_CORE_EXPORT void Esd_Loop(Esd_Context *ec)
 
 	while (Esd_IsRunning__ESD() && !ec->RequestStop)
 	{
+		paceFrame(ec);
 		Esd_Update(ec);
-		Esd_Render(ec);
-		Esd_WaitSwap(ec);
+		if (Esd_AsyncLoad_Inflating() || !renderNeeded(ec))
+		{
+			// The display list on screen is still valid, or the command buffer is held by CMD_INFLATE
+			if (ec->FrameMicros)
+				ec->SwapMicros += ec->FrameMicros; // Keep the schedule as if the frame was swapped
+			else
+				EVE_sleep(ESD_IDLE_FRAME_MS);
+			continue;
+		}
+		if (ec->Pipelined)
+		{
+			// The coprocessor has been working on the previous frame during Update,
+			// only block here, before the commands of the next frame are written
+			Esd_WaitSwap(ec);
+			Esd_Render(ec);
+		}
+		else
+		{
+			Esd_Render(ec);
+			Esd_WaitSwap(ec);
+		}
 	}
 
+	if (ec->SwapPending)
+		Esd_WaitSwap(ec);
 	Esd_Stop(ec);
 }
 
@@ -263,10 +483,20 @@ ESD_CORE_EXPORT void Esd_Start(Esd_Context *ec)
 
 	// Initialize framework
 	ec->Frame = 0;
+	ec->CompletedFrame = 0;
 	ec->Millis = EVE_millis();
 
 	// Initialize storage
 	EVE_Util_loadSdCard(&ec->HalContext);
+#ifdef ESD_BUNDLE_FILE
+	Esd_Bundle_Open(ESD_BUNDLE_FILE);
+#endif
+#if ESD_SETTINGS
+	Esd_Settings_Open();
+#endif
+#if ESD_SPI_TUNE
+	Esd_SpiTune_Apply(); // Before the application puts anything in RAM_G
+#endif
 
 	// Initialize application
 	if (ec->Start)
@@ -282,18 +512,26 @@ ESD_CORE_EXPORT void Esd_Update(Esd_Context *ec)
 	EVE_HalContext *phost = &ec->HalContext;
 	Esd_SetCurrent(ec);
 
+	Esd_Profile_Frame(ec->Frame);
+	Esd_Profile_Begin(ESD_PROFILE_UPDATE);
+	Esd_Quality_FrameStart();
+	++ec->UpdateFrame;
+
 	// Restore initial frame values
 	// EVE_CoCmd_loadIdentity(phost); // ?
 	Esd_ProcessFree();
 	Esd_BitmapHandle_FrameStart(&ec->HandleState);
 
 	if (ec->ShowLogo)
+	{
+		Esd_Profile_End(ESD_PROFILE_UPDATE);
 		return;
+	}
 	if (ec->ShowingLogo)
 		ec->Millis = EVE_millis(); // Reset time
 
-	// Verify initialization
-	EVE_Util_loadSdCard(phost); // Does this really need phost???
+	// Pick up SD card insertion or removal, only talks to the SD host a few times per second
+	EVE_Util_pollSdCard(phost);
 
 	// Idle at least once every frame
 	ec->LoopState = ESD_LOOPSTATE_IDLE;
@@ -301,23 +539,50 @@ ESD_CORE_EXPORT void Esd_Update(Esd_Context *ec)
 	{
 		if (ec->Idle)
 			ec->Idle(ec->UserContext);
+		EVE_Log_flush(ESD_LOG_FLUSH_MAX);
 		EVE_Hal_idle(phost);
 	}
+	// Top up the background video between frames
+	Esd_CoWidget_FillBgVideo();
+	Esd_Capture_Idle(); // Send the next stripe of a screen capture
+	Esd_BitmapSave_Idle();
+	Esd_Settings_Idle();
+	if (!Esd_AsyncLoad_Inflating())
+		Esd_GpuAlloc_Scrub(Esd_GAlloc); // Check one persistent allocation for RAM_G corruption
 
 	// Update GUI state before render
 	ec->LoopState = ESD_LOOPSTATE_UPDATE;
 	ms = EVE_millis(); // Calculate frame time delta
 	ec->DeltaMs = ms - ec->Millis;
 	ec->Millis = ms;
-	Esd_GpuAlloc_Update(Esd_GAlloc); // Run GC
+	ec->SharedSynced = ec->SharedClock && ec->SharedClock(&ec->SharedOffset);
+	if (!ec->SharedSynced)
+		ec->SharedOffset = 0;
+	Esd_Profile_Begin(ESD_PROFILE_GPUALLOC);
+	if (!Esd_AsyncLoad_Inflating())
+		Esd_GpuAlloc_Update(Esd_GAlloc); // Run GC, defragmentation sends CMD_MEMCPY
+	Esd_Profile_End(ESD_PROFILE_GPUALLOC);
+	Esd_Telemetry_Update();
+	Esd_SysClk_Update(); // Raise or lower the EVE clock for the measured load
+	Esd_AsyncLoad_Update(); // Upload queued bitmaps
+	Esd_Audio_Update(); // Refill the audio stream
+	Esd_Preview_Update(); // Swap in a received preview bitmap
+	Esd_Capture_Update(); // Snapshot the screen for remote capture
+	Esd_Profile_Begin(ESD_PROFILE_TOUCHTAG);
 	Esd_TouchTag_Update(NULL); // Update touch
+	Esd_Power_Update(); // Dim or go into standby when nobody touches the screen
+	Esd_Thermal_Update(); // Throttle when the board runs hot
+	Esd_HitTest_Update(); // Route touches outside of tagged widgets
+	Esd_Profile_End(ESD_PROFILE_TOUCHTAG);
 	if (ec->AnimationChannelsSetup)
-		ec->AnimationChannelsActive = EVE_Hal_rd32(phost, REG_ANIM_ACTIVE);
+		ec->AnimationChannelsActive = EVE_Hal_rd32(phost, REG_ANIM_ACTIVE); // Active channels also keep idle frames from being skipped
 	else
 		ec->AnimationChannelsActive = 0;
 	if (ec->Update)
 		ec->Update(ec->UserContext);
-		// Esd_Timer_UpdateGlobal(); // TODO
+	Esd_Timer_UpdateGlobal(ec->DeltaMs);
+	Esd_Sprite_UpdateGlobal(ec->DeltaMs); // Advance the frames of playing sprites
+	Esd_Binding_Update(); // Damage the widgets bound to changed cells
 
 #ifdef ESD_MEMORYPOOL_ALLOCATOR
 	eve_printf_debug_once("[Esd MemoryPool] esd update, memory usage is %d\n", Esd_MemoryPool_GetTotalUsed(Esd_MP));
@@ -325,9 +590,10 @@ ESD_CORE_EXPORT void Esd_Update(Esd_Context *ec)
 
 	// Return to idle state inbetween
 	ec->LoopState = ESD_LOOPSTATE_IDLE;
+	Esd_Profile_End(ESD_PROFILE_UPDATE);
 }
 
-ESD_CORE_EXPORT void Esd_Render(Esd_Context *ec)
+static void render(Esd_Context *ec)
 {
 	EVE_HalContext *phost = &ec->HalContext;
 	Esd_SetCurrent(ec);
@@ -357,6 +623,8 @@ ESD_CORE_EXPORT void Esd_Render(Esd_Context *ec)
 
 	// Process all coprocessor commands
 	ec->LoopState = ESD_LOOPSTATE_RENDER;
+	ec->Invalidated = false; // Changes made during render show in the next frame
+	ec->RenderMillis = ec->Millis;
 #if defined(_DEBUG)
 	// This will cause a dark red screen in case background video incorrectly swaps the display
 	EVE_Hal_startTransfer(phost, EVE_TRANSFER_WRITE, RAM_DL);
@@ -365,13 +633,16 @@ ESD_CORE_EXPORT void Esd_Render(Esd_Context *ec)
 	EVE_Hal_transfer32(phost, DISPLAY());
 	EVE_Hal_endTransfer(phost);
 #endif
+	Esd_Profile_Traffic(phost);
+	Esd_PerfGate_Frame(phost);
 	EVE_CoCmd_dlStart(phost);
 	Esd_CoWidget_Render();
 	EVE_CoDl_clearColorRgb_ex(phost, ec->ClearColor); // Set CLEAR_COLOR_RGB from user var
 	EVE_CoDl_clearTag(phost, 255); // Always default to 255, so no touch = 0, touch non-tag = 255
 	EVE_CoDl_clear(phost, true, true, true);
-	if (ec->Render)
+	if (Esd_Background_Render() && ec->Render) // The frame the background is captured from shows it alone
 		ec->Render(ec->UserContext);
+	Esd_Render_BatchReset();
 
 	if (ec->SpinnerPopup)
 	{
@@ -399,16 +670,29 @@ ESD_CORE_EXPORT void Esd_Render(Esd_Context *ec)
 
 	// Advance frame count
 	++ec->Frame;
+	ec->SwapPending = true;
 }
 
-ESD_CORE_EXPORT bool Esd_WaitSwap(Esd_Context *ec)
+ESD_CORE_EXPORT void Esd_Render(Esd_Context *ec)
+{
+	Esd_Profile_Begin(ESD_PROFILE_RENDER);
+	Esd_Profile_Begin(ESD_PROFILE_COPROCESSOR);
+	Esd_SysClk_RenderBegin();
+	render(ec);
+	Esd_SysClk_RenderEnd();
+	Esd_Profile_End(ESD_PROFILE_RENDER);
+}
+
+static bool waitSwap(Esd_Context *ec)
 {
 	EVE_HalContext *phost = &ec->HalContext;
 	Esd_SetCurrent(ec);
 	(void)phost;
 
 	ec->SwapIdled = false;
-	EVE_Cmd_waitFlush(&ec->HalContext);
+	ec->SwapPending = false;
+	Esd_SysClk_WaitFlush(&ec->HalContext); // Also measures the coprocessor load
+	Esd_Quality_FrameEnd(); // Reduce or restore quality for the measured frame time
 	ec->HasReset = false;
 
 	/* Reset the coprocessor in case of fault */
@@ -419,10 +703,15 @@ ESD_CORE_EXPORT bool Esd_WaitSwap(Esd_Context *ec)
 		EVE_sleep(1000);
 #endif
 
-		/* TODO: Create a utility function that resets the coprocessor and all cached state */
+		/* Only the coprocessor and the state cached against it are reset, RAM_G survives unless the fault overwrote it */
 		EVE_Util_resetCoprocessor(&ec->HalContext);
 		Esd_BitmapHandle_Reset(&ec->HandleState);
 		ec->AnimationChannelsSetup = 0;
+		if (!Esd_GpuAlloc_Verify(&ec->GpuAlloc))
+		{
+			eve_printf_debug("RAM_G lost in coprocessor fault, reloading all assets\n");
+			Esd_GpuAlloc_Reset(&ec->GpuAlloc);
+		}
 #ifdef ESD_LITTLEFS_FLASH
 		if (ec->LfsUnflushed)
 		{
@@ -436,20 +725,54 @@ ESD_CORE_EXPORT bool Esd_WaitSwap(Esd_Context *ec)
 	}
 
 	while (EVE_Hal_rd8(phost, REG_DLSWAP) != 0)
-		; // TODO: Handle wait abort
+	{
+		// TODO: Handle wait abort
+		if (ec->FrameMicros)
+			EVE_sleep(1); // Paced, no need to catch the swap to the microsecond
+	}
+
+	// Every frame rendered so far is now on screen or replaced, RAM_G released before the last one can be reused
+	ec->CompletedFrame = ec->Frame;
+	Esd_ProcessGpuFree();
+	Esd_Splash_Release();
+
+	if (ec->FrameMicros)
+	{
+		uint32_t micros = EVE_micros();
+		uint32_t late = (micros - ec->SwapMicros) - ec->FrameMicros;
+		if (ec->Frame > 1 && (int32_t)late > (int32_t)(ec->RefreshMicros ? (ec->RefreshMicros >> 1) : (ec->FrameMicros >> 1)))
+		{
+			++ec->MissedFrames;
+			eve_printf_debug("Missed frame deadline by %u us\n", (unsigned int)late);
+		}
+		ec->SwapMicros = micros;
+	}
 
 	return true;
 }
 
+ESD_CORE_EXPORT bool Esd_WaitSwap(Esd_Context *ec)
+{
+	bool res;
+	Esd_Profile_Begin(ESD_PROFILE_WAITSWAP);
+	res = waitSwap(ec);
+	Esd_Profile_End(ESD_PROFILE_WAITSWAP);
+	return res;
+}
+
 ESD_CORE_EXPORT void Esd_Stop(Esd_Context *ec)
 {
 	Esd_SetCurrent(ec);
 
 	// Cleanup application (generally unreachable)
 	ec->LoopState = ESD_LOOPSTATE_NONE;
-	// Esd_Timer_CancelGlobal(); // TODO
+	Esd_Timer_CancelGlobal();
+	Esd_Binding_UnregisterAll();
+	Esd_Sprite_StopGlobal();
+	Esd_Audio_Stop();
 	if (ec->End)
 		ec->End(ec->UserContext);
+	EVE_Log_flush(0);
 }
 
 /* Implements a generic main function, for reference only */
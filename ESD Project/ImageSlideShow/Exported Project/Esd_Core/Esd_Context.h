@@ -37,6 +37,7 @@
 #include "Esd_Scissor.h"
 #include "Esd_BitmapHandle.h"
 #include "Esd_TouchTag.h"
+#include "Esd_Splash.h"
 
 #ifdef ESD_MEMORYPOOL_ALLOCATOR
 #include "Esd_MemoryPool.h"
@@ -57,10 +58,72 @@
 
 #define ESD_MULTIGRADIENT_CACHE
 
+// Recently written multi gradient palettes, reused by colour rather than written again.
+// At most half the cells of the multi gradient bitmap, so a reused cell is not overwritten while it is displayed
+#ifndef ESD_MULTIGRADIENT_CACHE_NB
+#define ESD_MULTIGRADIENT_CACHE_NB 16
+#endif
+
+// With SkipIdleFrames, render at least this often even when nothing called Esd_Invalidate,
+// to pick up widget values that are computed by input functions rather than set
+#ifndef ESD_IDLE_REFRESH_MS
+#define ESD_IDLE_REFRESH_MS 1000
+#endif
+
+// Time Esd_Loop sleeps in place of a skipped frame, so touch and timers are still checked at about the display rate
+#ifndef ESD_IDLE_FRAME_MS
+#define ESD_IDLE_FRAME_MS 16
+#endif
+
+// Messages queued by eve_printf_debug with EVE_DEFERRED_LOG that are formatted per idle call, 0 for all
+#ifndef ESD_LOG_FLUSH_MAX
+#define ESD_LOG_FLUSH_MAX 4
+#endif
+
+// Background video media FIFO level in percent below which idle time refills it from the SD card
+#ifndef ESD_BGVIDEO_WATERMARK
+#define ESD_BGVIDEO_WATERMARK 75
+#endif
+
+// Media FIFO size range for video playback, sized within it from the AVI header data rate
+#ifndef ESD_VIDEO_FIFO_MIN
+#define ESD_VIDEO_FIFO_MIN (16 * 1024)
+#endif
+#ifndef ESD_VIDEO_FIFO_MAX
+#define ESD_VIDEO_FIFO_MAX (128 * 1024)
+#endif
+
+// Number of frames at the peak data rate the media FIFO should hold
+#ifndef ESD_VIDEO_FIFO_FRAMES
+#define ESD_VIDEO_FIFO_FRAMES 4
+#endif
+
+// Entries in the background video frame offset table, longer videos only index every n-th frame
+#ifndef ESD_BGVIDEO_INDEX_SIZE
+#define ESD_BGVIDEO_INDEX_SIZE 1024
+#endif
+
+// Factor by which Esd_SetLowRefresh multiplies REG_PCLK
+#ifndef ESD_LOW_REFRESH_FACTOR
+#define ESD_LOW_REFRESH_FACTOR 2
+#endif
+
+// RAM_G allocations which may be waiting for their fence at once, see Esd_DeferredGpuFree
+#ifndef ESD_GPU_RECLAIM_MAX
+#define ESD_GPU_RECLAIM_MAX 16
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/* RAM_G allocation released by Esd_DeferredGpuFree */
+typedef struct
+{
+	Esd_GpuHandle Handle;
+	uint32_t Fence; //< Value of CompletedFrame from which the allocation is no longer on screen
+} Esd_GpuReclaim;
+
 /* Runtime context of ESD */
 typedef struct
 {
@@ -69,6 +132,18 @@ typedef struct
 	uint32_t Millis; //< Time in milliseconds for current frame
 	uint32_t DeltaMs; //< Delta time in milliseconds between frames
 	uint32_t Frame; //< Number of times Render has been called
+	uint32_t UpdateFrame; //< Number of times Update has been called, keeps counting while frames are skipped
+	uint32_t RenderMillis; //< Time in milliseconds of the last Render
+	uint32_t RefreshMicros; //< Display refresh period in microseconds, from the panel timing registers, 0 if unknown
+	uint32_t FrameMicros; //< Target frame period in microseconds, a whole number of refresh periods, 0 when not pacing
+	uint8_t TargetFps; //< Frame rate FrameMicros was computed for, 0 when not pacing
+	uint8_t MaxFps; //< Ceiling on the paced frame rate, set by Esd_Thermal, 0 when there is none
+	bool LowRefresh; //< Display runs at the low refresh rate, see Esd_SetLowRefresh
+	uint32_t SwapMicros; //< Time in microseconds at which the last swap was seen complete, the schedule of the next frame
+	uint32_t MissedFrames; //< Number of swaps that landed at least one refresh later than the target frame period
+	bool (*SharedClock)(int32_t *offset); //< See Esd_Parameters.SharedClock
+	int32_t SharedOffset; //< Shared time less local time in milliseconds, for the current frame
+	bool SharedSynced; //< SharedOffset is valid for the current frame
 	esd_rgb32_t ClearColor; //< Screen clear color (default is 0x212121)
 	uint8_t LoopState; //< Current state of loop
 
@@ -79,19 +154,30 @@ typedef struct
 
 	bool HasReset; //< True if the coprocessor reset during in the previous frame
 	bool SwapIdled; //< True if idled during swap
+	bool Pipelined; //< Esd_Loop updates the next frame while the coprocessor is still processing the previous one
+	bool SwapPending; //< Render has been called without Esd_WaitSwap
+	bool SkipIdleFrames; //< Esd_Loop skips Render and swap while the previous display list is still valid
+	bool Invalidated; //< Something changed since the last Render, set by Esd_Invalidate
+	bool AsyncLoad; //< Esd_LoadBitmap uploads uncompressed bitmaps from the SD card in the background
+	bool Preloading; //< Rendering a hidden page, Esd_LoadBitmap queues on the background loader regardless of AsyncLoad
 	bool SpinnerPopped; //< Spinner is currently visible
 	bool ShowingLogo; //< Logo is currently showing (animation already finished)
 	void *CmdOwner; //< Owner of currently long-running coprocessor function (sketch, spinner, etc.)
 
-	void *DeferredFree;
+	void *DeferredFree; //< Host memory released at the next frame start
+	Esd_GpuReclaim GpuReclaim[ESD_GPU_RECLAIM_MAX]; //< RAM_G allocations released once the coprocessor has completed their fence
+	uint32_t NbGpuReclaim;
+	uint32_t CompletedFrame; //< Number of frames whose swap the coprocessor has completed
 
 	Esd_HandleState HandleState;
 
 	Esd_GpuHandle MultiGradientGpuHandle; //< Multi gradient rendering bitmap
 	uint16_t MultiGradientCell; //< Next available cell in the bitmap
 #ifdef ESD_MULTIGRADIENT_CACHE
-	int16_t MultiGradientCacheIdx;
-	uint64_t MultiGradientCache[8];
+	int16_t MultiGradientCacheIdx; //< Next cache entry to replace
+	int16_t MultiGradientCacheNb; //< Valid cache entries
+	uint64_t MultiGradientCache[ESD_MULTIGRADIENT_CACHE_NB]; //< Palette colours
+	uint16_t MultiGradientCacheCell[ESD_MULTIGRADIENT_CACHE_NB]; //< Cell holding the palette
 #endif
 
 	uint32_t AnimationChannelsReserved; //< Reserved animation channels, bitfield
@@ -101,8 +187,16 @@ typedef struct
 	Esd_BitmapInfo *BgVideoInfo; //< Currently playing background video
 	uint32_t BgVideoTransfered;
 	bool bAllFramePlayed;
+	bool BgVideoLoop; //< Background video continues from its first frame at the end
 
 	Esd_GpuHandle MediaFifoHandle; //< Media fifo used for background video playback
+	Esd_GpuHandle BgVideoBackHandle; //< Bitmap the next background video frame decodes into, swapped with the displayed one once complete
+
+	Esd_Callback RenderBackground; //< Draws the static background layer, see Esd_Background.h
+	void *BackgroundContext;
+	Esd_GpuHandle BackgroundHandle; //< Full screen snapshot of the background layer
+	uint32_t BackgroundFrame; //< Frame in which the background was rendered alone to be captured
+	uint8_t BackgroundState;
 
 #ifdef ESD_LITTLEFS_FLASH
 	bool LfsMounted;
@@ -153,6 +247,34 @@ typedef struct
 	Esd_Callback End;
 	void *UserContext;
 
+	/* Run Update of the next frame before waiting for the swap of the previous frame in Esd_Loop.
+	Update must not depend on the previous frame having finished rendering */
+	bool Pipelined;
+
+	/* Upload uncompressed bitmaps from the SD card over several frames from Esd_Update,
+	instead of stalling the render pass that first uses them. See Esd_AsyncLoad.h */
+	bool AsyncLoad;
+
+	/* Keep showing the previous frame instead of rendering and swapping, as long as nothing called Esd_Invalidate.
+	Geometry changes, timers, touch, animations and completed bitmap loads invalidate automatically,
+	other state changes made by the application should call Esd_Invalidate. See ESD_IDLE_REFRESH_MS */
+	bool SkipIdleFrames;
+
+	/* Pace Esd_Loop to this frame rate, rounded to a whole divisor of the display refresh rate.
+	The MCU sleeps until the frame is due instead of spinning on the swap. 0 runs as fast as possible */
+	uint8_t TargetFps;
+
+	/* Clock shared with the other panels of a display wall, for example timesync_offset of the BSP RS-485 time sync.
+	Returns false while not synchronised, otherwise sets the offset in milliseconds from EVE_millis to the shared time.
+	The frame pacing keeps the swaps on a grid of frame periods of the shared time, and widgets such as the image
+	slide show schedule their transitions against Esd_GetSharedMillis, so the panels change together without messages */
+	bool (*SharedClock)(int32_t *offset);
+
+#if ESD_SPLASH
+	/* Image shown from program memory while booting, until the first frame. See Esd_Splash.h */
+	const Esd_SplashImage *Splash;
+#endif
+
 #ifdef ESD_FLASH_FILES
 	/* Flash file path */
 	eve_tchar_t FlashFilePaths[ESD_FLASH_NB][260];
@@ -184,7 +306,8 @@ ESD_CORE_EXPORT void Esd_Defaults(Esd_Parameters *ep);
 ESD_CORE_EXPORT bool Esd_Open(Esd_Context *ec, Esd_Parameters *ep);
 ESD_CORE_EXPORT void Esd_Close(Esd_Context *ec);
 
-/* Main loop, calls Esd_Start, Esd_Update, Esd_WaitSwap, and Esd_Stop */
+/* Main loop, calls Esd_Start, Esd_Update, Esd_Render, Esd_WaitSwap, and Esd_Stop.
+In pipelined mode, Esd_WaitSwap of the previous frame is called after Esd_Update, right before Esd_Render */
 ESD_CORE_EXPORT void Esd_Loop(Esd_Context *ec);
 
 ESD_CORE_EXPORT void Esd_Start(Esd_Context *ec);
@@ -193,10 +316,32 @@ ESD_CORE_EXPORT void Esd_Render(Esd_Context *ec);
 ESD_CORE_EXPORT bool Esd_WaitSwap(Esd_Context *ec);
 ESD_CORE_EXPORT void Esd_Stop(Esd_Context *ec);
 
+/// Change the frame rate targeted by Esd_Loop, see Esd_Parameters.TargetFps
+ESD_CORE_EXPORT void Esd_SetTargetFps(Esd_Context *ec, uint8_t fps);
+
+/// Change REG_PCLK of the running display, the refresh period and the frame pacing follow it
+ESD_CORE_EXPORT bool Esd_SetPclk(Esd_Context *ec, uint8_t pclk);
+
+/// Switch between the refresh rate set up at boot, for animations, and one ESD_LOW_REFRESH_FACTOR times lower,
+/// for complex static pages, which gives the graphics engine as many times more clocks per line
+ESD_CORE_EXPORT void Esd_SetLowRefresh(Esd_Context *ec, bool low);
+
+/// Request the next frame to be rendered, when idle frames are skipped
+ESD_FUNCTION(Esd_Invalidate, DisplayName = "Invalidate", Category = EsdUtilities, Include = "Esd_Core.h")
+ESD_CORE_EXPORT void Esd_Invalidate();
+
 /// A function to get milliseconds for current frame
 ESD_FUNCTION(Esd_GetMillis, Type = uint32_t, DisplayName = "Get Milliseconds", Category = EsdUtilities, Inline, Include = "Esd_Core.h")
 static inline uint32_t Esd_GetMillis() { return Esd_CurrentContext->Millis; }
 
+/// Time in milliseconds for the current frame on the clock shared by the display wall, the local time while not synchronised
+ESD_FUNCTION(Esd_GetSharedMillis, Type = uint32_t, DisplayName = "Get Shared Milliseconds", Category = EsdUtilities, Inline, Include = "Esd_Core.h")
+static inline uint32_t Esd_GetSharedMillis() { return Esd_CurrentContext->Millis + (uint32_t)Esd_CurrentContext->SharedOffset; }
+
+/// Whether the current frame follows the clock of the display wall, see Esd_Parameters.SharedClock
+ESD_FUNCTION(Esd_IsSharedClockSynced, Type = bool, DisplayName = "Is Shared Clock Synced", Category = EsdUtilities, Inline, Include = "Esd_Core.h")
+static inline bool Esd_IsSharedClockSynced() { return Esd_CurrentContext->SharedSynced; }
+
 /// A function to get the difference in milliseconds since last frame Update call
 ESD_FUNCTION(Esd_GetDeltaMs, Type = uint32_t, DisplayName = "Get Delta Ms", Category = EsdUtilities, Inline, Include = "Esd_Core.h")
 static inline uint32_t Esd_GetDeltaMs() { return Esd_CurrentContext->DeltaMs; }
@@ -37,6 +37,12 @@
 #include "Esd_Render.h"
 #include "Esd_Utility.h"
 #include "Esd_CoWidget.h"
+#include "Esd_DlCache.h"
+#include "Esd_AsyncLoad.h"
+#include "Esd_Binding.h"
+#include "Esd_Sprite.h"
+#include "Esd_Background.h"
+#include "Esd_Gesture.h"
 
 #endif /* #ifndef ESD_CORE__H */
 
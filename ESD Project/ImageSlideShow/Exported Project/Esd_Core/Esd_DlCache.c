@@ -0,0 +1,111 @@
+
+#include "Esd_DlCache.h"
+
+#include "Esd_Context.h"
+
+#include <string.h>
+
+ESD_CORE_EXPORT bool Esd_DlCache_Begin(Esd_DlCache *cache)
+{
+	EVE_HalContext *phost = Esd_GetHost();
+	uint32_t addr;
+
+	eve_assert(!cache->Recording);
+	addr = cache->Size ? Esd_GpuAlloc_Get(Esd_GAlloc, cache->GpuHandle) : GA_INVALID;
+	if (addr == GA_INVALID && cache->Blob)
+	{
+		/* Upload the precompiled fragment, it is rendered as usual when there is no RAM_G */
+		Esd_DlCache_Invalidate(cache);
+		cache->GpuHandle = Esd_GpuAlloc_Alloc(Esd_GAlloc, cache->BlobSize, GA_GC_FLAG);
+		addr = Esd_GpuAlloc_Get(Esd_GAlloc, cache->GpuHandle);
+		if (addr != GA_INVALID)
+		{
+			EVE_Hal_wrProgMem(phost, addr, cache->Blob, cache->BlobSize);
+			cache->Size = cache->BlobSize;
+		}
+	}
+#if (EVE_DL_OPTIMIZE) || (EVE_DL_CACHE_SCISSOR)
+	if (addr != GA_INVALID && !cache->Blob && memcmp(&cache->State, &EVE_DL_STATE, sizeof(EVE_HalDlState)))
+	{
+		/* Recorded with different state */
+		Esd_DlCache_Invalidate(cache);
+		addr = GA_INVALID;
+	}
+#endif
+
+	if (addr != GA_INVALID)
+	{
+		/* Replay, the fragment leaves the display list state as it was */
+		EVE_CoCmd_append(phost, addr, cache->Size);
+#if (EVE_DL_OPTIMIZE)
+		phost->DlPrimitive = 0;
+#endif
+		return false;
+	}
+
+	/* Record, the coprocessor must have caught up to find where the fragment starts */
+	Esd_DlCache_Invalidate(cache);
+	EVE_CoCmd_peepholeFlush(phost); /* Nothing in the fragment may rely on state from before it */
+	EVE_Cmd_waitFlush(phost);
+	cache->Start = EVE_Hal_rd16(phost, REG_CMD_DL);
+	cache->Recording = true;
+#if (EVE_DL_OPTIMIZE) || (EVE_DL_CACHE_SCISSOR)
+	memcpy(&cache->State, &EVE_DL_STATE, sizeof(EVE_HalDlState));
+#endif
+	EVE_CoDl_saveContext(phost);
+#if (EVE_DL_OPTIMIZE)
+	phost->DlPrimitive = 0;
+#endif
+	return true;
+}
+
+ESD_CORE_EXPORT void Esd_DlCache_End(Esd_DlCache *cache)
+{
+	EVE_HalContext *phost = Esd_GetHost();
+	uint16_t end;
+	uint32_t addr;
+
+	eve_assert(cache->Recording);
+	cache->Recording = false;
+	EVE_CoDl_restoreContext(phost);
+#if (EVE_DL_OPTIMIZE)
+	phost->DlPrimitive = 0;
+#endif
+
+	EVE_Cmd_waitFlush(phost);
+	if (phost->CmdFault)
+		return;
+	end = EVE_Hal_rd16(phost, REG_CMD_DL);
+	if (end <= cache->Start)
+		return;
+
+	cache->GpuHandle = Esd_GpuAlloc_Alloc(Esd_GAlloc, end - cache->Start, GA_GC_FLAG);
+	addr = Esd_GpuAlloc_Get(Esd_GAlloc, cache->GpuHandle);
+	if (addr == GA_INVALID)
+		return; /* Out of RAM_G, keep rendering the fragment every frame */
+
+	/* Copied after the fragment has been built, before the frame is swapped */
+	EVE_CoCmd_memCpy(phost, addr, RAM_DL + cache->Start, end - cache->Start);
+	cache->Size = end - cache->Start;
+}
+
+ESD_CORE_EXPORT void Esd_DlCache_Preload(Esd_DlCache *cache, eve_progmem_const uint8_t *blob, uint32_t size)
+{
+	eve_assert(!cache->Recording);
+	eve_assert(!(size & 3));
+	Esd_DlCache_Invalidate(cache);
+	cache->Blob = size ? blob : NULL;
+	cache->BlobSize = size;
+}
+
+ESD_CORE_EXPORT void Esd_DlCache_Invalidate(Esd_DlCache *cache)
+{
+	if (cache->Size)
+	{
+		Esd_GpuAlloc_Free(Esd_GAlloc, cache->GpuHandle);
+		cache->GpuHandle = GA_HANDLE_INVALID;
+		cache->Size = 0;
+	}
+}
+
+/* end of file */
@@ -0,0 +1,84 @@
+
+#ifndef ESD_DLCACHE__H
+#define ESD_DLCACHE__H
+
+#include "Esd_Base.h"
+#include "Esd_GpuAlloc.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+Cached display list fragments.
+A static widget subtree is rendered once between Esd_DlCache_Begin and Esd_DlCache_End,
+the generated display list is copied from RAM_DL into RAM_G, and on later frames it is
+replayed with a single CMD_APPEND instead of rendering the subtree again.
+The fragment is wrapped in SAVE_CONTEXT and RESTORE_CONTEXT, and is recorded again
+whenever the display list state at the start of the fragment differs from the recording,
+or the RAM_G allocation was lost.
+
+Usage:
+	if (Esd_DlCache_Begin(&context->DlCache))
+	{
+		// Render the static subtree
+		Esd_DlCache_End(&context->DlCache);
+	}
+
+A fragment can also be precompiled. Tools/esd_dlblob.py turns a RAM_DL dump of the page, taken
+on the emulator or on the device, into a display list in program memory. After Esd_DlCache_Preload
+the first Esd_DlCache_Begin uploads it to RAM_G instead of recording, and it is uploaded again
+if the allocation is lost. The display list state is not compared for such a fragment. It was
+captured from a fresh display list, so append it before anything in the frame changes the context.
+Esd_DlCache_Invalidate keeps the precompiled display list, Esd_DlCache_Preload with NULL drops it.
+*/
+
+typedef struct
+{
+	/// Recorded display list in RAM_G
+	Esd_GpuHandle GpuHandle;
+	/// Size of the recorded display list in bytes, 0 when nothing is recorded
+	uint32_t Size;
+	/// REG_CMD_DL at the start of recording
+	uint16_t Start;
+	/// Set between Esd_DlCache_Begin and Esd_DlCache_End while recording
+	bool Recording;
+#if (EVE_DL_OPTIMIZE) || (EVE_DL_CACHE_SCISSOR)
+	/// Display list state at the start of the recording
+	EVE_HalDlState State;
+#endif
+	/// Precompiled display list, uploaded instead of recording when set
+	eve_progmem_const uint8_t *Blob;
+	uint32_t BlobSize;
+} Esd_DlCache;
+
+#define ESD_DLCACHE_INIT       \
+	{                          \
+		GA_HANDLE_INIT, 0, 0, 0 \
+	}
+
+// Replays the cached display list and returns false, or starts recording and returns true when the fragment must be rendered
+ESD_FUNCTION(Esd_DlCache_Begin, Type = bool, Attributes = ESD_CORE_EXPORT, Category = EveRenderFunctions, Include = "Esd_Core.h")
+ESD_PARAMETER(cache, Type = Esd_DlCache *)
+ESD_CORE_EXPORT bool Esd_DlCache_Begin(Esd_DlCache *cache);
+
+// Ends recording, call only when Esd_DlCache_Begin returned true
+ESD_FUNCTION(Esd_DlCache_End, Attributes = ESD_CORE_EXPORT, Category = EveRenderFunctions, Include = "Esd_Core.h")
+ESD_PARAMETER(cache, Type = Esd_DlCache *)
+ESD_CORE_EXPORT void Esd_DlCache_End(Esd_DlCache *cache);
+
+// Discards the recording, call when the content of the fragment changes
+ESD_FUNCTION(Esd_DlCache_Invalidate, Attributes = ESD_CORE_EXPORT, Category = EveRenderFunctions, Include = "Esd_Core.h")
+ESD_PARAMETER(cache, Type = Esd_DlCache *)
+ESD_CORE_EXPORT void Esd_DlCache_Invalidate(Esd_DlCache *cache);
+
+// Uses a precompiled display list for the fragment, or records it again when blob is NULL
+ESD_CORE_EXPORT void Esd_DlCache_Preload(Esd_DlCache *cache, eve_progmem_const uint8_t *blob, uint32_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* #ifndef ESD_DLCACHE__H */
+
+/* end of file */
@@ -19,6 +19,114 @@ Author: Jan Boon <jan.boon@kaetemi.be>
 extern ESD_CORE_EXPORT EVE_HalContext *Esd_Host;
 extern ESD_CORE_EXPORT Esd_GpuAlloc *Esd_GAlloc;
 
+/*
+Paged glyph file format (little-endian), for extended fonts with GlyphResource.Compressed set to ESD_RESOURCE_PAGED:
+
+0 uint32 signature; // ESD_FONT_PAGED_SIGNATURE
+4 uint32 pageCount; // One page per block of 128 characters
+8 struct { uint32 offset; uint32 size; uint32 rawSize; } pages[pageCount];
+
+Each page is the glyph data of one block of 128 characters as a separate deflate stream,
+padded to 4 bytes. The gptr entries of the font block point at the pages directly,
+with start_of_graphic_data set to 0, so each page is a separate garbage collected allocation.
+*/
+
+#define ESD_FONT_PAGED_SIGNATURE 0x594C4750 // "PGLY"
+#define ESD_FONT_PAGED_HEADER 8
+#define ESD_FONT_PAGED_ENTRY 12
+
+typedef struct
+{
+	Esd_FontInfo *Font;
+	uint32_t Page;
+	Esd_GpuHandle GpuHandle;
+} Esd_FontPage;
+
+static Esd_FontPage s_FontPages[ESD_FONT_PAGE_CACHE];
+static uint32_t s_FontPagesNext = 0;
+
+static bool Esd_Font_IsPaged(Esd_FontInfo *fontInfo)
+{
+	return fontInfo->Type == ESD_FONT_EXTENDED
+	    && fontInfo->GlyphResource.Type == ESD_RESOURCE_FILE
+	    && fontInfo->GlyphResource.Compressed == ESD_RESOURCE_PAGED;
+}
+
+// Load the font block of a paged font, glyph pages are loaded by Esd_Font_LoadText
+static uint32_t Esd_LoadPagedFont(Esd_FontInfo *fontInfo)
+{
+	uint32_t fontAddr;
+	uint32_t count;
+	uint32_t i;
+
+	fontAddr = Esd_GpuAlloc_Get(Esd_GAlloc, fontInfo->FontResource.GpuHandle);
+	if (fontAddr != GA_INVALID)
+		return fontAddr;
+
+	fontAddr = Esd_LoadResource(&fontInfo->FontResource, NULL);
+	if (fontAddr == GA_INVALID)
+		return GA_INVALID;
+
+	// Fresh font block, none of the glyph pages are mapped
+	for (i = 0; i < ESD_FONT_PAGE_CACHE; ++i)
+	{
+		if (s_FontPages[i].Font == fontInfo)
+			s_FontPages[i].Font = NULL;
+	}
+	count = EVE_Hal_rd32(Esd_Host, fontAddr + 36);
+	for (i = 0; i < (count + 127) / 128; ++i)
+		EVE_Hal_wr32(Esd_Host, fontAddr + 40 + i * 4, 0);
+	EVE_Hal_wr32(Esd_Host, fontAddr + 32, 0);
+	fontInfo->FontHeight = EVE_Hal_rd32(Esd_Host, fontAddr + 28);
+	fontInfo->BitmapHandle = ESD_BITMAPHANDLE_INVALID;
+	if (!fontInfo->BaseLine)
+		fontInfo->BaseLine = fontInfo->FontHeight;
+	if (!fontInfo->CapsHeight)
+		fontInfo->CapsHeight = fontInfo->FontHeight;
+	fontInfo->GlyphAddress = 0;
+	esd_resourceinfo_printf("Loaded paged font block, %i characters\n", (int)count);
+	return fontAddr;
+}
+
+// Inflate one glyph page from the SD card and map it in the font block
+static bool Esd_LoadFontPage(Esd_FontInfo *fontInfo, uint32_t fontAddr, uint32_t page, Esd_GpuHandle *gpuHandle)
+{
+	EVE_HalContext *phost = Esd_Host;
+	EVE_Asset asset;
+	uint32_t header[3];
+	uint32_t addr;
+	bool loaded = false;
+
+	if (!EVE_Util_openAsset(phost, &asset, fontInfo->GlyphResource.File))
+		return false;
+
+	if (EVE_Util_readAsset(phost, &asset, 0, (uint8_t *)header, ESD_FONT_PAGED_HEADER) == ESD_FONT_PAGED_HEADER
+	    && header[0] == ESD_FONT_PAGED_SIGNATURE && page < header[1]
+	    && EVE_Util_readAsset(phost, &asset, ESD_FONT_PAGED_HEADER + page * ESD_FONT_PAGED_ENTRY, (uint8_t *)header, ESD_FONT_PAGED_ENTRY) == ESD_FONT_PAGED_ENTRY)
+	{
+		*gpuHandle = Esd_GpuAlloc_Alloc(Esd_GAlloc, header[2], GA_GC_FLAG);
+		addr = Esd_GpuAlloc_Get(Esd_GAlloc, *gpuHandle);
+		if (addr != GA_INVALID)
+		{
+			EVE_CoCmd_inflate(phost, addr);
+			loaded = EVE_Util_inflateAssetRegion(phost, &asset, header[0], header[1]);
+			if (loaded)
+			{
+				// Ordered behind the inflate, text already in the command buffer only uses mapped pages
+				EVE_CoCmd_memWrite32(phost, fontAddr + 40 + page * 4, addr);
+				esd_resourceinfo_printf("Loaded glyph page %i to %i\n", (int)page, (int)addr);
+			}
+			else
+			{
+				Esd_GpuAlloc_Free(Esd_GAlloc, *gpuHandle);
+			}
+		}
+	}
+
+	EVE_Util_closeAsset(phost, &asset);
+	return loaded;
+}
+
 ESD_CORE_EXPORT uint32_t Esd_LoadFont(Esd_FontInfo *fontInfo)
 {
 	uint32_t glyphAddr;
@@ -28,6 +136,11 @@ ESD_CORE_EXPORT uint32_t Esd_LoadFont(Esd_FontInfo *fontInfo)
 		return GA_INVALID;
 	}
 
+	if (Esd_Font_IsPaged(fontInfo))
+	{
+		return Esd_LoadPagedFont(fontInfo);
+	}
+
 	// Load glyphs
 	glyphAddr = Esd_LoadResource(&fontInfo->GlyphResource, NULL);
 	if (glyphAddr != GA_INVALID)
@@ -102,4 +215,254 @@ ESD_CORE_EXPORT void Esd_FontPersist(Esd_FontInfo *fontInfo)
 	Esd_LoadFont(fontInfo);
 }
 
+/*
+Advance widths for the first 128 characters of each font are read from RAM_G or ROM in one transfer
+and kept on the host. Extended fonts keep one more block of 128 characters, for the last block used above that.
+*/
+
+#define ESD_FONT_METRICS_BLOCK 128
+
+typedef struct
+{
+	Esd_FontInfo *Font;
+	uint32_t HighBlock; //< Block of characters in HighWidths, 0 when unused
+	uint8_t Widths[ESD_FONT_METRICS_BLOCK];
+	uint8_t HighWidths[ESD_FONT_METRICS_BLOCK];
+} Esd_FontMetrics;
+
+static Esd_FontMetrics s_FontMetrics[ESD_FONT_METRICS_CACHE];
+static uint32_t s_FontMetricsNext = 0;
+
+// Read the widths of one block of 128 characters, returns false if the font has no such block
+static bool Esd_Font_ReadWidths(Esd_FontInfo *fontInfo, uint32_t block, uint8_t *widths)
+{
+	EVE_HalContext *phost = Esd_GetHost();
+	uint32_t fontAddr;
+
+	switch (fontInfo->Type)
+	{
+	case ESD_FONT_ROM: {
+		Esd_RomFontInfo *romFont = (Esd_RomFontInfo *)(void *)fontInfo;
+		if (block)
+			return false;
+		fontAddr = EVE_Hal_rd32(phost, ROMFONT_TABLEADDRESS) + (EVE_GPU_FONT_TABLE_SIZE * (romFont->RomFont - 16));
+		EVE_Hal_rdMem(phost, widths, fontAddr, ESD_FONT_METRICS_BLOCK);
+		return true;
+	}
+	case ESD_FONT_LEGACY: {
+		if (block)
+			return false;
+		fontAddr = Esd_LoadFont(fontInfo);
+		if (fontAddr == GA_INVALID)
+			return false;
+		EVE_Hal_rdMem(phost, widths, fontAddr, ESD_FONT_METRICS_BLOCK);
+		return true;
+	}
+	case ESD_FONT_EXTENDED: {
+		uint32_t count;
+		uint32_t wptr;
+		fontAddr = Esd_LoadFont(fontInfo);
+		if (fontAddr == GA_INVALID)
+			return false;
+		count = EVE_Hal_rd32(phost, fontAddr + 36);
+		if (block * ESD_FONT_METRICS_BLOCK >= count)
+			return false;
+		// Width pointers follow the glyph pointers, one of each per block, relative to the font block
+		wptr = EVE_Hal_rd32(phost, fontAddr + 40 + (((count + ESD_FONT_METRICS_BLOCK - 1) / ESD_FONT_METRICS_BLOCK) + block) * 4);
+		EVE_Hal_rdMem(phost, widths, fontAddr + wptr, ESD_FONT_METRICS_BLOCK);
+		return true;
+	}
+	}
+	return false;
+}
+
+static Esd_FontMetrics *Esd_Font_GetMetrics(Esd_FontInfo *fontInfo)
+{
+	Esd_FontMetrics *metrics;
+	uint32_t i;
+
+	for (i = 0; i < ESD_FONT_METRICS_CACHE; ++i)
+	{
+		if (s_FontMetrics[i].Font == fontInfo)
+			return &s_FontMetrics[i];
+	}
+
+	// Replace the oldest entry
+	metrics = &s_FontMetrics[s_FontMetricsNext];
+	if (!Esd_Font_ReadWidths(fontInfo, 0, metrics->Widths))
+		return NULL;
+	s_FontMetricsNext = (s_FontMetricsNext + 1) % ESD_FONT_METRICS_CACHE;
+	metrics->Font = fontInfo;
+	metrics->HighBlock = 0;
+	return metrics;
+}
+
+ESD_CORE_EXPORT void Esd_Font_ResetMetrics(Esd_FontInfo *fontInfo)
+{
+	uint32_t i;
+	for (i = 0; i < ESD_FONT_METRICS_CACHE; ++i)
+	{
+		if (s_FontMetrics[i].Font == fontInfo)
+			s_FontMetrics[i].Font = NULL;
+	}
+}
+
+static uint16_t Esd_Font_MetricsWidth(Esd_FontInfo *fontInfo, Esd_FontMetrics *metrics, uint32_t c)
+{
+	uint32_t block;
+
+	if (fontInfo->Type == ESD_FONT_LEGACY)
+	{
+		// Legacy fonts only have glyphs from FirstChar up to 127
+		if (c < fontInfo->FirstChar)
+			return 0;
+	}
+
+	block = c / ESD_FONT_METRICS_BLOCK;
+	if (!block)
+		return metrics->Widths[c];
+	if (metrics->HighBlock != block)
+	{
+		if (!Esd_Font_ReadWidths(fontInfo, block, metrics->HighWidths))
+			return 0;
+		metrics->HighBlock = block;
+	}
+	return metrics->HighWidths[c % ESD_FONT_METRICS_BLOCK];
+}
+
+// Decode one UTF-8 character, advances the text pointer
+static uint32_t Esd_Font_NextChar(const char **text)
+{
+	const uint8_t *s = (const uint8_t *)*text;
+	uint32_t c = *s++;
+	int extra = 0;
+
+	if (c >= 0xF0)
+	{
+		c &= 0x07;
+		extra = 3;
+	}
+	else if (c >= 0xE0)
+	{
+		c &= 0x0F;
+		extra = 2;
+	}
+	else if (c >= 0xC0)
+	{
+		c &= 0x1F;
+		extra = 1;
+	}
+	while (extra-- && (*s & 0xC0) == 0x80)
+		c = (c << 6) | (*s++ & 0x3F);
+	*text = (const char *)s;
+	return c;
+}
+
+ESD_CORE_EXPORT uint16_t Esd_Font_CharWidth(Esd_FontInfo *fontInfo, uint32_t c)
+{
+	Esd_FontMetrics *metrics;
+
+	if (!fontInfo)
+		return 0;
+	metrics = Esd_Font_GetMetrics(fontInfo);
+	if (!metrics)
+		return 0;
+	return Esd_Font_MetricsWidth(fontInfo, metrics, c);
+}
+
+ESD_CORE_EXPORT bool Esd_Font_LoadText(Esd_FontInfo *fontInfo, const char *text)
+{
+	uint32_t fontAddr;
+	uint32_t lastPage = ~0;
+	bool loaded = true;
+
+	if (!fontInfo || !text || !Esd_Font_IsPaged(fontInfo))
+		return true;
+
+	fontAddr = Esd_LoadPagedFont(fontInfo);
+	if (fontAddr == GA_INVALID)
+		return false;
+
+	while (*text)
+	{
+		uint32_t page = Esd_Font_NextChar(&text) / 128;
+		Esd_FontPage *entry = NULL;
+		uint32_t i;
+
+		if (page == lastPage)
+			continue;
+		lastPage = page;
+
+		for (i = 0; i < ESD_FONT_PAGE_CACHE; ++i)
+		{
+			if (s_FontPages[i].Font == fontInfo && s_FontPages[i].Page == page)
+			{
+				entry = &s_FontPages[i];
+				break;
+			}
+		}
+
+		// Get touches the page, so it survives garbage collection while on screen
+		if (entry && Esd_GpuAlloc_Get(Esd_GAlloc, entry->GpuHandle) != GA_INVALID)
+			continue;
+
+		if (!entry)
+		{
+			// Replace the oldest entry, its page is left to the garbage collector
+			entry = &s_FontPages[s_FontPagesNext];
+			s_FontPagesNext = (s_FontPagesNext + 1) % ESD_FONT_PAGE_CACHE;
+			entry->Font = NULL;
+		}
+		if (Esd_LoadFontPage(fontInfo, fontAddr, page, &entry->GpuHandle))
+		{
+			entry->Font = fontInfo;
+			entry->Page = page;
+		}
+		else
+		{
+			entry->Font = NULL;
+			loaded = false;
+		}
+	}
+
+	return loaded;
+}
+
+ESD_CORE_EXPORT uint32_t Esd_Font_MeasureText(Esd_FontInfo *fontInfo, const char *text)
+{
+	Esd_FontMetrics *metrics;
+	uint32_t width = 0;
+
+	if (!fontInfo || !text)
+		return 0;
+	metrics = Esd_Font_GetMetrics(fontInfo);
+	if (!metrics)
+		return 0;
+	while (*text)
+		width += Esd_Font_MetricsWidth(fontInfo, metrics, Esd_Font_NextChar(&text));
+	return width;
+}
+
+ESD_CORE_EXPORT uint32_t Esd_Font_FitText(Esd_FontInfo *fontInfo, const char *text, uint32_t width)
+{
+	Esd_FontMetrics *metrics;
+	const char *begin = text;
+	uint32_t used = 0;
+
+	if (!fontInfo || !text)
+		return 0;
+	metrics = Esd_Font_GetMetrics(fontInfo);
+	if (!metrics)
+		return 0;
+	while (*text)
+	{
+		const char *next = text;
+		used += Esd_Font_MetricsWidth(fontInfo, metrics, Esd_Font_NextChar(&next));
+		if (used > width)
+			break;
+		text = next;
+	}
+	return (uint32_t)(text - begin);
+}
+
 /* end of file */
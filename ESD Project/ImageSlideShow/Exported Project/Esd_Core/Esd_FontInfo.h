@@ -138,6 +138,46 @@ static inline void Esd_FontInfo_LoadFlashAddress(Esd_FontInfo *fontInfo)
 	}
 }
 
+// Number of fonts whose advance widths are kept on the host for text measurement
+#ifndef ESD_FONT_METRICS_CACHE
+#define ESD_FONT_METRICS_CACHE 8
+#endif
+
+/// Advance width in pixels of a character, read from the font metric block once and cached on the host
+ESD_FUNCTION(Esd_Font_CharWidth, Type = uint16_t, Attributes = ESD_CORE_EXPORT, DisplayName = "Get Character Width", Category = EsdUtilities)
+ESD_PARAMETER(fontInfo, Type = Esd_FontInfo *)
+ESD_PARAMETER(c, Type = uint32_t)
+ESD_CORE_EXPORT uint16_t Esd_Font_CharWidth(Esd_FontInfo *fontInfo, uint32_t c);
+
+/// Width in pixels of a UTF-8 string as CMD_TEXT draws it on one line
+ESD_FUNCTION(Esd_Font_MeasureText, Type = uint32_t, Attributes = ESD_CORE_EXPORT, DisplayName = "Measure Text", Category = EsdUtilities)
+ESD_PARAMETER(fontInfo, Type = Esd_FontInfo *)
+ESD_PARAMETER(text, Type = const char *)
+ESD_CORE_EXPORT uint32_t Esd_Font_MeasureText(Esd_FontInfo *fontInfo, const char *text);
+
+/// Number of bytes of a UTF-8 string that fit within a width in pixels, for wrapping and ellipsis
+ESD_FUNCTION(Esd_Font_FitText, Type = uint32_t, Attributes = ESD_CORE_EXPORT, DisplayName = "Fit Text", Category = EsdUtilities)
+ESD_PARAMETER(fontInfo, Type = Esd_FontInfo *)
+ESD_PARAMETER(text, Type = const char *)
+ESD_PARAMETER(width, Type = uint32_t)
+ESD_CORE_EXPORT uint32_t Esd_Font_FitText(Esd_FontInfo *fontInfo, const char *text, uint32_t width);
+
+// Number of glyph pages of paged fonts that are tracked as resident, pages beyond this are reloaded when used
+#ifndef ESD_FONT_PAGE_CACHE
+#define ESD_FONT_PAGE_CACHE 32
+#endif
+
+/// Make the glyph pages used by a UTF-8 string resident, for fonts with ESD_RESOURCE_PAGED glyphs.
+/// Call during render before drawing the text, the pages stay resident while they are drawn.
+/// Returns false if a page could not be loaded. Does nothing for other fonts
+ESD_FUNCTION(Esd_Font_LoadText, Type = bool, Attributes = ESD_CORE_EXPORT, DisplayName = "Load Font Text", Category = EsdUtilities)
+ESD_PARAMETER(fontInfo, Type = Esd_FontInfo *)
+ESD_PARAMETER(text, Type = const char *)
+ESD_CORE_EXPORT bool Esd_Font_LoadText(Esd_FontInfo *fontInfo, const char *text);
+
+/// Drop the cached widths of a font, call when a font resource is replaced by a different font
+ESD_CORE_EXPORT void Esd_Font_ResetMetrics(Esd_FontInfo *fontInfo);
+
 #ifdef __cplusplus
 }
 #endif
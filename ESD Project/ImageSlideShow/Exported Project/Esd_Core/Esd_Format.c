@@ -0,0 +1,189 @@
+
+#include "Esd_Format.h"
+
+#include <stdio.h>
+
+#define ESD_FORMAT_DIGITS 32
+
+static const char s_DecimalPairs[200] = {
+	'0', '0', '0', '1', '0', '2', '0', '3', '0', '4', '0', '5', '0', '6', '0', '7', '0', '8', '0', '9',
+	'1', '0', '1', '1', '1', '2', '1', '3', '1', '4', '1', '5', '1', '6', '1', '7', '1', '8', '1', '9',
+	'2', '0', '2', '1', '2', '2', '2', '3', '2', '4', '2', '5', '2', '6', '2', '7', '2', '8', '2', '9',
+	'3', '0', '3', '1', '3', '2', '3', '3', '3', '4', '3', '5', '3', '6', '3', '7', '3', '8', '3', '9',
+	'4', '0', '4', '1', '4', '2', '4', '3', '4', '4', '4', '5', '4', '6', '4', '7', '4', '8', '4', '9',
+	'5', '0', '5', '1', '5', '2', '5', '3', '5', '4', '5', '5', '5', '6', '5', '7', '5', '8', '5', '9',
+	'6', '0', '6', '1', '6', '2', '6', '3', '6', '4', '6', '5', '6', '6', '6', '7', '6', '8', '6', '9',
+	'7', '0', '7', '1', '7', '2', '7', '3', '7', '4', '7', '5', '7', '6', '7', '7', '7', '8', '7', '9',
+	'8', '0', '8', '1', '8', '2', '8', '3', '8', '4', '8', '5', '8', '6', '8', '7', '8', '8', '8', '9',
+	'9', '0', '9', '1', '9', '2', '9', '3', '9', '4', '9', '5', '9', '6', '9', '7', '9', '8', '9', '9'
+};
+
+static const char s_HexDigits[16] = {
+	'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F'
+};
+
+static const uint32_t s_Pow10[10] = {
+	1UL, 10UL, 100UL, 1000UL, 10000UL, 100000UL, 1000000UL, 10000000UL, 100000000UL, 1000000000UL
+};
+
+// Write the decimal digits of value, at least count of them, backwards from end. Returns the first digit
+static char *Esd_Format_Decimal(char *end, uint32_t value, int count)
+{
+	char *start = end - count;
+	while (value >= 100)
+	{
+		uint32_t pair = (value % 100) << 1;
+		value /= 100;
+		end -= 2;
+		end[0] = s_DecimalPairs[pair];
+		end[1] = s_DecimalPairs[pair + 1];
+	}
+	if (value >= 10)
+	{
+		end -= 2;
+		end[0] = s_DecimalPairs[value << 1];
+		end[1] = s_DecimalPairs[(value << 1) + 1];
+	}
+	else
+	{
+		*--end = (char)('0' + value);
+	}
+	while (end > start)
+		*--end = '0';
+	return end;
+}
+
+// Round to nearest, ties to even as printf does
+static uint32_t Esd_Format_Round(double value)
+{
+	uint32_t r = (uint32_t)value;
+	double remainder = value - (double)r;
+	if (remainder > 0.5 || (remainder == 0.5 && (r & 1)))
+		++r;
+	return r;
+}
+
+// Assemble prefix, padding and digits into the buffer
+static uint32_t Esd_Format_Write(char *buffer, uint32_t size, const char *prefix, uint32_t prefixLen, const char *digits, uint32_t digitsLen, int16_t width, uint16_t flags)
+{
+	uint32_t len = 0;
+	uint32_t pad = 0;
+	uint32_t i;
+
+	if (!size)
+		return 0;
+
+	// Hexadecimal prefix is not part of the width
+	if (width > 0 && (uint32_t)width > digitsLen + ((flags & ESD_FORMAT_HEX) ? 0 : prefixLen))
+		pad = width - digitsLen - ((flags & ESD_FORMAT_HEX) ? 0 : prefixLen);
+
+#define ESD_FORMAT_PUT(c)         \
+	do                            \
+	{                             \
+		if (len + 1 < size)       \
+			buffer[len++] = (c);  \
+	} while (0)
+
+	// Spaces go before a sign, but after the literal hexadecimal prefix
+	if (!(flags & (ESD_FORMAT_ZERO | ESD_FORMAT_HEX)))
+		for (i = 0; i < pad; ++i)
+			ESD_FORMAT_PUT(' ');
+	for (i = 0; i < prefixLen; ++i)
+		ESD_FORMAT_PUT(prefix[i]);
+	if (flags & (ESD_FORMAT_ZERO | ESD_FORMAT_HEX))
+		for (i = 0; i < pad; ++i)
+			ESD_FORMAT_PUT((flags & ESD_FORMAT_ZERO) ? '0' : ' ');
+	for (i = 0; i < digitsLen; ++i)
+		ESD_FORMAT_PUT(digits[i]);
+
+#undef ESD_FORMAT_PUT
+
+	buffer[len] = '\0';
+	return len;
+}
+
+ESD_CORE_EXPORT uint32_t Esd_FormatInt(char *buffer, uint32_t size, int32_t value, int16_t width, uint16_t flags)
+{
+	char digits[ESD_FORMAT_DIGITS];
+	char *end = &digits[ESD_FORMAT_DIGITS];
+	char *start;
+	const char *prefix = "";
+	uint32_t prefixLen = 0;
+
+	if (flags & ESD_FORMAT_HEX)
+	{
+		uint32_t v = (uint32_t)value;
+		start = end;
+		do
+		{
+			*--start = s_HexDigits[v & 0xF];
+			v >>= 4;
+		} while (v);
+		prefix = "0x";
+		prefixLen = 2;
+	}
+	else
+	{
+		uint32_t v = value < 0 ? (0UL - (uint32_t)value) : (uint32_t)value;
+		start = Esd_Format_Decimal(end, v, 1);
+		if (value < 0)
+			prefix = "-";
+		else if (flags & ESD_FORMAT_SPACE)
+			prefix = " ";
+		prefixLen = *prefix ? 1 : 0;
+	}
+
+	return Esd_Format_Write(buffer, size, prefix, prefixLen, start, (uint32_t)(end - start), width, flags);
+}
+
+ESD_CORE_EXPORT uint32_t Esd_FormatFixed(char *buffer, uint32_t size, float value, int16_t width, int16_t decimals, uint16_t flags)
+{
+	char digits[ESD_FORMAT_DIGITS];
+	char *end = &digits[ESD_FORMAT_DIGITS];
+	char *start;
+	const char *prefix = "";
+	bool negative = value < 0.0f;
+	float a = negative ? -value : value;
+	uint32_t integer;
+
+	if (decimals < 0)
+		decimals = 0;
+
+	// Also catches infinity and NaN
+	if (!(a < 4294967296.0f) || decimals > 9 || (flags & ESD_FORMAT_HEX))
+	{
+		int len = snprintf(buffer, size, (flags & ESD_FORMAT_ZERO) ? "%0*.*f" : ((flags & ESD_FORMAT_SPACE) ? "% *.*f" : "%*.*f"), (int)width, (int)decimals, value);
+		return len < 0 ? 0 : ((uint32_t)len < size ? (uint32_t)len : (size ? size - 1 : 0));
+	}
+
+	// Floats below 2^32 are at most 2^32 - 256, rounding up never overflows
+	start = end;
+	if (decimals)
+	{
+		// The fraction of a float is exact, and so is its product with a power of ten up to 10^9 as a double
+		uint32_t fraction;
+		integer = (uint32_t)a;
+		fraction = Esd_Format_Round((double)(a - (float)integer) * (double)s_Pow10[decimals]);
+		if (fraction >= s_Pow10[decimals])
+		{
+			fraction -= s_Pow10[decimals];
+			++integer;
+		}
+		start = Esd_Format_Decimal(end, fraction, decimals);
+		*--start = '.';
+	}
+	else
+	{
+		integer = Esd_Format_Round(a);
+	}
+	start = Esd_Format_Decimal(start, integer, 1);
+
+	if (negative)
+		prefix = "-";
+	else if (flags & ESD_FORMAT_SPACE)
+		prefix = " ";
+
+	return Esd_Format_Write(buffer, size, prefix, *prefix ? 1 : 0, start, (uint32_t)(end - start), width, flags & ~ESD_FORMAT_HEX);
+}
+
+/* end of file */
@@ -0,0 +1,44 @@
+
+#ifndef ESD_FORMAT__H
+#define ESD_FORMAT__H
+
+#include "Esd_Base.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+Number formatting for labels which are updated every frame.
+Digits are written two at a time from a table, without going through printf.
+The output matches the equivalent printf conversion, noted with each flag.
+*/
+
+// Uppercase hexadecimal of the value as unsigned, with a 0x prefix which is written before the padding ("0x%*X")
+#define ESD_FORMAT_HEX 1
+
+// Pad with zeros after the sign instead of with spaces before it ("%0*d")
+#define ESD_FORMAT_ZERO 2
+
+// Space in place of the sign of positive values, ignored for hexadecimal ("% *d")
+#define ESD_FORMAT_SPACE 4
+
+// Buffer size which fits any integer with a width up to 11
+#define ESD_FORMAT_INT_MAX 14
+
+// Format an integer into the buffer, padded up to width characters, not counting the hexadecimal prefix.
+// Output which does not fit in size is truncated. Returns the length excluding the terminator
+ESD_CORE_EXPORT uint32_t Esd_FormatInt(char *buffer, uint32_t size, int32_t value, int16_t width, uint16_t flags);
+
+// Format a fixed point number with the given number of decimals, rounded to nearest, padded up to width characters ("%*.*f").
+// Values which do not fit in 32 bits when scaled, or more than 9 decimals, are formatted by printf.
+// ESD_FORMAT_HEX is not supported. Returns the length excluding the terminator
+ESD_CORE_EXPORT uint32_t Esd_FormatFixed(char *buffer, uint32_t size, float value, int16_t width, int16_t decimals, uint16_t flags);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* #ifndef ESD_FORMAT__H */
+
+/* end of file */
@@ -0,0 +1,285 @@
+
+#include "Esd_Gesture.h"
+
+#if ESD_GESTURE
+
+#include "Esd_Context.h"
+
+// Samples kept for the release velocity, enough to cover ESD_GESTURE_VELOCITY_MS at ESD_GESTURE_SAMPLE_MS
+#define ESD_GESTURE_HISTORY 16
+
+typedef struct
+{
+	uint32_t Millis;
+	int16_t X;
+	int16_t Y;
+} Esd_GestureSample;
+
+static Esd_GestureListener *s_Listeners = NULL;
+
+static Esd_Gesture s_Queue[ESD_GESTURE_QUEUE_SIZE];
+static uint8_t s_QueueFirst = 0;
+static uint8_t s_QueueCount = 0;
+
+// Touch being recognized
+static bool s_Down = false;
+static bool s_Moved = false; // Left the slop, no longer a tap or long press
+static bool s_LongPressed = false;
+static bool s_Pinching = false;
+static uint8_t s_Tag;
+static uint32_t s_StartMillis;
+static int16_t s_StartX;
+static int16_t s_StartY;
+static int32_t s_PinchDistance; // Between the contacts when the pinch started
+static int32_t s_Scale; // Last delivered
+
+static Esd_GestureSample s_History[ESD_GESTURE_HISTORY];
+static uint8_t s_HistoryLast = 0;
+static uint8_t s_HistoryCount = 0;
+
+static uint32_t Esd_Gesture_Sqrt(uint32_t v)
+{
+	uint32_t res = 0;
+	uint32_t bit = 1UL << 30;
+	while (bit > v)
+		bit >>= 2;
+	while (bit)
+	{
+		if (v >= res + bit)
+		{
+			v -= res + bit;
+			res = (res >> 1) + bit;
+		}
+		else
+		{
+			res >>= 1;
+		}
+		bit >>= 2;
+	}
+	return res;
+}
+
+static int32_t Esd_Gesture_Distance(int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+{
+	int32_t dx = (int32_t)x1 - x0;
+	int32_t dy = (int32_t)y1 - y0;
+	return (int32_t)Esd_Gesture_Sqrt((uint32_t)(dx * dx + dy * dy));
+}
+
+static inline int32_t Esd_Gesture_Abs(int32_t v)
+{
+	return v < 0 ? -v : v;
+}
+
+static inline int16_t Esd_Gesture_Clamp(int32_t v)
+{
+	return (int16_t)(v < -32767 ? -32767 : (v > 32767 ? 32767 : v));
+}
+
+static void Esd_Gesture_Push(uint8_t type, uint32_t millis, int32_t vx, int32_t vy)
+{
+	Esd_GestureSample *last = &s_History[s_HistoryLast];
+	Esd_Gesture *gesture;
+
+	if (s_QueueCount >= ESD_GESTURE_QUEUE_SIZE)
+	{
+		eve_printf_debug("Gesture queue full\n");
+		return;
+	}
+	gesture = &s_Queue[(s_QueueFirst + s_QueueCount) % ESD_GESTURE_QUEUE_SIZE];
+	++s_QueueCount;
+	gesture->Type = type;
+	gesture->Tag = s_Tag;
+	gesture->X = s_StartX;
+	gesture->Y = s_StartY;
+	gesture->DeltaX = last->X - s_StartX;
+	gesture->DeltaY = last->Y - s_StartY;
+	gesture->VelocityX = Esd_Gesture_Clamp(vx);
+	gesture->VelocityY = Esd_Gesture_Clamp(vy);
+	gesture->Scale = s_Scale;
+	gesture->StartMillis = s_StartMillis;
+	gesture->Millis = millis;
+	Esd_Invalidate();
+}
+
+static void Esd_Gesture_Record(uint32_t millis, int16_t x, int16_t y)
+{
+	Esd_GestureSample *sample;
+	s_HistoryLast = (s_HistoryLast + 1) % ESD_GESTURE_HISTORY;
+	if (s_HistoryCount < ESD_GESTURE_HISTORY)
+		++s_HistoryCount;
+	sample = &s_History[s_HistoryLast];
+	sample->Millis = millis;
+	sample->X = x;
+	sample->Y = y;
+}
+
+static void Esd_Gesture_Release(uint32_t millis)
+{
+	Esd_GestureSample *last = &s_History[s_HistoryLast];
+	Esd_GestureSample *first = last;
+	int32_t dx, dy, ms, vx, vy;
+	uint8_t i, type;
+
+	if (s_Pinching)
+	{
+		Esd_Gesture_Push(ESD_GESTURE_PINCH_END, millis, 0, 0);
+		return;
+	}
+	if (s_LongPressed)
+		return;
+	if (!s_Moved)
+	{
+		if ((int32_t)(millis - s_StartMillis) <= ESD_GESTURE_TAP_MS)
+			Esd_Gesture_Push(ESD_GESTURE_TAP, millis, 0, 0);
+		return;
+	}
+
+	// Oldest sample within the window, the release itself has no position
+	for (i = 1; i < s_HistoryCount; ++i)
+	{
+		Esd_GestureSample *sample = &s_History[(s_HistoryLast + ESD_GESTURE_HISTORY - i) % ESD_GESTURE_HISTORY];
+		if ((int32_t)(last->Millis - sample->Millis) > ESD_GESTURE_VELOCITY_MS)
+			break;
+		first = sample;
+	}
+	ms = (int32_t)(last->Millis - first->Millis);
+	if (ms <= 0)
+		return;
+	vx = ((int32_t)last->X - first->X) * 1000 / ms;
+	vy = ((int32_t)last->Y - first->Y) * 1000 / ms;
+
+	dx = (int32_t)last->X - s_StartX;
+	dy = (int32_t)last->Y - s_StartY;
+	if (Esd_Gesture_Abs(dx) >= Esd_Gesture_Abs(dy))
+	{
+		if (Esd_Gesture_Abs(dx) < ESD_GESTURE_SWIPE_PX || Esd_Gesture_Abs(vx) < ESD_GESTURE_SWIPE_SPEED || (dx < 0) != (vx < 0))
+			return;
+		type = dx < 0 ? ESD_GESTURE_SWIPE_LEFT : ESD_GESTURE_SWIPE_RIGHT;
+	}
+	else
+	{
+		if (Esd_Gesture_Abs(dy) < ESD_GESTURE_SWIPE_PX || Esd_Gesture_Abs(vy) < ESD_GESTURE_SWIPE_SPEED || (dy < 0) != (vy < 0))
+			return;
+		type = dy < 0 ? ESD_GESTURE_SWIPE_UP : ESD_GESTURE_SWIPE_DOWN;
+	}
+	Esd_Gesture_Push(type, millis, vx, vy);
+}
+
+ESD_CORE_EXPORT void Esd_GestureListener__Initializer(Esd_GestureListener *listener)
+{
+	listener->Owner = NULL;
+	listener->Gesture = NULL;
+	listener->Rect.X = 0;
+	listener->Rect.Y = 0;
+	listener->Rect.Width = 0;
+	listener->Rect.Height = 0;
+	listener->Next = NULL;
+	listener->Added = false;
+}
+
+ESD_CORE_EXPORT void Esd_Gesture_Add(Esd_GestureListener *listener)
+{
+	if (listener->Added)
+		return;
+	listener->Next = s_Listeners;
+	s_Listeners = listener;
+	listener->Added = true;
+}
+
+ESD_CORE_EXPORT void Esd_Gesture_Remove(Esd_GestureListener *listener)
+{
+	Esd_GestureListener **link = &s_Listeners;
+	if (!listener->Added)
+		return;
+	while (*link && *link != listener)
+		link = &(*link)->Next;
+	if (*link)
+		*link = listener->Next;
+	listener->Added = false;
+}
+
+ESD_CORE_EXPORT void Esd_Gesture_Sample(uint32_t millis, uint8_t tag, int count, int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+{
+	if (!s_Down)
+	{
+		if (!count)
+			return;
+		s_Down = true;
+		s_Moved = false;
+		s_LongPressed = false;
+		s_Pinching = false;
+		s_Tag = tag;
+		s_StartMillis = millis;
+		s_StartX = x0;
+		s_StartY = y0;
+		s_Scale = 65536;
+		s_HistoryCount = 0;
+	}
+	else if (!count)
+	{
+		s_Down = false;
+		Esd_Gesture_Release(millis);
+		return;
+	}
+	else if ((int32_t)(millis - s_History[s_HistoryLast].Millis) < 0)
+	{
+		// Read before the previous sample, such as a frame read racing a poll
+		return;
+	}
+
+	if (count >= 2)
+	{
+		int32_t distance = Esd_Gesture_Distance(x0, y0, x1, y1);
+		if (!s_Pinching)
+		{
+			s_Pinching = true;
+			s_PinchDistance = distance ? distance : 1;
+		}
+		else
+		{
+			int32_t scale = (int32_t)(((int64_t)distance << 16) / s_PinchDistance);
+			if (Esd_Gesture_Abs(scale - s_Scale) >= ESD_GESTURE_PINCH_STEP)
+			{
+				s_Scale = scale;
+				Esd_Gesture_Push(ESD_GESTURE_PINCH, millis, 0, 0);
+			}
+		}
+	}
+
+	Esd_Gesture_Record(millis, x0, y0);
+	if (s_Pinching)
+		return;
+	if (!s_Moved && (Esd_Gesture_Abs((int32_t)x0 - s_StartX) > ESD_GESTURE_SLOP_PX || Esd_Gesture_Abs((int32_t)y0 - s_StartY) > ESD_GESTURE_SLOP_PX))
+		s_Moved = true;
+	if (!s_Moved && !s_LongPressed && (int32_t)(millis - s_StartMillis) >= ESD_GESTURE_LONGPRESS_MS)
+	{
+		s_LongPressed = true;
+		Esd_Gesture_Push(ESD_GESTURE_LONGPRESS, millis, 0, 0);
+	}
+}
+
+ESD_CORE_EXPORT void Esd_Gesture_Dispatch()
+{
+	while (s_QueueCount)
+	{
+		Esd_Gesture gesture = s_Queue[s_QueueFirst];
+		Esd_GestureListener *listener = s_Listeners;
+		s_QueueFirst = (s_QueueFirst + 1) % ESD_GESTURE_QUEUE_SIZE;
+		--s_QueueCount;
+		while (listener)
+		{
+			// The callback may remove its listener
+			Esd_GestureListener *next = listener->Next;
+			Esd_Rect16 rect = listener->Rect;
+			if (listener->Gesture && (!rect.Width || !rect.Height
+			        || (gesture.X >= rect.X && gesture.Y >= rect.Y && gesture.X < rect.X + rect.Width && gesture.Y < rect.Y + rect.Height)))
+				listener->Gesture(listener->Owner, &gesture);
+			listener = next;
+		}
+	}
+}
+
+#endif /* #if ESD_GESTURE */
+
+/* end of file */
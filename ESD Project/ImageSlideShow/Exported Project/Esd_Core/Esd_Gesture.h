@@ -0,0 +1,144 @@
+
+#ifndef ESD_GESTURE__H
+#define ESD_GESTURE__H
+
+#include "Esd_Base.h"
+#include "Esd_Math.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+Gesture recognition.
+With ESD_GESTURE, Esd_TouchTag feeds every touch sample it takes into the recognizer with the time the
+sample was taken at: the touch latched from INT_N with the time of the interrupt, the registers read in
+every frame, and while touching, the registers read between frames by Esd_TouchTag_Poll at most every
+ESD_GESTURE_SAMPLE_MS. Gestures therefore carry the time the touch actually started, and the speed of a
+swipe is measured from the samples rather than from the frame rate.
+
+Recognized gestures are queued, and delivered to the listeners from Esd_TouchTag_Update, one touch:
+	Tap, released within ESD_GESTURE_TAP_MS without moving more than ESD_GESTURE_SLOP_PX,
+	Long press, held for ESD_GESTURE_LONGPRESS_MS without moving, delivered while still held,
+	Swipe, released after moving ESD_GESTURE_SWIPE_PX along the dominant axis, at ESD_GESTURE_SWIPE_SPEED pixels per second
+	or faster over the last ESD_GESTURE_VELOCITY_MS,
+and with a second contact in extended mode, see Esd_TouchTag_SetMultiTouch:
+	Pinch, whenever the distance between the first two contacts changes by a step, with the scale since the second contact started,
+	Pinch end, once all contacts are released. A touch which became a pinch is not recognized as anything else.
+A listener receives the gestures which started inside its global rect, or all of them when the rect is empty.
+*/
+
+#ifndef ESD_GESTURE
+#define ESD_GESTURE 0
+#endif
+
+#ifndef ESD_GESTURE_TAP_MS
+#define ESD_GESTURE_TAP_MS 300
+#endif
+
+#ifndef ESD_GESTURE_LONGPRESS_MS
+#define ESD_GESTURE_LONGPRESS_MS 600
+#endif
+
+// Movement up to which a touch still counts as being in place
+#ifndef ESD_GESTURE_SLOP_PX
+#define ESD_GESTURE_SLOP_PX 12
+#endif
+
+#ifndef ESD_GESTURE_SWIPE_PX
+#define ESD_GESTURE_SWIPE_PX 40
+#endif
+
+// Pixels per second
+#ifndef ESD_GESTURE_SWIPE_SPEED
+#define ESD_GESTURE_SWIPE_SPEED 300
+#endif
+
+// Window of samples the release velocity is measured over
+#ifndef ESD_GESTURE_VELOCITY_MS
+#define ESD_GESTURE_VELOCITY_MS 100
+#endif
+
+// Interval of the samples read between frames while touching
+#ifndef ESD_GESTURE_SAMPLE_MS
+#define ESD_GESTURE_SAMPLE_MS 8
+#endif
+
+// Scale change in 16.16 fixed point between two pinch gestures
+#ifndef ESD_GESTURE_PINCH_STEP
+#define ESD_GESTURE_PINCH_STEP (65536 / 64)
+#endif
+
+// Gestures recognized between two deliveries
+#ifndef ESD_GESTURE_QUEUE_SIZE
+#define ESD_GESTURE_QUEUE_SIZE 8
+#endif
+
+#define ESD_GESTURE_TAP 1
+#define ESD_GESTURE_LONGPRESS 2
+#define ESD_GESTURE_SWIPE_LEFT 3
+#define ESD_GESTURE_SWIPE_RIGHT 4
+#define ESD_GESTURE_SWIPE_UP 5
+#define ESD_GESTURE_SWIPE_DOWN 6
+#define ESD_GESTURE_PINCH 7
+#define ESD_GESTURE_PINCH_END 8
+
+typedef struct
+{
+	uint8_t Type;
+	uint8_t Tag; // Tag under the touch when it started
+	int16_t X; // Where the touch started
+	int16_t Y;
+	int16_t DeltaX; // Movement of the first contact since the start
+	int16_t DeltaY;
+	int16_t VelocityX; // Pixels per second at release, swipe only
+	int16_t VelocityY;
+	int32_t Scale; // 16.16 fixed point, pinch only
+	uint32_t StartMillis; // EVE_millis time the touch started at
+	uint32_t Millis; // EVE_millis time of the sample the gesture was recognized at
+
+} Esd_Gesture;
+
+typedef struct Esd_GestureListener
+{
+	// Callback
+	void *Owner;
+
+	// Called for each gesture which started inside the rect
+	void (*Gesture)(void *context, const Esd_Gesture *gesture);
+
+	Esd_Rect16 Rect; // Global rect, all gestures when empty
+	struct Esd_GestureListener *Next;
+	bool Added;
+
+} Esd_GestureListener;
+
+#if ESD_GESTURE
+
+ESD_CORE_EXPORT void Esd_GestureListener__Initializer(Esd_GestureListener *listener);
+
+// Register the listener
+ESD_CORE_EXPORT void Esd_Gesture_Add(Esd_GestureListener *listener);
+
+// Unregister the listener, may be called from its callback
+ESD_CORE_EXPORT void Esd_Gesture_Remove(Esd_GestureListener *listener);
+
+// Feed a touch sample, count is the number of contacts touching, of which the first two are passed. Called by Esd_TouchTag
+ESD_CORE_EXPORT void Esd_Gesture_Sample(uint32_t millis, uint8_t tag, int count, int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+
+// Deliver the queued gestures, called from Esd_TouchTag_Update
+ESD_CORE_EXPORT void Esd_Gesture_Dispatch();
+
+#else
+
+#define Esd_Gesture_Dispatch() eve_noop()
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* #ifndef ESD_GESTURE__H */
+
+/* end of file */
@@ -15,13 +15,80 @@ Allocation mechanism for RAM_G.
 // TODO: #define GA_ENABLE_DEFRAG_AGGRESSIVE 1
 // TODO: #endif
 
-#if GA_ENABLE_DEFRAG_SAFE
 #include "Esd_Context.h"
-#endif
+#include "Esd_Utility.h"
+
+// Size class of a free space entry, the index of the highest bit set in the length
+static uint32_t Esd_GpuAlloc_SizeClass(uint32_t length)
+{
+	uint32_t c = 0;
+	while (length >>= 1)
+		++c;
+	return c;
+}
+
+// Add a free space entry to the free list of its size class
+static void Esd_GpuAlloc_LinkFree(Esd_GpuAlloc *ga, uint32_t idx)
+{
+	Esd_GpuAllocEntry *entry = &ga->AllocEntries[idx];
+	uint32_t c = Esd_GpuAlloc_SizeClass(entry->Length);
+	uint32_t head = ga->FreeLists[c];
+
+	entry->FreePrev = MAX_NUM_ALLOCATIONS;
+	entry->FreeNext = head;
+	if (head != MAX_NUM_ALLOCATIONS)
+		ga->AllocEntries[head].FreePrev = idx;
+	ga->FreeLists[c] = idx;
+	ga->FreeClasses |= (1UL << c);
+}
+
+// Remove a free space entry from its free list, must be called before the length is modified
+static void Esd_GpuAlloc_UnlinkFree(Esd_GpuAlloc *ga, uint32_t idx)
+{
+	Esd_GpuAllocEntry *entry = &ga->AllocEntries[idx];
+
+	if (entry->FreePrev != MAX_NUM_ALLOCATIONS)
+	{
+		ga->AllocEntries[entry->FreePrev].FreeNext = entry->FreeNext;
+	}
+	else
+	{
+		uint32_t c = Esd_GpuAlloc_SizeClass(entry->Length);
+		ga->FreeLists[c] = entry->FreeNext;
+		if (entry->FreeNext == MAX_NUM_ALLOCATIONS)
+			ga->FreeClasses &= ~(1UL << c);
+	}
+	if (entry->FreeNext != MAX_NUM_ALLOCATIONS)
+		ga->AllocEntries[entry->FreeNext].FreePrev = entry->FreePrev;
+}
+
+// Remove an entry from the allocation map
+static void Esd_GpuAlloc_DeleteEntry(Esd_GpuAlloc *ga, uint32_t idx)
+{
+	Esd_GpuAllocEntry *entry = &ga->AllocEntries[idx];
+
+	if (entry->Prev != MAX_NUM_ALLOCATIONS)
+		ga->AllocEntries[entry->Prev].Next = entry->Next;
+	else
+		ga->FirstEntry = entry->Next;
+	if (entry->Next != MAX_NUM_ALLOCATIONS)
+		ga->AllocEntries[entry->Next].Prev = entry->Prev;
+
+	entry->Address = ga->RamGSize;
+	entry->Length = 0;
+	entry->Id = MAX_NUM_ALLOCATIONS;
+	entry->Flags = 0;
+	entry->Prev = MAX_NUM_ALLOCATIONS;
+	entry->Next = MAX_NUM_ALLOCATIONS;
+	entry->FreePrev = MAX_NUM_ALLOCATIONS;
+	entry->FreeNext = ga->UnusedEntry;
+	ga->UnusedEntry = idx;
+	--ga->NbAllocEntries;
+}
 
 ESD_CORE_EXPORT void Esd_GpuAlloc_Reset(Esd_GpuAlloc *ga)
 {
-	int id, idx;
+	int id, idx, c;
 
 
 	for (id = 0; id < MAX_NUM_ALLOCATIONS; ++id)
@@ -34,140 +101,403 @@ ESD_CORE_EXPORT void Esd_GpuAlloc_Reset(Esd_GpuAlloc *ga)
 			ga->AllocRefs[id].Seq = 1;
 	}
 
+	// Stack the Ids so that the lowest Id is used first
+	ga->NbFreeIds = 0;
+	for (id = MAX_NUM_ALLOCATIONS - 1; id >= 0; --id)
+		ga->FreeIds[ga->NbFreeIds++] = id;
+
 	for (idx = 0; idx < MAX_NUM_ALLOCATIONS; ++idx)
 	{
 		ga->AllocEntries[idx].Address = ga->RamGSize;
 		ga->AllocEntries[idx].Length = 0;
 		ga->AllocEntries[idx].Id = MAX_NUM_ALLOCATIONS;
 		ga->AllocEntries[idx].Flags = 0;
+		ga->AllocEntries[idx].LastUse = 0;
+		ga->AllocEntries[idx].Crc = 0;
+		ga->AllocEntries[idx].Prev = MAX_NUM_ALLOCATIONS;
+		ga->AllocEntries[idx].Next = MAX_NUM_ALLOCATIONS;
+		ga->AllocEntries[idx].FreePrev = MAX_NUM_ALLOCATIONS;
+		ga->AllocEntries[idx].FreeNext = idx + 1; // Chain of unused entries
 	}
 
-	// First allocation entry is unallocated entry of entire RAM_G_SIZE
-	ga->AllocEntries[0].Address = 0;
-	ga->AllocEntries[0].Length = ga->RamGSize;
+	for (c = 0; c < GA_SIZE_CLASSES; ++c)
+		ga->FreeLists[c] = MAX_NUM_ALLOCATIONS;
+	ga->FreeClasses = 0;
+
+	// First allocation entry is unallocated entry of entire RAM_G_SIZE, after the static layout
+	eve_assert(ga->StaticSize <= ga->RamGSize);
+	ga->AllocEntries[0].Address = ga->StaticSize;
+	ga->AllocEntries[0].Length = ga->RamGSize - ga->StaticSize;
+	ga->FirstEntry = 0;
+	ga->UnusedEntry = 1;
 	ga->NbAllocEntries = 1;
+	ga->TotalUsed = 0;
+	ga->NbMoves = 0;
+	ga->ScrubHandle = GA_HANDLE_INVALID;
+	ga->ScrubAddress = 0;
+	ga->Arena = 0;
+#if EVE_CMD_FUTURES
+	ga->ScrubFuture = EVE_CMD_FUTURE_INVALID; // The result of a check in flight is left unclaimed
+#endif
+	Esd_GpuAlloc_LinkFree(ga, 0);
 }
 
-ESD_CORE_EXPORT void Esd_GpuAlloc_InsertFree(Esd_GpuAlloc *ga, uint32_t atidx, uint32_t size)
+// Insert a free space entry directly after the entry at idx, returns false when the allocation map is full
+ESD_CORE_EXPORT bool Esd_GpuAlloc_InsertFree(Esd_GpuAlloc *ga, uint32_t idx, uint32_t size)
 {
-	uint32_t idx;
+	Esd_GpuAllocEntry *entry = &ga->AllocEntries[idx];
+	uint32_t atidx = ga->UnusedEntry;
+	Esd_GpuAllocEntry *freeEntry;
 
 	eve_assert(ga->NbAllocEntries >= 1);
-	eve_assert(atidx < MAX_NUM_ALLOCATIONS);
+	eve_assert(idx < MAX_NUM_ALLOCATIONS);
+
+	if (atidx == MAX_NUM_ALLOCATIONS)
+		return false;
+
+	// Take an unused entry
+	freeEntry = &ga->AllocEntries[atidx];
+	ga->UnusedEntry = freeEntry->FreeNext;
+	++ga->NbAllocEntries;
+
+	// Link it after the entry in address order
+	freeEntry->Prev = idx;
+	freeEntry->Next = entry->Next;
+	if (entry->Next != MAX_NUM_ALLOCATIONS)
+		ga->AllocEntries[entry->Next].Prev = atidx;
+	entry->Next = atidx;
 
-	// First move entries one step forward
-	for (idx = (ga->NbAllocEntries - 1); idx >= atidx; --idx)
+	// Set the free space entry
+	freeEntry->Address = entry->Address + entry->Length;
+	freeEntry->Length = size;
+	freeEntry->Id = MAX_NUM_ALLOCATIONS;
+	freeEntry->Flags = 0;
+	Esd_GpuAlloc_LinkFree(ga, atidx);
+	return true;
+}
+
+// Assign an unused handle to the allocated entry at idx
+static Esd_GpuHandle Esd_GpuAlloc_AssignId(Esd_GpuAlloc *ga, uint32_t idx, uint16_t flags)
+{
+	Esd_GpuAllocEntry *entry = &ga->AllocEntries[idx];
+	Esd_GpuHandle ret;
+	int id;
+
+	// Find an unused handle
+	id = ga->FreeIds[--ga->NbFreeIds];
+	entry->Id = id;
+	flags |= GA_USED_FLAG;
+	entry->Flags = flags;
+	entry->LastUse = ga->Frame;
+	ga->AllocRefs[id].Idx = idx;
+	++ga->AllocRefs[id].Seq;
+
+	// Skip seq 0 to simplify invalid values
+	if (ga->AllocRefs[id].Seq == 0)
+		ga->AllocRefs[id].Seq = 1;
+
+	ga->TotalUsed += entry->Length;
+	++ga->NbAllocs;
+
+	// eve_printf_debug("Alloc id %i\n", id);
+
+	// Return the valid gpu ram handle
+	ret.Id = id;
+	ret.Seq = ga->AllocRefs[id].Seq;
+	return ret;
+}
+
+// Allocate a block at the start of the free space entry at idx
+static Esd_GpuHandle Esd_GpuAlloc_AllocAt(Esd_GpuAlloc *ga, uint32_t idx, uint32_t size, uint16_t flags)
+{
+	Esd_GpuAllocEntry *entry = &ga->AllocEntries[idx];
+	uint32_t remaining = entry->Length - size;
+	Esd_GpuHandle ret;
+
+	eve_assert(entry->Id == MAX_NUM_ALLOCATIONS && entry->Length >= size);
+
+	// Splitting off the remaining free space requires an additional entry
+	if (!ga->NbFreeIds || (remaining && ga->UnusedEntry == MAX_NUM_ALLOCATIONS))
 	{
-		int id = ga->AllocEntries[idx].Id;
-		if (id < MAX_NUM_ALLOCATIONS)
-		{
-			// Move reference idx one ahead
-			++ga->AllocRefs[id].Idx;
-		}
-		ga->AllocEntries[idx + 1] = ga->AllocEntries[idx];
+		ret.Id = MAX_NUM_ALLOCATIONS;
+		ret.Seq = 0;
+		return ret;
 	}
 
-	// Set the free space entry
-	ga->AllocEntries[atidx].Address = ga->AllocEntries[atidx - 1].Address + ga->AllocEntries[atidx - 1].Length;
-	ga->AllocEntries[atidx].Length = size;
-	ga->AllocEntries[atidx].Id = MAX_NUM_ALLOCATIONS;
-	ga->AllocEntries[atidx].Flags = 0;
-	++ga->NbAllocEntries;
+	// Allocate this block
+	Esd_GpuAlloc_UnlinkFree(ga, idx);
+	entry->Length = size;
+
+	// Insert free space entry after
+	if (remaining)
+	{
+		Esd_GpuAlloc_InsertFree(ga, idx, remaining);
+	}
+
+	return Esd_GpuAlloc_AssignId(ga, idx, flags);
 }
 
-ESD_CORE_EXPORT Esd_GpuHandle Esd_GpuAlloc_Alloc(Esd_GpuAlloc *ga, uint32_t size, uint16_t flags)
+// Allocate a block at the end of the free space entry at idx
+static Esd_GpuHandle Esd_GpuAlloc_AllocEnd(Esd_GpuAlloc *ga, uint32_t idx, uint32_t size, uint16_t flags)
 {
+	Esd_GpuAllocEntry *entry = &ga->AllocEntries[idx];
+	uint32_t remaining = entry->Length - size;
+	uint32_t atidx;
+	Esd_GpuHandle ret;
+
+	if (!remaining)
+		return Esd_GpuAlloc_AllocAt(ga, idx, size, flags);
+
+	if (!ga->NbFreeIds || ga->UnusedEntry == MAX_NUM_ALLOCATIONS)
+	{
+		ret.Id = MAX_NUM_ALLOCATIONS;
+		ret.Seq = 0;
+		return ret;
+	}
+
+	// The free space keeps the start of the entry, the block is split off after it
+	Esd_GpuAlloc_UnlinkFree(ga, idx);
+	entry->Length = remaining;
+	Esd_GpuAlloc_LinkFree(ga, idx);
+	Esd_GpuAlloc_InsertFree(ga, idx, size);
+	atidx = entry->Next;
+	Esd_GpuAlloc_UnlinkFree(ga, atidx);
+
+	return Esd_GpuAlloc_AssignId(ga, atidx, flags);
+}
+
+static Esd_GpuHandle Esd_GpuAlloc_AllocEntry(Esd_GpuAlloc *ga, uint32_t size, uint16_t flags)
+{
+	uint32_t c = Esd_GpuAlloc_SizeClass(size);
 	uint32_t idx;
+	uint32_t classes;
 	Esd_GpuHandle ret;
 
-	if (ga->NbAllocEntries >= MAX_NUM_ALLOCATIONS)
+	if (flags & GA_ARENA_MASK)
 	{
-		goto ReturnInvalidHandle;
+		// Arena allocations take the highest free space that fits, the map is walked in address order
+		uint32_t top = MAX_NUM_ALLOCATIONS;
+		for (idx = ga->FirstEntry; idx != MAX_NUM_ALLOCATIONS; idx = ga->AllocEntries[idx].Next)
+		{
+			if (ga->AllocEntries[idx].Id == MAX_NUM_ALLOCATIONS && ga->AllocEntries[idx].Length >= size)
+				top = idx;
+		}
+		if (top != MAX_NUM_ALLOCATIONS)
+			return Esd_GpuAlloc_AllocEnd(ga, top, size, flags);
+		ret.Id = MAX_NUM_ALLOCATIONS;
+		ret.Seq = 0;
+		return ret;
 	}
 
-	// Always align size to 4 bytes
-	size = (size + 3UL) & ~3UL;
+	// Free space in the size class of the request may be too small, take the first one that is large enough
+	for (idx = ga->FreeLists[c]; idx != MAX_NUM_ALLOCATIONS; idx = ga->AllocEntries[idx].FreeNext)
+	{
+		if (ga->AllocEntries[idx].Length >= size)
+			return Esd_GpuAlloc_AllocAt(ga, idx, size, flags);
+	}
+
+	// Any free space in a larger size class is large enough
+	classes = (c + 1 < GA_SIZE_CLASSES) ? (ga->FreeClasses >> (c + 1)) : 0;
+	if (classes)
+	{
+		++c;
+		while (!(classes & 1))
+		{
+			classes >>= 1;
+			++c;
+		}
+		return Esd_GpuAlloc_AllocAt(ga, ga->FreeLists[c], size, flags);
+	}
+
+	// No space left, return an invalid allocation handle...
+	ret.Id = MAX_NUM_ALLOCATIONS;
+	ret.Seq = 0;
+	return ret;
+}
+
+ESD_CORE_EXPORT void Esd_GpuAlloc_FreeId(Esd_GpuAlloc *ga, int id);
+
+// Free the least recently used allocation which may be discarded, returns false if there is none
+static bool Esd_GpuAlloc_Evict(Esd_GpuAlloc *ga)
+{
+	uint32_t idx;
+	uint32_t lruIdx = MAX_NUM_ALLOCATIONS;
+	uint32_t lruAge = 1; // Allocations used in the displayed frame are still referenced
 
-	// Scan through the AllocEntries, find the first open allocation that is large enough
-	for (idx = 0; idx < ga->NbAllocEntries; ++idx)
+	for (idx = ga->FirstEntry; idx != MAX_NUM_ALLOCATIONS; idx = ga->AllocEntries[idx].Next)
 	{
-		// Check if allocation entry is unallocated and large enough
-		if (ga->AllocEntries[idx].Id == MAX_NUM_ALLOCATIONS
-		    && ga->AllocEntries[idx].Length >= size)
+		Esd_GpuAllocEntry *entry = &ga->AllocEntries[idx];
+		if (entry->Id < MAX_NUM_ALLOCATIONS
+		    && (entry->Flags & (GA_GC_FLAG | GA_LOW_FLAG))
+		    && !(entry->Flags & GA_USED_FLAG))
 		{
-			// Find an unused handle
-			int id;
-			for (id = 0; id < MAX_NUM_ALLOCATIONS; ++id)
+			uint32_t age = ga->Frame - entry->LastUse;
+			if (age > lruAge)
 			{
-				if (ga->AllocRefs[id].Idx == MAX_NUM_ALLOCATIONS)
-				{
-					// Allocate this block
-					uint32_t remaining = ga->AllocEntries[idx].Length - size;
-					ga->AllocEntries[idx].Length = size;
-					ga->AllocEntries[idx].Id = id;
-					flags |= GA_USED_FLAG;
-					ga->AllocEntries[idx].Flags = flags;
-					ga->AllocRefs[id].Idx = idx;
-					++ga->AllocRefs[id].Seq;
-
-					// Skip seq 0 to simplify invalid values
-					if (ga->AllocRefs[id].Seq == 0)
-						ga->AllocRefs[id].Seq = 1;
-
-					// Insert free space entry after
-					if (remaining)
-					{
-						Esd_GpuAlloc_InsertFree(ga, idx + 1, remaining);
-					}
-
-
-					// eve_printf_debug("Alloc id %i\n", id);
-
-					// Return the valid gpu ram handle
-					ret.Id = id;
-					ret.Seq = ga->AllocRefs[id].Seq;
-					return ret;
-				}
+				lruIdx = idx;
+				lruAge = age;
 			}
-
-			// No invalid handle found
-			goto ReturnInvalidHandle;
 		}
 	}
 
-	// No space left, return an invalid allocation handle...
-ReturnInvalidHandle:
+	if (lruIdx == MAX_NUM_ALLOCATIONS)
+		return false;
+
+	// eve_printf_debug("Evict id %i, unused for %i frames\n", (int)ga->AllocEntries[lruIdx].Id, (int)lruAge);
+	Esd_GpuAlloc_FreeId(ga, ga->AllocEntries[lruIdx].Id);
+	++ga->NbEvictions;
+	return true;
+}
+
+ESD_CORE_EXPORT Esd_GpuHandle Esd_GpuAlloc_Alloc(Esd_GpuAlloc *ga, uint32_t size, uint16_t flags)
+{
+	Esd_GpuHandle ret;
+
+	// Always align size to 4 bytes
+	size = (size + 3UL) & ~3UL;
+
+	// Pinned allocations belong to their owner rather than to the page that happened to be active
+	flags &= ~GA_ARENA_MASK;
+	if (ga->Arena && (flags & (GA_GC_FLAG | GA_LOW_FLAG)))
+		flags |= (uint16_t)ga->Arena << GA_ARENA_SHIFT;
+
+	do
+	{
+		if (!ga->Budget || (ga->TotalUsed + size) <= ga->Budget)
+		{
+			ret = Esd_GpuAlloc_AllocEntry(ga, size, flags);
+			if (ret.Id < MAX_NUM_ALLOCATIONS)
+				return ret;
+		}
 
+		// Out of space or over budget, evict resident allocations until it fits
+	} while (Esd_GpuAlloc_Evict(ga));
 
 	ret.Id = MAX_NUM_ALLOCATIONS;
 	ret.Seq = 0;
 	return ret;
 }
 
+ESD_CORE_EXPORT Esd_GpuHandle Esd_GpuAlloc_AllocStatic(Esd_GpuAlloc *ga, uint32_t address, uint32_t size)
+{
+	uint32_t prev = MAX_NUM_ALLOCATIONS;
+	uint32_t next = ga->FirstEntry;
+	uint32_t idx;
+	Esd_GpuAllocEntry *entry;
+	Esd_GpuHandle ret;
+
+	// Always align size to 4 bytes
+	size = (size + 3UL) & ~3UL;
+
+	ret.Id = MAX_NUM_ALLOCATIONS;
+	ret.Seq = 0;
+
+	eve_assert(!(address & 3UL));
+	if (address > ga->StaticSize || size > ga->StaticSize - address)
+	{
+		eve_printf_debug("Static allocation at %i of %i bytes is outside of the layout, regenerate it\n", (int)address, (int)size);
+		return ret;
+	}
+
+	// Static entries are at the start of the allocation map, only those before the address are visited
+	while (next != MAX_NUM_ALLOCATIONS
+	    && (ga->AllocEntries[next].Flags & GA_STATIC_FLAG)
+	    && ga->AllocEntries[next].Address < address)
+	{
+		prev = next;
+		next = ga->AllocEntries[next].Next;
+	}
+
+	if (next != MAX_NUM_ALLOCATIONS && (ga->AllocEntries[next].Flags & GA_STATIC_FLAG)
+	    && ga->AllocEntries[next].Address == address && ga->AllocEntries[next].Length == size)
+	{
+		// Address is assigned to a single asset, a previous handle to it was dropped without freeing
+		uint32_t id = ga->AllocEntries[next].Id;
+		ga->TotalUsed -= size;
+		++ga->NbFrees;
+		ga->FreeIds[ga->NbFreeIds++] = id;
+		ga->AllocRefs[id].Idx = MAX_NUM_ALLOCATIONS;
+		return Esd_GpuAlloc_AssignId(ga, next, GA_FIXED_FLAG | GA_STATIC_FLAG);
+	}
+
+	if ((prev != MAX_NUM_ALLOCATIONS && ga->AllocEntries[prev].Address + ga->AllocEntries[prev].Length > address)
+	    || (next != MAX_NUM_ALLOCATIONS && (ga->AllocEntries[next].Flags & GA_STATIC_FLAG) && address + size > ga->AllocEntries[next].Address))
+	{
+		eve_printf_debug("Static allocation at %i of %i bytes overlaps another one, regenerate the layout\n", (int)address, (int)size);
+		return ret;
+	}
+
+	if (!ga->NbFreeIds || ga->UnusedEntry == MAX_NUM_ALLOCATIONS)
+		return ret;
+
+	// Take an unused entry and link it in address order, static entries need no free space entries in between
+	idx = ga->UnusedEntry;
+	entry = &ga->AllocEntries[idx];
+	ga->UnusedEntry = entry->FreeNext;
+	++ga->NbAllocEntries;
+
+	entry->Prev = prev;
+	entry->Next = next;
+	if (prev != MAX_NUM_ALLOCATIONS)
+		ga->AllocEntries[prev].Next = idx;
+	else
+		ga->FirstEntry = idx;
+	if (next != MAX_NUM_ALLOCATIONS)
+		ga->AllocEntries[next].Prev = idx;
+
+	entry->Address = address;
+	entry->Length = size;
+	entry->FreePrev = MAX_NUM_ALLOCATIONS;
+	entry->FreeNext = MAX_NUM_ALLOCATIONS;
+	entry->Crc = 0;
+	return Esd_GpuAlloc_AssignId(ga, idx, GA_FIXED_FLAG | GA_STATIC_FLAG);
+}
+
 bool Esd_GpuAlloc_Truncate(Esd_GpuAlloc *ga, Esd_GpuHandle handle, uint32_t size)
 {
-	if (ga->NbAllocEntries >= MAX_NUM_ALLOCATIONS && handle.Id < MAX_NUM_ALLOCATIONS)
+	// Always align size to 4 bytes
+	size = (size + 3UL) & ~3UL;
+
+	if (handle.Id < MAX_NUM_ALLOCATIONS)
 	{
 		if (ga->AllocRefs[handle.Id].Seq == handle.Seq)
 		{
 			uint16_t id = handle.Id;
 			uint16_t idx = ga->AllocRefs[id].Idx;
-			ga->AllocEntries[idx].Flags |= GA_USED_FLAG;
-			uint32_t oldSize = ga->AllocEntries[idx].Length;
+			Esd_GpuAllocEntry *entry = &ga->AllocEntries[idx];
+			entry->Flags |= GA_USED_FLAG;
+			entry->LastUse = ga->Frame;
+			uint32_t oldSize = entry->Length;
 			if (size == oldSize)
 				return true;
 			if (size > oldSize)
 				return false;
+			if (entry->Flags & GA_STATIC_FLAG)
+				return true; // The layout keeps the full size reserved
+			entry->Flags &= ~GA_VERIFY_FLAG;
 			uint32_t diffSize = oldSize - size;
-			ga->AllocEntries[idx].Length -= diffSize;
-			if (ga->AllocEntries[idx + 1].Id == MAX_NUM_ALLOCATIONS)
+			uint32_t next = entry->Next;
+			if (next != MAX_NUM_ALLOCATIONS && ga->AllocEntries[next].Id == MAX_NUM_ALLOCATIONS)
 			{
-				ga->AllocEntries[idx + 1].Address -= diffSize;
+				// Grow the free space entry after
+				Esd_GpuAlloc_UnlinkFree(ga, next);
+				entry->Length = size;
+				ga->AllocEntries[next].Address -= diffSize;
+				ga->AllocEntries[next].Length += diffSize;
+				Esd_GpuAlloc_LinkFree(ga, next);
 			}
 			else
 			{
-				Esd_GpuAlloc_InsertFree(ga, idx + 1, diffSize);
+				entry->Length = size;
+				if (!Esd_GpuAlloc_InsertFree(ga, idx, diffSize))
+				{
+					// Allocation map is full, keep the block as is
+					entry->Length = oldSize;
+					return false;
+				}
 			}
+			ga->TotalUsed -= diffSize;
+			return true;
 		}
 	}
 	return false;
@@ -182,6 +512,7 @@ ESD_CORE_EXPORT uint32_t Esd_GpuAlloc_Get(Esd_GpuAlloc *ga, Esd_GpuHandle handle
 			uint16_t id = handle.Id;
 			uint16_t idx = ga->AllocRefs[id].Idx;
 			ga->AllocEntries[idx].Flags |= GA_USED_FLAG;
+			ga->AllocEntries[idx].LastUse = ga->Frame;
 			return ga->AllocEntries[idx].Address;
 		}
 	}
@@ -189,41 +520,32 @@ ESD_CORE_EXPORT uint32_t Esd_GpuAlloc_Get(Esd_GpuAlloc *ga, Esd_GpuHandle handle
 	return ~0;
 }
 
-ESD_CORE_EXPORT void Esd_GpuAlloc_CollapseFree(Esd_GpuAlloc *ga, uint32_t idxat)
+// Merge a new free space entry with its free neighbours and add it to the free lists, returns the merged entry
+ESD_CORE_EXPORT uint32_t Esd_GpuAlloc_CollapseFree(Esd_GpuAlloc *ga, uint32_t idxat)
 {
-	int shift = 0;
-	if (idxat + 1 < ga->NbAllocEntries && ga->AllocEntries[idxat + 1].Id == MAX_NUM_ALLOCATIONS)
+	uint32_t next = ga->AllocEntries[idxat].Next;
+	uint32_t prev = ga->AllocEntries[idxat].Prev;
+	if (next != MAX_NUM_ALLOCATIONS && ga->AllocEntries[next].Id == MAX_NUM_ALLOCATIONS)
 	{
 		// Next entry is free, add to collapse
-		++shift;
-		ga->AllocEntries[idxat].Length += ga->AllocEntries[idxat + 1].Length;
+		Esd_GpuAlloc_UnlinkFree(ga, next);
+		ga->AllocEntries[idxat].Length += ga->AllocEntries[next].Length;
+		Esd_GpuAlloc_DeleteEntry(ga, next);
 	}
-	if (idxat > 0 && ga->AllocEntries[idxat - 1].Id == MAX_NUM_ALLOCATIONS)
+	if (prev != MAX_NUM_ALLOCATIONS && ga->AllocEntries[prev].Id == MAX_NUM_ALLOCATIONS)
 	{
 		// Previous entry is free, add to collapse
-		--idxat;
-		++shift;
-		ga->AllocEntries[idxat].Length += ga->AllocEntries[idxat + 1].Length;
-	}
-	if (shift)
-	{
-		// Collapse indices
-		uint32_t idx;
-		ga->NbAllocEntries -= shift;
-		for (idx = idxat + 1; idx < ga->NbAllocEntries; ++idx)
-		{
-			int id;
-			ga->AllocEntries[idx] = ga->AllocEntries[idx + shift];
-			id = ga->AllocEntries[idx].Id;
-			if (id < MAX_NUM_ALLOCATIONS)
-			{
-				ga->AllocRefs[id].Idx = idx;
-			}
-		}
+		Esd_GpuAlloc_UnlinkFree(ga, prev);
+		ga->AllocEntries[prev].Length += ga->AllocEntries[idxat].Length;
+		Esd_GpuAlloc_DeleteEntry(ga, idxat);
+		idxat = prev;
 	}
+	Esd_GpuAlloc_LinkFree(ga, idxat);
+	return idxat;
 }
 
-ESD_CORE_EXPORT void Esd_GpuAlloc_FreeId(Esd_GpuAlloc *ga, int id)
+// Free the allocation with the given Id, returns the free space entry it became part of, or MAX_NUM_ALLOCATIONS for static allocations
+static uint32_t Esd_GpuAlloc_FreeIdEntry(Esd_GpuAlloc *ga, int id)
 {
 	// eve_printf_debug("Free id %i\n", id);
 
@@ -238,12 +560,28 @@ ESD_CORE_EXPORT void Esd_GpuAlloc_FreeId(Esd_GpuAlloc *ga, int id)
 	if (ga->AllocRefs[id].Seq == 0)
 		ga->AllocRefs[id].Seq = 1;
 
+	ga->FreeIds[ga->NbFreeIds++] = id;
+	ga->TotalUsed -= ga->AllocEntries[idx].Length;
+	++ga->NbFrees;
+
+	// Static space is not managed by the free lists, just drop the entry
+	if (ga->AllocEntries[idx].Flags & GA_STATIC_FLAG)
+	{
+		Esd_GpuAlloc_DeleteEntry(ga, idx);
+		return MAX_NUM_ALLOCATIONS;
+	}
+
 	// Free entry
 	ga->AllocEntries[idx].Id = MAX_NUM_ALLOCATIONS;
 	ga->AllocEntries[idx].Flags = 0;
 
 	// Collapse neighbouring entries
-	Esd_GpuAlloc_CollapseFree(ga, idx);
+	return Esd_GpuAlloc_CollapseFree(ga, idx);
+}
+
+ESD_CORE_EXPORT void Esd_GpuAlloc_FreeId(Esd_GpuAlloc *ga, int id)
+{
+	Esd_GpuAlloc_FreeIdEntry(ga, id);
 }
 
 ESD_CORE_EXPORT void Esd_GpuAlloc_Free(Esd_GpuAlloc *ga, Esd_GpuHandle handle)
@@ -256,44 +594,127 @@ ESD_CORE_EXPORT void Esd_GpuAlloc_Free(Esd_GpuAlloc *ga, Esd_GpuHandle handle)
 	}
 }
 
-ESD_CORE_EXPORT void Esd_GpuAlloc_Update(Esd_GpuAlloc *ga)
+ESD_CORE_EXPORT uint8_t Esd_GpuAlloc_NewArena(Esd_GpuAlloc *ga)
+{
+	if (!++ga->LastArena)
+		ga->LastArena = 1;
+	return ga->LastArena;
+}
+
+ESD_CORE_EXPORT uint8_t Esd_GpuAlloc_SetArena(Esd_GpuAlloc *ga, uint8_t arena)
 {
+	uint8_t previous = ga->Arena;
+	ga->Arena = arena;
+	return previous;
+}
+
+ESD_CORE_EXPORT void Esd_GpuAlloc_FreeArena(Esd_GpuAlloc *ga, uint8_t arena)
+{
+	uint16_t tag = (uint16_t)arena << GA_ARENA_SHIFT;
 	uint32_t idx;
-	for (idx = 0; idx < ga->NbAllocEntries; ++idx)
-	{
-		// Check if allocation entry is allocated
-		if (ga->AllocEntries[idx].Id < MAX_NUM_ALLOCATIONS)
-		{
-			// If GC flag is set and used flag is not set, free this memory
-			if (ga->AllocEntries[idx].Flags & GA_GC_FLAG)
-			{
-				if (!(ga->AllocEntries[idx].Flags & GA_USED_FLAG))
-				{
-					Esd_GpuAlloc_FreeId(ga, ga->AllocEntries[idx].Id);
 
-					// Due to free collapse, the current idx may become another allocated entry
-					--idx;
-					continue;
-				}
-			}
+	if (!arena)
+		return;
 
-			// Always clear the used flag on update
-			ga->AllocEntries[idx].Flags &= ~GA_USED_FLAG;
-		}
+	// Collected by the next Update in one pass, neighbouring entries collapse into a single free extent
+	for (idx = ga->FirstEntry; idx != MAX_NUM_ALLOCATIONS; idx = ga->AllocEntries[idx].Next)
+	{
+		Esd_GpuAllocEntry *entry = &ga->AllocEntries[idx];
+		if (entry->Id < MAX_NUM_ALLOCATIONS && (entry->Flags & GA_ARENA_MASK) == tag)
+			entry->Flags |= GA_GC_FLAG | GA_DISCARD_FLAG;
+	}
+}
+
+ESD_CORE_EXPORT void Esd_GpuAlloc_Discard(Esd_GpuAlloc *ga, Esd_GpuHandle handle)
+{
+	int id = handle.Id;
+	if (id < MAX_NUM_ALLOCATIONS
+	    && ga->AllocRefs[id].Seq == handle.Seq)
+	{
+		uint32_t idx = ga->AllocRefs[id].Idx;
+		ga->AllocEntries[idx].Flags = (ga->AllocEntries[idx].Flags & ~GA_MOVING_FLAG) | GA_GC_FLAG | GA_DISCARD_FLAG;
 	}
+}
 
 #if GA_ENABLE_DEFRAG_SAFE
-	for (idx = 0; idx < ga->NbAllocEntries; ++idx)
+// Swap the handles of the copies which have completed, returns false while copies are still in flight
+static bool Esd_GpuAlloc_FinishMoves(Esd_GpuAlloc *ga)
+{
+	EVE_HalContext *phost = Esd_GetHost();
+	bool fault;
+	uint32_t i;
+
+	if (!ga->NbMoves)
+		return true;
+
+	// All copies have completed once the coprocessor has caught up
+	fault = phost->CmdFault;
+	if (!fault && EVE_Cmd_rp(phost) != EVE_Cmd_wp(phost))
+		return false;
+	fault = fault || phost->CmdFault;
+
+	for (i = 0; i < ga->NbMoves; ++i)
 	{
-		// Find the first empty block
-		if (ga->AllocEntries[idx].Id == MAX_NUM_ALLOCATIONS)
-			break;
+		Esd_GpuAllocMove *move = &ga->Moves[i];
+		uint32_t idx = MAX_NUM_ALLOCATIONS;
+		uint32_t newIdx = MAX_NUM_ALLOCATIONS;
+
+		if (move->Source.Id < MAX_NUM_ALLOCATIONS && ga->AllocRefs[move->Source.Id].Seq == move->Source.Seq)
+			idx = ga->AllocRefs[move->Source.Id].Idx;
+		if (move->Target.Id < MAX_NUM_ALLOCATIONS && ga->AllocRefs[move->Target.Id].Seq == move->Target.Seq)
+			newIdx = ga->AllocRefs[move->Target.Id].Idx;
+
+		// The source may have been freed, evicted or truncated while the copy was in flight
+		if (fault || idx == MAX_NUM_ALLOCATIONS || newIdx == MAX_NUM_ALLOCATIONS
+		    || ga->AllocEntries[idx].Length != move->Length)
+		{
+			if (idx != MAX_NUM_ALLOCATIONS)
+				ga->AllocEntries[idx].Flags &= ~GA_MOVING_FLAG;
+			Esd_GpuAlloc_Free(ga, move->Target);
+			continue;
+		}
+
+		// Swap the handles
+		ga->AllocEntries[newIdx].Id = move->Source.Id;
+		ga->AllocEntries[idx].Id = move->Target.Id; // Target handle will be discarded
+		ga->AllocRefs[move->Source.Id].Idx = newIdx;
+		ga->AllocRefs[move->Target.Id].Idx = idx; // Target handle will be discarded
+
+		// The new address takes over the state, the old address may still be referenced by the displayed frame
+		ga->AllocEntries[newIdx].Flags = ga->AllocEntries[idx].Flags & ~GA_MOVING_FLAG;
+		ga->AllocEntries[newIdx].LastUse = ga->AllocEntries[idx].LastUse;
+		ga->AllocEntries[newIdx].Crc = ga->AllocEntries[idx].Crc;
+		ga->AllocEntries[idx].Flags = 0; // Pinned, freed once the coprocessor has swapped in a frame which no longer references it
+		Esd_DeferredGpuFree(move->Target); // Target handle now refers to the old address
 	}
 
-	// Memory is fragmented, try to find a small block that can be moved
-	// This strategy only works if the first open space is larger than the fragmented blocks
-	if (idx != ga->NbAllocEntries - 1)
+	ga->NbMoves = 0;
+	return true;
+}
+
+// Schedule copies into the first empty block, within the per frame budget, without waiting for them
+static void Esd_GpuAlloc_StartMoves(Esd_GpuAlloc *ga)
+{
+	EVE_HalContext *phost = Esd_GetHost();
+	uint32_t budget = GA_DEFRAG_BUDGET;
+	uint32_t idx;
+	uint32_t next;
+
+	while (ga->NbMoves < GA_DEFRAG_MOVES)
 	{
+		for (idx = ga->FirstEntry; idx != MAX_NUM_ALLOCATIONS; idx = ga->AllocEntries[idx].Next)
+		{
+			// Find the first empty block
+			if (ga->AllocEntries[idx].Id == MAX_NUM_ALLOCATIONS)
+				break;
+		}
+
+		// Memory is not fragmented
+		if (idx == MAX_NUM_ALLOCATIONS || ga->AllocEntries[idx].Next == MAX_NUM_ALLOCATIONS)
+			return;
+
+		// Memory is fragmented, try to find a small block that can be moved
+		// This strategy only works if the first open space is larger than the fragmented blocks
 		// The first empty block is the largest space we can fill to cleanly defragment memory
 		uint32_t leftIdx = idx;
 		uint32_t leftSpace = ga->AllocEntries[leftIdx].Length;
@@ -301,28 +722,30 @@ ESD_CORE_EXPORT void Esd_GpuAlloc_Update(Esd_GpuAlloc *ga)
 		uint32_t largestIdx = MAX_NUM_ALLOCATIONS;
 		uint32_t largestSpace = 0;
 
-		for (idx = leftIdx + 1; idx < ga->NbAllocEntries; ++idx)
+		for (idx = ga->AllocEntries[leftIdx].Next; idx != MAX_NUM_ALLOCATIONS; idx = ga->AllocEntries[idx].Next)
 		{
+			uint32_t prev = ga->AllocEntries[idx].Prev;
+			next = ga->AllocEntries[idx].Next;
 			if (ga->AllocEntries[idx].Id != MAX_NUM_ALLOCATIONS
 			    && ga->AllocEntries[idx].Length <= leftSpace
-			    && (ga->AllocEntries[idx].Flags & GA_FIXED_FLAG) == 0)
+			    && (ga->AllocEntries[idx].Flags & (GA_FIXED_FLAG | GA_MOVING_FLAG | GA_ARENA_MASK)) == 0)
 			{
 				// This entry can potentially be moved
-				uint32_t space = 0;
+				// Score by the extent of free space it leaves behind once its old address is released
+				uint32_t space = ga->AllocEntries[idx].Length;
 
-				// Count space that will be emptied
 				// Doesn't count for the first entry, it moves into the same empty space
-				if (idx > leftIdx + 1)
-					space += ga->AllocEntries[idx].Length;
+				if (prev == leftIdx)
+					space = 0;
 
 				// Count empty space on the left
-				if (ga->AllocEntries[idx - 1].Id == MAX_NUM_ALLOCATIONS)
-					space += ga->AllocEntries[idx - 1].Length;
+				if (ga->AllocEntries[prev].Id == MAX_NUM_ALLOCATIONS)
+					space += ga->AllocEntries[prev].Length;
 
 				// Count empty space on the right
-				if (idx + 1 < MAX_NUM_ALLOCATIONS
-				    && ga->AllocEntries[idx + 1].Id == MAX_NUM_ALLOCATIONS)
-					space += ga->AllocEntries[idx + 1].Length;
+				if (next != MAX_NUM_ALLOCATIONS
+				    && ga->AllocEntries[next].Id == MAX_NUM_ALLOCATIONS)
+					space += ga->AllocEntries[next].Length;
 
 				if (space > largestSpace)
 				{
@@ -332,62 +755,237 @@ ESD_CORE_EXPORT void Esd_GpuAlloc_Update(Esd_GpuAlloc *ga)
 			}
 		}
 
-		if (largestIdx != MAX_NUM_ALLOCATIONS)
+		if (largestIdx == MAX_NUM_ALLOCATIONS)
+			return;
+
+		// Stay within the copy budget, but always allow one copy so large blocks can still be moved
+		uint32_t size = ga->AllocEntries[largestIdx].Length;
+		if (size > budget && ga->NbMoves)
+			return;
+
+		// Reserve the target at the start of the first empty block, it is not collected while the copy is in flight
+		Esd_GpuHandle newHandle = Esd_GpuAlloc_AllocAt(ga, leftIdx, size, GA_FIXED_FLAG);
+		if (newHandle.Id == MAX_NUM_ALLOCATIONS)
+			return;
+
+		Esd_GpuAllocMove *move = &ga->Moves[ga->NbMoves++];
+		move->Source.Id = ga->AllocEntries[largestIdx].Id;
+		move->Source.Seq = ga->AllocRefs[move->Source.Id].Seq;
+		move->Target = newHandle;
+		move->Length = size;
+		ga->AllocEntries[largestIdx].Flags |= GA_MOVING_FLAG;
+
+		eve_printf_debug("Defragmenting allocation %i with handle id %i and size %i bytes, leaving a free space of %i bytes. Copy %i to %i\n",
+		    (int)largestIdx, (int)move->Source.Id, (int)size, (int)largestSpace,
+		    (int)ga->AllocEntries[largestIdx].Address, (int)ga->AllocEntries[leftIdx].Address);
+		EVE_CoCmd_memCpy(phost, ga->AllocEntries[leftIdx].Address, ga->AllocEntries[largestIdx].Address, size);
+
+		budget = (size < budget) ? (budget - size) : 0;
+	}
+}
+#endif
+
+ESD_CORE_EXPORT void Esd_GpuAlloc_Update(Esd_GpuAlloc *ga)
+{
+	uint32_t idx;
+	uint32_t next;
+#if GA_ENABLE_DEFRAG_SAFE
+	bool moved;
+#endif
+	++ga->Frame;
+
+#if GA_ENABLE_DEFRAG_SAFE
+	// Handles are swapped before collecting, so the old addresses are discarded at the same time as they used to be
+	moved = Esd_GpuAlloc_FinishMoves(ga);
+#endif
+
+	for (idx = ga->FirstEntry; idx != MAX_NUM_ALLOCATIONS; idx = next)
+	{
+		next = ga->AllocEntries[idx].Next;
+
+		// Check if allocation entry is allocated
+		if (ga->AllocEntries[idx].Id < MAX_NUM_ALLOCATIONS)
 		{
-			// Store handle, address, and size
-			uint16_t handle = ga->AllocEntries[largestIdx].Id;
-			uint32_t addr = ga->AllocEntries[largestIdx].Address;
-			uint32_t size = ga->AllocEntries[largestIdx].Length;
-
-			// Esd_GpuAlloc_Print(ga);
-
-			// Get new allocation
-			Esd_GpuHandle newHandle = Esd_GpuAlloc_Alloc(ga, size, ga->AllocEntries[largestIdx].Flags);
-			idx = ga->AllocRefs[handle].Idx;
-			uint32_t newIdx = ga->AllocRefs[newHandle.Id].Idx;
-			uint32_t newAddr = ga->AllocEntries[newIdx].Address;
-
-			eve_assert(ga->AllocEntries[idx].Id == handle); // Verify old allocation
-			eve_printf_debug("Defragmenting allocation %i with handle id %i and size %i bytes, leaving a free space of %i bytes. Copy %i to %i\n",
-			    (int)largestIdx, handle, size, (int)largestSpace, (int)addr, (int)newAddr);
-			EVE_CoCmd_memCpy(Esd_GetHost(), newAddr, addr, size);
-			if (!EVE_Cmd_waitFlush(Esd_GetHost()))
-			{
-				eve_printf_debug("Failed to copy. Defragmentation failed");
-			}
-			else
+			// If GC flag is set and used flag is not set, free this memory
+			// When residency is enabled, it is kept until evicted, unless it was discarded
+			if (ga->AllocEntries[idx].Flags & GA_GC_FLAG)
 			{
-				// Swap the handles
-				ga->AllocEntries[newIdx].Id = handle;
-				ga->AllocEntries[idx].Id = newHandle.Id; // New handle will be discarded
-				ga->AllocRefs[handle].Idx = newIdx;
-				ga->AllocRefs[newHandle.Id].Idx = idx; // New handle will be discarded
-
-				ga->AllocEntries[newIdx].Flags &= ~GA_USED_FLAG; // Don't flag the new one as used
-				ga->AllocEntries[idx].Flags |= GA_GC_FLAG; // Force GC on the old address
+				if (!(ga->AllocEntries[idx].Flags & GA_USED_FLAG)
+#if GA_ENABLE_RESIDENCY
+				    && (ga->AllocEntries[idx].Flags & GA_DISCARD_FLAG)
+#endif
+				)
+				{
+					// Due to free collapse, the next entry may have been merged into the freed space
+					uint32_t freeIdx = Esd_GpuAlloc_FreeIdEntry(ga, ga->AllocEntries[idx].Id);
+					if (freeIdx != MAX_NUM_ALLOCATIONS)
+						next = ga->AllocEntries[freeIdx].Next;
+					continue;
+				}
 			}
 
-			// Esd_GpuAlloc_Print(ga);
+			// Always clear the used flag on update
+			ga->AllocEntries[idx].Flags &= ~GA_USED_FLAG;
 		}
 	}
+
+#if GA_ENABLE_DEFRAG_SAFE
+	// Only start new copies once the previous ones have been completed
+	if (moved)
+		Esd_GpuAlloc_StartMoves(ga);
 #endif
 }
 
-// Get total used GPU RAM
-ESD_CORE_EXPORT uint32_t Esd_GpuAlloc_GetTotalUsed(Esd_GpuAlloc *ga)
+ESD_CORE_EXPORT bool Esd_GpuAlloc_IsMoving(Esd_GpuAlloc *ga, Esd_GpuHandle handle)
+{
+	if (handle.Id < MAX_NUM_ALLOCATIONS && ga->AllocRefs[handle.Id].Seq == handle.Seq)
+		return !!(ga->AllocEntries[ga->AllocRefs[handle.Id].Idx].Flags & GA_MOVING_FLAG);
+	return false;
+}
+
+ESD_CORE_EXPORT void Esd_GpuAlloc_Seal(Esd_GpuAlloc *ga, Esd_GpuHandle handle)
 {
-	uint32_t total = 0;
+	EVE_HalContext *phost = Esd_GetHost();
+	Esd_GpuAllocEntry *entry;
+	uint32_t crc;
+
+	if (handle.Id >= MAX_NUM_ALLOCATIONS || ga->AllocRefs[handle.Id].Seq != handle.Seq)
+		return;
+
+	entry = &ga->AllocEntries[ga->AllocRefs[handle.Id].Idx];
+	if (EVE_CoCmd_memCrc(phost, entry->Address, entry->Length, &crc))
+	{
+		entry->Crc = crc;
+		entry->Flags |= GA_VERIFY_FLAG;
+	}
+}
+
+ESD_CORE_EXPORT void Esd_GpuAlloc_SealCrc(Esd_GpuAlloc *ga, Esd_GpuHandle handle, uint32_t crc, uint32_t size)
+{
+	Esd_GpuAllocEntry *entry;
+
+	if (handle.Id >= MAX_NUM_ALLOCATIONS || ga->AllocRefs[handle.Id].Seq != handle.Seq)
+		return;
+
+	entry = &ga->AllocEntries[ga->AllocRefs[handle.Id].Idx];
+	if (size != entry->Length)
+		return;
+	entry->Crc = crc;
+	entry->Flags |= GA_VERIFY_FLAG;
+}
+
+ESD_CORE_EXPORT void Esd_GpuAlloc_Scrub(Esd_GpuAlloc *ga)
+{
+#if GA_ENABLE_SCRUB && EVE_CMD_FUTURES
+	EVE_HalContext *phost = Esd_GetHost();
+	Esd_GpuAllocEntry *entry;
+	uint32_t first = MAX_NUM_ALLOCATIONS;
+	uint32_t found = MAX_NUM_ALLOCATIONS;
 	uint32_t idx;
-	for (idx = 0; idx < ga->NbAllocEntries; ++idx)
+
+	if (ga->ScrubFuture != EVE_CMD_FUTURE_INVALID)
 	{
-		// Check if allocation entry is allocated
-		if (ga->AllocEntries[idx].Id < MAX_NUM_ALLOCATIONS)
+		Esd_GpuHandle handle = ga->ScrubHandle;
+		uint32_t crc;
+		bool valid;
+
+		if (!EVE_Cmd_futurePoll(phost, ga->ScrubFuture))
+			return;
+		valid = EVE_Cmd_futureGet(phost, ga->ScrubFuture, &crc, 1);
+		ga->ScrubFuture = EVE_CMD_FUTURE_INVALID;
+
+		// Dropped by a coprocessor fault, or freed meanwhile
+		if (!valid || handle.Id >= MAX_NUM_ALLOCATIONS || ga->AllocRefs[handle.Id].Seq != handle.Seq)
+			return;
+
+		entry = &ga->AllocEntries[ga->AllocRefs[handle.Id].Idx];
+		if ((entry->Flags & GA_VERIFY_FLAG) && crc != entry->Crc)
+		{
+			eve_printf_debug("Allocation with handle id %i is corrupted, reloading\n", (int)entry->Id);
+			entry->Flags &= ~GA_VERIFY_FLAG;
+			++ga->NbCorruptions;
+			Esd_DeferredGpuFree(handle); // The displayed frame may still reference it
+			Esd_Invalidate();
+		}
+		return;
+	}
+
+	// Next sealed persistent allocation in address order, from the start again after the last one
+	for (idx = ga->FirstEntry; idx != MAX_NUM_ALLOCATIONS; idx = ga->AllocEntries[idx].Next)
+	{
+		entry = &ga->AllocEntries[idx];
+		if (entry->Id == MAX_NUM_ALLOCATIONS || (entry->Flags & (GA_VERIFY_FLAG | GA_GC_FLAG)) != GA_VERIFY_FLAG)
+			continue;
+		if (first == MAX_NUM_ALLOCATIONS)
+			first = idx;
+		if (entry->Address >= ga->ScrubAddress)
+		{
+			found = idx;
+			break;
+		}
+	}
+	if (found == MAX_NUM_ALLOCATIONS)
+		found = first;
+	if (found == MAX_NUM_ALLOCATIONS)
+		return;
+
+	entry = &ga->AllocEntries[found];
+	ga->ScrubHandle.Id = entry->Id;
+	ga->ScrubHandle.Seq = ga->AllocRefs[entry->Id].Seq;
+	ga->ScrubAddress = entry->Address + entry->Length;
+	ga->ScrubFuture = EVE_CoCmd_memCrc_future(phost, entry->Address, entry->Length);
+#else
+	(void)ga;
+#endif
+}
+
+ESD_CORE_EXPORT bool Esd_GpuAlloc_Verify(Esd_GpuAlloc *ga)
+{
+	EVE_HalContext *phost = Esd_GetHost();
+	uint32_t samples = 0;
+	uint32_t idx;
+	uint32_t i;
+
+	// The copies were discarded with the coprocessor state, keep the source
+	for (i = 0; i < ga->NbMoves; ++i)
+	{
+		Esd_GpuAllocMove *move = &ga->Moves[i];
+		if (move->Source.Id < MAX_NUM_ALLOCATIONS && ga->AllocRefs[move->Source.Id].Seq == move->Source.Seq)
+			ga->AllocEntries[ga->AllocRefs[move->Source.Id].Idx].Flags &= ~GA_MOVING_FLAG;
+		Esd_GpuAlloc_Free(ga, move->Target);
+	}
+	ga->NbMoves = 0;
+
+	// Sample the allocations in use by the last frames first, those are needed right away
+	for (i = 0; i < 2 && samples < GA_VERIFY_SAMPLES; ++i)
+	{
+		for (idx = ga->FirstEntry; idx != MAX_NUM_ALLOCATIONS && samples < GA_VERIFY_SAMPLES; idx = ga->AllocEntries[idx].Next)
 		{
-			// Add the size of the allocated block to the total
-			total += (uint32_t)ga->AllocEntries[idx].Length;
+			Esd_GpuAllocEntry *entry = &ga->AllocEntries[idx];
+			bool recent = (ga->Frame - entry->LastUse) <= 1;
+			uint32_t crc;
+
+			if (entry->Id == MAX_NUM_ALLOCATIONS || !(entry->Flags & GA_VERIFY_FLAG) || recent != (i == 0))
+				continue;
+
+			if (!EVE_CoCmd_memCrc(phost, entry->Address, entry->Length, &crc))
+				return false;
+			if (crc != entry->Crc)
+			{
+				eve_printf_debug("Allocation with handle id %i did not survive the coprocessor reset\n", (int)entry->Id);
+				return false;
+			}
+			++samples;
 		}
 	}
-	return total;
+
+	return true;
+}
+
+// Get total used GPU RAM
+ESD_CORE_EXPORT uint32_t Esd_GpuAlloc_GetTotalUsed(Esd_GpuAlloc *ga)
+{
+	return ga->TotalUsed;
 }
 
 // Get total GPU RAM
@@ -396,19 +994,65 @@ ESD_CORE_EXPORT uint32_t Esd_GpuAlloc_GetTotal(Esd_GpuAlloc *ga)
 	return ga->RamGSize;
 }
 
+ESD_CORE_EXPORT void Esd_GpuAlloc_GetStats(Esd_GpuAlloc *ga, Esd_GpuAllocStats *stats)
+{
+	uint32_t idx;
+
+	memset(stats, 0, sizeof(Esd_GpuAllocStats));
+	stats->Total = ga->RamGSize;
+	stats->Static = ga->StaticSize;
+	stats->Used = ga->TotalUsed;
+	stats->Entries = ga->NbAllocEntries;
+	stats->Allocs = ga->NbAllocs;
+	stats->Frees = ga->NbFrees;
+	stats->Evictions = ga->NbEvictions;
+	stats->Corruptions = ga->NbCorruptions;
+
+	for (idx = ga->FirstEntry; idx != MAX_NUM_ALLOCATIONS; idx = ga->AllocEntries[idx].Next)
+	{
+		Esd_GpuAllocEntry *entry = &ga->AllocEntries[idx];
+		if (entry->Id < MAX_NUM_ALLOCATIONS)
+		{
+			++stats->Allocations;
+			if (entry->Flags & GA_GC_FLAG)
+				++stats->GcAllocations;
+			if (entry->Flags & GA_LOW_FLAG)
+				++stats->LowAllocations;
+			if (entry->Flags & GA_VERIFY_FLAG)
+				++stats->VerifiedAllocations;
+			if (!(entry->Flags & (GA_GC_FLAG | GA_LOW_FLAG)))
+				++stats->PinnedAllocations;
+			if (entry->Flags & GA_STATIC_FLAG)
+				++stats->StaticAllocations;
+		}
+		else if (entry->Length)
+		{
+			++stats->FreeExtents;
+			stats->Free += entry->Length;
+			if (entry->Length > stats->LargestFree)
+				stats->LargestFree = entry->Length;
+		}
+	}
+
+	// Share of the free space that is not part of the largest free extent
+	if (stats->Free)
+		stats->Fragmentation = (uint16_t)(1000 - (uint32_t)(((uint64_t)stats->LargestFree * 1000) / stats->Free));
+}
+
 #ifndef NDEBUG
 ESD_CORE_EXPORT void Esd_GpuAlloc_Print(Esd_GpuAlloc *ga)
 {
 	uint32_t idx;
 	eve_printf_debug("GpuAlloc:\n");
-	for (idx = 0; idx < ga->NbAllocEntries; ++idx)
+	for (idx = ga->FirstEntry; idx != MAX_NUM_ALLOCATIONS; idx = ga->AllocEntries[idx].Next)
 	{
-		eve_printf_debug("%i: id: %i, addr: %li, len: %li, flags: %i\n",
+		eve_printf_debug("%i: id: %i, addr: %li, len: %li, flags: %i, last use: %li\n",
 		    (int)idx,
 		    (int)ga->AllocEntries[idx].Id,
 		    (long int)ga->AllocEntries[idx].Address,
 		    (long int)ga->AllocEntries[idx].Length,
-		    (int)ga->AllocEntries[idx].Flags);
+		    (int)ga->AllocEntries[idx].Flags,
+		    (long int)ga->AllocEntries[idx].LastUse);
 	}
 }
 #endif
@@ -6,7 +6,8 @@ Allocation returns a handle, consisting part of the allocation index and a seque
 Handle can be turned into an address using Esd_GpuAlloc_Get. This call should be repeated each frame,
 since the allocation may be invalidated by a graphics device reset, or the allocation may be moved by a memory
 defragmentation process.
-Supports up to MAX_NUM_ALLOCATIONS simultaneous allocations.
+Supports up to MAX_NUM_ALLOCATIONS simultaneous allocations, including free space entries.
+Free space is kept in segregated lists by power of two size class, so allocation cost does not depend on the number of entries.
 
 The regular use pattern is to call Esd_GpuAlloc_Get using a stored handle during the render stage whenever an image is required.
 This function may be called with an invalid handle. Valid handles may become invalid between render stages when not in use.
@@ -17,6 +18,21 @@ and Esd_GpuAlloc_Get must be called again with the new handle to get the new add
 When not using the GA_GC_FLAG, you must call Esd_GpuAlloc_Free manually when the memory is no longer in use.
 Either allocation option does not guarantee that memory will remain persistently allocated. Graphics memory can be reset whenever necessary.
 
+With GA_ENABLE_RESIDENCY, allocations flagged with GA_GC_FLAG or GA_LOW_FLAG are not freed as soon as they go unused.
+They stay resident, so an image that comes back on screen does not need to be loaded again, and are only evicted,
+least recently used first, when a new allocation does not fit in RAM_G or would exceed the Budget.
+Allocations that were used in the current or the previous frame are never evicted, since the displayed frame may still reference them.
+
+Collected allocations made while an arena is set with Esd_GpuAlloc_SetArena, such as the bitmaps of a page, are tagged
+with it, and placed at the end of the highest free extent that fits rather than at the start of the first one.
+Arena allocations thus stack downwards from the top of RAM_G, apart from the longer lived allocations growing upwards,
+and are not moved by the defragmentation. Esd_GpuAlloc_FreeArena discards them all at once, merging them back into
+one free extent for the next page, instead of leaving them to be evicted one by one among the allocations of the next page.
+
+The first StaticSize bytes of RAM_G hold the build time layout of the fixed assets, assigned by Tools/esd_ramg_layout.py.
+Esd_GpuAlloc_AllocStatic places an allocation at its assigned address in that region, without searching the free lists,
+and such allocations are never collected, evicted or moved. The free lists only cover the remaining RAM_G.
+
 */
 
 #ifndef ESD_GPUALLOC__H
@@ -28,7 +44,21 @@ Either allocation option does not guarantee that memory will remain persistently
 extern "C" {
 #endif
 
+// Maximum number of allocation entries, may be overridden by the project up to 65535
+#ifndef MAX_NUM_ALLOCATIONS
 #define MAX_NUM_ALLOCATIONS 64UL
+#endif
+
+#if (MAX_NUM_ALLOCATIONS > 65535)
+#error MAX_NUM_ALLOCATIONS must be less than 65536
+#elif (MAX_NUM_ALLOCATIONS > 255)
+#define GA_HANDLE_ID_BITS 16
+#else
+#define GA_HANDLE_ID_BITS 8
+#endif
+
+// Number of free list size classes, one per power of two
+#define GA_SIZE_CLASSES 32
 
 // Set the GC flag. This automatically frees the allocation when the USED flag is not set during Update.
 // Using this flag means you must call Esd_GpuAlloc_Get on each frame to keep the allocation alive
@@ -37,12 +67,62 @@ extern "C" {
 // Used flag is set whenever Esd_GpuAlloc_Get is called, reset on every Update
 #define GA_USED_FLAG 2
 
-// Low priority flag is set when the allocation may be discarded when low on RAM (not yet implemented).
+// Low priority flag is set when the allocation may be discarded when low on RAM, least recently used first.
 #define GA_LOW_FLAG 4
 
 // Fixed address flag is used to specify that the allocation cannot be moved during defragmentation (not yet implemented).
 #define GA_FIXED_FLAG 8
 
+// Discard flag is set internally on allocations that must be freed on the next Update, regardless of residency
+#define GA_DISCARD_FLAG 16
+
+// Moving flag is set internally on allocations which are being copied by the defragmentation
+#define GA_MOVING_FLAG 32
+
+// Verify flag is set by Esd_GpuAlloc_Seal on allocations with static contents, which carry a checksum to validate them after a coprocessor fault
+#define GA_VERIFY_FLAG 64
+
+// Static flag is set internally on allocations at a build time address, see Esd_GpuAlloc_AllocStatic
+#define GA_STATIC_FLAG 128
+
+// Arena tag of an allocation, kept in the upper byte of the flags, see Esd_GpuAlloc_SetArena
+#define GA_ARENA_SHIFT 8
+#define GA_ARENA_MASK 0xFF00
+
+// Size of the build time RAM_G layout, defined by the header generated with Tools/esd_ramg_layout.py
+#ifndef GA_STATIC_SIZE
+#ifdef ESD_RAMG_LAYOUT
+#include "Esd_RamGLayout.h"
+#else
+#define GA_STATIC_SIZE 0UL
+#endif
+#endif
+
+// Keep unused GC allocations resident until the space is needed, instead of freeing them on Update
+#ifndef GA_ENABLE_RESIDENCY
+#define GA_ENABLE_RESIDENCY 1
+#endif
+
+// Maximum number of defragmentation copies in flight at once
+#ifndef GA_DEFRAG_MOVES
+#define GA_DEFRAG_MOVES 4
+#endif
+
+// Number of bytes the defragmentation may schedule for copying per frame
+#ifndef GA_DEFRAG_BUDGET
+#define GA_DEFRAG_BUDGET (64UL * 1024UL)
+#endif
+
+// Maximum number of sealed allocations checked by Esd_GpuAlloc_Verify
+#ifndef GA_VERIFY_SAMPLES
+#define GA_VERIFY_SAMPLES 4
+#endif
+
+// Check the sealed persistent allocations against their checksum in the background, see Esd_GpuAlloc_Scrub
+#ifndef GA_ENABLE_SCRUB
+#define GA_ENABLE_SCRUB 1
+#endif
+
 // Address which is returned when the allocation is invalid (~0).
 #define GA_INVALID UINT32_MAX
 
@@ -50,9 +130,9 @@ extern "C" {
 typedef struct
 {
 	/// Id in the allocation reference table
-	uint32_t Id : 8;
+	uint32_t Id : GA_HANDLE_ID_BITS;
 	/// Sequence number used to invalidate handles
-	uint32_t Seq : 24;
+	uint32_t Seq : (32 - GA_HANDLE_ID_BITS);
 
 } Esd_GpuHandle;
 
@@ -65,8 +145,8 @@ typedef struct
 // Internal information about a gpu memory allocation handle
 typedef struct
 {
-	uint32_t Idx : 8;
-	uint32_t Seq : 24;
+	uint32_t Idx : GA_HANDLE_ID_BITS;
+	uint32_t Seq : (32 - GA_HANDLE_ID_BITS);
 
 } Esd_GpuAllocRef;
 
@@ -77,22 +157,101 @@ typedef struct
 	uint32_t Length;
 	uint16_t Id;
 	uint16_t Flags;
+	/// Frame in which the allocation was last used
+	uint32_t LastUse;
+	/// Neighbouring entries in address order
+	uint16_t Prev;
+	uint16_t Next;
+	/// Neighbouring entries in the free list of the same size class, next unused entry when not in the map
+	uint16_t FreePrev;
+	uint16_t FreeNext;
+	/// CMD_MEMCRC of the contents, valid with GA_VERIFY_FLAG
+	uint32_t Crc;
 
 } Esd_GpuAllocEntry;
 
+// Defragmentation copy in flight, handles are swapped once the coprocessor has completed it
+typedef struct
+{
+	Esd_GpuHandle Source;
+	Esd_GpuHandle Target;
+	uint32_t Length;
+
+} Esd_GpuAllocMove;
+
 typedef struct
 {
 	/// Reference to an allocation entry, by allocation Id
 	Esd_GpuAllocRef AllocRefs[MAX_NUM_ALLOCATIONS];
-	/// Allocation map,
+	/// Allocation map, entries are linked in address order
 	Esd_GpuAllocEntry AllocEntries[MAX_NUM_ALLOCATIONS];
 	/// Number of valid alloc entries
 	uint32_t NbAllocEntries;
+	/// Entry at address zero
+	uint16_t FirstEntry;
+	/// First entry which is not part of the allocation map
+	uint16_t UnusedEntry;
+	/// First free space entry of each size class
+	uint16_t FreeLists[GA_SIZE_CLASSES];
+	/// Bit set for each size class with free space entries
+	uint32_t FreeClasses;
+	/// Stack of unused allocation Ids
+	uint16_t FreeIds[MAX_NUM_ALLOCATIONS];
+	uint32_t NbFreeIds;
+	/// Total bytes in use by allocations
+	uint32_t TotalUsed;
+	/// Defragmentation copies in flight
+	Esd_GpuAllocMove Moves[GA_DEFRAG_MOVES];
+	uint32_t NbMoves;
 	/// RAM_G size usable by the allocator. Reset GpuAlloc after modifying
 	uint32_t RamGSize;
+	/// Bytes at the start of RAM_G reserved for allocations at build time addresses. Reset GpuAlloc after modifying
+	uint32_t StaticSize;
+	/// Maximum number of bytes in use by allocations, older resident allocations are evicted to stay within. Zero for no limit
+	uint32_t Budget;
+	/// Frame counter, incremented on every Update
+	uint32_t Frame;
+	/// Running counts of allocations, frees including garbage collection, and evictions, never reset
+	uint32_t NbAllocs;
+	uint32_t NbFrees;
+	uint32_t NbEvictions;
+	/// Allocations found corrupted by Esd_GpuAlloc_Scrub, never reset
+	uint32_t NbCorruptions;
+	/// Allocation of which the CMD_MEMCRC is in flight, and the address to continue scrubbing from
+	Esd_GpuHandle ScrubHandle;
+	uint32_t ScrubAddress;
+	uint16_t ScrubFuture;
+	/// Arena that new collected allocations are tagged with, 0 for none
+	uint8_t Arena;
+	/// Last arena handed out by Esd_GpuAlloc_NewArena
+	uint8_t LastArena;
 
 } Esd_GpuAlloc;
 
+// Snapshot of the allocator state, see Esd_GpuAlloc_GetStats
+typedef struct
+{
+	uint32_t Total; // RAM_G size usable by the allocator
+	uint32_t Static; // Bytes reserved for the build time layout, included in Total
+	uint32_t Used; // Bytes in use by allocations
+	uint32_t Free; // Bytes in free space entries
+	uint32_t LargestFree; // Largest free extent, the largest allocation that fits without eviction
+	uint16_t FreeExtents; // Number of free space entries
+	uint16_t Fragmentation; // Share of the free space outside the largest free extent, in 1/1000
+	uint16_t Entries; // Allocation map entries in use, out of MAX_NUM_ALLOCATIONS
+	uint16_t Allocations;
+	uint16_t GcAllocations; // With GA_GC_FLAG
+	uint16_t LowAllocations; // With GA_LOW_FLAG
+	uint16_t VerifiedAllocations; // Sealed with GA_VERIFY_FLAG
+	uint16_t PinnedAllocations; // Neither GA_GC_FLAG nor GA_LOW_FLAG, only released by Esd_GpuAlloc_Free
+	uint16_t StaticAllocations; // At a build time address, also counted as pinned
+	uint32_t Allocs; // Running counters, see Esd_GpuAlloc
+	uint32_t Frees;
+	uint32_t Evictions;
+	uint32_t Corruptions;
+
+} Esd_GpuAllocStats;
+
 // Initialize or reset gpu ram allocation mechanism
 ESD_CORE_EXPORT void Esd_GpuAlloc_Reset(Esd_GpuAlloc *ga);
 
@@ -102,21 +261,59 @@ ESD_CORE_EXPORT void Esd_GpuAlloc_Update(Esd_GpuAlloc *ga);
 // Allocate a gpu ram block
 ESD_CORE_EXPORT Esd_GpuHandle Esd_GpuAlloc_Alloc(Esd_GpuAlloc *ga, uint32_t size, uint16_t flags);
 
+// Allocate a gpu ram block at a build time address within the first StaticSize bytes, pinned with GA_FIXED_FLAG.
+// Freeing it only invalidates the handle, the address stays reserved for the next allocation
+ESD_CORE_EXPORT Esd_GpuHandle Esd_GpuAlloc_AllocStatic(Esd_GpuAlloc *ga, uint32_t address, uint32_t size);
+
 // Reduce the size of an allocated block
 ESD_CORE_EXPORT bool Esd_GpuAlloc_Truncate(Esd_GpuAlloc *ga, Esd_GpuHandle handle, uint32_t size);
 
 // Free a gpu ram block
 ESD_CORE_EXPORT void Esd_GpuAlloc_Free(Esd_GpuAlloc *ga, Esd_GpuHandle handle);
 
+// Free a gpu ram block through garbage collection, once it is no longer used by a frame
+ESD_CORE_EXPORT void Esd_GpuAlloc_Discard(Esd_GpuAlloc *ga, Esd_GpuHandle handle);
+
+// Get an arena tag which is not in use, never 0
+ESD_CORE_EXPORT uint8_t Esd_GpuAlloc_NewArena(Esd_GpuAlloc *ga);
+
+// Tag the collected allocations made from now on with the arena, 0 to stop tagging. Returns the previous arena
+ESD_CORE_EXPORT uint8_t Esd_GpuAlloc_SetArena(Esd_GpuAlloc *ga, uint8_t arena);
+
+// Discard all allocations of the arena, they are freed on the next Update unless they are still used by the current frame
+ESD_CORE_EXPORT void Esd_GpuAlloc_FreeArena(Esd_GpuAlloc *ga, uint8_t arena);
+
 // Get ram address from handle. Returns ~0 when invalid.
 ESD_CORE_EXPORT uint32_t Esd_GpuAlloc_Get(Esd_GpuAlloc *ga, Esd_GpuHandle handle);
 
+// Check if the allocation is being copied by the defragmentation.
+// Data written to a moving allocation is lost when the copy completes, writers which update an allocation over multiple frames must wait
+ESD_CORE_EXPORT bool Esd_GpuAlloc_IsMoving(Esd_GpuAlloc *ga, Esd_GpuHandle handle);
+
+// Record the checksum of an allocation once its contents are fully loaded and will no longer be written, waits for the coprocessor
+ESD_CORE_EXPORT void Esd_GpuAlloc_Seal(Esd_GpuAlloc *ga, Esd_GpuHandle handle);
+
+// Record a checksum of an allocation which is known ahead, such as from the resource bundle index, without waiting.
+// Ignored unless size covers the whole allocation, the contents may still be loading through the coprocessor
+ESD_CORE_EXPORT void Esd_GpuAlloc_SealCrc(Esd_GpuAlloc *ga, Esd_GpuHandle handle, uint32_t crc, uint32_t size);
+
+// Check one sealed persistent allocation per call with CMD_MEMCRC, without waiting for the coprocessor.
+// The result is picked up by a later call. A corrupted allocation is freed, so its resource is loaded again when next used
+ESD_CORE_EXPORT void Esd_GpuAlloc_Scrub(Esd_GpuAlloc *ga);
+
+// Check whether the allocations survived a coprocessor reset, by comparing the checksum of a sample of the sealed allocations.
+// Also drops the defragmentation copies which were in flight. Returns false when RAM_G contents were lost
+ESD_CORE_EXPORT bool Esd_GpuAlloc_Verify(Esd_GpuAlloc *ga);
+
 // Get total used GPU RAM
 ESD_CORE_EXPORT uint32_t Esd_GpuAlloc_GetTotalUsed(Esd_GpuAlloc *ga);
 
 // Get total GPU RAM
 ESD_CORE_EXPORT uint32_t Esd_GpuAlloc_GetTotal(Esd_GpuAlloc *ga);
 
+// Get a snapshot of the usage and fragmentation of GPU RAM, walks the allocation map
+ESD_CORE_EXPORT void Esd_GpuAlloc_GetStats(Esd_GpuAlloc *ga, Esd_GpuAllocStats *stats);
+
 #ifndef NDEBUG
 ESD_CORE_EXPORT void Esd_GpuAlloc_Print(Esd_GpuAlloc *ga);
 #else
@@ -0,0 +1,225 @@
+
+#include "Esd_HitTest.h"
+#include "Esd_Context.h"
+#include "Esd_TouchTag.h"
+
+#define ESD_HITTEST_NONE 0xFFFF
+
+typedef struct
+{
+	Esd_HitTarget *Target;
+	uint16_t Next; // Next entry in the same cell
+} Esd_HitEntry;
+
+static Esd_HitTarget *s_Targets = NULL;
+static uint32_t s_NextOrder = 0;
+
+// Grid of cells over the screen, each the head of a chain of entries
+static uint16_t s_Cells[ESD_HITTEST_GRID * ESD_HITTEST_GRID];
+static Esd_HitEntry s_Entries[ESD_HITTEST_ENTRIES];
+static int16_t s_CellWidth = 1;
+static int16_t s_CellHeight = 1;
+static bool s_Dirty = true;
+static bool s_Overflow = false; // Not every target is in the grid, check them all
+
+// Target the current touch started on
+static Esd_HitTarget *s_Down = NULL;
+static bool s_Touching = false;
+
+static inline bool Esd_HitTest_Contains(Esd_Rect16 rect, int16_t x, int16_t y)
+{
+	return x >= rect.X && y >= rect.Y && x < rect.X + rect.Width && y < rect.Y + rect.Height;
+}
+
+static inline int Esd_HitTest_Cell(int16_t v, int16_t cellSize)
+{
+	int cell = v / cellSize;
+	return cell < 0 ? 0 : (cell >= ESD_HITTEST_GRID ? (ESD_HITTEST_GRID - 1) : cell);
+}
+
+static void Esd_HitTest_Rebuild()
+{
+	EVE_HalContext *phost = Esd_GetHost();
+	Esd_HitTarget *target;
+	uint16_t nbEntries = 0;
+	int i;
+
+	s_CellWidth = (int16_t)((phost->Width + ESD_HITTEST_GRID - 1) >> ESD_HITTEST_GRID_BITS);
+	s_CellHeight = (int16_t)((phost->Height + ESD_HITTEST_GRID - 1) >> ESD_HITTEST_GRID_BITS);
+	if (s_CellWidth < 1)
+		s_CellWidth = 1;
+	if (s_CellHeight < 1)
+		s_CellHeight = 1;
+
+	for (i = 0; i < ESD_HITTEST_GRID * ESD_HITTEST_GRID; ++i)
+		s_Cells[i] = ESD_HITTEST_NONE;
+	s_Overflow = false;
+	s_Dirty = false;
+
+	for (target = s_Targets; target; target = target->Next)
+	{
+		Esd_Rect16 rect = target->Rect;
+		int x0, y0, x1, y1, x, y;
+
+		if (rect.Width <= 0 || rect.Height <= 0)
+			continue;
+
+		// Targets partly off screen go into the border cells, which are still checked against the rect
+		x0 = Esd_HitTest_Cell(rect.X, s_CellWidth);
+		y0 = Esd_HitTest_Cell(rect.Y, s_CellHeight);
+		x1 = Esd_HitTest_Cell(rect.X + rect.Width - 1, s_CellWidth);
+		y1 = Esd_HitTest_Cell(rect.Y + rect.Height - 1, s_CellHeight);
+		for (y = y0; y <= y1; ++y)
+		{
+			for (x = x0; x <= x1; ++x)
+			{
+				uint16_t *cell = &s_Cells[(y << ESD_HITTEST_GRID_BITS) + x];
+				if (nbEntries == ESD_HITTEST_ENTRIES)
+				{
+					eve_printf_debug_once("Hit test grid is full, increase ESD_HITTEST_ENTRIES\n");
+					s_Overflow = true;
+					return;
+				}
+				s_Entries[nbEntries].Target = target;
+				s_Entries[nbEntries].Next = *cell;
+				*cell = nbEntries++;
+			}
+		}
+	}
+}
+
+ESD_CORE_EXPORT void Esd_HitTarget__Initializer(Esd_HitTarget *target)
+{
+	target->Owner = NULL;
+	target->Down = Esd_Noop;
+	target->Up = Esd_Noop;
+	target->Tap = Esd_Noop;
+	target->Rect.X = 0;
+	target->Rect.Y = 0;
+	target->Rect.Width = 0;
+	target->Rect.Height = 0;
+	target->Next = NULL;
+	target->Previous = NULL;
+	target->Order = 0;
+	target->Set = false;
+}
+
+ESD_CORE_EXPORT void Esd_HitTest_Add(Esd_HitTarget *target)
+{
+	if (target->Previous)
+		Esd_HitTest_Remove(target);
+
+	target->Next = s_Targets;
+	if (s_Targets)
+		s_Targets->Previous = &target->Next;
+	target->Previous = &s_Targets;
+	s_Targets = target;
+	target->Order = s_NextOrder++;
+	s_Dirty = true;
+}
+
+ESD_CORE_EXPORT void Esd_HitTest_Remove(Esd_HitTarget *target)
+{
+	if (!target->Previous)
+		return;
+
+	if (s_Down == target)
+	{
+		s_Down = NULL;
+		target->Set = false;
+		target->Up(target->Owner);
+	}
+
+	*target->Previous = target->Next;
+	if (target->Next)
+		target->Next->Previous = target->Previous;
+	target->Next = NULL;
+	target->Previous = NULL;
+	s_Dirty = true;
+}
+
+ESD_CORE_EXPORT void Esd_HitTest_SetRect(Esd_HitTarget *target, Esd_Rect16 rect)
+{
+	if (target->Rect.X == rect.X && target->Rect.Y == rect.Y
+	    && target->Rect.Width == rect.Width && target->Rect.Height == rect.Height)
+		return;
+
+	target->Rect = rect;
+	if (target->Previous)
+		s_Dirty = true;
+}
+
+ESD_CORE_EXPORT Esd_HitTarget *Esd_HitTest_Find(int16_t x, int16_t y)
+{
+	Esd_HitTarget *found = NULL;
+
+	if (!s_Targets)
+		return NULL;
+	if (s_Dirty)
+		Esd_HitTest_Rebuild();
+
+	if (s_Overflow)
+	{
+		Esd_HitTarget *target;
+		for (target = s_Targets; target; target = target->Next)
+		{
+			if (Esd_HitTest_Contains(target->Rect, x, y) && (!found || target->Order > found->Order))
+				found = target;
+		}
+	}
+	else
+	{
+		uint16_t idx = s_Cells[(Esd_HitTest_Cell(y, s_CellHeight) << ESD_HITTEST_GRID_BITS) + Esd_HitTest_Cell(x, s_CellWidth)];
+		while (idx != ESD_HITTEST_NONE)
+		{
+			Esd_HitTarget *target = s_Entries[idx].Target;
+			if (Esd_HitTest_Contains(target->Rect, x, y) && (!found || target->Order > found->Order))
+				found = target;
+			idx = s_Entries[idx].Next;
+		}
+	}
+
+	return found;
+}
+
+ESD_CORE_EXPORT bool Esd_HitTest_Inside(Esd_HitTarget *target)
+{
+	return target->Set && Esd_HitTest_Contains(target->Rect, Esd_TouchTag_TouchX(NULL), Esd_TouchTag_TouchY(NULL));
+}
+
+ESD_CORE_EXPORT void Esd_HitTest_Update()
+{
+	bool touching;
+
+	if (!s_Targets && !s_Touching)
+		return;
+
+	touching = !!(Esd_TouchTag_Contacts() & 0x01);
+	if (touching && !s_Touching)
+	{
+		// Tagged widgets take the touch, only touches starting outside of them are routed here
+		if (Esd_TouchTag_CurrentTag(NULL) == 255)
+		{
+			s_Down = Esd_HitTest_Find(Esd_TouchTag_TouchX(NULL), Esd_TouchTag_TouchY(NULL));
+			if (s_Down)
+			{
+				s_Down->Set = true;
+				s_Down->Down(s_Down->Owner);
+			}
+		}
+	}
+	else if (!touching && s_Touching && s_Down)
+	{
+		// Touch position stays at the last touched point after release
+		Esd_HitTarget *target = s_Down;
+		bool inside = Esd_HitTest_Contains(target->Rect, Esd_TouchTag_TouchX(NULL), Esd_TouchTag_TouchY(NULL));
+		s_Down = NULL;
+		target->Set = false;
+		target->Up(target->Owner);
+		if (inside)
+			target->Tap(target->Owner);
+	}
+	s_Touching = touching;
+}
+
+/* end of file */
@@ -0,0 +1,86 @@
+
+#ifndef ESD_HITTEST__H
+#define ESD_HITTEST__H
+
+#include "Esd_Base.h"
+#include "Esd_Math.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+Host side hit testing.
+Touch targets registered here are found from the touch position through a grid of buckets
+over the screen, instead of each target rendering its own touch tag. Targets are drawn without
+a tag, touches which start on the clear tag 255 are routed to the topmost target under the
+touch point, tagged widgets keep taking precedence. The grid is rebuilt on the next touch after
+a target was added, removed or moved, so the cost of a touch does not depend on the number of
+targets. Intended for lists and grids with more rows than there are touch tags.
+*/
+
+// Number of target and grid cell pairs in the grid, a target is in every cell it overlaps.
+// When exceeded, hit testing falls back to checking every target
+#ifndef ESD_HITTEST_ENTRIES
+#define ESD_HITTEST_ENTRIES 1024
+#endif
+
+// Number of grid cells per axis as a power of two, spread over the screen
+#ifndef ESD_HITTEST_GRID_BITS
+#define ESD_HITTEST_GRID_BITS 4
+#endif
+#define ESD_HITTEST_GRID (1 << ESD_HITTEST_GRID_BITS)
+
+#if (ESD_HITTEST_ENTRIES > 65535)
+#error ESD_HITTEST_ENTRIES must be less than 65536
+#endif
+
+typedef struct Esd_HitTarget
+{
+	// Callback
+	void *Owner;
+
+	// Called when a touch starts on this target
+	void (*Down)(void *context);
+
+	// Called when that touch ends, wherever it ended. One Up is guaranteed to be called for every Down
+	void (*Up)(void *context);
+
+	// Called after Up when the touch also ended on this target
+	void (*Tap)(void *context);
+
+	Esd_Rect16 Rect; // Global rect, set with Esd_HitTest_SetRect
+	struct Esd_HitTarget *Next;
+	struct Esd_HitTarget **Previous; // Pointer linking to this target, NULL when not added
+	uint32_t Order; // Targets added later are on top
+	bool Set; // Touch started on this target and has not ended yet
+
+} Esd_HitTarget;
+
+ESD_CORE_EXPORT void Esd_HitTarget__Initializer(Esd_HitTarget *target);
+
+// Register the target, it is placed on top of the targets added before
+ESD_CORE_EXPORT void Esd_HitTest_Add(Esd_HitTarget *target);
+
+// Unregister the target, calls Up when it is being touched
+ESD_CORE_EXPORT void Esd_HitTest_Remove(Esd_HitTarget *target);
+
+// Move the target, does not touch the grid when the rect is unchanged
+ESD_CORE_EXPORT void Esd_HitTest_SetRect(Esd_HitTarget *target, Esd_Rect16 rect);
+
+// Topmost target at the given screen position, NULL when there is none
+ESD_CORE_EXPORT Esd_HitTarget *Esd_HitTest_Find(int16_t x, int16_t y);
+
+// Set while the touch which started on the target is on it
+ESD_CORE_EXPORT bool Esd_HitTest_Inside(Esd_HitTarget *target);
+
+// Route the touch read by Esd_TouchTag_Update, called from Esd_Update
+ESD_CORE_EXPORT void Esd_HitTest_Update();
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* #ifndef ESD_HITTEST__H */
+
+/* end of file */
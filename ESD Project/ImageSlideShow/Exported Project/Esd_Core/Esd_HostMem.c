@@ -0,0 +1,130 @@
+
+#include "Esd_HostMem.h"
+
+#if ESD_HOSTMEM
+
+#include "Esd_Profile.h"
+
+#include <stdlib.h>
+#include <string.h>
+#if defined(FT9XX_PLATFORM)
+#include <unistd.h>
+#endif
+
+// Keeps the block aligned for any type
+typedef union
+{
+	size_t Size;
+	uint64_t Align;
+} Esd_HostMemHeader;
+
+static uint32_t s_HeapBytes = 0;
+static uint32_t s_HeapPeak = 0;
+static uint32_t s_HeapBlocks = 0;
+static uint32_t s_Allocs = 0;
+static uint32_t s_Frees = 0;
+static uint32_t s_Failed = 0;
+
+#if defined(FT9XX_PLATFORM)
+static uint32_t *s_StackFloor = NULL; // Lowest painted word
+static uint32_t *s_StackTop = NULL; // Stack pointer of the caller at paint time
+#endif
+
+ESD_CORE_EXPORT void *Esd_HostMem_Alloc(size_t size)
+{
+	Esd_HostMemHeader *header = (Esd_HostMemHeader *)malloc(sizeof(Esd_HostMemHeader) + size);
+	if (!header)
+	{
+		++s_Failed;
+		eve_printf_debug("Host allocation of %u bytes failed, %u in use\n", (unsigned int)size, (unsigned int)s_HeapBytes);
+		return NULL;
+	}
+	header->Size = size;
+	s_HeapBytes += (uint32_t)size;
+	if (s_HeapBytes > s_HeapPeak)
+		s_HeapPeak = s_HeapBytes;
+	++s_HeapBlocks;
+	++s_Allocs;
+	return header + 1;
+}
+
+ESD_CORE_EXPORT void Esd_HostMem_Free(void *ptr)
+{
+	Esd_HostMemHeader *header;
+	if (!ptr)
+		return;
+	header = (Esd_HostMemHeader *)ptr - 1;
+	eve_assert(s_HeapBytes >= header->Size && s_HeapBlocks);
+	s_HeapBytes -= (uint32_t)header->Size;
+	--s_HeapBlocks;
+	++s_Frees;
+	free(header);
+}
+
+ESD_CORE_EXPORT void Esd_HostMem_PaintStack()
+{
+#if defined(FT9XX_PLATFORM)
+	volatile uint32_t marker = 0;
+	uint32_t *top = (uint32_t *)((uintptr_t)&marker & ~(uintptr_t)3);
+	uint32_t *floor = (uint32_t *)(((uintptr_t)sbrk(0) + ESD_HOSTMEM_HEAP_RESERVE + 3) & ~(uintptr_t)3);
+	volatile uint32_t *p;
+
+	// Leave the frame of this function alone
+	if (floor >= top - 64)
+		return;
+	for (p = floor; p < (volatile uint32_t *)(top - 64); ++p)
+		*p = ESD_HOSTMEM_PAINT;
+	s_StackFloor = floor;
+	s_StackTop = top;
+	eve_printf_debug("Painted %u bytes of stack\n", (unsigned int)((top - floor) << 2));
+#endif
+}
+
+ESD_CORE_EXPORT uint32_t Esd_HostMem_StackHighWater()
+{
+#if defined(FT9XX_PLATFORM)
+	uint32_t *heapEnd = (uint32_t *)(((uintptr_t)sbrk(0) + 3) & ~(uintptr_t)3);
+	uint32_t *p = s_StackFloor > heapEnd ? s_StackFloor : heapEnd;
+
+	if (!s_StackFloor)
+		return 0;
+	while (p < s_StackTop && *p == ESD_HOSTMEM_PAINT)
+		++p;
+	return (uint32_t)((s_StackTop - p) << 2);
+#else
+	return 0;
+#endif
+}
+
+ESD_CORE_EXPORT void Esd_HostMem_Snapshot(Esd_HostMemSummary *summary)
+{
+	memset(summary, 0, sizeof(Esd_HostMemSummary));
+	summary->Magic = ESD_HOSTMEM_MAGIC;
+	summary->HeapBytes = s_HeapBytes;
+	summary->HeapPeak = s_HeapPeak;
+	summary->HeapBlocks = s_HeapBlocks;
+	summary->Allocs = s_Allocs;
+	summary->Frees = s_Frees;
+	summary->Failed = s_Failed;
+#if defined(FT9XX_PLATFORM)
+	if (s_StackFloor)
+		summary->StackSize = (uint32_t)((s_StackTop - s_StackFloor) << 2);
+#endif
+	summary->StackHighWater = Esd_HostMem_StackHighWater();
+}
+
+ESD_CORE_EXPORT void Esd_HostMem_Report(uint32_t frame)
+{
+#if ESD_PROFILE
+	Esd_HostMemSummary summary;
+	if (!Esd_ProfileSink)
+		return;
+	Esd_HostMem_Snapshot(&summary);
+	summary.Frame = frame;
+	Esd_ProfileSink((const uint8_t *)&summary, sizeof(summary));
+#endif
+}
+
+#endif /* #if ESD_HOSTMEM */
+
+/* end of file */
@@ -0,0 +1,74 @@
+
+#ifndef ESD_HOSTMEM__H
+#define ESD_HOSTMEM__H
+
+#include "Esd_Base.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+Host heap and stack usage.
+With ESD_HOSTMEM, esd_malloc, the blocks of Esd_MemoryPool and ff_memalloc of FatFS go through
+Esd_HostMem_Alloc, which prefixes each block with its size to count the bytes in use, the peak,
+and the number of allocations. On FT9XX, Esd_Initialize paints the free stack below its caller
+with ESD_HOSTMEM_PAINT, and Esd_HostMem_StackHighWater finds the deepest word that was overwritten.
+The heap grows into the same RAM, so the scan starts at the current heap end.
+At the end of every profiler window an Esd_HostMemSummary follows the profile summary to Esd_ProfileSink.
+Enabled by default in debug builds, see ESD_HOSTMEM in Esd_Base.h.
+*/
+
+#define ESD_HOSTMEM_MAGIC 0x54534845UL // "EHST"
+
+// Stack fill pattern
+#define ESD_HOSTMEM_PAINT 0xC5C5C5C5UL
+
+// Bytes above the heap end at boot left unpainted, for the heap to grow into
+#ifndef ESD_HOSTMEM_HEAP_RESERVE
+#define ESD_HOSTMEM_HEAP_RESERVE 4096
+#endif
+
+// Binary summary, little endian
+typedef struct
+{
+	uint32_t Magic; // ESD_HOSTMEM_MAGIC
+	uint32_t Frame;
+	uint32_t HeapBytes; // Requested bytes currently allocated
+	uint32_t HeapPeak;
+	uint32_t HeapBlocks; // Blocks currently allocated
+	uint32_t Allocs; // Since boot
+	uint32_t Frees;
+	uint32_t Failed; // Allocations that returned NULL
+	uint32_t StackSize; // Painted at boot, 0 when not measured
+	uint32_t StackHighWater; // Deepest stack use below the caller of Esd_Initialize
+} Esd_HostMemSummary;
+
+#if ESD_HOSTMEM
+
+// Paints the unused stack, call before interrupts are enabled
+ESD_CORE_EXPORT void Esd_HostMem_PaintStack();
+
+// Deepest stack use in bytes since the stack was painted, 0 when not measured
+ESD_CORE_EXPORT uint32_t Esd_HostMem_StackHighWater();
+
+ESD_CORE_EXPORT void Esd_HostMem_Snapshot(Esd_HostMemSummary *summary);
+
+// Passes a summary to Esd_ProfileSink, called at the end of every profiler window
+ESD_CORE_EXPORT void Esd_HostMem_Report(uint32_t frame);
+
+#else
+
+#define Esd_HostMem_PaintStack() eve_noop()
+#define Esd_HostMem_StackHighWater() (0)
+#define Esd_HostMem_Report(frame) eve_noop()
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* #ifndef ESD_HOSTMEM__H */
+
+/* end of file */
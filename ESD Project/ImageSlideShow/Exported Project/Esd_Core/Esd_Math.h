@@ -127,6 +127,50 @@ ESD_FUNCTION(Esd_Float_To_Int, Type = int32_t, DisplayName = "Float to Int", Cat
 ESD_PARAMETER(value, Type = float, Default = 0)
 static inline int Esd_Float_To_Int(float value) { return (int)value; }
 
+/*
+Fixed point trigonometry, the FT9XX has no FPU and soft-float sin and cos are slow.
+Angles are in 1/65536 of a turn, as with CMD_ROTATE, and wrap around naturally.
+Sine and cosine return Q16 values, 65536 being 1.0, from a quarter wave table
+with linear interpolation, accurate to within 2 LSB.
+*/
+
+// Number of angle units in a turn
+#define ESD_ANGLE_TURN 65536L
+
+// Converts integer degrees to angle units
+#define ESD_ANGLE_DEG(deg) ((uint16_t)(((int32_t)(deg) * ESD_ANGLE_TURN) / 360))
+
+// Converts degrees to angle units, for callers that still work in float
+static inline uint16_t Esd_Math_DegToAngle(float deg) { return (uint16_t)(int32_t)(deg * (65536.0f / 360.0f)); }
+
+ESD_CORE_EXPORT int32_t Esd_Math_SinQ16(uint16_t angle);
+static inline int32_t Esd_Math_CosQ16(uint16_t angle) { return Esd_Math_SinQ16((uint16_t)(angle + (ESD_ANGLE_TURN >> 2))); }
+
+// Angle of the vector (x, y) counter-clockwise from the positive x axis with y upwards, 0 for a zero vector
+ESD_CORE_EXPORT uint16_t Esd_Math_Atan2(int32_t y, int32_t x);
+
+/*
+Bitmap transform matrix built on the host, for BITMAP_TRANSFORM_A to F.
+Operations match CMD_TRANSLATE, CMD_SCALE and CMD_ROTATE and are applied in the same order,
+the matrix holds the inverse which CMD_SETMATRIX would write, mapping screen pixels relative
+to the vertex to bitmap texels. All values are Q16.
+*/
+typedef struct
+{
+	int32_t A, B, C;
+	int32_t D, E, F;
+} Esd_Transform;
+
+ESD_CORE_EXPORT void Esd_Transform_Identity(Esd_Transform *t);
+ESD_CORE_EXPORT void Esd_Transform_Translate(Esd_Transform *t, int32_t tx, int32_t ty);
+ESD_CORE_EXPORT void Esd_Transform_Scale(Esd_Transform *t, int32_t sx, int32_t sy);
+ESD_CORE_EXPORT void Esd_Transform_Rotate(Esd_Transform *t, uint16_t angle);
+
+#if ESD_MATH_BENCHMARK
+// Prints the time taken by the table functions against the C library, on the debug output
+ESD_CORE_EXPORT void Esd_Math_Benchmark();
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -50,6 +50,9 @@
 		mm->free_list->alloc_mem = mem_sz;        \
 		mm->free_list->prev = NULL;               \
 		mm->free_list->next = NULL;               \
+		mm->free_list->owner = mm;                \
+		*(Esd_MpChunk **)(mm->start + mem_sz      \
+		    - MP_CHUNKEND) = mm->free_list;       \
 		mm->alloc_list = NULL;                    \
 	} while (0)
 
@@ -80,6 +83,76 @@
 		}                                \
 	} while (0)
 
+#if ESD_MEMORYPOOL_SLAB
+// Slab objects are preceded by a tag word in place of the is_free word of a chunk header
+#define MP_SLAB_TAG (mem_size_t)0x51AB0000
+#define MP_SLAB_TAG_SIZE sizeof(mem_size_t)
+#define MP_SLAB_SLOT(_cls) ((MP_SLAB_MIN_SIZE << (_cls)) + MP_SLAB_TAG_SIZE)
+
+static void init_slabs(Esd_MemoryPool *mp)
+{
+	int cls;
+	for (cls = 0; cls < MP_SLAB_CLASSES; ++cls)
+	{
+		Esd_MpSlab *slab = &mp->slab[cls];
+		slab->obj_size = MP_SLAB_MIN_SIZE << cls;
+		slab->free_list = NULL;
+		slab->pages = 0;
+		slab->in_use = 0;
+		slab->peak = 0;
+		slab->alloc_count = 0;
+	}
+}
+
+static void *slab_alloc(Esd_MemoryPool *mp, mem_size_t wantsize)
+{
+	int cls = 0;
+	while ((MP_SLAB_MIN_SIZE << cls) < wantsize)
+		++cls;
+
+	Esd_MpSlab *slab = &mp->slab[cls];
+	if (!slab->free_list)
+	{
+		// Carve a new page from the pool into objects of this class
+		mem_size_t slot = MP_SLAB_SLOT(cls);
+		mem_size_t count = ESD_MEMORYPOOL_SLAB_PAGE / slot;
+		char *page = (char *)Esd_MemoryPool_Alloc(mp, count * slot);
+		if (!page)
+			return NULL;
+		while (count--)
+		{
+			mem_size_t *tag = (mem_size_t *)(page + count * slot);
+			*tag = MP_SLAB_TAG + cls;
+			*(void **)(tag + 1) = slab->free_list;
+			slab->free_list = (void *)(tag + 1);
+		}
+		++slab->pages;
+	}
+
+	void *p = slab->free_list;
+	slab->free_list = *(void **)p;
+	++slab->alloc_count;
+	if (++slab->in_use > slab->peak)
+		slab->peak = slab->in_use;
+	return p;
+}
+
+static void slab_free(Esd_MemoryPool *mp, void *p, int cls)
+{
+	Esd_MpSlab *slab = &mp->slab[cls];
+	*(void **)p = slab->free_list;
+	slab->free_list = p;
+	--slab->in_use;
+}
+
+const Esd_MpSlab *Esd_MemoryPool_GetSlab(Esd_MemoryPool *mp, int cls)
+{
+	if (!mp || cls < 0 || cls >= MP_SLAB_CLASSES)
+		return NULL;
+	return &mp->slab[cls];
+}
+#endif
+
 #if 0
 void esd_get_memory_list_count(Esd_MemoryPool *mp, mem_size_t *mlist_len)
 {
@@ -124,7 +197,7 @@ int esd_get_memory_id(Esd_MpMemory *mm)
 
 static Esd_MpMemory *extend_memory_list(Esd_MemoryPool *mp, mem_size_t new_mem_sz)
 {
-	char *s = (char *)malloc(sizeof(Esd_MpMemory) + new_mem_sz * sizeof(char));
+	char *s = (char *)esd_heap_alloc(sizeof(Esd_MpMemory) + new_mem_sz * sizeof(char));
 	if (!s)
 		return NULL;
 
@@ -140,39 +213,28 @@ static Esd_MpMemory *extend_memory_list(Esd_MemoryPool *mp, mem_size_t new_mem_s
 	return mm;
 }
 
-static Esd_MpMemory *find_memory_list(Esd_MemoryPool *mp, void *p)
+// Merge a chunk which has just been freed with its free neighbours, the previous chunk is found through its end tag
+static int merge_free_chunk(Esd_MpMemory *mm, Esd_MpChunk *c)
 {
-	Esd_MpMemory *tmp = mp->mlist;
-	while (tmp)
+	Esd_MpChunk *p0 = (Esd_MpChunk *)((char *)c + c->alloc_mem);
+	if ((char *)p0 < mm->start + mm->mem_pool_size && p0->is_free)
 	{
-		if (tmp->start <= (char *)p && tmp->start + mp->mem_pool_size > (char *)p)
-			break;
-		tmp = tmp->next;
-	}
-
-	return tmp;
-}
-
-static int merge_free_chunk(Esd_MemoryPool *mp, Esd_MpMemory *mm, Esd_MpChunk *c)
-{
-	Esd_MpChunk *p0 = c, *p1 = c;
-	while (p0->is_free)
-	{
-		p1 = p0;
-		if ((char *)p0 - MP_CHUNKEND - MP_CHUNKHEADER <= mm->start)
-			break;
-		p0 = *(Esd_MpChunk **)((char *)p0 - MP_CHUNKEND);
+		MP_DLINKLIST_DEL(mm->free_list, p0);
+		c->alloc_mem += p0->alloc_mem;
 	}
 
-	p0 = (Esd_MpChunk *)((char *)p1 + p1->alloc_mem);
-	while ((char *)p0 < mm->start + mp->mem_pool_size && p0->is_free)
+	if ((char *)c > mm->start)
 	{
-		MP_DLINKLIST_DEL(mm->free_list, p0);
-		p1->alloc_mem += p0->alloc_mem;
-		p0 = (Esd_MpChunk *)((char *)p0 + p0->alloc_mem);
+		p0 = *(Esd_MpChunk **)((char *)c - MP_CHUNKEND);
+		if (p0->is_free)
+		{
+			MP_DLINKLIST_DEL(mm->free_list, c);
+			p0->alloc_mem += c->alloc_mem;
+			c = p0;
+		}
 	}
 
-	*(Esd_MpChunk **)((char *)p1 + p1->alloc_mem - MP_CHUNKEND) = p1;
+	*(Esd_MpChunk **)((char *)c + c->alloc_mem - MP_CHUNKEND) = c;
 	return 0;
 }
 
@@ -184,7 +246,7 @@ Esd_MemoryPool *Esd_MemoryPool_Init(mem_size_t maxmempoolsize, mem_size_t mempoo
 		eve_printf("[Esd MemoryPool] MemPool Init ERROR! Mempoolsize is too big!\n");
 		return NULL;
 	}
-	Esd_MemoryPool *mp = (Esd_MemoryPool *)malloc(sizeof(Esd_MemoryPool));
+	Esd_MemoryPool *mp = (Esd_MemoryPool *)esd_heap_alloc(sizeof(Esd_MemoryPool));
 	eve_printf_debug("[Esd MemoryPool] assign size %d\n", sizeof(Esd_MemoryPool));
 	if (!mp)
 	{
@@ -194,6 +256,7 @@ Esd_MemoryPool *Esd_MemoryPool_Init(mem_size_t maxmempoolsize, mem_size_t mempoo
 	eve_printf_debug("[Esd MemoryPool] address of mp is %p\n", mp);
 
 	mp->last_id = 0;
+	mp->auto_extend = 0;
 	if (mempoolsize < maxmempoolsize)
 	{
 		mp->auto_extend = 1;
@@ -202,7 +265,7 @@ Esd_MemoryPool *Esd_MemoryPool_Init(mem_size_t maxmempoolsize, mem_size_t mempoo
 	mp->max_mem_pool_size = maxmempoolsize;
 	mp->total_mem_pool_size = mp->mem_pool_size = mempoolsize;
 
-	char *s = (char *)malloc(sizeof(Esd_MpMemory) + sizeof(char) * mp->mem_pool_size);
+	char *s = (char *)esd_heap_alloc(sizeof(Esd_MpMemory) + sizeof(char) * mp->mem_pool_size);
 	if (!s)
 	{
 		eve_printf("[Esd MemoryPool] MemPool Init ERROR! Assign s fail\n");
@@ -214,6 +277,9 @@ Esd_MemoryPool *Esd_MemoryPool_Init(mem_size_t maxmempoolsize, mem_size_t mempoo
 	MP_INIT_MEMORY_STRUCT(mp->mlist, mp->mem_pool_size);
 	mp->mlist->next = NULL;
 	mp->mlist->id = mp->last_id++;
+#if ESD_MEMORYPOOL_SLAB
+	init_slabs(mp);
+#endif
 
 	return mp;
 }
@@ -222,8 +288,11 @@ void *Esd_MemoryPool_Alloc(Esd_MemoryPool *mp, mem_size_t wantsize)
 {
 	if (wantsize <= 0)
 		return NULL;
+#if ESD_MEMORYPOOL_SLAB
+	if (wantsize <= MP_SLAB_MAX_SIZE)
+		return slab_alloc(mp, wantsize);
+#endif
 	mem_size_t total_needed_size = MP_ALIGN_SIZE(wantsize + MP_CHUNKHEADER + MP_CHUNKEND);
-	eve_printf_debug("[Esd MemoryPool] total needed size %llu \n", total_needed_size);
 	if (total_needed_size > mp->max_mem_pool_size)
 	// if (total_needed_size > mp->mem_pool_size)
 	{
@@ -238,8 +307,8 @@ FIND_FREE_CHUNK:
 	mm = mp->mlist;
 	while (mm)
 	{
-		eve_printf_debug_once("[Esd MemoryPool] mem_pool_size %llu, alloc size %llu\n", mp->mem_pool_size, mm->alloc_mem);
-		if (mp->mem_pool_size - mm->alloc_mem < total_needed_size)
+		eve_printf_debug_once("[Esd MemoryPool] mem_pool_size %d, alloc size %d\n", (int)mp->mem_pool_size, (int)mm->alloc_mem);
+		if (mm->mem_pool_size - mm->alloc_mem < total_needed_size)
 		{
 			mm = mm->next;
 			continue;
@@ -250,7 +319,6 @@ FIND_FREE_CHUNK:
 
 		while (_free)
 		{
-			eve_printf_debug("[Esd MemoryPool] alloc mem is %llu\n", _free->alloc_mem);
 			if (_free->alloc_mem >= total_needed_size)
 			{
 				// if left size is big enough, divide the left memory
@@ -284,7 +352,6 @@ FIND_FREE_CHUNK:
 				// or alloc all left
 				else
 				{
-					eve_printf_debug("[Esd MemoryPool] alloc all left\n");
 					_not_free = _free;
 					MP_DLINKLIST_DEL(mm->free_list, _not_free);
 					_not_free->is_free = 0;
@@ -337,21 +404,25 @@ int Esd_MemoryPool_Free(Esd_MemoryPool *mp, void *p)
 {
 	if (p == NULL || mp == NULL)
 		return 1;
-	Esd_MpMemory *mm = mp->mlist;
-	if (mp->auto_extend)
-		mm = find_memory_list(mp, p);
-
+#if ESD_MEMORYPOOL_SLAB
+	mem_size_t tag = *(mem_size_t *)((char *)p - MP_SLAB_TAG_SIZE);
+	if (tag >= MP_SLAB_TAG && tag < MP_SLAB_TAG + MP_SLAB_CLASSES)
+	{
+		slab_free(mp, p, (int)(tag - MP_SLAB_TAG));
+		return 0;
+	}
+#endif
 	Esd_MpChunk *ck = (Esd_MpChunk *)((char *)p - MP_CHUNKHEADER);
+	Esd_MpMemory *mm = ck->owner;
 
 	MP_DLINKLIST_DEL(mm->alloc_list, ck);
 	MP_DLINKLIST_INS_FRT(mm->free_list, ck);
 	ck->is_free = 1;
 
 	mm->alloc_mem -= ck->alloc_mem;
-	eve_printf_debug("Free memory %d\n", (int)ck->alloc_mem);
 	mm->alloc_prog_mem -= (ck->alloc_mem - MP_CHUNKHEADER - MP_CHUNKEND);
 
-	return merge_free_chunk(mp, mm, ck);
+	return merge_free_chunk(mm, ck);
 }
 
 Esd_MemoryPool *Esd_MemoryPool_Clear(Esd_MemoryPool *mp)
@@ -364,6 +435,9 @@ Esd_MemoryPool *Esd_MemoryPool_Clear(Esd_MemoryPool *mp)
 		MP_INIT_MEMORY_STRUCT(mm, mm->mem_pool_size);
 		mm = mm->next;
 	}
+#if ESD_MEMORYPOOL_SLAB
+	init_slabs(mp);
+#endif
 	return mp;
 }
 
@@ -377,9 +451,9 @@ int Esd_MemoryPool_Destroy(Esd_MemoryPool *mp)
 	{
 		mm1 = mm;
 		mm = mm->next;
-		free(mm1);
+		esd_heap_free(mm1);
 	}
-	free(mp);
+	esd_heap_free(mp);
 	return 0;
 }
 
@@ -431,6 +505,11 @@ float Esd_MemoryPool_GetFactorProg(Esd_MemoryPool *mp)
 #undef MP_INIT_MEMORY_STRUCT
 #undef MP_DLINKLIST_INS_FRT
 #undef MP_DLINKLIST_DEL
+#if ESD_MEMORYPOOL_SLAB
+#undef MP_SLAB_TAG
+#undef MP_SLAB_TAG_SIZE
+#undef MP_SLAB_SLOT
+#endif
 
 #endif /* #ifdef ESD_MEMORYPOOL_ALLOCATOR*/
 
@@ -43,14 +43,41 @@ typedef size_t mem_size_t;
 #define KB (mem_size_t)(1 << 10)
 #define MB (mem_size_t)(1 << 20)
 
+// Serve small allocations of 16, 32, 64 and 128 bytes from fixed size slabs
+#ifndef ESD_MEMORYPOOL_SLAB
+#define ESD_MEMORYPOOL_SLAB 1
+#endif
+
+// Size of the pages which are taken from the pool to fill a slab
+#ifndef ESD_MEMORYPOOL_SLAB_PAGE
+#define ESD_MEMORYPOOL_SLAB_PAGE (2 * KB)
+#endif
+
+#define MP_SLAB_CLASSES 4
+#define MP_SLAB_MIN_SIZE (mem_size_t)16
+#define MP_SLAB_MAX_SIZE (MP_SLAB_MIN_SIZE << (MP_SLAB_CLASSES - 1))
+
 typedef struct _mp_chunk
 {
 	mem_size_t alloc_mem;
 	struct _mp_chunk *prev;
 	struct _mp_chunk *next;
-	int is_free;
+	struct _mp_mem_pool_list *owner; // Memory list containing this chunk
+	mem_size_t is_free; // Last word of the header, tells pool chunks apart from slab objects
 } Esd_MpChunk;
 
+#if ESD_MEMORYPOOL_SLAB
+typedef struct _mp_slab
+{
+	mem_size_t obj_size;
+	void *free_list;
+	mem_size_t pages;
+	mem_size_t in_use;
+	mem_size_t peak;
+	mem_size_t alloc_count;
+} Esd_MpSlab;
+#endif
+
 typedef struct _mp_mem_pool_list
 {
 	char *start;
@@ -71,6 +98,9 @@ typedef struct _mp_mem_pool
 	mem_size_t total_mem_pool_size;
 	mem_size_t max_mem_pool_size;
 	struct _mp_mem_pool_list *mlist;
+#if ESD_MEMORYPOOL_SLAB
+	Esd_MpSlab slab[MP_SLAB_CLASSES];
+#endif
 } Esd_MemoryPool;
 
 // below 3 are debug functions, get information only
@@ -99,6 +129,11 @@ mem_size_t Esd_MemoryPool_GetTotalUsed(Esd_MemoryPool *mp);
 mem_size_t Esd_MemoryPool_GetTotalProg(Esd_MemoryPool *mp);
 // float Esd_MemoryPool_GetFactorProg(Esd_MemoryPool *mp);
 
+#if ESD_MEMORYPOOL_SLAB
+// Get the statistics of a slab size class, returns NULL when out of range
+const Esd_MpSlab *Esd_MemoryPool_GetSlab(Esd_MemoryPool *mp, int cls);
+#endif
+
 #endif /* #ifdef ESD_MEMORYPOOL_ALLOCATOR*/
 
 #endif /* #ifndef ESD_MEMORYPOOL__H */
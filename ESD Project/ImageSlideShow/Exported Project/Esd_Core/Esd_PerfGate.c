@@ -0,0 +1,154 @@
+
+#include "Esd_PerfGate.h"
+
+#if ESD_PERFGATE
+
+#include "Esd_Context.h"
+
+#include <stdio.h>
+#include <string.h>
+
+static Esd_PerfGateRecord s_Records[ESD_PERFGATE_PAGES];
+static uint32_t s_RecordCount = 0;
+static uint32_t s_Page = 0; // Page of the frame being rendered
+static uint32_t s_FramePage = 0; // Page of the frame the counters belong to
+static uint32_t s_Frames = 0;
+static bool s_FrameStarted = false;
+
+static Esd_PerfGateRecord *findRecord(Esd_PerfGateRecord *records, uint32_t count, uint32_t page)
+{
+	uint32_t i;
+	for (i = 0; i < count; ++i)
+	{
+		if (records[i].Page == page)
+			return &records[i];
+	}
+	return NULL;
+}
+
+static void recordMax(uint32_t *value, uint32_t sample)
+{
+	if (sample > *value)
+		*value = sample;
+}
+
+ESD_CORE_EXPORT void Esd_PerfGate_SetPage(uint32_t page)
+{
+	s_Page = page;
+}
+
+ESD_CORE_EXPORT void Esd_PerfGate_Frame(EVE_HalContext *phost)
+{
+	Esd_PerfGateRecord *record;
+
+	// Stats still hold the counters since the previous CMD_DLSTART, including the Update of this frame
+	if (s_FrameStarted)
+	{
+		record = findRecord(s_Records, s_RecordCount, s_FramePage);
+		if (!record && s_RecordCount < ESD_PERFGATE_PAGES)
+		{
+			record = &s_Records[s_RecordCount++];
+			memset(record, 0, sizeof(Esd_PerfGateRecord));
+			record->Page = s_FramePage;
+		}
+		if (record)
+		{
+			++record->Frames;
+			recordMax(&record->Transfers, phost->Stats.Transfers);
+			recordMax(&record->RegPolls, phost->Stats.RegPolls);
+			recordMax(&record->CmdWords, phost->Stats.CmdWords);
+			recordMax(&record->BytesWritten, phost->Stats.BytesWritten);
+			recordMax(&record->BytesRead, phost->Stats.BytesRead);
+			recordMax(&record->DlWords, phost->DlEstimate);
+		}
+		if (++s_Frames >= ESD_PERFGATE_FRAMES && Esd_CurrentContext)
+			Esd_CurrentContext->RequestStop = true;
+	}
+	s_FrameStarted = true;
+	s_FramePage = s_Page;
+}
+
+static bool checkValue(uint32_t page, const char *name, uint32_t value, uint32_t baseline)
+{
+	if ((uint64_t)value * 100 > (uint64_t)baseline * (100 + ESD_PERFGATE_TOLERANCE))
+	{
+		eve_printf("PERFGATE REGRESSION page %08x %s: %u, baseline %u\n", (unsigned int)page, name, (unsigned int)value, (unsigned int)baseline);
+		return false;
+	}
+	return true;
+}
+
+ESD_CORE_EXPORT bool Esd_PerfGate_Check(const char *baselinePath, const char *resultPath)
+{
+	static Esd_PerfGateRecord baseline[ESD_PERFGATE_PAGES];
+	uint32_t baselineCount = 0;
+	bool ok = true;
+	uint32_t i;
+	FILE *f;
+
+	if (resultPath && (f = fopen(resultPath, "w")))
+	{
+		fprintf(f, "# page frames transfers regpolls cmdwords byteswritten bytesread dlwords\n");
+		for (i = 0; i < s_RecordCount; ++i)
+		{
+			Esd_PerfGateRecord *r = &s_Records[i];
+			fprintf(f, "%08x %u %u %u %u %u %u %u\n", (unsigned int)r->Page, (unsigned int)r->Frames,
+			    (unsigned int)r->Transfers, (unsigned int)r->RegPolls, (unsigned int)r->CmdWords, (unsigned int)r->BytesWritten,
+			    (unsigned int)r->BytesRead, (unsigned int)r->DlWords);
+		}
+		fclose(f);
+	}
+
+	if (!baselinePath || !(f = fopen(baselinePath, "r")))
+	{
+		eve_printf("PERFGATE no baseline, %u pages recorded\n", (unsigned int)s_RecordCount);
+		return true;
+	}
+	{
+		char line[160];
+		while (baselineCount < ESD_PERFGATE_PAGES && fgets(line, sizeof(line), f))
+		{
+			Esd_PerfGateRecord *r = &baseline[baselineCount];
+			unsigned int v[8];
+			if (line[0] == '#')
+				continue;
+			if (sscanf(line, "%x %u %u %u %u %u %u %u", &v[0], &v[1], &v[2], &v[3], &v[4], &v[5], &v[6], &v[7]) != 8)
+				continue;
+			r->Page = v[0];
+			r->Frames = v[1];
+			r->Transfers = v[2];
+			r->RegPolls = v[3];
+			r->CmdWords = v[4];
+			r->BytesWritten = v[5];
+			r->BytesRead = v[6];
+			r->DlWords = v[7];
+			++baselineCount;
+		}
+		fclose(f);
+	}
+
+	for (i = 0; i < s_RecordCount; ++i)
+	{
+		Esd_PerfGateRecord *r = &s_Records[i];
+		Esd_PerfGateRecord *b = findRecord(baseline, baselineCount, r->Page);
+		if (!b)
+		{
+			// New page, becomes part of the baseline once the result file is accepted
+			eve_printf("PERFGATE page %08x not in baseline\n", (unsigned int)r->Page);
+			continue;
+		}
+		ok = checkValue(r->Page, "transfers", r->Transfers, b->Transfers) && ok;
+		ok = checkValue(r->Page, "register polls", r->RegPolls, b->RegPolls) && ok;
+		ok = checkValue(r->Page, "command words", r->CmdWords, b->CmdWords) && ok;
+		ok = checkValue(r->Page, "bytes written", r->BytesWritten, b->BytesWritten) && ok;
+		ok = checkValue(r->Page, "bytes read", r->BytesRead, b->BytesRead) && ok;
+		ok = checkValue(r->Page, "display list words", r->DlWords, b->DlWords) && ok;
+	}
+
+	eve_printf("PERFGATE %s, %u pages over %u frames\n", ok ? "PASS" : "FAIL", (unsigned int)s_RecordCount, (unsigned int)s_Frames);
+	return ok;
+}
+
+#endif
+
+/* end of file */
@@ -0,0 +1,82 @@
+
+#ifndef ESD_PERFGATE__H
+#define ESD_PERFGATE__H
+
+#include "Esd_Base.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+Performance regression gate for headless host runs.
+Records the largest per frame traffic of each page: transfers, register polls, command words,
+bytes written and read, and estimated display list words, from the EVE_HAL_STATS counters.
+Pages are keyed by the class id of the page shown by Ft_Esd_Layout_Switch.
+After ESD_PERFGATE_FRAMES rendered frames the loop is stopped, and Esd_PerfGate_Check
+compares the records against a baseline file written by a previous run. Any counter
+exceeding its baseline by more than ESD_PERFGATE_TOLERANCE percent fails the check,
+so the runner can return a failure exit code to the build.
+Requires EVE_HAL_STATS and EVE_DL_ESTIMATE, and standard file IO.
+*/
+
+#ifndef ESD_PERFGATE
+#define ESD_PERFGATE 0
+#endif
+
+// Number of rendered frames after which Esd_Loop is stopped
+#ifndef ESD_PERFGATE_FRAMES
+#define ESD_PERFGATE_FRAMES 600
+#endif
+
+// Allowed increase over the baseline, in percent
+#ifndef ESD_PERFGATE_TOLERANCE
+#define ESD_PERFGATE_TOLERANCE 5
+#endif
+
+// Maximum number of distinct pages recorded
+#ifndef ESD_PERFGATE_PAGES
+#define ESD_PERFGATE_PAGES 16
+#endif
+
+#if ESD_PERFGATE
+
+#if !(EVE_HAL_STATS && EVE_DL_ESTIMATE)
+#error "ESD_PERFGATE requires EVE_HAL_STATS and EVE_DL_ESTIMATE"
+#endif
+
+typedef struct
+{
+	uint32_t Page; // Class id of the page, 0 when no page switch is used
+	uint32_t Frames;
+	uint32_t Transfers;
+	uint32_t RegPolls;
+	uint32_t CmdWords;
+	uint32_t BytesWritten;
+	uint32_t BytesRead;
+	uint32_t DlWords;
+} Esd_PerfGateRecord;
+
+// Sets the page the current frame belongs to
+ESD_CORE_EXPORT void Esd_PerfGate_SetPage(uint32_t page);
+
+// Records the counters of the previous frame, called by Esd_Render before CMD_DLSTART
+ESD_CORE_EXPORT void Esd_PerfGate_Frame(EVE_HalContext *phost);
+
+// Writes the records to resultPath, and compares them against baselinePath if it exists. Returns false on regression
+ESD_CORE_EXPORT bool Esd_PerfGate_Check(const char *baselinePath, const char *resultPath);
+
+#else
+
+#define Esd_PerfGate_SetPage(page) eve_noop()
+#define Esd_PerfGate_Frame(phost) eve_noop()
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* #ifndef ESD_PERFGATE__H */
+
+/* end of file */
@@ -0,0 +1,142 @@
+
+#include "Esd_Power.h"
+
+#if ESD_POWER
+
+#include "Esd_Context.h"
+#include "Esd_TouchTag.h"
+
+ESD_CORE_EXPORT Esd_PowerWaitCallback Esd_PowerWait = NULL;
+
+static uint8_t s_State = ESD_POWER_ACTIVE;
+static bool s_Started = false;
+static volatile bool s_Wake = false;
+static uint32_t s_ActivityMillis = 0;
+static uint32_t s_StepMillis;
+static uint8_t s_Duty; // Backlight duty before dimming
+static uint8_t s_DimmedDuty; // Current duty while dimming
+static uint8_t s_TargetFps; // Frame rate before slowing down
+
+ESD_CORE_EXPORT void Esd_Power_Wake()
+{
+	s_Wake = true;
+}
+
+ESD_CORE_EXPORT uint8_t Esd_Power_State()
+{
+	return s_State;
+}
+
+static void wait(uint32_t ms)
+{
+	if (Esd_PowerWait)
+		Esd_PowerWait(ms);
+	else
+		EVE_sleep(ms);
+}
+
+static void restore(Esd_Context *ec)
+{
+	EVE_HalContext *phost = Esd_GetHost();
+	EVE_Hal_wr8(phost, REG_PWM_DUTY, s_Duty);
+	Esd_SetTargetFps(ec, s_TargetFps); // The refresh rate may have changed meanwhile
+	s_State = ESD_POWER_ACTIVE;
+	Esd_Invalidate();
+}
+
+static void dim(Esd_Context *ec)
+{
+	EVE_HalContext *phost = Esd_GetHost();
+	s_Duty = EVE_Hal_rd8(phost, REG_PWM_DUTY);
+	s_DimmedDuty = s_Duty;
+	s_TargetFps = ec->TargetFps;
+	if (ESD_POWER_SLOW_FPS)
+		Esd_SetTargetFps(ec, ESD_POWER_SLOW_FPS);
+	s_StepMillis = ec->Millis;
+	s_State = ESD_POWER_DIMMED;
+}
+
+static void stepDim(Esd_Context *ec)
+{
+	uint8_t duty = s_DimmedDuty;
+	if (duty <= ESD_POWER_DIM_DUTY || (ec->Millis - s_StepMillis) < ESD_POWER_DIM_STEP_MS)
+		return;
+	s_StepMillis = ec->Millis;
+	duty = (duty - ESD_POWER_DIM_DUTY) > ESD_POWER_DIM_STEP ? (uint8_t)(duty - ESD_POWER_DIM_STEP) : ESD_POWER_DIM_DUTY;
+	s_DimmedDuty = duty;
+	EVE_Hal_wr8(Esd_GetHost(), REG_PWM_DUTY, duty);
+}
+
+// Returns once touched or woken
+static void standby(Esd_Context *ec)
+{
+	EVE_HalContext *phost = Esd_GetHost();
+
+	// Let the coprocessor finish the frame in flight, so the display list on screen is complete when waking up
+	EVE_Hal_wr8(phost, REG_PWM_DUTY, 0);
+	EVE_Cmd_waitFlush(phost);
+	s_State = ESD_POWER_STANDBY;
+	eve_printf_debug("Display standby\n");
+
+	for (;;)
+	{
+		EVE_Host_powerModeSwitch(phost, EVE_STANDBY_M);
+		wait(ESD_POWER_WAKE_POLL_MS);
+		EVE_Host_powerModeSwitch(phost, EVE_ACTIVE_M);
+		if (s_Wake)
+			break;
+		EVE_sleep(ESD_POWER_WAKE_SAMPLE_MS);
+
+		// REG_CTOUCH_TOUCH0_XY is at the same address
+		if (!(EVE_Hal_rd32(phost, REG_TOUCH_SCREEN_XY) & 0x80008000))
+		{
+			// The waking touch would land on whatever is under the finger on a screen that was dark
+			Esd_TouchTag_SuppressCurrentTags();
+			break;
+		}
+	}
+
+	ec->Millis = EVE_millis(); // Time in standby does not count as frame time
+	eve_printf_debug("Display active\n");
+}
+
+ESD_CORE_EXPORT void Esd_Power_Update()
+{
+	Esd_Context *ec = Esd_CurrentContext;
+	uint32_t idle;
+
+	if (!s_Started)
+	{
+		s_Started = true;
+		s_ActivityMillis = ec->Millis;
+	}
+	if (s_Wake || Esd_TouchTag_Contacts())
+	{
+		s_Wake = false;
+		s_ActivityMillis = ec->Millis;
+		if (s_State != ESD_POWER_ACTIVE)
+			restore(ec);
+		return;
+	}
+
+	idle = ec->Millis - s_ActivityMillis;
+	if (s_State == ESD_POWER_ACTIVE)
+	{
+		if (idle >= ESD_POWER_DIM_MS)
+			dim(ec);
+		return;
+	}
+
+	stepDim(ec);
+	if (ESD_POWER_STANDBY_MS && idle >= ESD_POWER_STANDBY_MS)
+	{
+		standby(ec);
+		s_Wake = false;
+		s_ActivityMillis = ec->Millis;
+		restore(ec);
+	}
+}
+
+#endif /* #if ESD_POWER */
+
+/* end of file */
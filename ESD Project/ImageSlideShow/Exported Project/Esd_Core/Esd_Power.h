@@ -0,0 +1,100 @@
+
+#ifndef ESD_POWER__H
+#define ESD_POWER__H
+
+#include "Esd_Base.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+Idle power management.
+With ESD_POWER, Esd_Update tracks the time since the last touch or Esd_Power_Wake. After
+ESD_POWER_DIM_MS the backlight fades down to ESD_POWER_DIM_DUTY in steps and Esd_Loop is
+paced down to ESD_POWER_SLOW_FPS. After ESD_POWER_STANDBY_MS the backlight is switched off
+and EVE is put in standby, its registers, display list and RAM_G are kept, so waking up only
+restores the backlight duty and the frame rate, nothing is uploaded again.
+
+The touch engine is not clocked in standby. Every ESD_POWER_WAKE_POLL_MS EVE is made
+active for ESD_POWER_WAKE_SAMPLE_MS to check for a touch, in between the host waits in
+Esd_PowerWait, which can be set to a platform sleep that returns on any interrupt.
+The touch that wakes the screen up is not passed to the widgets.
+*/
+
+#ifndef ESD_POWER
+#define ESD_POWER 0
+#endif
+
+// Inactivity before the backlight dims and the frame rate drops
+#ifndef ESD_POWER_DIM_MS
+#define ESD_POWER_DIM_MS 30000
+#endif
+
+// Inactivity before EVE goes into standby, 0 to stay dimmed
+#ifndef ESD_POWER_STANDBY_MS
+#define ESD_POWER_STANDBY_MS 120000
+#endif
+
+// Dimmed REG_PWM_DUTY, out of 128
+#ifndef ESD_POWER_DIM_DUTY
+#define ESD_POWER_DIM_DUTY 16
+#endif
+
+// The duty drops by ESD_POWER_DIM_STEP every ESD_POWER_DIM_STEP_MS while dimming
+#ifndef ESD_POWER_DIM_STEP
+#define ESD_POWER_DIM_STEP 8
+#endif
+#ifndef ESD_POWER_DIM_STEP_MS
+#define ESD_POWER_DIM_STEP_MS 40
+#endif
+
+// Frame rate while dimmed, 0 to keep the frame rate
+#ifndef ESD_POWER_SLOW_FPS
+#define ESD_POWER_SLOW_FPS 10
+#endif
+
+// Time in standby between touch checks, and time EVE is kept active for each check
+#ifndef ESD_POWER_WAKE_POLL_MS
+#define ESD_POWER_WAKE_POLL_MS 150
+#endif
+#ifndef ESD_POWER_WAKE_SAMPLE_MS
+#define ESD_POWER_WAKE_SAMPLE_MS 20
+#endif
+
+#define ESD_POWER_ACTIVE 0
+#define ESD_POWER_DIMMED 1
+#define ESD_POWER_STANDBY 2
+
+// Waits for about ms milliseconds, may return early. The host is not talking to EVE meanwhile
+typedef void (*Esd_PowerWaitCallback)(uint32_t ms);
+
+#if ESD_POWER
+
+// Optional, defaults to EVE_sleep
+extern ESD_CORE_EXPORT Esd_PowerWaitCallback Esd_PowerWait;
+
+// Restarts the inactivity time and wakes the screen up, may be called from an interrupt
+ESD_CORE_EXPORT void Esd_Power_Wake();
+
+// One of ESD_POWER_ACTIVE, ESD_POWER_DIMMED or ESD_POWER_STANDBY
+ESD_CORE_EXPORT uint8_t Esd_Power_State();
+
+// Advances the idle stages, called from Esd_Update after touch. Blocks while in standby
+ESD_CORE_EXPORT void Esd_Power_Update();
+
+#else
+
+#define Esd_Power_Wake() eve_noop()
+#define Esd_Power_State() ESD_POWER_ACTIVE
+#define Esd_Power_Update() eve_noop()
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* #ifndef ESD_POWER__H */
+
+/* end of file */
@@ -0,0 +1,270 @@
+
+#include "Esd_Preview.h"
+
+#if ESD_PREVIEW
+
+#include "Esd_Context.h"
+#include "Esd_Utility.h"
+
+#include <string.h>
+
+extern ESD_CORE_EXPORT Esd_GpuAlloc *Esd_GAlloc;
+
+typedef struct
+{
+	Esd_BitmapInfo *Info;
+	bool Previewed; // Layout below is the one of the bitmap source
+	uint32_t Format;
+	int32_t Width;
+	int32_t Height;
+	int32_t Stride;
+	int32_t Size;
+} Esd_PreviewSlot;
+
+static Esd_PreviewSlot s_Slots[ESD_PREVIEW_SLOTS];
+
+static uint8_t s_Header[ESD_PREVIEW_HEADER_SIZE];
+static uint32_t s_HeaderFill = 0;
+
+// Transfer in progress, or completed and waiting for Esd_Preview_Update
+static bool s_Active = false;
+static bool s_Discard = false; // The data of the transfer is skipped
+static uint8_t s_Slot;
+static uint32_t s_Size;
+static uint32_t s_Format;
+static uint16_t s_Width;
+static uint16_t s_Height;
+static uint16_t s_Stride;
+static uint32_t s_Offset; // Bytes received
+static Esd_GpuHandle s_Handle = GA_HANDLE_INIT;
+
+static uint32_t s_Burst[ESD_PREVIEW_BURST / 4];
+static uint32_t s_BurstFill = 0;
+
+static uint32_t get32(const uint8_t *p)
+{
+	return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint16_t get16(const uint8_t *p)
+{
+	return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static void cancel()
+{
+	// Never drawn, no need to defer
+	Esd_GpuAlloc_Free(Esd_GAlloc, s_Handle);
+	s_Handle = GA_HANDLE_INVALID;
+	s_Active = false;
+}
+
+static void beginTransfer()
+{
+	Esd_BitmapInfo *info;
+
+	s_Slot = s_Header[4];
+	s_Size = get32(&s_Header[8]);
+	s_Format = get32(&s_Header[12]);
+	s_Width = get16(&s_Header[16]);
+	s_Height = get16(&s_Header[18]);
+	s_Stride = get16(&s_Header[20]);
+	s_Offset = 0;
+	s_BurstFill = 0;
+	s_Active = true;
+	s_Discard = true;
+
+	info = s_Slot < ESD_PREVIEW_SLOTS ? s_Slots[s_Slot].Info : NULL;
+	if (!info || !s_Size)
+	{
+		eve_printf_debug("Preview slot %i is not registered\n", (int)s_Slot);
+		return;
+	}
+	if (!s_Width && s_Size != (uint32_t)info->Size)
+	{
+		eve_printf_debug("Preview size %u does not match the bitmap in slot %i\n", (unsigned int)s_Size, (int)s_Slot);
+		return;
+	}
+
+	// Fixed, so the bitmap keeps its address until the preview is cleared
+	s_Handle = Esd_GpuAlloc_Alloc(Esd_GAlloc, s_Size, GA_FIXED_FLAG);
+	if (Esd_GpuAlloc_Get(Esd_GAlloc, s_Handle) == GA_INVALID)
+	{
+		eve_printf_debug("Not enough RAM_G for the preview of slot %i\n", (int)s_Slot);
+		s_Handle = GA_HANDLE_INVALID;
+		return;
+	}
+	s_Discard = false;
+}
+
+static void flushBurst()
+{
+	uint32_t addr;
+
+	if (!s_BurstFill)
+		return;
+	addr = Esd_GpuAlloc_Get(Esd_GAlloc, s_Handle);
+	if (addr == GA_INVALID)
+	{
+		s_Discard = true;
+	}
+	else
+	{
+		EVE_Hal_wrMem(Esd_GetHost(), addr + s_Offset - s_BurstFill, (uint8_t *)s_Burst, s_BurstFill);
+	}
+	s_BurstFill = 0;
+}
+
+ESD_CORE_EXPORT void Esd_Preview_Register(uint8_t slot, Esd_BitmapInfo *info)
+{
+	if (slot >= ESD_PREVIEW_SLOTS)
+		return;
+	if (s_Active && s_Slot == slot)
+		cancel();
+	s_Slots[slot].Info = info;
+	s_Slots[slot].Previewed = false;
+}
+
+ESD_CORE_EXPORT void Esd_Preview_Clear(uint8_t slot)
+{
+	Esd_PreviewSlot *s;
+	Esd_BitmapInfo *info;
+
+	if (slot >= ESD_PREVIEW_SLOTS || !s_Slots[slot].Previewed)
+		return;
+	s = &s_Slots[slot];
+	info = s->Info;
+
+	// Bitmap data comes back from the source on the next load
+	Esd_DeferredGpuFree(info->GpuHandle);
+	info->GpuHandle = GA_HANDLE_INVALID;
+	info->Format = s->Format;
+	info->Width = s->Width;
+	info->Height = s->Height;
+	info->Stride = s->Stride;
+	info->Size = s->Size;
+	s->Previewed = false;
+}
+
+ESD_CORE_EXPORT bool Esd_Preview_Ready()
+{
+	return !(s_Active && s_Offset == s_Size);
+}
+
+ESD_CORE_EXPORT void Esd_Preview_Receive(const uint8_t *data, uint32_t size)
+{
+	while (size)
+	{
+		if (!s_Active || s_Offset == s_Size)
+		{
+			// A completed transfer is swapped in before the next header is accepted
+			if (s_Active)
+				return;
+
+			s_Header[s_HeaderFill++] = *data++;
+			--size;
+
+			// Resynchronize one byte at a time on the magic
+			while (s_HeaderFill && (s_HeaderFill < 4 ? memcmp(s_Header, "PRVW", s_HeaderFill) : get32(s_Header) != ESD_PREVIEW_MAGIC))
+			{
+				memmove(s_Header, &s_Header[1], --s_HeaderFill);
+			}
+			if (s_HeaderFill == ESD_PREVIEW_HEADER_SIZE)
+			{
+				s_HeaderFill = 0;
+				beginTransfer();
+				if (!s_Size)
+					s_Active = false;
+			}
+			continue;
+		}
+
+		uint32_t n = s_Size - s_Offset;
+		if (n > size)
+			n = size;
+
+		if (s_Discard)
+		{
+			s_Offset += n;
+			data += n;
+			size -= n;
+			if (s_Offset == s_Size)
+				cancel();
+			continue;
+		}
+
+		if (n > ESD_PREVIEW_BURST - s_BurstFill)
+			n = ESD_PREVIEW_BURST - s_BurstFill;
+		memcpy((uint8_t *)s_Burst + s_BurstFill, data, n);
+		s_BurstFill += n;
+		s_Offset += n;
+		data += n;
+		size -= n;
+
+		if (s_BurstFill == ESD_PREVIEW_BURST || s_Offset == s_Size)
+		{
+			flushBurst();
+			if (s_Discard)
+			{
+				if (s_Offset == s_Size)
+					cancel();
+				else
+					s_Handle = GA_HANDLE_INVALID; // Lost to a reset of the allocator
+			}
+		}
+	}
+}
+
+ESD_CORE_EXPORT void Esd_Preview_Update()
+{
+	Esd_PreviewSlot *s;
+	Esd_BitmapInfo *info;
+	Esd_GpuHandle old;
+
+	if (!s_Active || s_Discard || s_Offset != s_Size)
+		return;
+
+	s = &s_Slots[s_Slot];
+	info = s->Info;
+	if (!info || Esd_GpuAlloc_Get(Esd_GAlloc, s_Handle) == GA_INVALID)
+	{
+		cancel();
+		return;
+	}
+
+	// Let a background load of the same bitmap finish first, it would overwrite the handle
+	if (info->Loading)
+		return;
+
+	if (!s->Previewed)
+	{
+		s->Format = info->Format;
+		s->Width = info->Width;
+		s->Height = info->Height;
+		s->Stride = info->Stride;
+		s->Size = info->Size;
+		s->Previewed = true;
+	}
+
+	old = info->GpuHandle;
+	info->GpuHandle = s_Handle;
+	info->Size = (int32_t)s_Size;
+	if (s_Width)
+	{
+		info->Format = s_Format;
+		info->Width = s_Width;
+		info->Height = s_Height;
+		info->Stride = s_Stride;
+	}
+
+	// Frames already submitted may still draw the old data
+	Esd_DeferredGpuFree(old);
+
+	s_Handle = GA_HANDLE_INVALID;
+	s_Active = false;
+	eve_printf_debug("Preview of slot %i swapped in, %u bytes\n", (int)s_Slot, (unsigned int)s_Size);
+}
+
+#endif /* #if ESD_PREVIEW */
+
+/* end of file */
@@ -0,0 +1,81 @@
+
+#ifndef ESD_PREVIEW__H
+#define ESD_PREVIEW__H
+
+#include "Esd_Base.h"
+#include "Esd_BitmapInfo.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+Live bitmap preview.
+Bitmap data pushed from a PC is written straight into RAM_G, without going through the SD card.
+The application registers the bitmaps which may be replaced in numbered slots. The transport passes
+the received bytes to Esd_Preview_Receive, on FT9XX the OUT endpoint of the usbdbg CDC port with
+Esd_Preview_Ready and Esd_Preview_Receive as its receiver. Packets are coalesced into bursts of
+ESD_PREVIEW_BURST bytes for EVE_Hal_wrMem into a new fixed allocation. Once complete, Esd_Update
+swaps the allocation into the bitmap, and the old one is released when no frame uses it anymore.
+The bitmap keeps the preview until Esd_Preview_Clear, which reloads it from its own source.
+Tools/esd_preview.py sends a raw bitmap file as produced by the ESD image converter.
+
+Each transfer starts with a header, little endian:
+	uint32_t ESD_PREVIEW_MAGIC
+	uint8_t  slot, followed by 3 reserved bytes
+	uint32_t size of the bitmap data
+	uint32_t format
+	uint16_t width, height, stride, when width is 0 the bitmap keeps its layout and the size must match
+	uint16_t reserved
+*/
+
+#ifndef ESD_PREVIEW
+#define ESD_PREVIEW 0
+#endif
+
+#define ESD_PREVIEW_MAGIC 0x57565250UL // "PRVW"
+#define ESD_PREVIEW_HEADER_SIZE 24
+
+// Number of bitmaps that can be registered
+#ifndef ESD_PREVIEW_SLOTS
+#define ESD_PREVIEW_SLOTS 8
+#endif
+
+// Size of each RAM_G write, a multiple of 4 bytes
+#ifndef ESD_PREVIEW_BURST
+#define ESD_PREVIEW_BURST 4096
+#endif
+
+#if ESD_PREVIEW
+
+// Allow the bitmap to be replaced through the given slot, NULL unregisters the slot
+ESD_CORE_EXPORT void Esd_Preview_Register(uint8_t slot, Esd_BitmapInfo *info);
+
+// Drop the preview of the slot, the bitmap is loaded from its own source when next used
+ESD_CORE_EXPORT void Esd_Preview_Clear(uint8_t slot);
+
+// True when the next packet can be taken, false while a completed bitmap waits to be swapped in.
+// Call from the Idle or Update callback, not while rendering
+ESD_CORE_EXPORT bool Esd_Preview_Ready();
+
+// Process received bytes, any split of the stream into packets is accepted
+ESD_CORE_EXPORT void Esd_Preview_Receive(const uint8_t *data, uint32_t size);
+
+// Swap in the completed bitmap, called from Esd_Update
+ESD_CORE_EXPORT void Esd_Preview_Update();
+
+#else
+
+#define Esd_Preview_Register(slot, info) eve_noop()
+#define Esd_Preview_Clear(slot) eve_noop()
+#define Esd_Preview_Update() eve_noop()
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* #ifndef ESD_PREVIEW__H */
+
+/* end of file */
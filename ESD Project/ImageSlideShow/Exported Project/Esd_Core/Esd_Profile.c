@@ -0,0 +1,135 @@
+
+#include "Esd_Profile.h"
+
+#if ESD_PROFILE
+
+#include "Esd_HostMem.h"
+
+#include <string.h>
+
+ESD_CORE_EXPORT Esd_ProfileSinkCallback Esd_ProfileSink = NULL;
+
+static Esd_ProfileSummary s_Summary;
+static uint32_t s_BeginUs[ESD_PROFILE_NB];
+static bool s_FrameStarted = false;
+
+static uint32_t micros()
+{
+#if defined(FT9XX_PLATFORM)
+	return EVE_micros();
+#else
+	return EVE_millis() * 1000;
+#endif
+}
+
+static void resetSummary()
+{
+	uint8_t i;
+	memset(&s_Summary, 0, sizeof(s_Summary));
+	s_Summary.Magic = ESD_PROFILE_MAGIC;
+	s_Summary.Phases = ESD_PROFILE_NB;
+	for (i = 0; i < ESD_PROFILE_NB; ++i)
+		s_Summary.Stats[i].MinUs = UINT32_MAX;
+#if EVE_HAL_STATS
+	s_Summary.TrafficCounters = ESD_PROFILE_TRAFFIC_NB;
+#endif
+}
+
+ESD_CORE_EXPORT void Esd_Profile_Begin(Esd_ProfilePhase phase)
+{
+	s_BeginUs[phase] = micros();
+}
+
+ESD_CORE_EXPORT void Esd_Profile_End(Esd_ProfilePhase phase)
+{
+	Esd_ProfileStats *stats = &s_Summary.Stats[phase];
+	uint32_t us = micros() - s_BeginUs[phase];
+	uint32_t bin = us / ESD_PROFILE_BIN_US;
+
+	if (!Esd_ProfileSink)
+		return;
+
+	if (us < stats->MinUs)
+		stats->MinUs = us;
+	if (us > stats->MaxUs)
+		stats->MaxUs = us;
+	stats->TotalUs += us;
+	++stats->Histogram[bin < ESD_PROFILE_BINS ? bin : (ESD_PROFILE_BINS - 1)];
+}
+
+ESD_CORE_EXPORT void Esd_Profile_Frame(uint32_t frame)
+{
+	if (!Esd_ProfileSink)
+	{
+		s_FrameStarted = false;
+		return;
+	}
+
+	if (s_FrameStarted)
+	{
+		Esd_Profile_End(ESD_PROFILE_FRAME);
+		if (++s_Summary.Frames >= ESD_PROFILE_WINDOW)
+		{
+			s_Summary.Frame = frame;
+			Esd_ProfileSink((const uint8_t *)&s_Summary, sizeof(s_Summary));
+			Esd_HostMem_Report(frame);
+			resetSummary();
+		}
+	}
+	else
+	{
+		resetSummary();
+		s_FrameStarted = true;
+	}
+	Esd_Profile_Begin(ESD_PROFILE_FRAME);
+}
+
+ESD_CORE_EXPORT bool Esd_Profile_WaitFlush(EVE_HalContext *phost)
+{
+	bool res;
+
+	if (!Esd_ProfileSink)
+		return EVE_Cmd_waitFlush(phost);
+
+	if (EVE_Cmd_space(phost) == EVE_CMD_FIFO_SIZE - 4)
+	{
+		// Already flushed, the coprocessor finished while the host was busy
+		++s_Summary.HostBound;
+		return EVE_Cmd_waitFlush(phost);
+	}
+
+	res = EVE_Cmd_waitFlush(phost);
+	if (res)
+	{
+		Esd_Profile_End(ESD_PROFILE_COPROCESSOR);
+		++s_Summary.CoprocessorBound;
+	}
+	return res;
+}
+
+#if EVE_HAL_STATS
+static void addTraffic(Esd_ProfileTrafficCounter counter, uint32_t value)
+{
+	Esd_ProfileTraffic *traffic = &s_Summary.Traffic[counter];
+	traffic->Total += value;
+	if (value > traffic->Max)
+		traffic->Max = value;
+}
+
+ESD_CORE_EXPORT void Esd_Profile_Traffic(EVE_HalContext *phost)
+{
+	if (!Esd_ProfileSink || !s_FrameStarted)
+		return;
+
+	++s_Summary.TrafficFrames;
+	addTraffic(ESD_PROFILE_TRANSFERS, phost->Stats.Transfers);
+	addTraffic(ESD_PROFILE_BYTES_WRITTEN, phost->Stats.BytesWritten);
+	addTraffic(ESD_PROFILE_BYTES_READ, phost->Stats.BytesRead);
+	addTraffic(ESD_PROFILE_REG_POLLS, phost->Stats.RegPolls);
+	addTraffic(ESD_PROFILE_CMD_WORDS, phost->Stats.CmdWords);
+}
+#endif
+
+#endif
+
+/* end of file */
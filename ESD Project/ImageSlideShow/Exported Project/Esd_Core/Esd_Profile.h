@@ -0,0 +1,133 @@
+
+#ifndef ESD_PROFILE__H
+#define ESD_PROFILE__H
+
+#include "Esd_Base.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+Frame time profiler.
+Measures the time spent in each phase of the ESD loop in microseconds, and keeps a histogram
+of each phase over a window of ESD_PROFILE_WINDOW frames. At the end of each window,
+an Esd_ProfileSummary is passed to Esd_ProfileSink, and the statistics restart.
+On FT9XX the sink would typically write the summary to the usbdbg CDC endpoint,
+for example using usbdbg_write_byte for each byte.
+With EVE_HAL_STATS, the summary also carries the SPI traffic of the rendered frames.
+Before waiting for the coprocessor to flush a frame, REG_CMDB_SPACE is sampled once.
+When the coprocessor has not yet caught up, the frame is coprocessor bound, and the time from
+the start of Render until the wait returns is added to ESD_PROFILE_COPROCESSOR.
+Otherwise the coprocessor was idle before the host got there, and the frame is host bound.
+Enabled by default in debug builds, define ESD_PROFILE as 0 or 1 to override.
+*/
+
+#if !defined(ESD_PROFILE)
+#if defined(_DEBUG)
+#define ESD_PROFILE 1
+#else
+#define ESD_PROFILE 0
+#endif
+#endif
+
+#define ESD_PROFILE_WINDOW 60 // Frames per summary
+#define ESD_PROFILE_BINS 16 // Histogram bins per phase
+#define ESD_PROFILE_BIN_US 2000 // Width of a histogram bin, the last bin collects anything longer
+#define ESD_PROFILE_MAGIC 0x46525045UL // "EPRF"
+
+typedef enum
+{
+	ESD_PROFILE_FRAME, // Start of Esd_Update to the start of the next Esd_Update
+	ESD_PROFILE_UPDATE,
+	ESD_PROFILE_GPUALLOC, // Esd_GpuAlloc_Update, part of ESD_PROFILE_UPDATE
+	ESD_PROFILE_TOUCHTAG, // Esd_TouchTag_Update, part of ESD_PROFILE_UPDATE
+	ESD_PROFILE_RENDER,
+	ESD_PROFILE_WAITSWAP,
+	ESD_PROFILE_COPROCESSOR, // Start of Render until REG_CMD_READ caught up, only sampled on coprocessor bound frames
+	ESD_PROFILE_NB
+} Esd_ProfilePhase;
+
+typedef struct
+{
+	uint32_t MinUs;
+	uint32_t MaxUs;
+	uint32_t TotalUs;
+	uint16_t Histogram[ESD_PROFILE_BINS];
+} Esd_ProfileStats;
+
+#if EVE_HAL_STATS
+typedef enum
+{
+	ESD_PROFILE_TRANSFERS,
+	ESD_PROFILE_BYTES_WRITTEN,
+	ESD_PROFILE_BYTES_READ,
+	ESD_PROFILE_REG_POLLS,
+	ESD_PROFILE_CMD_WORDS,
+	ESD_PROFILE_TRAFFIC_NB
+} Esd_ProfileTrafficCounter;
+
+typedef struct
+{
+	uint32_t Total;
+	uint32_t Max; // Largest value of a single frame
+} Esd_ProfileTraffic;
+#endif
+
+// Binary summary, little endian
+typedef struct
+{
+	uint32_t Magic; // ESD_PROFILE_MAGIC
+	uint32_t Frame; // Frame number at the end of the window
+	uint16_t Phases; // ESD_PROFILE_NB
+	uint16_t Frames; // Number of frames in the window
+	uint16_t CoprocessorBound; // Frames where the host had to wait for the coprocessor to flush
+	uint16_t HostBound; // Frames where the coprocessor was done before the host started waiting
+	Esd_ProfileStats Stats[ESD_PROFILE_NB];
+#if EVE_HAL_STATS
+	uint16_t TrafficCounters; // ESD_PROFILE_TRAFFIC_NB
+	uint16_t TrafficFrames; // Number of rendered frames in the window
+	Esd_ProfileTraffic Traffic[ESD_PROFILE_TRAFFIC_NB];
+#endif
+} Esd_ProfileSummary;
+
+typedef void (*Esd_ProfileSinkCallback)(const uint8_t *data, uint32_t size);
+
+#if ESD_PROFILE
+
+// Receives a summary at the end of every window, no summaries are collected when not set
+extern ESD_CORE_EXPORT Esd_ProfileSinkCallback Esd_ProfileSink;
+
+ESD_CORE_EXPORT void Esd_Profile_Begin(Esd_ProfilePhase phase);
+ESD_CORE_EXPORT void Esd_Profile_End(Esd_ProfilePhase phase);
+
+// Marks the start of a frame, closes the frame phase and emits the summary when the window is complete
+ESD_CORE_EXPORT void Esd_Profile_Frame(uint32_t frame);
+
+// Waits for the coprocessor to process all submitted commands, and counts the frame as coprocessor or host bound
+ESD_CORE_EXPORT bool Esd_Profile_WaitFlush(EVE_HalContext *phost);
+
+#if EVE_HAL_STATS
+// Adds the traffic since the previous CMD_DLSTART, called by Esd_Render before CMD_DLSTART
+ESD_CORE_EXPORT void Esd_Profile_Traffic(EVE_HalContext *phost);
+#else
+#define Esd_Profile_Traffic(phost) eve_noop()
+#endif
+
+#else
+
+#define Esd_Profile_Begin(phase) eve_noop()
+#define Esd_Profile_End(phase) eve_noop()
+#define Esd_Profile_Frame(frame) eve_noop()
+#define Esd_Profile_Traffic(phost) eve_noop()
+#define Esd_Profile_WaitFlush(phost) EVE_Cmd_waitFlush(phost)
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* #ifndef ESD_PROFILE__H */
+
+/* end of file */
@@ -0,0 +1,59 @@
+
+#include "Esd_Quality.h"
+
+#if ESD_QUALITY
+
+#include "Esd_Context.h"
+
+static bool s_Reduced = false;
+static bool s_Started = false; // A frame start has been marked since the last measurement
+static uint32_t s_StartMicros;
+static uint16_t s_Count; // Consecutive frames towards switching
+
+ESD_CORE_EXPORT bool Esd_Quality_Reduced()
+{
+	return s_Reduced;
+}
+
+ESD_CORE_EXPORT void Esd_Quality_FrameStart()
+{
+	// Updates which are not rendered are part of the next frame
+	if (s_Started)
+		return;
+	s_Started = true;
+	s_StartMicros = EVE_micros();
+}
+
+ESD_CORE_EXPORT void Esd_Quality_FrameEnd()
+{
+	Esd_Context *ec = Esd_CurrentContext;
+	uint32_t budget = ec->FrameMicros ? ec->FrameMicros : ESD_QUALITY_BUDGET_US;
+	uint32_t micros;
+
+	if (!s_Started)
+		return;
+	s_Started = false;
+	micros = EVE_micros() - s_StartMicros;
+
+	if (!s_Reduced)
+	{
+		s_Count = (micros > budget) ? s_Count + 1 : 0;
+		if (s_Count < ESD_QUALITY_OVER_FRAMES)
+			return;
+		eve_printf_debug("Frame over budget for %d frames, reducing quality\n", (int)s_Count);
+	}
+	else
+	{
+		s_Count = ((uint64_t)micros * 100 <= (uint64_t)budget * ESD_QUALITY_RESTORE_PERCENT) ? s_Count + 1 : 0;
+		if (s_Count < ESD_QUALITY_RESTORE_FRAMES)
+			return;
+		eve_printf_debug("Frame within budget for %d frames, restoring quality\n", (int)s_Count);
+	}
+	s_Reduced = !s_Reduced;
+	s_Count = 0;
+	Esd_Invalidate();
+}
+
+#endif /* #if ESD_QUALITY */
+
+/* end of file */
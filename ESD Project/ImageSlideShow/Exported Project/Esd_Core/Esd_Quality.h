@@ -0,0 +1,72 @@
+
+#ifndef ESD_QUALITY__H
+#define ESD_QUALITY__H
+
+#include "Esd_Base.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+Adaptive render quality.
+With ESD_QUALITY, each rendered frame is timed from the start of Esd_Update until the coprocessor has
+flushed it, so both host and coprocessor load count. The budget is the frame period set with
+Esd_SetTargetFps, or ESD_QUALITY_BUDGET_US when the loop is not paced.
+After ESD_QUALITY_OVER_FRAMES consecutive frames over budget, quality is reduced:
+	Esd_Render_RectF_Grad draws from the cached four corner bitmap of Esd_Render_MultiGradient instead of CMD_GRADIENT,
+	Esd_Render_Circle_Stroke draws the ring with a hard inner edge, in two passes instead of five,
+	sprites marked Decorative keep their timing but hold their current frame,
+	widgets set with Ft_Esd_Widget_SetSecondary are replayed from a recording which is refreshed every few frames.
+Full quality is restored after ESD_QUALITY_RESTORE_FRAMES consecutive frames within
+ESD_QUALITY_RESTORE_PERCENT of the budget, the margin keeps it from switching back and forth.
+Widgets which are Cached keep the output they recorded at either quality until they are damaged.
+*/
+
+#ifndef ESD_QUALITY
+#define ESD_QUALITY 0
+#endif
+
+// Frame budget when the loop is not paced
+#ifndef ESD_QUALITY_BUDGET_US
+#define ESD_QUALITY_BUDGET_US 16667
+#endif
+
+#ifndef ESD_QUALITY_OVER_FRAMES
+#define ESD_QUALITY_OVER_FRAMES 4
+#endif
+
+#ifndef ESD_QUALITY_RESTORE_FRAMES
+#define ESD_QUALITY_RESTORE_FRAMES 60
+#endif
+
+#ifndef ESD_QUALITY_RESTORE_PERCENT
+#define ESD_QUALITY_RESTORE_PERCENT 70
+#endif
+
+#if ESD_QUALITY
+
+// True while rendering at reduced quality
+ESD_CORE_EXPORT bool Esd_Quality_Reduced();
+
+// Marks the start of a frame, called from Esd_Update
+ESD_CORE_EXPORT void Esd_Quality_FrameStart();
+
+// Measures the frame once the coprocessor has flushed it, called from Esd_WaitSwap
+ESD_CORE_EXPORT void Esd_Quality_FrameEnd();
+
+#else
+
+#define Esd_Quality_Reduced() false
+#define Esd_Quality_FrameStart() eve_noop()
+#define Esd_Quality_FrameEnd() eve_noop()
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* #ifndef ESD_QUALITY__H */
+
+/* end of file */
@@ -8,6 +8,7 @@
 ESD_CORE_EXPORT void Esd_Render_LineF(esd_int32_f4_t x0, esd_int32_f4_t y0, esd_int32_f4_t x1, esd_int32_f4_t y1, esd_int32_f3_t width, esd_argb32_t color)
 {
 	EVE_HalContext *phost = Esd_GetHost();
+	Esd_Render_BatchFlush();
 	EVE_CoDl_colorArgb_ex(phost, color);
 	EVE_CoDl_lineWidth(phost, width);
 	EVE_CoDl_begin(phost, LINES);
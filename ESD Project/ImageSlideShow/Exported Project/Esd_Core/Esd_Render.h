@@ -5,6 +5,7 @@
 #include "Esd_Base.h"
 #include "Esd_Scissor.h"
 #include "Esd_BitmapInfo.h"
+#include "Esd_FontInfo.h"
 #include "Esd_Math.h"
 
 #ifdef __cplusplus
@@ -86,6 +87,41 @@ ESD_CORE_EXPORT void Esd_Render_Rect_Stroke(
     esd_int32_f4_t radius, esd_int32_f4_t border,
     uint8_t stroke, esd_argb32_t color);
 
+// Filled circle with fixed point precision
+ESD_CORE_EXPORT void Esd_Render_PointF(esd_int32_f4_t x, esd_int32_f4_t y, esd_int32_f4_t radius, esd_argb32_t color);
+
+/*
+Primitive batching.
+Between Esd_Render_BatchBegin and Esd_Render_BatchEnd, the filled circles and rectangles of
+Esd_Render_PointF, Esd_Render_RectF and Esd_Render_Circle_Stroke without a hole are collected
+rather than written right away. They are written under one BEGIN per primitive type, grouped by
+colour and size. A primitive only moves ahead of pending ones it does not overlap, so the result
+looks the same as drawing them in order. The other Esd_Render functions write the pending
+primitives first. Anything drawn through EVE_CoDl or EVE_CoCmd directly inside the window
+must call Esd_Render_BatchFlush before, so use it around groups that are known to draw only
+these primitives, such as indicator rows and radio groups. Windows nest.
+*/
+
+// Primitives collected before they are written regardless
+#ifndef ESD_RENDER_BATCH_MAX
+#define ESD_RENDER_BATCH_MAX 32
+#endif
+
+ESD_CORE_EXPORT void Esd_Render_BatchBegin();
+ESD_CORE_EXPORT void Esd_Render_BatchEnd();
+
+// Write the pending primitives, the window stays open
+ESD_CORE_EXPORT void Esd_Render_BatchFlush();
+
+// Whether a batch window is open
+ESD_CORE_EXPORT bool Esd_Render_Batching();
+
+// Queue a POINTS or RECTS primitive, only while batching. For points the second vertex is the first one
+ESD_CORE_EXPORT void Esd_Render_BatchAdd(uint8_t primitive, esd_int32_f4_t size, esd_argb32_t color, esd_int32_f4_t x0, esd_int32_f4_t y0, esd_int32_f4_t x1, esd_int32_f4_t y1);
+
+// Close any window left open and write the pending primitives, called at the end of the frame
+ESD_CORE_EXPORT void Esd_Render_BatchReset();
+
 // Basic bitmap rendering
 ESD_RENDER(Esd_Render_Bitmap, Type = void, Attributes = ESD_CORE_EXPORT, DisplayName = "ESD Bitmap", Category = EsdPrimitives, Icon = ":/icons/image.png", Include = "Esd_Core.h")
 ESD_PARAMETER(x, Type = int16_t, Default = 0)
@@ -95,7 +131,7 @@ ESD_PARAMETER(bitmapCell, Type = Esd_BitmapCell, DisplayName = "Bitmap Cell")
 ESD_PARAMETER(c, Type = esd_argb32_t, DisplayName = "Color", Default = #FFFFFFFF)
 ESD_CORE_EXPORT void Esd_Render_Bitmap(int16_t x, int16_t y, Esd_BitmapCell bitmapCell, esd_argb32_t c);
 
-// Scaled bitmap rendering
+// Scaled bitmap rendering, draws the smallest Thumbnail variant of the bitmap that covers the scaled size
 ESD_RENDER(Esd_Render_Bitmap_Scaled, Type = void, Attributes = ESD_CORE_EXPORT, DisplayName = "ESD Bitmap Scaled", Category = EsdPrimitives, Icon = ":/icons/image.png", Include = "Esd_Core.h")
 ESD_PARAMETER(x, Type = int16_t, Default = 0)
 ESD_PARAMETER(y, Type = int16_t, Default = 0)
@@ -169,6 +205,29 @@ static inline void Esd_Render_Line(int32_t x0, int32_t y0, int32_t x1, int32_t y
 	Esd_Render_LineF(x0 << 4, y0 << 4, x1 << 4, y1 << 4, width << 3, color);
 }
 
+// Text pre-rendered into an L8 bitmap, see Esd_Render_TextRun
+ESD_TYPE(Esd_TextRun, Native = Struct)
+typedef struct Esd_TextRun
+{
+	// Bitmap holding the rendered text, RAM_G is garbage collected when unused
+	Esd_BitmapInfo BitmapInfo;
+
+	// Font the text was rendered with, NULL if nothing is rendered
+	Esd_FontInfo *Font;
+
+	// Hash of the rendered text
+	uint32_t Hash;
+
+	// Advance width of the rendered text, used for alignment
+	uint16_t TextWidth;
+
+} Esd_TextRun;
+
+// Text rendering through a pre-rendered bitmap. Same parameters as EVE_CoCmd_text_ex.
+// The glyphs are composited on the host once, and drawn as a single bitmap until the text or font changes.
+// Falls back to the coprocessor for extended fonts, characters above 127, or text that does not fit
+ESD_CORE_EXPORT void Esd_Render_TextRun(Esd_TextRun *run, Esd_FontInfo *fontInfo, int16_t font, int16_t x, int16_t y, uint16_t options, bool bottom, int16_t baseLine, int16_t capsHeight, int16_t xOffset, const char *s);
+
 // Get scaled size
 ESD_CORE_EXPORT Esd_Size16 Esd_Math_GetScaledSize(Esd_Size16 boundary, Esd_Size16 original, uint8_t scaling);
 
@@ -249,6 +308,9 @@ ESD_ENUM(Esd_ImageAnimation, Type = int, Include = "Esd_Core.h")
 #define IMAGE_TOP_TO_BOTTOM (3)
 #define IMAGE_FADE_IN (4)
 #define IMAGE_FADE_OUT (5)
+#define IMAGE_CROSSFADE (6)
+#define IMAGE_SLIDE (7)
+#define IMAGE_ZOOM (8)
 ESD_END()
 
 
@@ -0,0 +1,129 @@
+
+#include "Esd_Render.h"
+#include "Esd_Context.h"
+
+typedef struct
+{
+	esd_argb32_t Color;
+	int16_t Size; // Point size or line width
+	uint8_t Primitive; // POINTS or RECTS
+	bool Emitted;
+	int16_t X0, Y0, X1, Y1; // Vertices, the second one is unused for points
+	int32_t Left, Top, Right, Bottom; // Covered area, including the size
+} Esd_BatchPrimitive;
+
+static Esd_BatchPrimitive s_Batch[ESD_RENDER_BATCH_MAX];
+static uint8_t s_BatchNb = 0;
+static uint8_t s_BatchDepth = 0;
+
+static bool overlaps(const Esd_BatchPrimitive *a, const Esd_BatchPrimitive *b)
+{
+	return a->Left < b->Right && b->Left < a->Right && a->Top < b->Bottom && b->Top < a->Bottom;
+}
+
+static bool sameState(const Esd_BatchPrimitive *a, const Esd_BatchPrimitive *b)
+{
+	return a->Primitive == b->Primitive && a->Size == b->Size && a->Color == b->Color;
+}
+
+static void emit(EVE_HalContext *phost, const Esd_BatchPrimitive *p)
+{
+	EVE_CoDl_colorArgb_ex(phost, p->Color);
+	if (p->Primitive == POINTS)
+		EVE_CoDl_pointSize(phost, p->Size);
+	else
+		EVE_CoDl_lineWidth(phost, p->Size);
+	EVE_CoDl_begin(phost, p->Primitive);
+	EVE_CoDl_vertex2f_4(phost, p->X0, p->Y0);
+	if (p->Primitive == RECTS)
+		EVE_CoDl_vertex2f_4(phost, p->X1, p->Y1);
+}
+
+ESD_CORE_EXPORT void Esd_Render_BatchFlush()
+{
+	EVE_HalContext *phost;
+	uint8_t first = 0;
+
+	if (!s_BatchNb)
+		return;
+
+	phost = Esd_GetHost();
+	while (first < s_BatchNb)
+	{
+		// Each pass emits everything with the state of the first pending primitive,
+		// that does not overlap a pending primitive which was drawn before it
+		const Esd_BatchPrimitive *state = &s_Batch[first];
+		for (uint8_t i = first; i < s_BatchNb; ++i)
+		{
+			Esd_BatchPrimitive *p = &s_Batch[i];
+			bool blocked = false;
+			if (p->Emitted || !sameState(p, state))
+				continue;
+			for (uint8_t j = first; j < i; ++j)
+			{
+				if (!s_Batch[j].Emitted && overlaps(&s_Batch[j], p))
+				{
+					blocked = true;
+					break;
+				}
+			}
+			if (blocked)
+				continue;
+			emit(phost, p);
+			p->Emitted = true;
+		}
+		while (first < s_BatchNb && s_Batch[first].Emitted)
+			++first;
+	}
+	EVE_CoDl_end(phost);
+	s_BatchNb = 0;
+}
+
+ESD_CORE_EXPORT void Esd_Render_BatchBegin()
+{
+	++s_BatchDepth;
+}
+
+ESD_CORE_EXPORT void Esd_Render_BatchEnd()
+{
+	eve_assert(s_BatchDepth);
+	if (s_BatchDepth && !--s_BatchDepth)
+		Esd_Render_BatchFlush();
+}
+
+ESD_CORE_EXPORT void Esd_Render_BatchReset()
+{
+	eve_assert_ex(!s_BatchDepth, "Primitive batch left open at the end of the frame");
+	s_BatchDepth = 0;
+	Esd_Render_BatchFlush();
+}
+
+ESD_CORE_EXPORT bool Esd_Render_Batching()
+{
+	return s_BatchDepth != 0;
+}
+
+// Queues a primitive, only called while batching
+ESD_CORE_EXPORT void Esd_Render_BatchAdd(uint8_t primitive, esd_int32_f4_t size, esd_argb32_t color, esd_int32_f4_t x0, esd_int32_f4_t y0, esd_int32_f4_t x1, esd_int32_f4_t y1)
+{
+	Esd_BatchPrimitive *p;
+
+	if (s_BatchNb >= ESD_RENDER_BATCH_MAX)
+		Esd_Render_BatchFlush();
+
+	p = &s_Batch[s_BatchNb++];
+	p->Color = color;
+	p->Size = (int16_t)size;
+	p->Primitive = primitive;
+	p->Emitted = false;
+	p->X0 = (int16_t)x0;
+	p->Y0 = (int16_t)y0;
+	p->X1 = (int16_t)x1;
+	p->Y1 = (int16_t)y1;
+	p->Left = min(x0, x1) - size;
+	p->Top = min(y0, y1) - size;
+	p->Right = max(x0, x1) + size;
+	p->Bottom = max(y0, y1) + size;
+}
+
+/* end of file */
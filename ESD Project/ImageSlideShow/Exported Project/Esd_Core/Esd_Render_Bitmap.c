@@ -4,6 +4,7 @@
 #include "Esd_Context.h"
 #include "Esd_Scissor.h"
 #include "Esd_BitmapHandle.h"
+#include "Esd_TiledImage.h"
 
 void Esd_CoDl_Bitmap_Vertex(int16_t x, int16_t y, uint8_t handle, uint16_t cell)
 {
@@ -23,31 +24,9 @@ void Esd_CoDl_Bitmap_Vertex(int16_t x, int16_t y, uint8_t handle, uint16_t cell)
 	}
 }
 
-/*
 // TODO: Can we use an L8 bitmap to render a bayer dithered alpha into the STENCIL buffer, to allow fading out DXT1?
 // TODO: Can we use the same trick with an additional L1 map rendered into the STENCIL buffer to allow DXT1 to have a fake alpha channel?
-void Esd_CoDl_Bitmap_GenerateDither()
-{
-    static const uint8_t offsets[16] = {
-        0, 10, 2, 8, 5, 15, 7, 13, 1, 11, 3, 9, 4, 14, 6, 12
-    };
-    uint8_t matrix256[256];
-    uint8_t v = 0;
-    for (uint8_t i = 0; i < 16; ++i)
-    {
-        for (uint8_t j = 0; j < 16; ++j)
-        {
-            uint8_t o =
-                ((j & 0xC) << 4)
-                | ((j & 0x3) << 2)
-                | ((i & 0xC) << 2)
-                | (i & 0x3);
-            matrix256[o] = v;
-            ++v;
-        }
-    }
-}
-*/
+// The dither matrix for this is generated ahead of time in program memory, see Tools/esd_imageconv.py --dither-map
 
 // NOTE: This function may only be used within a EVE_CoDl_saveContext block, because it does not clean up state, and bypasses some EVE_CoDl optimizations
 // Also EVE_CoCmd_loadIdentity must be called afterwards to fully restore the context
@@ -121,10 +100,18 @@ ESD_CORE_EXPORT void Esd_Render_Bitmap(int16_t x, int16_t y, Esd_BitmapCell bitm
 	if (!bitmapCell.Info)
 		return;
 
+	Esd_Render_BatchFlush();
+
 	bitmapInfo = bitmapCell.Info;
 	cell = bitmapCell.Cell;
 	phost = Esd_Host;
 	handle = Esd_CoDl_SetupBitmap(bitmapInfo);
+	if (!ESD_BITMAPHANDLE_VALID(handle) && bitmapInfo->Loading)
+	{
+		// Still streaming, draw the rows which are already in RAM_G
+		handle = Esd_CoDl_SetupLoadingBitmap(bitmapInfo, cell);
+		cell = 0;
+	}
 
 	if (ESD_BITMAPHANDLE_VALID(handle))
 	{
@@ -164,6 +151,23 @@ ESD_CORE_EXPORT void Esd_Render_Bitmap(int16_t x, int16_t y, Esd_BitmapCell bitm
 	}
 }
 
+// Smallest variant of which the pixels are not magnified at the given scale, so overview screens load fewer bytes
+static Esd_BitmapInfo *Esd_Render_Bitmap_Variant(Esd_BitmapInfo *bitmapInfo, esd_int32_f16_t xscale, esd_int32_f16_t yscale)
+{
+	int64_t screenWidth = (int64_t)bitmapInfo->Width * (xscale < 0 ? -xscale : xscale);
+	int64_t screenHeight = (int64_t)bitmapInfo->Height * (yscale < 0 ? -yscale : yscale);
+	Esd_BitmapInfo *variant = bitmapInfo;
+	Esd_BitmapInfo *thumbnail;
+
+	for (thumbnail = bitmapInfo->Thumbnail; thumbnail; thumbnail = thumbnail->Thumbnail)
+	{
+		if (((int64_t)thumbnail->Width << 16) < screenWidth || ((int64_t)thumbnail->Height << 16) < screenHeight)
+			break;
+		variant = thumbnail;
+	}
+	return variant;
+}
+
 ESD_CORE_EXPORT void Esd_Render_Bitmap_Scaled(int16_t x, int16_t y, Esd_BitmapCell bitmapCell, esd_argb32_t c, esd_int32_f16_t xscale, esd_int32_f16_t yscale, esd_int32_f16_t xoffset, esd_int32_f16_t yoffset, int16_t width, int16_t height)
 {
 	EVE_HalContext *phost;
@@ -174,10 +178,36 @@ ESD_CORE_EXPORT void Esd_Render_Bitmap_Scaled(int16_t x, int16_t y, Esd_BitmapCe
 	if (!bitmapCell.Info)
 		return;
 
+	Esd_Render_BatchFlush();
+
 	phost = Esd_Host;
 	bitmapInfo = bitmapCell.Info;
 	cell = bitmapCell.Cell;
+#if ESD_TILED_IMAGE
+	if (bitmapInfo->Tiled)
+	{
+		Esd_TiledImage_Render(x, y, bitmapInfo, c, xscale, yscale, xoffset, yoffset, width, height);
+		return;
+	}
+#endif
+	if (bitmapInfo->Thumbnail)
+	{
+		// Scale the variant up to the same size on screen
+		Esd_BitmapInfo *variant = Esd_Render_Bitmap_Variant(bitmapInfo, xscale, yscale);
+		if (variant != bitmapInfo)
+		{
+			xscale = (esd_int32_f16_t)(((int64_t)xscale * bitmapInfo->Width) / variant->Width);
+			yscale = (esd_int32_f16_t)(((int64_t)yscale * bitmapInfo->Height) / variant->Height);
+			bitmapInfo = variant;
+		}
+	}
 	handle = Esd_CoDl_SetupBitmap(bitmapInfo);
+	if (!ESD_BITMAPHANDLE_VALID(handle) && bitmapInfo->Loading)
+	{
+		// Border wrap leaves the area below the uploaded rows empty
+		handle = Esd_CoDl_SetupLoadingBitmap(bitmapInfo, cell);
+		cell = 0;
+	}
 
 	if (ESD_BITMAPHANDLE_VALID(handle))
 	{
@@ -228,6 +258,8 @@ ESD_CORE_EXPORT void Esd_Render_Bitmap_Freeform(Esd_BitmapCell bitmapCell, esd_a
 	if (!bitmapCell.Info)
 		return;
 
+	Esd_Render_BatchFlush();
+
 	phost = Esd_Host;
 
 	EVE_CoDl_alphaFunc(phost, (minAlpha > 0) ? GEQUAL : ALWAYS, minAlpha);
@@ -265,6 +297,8 @@ ESD_CORE_EXPORT void Esd_Render_Bitmap_RotateScaled(Esd_BitmapCell bitmapCell, e
 {
 	EVE_HalContext *phost;
 	Esd_BitmapInfo *bitmapInfo;
+	Esd_TransformState state;
+	Esd_Transform transform;
 	uint16_t cell;
 	uint8_t handle;
 	(void)phost;
@@ -272,6 +306,8 @@ ESD_CORE_EXPORT void Esd_Render_Bitmap_RotateScaled(Esd_BitmapCell bitmapCell, e
 	if (!bitmapCell.Info)
 		return;
 
+	Esd_Render_BatchFlush();
+
 	phost = Esd_Host;
 	bitmapInfo = bitmapCell.Info;
 	cell = bitmapCell.Cell;
@@ -291,19 +327,19 @@ ESD_CORE_EXPORT void Esd_Render_Bitmap_RotateScaled(Esd_BitmapCell bitmapCell, e
 		Esd_CoDl_BitmapSize(handle, BILINEAR, BORDER, BORDER, bitmapInfo->Width, bitmapInfo->Height);
 		Esd_CoDl_PagedCell(handle, cell);
 
-		EVE_CoDl_saveContext(phost);
-		EVE_CoCmd_loadIdentity(Esd_Host);
-		EVE_CoCmd_translate(Esd_Host, x_center << 16, y_center << 16);
-		EVE_CoCmd_scale(Esd_Host, xscale, yscale);
-		EVE_CoCmd_rotate(Esd_Host, rotateAngle);
+		// Matrix computed on the host, the coprocessor does not need to run the matrix commands
+		Esd_Transform_Identity(&transform);
+		Esd_Transform_Translate(&transform, x_center << 16, y_center << 16);
+		Esd_Transform_Scale(&transform, xscale, yscale);
+		Esd_Transform_Rotate(&transform, (uint16_t)rotateAngle);
 		// eve_printf_debug("xscale: %i, yscale: %i\n", (int)xscale, (int)yscale);
-		EVE_CoCmd_translate(Esd_Host, -x_center << 16, -y_center << 16);
-		EVE_CoCmd_setMatrix(Esd_Host);
-		EVE_CoCmd_loadIdentity(Esd_Host);
+		Esd_Transform_Translate(&transform, -x_center << 16, -y_center << 16);
+		Esd_CoDl_BeginTransform(&state);
+		Esd_CoDl_Transform(&state, &transform);
 		EVE_CoDl_begin(phost, BITMAPS);
 		EVE_CoDl_vertex2f_4(Esd_Host, x * 16, y * 16);
 		EVE_CoDl_end(phost);
-		EVE_CoDl_restoreContext(phost);
+		Esd_CoDl_EndTransform(&state);
 	}
 }
 
@@ -311,6 +347,8 @@ ESD_CORE_EXPORT void Esd_Render_Bitmap_Rotate(Esd_BitmapCell bitmapCell, esd_arg
 {
 	EVE_HalContext *phost = Esd_GetHost();
 	Esd_BitmapInfo *bitmapInfo;
+	Esd_TransformState state;
+	Esd_Transform transform;
 	uint16_t cell;
 	uint8_t handle;
 	(void)phost;
@@ -318,6 +356,8 @@ ESD_CORE_EXPORT void Esd_Render_Bitmap_Rotate(Esd_BitmapCell bitmapCell, esd_arg
 	if (!bitmapCell.Info)
 		return;
 
+	Esd_Render_BatchFlush();
+
 	bitmapInfo = bitmapCell.Info;
 	cell = bitmapCell.Cell;
 	handle = Esd_CoDl_SetupBitmap(bitmapInfo);
@@ -337,7 +377,7 @@ ESD_CORE_EXPORT void Esd_Render_Bitmap_Rotate(Esd_BitmapCell bitmapCell, esd_arg
 		const int TITLE_SIZE = 64; // Magic number, DONOT CHANGE
 		EVE_CoDl_colorArgb_ex(phost, c);
 		EVE_CoDl_vertexFormat(phost, 4);
-		EVE_CoDl_saveContext(phost);
+		Esd_CoDl_BeginTransform(&state);
 
 		Esd_CoDl_BitmapSize(handle, BILINEAR, BORDER, BORDER, TITLE_SIZE, TITLE_SIZE); // Bitmap_Size command
 
@@ -353,21 +393,21 @@ ESD_CORE_EXPORT void Esd_Render_Bitmap_Rotate(Esd_BitmapCell bitmapCell, esd_arg
 				{
 					// eve_printf_debug("draw tile %d\n",tilenumber ++);
 					tilenumber++;
-					EVE_CoCmd_loadIdentity(Esd_Host);
-					EVE_CoCmd_translate(Esd_Host, (x - dx) << 16, (y - dy) << 16);
+					Esd_Transform_Identity(&transform);
+					Esd_Transform_Translate(&transform, (x - dx) << 16, (y - dy) << 16);
 
-					EVE_CoCmd_rotate(Esd_Host, rotateAngle);
-					EVE_CoCmd_translate(Esd_Host, -x_center << 16, -y_center << 16);
-					// EVE_CoCmd_translate(Esd_Host, -x_center, -y_center);
+					Esd_Transform_Rotate(&transform, (uint16_t)rotateAngle);
+					Esd_Transform_Translate(&transform, -x_center << 16, -y_center << 16);
 
-					EVE_CoCmd_setMatrix(Esd_Host);
+					// Between tiles only the translation entries change
+					Esd_CoDl_Transform(&state, &transform);
 					EVE_CoDl_vertex2f_4(Esd_Host, dx * 16, dy * 16);
 				}
 			}
 		}
 		// eve_printf_debug("draw tile %d\n",tilenumber);
-		EVE_CoCmd_loadIdentity(Esd_Host);
-		EVE_CoDl_restoreContext(phost);
+		EVE_CoDl_end(phost);
+		Esd_CoDl_EndTransform(&state);
 	}
 }
 
@@ -2,6 +2,22 @@
 #include "Esd_Render.h"
 #include "Esd_Context.h"
 #include "Esd_Scissor.h"
+#include "Esd_Quality.h"
+
+ESD_CORE_EXPORT void Esd_Render_PointF(esd_int32_f4_t x, esd_int32_f4_t y, esd_int32_f4_t radius, esd_argb32_t color)
+{
+	EVE_HalContext *phost = Esd_GetHost();
+	if (Esd_Render_Batching())
+	{
+		Esd_Render_BatchAdd(POINTS, radius, color, x, y, x, y);
+		return;
+	}
+	EVE_CoDl_colorArgb_ex(phost, color);
+	EVE_CoDl_pointSize(phost, radius);
+	EVE_CoDl_begin(phost, POINTS);
+	EVE_CoDl_vertex2f_4(phost, x, y);
+	EVE_CoDl_end(phost);
+}
 
 ESD_CORE_EXPORT void Esd_Render_Circle_Stroke(
     esd_int32_f4_t x, esd_int32_f4_t y,
@@ -56,9 +72,12 @@ ESD_CORE_EXPORT void Esd_Render_Circle_Stroke(
 
 	if (innerRadius <= 0)
 	{
-		// TODO: This is just a circle
+		// This is just a circle
+		Esd_Render_PointF(x, y, outerRadius, color);
+		return;
 	}
 
+	Esd_Render_BatchFlush();
 	EVE_CoDl_begin(phost, POINTS);
 	EVE_CoDl_colorArgb_ex(phost, color);
 	EVE_CoDl_vertexFormat(phost, 4);
@@ -70,6 +89,28 @@ ESD_CORE_EXPORT void Esd_Render_Circle_Stroke(
 	// Use local rendering context, bypass EVE_CoDl display list functions.
 	EVE_CoCmd_dl(phost, SAVE_CONTEXT());
 
+#if ESD_QUALITY
+	if (Esd_Quality_Reduced())
+	{
+		// Inner circle marked in the stencil only, the inner edge is not anti-aliased
+		EVE_CoCmd_dl(phost, COLOR_MASK(0, 0, 0, 0));
+		EVE_CoCmd_dl(phost, STENCIL_FUNC(ALWAYS, 1, 255));
+		EVE_CoCmd_dl(phost, STENCIL_OP(REPLACE, REPLACE));
+		EVE_CoCmd_dl(phost, POINT_SIZE(innerRadius));
+		EVE_CoCmd_dl(phost, VERTEX2F(x, y));
+
+		// Outer circle
+		EVE_CoCmd_dl(phost, COLOR_MASK(1, 1, 1, 1));
+		EVE_CoCmd_dl(phost, STENCIL_FUNC(NOTEQUAL, 1, 255));
+		EVE_CoCmd_dl(phost, POINT_SIZE(outerRadius));
+		EVE_CoCmd_dl(phost, VERTEX2F(x, y));
+
+		EVE_CoCmd_dl(phost, RESTORE_CONTEXT());
+		EVE_CoDl_end(phost);
+		return;
+	}
+#endif
+
 	// Outer reset
 	EVE_CoCmd_dl(phost, COLOR_MASK(0, 0, 0, 1));
 	EVE_CoCmd_dl(phost, STENCIL_FUNC(ALWAYS, 0, 1));
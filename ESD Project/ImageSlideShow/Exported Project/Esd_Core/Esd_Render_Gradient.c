@@ -4,6 +4,7 @@
 #include "Esd_GpuAlloc.h"
 #include "Esd_BitmapHandle.h"
 #include "Esd_Math.h"
+#include "Esd_Quality.h"
 
 #include "math.h"
 
@@ -18,6 +19,7 @@ ESD_CORE_EXPORT void Esd_Render_MultiGradient(int16_t x, int16_t y, int16_t widt
 	EVE_HalContext *phost = Esd_GetHost();
 	Esd_Context *ec = Esd_CurrentContext;
 	uint32_t addr;
+	uint16_t cell;
 	bool alpha;
 	union
 	{
@@ -29,6 +31,8 @@ ESD_CORE_EXPORT void Esd_Render_MultiGradient(int16_t x, int16_t y, int16_t widt
 	if (width == 0 || height == 0)
 		return;
 
+	Esd_Render_BatchFlush();
+
 	// Get address of RAM_G used for gradient palette
 	addr = Esd_GpuAlloc_Get(Esd_GAlloc, ec->MultiGradientGpuHandle);
 	if (addr == GA_INVALID)
@@ -38,10 +42,8 @@ ESD_CORE_EXPORT void Esd_Render_MultiGradient(int16_t x, int16_t y, int16_t widt
 		ec->MultiGradientGpuHandle = Esd_GpuAlloc_Alloc(Esd_GAlloc, 2 * 4 * ESD_MULTIGRADIENT_MAX_NB, GA_GC_FLAG);
 		addr = Esd_GpuAlloc_Get(Esd_GAlloc, ec->MultiGradientGpuHandle);
 #ifdef ESD_MULTIGRADIENT_CACHE
-		memset(ec->MultiGradientCache, 0, sizeof(ec->MultiGradientCache));
-		EVE_CoCmd_memZero(phost, addr + (ec->MultiGradientCell * 8), 8);
-		++ec->MultiGradientCell;
-		ec->MultiGradientCell &= (ESD_MULTIGRADIENT_MAX_NB - 1);
+		// Palettes written to the previous allocation are gone
+		ec->MultiGradientCacheNb = 0;
 #endif
 	}
 	if (addr == GA_INVALID)
@@ -67,22 +69,16 @@ ESD_CORE_EXPORT void Esd_Render_MultiGradient(int16_t x, int16_t y, int16_t widt
 		color.values[3] = ESD_COLOR_RGB565(bottomRight);
 	}
 
-	// Select cell address directly
-	addr += (ec->MultiGradientCell * 8);
+	cell = ec->MultiGradientCell;
 
 #ifdef ESD_MULTIGRADIENT_CACHE
+	// Reuse the cell of a recent gradient with the same colours
 	bool cached = false;
-	for (int16_t i = 7; i >= 0; --i)
+	for (int16_t i = 0; i < ec->MultiGradientCacheNb; ++i)
 	{
 		if (ec->MultiGradientCache[i] == color.cache)
 		{
-			// If i == (ec->MultiGradientCacheIdx - 1),
-			// then the cell will be (ec->MultiGradientCell - 1).
-			// Adjust addr accordingly.
-			int16_t cellOffset = ec->MultiGradientCacheIdx - i;
-			if (cellOffset <= 0)
-				cellOffset += 8;
-			addr -= ((uint16_t)cellOffset * 8);
+			cell = ec->MultiGradientCacheCell[i];
 			cached = true;
 			break;
 		}
@@ -91,24 +87,28 @@ ESD_CORE_EXPORT void Esd_Render_MultiGradient(int16_t x, int16_t y, int16_t widt
 #endif
 	{
 		// Write gradient palette to RAM_G
-		EVE_CoCmd_memWrite(phost, addr, 8);
+		EVE_CoCmd_memWrite(phost, addr + (cell * 8), 8);
 		EVE_Cmd_wr16(phost, color.values[0]);
 		EVE_Cmd_wr16(phost, color.values[1]);
 		EVE_Cmd_wr16(phost, color.values[2]);
 		EVE_Cmd_wr16(phost, color.values[3]);
 #ifdef ESD_MULTIGRADIENT_CACHE
 		ec->MultiGradientCache[ec->MultiGradientCacheIdx] = color.cache;
+		ec->MultiGradientCacheCell[ec->MultiGradientCacheIdx] = cell;
+		if (ec->MultiGradientCacheNb < ESD_MULTIGRADIENT_CACHE_NB)
+			++ec->MultiGradientCacheNb;
+		if (++ec->MultiGradientCacheIdx >= ESD_MULTIGRADIENT_CACHE_NB)
+			ec->MultiGradientCacheIdx = 0;
 #endif
 
 		// Move to the next cell in the bitmap for next gradient
 		++ec->MultiGradientCell;
 		ec->MultiGradientCell &= (ESD_MULTIGRADIENT_MAX_NB - 1);
-#ifdef ESD_MULTIGRADIENT_CACHE
-		++ec->MultiGradientCacheIdx;
-		ec->MultiGradientCacheIdx &= 7;
-#endif
 	}
 
+	// Select cell address directly
+	addr += (cell * 8);
+
 	// Set required state
 	EVE_CoDl_colorArgb_ex(phost, ESD_ARGB_WHITE);
 
@@ -171,6 +171,8 @@ ESD_CORE_EXPORT void Esd_Render_MultiGradient_Rounded(int16_t x, int16_t y, int1
 {
 	EVE_HalContext *phost = Esd_GetHost();
 
+	Esd_Render_BatchFlush();
+
 	// EVE_CoDl_saveContext(phost);
 
 	// Set alpha of the target rendering area to 255
@@ -191,6 +193,7 @@ ESD_CORE_EXPORT void Esd_Render_MultiGradient_Rounded(int16_t x, int16_t y, int1
 	// Draw rounded rectangle as masking shape
 	EVE_CoDl_blendFunc(Esd_Host, ZERO, ONE_MINUS_SRC_ALPHA);
 	Esd_Render_RectF(x << 4, y << 4, width << 4, height << 4, radius, ESD_COMPOSE_RGB_ALPHA(0xFFFFFF, alpha));
+	Esd_Render_BatchFlush(); // Under this blend function
 
 	// Draw color using mask alpha
 	EVE_CoDl_blendFunc(Esd_Host, ONE_MINUS_DST_ALPHA, ONE);
@@ -201,6 +204,31 @@ ESD_CORE_EXPORT void Esd_Render_MultiGradient_Rounded(int16_t x, int16_t y, int1
 	EVE_CoDl_blendFunc_default(Esd_Host);
 }
 
+#if ESD_QUALITY
+// Color of the linear gradient from a to b at point p
+static esd_argb32_t gradientColorAt(int32_t px, int32_t py, int32_t ax, int32_t ay, int32_t bx, int32_t by, esd_argb32_t color1, esd_argb32_t color2)
+{
+	int32_t dx = bx - ax;
+	int32_t dy = by - ay;
+	int32_t len = dx * dx + dy * dy;
+	int32_t t;
+	esd_argb32_t res = 0;
+	int shift;
+
+	if (!len)
+		return color1;
+	t = (int32_t)(((int64_t)((px - ax) * dx + (py - ay) * dy) << 8) / len);
+	t = min(max(t, 0), 256);
+	for (shift = 0; shift < 32; shift += 8)
+	{
+		int32_t c1 = (color1 >> shift) & 0xFF;
+		int32_t c2 = (color2 >> shift) & 0xFF;
+		res |= (esd_argb32_t)(c1 + (((c2 - c1) * t) >> 8)) << shift;
+	}
+	return res;
+}
+#endif
+
 ESD_CORE_EXPORT void Esd_Render_RectF_Grad(esd_int32_f4_t x, esd_int32_f4_t y, esd_int32_f4_t w, esd_int32_f4_t h, esd_argb32_t color1, esd_argb32_t color2, int16_t direction, uint8_t style)
 {
 
@@ -215,6 +243,8 @@ ESD_CORE_EXPORT void Esd_Render_RectF_Grad(esd_int32_f4_t x, esd_int32_f4_t y, e
 	if (w1 == 0 || h1 == 0)
 		return;
 
+	Esd_Render_BatchFlush();
+
 	// FIXME: Use rect for parameters
 	Esd_Rect16 rect = {
 		.X = x0,
@@ -229,6 +259,7 @@ ESD_CORE_EXPORT void Esd_Render_RectF_Grad(esd_int32_f4_t x, esd_int32_f4_t y, e
 		EVE_CoDl_saveContext(phost);
 		Esd_Scissor_Set(rect);
 		Esd_Render_Rect(x0, y0, w1, h1, 1, color1);
+		Esd_Render_BatchFlush(); // Inside the scissor
 		EVE_CoDl_restoreContext(phost);
 		return;
 	}
@@ -281,6 +312,20 @@ ESD_CORE_EXPORT void Esd_Render_RectF_Grad(esd_int32_f4_t x, esd_int32_f4_t y, e
 			dy = (int16_t)(0.4 * h1 * sine);
 		}
 
+#if ESD_QUALITY
+		if (Esd_Quality_Reduced())
+		{
+			// Bilinear between the corner colors, close enough to the linear gradient while quality is reduced
+			int16_t x2 = x0 + w1;
+			int16_t y2 = y0 + h1;
+			Esd_Render_MultiGradient(x0, y0, w1, h1,
+			    gradientColorAt(x0, y0, x1 - dx, y1 - dy, x1 + dx, y1 + dy, color1, color2),
+			    gradientColorAt(x2, y0, x1 - dx, y1 - dy, x1 + dx, y1 + dy, color1, color2),
+			    gradientColorAt(x0, y2, x1 - dx, y1 - dy, x1 + dx, y1 + dy, color1, color2),
+			    gradientColorAt(x2, y2, x1 - dx, y1 - dy, x1 + dx, y1 + dy, color1, color2));
+			return;
+		}
+#endif
 		Esd_Rect16 s = Esd_Scissor_Set(rect);
 		EVE_CoCmd_gradient(phost, x1 - dx, y1 - dy, color1, x1 + dx, y1 + dy, color2); // original
 		Esd_Scissor_Reset(s);
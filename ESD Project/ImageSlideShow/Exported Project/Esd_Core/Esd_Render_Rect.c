@@ -11,6 +11,11 @@ ESD_CORE_EXPORT void Esd_Render_RectF(esd_int32_f4_t x, esd_int32_f4_t y, esd_in
 	int32_t y0 = y + radius;
 	int32_t x1 = x + w - 16 - radius;
 	int32_t y1 = y + h - 16 - radius;
+	if (Esd_Render_Batching())
+	{
+		Esd_Render_BatchAdd(RECTS, width, color, x0, y0, x1, y1);
+		return;
+	}
 	EVE_CoDl_colorArgb_ex(phost, color);
 	EVE_CoDl_lineWidth(phost, width);
 	EVE_CoDl_begin(phost, RECTS);
@@ -40,6 +45,8 @@ ESD_CORE_EXPORT void Esd_Render_Rect_Stroke(
 		return;
 	}
 
+	Esd_Render_BatchFlush();
+
 	switch (stroke)
 	{
 	case ESD_STROKE_INNER:
@@ -0,0 +1,211 @@
+
+#include "Esd_Render.h"
+
+#include "Esd_Context.h"
+#include "Esd_Scissor.h"
+#include "Esd_BitmapHandle.h"
+#include "Esd_GpuAlloc.h"
+
+#include <string.h>
+
+/*
+Static text is rendered once on the host from the glyphs of a legacy or ROM font,
+and uploaded as an L8 bitmap. Drawing it afterwards costs one bitmap vertex,
+rather than one vertex per character from the coprocessor.
+*/
+
+// Number of bytes composited on the host at a time, the text bitmap is uploaded in bands of this size
+#ifndef ESD_TEXTRUN_BAND_BYTES
+#define ESD_TEXTRUN_BAND_BYTES 2048
+#endif
+
+// Maximum width and height of a pre-rendered text bitmap, FT80X is further limited to 511 by BITMAP_SIZE
+#ifndef ESD_TEXTRUN_MAX_SIZE
+#define ESD_TEXTRUN_MAX_SIZE 2047
+#endif
+
+extern ESD_CORE_EXPORT Esd_GpuAlloc *Esd_GAlloc;
+
+void Esd_CoDl_Bitmap_Vertex(int16_t x, int16_t y, uint8_t handle, uint16_t cell);
+
+static uint8_t s_TextRunBand[ESD_TEXTRUN_BAND_BYTES];
+static uint8_t s_TextRunGlyph[ESD_TEXTRUN_BAND_BYTES];
+
+static uint32_t Esd_TextRun_Hash(const char *s)
+{
+	uint32_t hash = 2166136261UL;
+	while (*s)
+	{
+		hash ^= (uint8_t)*s++;
+		hash *= 16777619UL;
+	}
+	return hash;
+}
+
+// Value of one glyph pixel expanded to 0..255
+static uint8_t Esd_TextRun_Pixel(const uint8_t *row, uint32_t format, uint32_t px)
+{
+	switch (format)
+	{
+	case L1:
+		return ((row[px >> 3] >> (7 - (px & 7))) & 0x1) ? 255 : 0;
+	case L2:
+		return ((row[px >> 2] >> (6 - ((px & 3) << 1))) & 0x3) * 85;
+	case L4:
+		return ((row[px >> 1] >> ((px & 1) ? 0 : 4)) & 0xF) * 17;
+	case L8:
+		return row[px];
+	}
+	return 0;
+}
+
+// Render the text into a new bitmap, returns false if the coprocessor should render this text instead
+static bool Esd_TextRun_Rasterize(Esd_TextRun *run, Esd_FontInfo *fontInfo, const char *s)
+{
+	EVE_HalContext *phost = Esd_GetHost();
+	uint8_t widths[128];
+	uint32_t fontAddr;
+	uint32_t format, stride, cellWidth, height, glyphAddr, first;
+	uint32_t textWidth = 0;
+	uint32_t width = 0;
+	uint32_t bandRows, row;
+	uint32_t addr;
+	const char *c;
+
+	switch (fontInfo->Type)
+	{
+	case ESD_FONT_ROM:
+		fontAddr = EVE_Hal_rd32(phost, ROMFONT_TABLEADDRESS) + (EVE_GPU_FONT_TABLE_SIZE * (((Esd_RomFontInfo *)(void *)fontInfo)->RomFont - 16));
+		first = 0;
+		break;
+	case ESD_FONT_LEGACY:
+		fontAddr = Esd_LoadFont(fontInfo);
+		first = fontInfo->FirstChar;
+		break;
+	default:
+		// Extended fonts may be compressed or stored in flash
+		return false;
+	}
+	if (fontAddr == GA_INVALID)
+		return false;
+
+	// Legacy metric block, widths followed by the glyph bitmap layout
+	EVE_Hal_rdMem(phost, widths, fontAddr, 128);
+	format = EVE_Hal_rd32(phost, fontAddr + 128);
+	stride = EVE_Hal_rd32(phost, fontAddr + 132);
+	cellWidth = EVE_Hal_rd32(phost, fontAddr + 136);
+	height = EVE_Hal_rd32(phost, fontAddr + 140);
+	glyphAddr = EVE_Hal_rd32(phost, fontAddr + 144);
+
+	for (c = s; *c; ++c)
+	{
+		uint8_t ch = (uint8_t)*c;
+		if (ch >= 128 || ch < first)
+			return false;
+		if (textWidth + cellWidth > width)
+			width = textWidth + cellWidth;
+		textWidth += widths[ch];
+	}
+	if (!width || !height || width > ESD_TEXTRUN_MAX_SIZE || height > ESD_TEXTRUN_MAX_SIZE
+	    || (EVE_CHIPID < EVE_FT810 && (width > 511 || height > 511))
+	    || stride > width || width > ESD_TEXTRUN_BAND_BYTES)
+		return false;
+
+	run->BitmapInfo.Width = width;
+	run->BitmapInfo.Height = height;
+	run->BitmapInfo.Format = L8;
+	run->BitmapInfo.Stride = width;
+	run->BitmapInfo.Size = width * height;
+	run->BitmapInfo.BitmapHandle = ~0;
+	run->BitmapInfo.GpuHandle = Esd_GpuAlloc_Alloc(Esd_GAlloc, run->BitmapInfo.Size, GA_GC_FLAG);
+	addr = Esd_GpuAlloc_Get(Esd_GAlloc, run->BitmapInfo.GpuHandle);
+	if (addr == GA_INVALID)
+		return false;
+
+	// Composite the glyphs band by band, glyph cells may overlap when the advance is smaller than the cell
+	bandRows = ESD_TEXTRUN_BAND_BYTES / width;
+	for (row = 0; row < height; row += bandRows)
+	{
+		uint32_t rows = (height - row) < bandRows ? (height - row) : bandRows;
+		uint32_t cursor = 0;
+		memset(s_TextRunBand, 0, rows * width);
+		for (c = s; *c; ++c)
+		{
+			uint8_t ch = (uint8_t)*c;
+			uint32_t r, px;
+			EVE_Hal_rdMem(phost, s_TextRunGlyph, glyphAddr + ((ch - first) * height + row) * stride, rows * stride);
+			for (r = 0; r < rows; ++r)
+			{
+				const uint8_t *src = &s_TextRunGlyph[r * stride];
+				uint8_t *dst = &s_TextRunBand[r * width + cursor];
+				for (px = 0; px < cellWidth; ++px)
+				{
+					uint8_t v = Esd_TextRun_Pixel(src, format, px);
+					if (v > dst[px])
+						dst[px] = v;
+				}
+			}
+			cursor += widths[ch];
+		}
+		EVE_Hal_wrMem(phost, addr + row * width, s_TextRunBand, rows * width);
+	}
+
+	run->TextWidth = textWidth;
+	return true;
+}
+
+ESD_CORE_EXPORT void Esd_Render_TextRun(Esd_TextRun *run, Esd_FontInfo *fontInfo, int16_t font, int16_t x, int16_t y, uint16_t options, bool bottom, int16_t baseLine, int16_t capsHeight, int16_t xOffset, const char *s)
+{
+	EVE_HalContext *phost = Esd_GetHost();
+	uint32_t hash;
+	int16_t bx, by;
+	uint8_t handle;
+
+	if (!s || !*s)
+		return;
+
+	Esd_Render_BatchFlush();
+
+	hash = Esd_TextRun_Hash(s);
+	if (run->Font != fontInfo || run->Hash != hash
+	    || Esd_GpuAlloc_Get(Esd_GAlloc, run->BitmapInfo.GpuHandle) == GA_INVALID)
+	{
+		// Text changed, or the bitmap was garbage collected.
+		// The previous bitmap is left to the garbage collector, as it may still be on screen
+		run->BitmapInfo.GpuHandle = GA_HANDLE_INVALID;
+		run->Font = NULL;
+		if (!fontInfo || (options & OPT_FORMAT) || !Esd_TextRun_Rasterize(run, fontInfo, s))
+		{
+			EVE_CoCmd_text_ex(phost, x, y, font, options, bottom, baseLine, capsHeight, xOffset, s);
+			return;
+		}
+		run->Font = fontInfo;
+		run->Hash = hash;
+	}
+
+	handle = Esd_CoDl_SetupBitmap(&run->BitmapInfo);
+	if (!ESD_BITMAPHANDLE_VALID(handle))
+	{
+		EVE_CoCmd_text_ex(phost, x, y, font, options, bottom, baseLine, capsHeight, xOffset, s);
+		return;
+	}
+
+	// Same placement as EVE_CoCmd_text_ex
+	if (options & OPT_CENTERY)
+		by = y - (baseLine - (capsHeight >> 1));
+	else if (bottom)
+		by = y - baseLine;
+	else
+		by = y - (baseLine - capsHeight);
+	bx = x - xOffset;
+	if (options & OPT_RIGHTX)
+		bx -= run->TextWidth;
+	else if (options & OPT_CENTERX)
+		bx -= run->TextWidth >> 1;
+
+	EVE_CoDl_begin(phost, BITMAPS);
+	Esd_CoDl_Bitmap_Vertex(bx, by, handle, 0);
+	EVE_CoDl_end(phost);
+}
+
+/* end of file */
@@ -6,6 +6,7 @@ Author: Jan Boon <jan.boon@kaetemi.be>
 
 #include "Esd_ResourceInfo.h"
 #include "Esd_Context.h"
+#include "Esd_Utility.h"
 
 #ifndef NDEBUG
 #define ESD_RESOURCEINFO_DEBUG
@@ -41,11 +42,201 @@ ESD_CORE_EXPORT void Esd_ResourceInfo_LoadFlashAddressEx(Esd_ResourceInfo *resou
 }
 #endif
 
+// Bundle entries as read from the index at open, the metadata blocks are read from the card on demand
+typedef struct
+{
+	uint32_t NameHash;
+	uint32_t Offset;
+	uint32_t Size : 23;
+	uint32_t Compressed : 2;
+	uint32_t MetadataSize : 7;
+} Esd_BundleEntry;
+
+static EVE_Asset s_Bundle;
+static Esd_BundleEntry s_BundleIndex[ESD_BUNDLE_ENTRIES];
+static uint32_t s_BundleCount = 0;
+static uint32_t s_BundleMetadata = 0;
+static uint32_t s_BundleCrc = 0;
+static bool s_BundleOpen = false;
+
+static uint32_t Esd_Bundle_Hash(const char *s)
+{
+	uint32_t hash = 2166136261UL;
+	while (*s)
+	{
+		hash ^= (uint8_t)*s++;
+		hash *= 16777619UL;
+	}
+	return hash;
+}
+
+ESD_CORE_EXPORT bool Esd_Bundle_Open(const char *file)
+{
+	EVE_HalContext *phost = Esd_GetHost();
+	uint8_t buffer[ESD_BUNDLE_ENTRY * 16];
+	uint32_t count, i;
+
+	Esd_Bundle_Close();
+	if (!file || !EVE_Util_openAsset(phost, &s_Bundle, file))
+		return false;
+
+	if (EVE_Util_readAsset(phost, &s_Bundle, 0, buffer, ESD_BUNDLE_HEADER) != ESD_BUNDLE_HEADER
+	    || ESD_RD32_LE(buffer, 0) != ESD_BUNDLE_SIGNATURE || ESD_RD16_LE(buffer, 4) != ESD_BUNDLE_VERSION)
+	{
+		esd_resourceinfo_printf("Bundle %s is not a valid resource bundle\n", file);
+		EVE_Util_closeAsset(phost, &s_Bundle);
+		return false;
+	}
+	count = ESD_RD16_LE(buffer, 6);
+	s_BundleMetadata = ESD_RD32_LE(buffer, 8);
+	s_BundleCrc = ESD_RD32_LE(buffer, 12);
+	if (count > ESD_BUNDLE_ENTRIES)
+	{
+		esd_resourceinfo_printf("Bundle %s has %i entries, only %i supported\n", file, (int)count, (int)ESD_BUNDLE_ENTRIES);
+		EVE_Util_closeAsset(phost, &s_Bundle);
+		return false;
+	}
+
+	// Read the index in blocks, the card is read by sector either way
+	for (i = 0; i < count; ++i)
+	{
+		Esd_BundleEntry *entry = &s_BundleIndex[i];
+		uint32_t offset = (i & 15) * ESD_BUNDLE_ENTRY;
+		uint32_t size;
+		if (!offset)
+		{
+			size = ((count - i) < 16 ? (count - i) : 16) * ESD_BUNDLE_ENTRY;
+			if (EVE_Util_readAsset(phost, &s_Bundle, ESD_BUNDLE_HEADER + i * ESD_BUNDLE_ENTRY, buffer, size) != size)
+				break;
+		}
+		entry->NameHash = ESD_RD32_LE(buffer, offset);
+		entry->Offset = ESD_RD32_LE(buffer, offset + 4);
+		size = ESD_RD32_LE(buffer, offset + 8);
+		entry->Size = size;
+		entry->Compressed = buffer[offset + 12];
+		entry->MetadataSize = buffer[offset + 13];
+		if (size != entry->Size || buffer[offset + 12] > ESD_RESOURCE_IMAGE || buffer[offset + 13] > ESD_METADATA_MAX
+		    || entry->Offset + size > s_Bundle.Size || (i && entry->NameHash < s_BundleIndex[i - 1].NameHash))
+			break;
+	}
+	if (i < count)
+	{
+		esd_resourceinfo_printf("Bundle %s has an invalid index entry %i\n", file, (int)i);
+		EVE_Util_closeAsset(phost, &s_Bundle);
+		return false;
+	}
+
+	s_BundleCount = count;
+	s_BundleOpen = true;
+	esd_resourceinfo_printf("Opened bundle %s with %i resources\n", file, (int)count);
+	return true;
+}
+
+ESD_CORE_EXPORT void Esd_Bundle_Close()
+{
+	if (!s_BundleOpen)
+		return;
+	EVE_Util_closeAsset(Esd_GetHost(), &s_Bundle);
+	s_BundleCount = 0;
+	s_BundleOpen = false;
+}
+
+ESD_CORE_EXPORT int32_t Esd_Bundle_Find(const char *file)
+{
+	uint32_t hash;
+	uint32_t lo = 0;
+	uint32_t hi;
+
+	if (!s_BundleOpen || !file)
+		return -1;
+
+	hash = Esd_Bundle_Hash(file);
+	hi = s_BundleCount;
+	while (lo < hi)
+	{
+		uint32_t mid = (lo + hi) >> 1;
+		if (s_BundleIndex[mid].NameHash < hash)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	if (lo < s_BundleCount && s_BundleIndex[lo].NameHash == hash)
+		return (int32_t)lo;
+	return -1;
+}
+
+ESD_CORE_EXPORT bool Esd_Bundle_ReadCrc(int32_t index, uint32_t *crc, uint32_t *size)
+{
+	uint8_t buffer[8];
+
+	if (!s_BundleOpen || index < 0 || (uint32_t)index >= s_BundleCount || !s_BundleCrc)
+		return false;
+
+	if (EVE_Util_readAsset(Esd_GetHost(), &s_Bundle, s_BundleCrc + index * 8, buffer, 8) != 8)
+		return false;
+
+	*crc = ESD_RD32_LE(buffer, 0);
+	*size = ESD_RD32_LE(buffer, 4);
+	return *size != 0;
+}
+
+ESD_CORE_EXPORT bool Esd_Bundle_ReadMetadata(int32_t index, uint8_t *metadata)
+{
+	uint32_t size;
+
+	if (!s_BundleOpen || index < 0 || (uint32_t)index >= s_BundleCount || !metadata)
+		return false;
+
+	size = s_BundleIndex[index].MetadataSize;
+	if (!size)
+		return false;
+
+	return EVE_Util_readAsset(Esd_GetHost(), &s_Bundle, s_BundleMetadata + index * ESD_METADATA_MAX, metadata, size) == size;
+}
+
+ESD_CORE_EXPORT bool Esd_Bundle_Load(int32_t index, uint32_t addr, uint32_t *imageFormat)
+{
+	EVE_HalContext *phost = Esd_GetHost();
+	Esd_BundleEntry *entry;
+	uint32_t size;
+
+	if (!s_BundleOpen || index < 0 || (uint32_t)index >= s_BundleCount)
+		return false;
+
+	entry = &s_BundleIndex[index];
+
+	// Compressed payloads are sent to the coprocessor including their padding, unless they end the file
+	size = (entry->Size + 3) & ~3UL;
+	if (entry->Offset + size > s_Bundle.Size)
+		size = entry->Size;
+
+	switch (entry->Compressed)
+	{
+	case ESD_RESOURCE_RAW:
+		return EVE_Util_loadAssetRegion(phost, &s_Bundle, entry->Offset, addr, entry->Size);
+	case ESD_RESOURCE_DEFLATE:
+		EVE_CoCmd_inflate(phost, addr);
+		return EVE_Util_inflateAssetRegion(phost, &s_Bundle, entry->Offset, size);
+	case ESD_RESOURCE_IMAGE:
+		EVE_CoCmd_loadImage(phost, addr, OPT_NODL);
+		if (!EVE_Util_inflateAssetRegion(phost, &s_Bundle, entry->Offset, size))
+			return false;
+		if (!EVE_Cmd_waitFlush(phost))
+			return false;
+		if (imageFormat)
+			*imageFormat = EVE_Hal_rd32(phost, 0x3097e8);
+		return true;
+	}
+	return false;
+}
+
 ESD_CORE_EXPORT uint32_t Esd_LoadResourceEx(Esd_ResourceInfo *resourceInfo, uint8_t *metadata, uint32_t *imageFormat)
 {
 	EVE_HalContext *phost = Esd_GetHost();
 	int32_t flashAddr = FA_INVALID;
+	int32_t bundleIndex = -1;
 	uint32_t addr;
+	uint32_t crc, crcSize;
 	bool loaded;
 	(void)phost;
 
@@ -98,8 +289,16 @@ ESD_CORE_EXPORT uint32_t Esd_LoadResourceEx(Esd_ResourceInfo *resourceInfo, uint
 		break;
 	}
 
-	// Load metadata from file on SD card
-	if (metadata && resourceInfo->Type == ESD_RESOURCE_FILE)
+	// Look up the file in the open bundle
+	if (resourceInfo->Type == ESD_RESOURCE_FILE)
+		bundleIndex = Esd_Bundle_Find(resourceInfo->File);
+
+	// Load metadata from the bundle index, or from file on SD card
+	if (metadata && bundleIndex >= 0)
+	{
+		Esd_Bundle_ReadMetadata(bundleIndex, metadata);
+	}
+	else if (metadata && resourceInfo->Type == ESD_RESOURCE_FILE)
 	{
 		// Generate metafile name
 		size_t nameLen = strlen(resourceInfo->File);
@@ -131,6 +330,15 @@ ESD_CORE_EXPORT uint32_t Esd_LoadResourceEx(Esd_ResourceInfo *resourceInfo, uint
 	switch (resourceInfo->Type)
 	{
 	case ESD_RESOURCE_FILE: {
+		if (bundleIndex >= 0)
+		{
+			loaded = Esd_Bundle_Load(bundleIndex, addr, imageFormat);
+
+			// Checked in the background by Esd_GpuAlloc_Scrub, and after a coprocessor fault
+			if (loaded && Esd_Bundle_ReadCrc(bundleIndex, &crc, &crcSize))
+				Esd_GpuAlloc_SealCrc(Esd_GAlloc, resourceInfo->GpuHandle, crc, crcSize);
+			break;
+		}
 		switch (resourceInfo->Compressed)
 		{
 		case ESD_RESOURCE_RAW:
@@ -203,7 +411,7 @@ ESD_CORE_EXPORT void Esd_FreeResource(Esd_ResourceInfo *resourceInfo)
 	if (!resourceInfo)
 		return;
 
-	Esd_GpuAlloc_Free(Esd_GAlloc, resourceInfo->GpuHandle);
+	Esd_DeferredGpuFree(resourceInfo->GpuHandle); // The displayed frame may still reference it
 	resourceInfo->GpuHandle.Id = MAX_NUM_ALLOCATIONS;
 #ifdef ESD_LITTLEFS_FLASH
 	resourceInfo->FlashAddress = FA_INVALID;
@@ -41,8 +41,8 @@ ESD_ENUM(Esd_ResourceCompression, DisplayName = "Resource Compression")
 #define ESD_RESOURCE_DEFLATE 1
 // Load to RAM using CMD_LOADIMAGE
 #define ESD_RESOURCE_IMAGE 2
-// Load to RAM using CMD_VIDEOFRAME
-// TBD: #define ESD_RESOURCE_VIDEOFRAME 3
+// Glyphs of an extended font, stored as separately deflated pages of 128 characters, loaded on demand (see Esd_Font_LoadText)
+#define ESD_RESOURCE_PAGED 3
 ESD_END()
 
 // Both flash and direct flash have the same type bit set on purpose
@@ -139,6 +139,51 @@ Type-specific data follows immediately after
 
 */
 
+/// Resource bundle signature, serialized byte sequence equals "ESDB"
+#define ESD_BUNDLE_SIGNATURE 0x42445345
+#define ESD_BUNDLE_VERSION 1
+#define ESD_BUNDLE_HEADER 16
+#define ESD_BUNDLE_ENTRY 16
+
+/// Payloads in a bundle start on a sector boundary
+#define ESD_BUNDLE_ALIGN 512
+
+// Define ESD_BUNDLE_FILE to the name of a bundle on the SD card to open it at Esd_Start
+
+// Maximum number of resources in the open bundle, the index takes 12 bytes of RAM per entry
+#ifndef ESD_BUNDLE_ENTRIES
+#define ESD_BUNDLE_ENTRIES 128
+#endif
+
+/*
+
+Resource bundle format (little-endian):
+
+0 uint32 signature; // ESD_BUNDLE_SIGNATURE
+4 uint16 version; // ESD_BUNDLE_VERSION
+6 uint16 count; // Number of entries
+8 uint32 metadataOffset; // Offset of the metadata table, count blocks of ESD_METADATA_MAX bytes in entry order
+12 uint32 crcOffset; // Offset of the checksum table, 0 if the bundle has none
+
+Followed by count entries, sorted by name hash:
+
+0 uint32 nameHash; // FNV-1a hash of the resource file name, as referenced by Esd_ResourceInfo::File
+4 uint32 offset; // Offset of the payload, a multiple of ESD_BUNDLE_ALIGN
+8 uint32 size; // Size of the payload, zero padded to a multiple of 4 in the file
+12 uint8 compression; // Same as the metadata compression
+13 uint8 metadataSize; // Size of the metadata block of this entry, 0 if the resource has no .esdm file
+14 uint16 reserved;
+
+The checksum table holds count pairs in entry order:
+
+0 uint32 crc; // CMD_MEMCRC of the resource as loaded into RAM_G
+4 uint32 size; // Number of bytes loaded into RAM_G, 0 where not known ahead, such as for images
+
+The metadata blocks hold the .esdm contents with the format and layout of each resource.
+Payloads are stored contiguously, so a resource loads with whole sector reads from the card.
+
+*/
+
 /// Read utility
 #define ESD_RD32_LE(buffer, offset) ((uint32_t)buffer[offset] | (((uint32_t)buffer[offset + 1]) << 8) | (((uint32_t)buffer[offset + 2]) << 16) | (((uint32_t)buffer[offset + 3]) << 24))
 #define ESD_RD16_LE(buffer, offset) ((uint16_t)buffer[offset] | (((uint16_t)buffer[offset + 1]) << 8))
@@ -182,6 +227,26 @@ Type-specific data follows immediately after
 ESD_CORE_EXPORT uint32_t Esd_LoadResourceEx(Esd_ResourceInfo *resourceInfo, uint8_t *metadata, uint32_t *imageFormat);
 ESD_CORE_EXPORT uint32_t Esd_LoadResource(Esd_ResourceInfo *resourceInfo, uint32_t *imageFormat);
 
+/// Open a resource bundle, file resources found in it are then loaded from the bundle instead of their own files.
+/// Only one bundle is open at a time, opening a bundle closes the previous one
+ESD_CORE_EXPORT bool Esd_Bundle_Open(const char *file);
+
+/// Close the open resource bundle, file resources are loaded from their own files again
+ESD_CORE_EXPORT void Esd_Bundle_Close();
+
+/// Find a resource file in the open bundle, returns the entry index or -1
+ESD_CORE_EXPORT int32_t Esd_Bundle_Find(const char *file);
+
+/// Load the payload of a bundle entry to RAM_G, compressed entries are loaded through the coprocessor.
+/// Returns the output image format if the entry is an image
+ESD_CORE_EXPORT bool Esd_Bundle_Load(int32_t index, uint32_t addr, uint32_t *imageFormat);
+
+/// Read the checksum of a bundle entry as loaded into RAM_G, returns false if the bundle has none for the entry
+ESD_CORE_EXPORT bool Esd_Bundle_ReadCrc(int32_t index, uint32_t *crc, uint32_t *size);
+
+/// Read the metadata of a bundle entry, returns false if the entry has none
+ESD_CORE_EXPORT bool Esd_Bundle_ReadMetadata(int32_t index, uint8_t *metadata);
+
 /// Free a currently loaded resource from RAM_G. Can be used to enforce reloading a resource.
 ESD_CORE_EXPORT void Esd_FreeResource(Esd_ResourceInfo *resourceInfo);
 
@@ -24,9 +24,9 @@ ESD_CORE_EXPORT Esd_Rect16 Esd_Scissor_Set(Esd_Rect16 rect)
 	return state;
 }
 
-ESD_CORE_EXPORT void Esd_Scissor_Adjust(Esd_Rect16 rect, Esd_Rect16 state)
+// Crop rect to the state area on the host
+static Esd_Rect16 Esd_Scissor_Crop(Esd_Rect16 rect, Esd_Rect16 state)
 {
-	EVE_HalContext *phost = Esd_GetHost();
 	int16_t x1diff;
 	int16_t y1diff;
 	int16_t x2diff;
@@ -58,17 +58,73 @@ ESD_CORE_EXPORT void Esd_Scissor_Adjust(Esd_Rect16 rect, Esd_Rect16 state)
 		rect.Width = 0;
 	if (rect.Height < 0)
 		rect.Height = 0;
+	return rect;
+}
 
-	EVE_CoDl_scissorXY(phost, rect.X, rect.Y);
-	EVE_CoDl_scissorSize(phost, rect.Width, rect.Height);
+// Emit the scissor area, only the parts that differ from the current state
+static void Esd_Scissor_Apply(Esd_Rect16 rect)
+{
+	EVE_HalContext *phost = Esd_GetHost();
+
+	if (EVE_DL_STATE.ScissorX != (uint16_t)rect.X || EVE_DL_STATE.ScissorY != (uint16_t)rect.Y)
+		EVE_CoDl_scissorXY(phost, rect.X, rect.Y);
+	if (EVE_DL_STATE.ScissorWidth != (uint16_t)rect.Width || EVE_DL_STATE.ScissorHeight != (uint16_t)rect.Height)
+		EVE_CoDl_scissorSize(phost, rect.Width, rect.Height);
+}
+
+ESD_CORE_EXPORT void Esd_Scissor_Adjust(Esd_Rect16 rect, Esd_Rect16 state)
+{
+	Esd_Scissor_Apply(Esd_Scissor_Crop(rect, state));
 }
 
 ESD_CORE_EXPORT void Esd_Scissor_Reset(Esd_Rect16 state)
+{
+	Esd_Scissor_Apply(state);
+}
+
+static Esd_Rect16 s_ScissorStack[ESD_SCISSOR_STACK_SIZE];
+static uint32_t s_ScissorDepth = 0;
+static uint32_t s_ScissorFrame = ~0;
+
+ESD_CORE_EXPORT bool Esd_Scissor_Push(Esd_Rect16 rect)
+{
+	Esd_Rect16 state = Esd_Scissor_Get();
+	Esd_Rect16 cropped;
+
+	if (s_ScissorFrame != Esd_CurrentContext->Frame)
+	{
+		// The display list starts with the full screen scissor every frame
+		eve_assert(!s_ScissorDepth);
+		s_ScissorFrame = Esd_CurrentContext->Frame;
+		s_ScissorDepth = 0;
+	}
+	eve_assert(s_ScissorDepth < ESD_SCISSOR_STACK_SIZE);
+	if (s_ScissorDepth < ESD_SCISSOR_STACK_SIZE)
+		s_ScissorStack[s_ScissorDepth] = state;
+	++s_ScissorDepth;
+
+	cropped = Esd_Scissor_Crop(rect, state);
+	if (!cropped.Width || !cropped.Height)
+		return false; // Nothing to emit, the subtree is skipped
+	Esd_Scissor_Apply(cropped);
+	return true;
+}
+
+ESD_CORE_EXPORT void Esd_Scissor_Pop()
+{
+	eve_assert(s_ScissorDepth);
+	if (!s_ScissorDepth)
+		return;
+	--s_ScissorDepth;
+	if (s_ScissorDepth < ESD_SCISSOR_STACK_SIZE)
+		Esd_Scissor_Apply(s_ScissorStack[s_ScissorDepth]);
+}
+
+ESD_CORE_EXPORT bool Esd_Scissor_IsEmpty()
 {
 	EVE_HalContext *phost = Esd_GetHost();
 
-	EVE_CoDl_scissorXY(phost, state.X, state.Y);
-	EVE_CoDl_scissorSize(phost, state.Width, state.Height);
+	return !EVE_DL_STATE.ScissorWidth || !EVE_DL_STATE.ScissorHeight;
 }
 
 /* end of file */
@@ -5,6 +5,11 @@
 #include "Esd_Base.h"
 #include "Esd_Math.h"
 
+// Nesting depth of Esd_Scissor_Push
+#ifndef ESD_SCISSOR_STACK_SIZE
+#define ESD_SCISSOR_STACK_SIZE 8
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -29,6 +34,19 @@ ESD_FUNCTION(Esd_Scissor_Reset, Attributes = ESD_CORE_EXPORT, Category = EveRend
 ESD_PARAMETER(state, Type = Esd_Rect16)
 ESD_CORE_EXPORT void Esd_Scissor_Reset(Esd_Rect16 state);
 
+// Push the current scissor area and crop it to rect. Returns false when nothing inside rect can be visible, the subtree can be skipped, Esd_Scissor_Pop must still be called
+ESD_FUNCTION(Esd_Scissor_Push, Type = bool, Attributes = ESD_CORE_EXPORT, Category = EveRenderFunctions, Include = "Esd_Core.h")
+ESD_PARAMETER(rect, Type = Esd_Rect16)
+ESD_CORE_EXPORT bool Esd_Scissor_Push(Esd_Rect16 rect);
+
+// Restore the scissor area from before the matching Esd_Scissor_Push
+ESD_FUNCTION(Esd_Scissor_Pop, Attributes = ESD_CORE_EXPORT, Category = EveRenderFunctions, Include = "Esd_Core.h")
+ESD_CORE_EXPORT void Esd_Scissor_Pop();
+
+// Returns true when the current scissor area is empty
+ESD_FUNCTION(Esd_Scissor_IsEmpty, Type = bool, Attributes = ESD_CORE_EXPORT, Category = EveRenderFunctions, Include = "Esd_Core.h")
+ESD_CORE_EXPORT bool Esd_Scissor_IsEmpty();
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,190 @@
+
+#include "Esd_Settings.h"
+
+#if ESD_SETTINGS
+
+#include "Esd_Context.h"
+#include "EVE_LoadFile.h"
+#include "diskio.h"
+
+#define ESD_SETTINGS_SECTOR_SIZE 512
+#define ESD_SETTINGS_HEADER_SIZE 16
+#define ESD_SETTINGS_SLOT_SIZE (ESD_SETTINGS_SECTORS * ESD_SETTINGS_SECTOR_SIZE)
+#define ESD_SETTINGS_IMAGE_SIZE (ESD_SETTINGS_SLOT_SIZE - ESD_SETTINGS_HEADER_SIZE)
+
+// Slot as read from and written to the card, word aligned so disk_write does not copy it
+static uint32_t s_Slot[ESD_SETTINGS_SLOT_SIZE / 4];
+#define s_Records ((uint8_t *)&s_Slot[ESD_SETTINGS_HEADER_SIZE / 4])
+
+static DWORD s_Sector; // First sector of the region, 0 when there is none
+static uint32_t s_Sequence; // Of the current image
+static uint8_t s_Current; // Slot holding the current image
+static uint32_t s_Size; // Bytes of records
+static bool s_Dirty;
+static uint32_t s_ChangedMs;
+
+static uint32_t checksum(const uint8_t *data, uint32_t size)
+{
+	uint32_t crc = 0xFFFFFFFFUL;
+	for (uint32_t i = 0; i < size; ++i)
+	{
+		crc ^= data[i];
+		for (int b = 0; b < 8; ++b)
+			crc = (crc >> 1) ^ (0xEDB88320UL & (0 - (crc & 1)));
+	}
+	return ~crc;
+}
+
+// Reads a slot into s_Slot, returns false when it does not hold a valid image
+static bool readSlot(uint8_t slot, uint32_t *sequence)
+{
+	uint32_t size;
+	if (disk_read(0, (BYTE *)s_Slot, s_Sector + (slot * ESD_SETTINGS_SECTORS), ESD_SETTINGS_SECTORS) != RES_OK)
+		return false;
+	if (s_Slot[0] != ESD_SETTINGS_MAGIC)
+		return false;
+	size = s_Slot[2] & 0xFFFF;
+	if (size > ESD_SETTINGS_IMAGE_SIZE || checksum(s_Records, size) != s_Slot[3])
+		return false;
+	*sequence = s_Slot[1];
+	return true;
+}
+
+// Offset of the record with the key, or s_Size
+static uint32_t find(uint8_t key)
+{
+	uint32_t offset = 0;
+	while (offset < s_Size && s_Records[offset] != key)
+		offset += 2 + s_Records[offset + 1];
+	return offset;
+}
+
+static void changed()
+{
+	s_Dirty = true;
+	s_ChangedMs = EVE_millis();
+}
+
+ESD_CORE_EXPORT bool Esd_Settings_Open()
+{
+	static EVE_Asset asset;
+	uint32_t sequence[2];
+	bool valid[2];
+	uint8_t first;
+
+	s_Sector = 0;
+	s_Size = 0;
+	s_Sequence = 0;
+	s_Current = 1; // The first commit goes to slot 0
+	s_Dirty = false;
+
+	if (!EVE_Util_openAsset(Esd_GetHost(), &asset, ESD_SETTINGS_FILE))
+		return false;
+	if (asset.Sector && asset.Size >= 2 * ESD_SETTINGS_SLOT_SIZE)
+		s_Sector = asset.Sector;
+	EVE_Util_closeAsset(Esd_GetHost(), &asset);
+	if (!s_Sector)
+	{
+		eve_printf_debug("%s is missing, too small, or not contiguous\n", ESD_SETTINGS_FILE);
+		return false;
+	}
+
+	// Both slots are checked, slot 0 is read again when it holds the newer image
+	valid[0] = readSlot(0, &sequence[0]);
+	valid[1] = readSlot(1, &sequence[1]);
+	if (valid[0] && (!valid[1] || (int32_t)(sequence[0] - sequence[1]) > 0))
+		first = 0;
+	else if (valid[1])
+		first = 1;
+	else
+		return true; // Blank region
+
+	if (first == 0 && !readSlot(0, &sequence[0]))
+		return true;
+	s_Current = first;
+	s_Sequence = sequence[first];
+	s_Size = s_Slot[2] & 0xFFFF;
+	return true;
+}
+
+ESD_CORE_EXPORT uint32_t Esd_Settings_Get(uint8_t key, void *buffer, uint32_t size)
+{
+	uint32_t offset = find(key);
+	uint32_t stored;
+	if (!key || offset >= s_Size)
+		return 0;
+	stored = s_Records[offset + 1];
+	memcpy(buffer, &s_Records[offset + 2], min(size, stored));
+	return stored;
+}
+
+ESD_CORE_EXPORT void Esd_Settings_Remove(uint8_t key)
+{
+	uint32_t offset = find(key);
+	uint32_t next;
+	if (!key || offset >= s_Size)
+		return;
+	next = offset + 2 + s_Records[offset + 1];
+	memmove(&s_Records[offset], &s_Records[next], s_Size - next);
+	s_Size -= next - offset;
+	changed();
+}
+
+ESD_CORE_EXPORT bool Esd_Settings_Set(uint8_t key, const void *data, uint32_t size)
+{
+	uint32_t offset = find(key);
+
+	if (!key || size > 255)
+		return false;
+	if (offset < s_Size && s_Records[offset + 1] == size && !memcmp(&s_Records[offset + 2], data, size))
+		return true;
+	if (s_Size - (offset < s_Size ? 2 + s_Records[offset + 1] : 0) + 2 + size > ESD_SETTINGS_IMAGE_SIZE)
+		return false;
+
+	Esd_Settings_Remove(key);
+	s_Records[s_Size] = key;
+	s_Records[s_Size + 1] = (uint8_t)size;
+	memcpy(&s_Records[s_Size + 2], data, size);
+	s_Size += 2 + size;
+	changed();
+	return true;
+}
+
+ESD_CORE_EXPORT bool Esd_Settings_Commit()
+{
+	uint8_t slot;
+
+	if (!s_Dirty || !s_Sector)
+		return true;
+
+	// The unused tail is cleared, so a stale record never follows the terminator
+	slot = s_Current ^ 1;
+	memset(&s_Records[s_Size], 0, ESD_SETTINGS_IMAGE_SIZE - s_Size);
+	s_Slot[0] = ESD_SETTINGS_MAGIC;
+	s_Slot[1] = s_Sequence + 1;
+	s_Slot[2] = s_Size;
+	s_Slot[3] = checksum(s_Records, s_Size);
+	if (disk_write(0, (const BYTE *)s_Slot, s_Sector + (slot * ESD_SETTINGS_SECTORS), ESD_SETTINGS_SECTORS) != RES_OK
+	    || disk_ioctl(0, CTRL_SYNC, NULL) != RES_OK)
+	{
+		// Retried on the next change, the previous image is still on the card
+		eve_printf_debug("Settings write failed\n");
+		s_Dirty = false;
+		return false;
+	}
+
+	s_Current = slot;
+	++s_Sequence;
+	s_Dirty = false;
+	return true;
+}
+
+ESD_CORE_EXPORT void Esd_Settings_Idle()
+{
+	if (s_Dirty && EVE_millis() - s_ChangedMs >= ESD_SETTINGS_COMMIT_MS)
+		Esd_Settings_Commit();
+}
+
+#endif /* #if ESD_SETTINGS */
+
+/* end of file */
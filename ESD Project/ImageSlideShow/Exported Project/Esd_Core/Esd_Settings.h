@@ -0,0 +1,91 @@
+
+#ifndef ESD_SETTINGS__H
+#define ESD_SETTINGS__H
+
+#include "Esd_Base.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+Power safe settings store on the SD card.
+Settings are small records of up to 255 bytes, looked up by a one byte key, and kept in an image
+in RAM, so reading them never touches the card. The image is stored in a region reserved as a
+contiguous file, ESD_SETTINGS_FILE, of which only the first sectors are used, written directly with
+disk_write without going through FatFS, so the directory and the FAT are never updated.
+The region holds two slots of ESD_SETTINGS_SECTORS sectors. A commit writes the whole image with the
+next sequence number into the slot that does not hold the current image, so a write torn by a power
+loss leaves the previous image intact. At boot both slots are read, and the one with a valid checksum
+and the higher sequence number is taken, that is two sector reads for the default size, and one more
+when the newer image is in the first slot.
+Changes are held back until no setting has been changed for ESD_SETTINGS_COMMIT_MS, so dragging a
+slider programs the card once, or until Esd_Settings_Commit is called.
+
+Create the file on the PC, for example by copying 2 * ESD_SETTINGS_SECTORS * 512 zero bytes onto a
+freshly formatted card. A file that is not contiguous is not used. Esd_Start opens the store once
+the card is mounted, and Esd_Close writes what is still pending.
+
+A slot is little endian:
+	uint32_t ESD_SETTINGS_MAGIC
+	uint32_t sequence number
+	uint16_t size of the records, uint16_t zero
+	uint32_t checksum of the records
+Followed by the records, one key byte, one size byte and the data each. Key 0 ends the records.
+*/
+
+#ifndef ESD_SETTINGS
+#define ESD_SETTINGS 0
+#endif
+
+#ifndef ESD_SETTINGS_FILE
+#define ESD_SETTINGS_FILE "SETTINGS.BIN"
+#endif
+
+// Sectors per slot, the image holds this many sectors less the slot header
+#ifndef ESD_SETTINGS_SECTORS
+#define ESD_SETTINGS_SECTORS 1
+#endif
+
+// Quiet time after the last change before the image is written
+#ifndef ESD_SETTINGS_COMMIT_MS
+#define ESD_SETTINGS_COMMIT_MS 2000
+#endif
+
+#define ESD_SETTINGS_MAGIC 0x54455345UL // "ESET"
+
+#if ESD_SETTINGS
+
+// Finds the reserved region and reads the current image, returns false when there is no usable region.
+// The store then stays empty and changes are kept in RAM only
+ESD_CORE_EXPORT bool Esd_Settings_Open();
+
+// Copies a setting into buffer, returns its size, or 0 when it was never set.
+// Bytes past size are not written when the setting is larger
+ESD_CORE_EXPORT uint32_t Esd_Settings_Get(uint8_t key, void *buffer, uint32_t size);
+
+// Changes a setting in RAM, returns false when the image is full. Setting the same value does not cause a write
+ESD_CORE_EXPORT bool Esd_Settings_Set(uint8_t key, const void *data, uint32_t size);
+
+// Removes a setting
+ESD_CORE_EXPORT void Esd_Settings_Remove(uint8_t key);
+
+// Writes pending changes now, for example before powering down. Returns false when the card write failed
+ESD_CORE_EXPORT bool Esd_Settings_Commit();
+
+// Writes pending changes once they have settled, called while idle
+ESD_CORE_EXPORT void Esd_Settings_Idle();
+
+#else
+
+#define Esd_Settings_Idle() eve_noop()
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* #ifndef ESD_SETTINGS__H */
+
+/* end of file */
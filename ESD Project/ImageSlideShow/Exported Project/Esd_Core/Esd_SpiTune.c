@@ -0,0 +1,210 @@
+
+#include "Esd_SpiTune.h"
+
+#if ESD_SPI_TUNE
+
+#if !defined(FT9XX_PLATFORM) || !ESD_SETTINGS
+#error ESD_SPI_TUNE requires FT9XX_PLATFORM and ESD_SETTINGS
+#endif
+
+#include "Esd_Context.h"
+#include "Esd_GpuAlloc.h"
+#include "Esd_Settings.h"
+
+// Written and read back at a time, long enough for the bulk read mode. The pattern is generated, not stored
+#define ESD_SPI_TUNE_CHUNK 256
+
+#if (ESD_SPI_TUNE_SIZE % ESD_SPI_TUNE_CHUNK)
+#error ESD_SPI_TUNE_SIZE must be a multiple of 256
+#endif
+
+#define ESD_SPI_TUNE_WIDTHS 3
+#define ESD_SPI_TUNE_MAX_SETTINGS (ESD_SPI_TUNE_WIDTHS * 9) // Dividers 2 to 512
+
+typedef struct
+{
+	uint8_t Channels; // EVE_SPI_CHANNELS_T
+	uint8_t Lines;
+	uint16_t Divider;
+} Esd_SpiSetting;
+
+static const uint8_t c_Toggle[2][2] = { { 0x00, 0xFF }, { 0x55, 0xAA } };
+
+// Even rounds toggle every line on every byte, odd rounds are pseudo random
+static void pattern(uint8_t *buffer, uint32_t offset, uint32_t round)
+{
+	uint32_t x = ((offset + 1) * 0x9E3779B9UL) ^ (round * 0x85EBCA6BUL);
+	for (uint32_t i = 0; i < ESD_SPI_TUNE_CHUNK; ++i)
+	{
+		if (round & 1)
+		{
+			x ^= x << 13;
+			x ^= x >> 17;
+			x ^= x << 5;
+			buffer[i] = (uint8_t)x;
+		}
+		else
+		{
+			buffer[i] = c_Toggle[(round >> 1) & 1][i & 1];
+		}
+	}
+}
+
+static void writePattern(EVE_HalContext *phost, uint32_t addr, uint32_t round)
+{
+	uint8_t buffer[ESD_SPI_TUNE_CHUNK];
+	for (uint32_t offset = 0; offset < ESD_SPI_TUNE_SIZE; offset += ESD_SPI_TUNE_CHUNK)
+	{
+		pattern(buffer, offset, round);
+		EVE_Hal_wrMem(phost, addr + offset, buffer, ESD_SPI_TUNE_CHUNK);
+	}
+}
+
+static bool readPattern(EVE_HalContext *phost, uint32_t addr, uint32_t round)
+{
+	uint8_t expected[ESD_SPI_TUNE_CHUNK];
+	uint8_t actual[ESD_SPI_TUNE_CHUNK];
+	for (uint32_t offset = 0; offset < ESD_SPI_TUNE_SIZE; offset += ESD_SPI_TUNE_CHUNK)
+	{
+		pattern(expected, offset, round);
+		EVE_Hal_rdMem(phost, actual, addr + offset, ESD_SPI_TUNE_CHUNK);
+		if (memcmp(expected, actual, ESD_SPI_TUNE_CHUNK))
+			return false;
+	}
+	return true;
+}
+
+// The width is switched at the slow clock, so the write of REG_SPI_WIDTH cannot be lost
+static void useSetting(EVE_HalContext *phost, EVE_SPI_CHANNELS_T channels, uint16_t divider)
+{
+	EVE_Hal_setSPIDivider(phost, ESD_SPI_TUNE_SAFE_DIVIDER);
+	if (phost->SpiChannels != channels)
+		EVE_Hal_setSPI(phost, channels, phost->SpiDummyBytes);
+	EVE_Hal_setSPIDivider(phost, divider);
+}
+
+static bool testRound(EVE_HalContext *phost, uint16_t divider, uint32_t addr, uint32_t round)
+{
+	uint32_t crc, reference;
+	bool ok;
+
+	EVE_Hal_setSPIDivider(phost, divider);
+	writePattern(phost, addr, round);
+	ok = readPattern(phost, addr, round);
+
+	// The coprocessor checks what arrived, at the slow clock
+	EVE_Hal_setSPIDivider(phost, ESD_SPI_TUNE_SAFE_DIVIDER);
+	if (!EVE_CoCmd_memCrc(phost, addr, ESD_SPI_TUNE_SIZE, &crc))
+	{
+		// A bad write may have hit the command buffer
+		EVE_Util_resetCoprocessor(phost);
+		return false;
+	}
+	writePattern(phost, addr, round);
+	if (!EVE_CoCmd_memCrc(phost, addr, ESD_SPI_TUNE_SIZE, &reference))
+	{
+		EVE_Util_resetCoprocessor(phost);
+		return false;
+	}
+	return ok && crc == reference;
+}
+
+// Highest throughput first, at equal throughput the wider bus at the slower clock
+static uint32_t listSettings(Esd_SpiSetting *settings)
+{
+	static const uint8_t c_Channels[ESD_SPI_TUNE_WIDTHS] = { EVE_SPI_QUAD_CHANNEL, EVE_SPI_DUAL_CHANNEL, EVE_SPI_SINGLE_CHANNEL };
+	static const uint8_t c_Lines[ESD_SPI_TUNE_WIDTHS] = { 4, 2, 1 };
+	uint32_t nb = 0;
+
+	for (uint32_t w = 0; w < ESD_SPI_TUNE_WIDTHS; ++w)
+	{
+		for (uint32_t divider = ESD_SPI_TUNE_DIVIDER_MIN; divider <= ESD_SPI_TUNE_DIVIDER_MAX && nb < ESD_SPI_TUNE_MAX_SETTINGS; divider <<= 1)
+		{
+			Esd_SpiSetting s = { c_Channels[w], c_Lines[w], (uint16_t)divider };
+			uint32_t i = nb++;
+			while (i && (settings[i - 1].Lines * (uint32_t)s.Divider < s.Lines * (uint32_t)settings[i - 1].Divider
+			          || (settings[i - 1].Lines * (uint32_t)s.Divider == s.Lines * (uint32_t)settings[i - 1].Divider && settings[i - 1].Divider < s.Divider)))
+			{
+				settings[i] = settings[i - 1];
+				--i;
+			}
+			settings[i] = s;
+		}
+	}
+	return nb;
+}
+
+ESD_CORE_EXPORT bool Esd_SpiTune_Run()
+{
+	EVE_HalContext *phost = Esd_GetHost();
+	EVE_SPI_CHANNELS_T channels = phost->SpiChannels;
+	uint16_t divider = phost->SpiDivider;
+	Esd_SpiSetting settings[ESD_SPI_TUNE_MAX_SETTINGS];
+	const Esd_SpiSetting *found = NULL;
+	Esd_GpuHandle handle;
+	uint32_t addr, nb;
+	uint8_t record[3];
+
+	if (EVE_CHIPID < EVE_FT810)
+		return false;
+	handle = Esd_GpuAlloc_Alloc(Esd_GAlloc, ESD_SPI_TUNE_SIZE, 0);
+	addr = Esd_GpuAlloc_Get(Esd_GAlloc, handle);
+	if (addr == GA_INVALID)
+	{
+		eve_printf_debug("No RAM_G for the SPI test pattern\n");
+		return false;
+	}
+
+	nb = listSettings(settings);
+	for (uint32_t i = 0; i < nb && !found; ++i)
+	{
+		bool pass = true;
+		useSetting(phost, (EVE_SPI_CHANNELS_T)settings[i].Channels, ESD_SPI_TUNE_SAFE_DIVIDER);
+		for (uint32_t round = 0; round < ESD_SPI_TUNE_ROUNDS && pass; ++round)
+			pass = testRound(phost, settings[i].Divider, addr, round);
+		if (pass)
+			found = &settings[i];
+	}
+	Esd_GpuAlloc_Free(Esd_GAlloc, handle);
+
+	if (!found)
+	{
+		eve_printf_debug("No SPI setting passed, keeping the boot setting\n");
+		useSetting(phost, channels, divider);
+		return false;
+	}
+
+	useSetting(phost, (EVE_SPI_CHANNELS_T)found->Channels, found->Divider);
+	record[0] = found->Channels;
+	record[1] = (uint8_t)found->Divider;
+	record[2] = (uint8_t)(found->Divider >> 8);
+	Esd_Settings_Set(ESD_SPI_TUNE_KEY, record, sizeof(record));
+	eve_printf_debug("SPI characterised, %d lines at divider %d\n", (int)found->Lines, (int)found->Divider);
+	return true;
+}
+
+ESD_CORE_EXPORT void Esd_SpiTune_Apply()
+{
+	EVE_HalContext *phost = Esd_GetHost();
+	uint8_t record[3];
+	uint16_t divider;
+
+	if (EVE_CHIPID < EVE_FT810)
+		return;
+	if (Esd_Settings_Get(ESD_SPI_TUNE_KEY, record, sizeof(record)) != sizeof(record))
+	{
+		Esd_SpiTune_Run();
+		return;
+	}
+	divider = (uint16_t)(record[1] | (record[2] << 8));
+	if (record[0] > EVE_SPI_QUAD_CHANNEL || divider < 2 || (divider & (divider - 1)))
+	{
+		Esd_SpiTune_Run();
+		return;
+	}
+	useSetting(phost, (EVE_SPI_CHANNELS_T)record[0], divider);
+}
+
+#endif /* #if ESD_SPI_TUNE */
+
+/* end of file */
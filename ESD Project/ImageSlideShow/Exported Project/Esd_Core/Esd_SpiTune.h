@@ -0,0 +1,76 @@
+
+#ifndef ESD_SPITUNE__H
+#define ESD_SPITUNE__H
+
+#include "Esd_Base.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+SPI clock characterisation.
+Boards do not all reach the same SPI clock, so with ESD_SPI_TUNE the fastest setting a unit handles
+reliably is measured once and kept in the settings store under ESD_SPI_TUNE_KEY.
+Settings are tried from the highest throughput down, every SPIM divider from ESD_SPI_TUNE_DIVIDER_MIN
+to ESD_SPI_TUNE_DIVIDER_MAX on quad, dual and single lines. At each one a test pattern of
+ESD_SPI_TUNE_SIZE bytes is written to RAM_G and read back, then the coprocessor computes its CRC with
+CMD_MEMCRC, which must match the CRC of the same pattern written at the slow ESD_SPI_TUNE_SAFE_DIVIDER.
+The first setting that passes all ESD_SPI_TUNE_ROUNDS rounds, alternating toggling and random patterns,
+is taken. The bus width is only ever switched at the slow clock, and the coprocessor is only used there.
+
+Esd_Start runs it after the settings store is opened and before the application starts, since a
+failing setting may write outside of the test area. Later boots just apply the stored setting.
+Divider 2 runs the bus at 50 MHz, beyond what the FT81X datasheet specifies, and is only used when it
+passes every round. Raise ESD_SPI_TUNE_DIVIDER_MIN to 4 to stay within the specification.
+Requires the FT9XX platform and ESD_SETTINGS, without the store it runs on every boot.
+*/
+
+#ifndef ESD_SPI_TUNE
+#define ESD_SPI_TUNE 0
+#endif
+
+#ifndef ESD_SPI_TUNE_KEY
+#define ESD_SPI_TUNE_KEY 0xF0
+#endif
+
+// Range of SPIM dividers of the 100 MHz peripheral clock, in powers of two
+#ifndef ESD_SPI_TUNE_DIVIDER_MIN
+#define ESD_SPI_TUNE_DIVIDER_MIN 2
+#endif
+#ifndef ESD_SPI_TUNE_DIVIDER_MAX
+#define ESD_SPI_TUNE_DIVIDER_MAX 16
+#endif
+
+// Divider at which the bus width is switched and the coprocessor is used
+#ifndef ESD_SPI_TUNE_SAFE_DIVIDER
+#define ESD_SPI_TUNE_SAFE_DIVIDER 32
+#endif
+
+// Size of the test pattern, a multiple of 256
+#ifndef ESD_SPI_TUNE_SIZE
+#define ESD_SPI_TUNE_SIZE 4096
+#endif
+
+#ifndef ESD_SPI_TUNE_ROUNDS
+#define ESD_SPI_TUNE_ROUNDS 8
+#endif
+
+#if ESD_SPI_TUNE
+
+// Applies the stored setting, or characterises the bus when there is none. Called by Esd_Start
+ESD_CORE_EXPORT void Esd_SpiTune_Apply();
+
+// Characterises the bus now, applies and stores the fastest setting that passed.
+// Returns false when none did, the setting in use before is then kept
+ESD_CORE_EXPORT bool Esd_SpiTune_Run();
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* #ifndef ESD_SPITUNE__H */
+
+/* end of file */
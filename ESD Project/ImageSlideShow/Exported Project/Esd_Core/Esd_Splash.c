@@ -0,0 +1,69 @@
+
+#include "Esd_Splash.h"
+
+#if ESD_SPLASH
+
+#include "Esd_Context.h"
+
+extern ESD_CORE_EXPORT Esd_GpuAlloc *Esd_GAlloc;
+
+static Esd_GpuHandle s_Handle = GA_HANDLE_INIT;
+static bool s_Loaded;
+
+ESD_CORE_EXPORT bool Esd_Splash_Show(const Esd_SplashImage *image)
+{
+	EVE_HalContext *phost = Esd_GetHost();
+	uint32_t addr;
+
+	if (!image || !image->Data)
+		return false;
+
+	if (!s_Loaded)
+	{
+		// Fixed, the application Start allocates around it while it is still on screen
+		s_Handle = Esd_GpuAlloc_Alloc(Esd_GAlloc, (uint32_t)image->Stride * image->Height, GA_FIXED_FLAG);
+		addr = Esd_GpuAlloc_Get(Esd_GAlloc, s_Handle);
+		if (addr == GA_INVALID)
+			return false;
+		if (!EVE_CoCmd_inflate_progMem(phost, addr, image->Data, image->Size))
+		{
+			Esd_GpuAlloc_Free(Esd_GAlloc, s_Handle);
+			s_Handle = GA_HANDLE_INVALID;
+			return false;
+		}
+		s_Loaded = true;
+	}
+	else
+	{
+		addr = Esd_GpuAlloc_Get(Esd_GAlloc, s_Handle);
+		if (addr == GA_INVALID)
+			return false;
+	}
+
+	EVE_CoCmd_dlStart(phost);
+	EVE_CoDl_clearColorRgb_ex(phost, image->BgColor);
+	EVE_CoDl_clear(phost, true, true, true);
+	EVE_CoDl_bitmapHandle(phost, ESD_SPLASH_HANDLE);
+	EVE_CoDl_bitmapSource(phost, addr);
+	EVE_CoDl_bitmapLayout(phost, image->Format, image->Stride, image->Height);
+	EVE_CoDl_bitmapSize(phost, NEAREST, BORDER, BORDER, image->Width, image->Height);
+	EVE_CoDl_begin(phost, BITMAPS);
+	EVE_CoDl_vertex2f_0(phost, (phost->Width - image->Width) >> 1, (phost->Height - image->Height) >> 1);
+	EVE_CoDl_end(phost);
+	EVE_CoDl_display(phost);
+	EVE_CoCmd_swap(phost);
+	return EVE_Cmd_waitFlush(phost);
+}
+
+ESD_CORE_EXPORT void Esd_Splash_Release()
+{
+	if (!s_Loaded)
+		return;
+	Esd_GpuAlloc_Free(Esd_GAlloc, s_Handle);
+	s_Handle = GA_HANDLE_INVALID;
+	s_Loaded = false;
+}
+
+#endif /* #if ESD_SPLASH */
+
+/* end of file */
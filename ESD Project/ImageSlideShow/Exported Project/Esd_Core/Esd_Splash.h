@@ -0,0 +1,61 @@
+
+#ifndef ESD_SPLASH__H
+#define ESD_SPLASH__H
+
+#include "Esd_Base.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+Boot splash from program memory.
+Esd_Open shows the splash image of Esd_Parameters as soon as the display is configured, before touch
+calibration, the SD card mount and the application Start, which can take a long while before the first
+frame. The image is deflated into RAM_G with CMD_INFLATE straight from program memory, so it does not
+depend on any storage being ready, and takes the place of the startup spinner until the first frame
+of the application has been swapped in, after which its RAM_G is released.
+The image is a raw bitmap compressed with zlib, as written by the img_cvt or eve_asset_builder tools.
+*/
+
+#ifndef ESD_SPLASH
+#define ESD_SPLASH 0
+#endif
+
+// Bitmap handle used by the splash display list, no other handle is in use at boot
+#ifndef ESD_SPLASH_HANDLE
+#define ESD_SPLASH_HANDLE 0
+#endif
+
+typedef struct Esd_SplashImage
+{
+	eve_progmem_const uint8_t *Data; // Deflated bitmap
+	uint32_t Size; // Bytes of Data
+	uint16_t Width;
+	uint16_t Height;
+	uint16_t Stride;
+	uint8_t Format;
+	uint32_t BgColor; // Clear colour around the centered image
+} Esd_SplashImage;
+
+#if ESD_SPLASH
+
+// Deflates the image on the first call, and shows it centered on the screen. Returns false when there is no splash
+ESD_CORE_EXPORT bool Esd_Splash_Show(const Esd_SplashImage *image);
+
+// Frees the RAM_G of the splash, called once a frame of the application has been swapped in
+ESD_CORE_EXPORT void Esd_Splash_Release();
+
+#else
+
+#define Esd_Splash_Release() eve_noop()
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* #ifndef ESD_SPLASH__H */
+
+/* end of file */
@@ -0,0 +1,122 @@
+
+#include "Esd_Sprite.h"
+#include "Esd_Context.h"
+#include "Esd_BitmapHandle.h"
+#include "Esd_Quality.h"
+
+void Esd_CoDl_Bitmap_Vertex(int16_t x, int16_t y, uint8_t handle, uint16_t cell);
+
+static Esd_Sprite *s_Playing = NULL;
+
+ESD_CORE_EXPORT void Esd_Sprite_Initialize(Esd_Sprite *sprite, Esd_BitmapInfo *info, uint16_t firstCell, uint16_t frames, uint16_t frameMs, bool loop)
+{
+	sprite->Next = NULL;
+	sprite->Previous = NULL;
+	sprite->Info = info;
+	sprite->FirstCell = firstCell;
+	sprite->Frames = frames ? frames : 1;
+	sprite->FrameMs = frameMs ? frameMs : 1;
+	sprite->Cell = firstCell;
+	sprite->ElapsedMs = 0;
+	sprite->Loop = loop;
+	sprite->Decorative = false;
+	sprite->Advanced = NULL;
+}
+
+ESD_CORE_EXPORT void Esd_Sprite_Play(Esd_Sprite *sprite)
+{
+	if (sprite->Previous)
+		return;
+	if (!sprite->Loop && sprite->ElapsedMs >= (uint32_t)(sprite->Frames - 1) * sprite->FrameMs)
+		Esd_Sprite_Seek(sprite, 0); // Played to the end, play again
+	sprite->Next = s_Playing;
+	if (s_Playing)
+		s_Playing->Previous = &sprite->Next;
+	sprite->Previous = &s_Playing;
+	s_Playing = sprite;
+}
+
+ESD_CORE_EXPORT void Esd_Sprite_Stop(Esd_Sprite *sprite)
+{
+	if (!sprite->Previous)
+		return;
+	*sprite->Previous = sprite->Next;
+	if (sprite->Next)
+		sprite->Next->Previous = sprite->Previous;
+	sprite->Next = NULL;
+	sprite->Previous = NULL;
+}
+
+static void setFrame(Esd_Sprite *sprite, uint16_t frame)
+{
+	uint16_t cell = sprite->FirstCell + frame;
+	if (cell == sprite->Cell)
+		return;
+	sprite->Cell = cell;
+	if (sprite->Advanced)
+		sprite->Advanced(sprite);
+	Esd_Invalidate();
+}
+
+ESD_CORE_EXPORT void Esd_Sprite_Seek(Esd_Sprite *sprite, uint16_t frame)
+{
+	if (frame >= sprite->Frames)
+		frame = sprite->Frames - 1;
+	sprite->ElapsedMs = (uint32_t)frame * sprite->FrameMs;
+	setFrame(sprite, frame);
+}
+
+ESD_CORE_EXPORT void Esd_Sprite_UpdateGlobal(uint32_t deltaMs)
+{
+	Esd_Sprite *sprite = s_Playing;
+	while (sprite)
+	{
+		// Advanced may stop the sprite
+		Esd_Sprite *next = sprite->Next;
+		uint32_t duration = (uint32_t)sprite->Frames * sprite->FrameMs;
+		uint32_t elapsed = sprite->ElapsedMs + deltaMs;
+
+		if (elapsed >= duration)
+		{
+			if (sprite->Loop)
+			{
+				elapsed %= duration;
+			}
+			else
+			{
+				elapsed = duration - sprite->FrameMs;
+				Esd_Sprite_Stop(sprite);
+			}
+		}
+		sprite->ElapsedMs = elapsed;
+		// Keeps time, so where it resumes does not depend on how long quality was reduced
+		if (!(sprite->Decorative && Esd_Quality_Reduced()) || !Esd_Sprite_IsPlaying(sprite))
+			setFrame(sprite, (uint16_t)(elapsed / sprite->FrameMs));
+		sprite = next;
+	}
+}
+
+ESD_CORE_EXPORT void Esd_Sprite_StopGlobal()
+{
+	while (s_Playing)
+		Esd_Sprite_Stop(s_Playing);
+}
+
+ESD_CORE_EXPORT void Esd_Sprite_Render(Esd_Sprite *sprite, int16_t x, int16_t y)
+{
+	EVE_HalContext *phost = Esd_GetHost();
+	uint8_t handle;
+
+	if (!sprite->Info)
+		return;
+
+	// Set up only once for consecutive sprites of the same bitmap
+	handle = Esd_CoDl_SetupBitmap(sprite->Info);
+	if (!ESD_BITMAPHANDLE_VALID(handle))
+		return;
+	Esd_CoDl_BitmapSizeReset(handle);
+	EVE_CoDl_begin(phost, BITMAPS);
+	Esd_CoDl_Bitmap_Vertex(x, y, handle, sprite->Cell);
+}
+
+/* end of file */
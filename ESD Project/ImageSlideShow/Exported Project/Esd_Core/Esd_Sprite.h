@@ -0,0 +1,70 @@
+
+#ifndef ESD_SPRITE__H
+#define ESD_SPRITE__H
+
+#include "Esd_Base.h"
+#include "Esd_BitmapInfo.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+Host driven sprite animation.
+The frames of a sprite are consecutive cells of one bitmap, loaded as a single allocation.
+Playing sprites are advanced together once per frame by Esd_Update from the frame delta time,
+and Esd_Invalidate is only called when one of them moved on to a new cell.
+For sprite sheets of up to 128 cells at positions within 512 pixels, Esd_Sprite_Render
+costs a single VERTEX2II word once the bitmap handle is set up. With EVE_DL_OPTIMIZE, sprites
+sharing a bitmap and drawn one after another share the handle setup and the BEGIN.
+For FT81X, which lacks the CMD_ANIMSTART family used by Ft_Esd_Animation.
+*/
+
+typedef struct Esd_Sprite
+{
+	struct Esd_Sprite *Next;
+	struct Esd_Sprite **Previous; // Pointer linking to this sprite, NULL when not playing
+	Esd_BitmapInfo *Info;
+	uint16_t FirstCell;
+	uint16_t Frames;
+	uint16_t FrameMs; // Duration of each frame
+	uint16_t Cell; // Cell of the frame to render
+	uint32_t ElapsedMs; // Time into the sequence
+	bool Loop;
+	bool Decorative; // Holds its frame while render quality is reduced, see Esd_Quality.h
+	void (*Advanced)(struct Esd_Sprite *sprite); // Optional, called when Cell changed
+} Esd_Sprite;
+
+// Sets up a stopped sprite showing its first frame, the sprite must not be playing
+ESD_CORE_EXPORT void Esd_Sprite_Initialize(Esd_Sprite *sprite, Esd_BitmapInfo *info, uint16_t firstCell, uint16_t frames, uint16_t frameMs, bool loop);
+
+// Plays from the current frame, does nothing when already playing
+ESD_CORE_EXPORT void Esd_Sprite_Play(Esd_Sprite *sprite);
+
+// Stops on the current frame
+ESD_CORE_EXPORT void Esd_Sprite_Stop(Esd_Sprite *sprite);
+
+// Jumps to a frame, keeps playing when playing
+ESD_CORE_EXPORT void Esd_Sprite_Seek(Esd_Sprite *sprite, uint16_t frame);
+
+// Draws the current frame with its top left at x, y in the current color
+ESD_CORE_EXPORT void Esd_Sprite_Render(Esd_Sprite *sprite, int16_t x, int16_t y);
+
+// Advances all playing sprites, called from Esd_Update
+ESD_CORE_EXPORT void Esd_Sprite_UpdateGlobal(uint32_t deltaMs);
+
+// Stops all sprites, called from Esd_Stop
+ESD_CORE_EXPORT void Esd_Sprite_StopGlobal();
+
+static inline bool Esd_Sprite_IsPlaying(Esd_Sprite *sprite)
+{
+	return sprite->Previous != NULL;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* #ifndef ESD_SPRITE__H */
+
+/* end of file */
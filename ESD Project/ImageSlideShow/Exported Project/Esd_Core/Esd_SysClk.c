@@ -0,0 +1,239 @@
+
+#include "Esd_SysClk.h"
+
+#if ESD_SYSCLK_POLICY
+
+#include "Esd_Context.h"
+#include "Esd_AsyncLoad.h"
+
+#define ESD_SYSCLK_UNKNOWN 0
+#define ESD_SYSCLK_READY 1
+#define ESD_SYSCLK_UNSUPPORTED 2
+
+// EVE_81X_PLL_FREQ_T values are multiples of 12 MHz
+#define ESD_SYSCLK_HZ(freq) ((uint32_t)(freq) * 12000000UL)
+
+static uint8_t s_State = ESD_SYSCLK_UNKNOWN;
+static uint8_t s_Clock; // Current EVE_81X_PLL_FREQ_T
+static uint8_t s_Max = ESD_SYSCLK_MAX; // Fastest clock the policy may select
+static uint32_t s_PixelHz; // Pixel clock set up at boot, or by Esd_SetPclk
+static bool s_Rendered = false;
+static uint32_t s_RenderMicros;
+static uint32_t s_RenderEndMicros;
+static uint32_t s_BusyMicros = 0;
+static uint32_t s_WindowMicros;
+static bool s_Low = false;
+static uint32_t s_LowMillis;
+
+static bool ready()
+{
+	EVE_HalContext *phost;
+	uint32_t freq;
+	uint8_t pclk;
+
+	if (s_State != ESD_SYSCLK_UNKNOWN)
+		return s_State == ESD_SYSCLK_READY;
+
+	phost = Esd_GetHost();
+	freq = EVE_Hal_rd32(phost, REG_FREQUENCY);
+	pclk = EVE_Hal_rd8(phost, REG_PCLK);
+	if (EVE_CHIPID < EVE_FT810 || !freq || !pclk)
+	{
+		eve_printf_debug("System clock policy requires FT81X and a running display\n");
+		s_State = ESD_SYSCLK_UNSUPPORTED;
+		return false;
+	}
+	s_PixelHz = freq / pclk;
+	s_Clock = (uint8_t)((freq + 6000000UL) / 12000000UL);
+	s_WindowMicros = EVE_micros();
+	s_State = ESD_SYSCLK_READY;
+	return true;
+}
+
+// REG_PCLK that keeps the pixel clock at the given system clock, 0 when none is close enough
+static uint8_t pclkFor(uint8_t freq)
+{
+	uint32_t hz = ESD_SYSCLK_HZ(freq);
+	uint32_t pclk = (hz + (s_PixelHz >> 1)) / s_PixelHz;
+	uint32_t pixelHz, diff;
+
+	if (pclk < 2 || pclk > 255)
+		return 0;
+	pixelHz = hz / pclk;
+	diff = pixelHz > s_PixelHz ? pixelHz - s_PixelHz : s_PixelHz - pixelHz;
+	if ((uint64_t)diff * 100 > (uint64_t)s_PixelHz * ESD_SYSCLK_PCLK_TOLERANCE)
+		return 0;
+	return (uint8_t)pclk;
+}
+
+// Next usable clock up or down from the current one, 0 when there is none
+static uint8_t nextClock(int direction)
+{
+	for (int freq = s_Clock + direction; freq >= ESD_SYSCLK_MIN && freq <= s_Max; freq += direction)
+	{
+		if (pclkFor((uint8_t)freq))
+			return (uint8_t)freq;
+	}
+	return 0;
+}
+
+ESD_CORE_EXPORT void Esd_SysClk_PclkChanged()
+{
+	if (s_State == ESD_SYSCLK_READY)
+		s_PixelHz = EVE_Hal_rd32(Esd_GetHost(), REG_FREQUENCY) / EVE_Hal_rd8(Esd_GetHost(), REG_PCLK);
+}
+
+ESD_CORE_EXPORT void Esd_SysClk_SetMax(EVE_81X_PLL_FREQ_T freq)
+{
+	s_Max = (uint8_t)max(min((int)freq, ESD_SYSCLK_MAX), ESD_SYSCLK_MIN);
+	if (!ready() || s_Clock <= s_Max)
+		return;
+
+	// Fastest usable clock within the limit, or the slowest one above it when none keeps the pixel clock
+	for (int f = s_Max; f >= ESD_SYSCLK_MIN; --f)
+	{
+		if (pclkFor((uint8_t)f))
+		{
+			Esd_SysClk_Select((EVE_81X_PLL_FREQ_T)f);
+			return;
+		}
+	}
+	for (int f = s_Max + 1; f < s_Clock; ++f)
+	{
+		if (pclkFor((uint8_t)f))
+		{
+			Esd_SysClk_Select((EVE_81X_PLL_FREQ_T)f);
+			return;
+		}
+	}
+}
+
+ESD_CORE_EXPORT uint32_t Esd_SysClk_MHz()
+{
+	return ready() ? (uint32_t)s_Clock * 12 : EVE_Hal_rd32(Esd_GetHost(), REG_FREQUENCY) / 1000000UL;
+}
+
+ESD_CORE_EXPORT bool Esd_SysClk_Select(EVE_81X_PLL_FREQ_T freq)
+{
+	Esd_Context *ec = Esd_CurrentContext;
+	EVE_HalContext *phost = Esd_GetHost();
+	uint32_t hz;
+	uint8_t pclk;
+	uint8_t duty;
+
+	if (!ready())
+		return false;
+	if ((uint8_t)freq == s_Clock)
+		return true;
+	pclk = pclkFor((uint8_t)freq);
+	if (!pclk)
+		return false;
+
+	// CMD_INFLATE waits for data from the host, the flush would not return
+	if (Esd_AsyncLoad_Inflating() || !EVE_Cmd_waitFlush(phost))
+		return false;
+	while (EVE_Hal_rd8(phost, REG_DLSWAP) != 0)
+		; // Let a pending swap land, so the display list on screen is complete
+
+	duty = EVE_Hal_rd8(phost, REG_PWM_DUTY);
+	EVE_Hal_wr8(phost, REG_PWM_DUTY, 0);
+
+	// CLKSEL is only accepted while the PLL is stopped
+	EVE_Host_powerModeSwitch(phost, EVE_SLEEP_M);
+	EVE_Host_selectSysClk(phost, freq);
+	EVE_Host_powerModeSwitch(phost, EVE_ACTIVE_M);
+	EVE_sleep(20); // Oscillator and PLL start up
+	while (EVE_Hal_rd8(phost, REG_ID) != 0x7C)
+		EVE_sleep(1);
+
+	hz = ESD_SYSCLK_HZ(freq);
+	EVE_Hal_wr32(phost, REG_FREQUENCY, hz);
+	EVE_Hal_wr8(phost, REG_PCLK, pclk);
+	EVE_Hal_wr8(phost, REG_PWM_DUTY, duty);
+
+	{
+		uint64_t clocks = (uint64_t)EVE_Hal_rd16(phost, REG_HCYCLE) * EVE_Hal_rd16(phost, REG_VCYCLE) * pclk;
+		ec->RefreshMicros = (uint32_t)((clocks * 1000000UL) / hz);
+	}
+	ec->SwapMicros = EVE_micros(); // Not a missed frame
+	eve_printf_debug("EVE clock switched to %d MHz, PCLK %d\n", (int)(freq * 12), (int)pclk);
+
+	s_Clock = (uint8_t)freq;
+	s_BusyMicros = 0;
+	s_WindowMicros = EVE_micros();
+	s_Low = false;
+	return true;
+}
+
+ESD_CORE_EXPORT void Esd_SysClk_RenderBegin()
+{
+	s_RenderMicros = EVE_micros();
+}
+
+ESD_CORE_EXPORT void Esd_SysClk_RenderEnd()
+{
+	s_RenderEndMicros = EVE_micros();
+	s_Rendered = true;
+}
+
+ESD_CORE_EXPORT bool Esd_SysClk_WaitFlush(EVE_HalContext *phost)
+{
+	bool busy = EVE_Cmd_space(phost) != EVE_CMD_FIFO_SIZE - 4;
+	bool res = Esd_Profile_WaitFlush(phost);
+
+	if (s_Rendered)
+	{
+		// When already flushed, the coprocessor kept up with the host while rendering
+		s_BusyMicros += (busy ? EVE_micros() : s_RenderEndMicros) - s_RenderMicros;
+		s_Rendered = false;
+	}
+	return res;
+}
+
+ESD_CORE_EXPORT void Esd_SysClk_Update()
+{
+	Esd_Context *ec = Esd_CurrentContext;
+	uint32_t micros = EVE_micros();
+	uint32_t elapsed;
+	uint32_t load;
+	uint8_t next;
+
+	if (!ready())
+		return;
+	elapsed = micros - s_WindowMicros;
+	if (elapsed < ESD_SYSCLK_WINDOW_MS * 1000UL)
+		return;
+	load = (uint32_t)(((uint64_t)s_BusyMicros * 100) / elapsed);
+	s_BusyMicros = 0;
+	s_WindowMicros = micros;
+
+	if (load > ESD_SYSCLK_RAISE_LOAD)
+	{
+		s_Low = false;
+		next = nextClock(1);
+		if (next)
+			Esd_SysClk_Select((EVE_81X_PLL_FREQ_T)next);
+		return;
+	}
+
+	// The busy time scales with the clock period
+	next = nextClock(-1);
+	if (!next || load * s_Clock >= ESD_SYSCLK_LOWER_LOAD * next)
+	{
+		s_Low = false;
+		return;
+	}
+	if (!s_Low)
+	{
+		s_Low = true;
+		s_LowMillis = ec->Millis;
+	}
+	else if (ec->Millis - s_LowMillis >= ESD_SYSCLK_HOLD_MS)
+	{
+		Esd_SysClk_Select((EVE_81X_PLL_FREQ_T)next);
+	}
+}
+
+#endif /* #if ESD_SYSCLK_POLICY */
+
+/* end of file */
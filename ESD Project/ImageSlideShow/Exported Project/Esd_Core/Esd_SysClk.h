@@ -0,0 +1,108 @@
+
+#ifndef ESD_SYSCLK__H
+#define ESD_SYSCLK__H
+
+#include "Esd_Base.h"
+#include "Esd_Profile.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+System clock policy.
+With ESD_SYSCLK_POLICY, the loop measures how long the coprocessor is busy with each frame,
+from the start of Render until the last command is read. On frames where the coprocessor had
+already caught up when the host started waiting, the Render time is counted instead.
+Every ESD_SYSCLK_WINDOW_MS the busy share of the elapsed time is compared against the limits.
+Above ESD_SYSCLK_RAISE_LOAD percent the next faster clock is selected, and when the load
+estimated for the next slower clock stays below ESD_SYSCLK_LOWER_LOAD percent for
+ESD_SYSCLK_HOLD_MS, the clock is lowered. Skipped idle frames count as idle time.
+
+Only clocks that divide down to within ESD_SYSCLK_PCLK_TOLERANCE percent of the pixel clock
+set up at boot, or last set by Esd_SetPclk, are used, so REG_PCLK is recomputed and the panel timing stays valid.
+Esd_SysClk_SetMax lowers the upper end of the range at run time, as done by Esd_Thermal.
+The clock can only be selected while EVE is asleep. The backlight is switched off during
+the switch of about 25 ms, registers and RAM_G are kept. Requires FT81X or newer.
+*/
+
+#ifndef ESD_SYSCLK_POLICY
+#define ESD_SYSCLK_POLICY 0
+#endif
+
+// Range of clocks used by the policy
+#ifndef ESD_SYSCLK_MIN
+#define ESD_SYSCLK_MIN EVE_SYSCLK_24M
+#endif
+#ifndef ESD_SYSCLK_MAX
+#define ESD_SYSCLK_MAX EVE_SYSCLK_60M
+#endif
+
+// Time over which the coprocessor load is measured
+#ifndef ESD_SYSCLK_WINDOW_MS
+#define ESD_SYSCLK_WINDOW_MS 1000
+#endif
+
+// Coprocessor load in percent above which the clock is raised
+#ifndef ESD_SYSCLK_RAISE_LOAD
+#define ESD_SYSCLK_RAISE_LOAD 75
+#endif
+
+// Coprocessor load in percent at the slower clock below which the clock is lowered
+#ifndef ESD_SYSCLK_LOWER_LOAD
+#define ESD_SYSCLK_LOWER_LOAD 50
+#endif
+
+// Time the load must stay low before the clock is lowered
+#ifndef ESD_SYSCLK_HOLD_MS
+#define ESD_SYSCLK_HOLD_MS 5000
+#endif
+
+// Allowed deviation from the pixel clock set up at boot, in percent
+#ifndef ESD_SYSCLK_PCLK_TOLERANCE
+#define ESD_SYSCLK_PCLK_TOLERANCE 5
+#endif
+
+#if ESD_SYSCLK_POLICY
+
+// Marks the start and the end of Render, called by Esd_Render
+ESD_CORE_EXPORT void Esd_SysClk_RenderBegin();
+ESD_CORE_EXPORT void Esd_SysClk_RenderEnd();
+
+// Waits for the coprocessor to process all submitted commands, and adds the busy time of the frame
+ESD_CORE_EXPORT bool Esd_SysClk_WaitFlush(EVE_HalContext *phost);
+
+// Selects the clock for the measured load, called from Esd_Update
+ESD_CORE_EXPORT void Esd_SysClk_Update();
+
+// Switches to the given clock if it keeps the pixel clock, returns false otherwise
+ESD_CORE_EXPORT bool Esd_SysClk_Select(EVE_81X_PLL_FREQ_T freq);
+
+// Limits the policy to clocks up to freq, switching down right away when the current clock is faster.
+// ESD_SYSCLK_MAX lifts the limit
+ESD_CORE_EXPORT void Esd_SysClk_SetMax(EVE_81X_PLL_FREQ_T freq);
+
+// Current system clock in MHz
+ESD_CORE_EXPORT uint32_t Esd_SysClk_MHz();
+
+// Takes the pixel clock of the current REG_PCLK as the one to keep, called by Esd_SetPclk
+ESD_CORE_EXPORT void Esd_SysClk_PclkChanged();
+
+#else
+
+#define Esd_SysClk_RenderBegin() eve_noop()
+#define Esd_SysClk_RenderEnd() eve_noop()
+#define Esd_SysClk_WaitFlush(phost) Esd_Profile_WaitFlush(phost)
+#define Esd_SysClk_Update() eve_noop()
+#define Esd_SysClk_PclkChanged() eve_noop()
+#define Esd_SysClk_SetMax(freq) eve_noop()
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* #ifndef ESD_SYSCLK__H */
+
+/* end of file */
@@ -0,0 +1,62 @@
+
+#include "Esd_Telemetry.h"
+
+#include "Esd_Context.h"
+#include "Esd_BitmapHandle.h"
+
+extern ESD_CORE_EXPORT Esd_GpuAlloc *Esd_GAlloc;
+
+#if ESD_TELEMETRY
+ESD_CORE_EXPORT Esd_TelemetrySinkCallback Esd_TelemetrySink = NULL;
+#endif
+
+// State at the previous snapshot
+static uint32_t s_Millis = 0;
+static uint32_t s_Allocs = 0;
+static uint32_t s_Frees = 0;
+static uint32_t s_Evictions = 0;
+
+static uint32_t perSecond(uint32_t count, uint32_t ms)
+{
+	return ms ? (uint32_t)(((uint64_t)count * 1000) / ms) : 0;
+}
+
+ESD_CORE_EXPORT void Esd_Telemetry_Snapshot(Esd_MemorySnapshot *snapshot)
+{
+	uint32_t ms = EVE_millis();
+	uint32_t elapsed = ms - s_Millis;
+
+	snapshot->Magic = ESD_TELEMETRY_MAGIC;
+	snapshot->Millis = ms;
+	snapshot->Frame = Esd_CurrentContext->Frame;
+	snapshot->BitmapHandles = (uint16_t)Esd_BitmapHandle_GetTotalUsed();
+	snapshot->BitmapHandlesTotal = (uint16_t)Esd_BitmapHandle_GetTotal();
+	Esd_GpuAlloc_GetStats(Esd_GAlloc, &snapshot->GpuAlloc);
+
+	// The first snapshot reports the churn since the context was opened
+	snapshot->AllocsPerSecond = perSecond(snapshot->GpuAlloc.Allocs - s_Allocs, elapsed);
+	snapshot->FreesPerSecond = perSecond(snapshot->GpuAlloc.Frees - s_Frees, elapsed);
+	snapshot->EvictionsPerSecond = perSecond(snapshot->GpuAlloc.Evictions - s_Evictions, elapsed);
+
+	s_Millis = ms;
+	s_Allocs = snapshot->GpuAlloc.Allocs;
+	s_Frees = snapshot->GpuAlloc.Frees;
+	s_Evictions = snapshot->GpuAlloc.Evictions;
+}
+
+#if ESD_TELEMETRY
+ESD_CORE_EXPORT void Esd_Telemetry_Update()
+{
+	Esd_MemorySnapshot snapshot;
+
+	if (!Esd_TelemetrySink)
+		return;
+	if ((EVE_millis() - s_Millis) < ESD_TELEMETRY_INTERVAL_MS)
+		return;
+
+	Esd_Telemetry_Snapshot(&snapshot);
+	Esd_TelemetrySink((const uint8_t *)&snapshot, sizeof(snapshot));
+}
+#endif
+
+/* end of file */
@@ -0,0 +1,70 @@
+
+#ifndef ESD_TELEMETRY__H
+#define ESD_TELEMETRY__H
+
+#include "Esd_Base.h"
+#include "Esd_GpuAlloc.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+Memory telemetry for long running devices.
+Every ESD_TELEMETRY_INTERVAL_MS, Esd_Update passes an Esd_MemorySnapshot to Esd_TelemetrySink,
+with the RAM_G usage and fragmentation, the bitmap handles in use, and the allocation churn
+per second since the previous snapshot. Like the profiler sink, on FT9XX the snapshot would
+typically be written to the usbdbg CDC endpoint, or forwarded to a remote log.
+Unlike the profiler, this is meant to stay enabled in release builds.
+*/
+
+#ifndef ESD_TELEMETRY
+#define ESD_TELEMETRY 0
+#endif
+
+#ifndef ESD_TELEMETRY_INTERVAL_MS
+#define ESD_TELEMETRY_INTERVAL_MS 10000
+#endif
+
+#define ESD_TELEMETRY_MAGIC 0x4D454D45UL // "EMEM"
+
+// Binary snapshot, little endian
+typedef struct
+{
+	uint32_t Magic; // ESD_TELEMETRY_MAGIC
+	uint32_t Millis; // Time of the snapshot
+	uint32_t Frame;
+	uint16_t BitmapHandles; // Bitmap handles in use
+	uint16_t BitmapHandlesTotal;
+	uint32_t AllocsPerSecond; // Allocations since the previous snapshot, per second
+	uint32_t FreesPerSecond; // Frees, including garbage collection
+	uint32_t EvictionsPerSecond;
+	Esd_GpuAllocStats GpuAlloc;
+} Esd_MemorySnapshot;
+
+typedef void (*Esd_TelemetrySinkCallback)(const uint8_t *data, uint32_t size);
+
+// Get a memory snapshot on demand, the churn is calculated against the previous snapshot
+ESD_CORE_EXPORT void Esd_Telemetry_Snapshot(Esd_MemorySnapshot *snapshot);
+
+#if ESD_TELEMETRY
+
+// Receives a snapshot every ESD_TELEMETRY_INTERVAL_MS, no snapshots are taken when not set
+extern ESD_CORE_EXPORT Esd_TelemetrySinkCallback Esd_TelemetrySink;
+
+// Emits a snapshot when the interval has passed, called from Esd_Update
+ESD_CORE_EXPORT void Esd_Telemetry_Update();
+
+#else
+
+#define Esd_Telemetry_Update() eve_noop()
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* #ifndef ESD_TELEMETRY__H */
+
+/* end of file */
@@ -0,0 +1,105 @@
+
+#include "Esd_Thermal.h"
+
+#if ESD_THERMAL
+
+#include "Esd_Context.h"
+#include "Esd_Power.h"
+#include "Esd_SysClk.h"
+
+ESD_CORE_EXPORT Esd_ThermalSampleCallback Esd_ThermalSample = NULL;
+
+// Indexed by level, level 0 has no ceiling
+static const int16_t c_Threshold[ESD_THERMAL_LEVELS + 1] = { 0, ESD_THERMAL_LEVEL1_C << 8, ESD_THERMAL_LEVEL2_C << 8, ESD_THERMAL_LEVEL3_C << 8 };
+static const uint8_t c_Fps[ESD_THERMAL_LEVELS + 1] = { 0, ESD_THERMAL_LEVEL1_FPS, ESD_THERMAL_LEVEL2_FPS, ESD_THERMAL_LEVEL3_FPS };
+static const uint8_t c_Duty[ESD_THERMAL_LEVELS + 1] = { 128, 128, ESD_THERMAL_LEVEL2_DUTY, ESD_THERMAL_LEVEL3_DUTY };
+
+static uint8_t s_Level = 0;
+static bool s_Started = false;
+static uint32_t s_CheckMillis;
+static bool s_Stale = false;
+static bool s_DutyPending = false; // Level changed while Esd_Power had the backlight
+static bool s_DutyHeld = false; // s_Duty holds the duty of the application
+static uint8_t s_Duty;
+
+ESD_CORE_EXPORT uint8_t Esd_Thermal_Level()
+{
+	return s_Level;
+}
+
+static void applyDuty()
+{
+	EVE_HalContext *phost = Esd_GetHost();
+	uint8_t cap = c_Duty[s_Level];
+
+	s_DutyPending = false;
+	if (cap >= 128)
+	{
+		if (s_DutyHeld)
+		{
+			EVE_Hal_wr8(phost, REG_PWM_DUTY, s_Duty);
+			s_DutyHeld = false;
+		}
+		return;
+	}
+	if (!s_DutyHeld)
+	{
+		s_Duty = EVE_Hal_rd8(phost, REG_PWM_DUTY);
+		s_DutyHeld = true;
+	}
+	EVE_Hal_wr8(phost, REG_PWM_DUTY, min(s_Duty, cap));
+}
+
+static void setLevel(Esd_Context *ec, uint8_t level, int16_t temp)
+{
+	eve_printf_debug("Thermal level %d at %d C\n", (int)level, (int)(temp >> 8));
+	s_Level = level;
+
+	ec->MaxFps = c_Fps[level];
+	Esd_SetTargetFps(ec, ec->TargetFps);
+	Esd_SysClk_SetMax(level >= 3 ? ESD_THERMAL_LEVEL3_SYSCLK : ESD_SYSCLK_MAX);
+	s_DutyPending = true;
+	Esd_Invalidate();
+}
+
+ESD_CORE_EXPORT void Esd_Thermal_Update()
+{
+	Esd_Context *ec = Esd_CurrentContext;
+	uint32_t timestamp;
+	int16_t temp;
+	uint8_t level;
+
+	if (s_DutyPending && Esd_Power_State() == ESD_POWER_ACTIVE)
+		applyDuty();
+
+	if (!Esd_ThermalSample)
+		return;
+	if (s_Started && (ec->Millis - s_CheckMillis) < ESD_THERMAL_PERIOD_MS)
+		return;
+	s_Started = true;
+	s_CheckMillis = ec->Millis;
+
+	if (!Esd_ThermalSample(&temp, &timestamp))
+		return;
+	// The sample may have been taken after the frame time was read
+	if ((int32_t)(ec->Millis - timestamp) > ESD_THERMAL_STALE_MS)
+	{
+		if (!s_Stale)
+			eve_printf_debug("Temperature sample is stale, keeping thermal level %d\n", (int)s_Level);
+		s_Stale = true;
+		return;
+	}
+	s_Stale = false;
+
+	level = s_Level;
+	while (level < ESD_THERMAL_LEVELS && temp >= c_Threshold[level + 1])
+		++level;
+	if (level == s_Level && level && temp < c_Threshold[level] - (ESD_THERMAL_HYSTERESIS_C << 8))
+		--level;
+	if (level != s_Level)
+		setLevel(ec, level, temp);
+}
+
+#endif /* #if ESD_THERMAL */
+
+/* end of file */
@@ -0,0 +1,111 @@
+
+#ifndef ESD_THERMAL__H
+#define ESD_THERMAL__H
+
+#include "Esd_Base.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+Thermal throttling.
+With ESD_THERMAL, Esd_Update reads the board temperature every ESD_THERMAL_PERIOD_MS through Esd_ThermalSample,
+which has the signature of max31725_sample in the BSP. The application starts the sampler at boot, and keeps
+calling max31725_sampler_poll, for example from the Idle callback:
+	max31725_sampler_start(1000, EVE_millis);
+	Esd_ThermalSample = max31725_sample;
+
+Each threshold reached adds a level of throttling, and the lower levels stay in effect:
+from ESD_THERMAL_LEVEL1_C the frame rate is capped at ESD_THERMAL_LEVEL1_FPS,
+from ESD_THERMAL_LEVEL2_C the frame rate is capped at ESD_THERMAL_LEVEL2_FPS and the backlight duty at ESD_THERMAL_LEVEL2_DUTY,
+from ESD_THERMAL_LEVEL3_C the frame rate and the duty drop further, and the EVE clock is limited to ESD_THERMAL_LEVEL3_SYSCLK.
+A level is left once the temperature is ESD_THERMAL_HYSTERESIS_C below its threshold, one level per period.
+Touch keeps working at every level, only the frame rate it is shown at changes.
+
+The frame rate cap is the MaxFps ceiling of the context, the rate set with Esd_SetTargetFps is restored once it is lifted.
+The duty set by the application when throttling started is restored after cooling down, changes in between are overridden.
+While Esd_Power has the backlight dimmed or off, the duty is left to it and capped when the screen is active again.
+The clock limit requires ESD_SYSCLK_POLICY. A sensor that stops reporting for ESD_THERMAL_STALE_MS keeps the current level.
+*/
+
+#ifndef ESD_THERMAL
+#define ESD_THERMAL 0
+#endif
+
+// Thresholds in degrees Celsius
+#ifndef ESD_THERMAL_LEVEL1_C
+#define ESD_THERMAL_LEVEL1_C 60
+#endif
+#ifndef ESD_THERMAL_LEVEL2_C
+#define ESD_THERMAL_LEVEL2_C 70
+#endif
+#ifndef ESD_THERMAL_LEVEL3_C
+#define ESD_THERMAL_LEVEL3_C 80
+#endif
+
+#ifndef ESD_THERMAL_HYSTERESIS_C
+#define ESD_THERMAL_HYSTERESIS_C 3
+#endif
+
+// Frame rate ceiling at each level
+#ifndef ESD_THERMAL_LEVEL1_FPS
+#define ESD_THERMAL_LEVEL1_FPS 30
+#endif
+#ifndef ESD_THERMAL_LEVEL2_FPS
+#define ESD_THERMAL_LEVEL2_FPS 20
+#endif
+#ifndef ESD_THERMAL_LEVEL3_FPS
+#define ESD_THERMAL_LEVEL3_FPS 10
+#endif
+
+// REG_PWM_DUTY ceiling, out of 128
+#ifndef ESD_THERMAL_LEVEL2_DUTY
+#define ESD_THERMAL_LEVEL2_DUTY 80
+#endif
+#ifndef ESD_THERMAL_LEVEL3_DUTY
+#define ESD_THERMAL_LEVEL3_DUTY 48
+#endif
+
+// Fastest EVE clock at the last level
+#ifndef ESD_THERMAL_LEVEL3_SYSCLK
+#define ESD_THERMAL_LEVEL3_SYSCLK EVE_SYSCLK_36M
+#endif
+
+#ifndef ESD_THERMAL_PERIOD_MS
+#define ESD_THERMAL_PERIOD_MS 1000
+#endif
+
+#ifndef ESD_THERMAL_STALE_MS
+#define ESD_THERMAL_STALE_MS 10000
+#endif
+
+#define ESD_THERMAL_LEVELS 3
+
+// Latest temperature in 1/256 degrees Celsius and the EVE_millis time it was taken at, false when there is none yet
+typedef bool (*Esd_ThermalSampleCallback)(int16_t *degCQ8, uint32_t *timestamp);
+
+#if ESD_THERMAL
+
+extern ESD_CORE_EXPORT Esd_ThermalSampleCallback Esd_ThermalSample;
+
+// Throttling level, from 0 when running at full speed to ESD_THERMAL_LEVELS
+ESD_CORE_EXPORT uint8_t Esd_Thermal_Level();
+
+// Reads the temperature and applies the level, called from Esd_Update after Esd_Power_Update
+ESD_CORE_EXPORT void Esd_Thermal_Update();
+
+#else
+
+#define Esd_Thermal_Level() 0
+#define Esd_Thermal_Update() eve_noop()
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* #ifndef ESD_THERMAL__H */
+
+/* end of file */
@@ -0,0 +1,272 @@
+
+#include "Esd_TiledImage.h"
+
+#if ESD_TILED_IMAGE
+
+#include "Esd_Context.h"
+#include "Esd_AsyncLoad.h"
+#include "Esd_BitmapHandle.h"
+#include "Esd_Render.h"
+#include "Esd_Utility.h"
+
+extern ESD_CORE_EXPORT Esd_GpuAlloc *Esd_GAlloc;
+
+typedef struct
+{
+	Esd_BitmapInfo Info; // Bitmap of the tile, including the gutter
+	Esd_TiledImage *Image; // NULL when the slot is free
+	uint16_t Column;
+	uint16_t Row;
+	uint32_t UsedFrame; // Last frame in which the tile was on screen or in the prefetch ring
+} Esd_TiledImageSlot;
+
+static Esd_TiledImageSlot s_Slots[ESD_TILED_IMAGE_SLOTS];
+
+// For the visible tiles when they are not loaded in the background
+static EVE_Asset s_Asset;
+
+static int64_t floorDiv(int64_t a, int64_t b)
+{
+	int64_t q = a / b;
+	if ((a % b) && ((a < 0) != (b < 0)))
+		--q;
+	return q;
+}
+
+// Range of tiles covering the screen span from 0 to size, of tiles of the given size on screen starting at offset
+static bool tileRange(int32_t *first, int32_t *last, int64_t offset, int64_t tile, int32_t size, int32_t count)
+{
+	int64_t f = floorDiv(-offset, tile);
+	int64_t l = floorDiv(((int64_t)size << 16) - 1 - offset, tile);
+	if (l < 0 || f >= count)
+		return false;
+	*first = (int32_t)max(f, 0);
+	*last = (int32_t)min(l, count - 1);
+	return true;
+}
+
+static Esd_TiledImageSlot *findSlot(Esd_TiledImage *image, int32_t column, int32_t row)
+{
+	for (uint32_t i = 0; i < ESD_TILED_IMAGE_SLOTS; ++i)
+	{
+		Esd_TiledImageSlot *slot = &s_Slots[i];
+		if (slot->Image == image && slot->Column == column && slot->Row == row)
+			return slot;
+	}
+	return NULL;
+}
+
+// Free slot, or the one which has been off screen the longest. Slots used in this frame or still uploading are kept
+static Esd_TiledImageSlot *claimSlot()
+{
+	uint32_t frame = Esd_CurrentContext->Frame;
+	Esd_TiledImageSlot *best = NULL;
+
+	for (uint32_t i = 0; i < ESD_TILED_IMAGE_SLOTS; ++i)
+	{
+		Esd_TiledImageSlot *slot = &s_Slots[i];
+		if (slot->Info.Loading || (slot->Image && slot->UsedFrame == frame))
+			continue;
+		if (!slot->Image)
+		{
+			best = slot;
+			break;
+		}
+		if (!best || (frame - slot->UsedFrame) > (frame - best->UsedFrame))
+			best = slot;
+	}
+	if (best)
+	{
+		// The previous frame may still show the old tile
+		Esd_DeferredGpuFree(best->Info.GpuHandle);
+		best->Info.GpuHandle = GA_HANDLE_INVALID;
+		best->Image = NULL;
+	}
+	return best;
+}
+
+// Allocates and uploads the tile, returns true when it can be drawn in this frame
+static bool loadTile(Esd_TiledImageSlot *slot, bool visible)
+{
+	EVE_HalContext *phost = Esd_GetHost();
+	Esd_TiledImage *image = slot->Image;
+	uint32_t offset = ((uint32_t)slot->Row * image->Columns + slot->Column) * image->TileSize;
+	uint32_t addr;
+
+	slot->Info.GpuHandle = Esd_GpuAlloc_Alloc(Esd_GAlloc, slot->Info.Size, GA_GC_FLAG);
+	addr = Esd_GpuAlloc_Get(Esd_GAlloc, slot->Info.GpuHandle);
+	if (addr == GA_INVALID)
+		return false;
+
+	if ((Esd_CurrentContext->AsyncLoad || Esd_CurrentContext->Preloading)
+	    && Esd_AsyncLoad_QueueRegion(&slot->Info, offset))
+		return false;
+
+	// Only what is on screen is worth waiting for
+	if (!visible)
+	{
+		Esd_GpuAlloc_Free(Esd_GAlloc, slot->Info.GpuHandle);
+		return false;
+	}
+
+	if (!EVE_Util_openAsset(phost, &s_Asset, image->File))
+	{
+		Esd_GpuAlloc_Free(Esd_GAlloc, slot->Info.GpuHandle);
+		return false;
+	}
+	if (!EVE_Util_loadAssetRegion(phost, &s_Asset, offset, addr, slot->Info.Size))
+	{
+		eve_printf_debug("Failed to load tile %i, %i of '%s'\n", (int)slot->Column, (int)slot->Row, image->File);
+		EVE_Util_closeAsset(phost, &s_Asset);
+		Esd_GpuAlloc_Free(Esd_GAlloc, slot->Info.GpuHandle);
+		return false;
+	}
+	EVE_Util_closeAsset(phost, &s_Asset);
+	Esd_GpuAlloc_Seal(Esd_GAlloc, slot->Info.GpuHandle);
+	return true;
+}
+
+// Returns the slot of the tile when it is in RAM_G, otherwise requests it and returns NULL
+static Esd_TiledImageSlot *requestTile(Esd_TiledImage *image, int32_t column, int32_t row, bool visible)
+{
+	Esd_TiledImageSlot *slot = findSlot(image, column, row);
+	bool async = Esd_CurrentContext->AsyncLoad || Esd_CurrentContext->Preloading;
+
+	if (slot)
+	{
+		slot->UsedFrame = Esd_CurrentContext->Frame;
+		if (slot->Info.Loading)
+		{
+			Esd_AsyncLoad_Touch(&slot->Info);
+			return NULL;
+		}
+		if (Esd_GpuAlloc_Get(Esd_GAlloc, slot->Info.GpuHandle) != GA_INVALID)
+			return slot;
+
+		// Evicted, load it again into the same slot
+		if (!visible && !async)
+			return NULL;
+		return loadTile(slot, visible) ? slot : NULL;
+	}
+
+	if (!visible && !async)
+		return NULL;
+	slot = claimSlot();
+	if (!slot)
+		return NULL;
+
+	slot->Image = image;
+	slot->Column = (uint16_t)column;
+	slot->Row = (uint16_t)row;
+	slot->UsedFrame = Esd_CurrentContext->Frame;
+	slot->Info = (Esd_BitmapInfo){
+		ESD_BITMAP_DEFAULTS,
+		.Width = image->TileWidth + 2 * ESD_TILED_IMAGE_GUTTER,
+		.Height = image->TileHeight + 2 * ESD_TILED_IMAGE_GUTTER,
+		.Stride = image->TileStride,
+		.Format = image->Format,
+		.Size = image->TileStride * (image->TileHeight + 2 * ESD_TILED_IMAGE_GUTTER),
+		.File = image->File,
+		.Type = ESD_RESOURCE_FILE,
+		.Cells = 1,
+	};
+	return loadTile(slot, visible) ? slot : NULL;
+}
+
+ESD_CORE_EXPORT void Esd_TiledImage_Render(int16_t x, int16_t y, Esd_BitmapInfo *bitmapInfo, esd_argb32_t c, esd_int32_f16_t xscale, esd_int32_f16_t yscale, esd_int32_f16_t xoffset, esd_int32_f16_t yoffset, int16_t width, int16_t height)
+{
+	EVE_HalContext *phost = Esd_GetHost();
+	Esd_TiledImage *image = bitmapInfo->Tiled;
+	Esd_TiledImageSlot *ready[ESD_TILED_IMAGE_SLOTS];
+	uint32_t nbReady = 0;
+	Esd_TransformState state;
+	int64_t tileWidth, tileHeight, imageRight, imageBottom;
+	int32_t c0, c1, r0, r1;
+
+	if (xscale <= 0 || yscale <= 0 || width <= 0 || height <= 0)
+		return;
+
+	// Sizes on screen, in Q16 pixels relative to the widget
+	tileWidth = (int64_t)xscale * image->TileWidth;
+	tileHeight = (int64_t)yscale * image->TileHeight;
+	imageRight = xoffset + (int64_t)xscale * bitmapInfo->Width;
+	imageBottom = yoffset + (int64_t)yscale * bitmapInfo->Height;
+	if (!tileRange(&c0, &c1, xoffset, tileWidth, width, image->Columns)
+	    || !tileRange(&r0, &r1, yoffset, tileHeight, height, image->Rows))
+		return;
+
+	// Load what is on screen first, uploads are queued in the order requested
+	for (int32_t row = r0; row <= r1; ++row)
+	{
+		for (int32_t column = c0; column <= c1; ++column)
+		{
+			Esd_TiledImageSlot *slot = requestTile(image, column, row, true);
+			if (slot && nbReady < ESD_TILED_IMAGE_SLOTS)
+				ready[nbReady++] = slot;
+		}
+	}
+	for (int32_t row = max(r0 - ESD_TILED_IMAGE_PREFETCH, 0); row <= min(r1 + ESD_TILED_IMAGE_PREFETCH, image->Rows - 1); ++row)
+	{
+		for (int32_t column = max(c0 - ESD_TILED_IMAGE_PREFETCH, 0); column <= min(c1 + ESD_TILED_IMAGE_PREFETCH, image->Columns - 1); ++column)
+		{
+			if (row < r0 || row > r1 || column < c0 || column > c1)
+				requestTile(image, column, row, false);
+		}
+	}
+	if (!nbReady)
+		return;
+
+	EVE_CoDl_colorArgb_ex(phost, c);
+	Esd_CoDl_BeginTransform(&state);
+	EVE_CoDl_begin(phost, BITMAPS);
+	for (uint32_t i = 0; i < nbReady; ++i)
+	{
+		Esd_TiledImageSlot *slot = ready[i];
+		int64_t tileX = xoffset + tileWidth * slot->Column;
+		int64_t tileY = yoffset + tileHeight * slot->Row;
+		// Clipped to the image, edge tiles are padded, and to the widget
+		int32_t left = (int32_t)max(floorDiv(tileX, 1 << 16), 0);
+		int32_t top = (int32_t)max(floorDiv(tileY, 1 << 16), 0);
+		int32_t right = (int32_t)min(floorDiv(min(tileX + tileWidth, imageRight) + 0xFFFF, 1 << 16), width);
+		int32_t bottom = (int32_t)min(floorDiv(min(tileY + tileHeight, imageBottom) + 0xFFFF, 1 << 16), height);
+		Esd_Transform transform;
+		uint8_t handle;
+
+		if (right <= left || bottom <= top)
+			continue;
+		handle = Esd_CoDl_SetupBitmap(&slot->Info);
+		if (!ESD_BITMAPHANDLE_VALID(handle))
+			continue;
+
+		Esd_CoDl_BitmapSize(handle, BILINEAR, BORDER, BORDER, (uint16_t)(right - left), (uint16_t)(bottom - top));
+		Esd_Transform_Identity(&transform);
+		Esd_Transform_Translate(&transform, (int32_t)(tileX - ((int64_t)left << 16)), (int32_t)(tileY - ((int64_t)top << 16)));
+		Esd_Transform_Scale(&transform, xscale, yscale);
+		Esd_Transform_Translate(&transform, -ESD_TILED_IMAGE_GUTTER << 16, -ESD_TILED_IMAGE_GUTTER << 16);
+		Esd_CoDl_Transform(&state, &transform);
+		Esd_CoDl_Bitmap_Vertex((int16_t)(x + left), (int16_t)(y + top), handle, 0);
+	}
+	EVE_CoDl_end(phost);
+	Esd_CoDl_EndTransform(&state);
+}
+
+ESD_CORE_EXPORT void Esd_TiledImage_Release(Esd_TiledImage *image)
+{
+	for (uint32_t i = 0; i < ESD_TILED_IMAGE_SLOTS; ++i)
+	{
+		Esd_TiledImageSlot *slot = &s_Slots[i];
+		if (slot->Image != image)
+			continue;
+		slot->Image = NULL;
+		// An upload in progress is dropped by the loader once it is no longer touched, claimSlot frees it after
+		if (!slot->Info.Loading)
+		{
+			Esd_DeferredGpuFree(slot->Info.GpuHandle);
+			slot->Info.GpuHandle = GA_HANDLE_INVALID;
+		}
+	}
+}
+
+#endif /* #if ESD_TILED_IMAGE */
+
+/* end of file */
@@ -0,0 +1,85 @@
+
+#ifndef ESD_TILEDIMAGE__H
+#define ESD_TILEDIMAGE__H
+
+#include "Esd_Base.h"
+#include "Esd_BitmapInfo.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+Tiled images, for images larger than RAM_G.
+Tools/esd_imageconv.py --tiles cuts the image into fixed size tiles, written row by row to a single
+file in the asset bundle. Each tile starts at a multiple of TileSize, a whole number of SD card sectors,
+and holds a one pixel gutter copied from its neighbours, so bilinear filtering does not show the seams.
+The generated Esd_BitmapInfo has no File, and points to the Esd_TiledImage through Tiled.
+
+Esd_Render_Bitmap_Scaled draws only the tiles which intersect the widget, so the scroll offset and scale
+of Ft_Esd_ScrollableImageWidget work as they do for a regular bitmap. Tiles up to ESD_TILED_IMAGE_PREFETCH
+tiles beyond the viewport are requested as well, so they are in RAM_G by the time they scroll into view.
+Tiles are uploaded by the background loader, see Esd_AsyncLoad.h, or synchronously for the visible ones
+when AsyncLoad is not set. A tile which is not uploaded yet is left empty.
+
+Resident tiles are kept in a pool of ESD_TILED_IMAGE_SLOTS entries shared by all tiled images, each with
+its own collected RAM_G allocation, which the residency manager of Esd_GpuAlloc.h evicts when space is
+needed. When a slot is reused for another tile, its previous allocation is released once off screen.
+The pool must hold at least the tiles a widget shows at once, the prefetch ring only takes the slots left.
+Tiles are uncompressed, in L8, RGB332, RGB565, ARGB1555 or ARGB4.
+*/
+
+#ifndef ESD_TILED_IMAGE
+#define ESD_TILED_IMAGE 0
+#endif
+
+// Number of tiles resident at once, for all tiled images
+#ifndef ESD_TILED_IMAGE_SLOTS
+#define ESD_TILED_IMAGE_SLOTS 24
+#endif
+
+// Number of tile rows and columns around the viewport which are loaded ahead
+#ifndef ESD_TILED_IMAGE_PREFETCH
+#define ESD_TILED_IMAGE_PREFETCH 1
+#endif
+
+// Pixels copied from the neighbouring tiles on each side of a tile
+#define ESD_TILED_IMAGE_GUTTER 1
+
+typedef struct Esd_TiledImage
+{
+	// File holding the tiles, row by row
+	const char *File;
+	uint32_t Format;
+
+	// Size of a tile, excluding the gutter. Tiles in the last column and row are padded to this size
+	uint16_t TileWidth;
+	uint16_t TileHeight;
+	uint16_t Columns;
+	uint16_t Rows;
+
+	// Bytes per row of a tile, including the gutter
+	uint32_t TileStride;
+
+	// Distance between tiles in the file, a multiple of 512
+	uint32_t TileSize;
+
+} Esd_TiledImage;
+
+#if ESD_TILED_IMAGE
+
+// Draws the part of the tiled bitmap inside the widget rectangle, with the transform of Esd_Render_Bitmap_Scaled
+ESD_CORE_EXPORT void Esd_TiledImage_Render(int16_t x, int16_t y, Esd_BitmapInfo *bitmapInfo, esd_argb32_t c, esd_int32_f16_t xscale, esd_int32_f16_t yscale, esd_int32_f16_t xoffset, esd_int32_f16_t yoffset, int16_t width, int16_t height);
+
+// Forgets the resident tiles of an image, such as before its file is replaced
+ESD_CORE_EXPORT void Esd_TiledImage_Release(Esd_TiledImage *image);
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* #ifndef ESD_TILEDIMAGE__H */
+
+/* end of file */
@@ -0,0 +1,117 @@
+
+#include "Esd_Timer.h"
+
+#if ESD_TIMER_WHEEL
+
+#define ESD_TIMER_WHEEL_MASK (ESD_TIMER_WHEEL_SLOTS - 1)
+#define ESD_TIMER_WHEEL_SPAN (1UL << (ESD_TIMER_WHEEL_LEVELS * ESD_TIMER_WHEEL_BITS))
+
+// Level 0 has one slot per millisecond, an entry in level n is moved down once its slot comes up
+static Esd_TimerEntry *s_Slots[ESD_TIMER_WHEEL_LEVELS][ESD_TIMER_WHEEL_SLOTS];
+static uint32_t s_Now = 0;
+static uint32_t s_Count = 0;
+
+static void linkEntry(Esd_TimerEntry *entry)
+{
+	uint32_t delta = entry->Due - s_Now;
+	uint32_t due = entry->Due;
+	uint32_t level = 0;
+	Esd_TimerEntry **slot;
+
+	while (level < (ESD_TIMER_WHEEL_LEVELS - 1) && delta >= (1UL << ((level + 1) * ESD_TIMER_WHEEL_BITS)))
+		++level;
+	if (delta >= ESD_TIMER_WHEEL_SPAN)
+		due = s_Now + ESD_TIMER_WHEEL_SPAN - 1; // Out of range, placed in the last slot and cascaded again before it is due
+
+	slot = &s_Slots[level][(due >> (level * ESD_TIMER_WHEEL_BITS)) & ESD_TIMER_WHEEL_MASK];
+	entry->Next = *slot;
+	if (entry->Next)
+		entry->Next->Previous = &entry->Next;
+	entry->Previous = slot;
+	*slot = entry;
+}
+
+static void cascade(uint32_t level)
+{
+	Esd_TimerEntry **slot = &s_Slots[level][(s_Now >> (level * ESD_TIMER_WHEEL_BITS)) & ESD_TIMER_WHEEL_MASK];
+	Esd_TimerEntry *entry = *slot;
+	*slot = NULL;
+	while (entry)
+	{
+		Esd_TimerEntry *next = entry->Next;
+		linkEntry(entry); // Always lands in a lower level
+		entry = next;
+	}
+}
+
+ESD_CORE_EXPORT void Esd_Timer_Schedule(Esd_TimerEntry *entry, uint32_t delayMs)
+{
+	Esd_Timer_Cancel(entry);
+	entry->Due = s_Now + (delayMs ? delayMs : 1);
+	linkEntry(entry);
+	++s_Count;
+}
+
+ESD_CORE_EXPORT void Esd_Timer_Cancel(Esd_TimerEntry *entry)
+{
+	if (!entry->Previous)
+		return;
+	*entry->Previous = entry->Next;
+	if (entry->Next)
+		entry->Next->Previous = entry->Previous;
+	entry->Next = NULL;
+	entry->Previous = NULL;
+	--s_Count;
+}
+
+ESD_CORE_EXPORT uint32_t Esd_Timer_Remaining(Esd_TimerEntry *entry)
+{
+	return entry->Previous ? (entry->Due - s_Now) : 0;
+}
+
+ESD_CORE_EXPORT void Esd_Timer_UpdateGlobal(uint32_t deltaMs)
+{
+	while (deltaMs)
+	{
+		Esd_TimerEntry **slot;
+		uint32_t level;
+
+		if (!s_Count)
+		{
+			// Nothing scheduled, no slots to visit
+			s_Now += deltaMs;
+			return;
+		}
+
+		++s_Now;
+		--deltaMs;
+		for (level = 1; level < ESD_TIMER_WHEEL_LEVELS && !(s_Now & ((1UL << (level * ESD_TIMER_WHEEL_BITS)) - 1)); ++level)
+			cascade(level);
+
+		// Entries in the current slot are due now, they may schedule themselves again
+		slot = &s_Slots[0][s_Now & ESD_TIMER_WHEEL_MASK];
+		while (*slot)
+		{
+			Esd_TimerEntry *entry = *slot;
+			Esd_Timer_Cancel(entry);
+			entry->Expired(entry);
+		}
+	}
+}
+
+ESD_CORE_EXPORT void Esd_Timer_CancelGlobal()
+{
+	uint32_t level, i;
+	for (level = 0; level < ESD_TIMER_WHEEL_LEVELS; ++level)
+	{
+		for (i = 0; i < ESD_TIMER_WHEEL_SLOTS; ++i)
+		{
+			while (s_Slots[level][i])
+				Esd_Timer_Cancel(s_Slots[level][i]);
+		}
+	}
+}
+
+#endif
+
+/* end of file */
@@ -0,0 +1,74 @@
+
+#ifndef ESD_TIMER__H
+#define ESD_TIMER__H
+
+#include "Esd_Base.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+Global timer wheel.
+With ESD_TIMER_WHEEL, Ft_Esd_Timer instances are scheduled on a hierarchical wheel advanced
+by Esd_Update with the frame delta time, instead of each timer counting down from the Update
+slot of its owner. A frame only touches the timers which are due, plus one cascade step for
+every ESD_TIMER_WHEEL_SLOTS milliseconds, independent of the number of running timers.
+Timers then keep running while their owner is inactive, until halted or ended.
+*/
+
+#ifndef ESD_TIMER_WHEEL
+#define ESD_TIMER_WHEEL 0
+#endif
+
+// Number of levels, each level covering ESD_TIMER_WHEEL_SLOTS times the span of the previous one
+#define ESD_TIMER_WHEEL_LEVELS 4
+
+// Number of slots per level as a power of two, the first level has one slot per millisecond
+#define ESD_TIMER_WHEEL_BITS 6
+#define ESD_TIMER_WHEEL_SLOTS (1 << ESD_TIMER_WHEEL_BITS)
+
+typedef struct Esd_TimerEntry
+{
+	struct Esd_TimerEntry *Next;
+	struct Esd_TimerEntry **Previous; // Pointer linking to this entry, NULL when not scheduled
+	uint32_t Due; // Wheel time at which the entry expires
+	void (*Expired)(struct Esd_TimerEntry *entry);
+} Esd_TimerEntry;
+
+#if ESD_TIMER_WHEEL
+
+// Schedules the entry to expire after delayMs, at least one millisecond. Reschedules when already scheduled
+ESD_CORE_EXPORT void Esd_Timer_Schedule(Esd_TimerEntry *entry, uint32_t delayMs);
+
+// Removes the entry from the wheel, does nothing when not scheduled
+ESD_CORE_EXPORT void Esd_Timer_Cancel(Esd_TimerEntry *entry);
+
+// Milliseconds until the entry expires, 0 when not scheduled
+ESD_CORE_EXPORT uint32_t Esd_Timer_Remaining(Esd_TimerEntry *entry);
+
+// Advances the wheel and calls Expired on due entries, called from Esd_Update
+ESD_CORE_EXPORT void Esd_Timer_UpdateGlobal(uint32_t deltaMs);
+
+// Removes all entries, called from Esd_Stop
+ESD_CORE_EXPORT void Esd_Timer_CancelGlobal();
+
+static inline bool Esd_Timer_IsScheduled(Esd_TimerEntry *entry)
+{
+	return entry->Previous != NULL;
+}
+
+#else
+
+#define Esd_Timer_UpdateGlobal(deltaMs) eve_noop()
+#define Esd_Timer_CancelGlobal() eve_noop()
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* #ifndef ESD_TIMER__H */
+
+/* end of file */
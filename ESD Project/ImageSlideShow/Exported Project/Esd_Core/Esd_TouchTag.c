@@ -1,6 +1,7 @@
 
 #include "Esd_TouchTag.h"
 #include "Esd_Context.h"
+#include "Esd_Gesture.h"
 
 static uint32_t s_LastTagFrame = ~0;
 #if defined(_MSC_VER) && (_MSC_VER < 1800)
@@ -38,6 +39,34 @@ typedef union
 static Esd_TouchPos_t s_TouchPos = { 0 };
 int16_t s_TouchPosXDelta = 0;
 int16_t s_TouchPosYDelta = 0;
+static uint32_t s_TouchMillis = 0;
+static bool s_Touching = false;
+
+#if ESD_TOUCHTAG_MULTITOUCH
+// Contacts reported by the touch controller in extended mode, contact 0 mirrors s_TouchPos and s_GpuRegTouchTag
+static bool s_MultiTouch = false;
+static uint8_t s_Contacts = 0;
+static Esd_TouchPos_t s_ContactPos[ESD_TOUCHTAG_CONTACTS] = { 0 };
+static uint8_t s_ContactTag[ESD_TOUCHTAG_CONTACTS] = { 0 };
+#endif
+
+#if EVE_INTERRUPT
+// Touch samples latched from INT_N between frames, so taps shorter than a frame are not lost
+typedef struct
+{
+	uint32_t Millis;
+	uint32_t XY;
+	uint8_t Tag;
+} Esd_TouchSample;
+static Esd_TouchSample s_TouchQueue[ESD_TOUCHTAG_QUEUE_SIZE];
+static uint8_t s_TouchQueueFirst = 0;
+static uint8_t s_TouchQueueCount = 0;
+static bool s_PollTouching = false;
+#endif
+
+#if ESD_GESTURE
+static uint32_t s_GestureMillis = 0; // Time of the last sample read between frames
+#endif
 
 static Esd_TouchTag *s_TagHandlers[256] = {
 	&s_NullTag, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
@@ -50,6 +79,35 @@ static Esd_TouchTag *s_TagHandlers[256] = {
 	NULL, NULL, NULL, NULL, NULL, NULL, NULL, &s_NullTag
 };
 
+// Unallocated tags, linked through s_NextFreeTag, tag 0 ends the list
+static uint8_t s_NextFreeTag[256];
+static uint8_t s_FreeTag = 0;
+static bool s_FreeTagsLinked = false;
+
+// Incremented whenever a tag is released
+static uint8_t s_TagGeneration[256];
+
+static void Esd_TouchTag_LinkFreeTags()
+{
+	int i;
+	s_FreeTag = 0;
+	for (i = 254; i > 0; --i)
+	{
+		// Linked from the top, so the lowest tags are handed out first, skipping reserved tags
+		if (!s_TagHandlers[i])
+		{
+			s_NextFreeTag[i] = s_FreeTag;
+			s_FreeTag = (uint8_t)i;
+		}
+	}
+	s_FreeTagsLinked = true;
+}
+
+static inline bool Esd_TouchTag_Owns(Esd_TouchTag *context)
+{
+	return s_TagHandlers[context->Tag] == context && s_TagGeneration[context->Tag] == context->Generation;
+}
+
 ESD_CORE_EXPORT void Esd_TouchTag__Initializer(Esd_TouchTag *context)
 {
 	*context = s_NullTag;
@@ -57,40 +115,200 @@ ESD_CORE_EXPORT void Esd_TouchTag__Initializer(Esd_TouchTag *context)
 
 ESD_CORE_EXPORT void Esd_TouchTag_Start(Esd_TouchTag *context)
 {
-	int i;
-
+	uint8_t tag;
 
 	if (context->Tag)
 	{
 		Esd_TouchTag_End(context);
 	}
 
-	// Allocate tag
-	for (i = 1; i < 255; ++i)
+	if (!s_FreeTagsLinked)
+		Esd_TouchTag_LinkFreeTags();
+
+	// Allocate tag, none left when the head is 0
+	tag = s_FreeTag;
+	if (tag)
 	{
-		if (!s_TagHandlers[i])
+		s_FreeTag = s_NextFreeTag[tag];
+		s_TagHandlers[tag] = context;
+		context->Tag = tag;
+		context->Generation = s_TagGeneration[tag];
+	}
+}
+
+// Read REG_TOUCH_TAG_XY and REG_TOUCH_TAG in one transfer, in extended mode followed by REG_TOUCH_TAG1_XY up to REG_TOUCH_TAG4
+static void Esd_TouchTag_ReadRegs(EVE_HalContext *phost, uint32_t *regValue)
+{
+#if ESD_TOUCHTAG_MULTITOUCH
+	uint32_t regAddr[2 * ESD_TOUCHTAG_CONTACTS];
+	uint32_t count = s_MultiTouch ? (2 * ESD_TOUCHTAG_CONTACTS) : 2;
+	uint32_t i;
+	for (i = 0; i < count; ++i)
+		regAddr[i] = REG_TOUCH_TAG_XY + (i << 2);
+	EVE_Hal_rdRegs(phost, regValue, regAddr, count);
+#else
+	uint32_t regAddr[2];
+	regAddr[0] = REG_TOUCH_TAG_XY;
+	regAddr[1] = REG_TOUCH_TAG;
+	EVE_Hal_rdRegs(phost, regValue, regAddr, 2);
+#endif
+}
+
+#if ESD_TOUCHTAG_MULTITOUCH
+// Update the contacts from the register values, entries past count are not touching
+static void Esd_TouchTag_UpdateContacts(const uint32_t *regValue, uint32_t count)
+{
+	uint8_t contacts = 0;
+	uint32_t i;
+	for (i = 0; i < ESD_TOUCHTAG_CONTACTS; ++i)
+	{
+		uint32_t regTouchXY = (i < count) ? regValue[i << 1] : 0x80008000;
+		if (regTouchXY & 0x80008000)
+		{
+			s_ContactTag[i] = 0;
+		}
+		else
+		{
+			s_ContactPos[i].XY = regTouchXY;
+			s_ContactTag[i] = (uint8_t)regValue[(i << 1) + 1];
+			contacts |= (uint8_t)(1 << i);
+		}
+	}
+	s_Contacts = contacts;
+}
+#endif
+
+#if ESD_GESTURE
+// Pass the register values to the gesture recognizer, with the first two contacts that are touching
+static void Esd_TouchTag_FeedGesture(uint32_t millis, const uint32_t *regValue)
+{
+	Esd_TouchPos_t pos[2] = { { 0 }, { 0 } };
+	int count = 0;
+#if ESD_TOUCHTAG_MULTITOUCH
+	uint32_t regCount = s_MultiTouch ? ESD_TOUCHTAG_CONTACTS : 1;
+#else
+	uint32_t regCount = 1;
+#endif
+	uint32_t i;
+	for (i = 0; i < regCount; ++i)
+	{
+		if (!(regValue[i << 1] & 0x80008000))
 		{
-			s_TagHandlers[i] = context;
-			context->Tag = i;
-			break;
+			if (count < 2)
+				pos[count].XY = regValue[i << 1];
+			++count;
 		}
 	}
+	Esd_Gesture_Sample(millis, (uint8_t)regValue[1], count, pos[0].X, pos[0].Y, pos[1].X, pos[1].Y);
+}
+#endif
+
+ESD_CORE_EXPORT void Esd_TouchTag_Poll()
+{
+#if EVE_INTERRUPT || ESD_GESTURE
+	EVE_HalContext *phost = Esd_GetHost();
+#if ESD_TOUCHTAG_MULTITOUCH
+	uint32_t regValue[2 * ESD_TOUCHTAG_CONTACTS];
+#else
+	uint32_t regValue[2];
+#endif
+#endif
+#if EVE_INTERRUPT
+	bool touching;
+#endif
+
+#if ESD_GESTURE
+	if (s_Touching)
+	{
+		// Sampled between frames too, so the swipe velocity does not depend on the frame rate
+		uint32_t millis = EVE_millis();
+		if ((millis - s_GestureMillis) < ESD_GESTURE_SAMPLE_MS)
+			return;
+		s_GestureMillis = millis;
+		Esd_TouchTag_ReadRegs(phost, regValue);
+		Esd_TouchTag_FeedGesture(millis, regValue);
+		return;
+	}
+#endif
+
+#if EVE_INTERRUPT
+
+	// While touching the registers are read every frame anyway, INT_N is armed again when the touch ends
+	if (!phost->InterruptMask || s_Touching || !EVE_Hal_interruptFired(phost))
+		return;
+
+	EVE_Hal_armInterrupt(phost);
+	Esd_TouchTag_ReadRegs(phost, regValue);
+	touching = !(regValue[0] & 0x80008000);
+	if (touching && !s_PollTouching && s_TouchQueueCount < ESD_TOUCHTAG_QUEUE_SIZE)
+	{
+		Esd_TouchSample *sample = &s_TouchQueue[(s_TouchQueueFirst + s_TouchQueueCount) % ESD_TOUCHTAG_QUEUE_SIZE];
+		sample->Millis = phost->InterruptMillis;
+		sample->XY = regValue[0];
+		sample->Tag = (uint8_t)regValue[1];
+		++s_TouchQueueCount;
+	}
+#if ESD_GESTURE
+	// The release of a touch shorter than a frame is only seen here
+	Esd_TouchTag_FeedGesture((touching && !s_PollTouching) ? phost->InterruptMillis : EVE_millis(), regValue);
+#endif
+	s_PollTouching = touching;
+#endif
 }
 
 ESD_CORE_EXPORT void Esd_TouchTag_Update(Esd_TouchTag *context)
 {
 	EVE_HalContext *phost = Esd_GetHost();
 	(void)phost;
-	if (s_LastTagFrame != Esd_CurrentContext->Frame)
+	if (s_LastTagFrame != Esd_CurrentContext->UpdateFrame)
 	{
+#if ESD_TOUCHTAG_MULTITOUCH
+		uint32_t regValue[2 * ESD_TOUCHTAG_CONTACTS];
+		uint32_t regCount = 1;
+#else
+		uint32_t regValue[2];
+#endif
 		uint32_t regTouchXY;
 		uint8_t regTouchTag;
 
 		// Global tag update
-		s_LastTagFrame = Esd_CurrentContext->Frame;
+		s_LastTagFrame = Esd_CurrentContext->UpdateFrame;
 
-		// Read registers
-		regTouchXY = EVE_Hal_rd32(Esd_Host, REG_TOUCH_TAG_XY);
+#if EVE_INTERRUPT
+		Esd_TouchTag_Poll();
+		if (s_TouchQueueCount && !s_Touching)
+		{
+			// Oldest latched touch, processed as a frame of its own followed by at least one read of the registers
+			Esd_TouchSample *sample = &s_TouchQueue[s_TouchQueueFirst];
+			s_TouchQueueFirst = (s_TouchQueueFirst + 1) % ESD_TOUCHTAG_QUEUE_SIZE;
+			--s_TouchQueueCount;
+			regValue[0] = sample->XY;
+			regValue[1] = sample->Tag;
+			s_TouchMillis = sample->Millis;
+		}
+		else if (phost->InterruptMask && !s_Touching)
+		{
+			// Nothing touched since the last frame, no need to read the registers
+			regValue[0] = 0x80008000;
+			regValue[1] = 0;
+		}
+		else
+#endif
+		{
+			Esd_TouchTag_ReadRegs(phost, regValue);
+			s_TouchMillis = Esd_CurrentContext->Millis;
+#if ESD_TOUCHTAG_MULTITOUCH
+			if (s_MultiTouch)
+				regCount = ESD_TOUCHTAG_CONTACTS;
+#endif
+#if ESD_GESTURE
+			Esd_TouchTag_FeedGesture(s_TouchMillis, regValue);
+#endif
+		}
+#if ESD_TOUCHTAG_MULTITOUCH
+		Esd_TouchTag_UpdateContacts(regValue, regCount);
+#endif
+		regTouchXY = regValue[0];
 		if (regTouchXY & 0x80008000)
 		{
 			// No touch
@@ -101,7 +319,7 @@ ESD_CORE_EXPORT void Esd_TouchTag_Update(Esd_TouchTag *context)
 		else
 		{
 			Esd_TouchPos_t prevPos;
-			regTouchTag = EVE_Hal_rd8(Esd_Host, REG_TOUCH_TAG);
+			regTouchTag = (uint8_t)regValue[1];
 			if (!regTouchTag)
 			{
 				// Fallback when touching but touch tag 0 reported, stick to the last recorded tag
@@ -136,12 +354,35 @@ ESD_CORE_EXPORT void Esd_TouchTag_Update(Esd_TouchTag *context)
 		}
 
 		s_GpuRegTouchTag = regTouchTag;
+
+		{
+#if ESD_TOUCHTAG_MULTITOUCH
+			// Keep reading while any contact remains, not only the primary one
+			bool touching = s_Contacts != 0;
+#else
+			bool touching = !(regTouchXY & 0x80008000);
+#endif
+			if (touching || s_Touching)
+				Esd_Invalidate();
+#if EVE_INTERRUPT
+			if (s_Touching && !touching && !s_TouchQueueCount)
+			{
+				// Touch ended, listen on INT_N again
+				s_PollTouching = false;
+				EVE_Hal_armInterrupt(phost);
+			}
+#endif
+			s_Touching = touching;
+		}
+
+		// Gestures of the samples taken since the last frame
+		Esd_Gesture_Dispatch();
 	}
 
 	if (!context)
 		return;
 
-	if (s_TagHandlers[context->Tag] != context)
+	if (!Esd_TouchTag_Owns(context))
 	{
 		// Tag was forced taken over by another widget (CMD_KEYS for example), need to get a new tag...
 		context->Tag = 0;
@@ -188,9 +429,12 @@ ESD_CORE_EXPORT void Esd_TouchTag_End(Esd_TouchTag *context)
 	if (context->Tag)
 	{
 		// Free tag
-		if (s_TagHandlers[context->Tag] == context)
+		if (Esd_TouchTag_Owns(context))
 		{
 			s_TagHandlers[context->Tag] = 0;
+			++s_TagGeneration[context->Tag];
+			s_NextFreeTag[context->Tag] = s_FreeTag;
+			s_FreeTag = (uint8_t)context->Tag;
 		}
 		context->Tag = 0;
 	}
@@ -244,6 +488,85 @@ ESD_CORE_EXPORT int16_t Esd_TouchTag_TouchYDelta(Esd_TouchTag *context)
 	return s_TouchPosYDelta;
 }
 
+ESD_CORE_EXPORT uint32_t Esd_TouchTag_TouchMillis(Esd_TouchTag *context)
+{
+	return s_TouchMillis;
+}
+
+ESD_CORE_EXPORT bool Esd_TouchTag_SetMultiTouch(bool enable)
+{
+#if ESD_TOUCHTAG_MULTITOUCH
+	EVE_HalContext *phost = Esd_GetHost();
+	if (!(EVE_CHIPID & 0x01))
+		return false; // Resistive touch
+
+	EVE_Hal_wr8(phost, REG_CTOUCH_EXTENDED, enable ? CTOUCH_MODE_EXTENDED : CTOUCH_MODE_COMPATIBILITY);
+	s_MultiTouch = enable;
+	if (!enable)
+		s_Contacts &= 0x01;
+	return enable;
+#else
+	return false;
+#endif
+}
+
+ESD_CORE_EXPORT bool Esd_TouchTag_MultiTouch()
+{
+#if ESD_TOUCHTAG_MULTITOUCH
+	return s_MultiTouch;
+#else
+	return false;
+#endif
+}
+
+ESD_CORE_EXPORT uint8_t Esd_TouchTag_Contacts()
+{
+#if ESD_TOUCHTAG_MULTITOUCH
+	return s_Contacts;
+#else
+	return s_Touching ? 0x01 : 0;
+#endif
+}
+
+ESD_CORE_EXPORT int Esd_TouchTag_ContactCount()
+{
+	uint8_t contacts = Esd_TouchTag_Contacts();
+	int count = 0;
+	while (contacts)
+	{
+		contacts &= contacts - 1;
+		++count;
+	}
+	return count;
+}
+
+ESD_CORE_EXPORT int16_t Esd_TouchTag_ContactX(int index)
+{
+#if ESD_TOUCHTAG_MULTITOUCH
+	if (index > 0 && index < ESD_TOUCHTAG_CONTACTS)
+		return s_ContactPos[index].X;
+#endif
+	return index ? 0 : s_TouchPos.X;
+}
+
+ESD_CORE_EXPORT int16_t Esd_TouchTag_ContactY(int index)
+{
+#if ESD_TOUCHTAG_MULTITOUCH
+	if (index > 0 && index < ESD_TOUCHTAG_CONTACTS)
+		return s_ContactPos[index].Y;
+#endif
+	return index ? 0 : s_TouchPos.Y;
+}
+
+ESD_CORE_EXPORT uint8_t Esd_TouchTag_ContactTag(int index)
+{
+#if ESD_TOUCHTAG_MULTITOUCH
+	if (index > 0 && index < ESD_TOUCHTAG_CONTACTS)
+		return s_ContactTag[index];
+#endif
+	return index ? 0 : s_GpuRegTouchTag;
+}
+
 ESD_CORE_EXPORT void Esd_TouchTag_SuppressCurrentTags()
 {
 	s_SuppressCurrentTags = 1;
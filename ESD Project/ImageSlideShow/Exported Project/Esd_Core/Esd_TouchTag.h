@@ -4,6 +4,23 @@
 
 #include "Esd_Base.h"
 
+// Number of touch events latched by INT_N between two frames
+#ifndef ESD_TOUCHTAG_QUEUE_SIZE
+#define ESD_TOUCHTAG_QUEUE_SIZE 4
+#endif
+
+// Track all contacts of a capacitive touch controller in extended mode, see Esd_TouchTag_SetMultiTouch
+#ifndef ESD_TOUCHTAG_MULTITOUCH
+#if defined(EVE_SUPPORT_CAPACITIVE)
+#define ESD_TOUCHTAG_MULTITOUCH 1
+#else
+#define ESD_TOUCHTAG_MULTITOUCH 0
+#endif
+#endif
+
+// Number of concurrent contacts reported by the touch controller in extended mode
+#define ESD_TOUCHTAG_CONTACTS 5
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -36,6 +53,7 @@ typedef struct
 	//
 	int Tag;
 	bool Set;
+	uint8_t Generation; // Generation of the tag when it was allocated, the tag is no longer owned once it differs
 
 } Esd_TouchTag;
 
@@ -93,6 +111,41 @@ ESD_CORE_EXPORT int16_t Esd_TouchTag_TouchXDelta(Esd_TouchTag *context);
 ESD_OUTPUT(TouchYDelta, DisplayName = "Touch Y Delta", Type = int16_t)
 ESD_CORE_EXPORT int16_t Esd_TouchTag_TouchYDelta(Esd_TouchTag *context);
 
+// Time in milliseconds at which the current touch position was sampled, context may be NULL
+ESD_CORE_EXPORT uint32_t Esd_TouchTag_TouchMillis(Esd_TouchTag *context);
+
+// Latch touch events signalled on INT_N since the last frame. Called while idling, does nothing when INT_N has not fired
+ESD_CORE_EXPORT void Esd_TouchTag_Poll();
+
+// Switch the capacitive touch controller between extended (multi-touch) and compatibility mode. Returns true when extended mode is active
+ESD_CORE_EXPORT bool Esd_TouchTag_SetMultiTouch(bool enable);
+
+// Set while the touch controller is in extended mode
+ESD_CORE_EXPORT bool Esd_TouchTag_MultiTouch();
+
+// Bit mask of the contacts currently touching, bit 0 is the primary contact also reported by Touch X and Touch Y
+ESD_FUNCTION(Esd_TouchTag_Contacts, Attributes = ESD_CORE_EXPORT, DisplayName = "Touch Contacts", Type = uint8_t, Category = EsdUtilities)
+ESD_CORE_EXPORT uint8_t Esd_TouchTag_Contacts();
+
+// Number of contacts currently touching
+ESD_FUNCTION(Esd_TouchTag_ContactCount, Attributes = ESD_CORE_EXPORT, DisplayName = "Touch Contact Count", Type = int, Category = EsdUtilities)
+ESD_CORE_EXPORT int Esd_TouchTag_ContactCount();
+
+// Last X position of a contact, stays the same after the contact has ended
+ESD_FUNCTION(Esd_TouchTag_ContactX, Attributes = ESD_CORE_EXPORT, DisplayName = "Touch Contact X", Type = int16_t, Category = EsdUtilities)
+ESD_PARAMETER(index, Type = int, Min = 0, Max = 4)
+ESD_CORE_EXPORT int16_t Esd_TouchTag_ContactX(int index);
+
+// Last Y position of a contact
+ESD_FUNCTION(Esd_TouchTag_ContactY, Attributes = ESD_CORE_EXPORT, DisplayName = "Touch Contact Y", Type = int16_t, Category = EsdUtilities)
+ESD_PARAMETER(index, Type = int, Min = 0, Max = 4)
+ESD_CORE_EXPORT int16_t Esd_TouchTag_ContactY(int index);
+
+// Tag under a contact, returns 0 when the contact is not touching
+ESD_FUNCTION(Esd_TouchTag_ContactTag, Attributes = ESD_CORE_EXPORT, DisplayName = "Touch Contact Tag", Type = uint8_t, Category = EsdUtilities)
+ESD_PARAMETER(index, Type = int, Min = 0, Max = 4)
+ESD_CORE_EXPORT uint8_t Esd_TouchTag_ContactTag(int index);
+
 // Suppress the current tag
 ESD_FUNCTION(Esd_TouchTag_SuppressCurrentTags, Attributes = ESD_CORE_EXPORT, DisplayName = "Suppress Current Tags", Category = EsdUtilities)
 ESD_CORE_EXPORT void Esd_TouchTag_SuppressCurrentTags();
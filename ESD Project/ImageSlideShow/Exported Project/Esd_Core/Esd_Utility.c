@@ -66,6 +66,11 @@ ESD_CORE_EXPORT bool Esd_Calibrate()
 	uint32_t result;
 	uint32_t transMatrix[6];
 
+#if ESD_TOUCHTAG_MULTITOUCH
+	// Calibration only works in compatibility mode
+	bool multiTouch = Esd_TouchTag_MultiTouch();
+	Esd_TouchTag_SetMultiTouch(false);
+#endif
 #if defined(EVE_SCREEN_CAPACITIVE)
 	EVE_Hal_wr8(phost, REG_CTOUCH_EXTENDED, CTOUCH_MODE_COMPATIBILITY);
 #endif
@@ -89,6 +94,11 @@ ESD_CORE_EXPORT bool Esd_Calibrate()
 	    (unsigned long)transMatrix[0], (unsigned long)transMatrix[1], (unsigned long)transMatrix[2],
 	    (unsigned long)transMatrix[3], (unsigned long)transMatrix[4], (unsigned long)transMatrix[5]);
 
+#if ESD_TOUCHTAG_MULTITOUCH
+	if (multiTouch)
+		Esd_TouchTag_SetMultiTouch(true);
+#endif
+
 	return result != 0;
 }
 
@@ -99,9 +109,55 @@ ESD_CORE_EXPORT void Esd_DeferredFree(void *ptr)
 	Esd_CurrentContext->DeferredFree = ptr;
 }
 
+ESD_CORE_EXPORT void Esd_DeferredGpuFree(Esd_GpuHandle handle)
+{
+	Esd_Context *ec = Esd_CurrentContext;
+	Esd_GpuReclaim *reclaim;
+
+	if (handle.Id >= MAX_NUM_ALLOCATIONS)
+		return;
+
+	if (ec->NbGpuReclaim == ESD_GPU_RECLAIM_MAX)
+	{
+		Esd_ProcessGpuFree();
+		if (ec->NbGpuReclaim == ESD_GPU_RECLAIM_MAX)
+		{
+			// Queue is full, fall back to garbage collection
+			Esd_GpuAlloc_Discard(Esd_GAlloc, handle);
+			return;
+		}
+	}
+
+	// The last display list sent may reference the allocation until the next one is swapped in,
+	// while rendering that is the display list being built
+	reclaim = &ec->GpuReclaim[ec->NbGpuReclaim++];
+	reclaim->Handle = handle;
+	reclaim->Fence = ec->Frame + ((ec->LoopState == ESD_LOOPSTATE_RENDER) ? 2 : 1);
+}
+
+ESD_CORE_EXPORT void Esd_ProcessGpuFree()
+{
+	Esd_Context *ec = Esd_CurrentContext;
+	uint32_t i = 0;
+
+	while (i < ec->NbGpuReclaim)
+	{
+		Esd_GpuReclaim *reclaim = &ec->GpuReclaim[i];
+		if ((int32_t)(ec->CompletedFrame - reclaim->Fence) >= 0)
+		{
+			// Stale handles, after a RAM_G reset, are ignored by Esd_GpuAlloc_Free
+			Esd_GpuAlloc_Free(Esd_GAlloc, reclaim->Handle);
+			*reclaim = ec->GpuReclaim[--ec->NbGpuReclaim];
+			continue;
+		}
+		++i;
+	}
+}
+
 ESD_CORE_EXPORT void Esd_ProcessFree()
 {
 	void *current = Esd_CurrentContext->DeferredFree;
+	Esd_ProcessGpuFree();
 	Esd_CurrentContext->DeferredFree = NULL;
 	while (current)
 	{
@@ -33,6 +33,7 @@
 #define ESD_UTILITY__H
 
 #include "Esd_Base.h"
+#include "Esd_GpuAlloc.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -46,9 +47,18 @@ ESD_CORE_EXPORT void Esd_EndLogo();
 
 ESD_CORE_EXPORT bool Esd_Calibrate();
 
+// Release host memory at the next frame start, once the current call stack no longer uses it
 ESD_CORE_EXPORT void Esd_DeferredFree(void *ptr);
+
+// Release a RAM_G allocation once the coprocessor has swapped in a frame which no longer references it
+ESD_CORE_EXPORT void Esd_DeferredGpuFree(Esd_GpuHandle handle);
+
+// Release the deferred memory which is safe to reuse, called at frame start
 ESD_CORE_EXPORT void Esd_ProcessFree();
 
+// Release the deferred RAM_G allocations whose fence has passed, called when a swap completes
+ESD_CORE_EXPORT void Esd_ProcessGpuFree();
+
 #ifdef __cplusplus
 }
 #endif
@@ -5,7 +5,7 @@ static Ft_Esd_WidgetSlots s_Ft_Esd_Layout_Fixed__Slots = {
 	(void (*)(void *))Ft_Esd_Widget_Start,
 	(void (*)(void *))Ft_Esd_Widget_Enable,
 	(void (*)(void *))Ft_Esd_Layout_Fixed_Update,
-	(void (*)(void *))Ft_Esd_Layout_Fixed_Render,
+	(void (*)(void *))Ft_Esd_Widget_Render, // Same as Ft_Esd_Layout_Fixed_Render, lets flat rendering inline the children
 	(void (*)(void *))Ft_Esd_Layout_Fixed_Idle,
 	(void (*)(void *))Ft_Esd_Widget_Disable,
 	(void (*)(void *))Ft_Esd_Widget_End,
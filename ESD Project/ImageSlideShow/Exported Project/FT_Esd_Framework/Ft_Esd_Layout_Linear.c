@@ -28,315 +28,316 @@ void Ft_Esd_Layout_Linear__Initializer(Ft_Esd_Layout_Linear *context)
 	context->ChildClipping = ESD_CLIP_RENDER;
 	context->AutoResize = FT_FALSE;
 	context->LastValues = context->Values;
+	context->LayoutHash = 0;
 }
 
-void Ft_Esd_Layout_Linear_Update(Ft_Esd_Layout_Linear *context)
+// Hash of everything the child placement depends on: the layout rect and settings, and the order, size and weight of the active children.
+// Also covers whether each child still has its rect, which is lost when a child is detached and inserted again
+static ft_uint32_t Ft_Esd_Layout_Linear_Hash(Ft_Esd_Layout_Linear *context)
 {
-	if (context->LastValues != context->Values)
+	ft_uint32_t hash = 2166136261UL; // FNV-1a
+	Ft_Esd_Widget *child;
+#define FT_ESD_LAYOUT_LINEAR_HASH(value) hash = (hash ^ (ft_uint32_t)(value)) * 16777619UL
+	FT_ESD_LAYOUT_LINEAR_HASH(context->Widget.GlobalX);
+	FT_ESD_LAYOUT_LINEAR_HASH(context->Widget.GlobalY);
+	FT_ESD_LAYOUT_LINEAR_HASH(context->Widget.GlobalWidth);
+	FT_ESD_LAYOUT_LINEAR_HASH(context->Widget.GlobalHeight);
+	FT_ESD_LAYOUT_LINEAR_HASH(context->Values);
+	FT_ESD_LAYOUT_LINEAR_HASH(context->Values >> 32);
+	FT_ESD_LAYOUT_LINEAR_HASH(context->AutoResize);
+	for (child = context->Widget.First; child; child = child->Next)
 	{
-		context->LastValues = context->Values;
-		context->Widget.Recalculate = FT_TRUE;
+		if (!child->Active)
+			continue;
+		FT_ESD_LAYOUT_LINEAR_HASH((uintptr_t)child);
+		FT_ESD_LAYOUT_LINEAR_HASH(child->GlobalValid);
+		if (child->ClassId == Ft_Esd_Layout_Stretch_CLASSID)
+		{
+			FT_ESD_LAYOUT_LINEAR_HASH(((Ft_Esd_Layout_Stretch *)child)->Weight);
+		}
+		else
+		{
+			FT_ESD_LAYOUT_LINEAR_HASH(child->LocalWidth);
+			FT_ESD_LAYOUT_LINEAR_HASH(child->LocalHeight);
+		}
 	}
-	bool recalculate = context->Widget.Recalculate;
-	if (recalculate)
-	{
-		// eve_printf_debug("Recalculate Linear\n");
-
-		context->Widget.Recalculate = 0;
+#undef FT_ESD_LAYOUT_LINEAR_HASH
+	return hash;
+}
 
-		const ft_int16_t margin = max(0, min(min(context->Margin, // Margin must be within the rectangle and positive
-		                                         context->Widget.GlobalWidth >> 1),
-		                                     context->Widget.GlobalHeight >> 1));
-		const ft_int16_t outerX = context->Widget.GlobalX + margin;
-		const ft_int16_t outerY = context->Widget.GlobalY + margin;
-		const ft_int16_t outerWidth = max(0, context->Widget.GlobalWidth - (margin << 1));
-		const ft_int16_t outerHeight = max(0, context->Widget.GlobalHeight - (margin << 1));
-		const ft_int16_t spacing = max(0, context->Spacing); // Spacing must be positive
+static void Ft_Esd_Layout_Linear_Recalculate(Ft_Esd_Layout_Linear *context)
+{
+	const ft_int16_t margin = max(0, min(min(context->Margin, // Margin must be within the rectangle and positive
+	                                         context->Widget.GlobalWidth >> 1),
+	                                     context->Widget.GlobalHeight >> 1));
+	const ft_int16_t outerX = context->Widget.GlobalX + margin;
+	const ft_int16_t outerY = context->Widget.GlobalY + margin;
+	const ft_int16_t outerWidth = max(0, context->Widget.GlobalWidth - (margin << 1));
+	const ft_int16_t outerHeight = max(0, context->Widget.GlobalHeight - (margin << 1));
+	const ft_int16_t spacing = max(0, context->Spacing); // Spacing must be positive
 
-		ft_uint8_t alignX = ESD_ALIGN_HORIZONTAL(context->Align);
-		ft_uint8_t alignY = ESD_ALIGN_VERTICAL(context->Align);
+	ft_uint8_t alignX = ESD_ALIGN_HORIZONTAL(context->Align);
+	ft_uint8_t alignY = ESD_ALIGN_VERTICAL(context->Align);
 
-		if (context->Orientation & ESD_ORIENTATION_HORIZONTAL)
-		{
-			Ft_Esd_Widget *child;
+	if (context->Orientation & ESD_ORIENTATION_HORIZONTAL)
+	{
+		Ft_Esd_Widget *child;
 
-			ft_int16_t childWidthTotal = 0;
-			ft_int16_t childCount = 0;
-			ft_int16_t stretchCount = 0;
+		ft_int16_t childWidthTotal = 0;
+		ft_int16_t childCount = 0;
+		ft_int16_t stretchCount = 0;
 
-			child = context->Widget.First;
-			while (child)
+		child = context->Widget.First;
+		while (child)
+		{
+			if (child->Active)
 			{
-				if (child->Active)
+				if (child->ClassId == Ft_Esd_Layout_Stretch_CLASSID)
 				{
-					if (child->ClassId == Ft_Esd_Layout_Stretch_CLASSID)
-					{
-						stretchCount += ((Ft_Esd_Layout_Stretch *)child)->Weight;
-					}
-					else
-					{
-						childWidthTotal += max(0, child->LocalWidth);
-						++childCount;
-					}
+					stretchCount += ((Ft_Esd_Layout_Stretch *)child)->Weight;
+				}
+				else
+				{
+					childWidthTotal += max(0, child->LocalWidth);
+					++childCount;
 				}
-				child = child->Next;
 			}
+			child = child->Next;
+		}
 
-			const ft_int32_t childWidthTotalInclSpacing = childWidthTotal + ((childCount - 1) * spacing);
-			ft_int32_t remainingStretchWidth = outerWidth - childWidthTotalInclSpacing;
-			ft_int32_t remainingStretchCount = stretchCount; // (remainingStretchWidth > 0) ? stretchCount : 0;
+		const ft_int32_t childWidthTotalInclSpacing = childWidthTotal + ((childCount - 1) * spacing);
+		ft_int32_t remainingStretchWidth = outerWidth - childWidthTotalInclSpacing;
+		ft_int32_t remainingStretchCount = stretchCount; // (remainingStretchWidth > 0) ? stretchCount : 0;
 
-			if (remainingStretchWidth > 0)
-			{
-				// When remaining width, and stretches detected, simply force basic align
-				if (stretchCount && alignX == ESD_ALIGN_FILLX)
-					alignX = ESD_ALIGN_LEFTX;
-			}
-			else if (remainingStretchWidth < 0)
-			{
-				// Only fill when overflowing and overflow is set to fill, otherwise force basic align
-				if (context->Overflow == ESD_OVERFLOW_FILL)
-					alignX = ESD_ALIGN_FILLX;
-				else if (alignX == ESD_ALIGN_FILLX)
-					alignX = ESD_ALIGN_LEFTX;
-			}
+		if (remainingStretchWidth > 0)
+		{
+			// When remaining width, and stretches detected, simply force basic align
+			if (stretchCount && alignX == ESD_ALIGN_FILLX)
+				alignX = ESD_ALIGN_LEFTX;
+		}
+		else if (remainingStretchWidth < 0)
+		{
+			// Only fill when overflowing and overflow is set to fill, otherwise force basic align
+			if (context->Overflow == ESD_OVERFLOW_FILL)
+				alignX = ESD_ALIGN_FILLX;
+			else if (alignX == ESD_ALIGN_FILLX)
+				alignX = ESD_ALIGN_LEFTX;
+		}
 
-			ft_int16_t currentX = outerX;
+		ft_int16_t currentX = outerX;
 
-			switch (alignX)
-			{
-			case ESD_ALIGN_CENTERX:
-				currentX += (remainingStretchWidth >> 1);
-				break;
-			case ESD_ALIGN_RIGHTX:
-				currentX += remainingStretchWidth;
-				break;
-			case ESD_ALIGN_FILLX:
-				// Proportional
-				stretchCount = 0;
-				remainingStretchWidth = outerWidth - ((childCount - 1) * spacing);
-				remainingStretchCount = childWidthTotal;
-				break;
-			}
+		switch (alignX)
+		{
+		case ESD_ALIGN_CENTERX:
+			currentX += (remainingStretchWidth >> 1);
+			break;
+		case ESD_ALIGN_RIGHTX:
+			currentX += remainingStretchWidth;
+			break;
+		case ESD_ALIGN_FILLX:
+			// Proportional
+			stretchCount = 0;
+			remainingStretchWidth = outerWidth - ((childCount - 1) * spacing);
+			remainingStretchCount = childWidthTotal;
+			break;
+		}
 
-			child = context->Widget.First;
-			while (child)
+		child = context->Widget.First;
+		while (child)
+		{
+			if (child->Active)
 			{
-				if (child->Active)
+				ft_int16_t childY, childHeight;
+				switch (alignY)
 				{
-					ft_int16_t childY, childHeight;
-					switch (alignY)
-					{
-					case ESD_ALIGN_TOPY:
-						childY = outerY;
-						childHeight = child->LocalHeight;
-						break;
-					case ESD_ALIGN_CENTERY:
-						childY = outerY + ((outerHeight - child->LocalHeight) >> 1);
-						childHeight = child->LocalHeight;
-						break;
-					case ESD_ALIGN_BOTTOMY:
-						childY = outerY + (outerHeight - child->LocalHeight);
-						childHeight = child->LocalHeight;
-						break;
-					case ESD_ALIGN_FILLY:
-						childY = outerY;
-						childHeight = outerHeight;
-						break;
-					}
-					if (context->Overflow == ESD_OVERFLOW_FILL && childHeight > outerHeight)
-					{
-						childHeight = outerHeight;
-					}
-					if (child->ClassId == Ft_Esd_Layout_Stretch_CLASSID)
-					{
-						if (stretchCount)
-						{
-							ft_int32_t weight = ((Ft_Esd_Layout_Stretch *)child)->Weight;
-							ft_int16_t stretchWidth = remainingStretchWidth * weight / remainingStretchCount;
-							remainingStretchWidth -= stretchWidth;
-							remainingStretchCount -= weight;
-							Ft_Esd_Widget_SetGlobalRect(child,
-							    currentX,
-							    childY,
-							    max(0, (stretchWidth - spacing)),
-							    childHeight);
-							currentX += stretchWidth;
-						}
-						else
-						{
-							Ft_Esd_Widget_SetGlobalRect(child,
-							    currentX,
-							    childY,
-							    0,
-							    childHeight);
-						}
-					}
-					else if (alignX == ESD_ALIGN_FILLX)
+				case ESD_ALIGN_TOPY:
+					childY = outerY;
+					childHeight = child->LocalHeight;
+					break;
+				case ESD_ALIGN_CENTERY:
+					childY = outerY + ((outerHeight - child->LocalHeight) >> 1);
+					childHeight = child->LocalHeight;
+					break;
+				case ESD_ALIGN_BOTTOMY:
+					childY = outerY + (outerHeight - child->LocalHeight);
+					childHeight = child->LocalHeight;
+					break;
+				case ESD_ALIGN_FILLY:
+					childY = outerY;
+					childHeight = outerHeight;
+					break;
+				}
+				if (context->Overflow == ESD_OVERFLOW_FILL && childHeight > outerHeight)
+				{
+					childHeight = outerHeight;
+				}
+				if (child->ClassId == Ft_Esd_Layout_Stretch_CLASSID)
+				{
+					if (stretchCount)
 					{
-						ft_int32_t weight = child->LocalWidth;
+						ft_int32_t weight = ((Ft_Esd_Layout_Stretch *)child)->Weight;
 						ft_int16_t stretchWidth = remainingStretchWidth * weight / remainingStretchCount;
 						remainingStretchWidth -= stretchWidth;
 						remainingStretchCount -= weight;
 						Ft_Esd_Widget_SetGlobalRect(child,
 						    currentX,
 						    childY,
-						    max(0, stretchWidth),
+						    max(0, (stretchWidth - spacing)),
 						    childHeight);
-						currentX += stretchWidth + spacing;
+						currentX += stretchWidth;
 					}
 					else
 					{
 						Ft_Esd_Widget_SetGlobalRect(child,
 						    currentX,
 						    childY,
-						    max(0, child->LocalWidth),
+						    0,
 						    childHeight);
-						currentX += child->GlobalWidth + spacing;
-					}
-					if (context->Overflow == ESD_OVERFLOW_CLIP)
-					{
-						child->GlobalValid &= Ft_Esd_Rect16_IsInsideHorizontal(child->GlobalRect, context->Widget.GlobalRect);
 					}
 				}
-				child = child->Next;
-			}
-
-			if ((context->AutoResize & ESD_AUTORESIZE_WIDTH)
-			    && (context->Overflow == ESD_OVERFLOW_ALLOW))
-			{
-				// Generally self resize is useful when part of scroll panel
-				Ft_Esd_Widget_SetWidth((Ft_Esd_Widget *)context, childWidthTotalInclSpacing + (context->Margin * 2));
+				else if (alignX == ESD_ALIGN_FILLX)
+				{
+					ft_int32_t weight = child->LocalWidth;
+					ft_int16_t stretchWidth = remainingStretchWidth * weight / remainingStretchCount;
+					remainingStretchWidth -= stretchWidth;
+					remainingStretchCount -= weight;
+					Ft_Esd_Widget_SetGlobalRect(child,
+					    currentX,
+					    childY,
+					    max(0, stretchWidth),
+					    childHeight);
+					currentX += stretchWidth + spacing;
+				}
+				else
+				{
+					Ft_Esd_Widget_SetGlobalRect(child,
+					    currentX,
+					    childY,
+					    max(0, child->LocalWidth),
+					    childHeight);
+					currentX += child->GlobalWidth + spacing;
+				}
+				if (context->Overflow == ESD_OVERFLOW_CLIP)
+				{
+					child->GlobalValid &= Ft_Esd_Rect16_IsInsideHorizontal(child->GlobalRect, context->Widget.GlobalRect);
+				}
 			}
+			child = child->Next;
 		}
-		else
+
+		if ((context->AutoResize & ESD_AUTORESIZE_WIDTH)
+		    && (context->Overflow == ESD_OVERFLOW_ALLOW))
 		{
-			Ft_Esd_Widget *child;
+			// Generally self resize is useful when part of scroll panel
+			Ft_Esd_Widget_SetWidth((Ft_Esd_Widget *)context, childWidthTotalInclSpacing + (context->Margin * 2));
+		}
+	}
+	else
+	{
+		Ft_Esd_Widget *child;
 
-			ft_int16_t childHeightTotal = 0;
-			ft_int16_t childCount = 0;
-			ft_int16_t stretchCount = 0;
+		ft_int16_t childHeightTotal = 0;
+		ft_int16_t childCount = 0;
+		ft_int16_t stretchCount = 0;
 
-			child = context->Widget.First;
-			while (child)
+		child = context->Widget.First;
+		while (child)
+		{
+			if (child->Active)
 			{
-				if (child->Active)
+				if (child->ClassId == Ft_Esd_Layout_Stretch_CLASSID)
 				{
-					if (child->ClassId == Ft_Esd_Layout_Stretch_CLASSID)
-					{
-						stretchCount += ((Ft_Esd_Layout_Stretch *)child)->Weight;
-					}
-					else
-					{
-						childHeightTotal += max(0, child->LocalHeight);
-						++childCount;
-					}
+					stretchCount += ((Ft_Esd_Layout_Stretch *)child)->Weight;
+				}
+				else
+				{
+					childHeightTotal += max(0, child->LocalHeight);
+					++childCount;
 				}
-				child = child->Next;
 			}
+			child = child->Next;
+		}
 
-			const ft_int32_t childHeightTotalInclSpacing = childHeightTotal + ((childCount - 1) * spacing);
-			ft_int32_t remainingStretchHeight = outerHeight - childHeightTotalInclSpacing;
-			ft_int32_t remainingStretchCount = stretchCount; // (remainingStretchHeight > 0) ? stretchCount : 0;
+		const ft_int32_t childHeightTotalInclSpacing = childHeightTotal + ((childCount - 1) * spacing);
+		ft_int32_t remainingStretchHeight = outerHeight - childHeightTotalInclSpacing;
+		ft_int32_t remainingStretchCount = stretchCount; // (remainingStretchHeight > 0) ? stretchCount : 0;
 
-			if (remainingStretchHeight > 0)
-			{
-				// When remaining width, and stretches detected, simply force basic align
-				if (stretchCount && alignY == ESD_ALIGN_FILLY)
-					alignY = ESD_ALIGN_TOPY;
-			}
-			else if (remainingStretchHeight < 0)
-			{
-				// Only fill when overflowing and overflow is set to fill, otherwise force basic align
-				if (context->Overflow == ESD_OVERFLOW_FILL)
-					alignY = ESD_ALIGN_FILLY;
-				else if (alignY == ESD_ALIGN_FILLY)
-					alignY = ESD_ALIGN_TOPY;
-			}
+		if (remainingStretchHeight > 0)
+		{
+			// When remaining width, and stretches detected, simply force basic align
+			if (stretchCount && alignY == ESD_ALIGN_FILLY)
+				alignY = ESD_ALIGN_TOPY;
+		}
+		else if (remainingStretchHeight < 0)
+		{
+			// Only fill when overflowing and overflow is set to fill, otherwise force basic align
+			if (context->Overflow == ESD_OVERFLOW_FILL)
+				alignY = ESD_ALIGN_FILLY;
+			else if (alignY == ESD_ALIGN_FILLY)
+				alignY = ESD_ALIGN_TOPY;
+		}
 
-			ft_int16_t currentY = outerY;
+		ft_int16_t currentY = outerY;
 
-			switch (alignY)
-			{
-			case ESD_ALIGN_CENTERY:
-				currentY += (remainingStretchHeight >> 1);
-				break;
-			case ESD_ALIGN_BOTTOMY:
-				currentY += remainingStretchHeight;
-				break;
-			case ESD_ALIGN_FILLY:
-				// Proportional
-				stretchCount = 0;
-				remainingStretchHeight = outerHeight - ((childCount - 1) * spacing);
-				remainingStretchCount = childHeightTotal;
-				break;
-			}
+		switch (alignY)
+		{
+		case ESD_ALIGN_CENTERY:
+			currentY += (remainingStretchHeight >> 1);
+			break;
+		case ESD_ALIGN_BOTTOMY:
+			currentY += remainingStretchHeight;
+			break;
+		case ESD_ALIGN_FILLY:
+			// Proportional
+			stretchCount = 0;
+			remainingStretchHeight = outerHeight - ((childCount - 1) * spacing);
+			remainingStretchCount = childHeightTotal;
+			break;
+		}
 
-			child = context->Widget.First;
-			while (child)
+		child = context->Widget.First;
+		while (child)
+		{
+			if (child->Active)
 			{
-				if (child->Active)
+				ft_int16_t childX, childWidth;
+				switch (alignX)
 				{
-					ft_int16_t childX, childWidth;
-					switch (alignX)
-					{
-					case ESD_ALIGN_LEFTX:
-						childX = outerX;
-						childWidth = child->LocalWidth;
-						break;
-					case ESD_ALIGN_CENTERX:
-						childX = outerX + ((outerWidth - child->LocalWidth) >> 1);
-						childWidth = child->LocalWidth;
-						break;
-					case ESD_ALIGN_RIGHTX:
-						childX = outerX + (outerWidth - child->LocalWidth);
-						childWidth = child->LocalWidth;
-						break;
-					case ESD_ALIGN_FILLX:
-						childX = outerX;
-						childWidth = outerWidth;
-						break;
-					}
-					if (context->Overflow == ESD_OVERFLOW_FILL && childWidth > outerWidth)
-					{
-						childWidth = outerWidth;
-					}
-					if (child->ClassId == Ft_Esd_Layout_Stretch_CLASSID)
-					{
-						if (stretchCount)
-						{
-							ft_int32_t weight = ((Ft_Esd_Layout_Stretch *)child)->Weight;
-							ft_int16_t stretchHeight = remainingStretchHeight * weight / remainingStretchCount;
-							remainingStretchHeight -= stretchHeight;
-							remainingStretchCount -= weight;
-							Ft_Esd_Widget_SetGlobalRect(child,
-							    outerX,
-							    currentY,
-							    outerWidth,
-							    max(0, (stretchHeight - spacing)));
-							currentY += stretchHeight;
-						}
-						else
-						{
-							Ft_Esd_Widget_SetGlobalRect(child,
-							    childX,
-							    currentY,
-							    childWidth,
-							    0);
-						}
-					}
-					else if (alignY == ESD_ALIGN_FILLY)
+				case ESD_ALIGN_LEFTX:
+					childX = outerX;
+					childWidth = child->LocalWidth;
+					break;
+				case ESD_ALIGN_CENTERX:
+					childX = outerX + ((outerWidth - child->LocalWidth) >> 1);
+					childWidth = child->LocalWidth;
+					break;
+				case ESD_ALIGN_RIGHTX:
+					childX = outerX + (outerWidth - child->LocalWidth);
+					childWidth = child->LocalWidth;
+					break;
+				case ESD_ALIGN_FILLX:
+					childX = outerX;
+					childWidth = outerWidth;
+					break;
+				}
+				if (context->Overflow == ESD_OVERFLOW_FILL && childWidth > outerWidth)
+				{
+					childWidth = outerWidth;
+				}
+				if (child->ClassId == Ft_Esd_Layout_Stretch_CLASSID)
+				{
+					if (stretchCount)
 					{
-						ft_int32_t weight = child->LocalHeight;
+						ft_int32_t weight = ((Ft_Esd_Layout_Stretch *)child)->Weight;
 						ft_int16_t stretchHeight = remainingStretchHeight * weight / remainingStretchCount;
 						remainingStretchHeight -= stretchHeight;
 						remainingStretchCount -= weight;
 						Ft_Esd_Widget_SetGlobalRect(child,
-						    childX,
+						    outerX,
 						    currentY,
-						    childWidth,
-						    max(0, stretchHeight));
-						currentY += stretchHeight + spacing;
+						    outerWidth,
+						    max(0, (stretchHeight - spacing)));
+						currentY += stretchHeight;
 					}
 					else
 					{
@@ -344,23 +345,68 @@ void Ft_Esd_Layout_Linear_Update(Ft_Esd_Layout_Linear *context)
 						    childX,
 						    currentY,
 						    childWidth,
-						    max(0, child->LocalHeight));
-						currentY += child->GlobalHeight + spacing;
-					}
-					if (context->Overflow == ESD_OVERFLOW_CLIP)
-					{
-						child->GlobalValid &= Ft_Esd_Rect16_IsInsideVertical(child->GlobalRect, context->Widget.GlobalRect);
+						    0);
 					}
 				}
-				child = child->Next;
+				else if (alignY == ESD_ALIGN_FILLY)
+				{
+					ft_int32_t weight = child->LocalHeight;
+					ft_int16_t stretchHeight = remainingStretchHeight * weight / remainingStretchCount;
+					remainingStretchHeight -= stretchHeight;
+					remainingStretchCount -= weight;
+					Ft_Esd_Widget_SetGlobalRect(child,
+					    childX,
+					    currentY,
+					    childWidth,
+					    max(0, stretchHeight));
+					currentY += stretchHeight + spacing;
+				}
+				else
+				{
+					Ft_Esd_Widget_SetGlobalRect(child,
+					    childX,
+					    currentY,
+					    childWidth,
+					    max(0, child->LocalHeight));
+					currentY += child->GlobalHeight + spacing;
+				}
+				if (context->Overflow == ESD_OVERFLOW_CLIP)
+				{
+					child->GlobalValid &= Ft_Esd_Rect16_IsInsideVertical(child->GlobalRect, context->Widget.GlobalRect);
+				}
 			}
+			child = child->Next;
+		}
 
-			if ((context->AutoResize & ESD_AUTORESIZE_HEIGHT)
-			    && (context->Overflow == ESD_OVERFLOW_ALLOW))
-			{
-				// Generally self resize is useful when part of scroll panel
-				Ft_Esd_Widget_SetHeight((Ft_Esd_Widget *)context, childHeightTotalInclSpacing + (context->Margin * 2));
-			}
+		if ((context->AutoResize & ESD_AUTORESIZE_HEIGHT)
+		    && (context->Overflow == ESD_OVERFLOW_ALLOW))
+		{
+			// Generally self resize is useful when part of scroll panel
+			Ft_Esd_Widget_SetHeight((Ft_Esd_Widget *)context, childHeightTotalInclSpacing + (context->Margin * 2));
+		}
+	}
+}
+
+void Ft_Esd_Layout_Linear_Update(Ft_Esd_Layout_Linear *context)
+{
+	if (context->LastValues != context->Values)
+	{
+		context->LastValues = context->Values;
+		context->Widget.Recalculate = FT_TRUE;
+	}
+	bool recalculate = context->Widget.Recalculate;
+	if (recalculate)
+	{
+		// eve_printf_debug("Recalculate Linear\n");
+
+		context->Widget.Recalculate = 0;
+
+		// Recalculate is also requested for changes which do not move any child, such as a child position
+		// or a new rect of the layout arriving unchanged from further up. Keep the previous child rects then
+		if (Ft_Esd_Layout_Linear_Hash(context) != context->LayoutHash)
+		{
+			Ft_Esd_Layout_Linear_Recalculate(context);
+			context->LayoutHash = Ft_Esd_Layout_Linear_Hash(context);
 		}
 	}
 	if (context->ChildClipping & ESD_CLIP_UPDATE)
@@ -379,7 +425,8 @@ void Ft_Esd_Layout_Linear_Render(Ft_Esd_Layout_Linear *context)
 {
 	if (context->ChildClipping & ESD_CLIP_RENDER)
 	{
-		Ft_Esd_Widget_IterateChildVisibleSlot((Ft_Esd_Widget *)context, FT_ESD_WIDGET_RENDER);
+		// Children are placed in order, long lists only cost the rows up to the end of the visible area
+		Ft_Esd_Widget_IterateChildVisibleSlotOrdered((Ft_Esd_Widget *)context, FT_ESD_WIDGET_RENDER, (context->Orientation & ESD_ORIENTATION_HORIZONTAL) != 0);
 	}
 	else
 	{
@@ -86,6 +86,9 @@ typedef struct
 
 	ft_int64_t LastValues;
 
+	// Hash of the inputs of the last child placement, see Ft_Esd_Layout_Linear_Update
+	ft_uint32_t LayoutHash;
+
 } Ft_Esd_Layout_Linear;
 
 void Ft_Esd_Layout_Linear__Initializer(Ft_Esd_Layout_Linear *context);
@@ -210,17 +210,16 @@ void Ft_Esd_Layout_Scroll_Update(Ft_Esd_Layout_Scroll *context)
 
 void Ft_Esd_Layout_Scroll_Render(Ft_Esd_Layout_Scroll *context)
 {
-	Ft_Esd_Rect16 scissor;
 	if (context->Scissor)
 	{
-		scissor = Ft_Esd_Dl_Scissor_Set(context->Widget.GlobalRect);
+		// Skip children scrolled outside of the visible area, or everything when the viewport is clipped away
+		if (Esd_Scissor_Push(context->Widget.GlobalRect))
+			Ft_Esd_Widget_IterateChildVisibleSlot((Ft_Esd_Widget *)context, FT_ESD_WIDGET_RENDER);
+		Esd_Scissor_Pop();
 	}
-
-	Ft_Esd_Widget_IterateChildActiveValidSlot((Ft_Esd_Widget *)context, FT_ESD_WIDGET_RENDER);
-
-	if (context->Scissor)
+	else
 	{
-		Ft_Esd_Dl_Scissor_Reset(scissor);
+		Ft_Esd_Widget_IterateChildVisibleSlot((Ft_Esd_Widget *)context, FT_ESD_WIDGET_RENDER);
 	}
 }
 
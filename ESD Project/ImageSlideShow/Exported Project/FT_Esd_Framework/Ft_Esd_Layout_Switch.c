@@ -1,7 +1,10 @@
 
 #include "Ft_Esd_Layout_Switch.h"
+#include "Esd_PerfGate.h"
+#include "Esd_Context.h"
 
 ESD_CORE_EXPORT void Esd_CoWidget_PopupSpinner();
+extern ESD_CORE_EXPORT Esd_GpuAlloc *Esd_GAlloc;
 
 
 static Ft_Esd_WidgetSlots s_Ft_Esd_Layout_Switch__Slots = {
@@ -25,8 +28,42 @@ void Ft_Esd_Layout_Switch__Initializer(Ft_Esd_Layout_Switch *context)
 	context->Spinner = FT_TRUE;
 	// context->Scissor = FT_FALSE;
 	context->AutoResize = FT_FALSE;
+	context->UnloadMs = 10000;
 	context->Current = 0;
 	context->Next = 0;
+	context->Preload = 0;
+	context->Preloaded = FT_FALSE;
+	context->CurrentArena = 0;
+	context->PreloadArena = 0;
+	context->PendingArena = 0;
+	context->LazyPages = 0;
+}
+
+static void Ft_Esd_Layout_Switch_Unload(Ft_Esd_Layout_Switch *context)
+{
+	Ft_Esd_LazyPage *lazy = context->LazyPages;
+	ft_uint32_t millis = Esd_GetMillis();
+	while (lazy)
+	{
+		Ft_Esd_Widget *page = *lazy->Page;
+		if (!page || page->Active || page == context->Next || !lazy->Destroy)
+		{
+			lazy->Hidden = FT_FALSE;
+		}
+		else if (!lazy->Hidden)
+		{
+			lazy->Hidden = FT_TRUE;
+			lazy->HiddenMillis = millis;
+		}
+		else if (millis - lazy->HiddenMillis >= context->UnloadMs)
+		{
+			// Ends and detaches the page, its widgets go back to the pool once the frame is done with them
+			eve_printf_debug("Unload hidden page %x\n", (unsigned int)page->ClassId);
+			lazy->Destroy(lazy->Owner);
+			lazy->Hidden = FT_FALSE;
+		}
+		lazy = lazy->NextLazy;
+	}
 }
 
 void Ft_Esd_Layout_Switch_Update(Ft_Esd_Layout_Switch *context)
@@ -41,7 +78,8 @@ void Ft_Esd_Layout_Switch_Update(Ft_Esd_Layout_Switch *context)
 		child = context->Widget.Last;
 		while (child)
 		{
-			if (child->Active)
+			// The preloaded page is active, but only becomes current through ShowPreload
+			if (child->Active && child != context->Preload)
 			{
 				if (child == next)
 				{
@@ -76,6 +114,15 @@ void Ft_Esd_Layout_Switch_Update(Ft_Esd_Layout_Switch *context)
 				    context->Widget.GlobalWidth,
 				    context->Widget.GlobalHeight);
 			}
+			else if (child == context->Preload)
+			{
+				// Laid out where it will be shown, so it requests the same bitmaps
+				Ft_Esd_Widget_SetGlobalRect(child,
+				    context->Widget.GlobalX,
+				    context->Widget.GlobalY,
+				    context->Widget.GlobalWidth,
+				    context->Widget.GlobalHeight);
+			}
 			else if (child == next)
 			{
 				child->GlobalValid = FT_FALSE;
@@ -87,6 +134,13 @@ void Ft_Esd_Layout_Switch_Update(Ft_Esd_Layout_Switch *context)
 			child = child->Previous;
 		}
 	}
+	if (current != context->Current)
+	{
+		// The page going away takes its bitmaps with it, in one block
+		Esd_GpuAlloc_FreeArena(Esd_GAlloc, context->CurrentArena);
+		context->CurrentArena = context->PendingArena ? context->PendingArena : Esd_GpuAlloc_NewArena(Esd_GAlloc);
+		context->PendingArena = 0;
+	}
 	context->Current = current;
 	Ft_Esd_Widget_IterateChildActiveSlotReverse((Ft_Esd_Widget *)context, FT_ESD_WIDGET_UPDATE);
 	if (current && context->AutoResize)
@@ -96,11 +150,103 @@ void Ft_Esd_Layout_Switch_Update(Ft_Esd_Layout_Switch *context)
 	}
 	if (recalculate)
 		Ft_Esd_Widget_CheckDefaultIdle(&context->Widget);
+	Ft_Esd_Layout_Switch_Unload(context);
 }
 
 void Ft_Esd_Layout_Switch_Render(Ft_Esd_Layout_Switch *context)
 {
+	Ft_Esd_Widget *preload = context->Preload;
+	ft_bool_t preloadValid = preload && preload->GlobalValid;
+	uint8_t arena = Esd_GpuAlloc_SetArena(Esd_GAlloc, context->CurrentArena);
+
+	if (context->Current)
+		Esd_PerfGate_SetPage(context->Current->ClassId);
+
+	// Kept out of the regular pass, it is rendered masked until its bitmaps are loaded
+	if (preload)
+		preload->GlobalValid = FT_FALSE;
 	Ft_Esd_Widget_IterateChildActiveValidSlotReverse((Ft_Esd_Widget *)context, FT_ESD_WIDGET_RENDER);
+	if (preload)
+		preload->GlobalValid = preloadValid;
+	if (preloadValid && !context->Preloaded)
+	{
+		Esd_GpuAlloc_SetArena(Esd_GAlloc, context->PreloadArena);
+		context->Preloaded = Ft_Esd_Widget_RenderPreload(preload);
+		if (context->Preloaded)
+			Ft_Esd_Widget_Damage(&context->Widget);
+	}
+	Esd_GpuAlloc_SetArena(Esd_GAlloc, arena);
+}
+
+void Ft_Esd_Layout_Switch_Preload(Ft_Esd_Layout_Switch *context, Ft_Esd_Widget *page)
+{
+	if (page == context->Current || page == context->Preload)
+		return;
+	if (context->Preload)
+		Ft_Esd_Widget_SetActive(context->Preload, FT_FALSE);
+	Esd_GpuAlloc_FreeArena(Esd_GAlloc, context->PreloadArena);
+	context->PreloadArena = page ? Esd_GpuAlloc_NewArena(Esd_GAlloc) : 0;
+	context->Preload = page;
+	context->Preloaded = FT_FALSE;
+	if (page)
+		Ft_Esd_Widget_SetActive(page, FT_TRUE);
+}
+
+ft_bool_t Ft_Esd_Layout_Switch_IsPreloaded(Ft_Esd_Layout_Switch *context)
+{
+	return context->Preload && context->Preloaded;
+}
+
+void Ft_Esd_Layout_Switch_ShowPreload(Ft_Esd_Layout_Switch *context)
+{
+	Ft_Esd_Widget *page = context->Preload;
+	if (!page)
+		return;
+
+	// Taken as the pending switch, the spinner is only shown when it is still loading
+	if (context->Preloaded)
+		context->Next = page;
+	context->PendingArena = context->PreloadArena;
+	context->PreloadArena = 0;
+	context->Preload = 0;
+	context->Preloaded = FT_FALSE;
+	context->Widget.Recalculate = FT_TRUE;
+}
+
+static Ft_Esd_Widget *Ft_Esd_Layout_Switch_Construct(Ft_Esd_Layout_Switch *context, Ft_Esd_LazyPage *lazy)
+{
+	if (!lazy->Registered)
+	{
+		lazy->NextLazy = context->LazyPages;
+		context->LazyPages = lazy;
+		lazy->Registered = FT_TRUE;
+	}
+	lazy->Hidden = FT_FALSE;
+
+	// Out of memory is reported by the validate function, the page then stays 0
+	if (!*lazy->Page)
+		lazy->Validate(lazy->Owner);
+	return *lazy->Page;
+}
+
+void Ft_Esd_Layout_Switch_ShowLazy(Ft_Esd_Layout_Switch *context, Ft_Esd_LazyPage *lazy)
+{
+	Ft_Esd_Widget *page = Ft_Esd_Layout_Switch_Construct(context, lazy);
+	if (!page)
+		return;
+	if (page == context->Preload)
+	{
+		Ft_Esd_Layout_Switch_ShowPreload(context);
+		return;
+	}
+	Ft_Esd_Widget_SetActive(page, FT_TRUE);
+}
+
+void Ft_Esd_Layout_Switch_PreloadLazy(Ft_Esd_Layout_Switch *context, Ft_Esd_LazyPage *lazy)
+{
+	Ft_Esd_Widget *page = Ft_Esd_Layout_Switch_Construct(context, lazy);
+	if (page)
+		Ft_Esd_Layout_Switch_Preload(context, page);
 }
 
 void Ft_Esd_Layout_Switch_Idle(Ft_Esd_Layout_Switch *context)
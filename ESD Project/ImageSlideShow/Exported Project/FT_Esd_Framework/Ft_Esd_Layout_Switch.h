@@ -34,6 +34,23 @@
 
 #include "Ft_Esd_Widget.h"
 
+// Page of a switch that is only constructed when it is first shown or preloaded.
+// Generated pages are held by a pointer in their owner, and allocated, initialized into the switch and
+// started by the generated __Validate function. Once a page has been hidden for UnloadMs, the switch
+// ends and frees its widgets with the generated __Destroy function, they are allocated again from the
+// memory pool when the page is shown the next time. A page without Destroy is left to its owner
+typedef struct Ft_Esd_LazyPage
+{
+	Ft_Esd_Widget **Page; // Pointer in the owner, 0 while the page does not exist
+	void (*Validate)(void *owner);
+	void (*Destroy)(void *owner);
+	void *Owner;
+	struct Ft_Esd_LazyPage *NextLazy; // Pages constructed by the same switch
+	ft_uint32_t HiddenMillis;
+	ft_bool_t Registered;
+	ft_bool_t Hidden;
+} Ft_Esd_LazyPage;
+
 #define Ft_Esd_Layout_Switch_CLASSID 0x66221688
 ESD_SYMBOL(Ft_Esd_Layout_Switch_CLASSID, Type = esd_classid_t)
 
@@ -59,8 +76,22 @@ typedef struct
 	ESD_VARIABLE(AutoResize, Type = ft_bool_t, Default = 0, Public)
 	ft_bool_t AutoResize;
 
+	// Milliseconds a lazy page stays hidden before its widgets are freed, so quickly returning to it does not construct it again
+	ESD_VARIABLE(UnloadMs, Type = ft_uint32_t, Default = 10000, Public)
+	ft_uint32_t UnloadMs;
+
 	Ft_Esd_Widget *Current;
 	Ft_Esd_Widget *Next;
+	Ft_Esd_Widget *Preload;
+	ft_bool_t Preloaded;
+
+	// RAM_G arenas of the collected allocations of the current and the preloaded page, freed when the page goes away.
+	// A shown preload hands its arena over to the page switch that is pending
+	ft_uint8_t CurrentArena;
+	ft_uint8_t PreloadArena;
+	ft_uint8_t PendingArena;
+
+	Ft_Esd_LazyPage *LazyPages;
 
 } Ft_Esd_Layout_Switch;
 
@@ -75,6 +106,34 @@ void Ft_Esd_Layout_Switch_Render(Ft_Esd_Layout_Switch *context);
 ESD_SLOT(Idle)
 void Ft_Esd_Layout_Switch_Idle(Ft_Esd_Layout_Switch *context);
 
+// Activate a child widget without showing it. Its bitmaps are loaded in the background while the current page stays on screen
+ESD_FUNCTION(Ft_Esd_Layout_Switch_Preload, DisplayName = "Preload Page", Category = EsdLayoutUtilities)
+ESD_PARAMETER(context, Type = Ft_Esd_Layout_Switch *)
+ESD_PARAMETER(page, Type = Ft_Esd_Widget *)
+void Ft_Esd_Layout_Switch_Preload(Ft_Esd_Layout_Switch *context, Ft_Esd_Widget *page);
+
+// Returns FT_TRUE once the preloaded page has nothing left to load
+ESD_FUNCTION(Ft_Esd_Layout_Switch_IsPreloaded, Type = ft_bool_t, DisplayName = "Is Page Preloaded", Category = EsdLayoutUtilities)
+ESD_PARAMETER(context, Type = Ft_Esd_Layout_Switch *)
+ft_bool_t Ft_Esd_Layout_Switch_IsPreloaded(Ft_Esd_Layout_Switch *context);
+
+// Switch to the preloaded page. When it has finished loading, it is shown right away without the spinner
+ESD_FUNCTION(Ft_Esd_Layout_Switch_ShowPreload, DisplayName = "Show Preloaded Page", Category = EsdLayoutUtilities)
+ESD_PARAMETER(context, Type = Ft_Esd_Layout_Switch *)
+void Ft_Esd_Layout_Switch_ShowPreload(Ft_Esd_Layout_Switch *context);
+
+// Switch to a lazy page, constructing it first when it does not exist yet
+ESD_FUNCTION(Ft_Esd_Layout_Switch_ShowLazy, DisplayName = "Show Lazy Page", Category = EsdLayoutUtilities)
+ESD_PARAMETER(context, Type = Ft_Esd_Layout_Switch *)
+ESD_PARAMETER(lazy, Type = Ft_Esd_LazyPage *)
+void Ft_Esd_Layout_Switch_ShowLazy(Ft_Esd_Layout_Switch *context, Ft_Esd_LazyPage *lazy);
+
+// Preload a lazy page, constructing it first when it does not exist yet
+ESD_FUNCTION(Ft_Esd_Layout_Switch_PreloadLazy, DisplayName = "Preload Lazy Page", Category = EsdLayoutUtilities)
+ESD_PARAMETER(context, Type = Ft_Esd_Layout_Switch *)
+ESD_PARAMETER(lazy, Type = Ft_Esd_LazyPage *)
+void Ft_Esd_Layout_Switch_PreloadLazy(Ft_Esd_Layout_Switch *context, Ft_Esd_LazyPage *lazy);
+
 #endif /* FT_ESD_LAYOUT_SWITCH_H */
 
 /* end of file */
@@ -64,21 +64,21 @@ ft_int16_t Ft_Esd_RenderForwarder_GlobalHeight(Ft_Esd_RenderForwarder *context)
 void Ft_Esd_RenderForwarder_Update(Ft_Esd_RenderForwarder *context)
 {
 	void *owner = context->Owner;
-	context->ForwardUpdate(owner);
+	ESD_SIGNAL_EMIT(context, ForwardUpdate, owner);
 	Ft_Esd_Widget_Update((Ft_Esd_Widget *)context); 
 }
 
 void Ft_Esd_RenderForwarder_Render(Ft_Esd_RenderForwarder *context)
 {
 	void *owner = context->Owner;
-	context->ForwardRender(owner);
+	ESD_SIGNAL_EMIT(context, ForwardRender, owner);
 	Ft_Esd_Widget_Render((Ft_Esd_Widget *)context); 
 }
 
 void Ft_Esd_RenderForwarder_Idle(Ft_Esd_RenderForwarder *context)
 {
 	void *owner = context->Owner;
-	context->ForwardIdle(owner);
+	ESD_SIGNAL_EMIT(context, ForwardIdle, owner);
 	Ft_Esd_Widget_Idle((Ft_Esd_Widget *)context); 
 }
 
@@ -6,6 +6,7 @@ void Ft_Esd_Timer_Process(Ft_Esd_Timer *context)
 {
 	while (context->RemainingMs <= 0L)
 	{
+		Esd_Invalidate();
 		context->Fired(context->Owner);
 		if (context->Repeat)
 		{
@@ -19,4 +20,24 @@ void Ft_Esd_Timer_Process(Ft_Esd_Timer *context)
 	}
 }
 
+#if ESD_TIMER_WHEEL
+
+#include <stddef.h>
+
+void Ft_Esd_Timer_Expired(Esd_TimerEntry *entry)
+{
+	Ft_Esd_Timer *context = (Ft_Esd_Timer *)((char *)entry - offsetof(Ft_Esd_Timer, Entry));
+	Esd_Invalidate();
+	context->RemainingMs = 0L;
+	context->Fired(context->Owner);
+	if (context->Repeat && context->TimeoutMs > 0 && !Esd_Timer_IsScheduled(entry))
+	{
+		// Due exactly now, so the period does not drift with the frame time
+		Esd_Timer_Schedule(entry, context->TimeoutMs);
+	}
+	context->RemainingMs = (int)Esd_Timer_Remaining(entry);
+}
+
+#endif
+
 /* end of file */
@@ -10,6 +10,7 @@ Header
 
 #include "Esd_Base.h"
 #include "Ft_Esd.h"
+#include "Esd_Timer.h"
 
 #ifndef ESD_LOGIC
 #define ESD_LOGIC(name, ...)
@@ -41,6 +42,10 @@ typedef struct
 	bool Repeat;
 	ESD_VARIABLE(RemainingMs, Type = int, ReadOnly)
 	int RemainingMs;
+#if ESD_TIMER_WHEEL
+	/* Scheduled on the global timer wheel while running */
+	Esd_TimerEntry Entry;
+#endif
 } Ft_Esd_Timer;
 
 void Ft_Esd_Timer__Initializer(Ft_Esd_Timer *context);
@@ -12,7 +12,9 @@ C Source
 
 ESD_CORE_EXPORT void Esd_Noop(void *context);
 
-
+#if ESD_TIMER_WHEEL
+void Ft_Esd_Timer_Expired(Esd_TimerEntry *entry);
+#endif
 
 void Ft_Esd_Timer__Initializer(Ft_Esd_Timer *context)
 {
@@ -21,6 +23,11 @@ void Ft_Esd_Timer__Initializer(Ft_Esd_Timer *context)
 	context->TimeoutMs = 1000L;
 	context->Repeat = 0;
 	context->RemainingMs = 0L;
+#if ESD_TIMER_WHEEL
+	context->Entry.Next = NULL;
+	context->Entry.Previous = NULL;
+	context->Entry.Expired = Ft_Esd_Timer_Expired;
+#endif
 }
 
 void Ft_Esd_Timer_Process(Ft_Esd_Timer *context);
@@ -30,6 +37,12 @@ void Ft_Esd_Timer_Run(Ft_Esd_Timer *context)
 	void *owner = context->Owner;
 	int start_or_restart_timer = context->TimeoutMs;
 	context->RemainingMs = start_or_restart_timer;
+#if ESD_TIMER_WHEEL
+	if (start_or_restart_timer > 0)
+		Esd_Timer_Schedule(&context->Entry, start_or_restart_timer);
+	else
+		Esd_Timer_Cancel(&context->Entry);
+#endif
 }
 
 void Ft_Esd_Timer_Halt(Ft_Esd_Timer *context)
@@ -37,11 +50,18 @@ void Ft_Esd_Timer_Halt(Ft_Esd_Timer *context)
 	void *owner = context->Owner;
 	int stop_timer = 0L;
 	context->RemainingMs = stop_timer;
+#if ESD_TIMER_WHEEL
+	Esd_Timer_Cancel(&context->Entry);
+#endif
 }
 
 void Ft_Esd_Timer_Update(Ft_Esd_Timer *context)
 {
 	void *owner = context->Owner;
+#if ESD_TIMER_WHEEL
+	// Fired from the timer wheel in Esd_Update, only report the remaining time here
+	context->RemainingMs = (int)Esd_Timer_Remaining(&context->Entry);
+#else
 	int left = context->RemainingMs;
 	int right = 0L;
 	int if_1 = left > right;
@@ -56,6 +76,7 @@ void Ft_Esd_Timer_Update(Ft_Esd_Timer *context)
 	else
 	{
 	}
+#endif
 }
 
 void Ft_Esd_Timer_End(Ft_Esd_Timer *context)
@@ -63,6 +84,9 @@ void Ft_Esd_Timer_End(Ft_Esd_Timer *context)
 	void *owner = context->Owner;
 	int stop_timer_1 = 0L;
 	context->RemainingMs = stop_timer_1;
+#if ESD_TIMER_WHEEL
+	Esd_Timer_Cancel(&context->Entry);
+#endif
 }
 
 
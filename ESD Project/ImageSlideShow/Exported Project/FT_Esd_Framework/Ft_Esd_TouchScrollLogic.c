@@ -1,18 +1,46 @@
 #include "Ft_Esd.h"
 #include "Ft_Esd_TouchScrollLogic.h"
+#include "Esd_TouchTag.h"
+#include <math.h>
 
 #define DAccFactor (0.92f)
-#define FactorNewValue (0.2f)
-#define FactorOldValue (0.8f)
+
+// Speeds are in pixels per reference frame of this many milliseconds, fling decays by DAccFactor per reference frame
+#define FrameMs (16.0)
+// Time constant of the velocity estimate, longer is smoother but reacts slower to changes in direction
+#define VelocityMs (24.0)
+// Longest time the touch position is extrapolated ahead, from the sample time to the expected swap
+#define PredictMaxMs (40)
 
 //-------------------------------------------------------------------------------------------------------------------------------------------------------------
 //-------------------------------------------------------------------------------------------------------------------------------------------------------------
 static void Compute2ndOrder(double *newValue, double *oldValue, double *d, double *oldD, double *acc);
+// Filter the movement since the previous touch sample into a speed, weighted by the time the sample covers so slow frames count for more
+static void EstimateSpeed(double *speed, double *acc, uint32_t sampleMs)
+{
+	if (sampleMs)
+	{
+		double weight = sampleMs / (sampleMs + VelocityMs);
+		double sampleSpeed = *acc * FrameMs / sampleMs;
+		*speed += (sampleSpeed - *speed) * weight;
+	}
+}
+
+// Advance a kinetic scroll by the time since the last frame, independent of the frame rate
+static void Fling(double *speed, double *d, uint32_t deltaMs)
+{
+	double frames = deltaMs / FrameMs;
+	*d += *speed * frames;
+	*speed *= pow(DAccFactor, frames);
+}
+
 static void SetRecord(double *current, double *previous);
 static void SetDifference(double *dif, double *valueNew, double *valueOld);
 static void LimitValue(double *value, const int min, const int max);
-static void HandleXTouchChange(Ft_Esd_TouchScrollLogic *context);
-static void HandleYTouchChange(Ft_Esd_TouchScrollLogic *context);
+static void HandleXTouchChange(Ft_Esd_TouchScrollLogic *context, uint32_t sampleMs, uint32_t predictMs);
+static void HandleYTouchChange(Ft_Esd_TouchScrollLogic *context, uint32_t sampleMs, uint32_t predictMs);
+static void EstimateSpeed(double *speed, double *acc, uint32_t sampleMs);
+static void Fling(double *speed, double *d, uint32_t deltaMs);
 //-------------------------------------------------------------------------------------------------------------------------------------------------------------
 
 ESD_METHOD(Ft_Esd_TouchScrollLogic_TouchUpdate_Then, Context = Ft_Esd_TouchScrollLogic)
@@ -21,11 +49,19 @@ ESD_METHOD(Ft_Esd_TouchScrollLogic_TouchUpdate_Then, Context = Ft_Esd_TouchScrol
 void Ft_Esd_TouchScrollLogic_TouchUpdate_Then(Ft_Esd_TouchScrollLogic *context)
 {
 	void *owner = context->Owner;
+	// Time between this touch sample and the previous one, 0 when the touch position has not been sampled again
+	uint32_t touchMillis = Esd_TouchTag_TouchMillis(0);
+	uint32_t sampleMs = touchMillis - context->touchMillis;
+	// Time from the touch sample until the frame being built is expected on screen, one frame after this one starts
+	uint32_t predictMs = (Esd_GetMillis() - touchMillis) + Esd_GetDeltaMs();
+	if (predictMs > PredictMaxMs)
+		predictMs = PredictMaxMs;
+	context->touchMillis = touchMillis;
 	// eve_printf_debug("Switch: X %d, Y %d\n",context->EnableXScroll(owner), context->EnableYScroll(owner));
 	if (context->EnableXScroll(owner))
-		HandleXTouchChange(context);
+		HandleXTouchChange(context, sampleMs, predictMs);
 	if (context->EnableYScroll(owner))
-		HandleYTouchChange(context);
+		HandleYTouchChange(context, sampleMs, predictMs);
 }
 
 ESD_METHOD(Ft_Esd_TouchScrollLogic_Check_X_acceleration_Then, Context = Ft_Esd_TouchScrollLogic)
@@ -36,10 +72,7 @@ void Ft_Esd_TouchScrollLogic_Check_X_acceleration_Then(Ft_Esd_TouchScrollLogic *
 	if (accRounded != 0)
 	{
 		SetRecord(&context->dX, &context->OldDx);
-		double newAcc = context->speedXAvg * DAccFactor;
-		double newDx = newAcc + context->dX;
-		context->speedXAvg = newAcc;
-		context->dX = newDx;
+		Fling(&context->speedXAvg, &context->dX, Esd_GetDeltaMs());
 		double newXRounded = (context->dX + context->lastOffsetX);
 		LimitValue(&newXRounded, context->MinX(owner), context->MaxX(owner));
 		ft_bool_t changed = context->offsetX != newXRounded;
@@ -47,6 +80,10 @@ void Ft_Esd_TouchScrollLogic_Check_X_acceleration_Then(Ft_Esd_TouchScrollLogic *
 		if (changed)
 			context->isTouchChanged |= 1;
 	}
+	else
+	{
+		context->speedXAvg = 0.0;
+	}
 }
 
 ESD_METHOD(Ft_Esd_TouchScrollLogic_Check_Y_acceleration_Then, Context = Ft_Esd_TouchScrollLogic)
@@ -57,10 +94,7 @@ void Ft_Esd_TouchScrollLogic_Check_Y_acceleration_Then(Ft_Esd_TouchScrollLogic *
 	if (accRounded != 0)
 	{
 		SetRecord(&context->dY, &context->OldDy);
-		double newAcc = context->speedYAvg * DAccFactor;
-		double newDy = newAcc + context->dY;
-		context->speedYAvg = newAcc;
-		context->dY = newDy;
+		Fling(&context->speedYAvg, &context->dY, Esd_GetDeltaMs());
 		double newYRounded = (context->dY + context->lastOffsetY);
 		LimitValue(&newYRounded, context->MinY(parent), context->MaxY(parent));
 		ft_bool_t changed = context->offsetY != newYRounded;
@@ -68,21 +102,26 @@ void Ft_Esd_TouchScrollLogic_Check_Y_acceleration_Then(Ft_Esd_TouchScrollLogic *
 		if (changed)
 			context->isTouchChanged |= 1;
 	}
+	else
+	{
+		context->speedYAvg = 0.0;
+	}
 }
 
-static void HandleXTouchChange(Ft_Esd_TouchScrollLogic *context)
+static void HandleXTouchChange(Ft_Esd_TouchScrollLogic *context, uint32_t sampleMs, uint32_t predictMs)
 {
 	void *parent = context->Owner;
 	// Handle X
 	double newX = Ft_Esd_TouchArea_TouchX(&context->Touch_Area);
 	// eve_printf_debug("(%f, %f, %f, %f, %f)\n", newX, context->lastX, context->dX, context->OldDx, context->aX);
 	Compute2ndOrder(&newX, &context->lastX, &(context->dX), &(context->OldDx), &(context->aX));
-	context->speedXAvg = context->aX * FactorNewValue + context->speedXAvg * FactorOldValue;
+	EstimateSpeed(&context->speedXAvg, &context->aX, sampleMs);
 	// eve_printf_debug("(%f, %f, %f, %f, %f)\n", newX, context->lastX, context->dX, context->OldDx, context->aX);
 	// eve_printf_debug("lastOffsetX : %f\n", context->lastOffsetX);
 	// eve_printf_debug("dX : %f\n", context->dX);
 
-	double newXRounded = (context->dX + context->lastOffsetX);
+	// Extrapolate to where the touch will be when this frame is displayed
+	double newXRounded = (context->dX + context->lastOffsetX) + (context->speedXAvg * predictMs / FrameMs);
 	// eve_printf_debug("raw Offset X : %f\n", newXRounded);
 	LimitValue(&newXRounded, context->MinX(parent), context->MaxX(parent));
 	// eve_printf_debug(" > %f, %d, %d\n", newXRounded, context->MinX(parent), context->MaxX(parent));
@@ -96,18 +135,18 @@ static void HandleXTouchChange(Ft_Esd_TouchScrollLogic *context)
 	}
 }
 
-static void HandleYTouchChange(Ft_Esd_TouchScrollLogic *context)
+static void HandleYTouchChange(Ft_Esd_TouchScrollLogic *context, uint32_t sampleMs, uint32_t predictMs)
 {
 	void *parent = context->Owner;
 	// Handle Y
 	double newY = Ft_Esd_TouchArea_TouchY(&context->Touch_Area);
 	// eve_printf_debug("(%f, %f, %f, %f, %f)\n", newY, context->lastY, context->dY, context->OldDx, context->aY);
 	Compute2ndOrder(&newY, &context->lastY, &(context->dY), &(context->OldDx), &(context->aY));
-	context->speedYAvg = context->aY * FactorNewValue + context->speedYAvg * FactorOldValue;
+	EstimateSpeed(&context->speedYAvg, &context->aY, sampleMs);
 	// eve_printf_debug("(%f, %f, %f, %f, %f)\n", newY, context->lastY, context->dY, context->OldDx, context->aY);
 	// eve_printf_debug("lastOffsetY : %f\n", context->lastOffsetY);
 	// eve_printf_debug("dY : %f\n", context->dY);
-	double newYRounded = (context->dY + context->lastOffsetY);
+	double newYRounded = (context->dY + context->lastOffsetY) + (context->speedYAvg * predictMs / FrameMs);
 	// eve_printf_debug("raw Offset Y : %f\n", newYRounded);
 
 	LimitValue(&newYRounded, context->MinY(parent), context->MaxY(parent));
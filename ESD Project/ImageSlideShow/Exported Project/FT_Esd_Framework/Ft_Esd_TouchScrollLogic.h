@@ -93,6 +93,8 @@ typedef struct
 	int(* DefaultY)(void *context);
 	ESD_INPUT(MaxY, DisplayName = "Y Max Value", Type = int)
 	int(* MaxY)(void *context);
+	ESD_VARIABLE(touchMillis, Type = uint32_t, Private)
+	uint32_t touchMillis;
 	Ft_Esd_TouchArea Touch_Area;
 } Ft_Esd_TouchScrollLogic;
 
@@ -78,6 +78,7 @@ void Ft_Esd_TouchScrollLogic__Initializer(Ft_Esd_TouchScrollLogic *context)
 	context->MinY = Ft_Esd_TouchScrollLogic_MinY__Default;
 	context->DefaultY = Ft_Esd_TouchScrollLogic_DefaultY__Default;
 	context->MaxY = Ft_Esd_TouchScrollLogic_MaxY__Default;
+	context->touchMillis = 0;
 	Ft_Esd_TouchScrollLogic__Touch_Area__Initializer(context);
 }
 
@@ -227,6 +228,10 @@ void Ft_Esd_TouchScrollLogic_Touch_Area_Down__Signal(void *c)
 		double resetdy = 0.0;
 		context->dY = resetdy;
 		context->OldDy = resetdy;
+		context->speedXAvg = resetdx;
+		context->speedYAvg = resetdy;
+		uint32_t set_touchmillis = Esd_TouchTag_TouchMillis(0);
+		context->touchMillis = set_touchmillis;
 	}
 	else
 	{
@@ -71,7 +71,7 @@ void Ft_Esd_TouchTagRenderInterface_Render(Ft_Esd_TouchTagRenderInterface *conte
 	void *owner = context->Owner;
 	ft_uint8_t s = Ft_Esd_TouchTag_Tag(&context->Touch_Tag);
 	Ft_Esd_Dl_TAG(s);
-	context->Rendering(owner);
+	ESD_SIGNAL_EMIT(context, Rendering, owner);
 	ft_uint8_t s_1 = 255;
 	Ft_Esd_Dl_TAG(s_1);
 	Ft_Esd_Widget_Render((Ft_Esd_Widget *)context);
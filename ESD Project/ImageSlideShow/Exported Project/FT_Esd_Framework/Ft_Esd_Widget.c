@@ -2,6 +2,8 @@
 
 #include "Ft_Esd_Widget.h"
 #include "Ft_Esd_Dl.h"
+#include "Esd_AsyncLoad.h"
+#include "Esd_Quality.h"
 
 static Ft_Esd_WidgetSlots s_Ft_Esd_Widget__Slots = {
 	(void (*)(void *))Ft_Esd_Widget_Initialize,
@@ -27,6 +29,549 @@ static Ft_Esd_WidgetSlots s_Ft_Esd_Widget__NoopSlots = {
 
 static Ft_Esd_Widget *s_Ft_Esd_Widget_FreeQueue = 0;
 
+// Number of widgets that can have their render output cached at the same time
+#ifndef FT_ESD_WIDGET_DLCACHE_COUNT
+#define FT_ESD_WIDGET_DLCACHE_COUNT 8
+#endif
+
+// Frames between recordings of a secondary widget while quality is reduced
+#ifndef FT_ESD_WIDGET_SECONDARY_FRAMES
+#define FT_ESD_WIDGET_SECONDARY_FRAMES 4
+#endif
+
+typedef struct
+{
+	Ft_Esd_Widget *Widget;
+	Esd_DlCache DlCache;
+	// Snapshot of the rendered widget in RAM_G, for widgets cached as bitmap
+	Esd_GpuHandle SnapshotHandle;
+	Ft_Esd_Rect16 SnapshotRect;
+	uint32_t SnapshotFrame;
+	uint8_t SnapshotState;
+	uint32_t RefreshFrame; // Frame in which a secondary widget was last recorded at reduced quality
+} Ft_Esd_WidgetDlCache;
+
+#define FT_ESD_WIDGET_SNAPSHOT_NONE 0
+#define FT_ESD_WIDGET_SNAPSHOT_PENDING 1 // Rendered in SnapshotFrame, captured once that frame is on screen
+#define FT_ESD_WIDGET_SNAPSHOT_READY 2
+
+static Ft_Esd_WidgetDlCache s_Ft_Esd_Widget_DlCache[FT_ESD_WIDGET_DLCACHE_COUNT];
+
+// Render widget subtrees from a flat pre-order array instead of recursing through the child lists.
+// Children of widgets which use Ft_Esd_Widget_Render as their Render slot are inlined in the array,
+// all other widgets are called through their slot as before, and start an array of their own when
+// they call Ft_Esd_Widget_Render. The arrays are rebuilt after a widget is inserted, detached or cached
+#ifndef FT_ESD_WIDGET_FLAT
+#define FT_ESD_WIDGET_FLAT 0
+#endif
+
+// Total number of entries in all flat arrays, and number of widgets rendering from a flat array
+#ifndef FT_ESD_WIDGET_FLAT_NODES
+#define FT_ESD_WIDGET_FLAT_NODES 256
+#endif
+#ifndef FT_ESD_WIDGET_FLAT_ROOTS
+#define FT_ESD_WIDGET_FLAT_ROOTS 16
+#endif
+
+#if FT_ESD_WIDGET_FLAT
+typedef struct
+{
+	Ft_Esd_Widget *Widget;
+	uint16_t Skip; // Number of following entries belonging to the subtree of this widget
+	bool Expand; // Render by visiting the children that follow, rather than calling the slot
+} Ft_Esd_WidgetFlatNode;
+
+typedef struct
+{
+	Ft_Esd_Widget *Widget;
+	uint16_t First;
+	uint16_t Count;
+	bool Failed; // Out of entries, render recursively
+} Ft_Esd_WidgetFlatRoot;
+
+static Ft_Esd_WidgetFlatNode s_Ft_Esd_Widget_FlatNodes[FT_ESD_WIDGET_FLAT_NODES];
+static Ft_Esd_WidgetFlatRoot s_Ft_Esd_Widget_FlatRoots[FT_ESD_WIDGET_FLAT_ROOTS];
+static uint16_t s_Ft_Esd_Widget_FlatNodeCount = 0;
+static uint16_t s_Ft_Esd_Widget_FlatRootCount = 0;
+static uint32_t s_Ft_Esd_Widget_FlatVersion = 0;
+static uint32_t s_Ft_Esd_Widget_FlatDepth = 0;
+#endif
+
+// Number of unordered widgets, and number of children each of them sorts.
+// Widgets with more children are rendered in tree order
+#ifndef FT_ESD_WIDGET_UNORDERED_COUNT
+#define FT_ESD_WIDGET_UNORDERED_COUNT 2
+#endif
+#ifndef FT_ESD_WIDGET_UNORDERED_CHILDREN
+#define FT_ESD_WIDGET_UNORDERED_CHILDREN 32
+#endif
+
+typedef struct
+{
+	Ft_Esd_Widget *Widget;
+	uint32_t Version; // Tree version the children were collected at
+	uint16_t Count;
+	bool Failed; // Too many children
+	Ft_Esd_Widget *Children[FT_ESD_WIDGET_UNORDERED_CHILDREN]; // In render order
+	uint32_t Keys[FT_ESD_WIDGET_UNORDERED_CHILDREN]; // Display list state after the child rendered
+} Ft_Esd_WidgetUnordered;
+
+static Ft_Esd_WidgetUnordered s_Ft_Esd_Widget_Unordered[FT_ESD_WIDGET_UNORDERED_COUNT];
+
+// Incremented on every change of the widget tree structure
+static uint32_t s_Ft_Esd_Widget_TreeVersion = 0;
+
+static Ft_Esd_WidgetDlCache *Ft_Esd_Widget_FindDlCache(Ft_Esd_Widget *context)
+{
+	int i;
+	for (i = 0; i < FT_ESD_WIDGET_DLCACHE_COUNT; ++i)
+	{
+		if (s_Ft_Esd_Widget_DlCache[i].Widget == context)
+			return &s_Ft_Esd_Widget_DlCache[i];
+	}
+	return 0;
+}
+
+static void Ft_Esd_Widget_DropSnapshot(Ft_Esd_WidgetDlCache *entry)
+{
+	Esd_DeferredGpuFree(entry->SnapshotHandle); // May still be on screen
+	entry->SnapshotHandle = GA_HANDLE_INVALID;
+	entry->SnapshotState = FT_ESD_WIDGET_SNAPSHOT_NONE;
+}
+
+// Draw the snapshot of a widget cached as bitmap, or render it and capture it on the next frame.
+// The capture reads back the displayed frame, so it includes whatever was drawn behind and over the widget
+static void Ft_Esd_Widget_RenderSnapshot(Ft_Esd_Widget *context, Ft_Esd_WidgetDlCache *entry)
+{
+	EVE_HalContext *phost = Esd_GetHost();
+	uint32_t frame = Esd_CurrentContext->Frame;
+	uint32_t addr;
+
+	if (memcmp(&entry->SnapshotRect, &context->GlobalRect, sizeof(Ft_Esd_Rect16)))
+		Ft_Esd_Widget_DropSnapshot(entry);
+
+	if (entry->SnapshotState == FT_ESD_WIDGET_SNAPSHOT_PENDING && frame != entry->SnapshotFrame)
+	{
+		// The previous frame showed the rendered widget, read it back before this frame is swapped in
+		entry->SnapshotHandle = Esd_GpuAlloc_Alloc(Esd_GAlloc, (uint32_t)context->GlobalWidth * context->GlobalHeight * 2, GA_GC_FLAG);
+		addr = Esd_GpuAlloc_Get(Esd_GAlloc, entry->SnapshotHandle);
+		if (addr != GA_INVALID)
+		{
+			EVE_CoCmd_snapshot2(phost, RGB565, addr, context->GlobalX, context->GlobalY, context->GlobalWidth, context->GlobalHeight);
+			entry->SnapshotState = FT_ESD_WIDGET_SNAPSHOT_READY;
+		}
+		else
+		{
+			entry->SnapshotState = FT_ESD_WIDGET_SNAPSHOT_NONE;
+		}
+	}
+
+	if (entry->SnapshotState == FT_ESD_WIDGET_SNAPSHOT_READY)
+	{
+		addr = Esd_GpuAlloc_Get(Esd_GAlloc, entry->SnapshotHandle);
+		if (addr != GA_INVALID)
+		{
+			EVE_CoDl_saveContext(phost);
+			EVE_CoDl_bitmapHandle(phost, ESD_CO_SCRATCH_HANDLE);
+			EVE_CoCmd_setBitmap(phost, addr, RGB565, context->GlobalWidth, context->GlobalHeight);
+			EVE_CoDl_colorArgb_ex(phost, 0xFFFFFFFF);
+			EVE_CoDl_begin(phost, BITMAPS);
+			EVE_CoDl_vertexFormat(phost, 0);
+			EVE_CoDl_vertex2f(phost, context->GlobalX, context->GlobalY);
+			EVE_CoDl_end(phost);
+			EVE_CoDl_restoreContext(phost);
+			return;
+		}
+		entry->SnapshotState = FT_ESD_WIDGET_SNAPSHOT_NONE;
+	}
+
+	context->Slots->Render(context);
+
+	// Only capture what is entirely on screen, a clipped widget is rendered as is
+	if (entry->SnapshotState == FT_ESD_WIDGET_SNAPSHOT_NONE
+	    && context->GlobalWidth > 0 && context->GlobalHeight > 0
+	    && Ft_Esd_Rect16_IsInside(context->GlobalRect, Ft_Esd_ScissorRect))
+	{
+		entry->SnapshotRect = context->GlobalRect;
+		entry->SnapshotFrame = frame;
+		entry->SnapshotState = FT_ESD_WIDGET_SNAPSHOT_PENDING;
+	}
+}
+
+// Replay the recorded render output of a cached widget, or record it again when damaged
+static void Ft_Esd_Widget_RenderCached(Ft_Esd_Widget *context)
+{
+	Ft_Esd_WidgetDlCache *entry = Ft_Esd_Widget_FindDlCache(context);
+	if (!entry)
+	{
+		context->Slots->Render(context);
+		return;
+	}
+	bool hold = FT_FALSE;
+	if (context->Secondary)
+	{
+		uint32_t frame = Esd_CurrentContext->Frame;
+		if (!Esd_Quality_Reduced())
+		{
+			if (!context->Cached)
+			{
+				// Only replayed while quality is reduced, the recording would be stale by then
+				Esd_DlCache_Invalidate(&entry->DlCache);
+				context->Slots->Render(context);
+				return;
+			}
+		}
+		else if ((frame - entry->RefreshFrame) < FT_ESD_WIDGET_SECONDARY_FRAMES)
+		{
+			hold = FT_TRUE; // Replay, damage is picked up on the next refresh
+		}
+		else
+		{
+			if (!context->Cached)
+				context->Damaged = FT_TRUE; // Nothing tracks damage inside a widget which is not cached
+			if (context->Damaged)
+				entry->RefreshFrame = frame;
+		}
+	}
+	if (context->Damaged && !hold)
+	{
+		Esd_DlCache_Invalidate(&entry->DlCache);
+		Ft_Esd_Widget_DropSnapshot(entry);
+		context->Damaged = FT_FALSE;
+	}
+	if (context->Snapshot)
+	{
+		Ft_Esd_Widget_RenderSnapshot(context, entry);
+		return;
+	}
+	if (Esd_DlCache_Begin(&entry->DlCache))
+	{
+		context->Slots->Render(context);
+		Esd_DlCache_End(&entry->DlCache);
+	}
+}
+
+#if FT_ESD_WIDGET_PROFILE
+void (*Ft_Esd_WidgetProfileSink)(const uint8_t *data, uint32_t size) = 0;
+
+static struct
+{
+	Ft_Esd_WidgetProfileSummary Summary;
+	Ft_Esd_WidgetProfileRecord Records[FT_ESD_WIDGET_PROFILE_COUNT];
+} s_Ft_Esd_WidgetProfile;
+static uint32_t s_Ft_Esd_WidgetProfile_LastFrame = 0;
+static uint32_t s_Ft_Esd_WidgetProfile_NestedMicros = 0; // Time spent in the children of the widget being rendered
+static uint32_t s_Ft_Esd_WidgetProfile_NestedWords = 0;
+
+static uint32_t Ft_Esd_WidgetProfile_Micros()
+{
+#if defined(FT9XX_PLATFORM)
+	return EVE_micros();
+#else
+	return EVE_millis() * 1000;
+#endif
+}
+
+static uint32_t Ft_Esd_WidgetProfile_Words()
+{
+#if EVE_HAL_STATS
+	return Esd_GetHost()->Stats.CmdWords;
+#else
+	return 0;
+#endif
+}
+
+// Emit the window once enough frames have passed, called before the first widget of each frame is measured
+static void Ft_Esd_WidgetProfile_Frame()
+{
+	uint32_t frame = Esd_CurrentContext->Frame;
+	if (frame == s_Ft_Esd_WidgetProfile_LastFrame && s_Ft_Esd_WidgetProfile.Summary.Magic)
+		return;
+	s_Ft_Esd_WidgetProfile_LastFrame = frame;
+	if (s_Ft_Esd_WidgetProfile.Summary.Magic)
+	{
+		if (++s_Ft_Esd_WidgetProfile.Summary.Frames < FT_ESD_WIDGET_PROFILE_FRAMES)
+			return;
+		s_Ft_Esd_WidgetProfile.Summary.Frame = frame;
+		Ft_Esd_WidgetProfileSink((const uint8_t *)&s_Ft_Esd_WidgetProfile,
+		    sizeof(Ft_Esd_WidgetProfileSummary) + s_Ft_Esd_WidgetProfile.Summary.Count * sizeof(Ft_Esd_WidgetProfileRecord));
+	}
+	memset(&s_Ft_Esd_WidgetProfile.Summary, 0, sizeof(Ft_Esd_WidgetProfileSummary));
+	s_Ft_Esd_WidgetProfile.Summary.Magic = FT_ESD_WIDGET_PROFILE_MAGIC;
+}
+
+static Ft_Esd_WidgetProfileRecord *Ft_Esd_WidgetProfile_Find(Ft_Esd_Widget *context)
+{
+	uint32_t instance = (uint32_t)(uintptr_t)context;
+	Ft_Esd_WidgetProfileRecord *record;
+	int i;
+	for (i = 0; i < s_Ft_Esd_WidgetProfile.Summary.Count; ++i)
+	{
+		record = &s_Ft_Esd_WidgetProfile.Records[i];
+		if (record->Instance == instance && record->ClassId == context->ClassId)
+			return record;
+	}
+	if (s_Ft_Esd_WidgetProfile.Summary.Count >= FT_ESD_WIDGET_PROFILE_COUNT)
+		return 0;
+	record = &s_Ft_Esd_WidgetProfile.Records[s_Ft_Esd_WidgetProfile.Summary.Count++];
+	record->ClassId = context->ClassId;
+	record->Instance = instance;
+	record->Calls = 0;
+	record->Micros = 0;
+	record->CmdWords = 0;
+	return record;
+}
+
+// Render a widget, and add its own cost to its record
+static void Ft_Esd_Widget_RenderProfiled(Ft_Esd_Widget *context)
+{
+	uint32_t outerMicros = s_Ft_Esd_WidgetProfile_NestedMicros;
+	uint32_t outerWords = s_Ft_Esd_WidgetProfile_NestedWords;
+	uint32_t micros, words;
+	Ft_Esd_WidgetProfileRecord *record;
+
+	Ft_Esd_WidgetProfile_Frame();
+	s_Ft_Esd_WidgetProfile_NestedMicros = 0;
+	s_Ft_Esd_WidgetProfile_NestedWords = 0;
+	micros = Ft_Esd_WidgetProfile_Micros();
+	words = Ft_Esd_WidgetProfile_Words();
+
+	if (context->Cached || context->Secondary)
+		Ft_Esd_Widget_RenderCached(context);
+	else
+		context->Slots->Render(context);
+
+	micros = Ft_Esd_WidgetProfile_Micros() - micros;
+	words = Ft_Esd_WidgetProfile_Words() - words;
+	record = Ft_Esd_WidgetProfile_Find(context);
+	if (record)
+	{
+		++record->Calls;
+		record->Micros += micros - s_Ft_Esd_WidgetProfile_NestedMicros;
+		record->CmdWords += words - s_Ft_Esd_WidgetProfile_NestedWords;
+	}
+	else
+	{
+		++s_Ft_Esd_WidgetProfile.Summary.Dropped;
+	}
+	s_Ft_Esd_WidgetProfile_NestedMicros = outerMicros + micros;
+	s_Ft_Esd_WidgetProfile_NestedWords = outerWords + words;
+}
+#endif
+
+// Call a slot on a child widget, rendering goes through the cache for cached widgets
+static inline void Ft_Esd_Widget_CallSlot(Ft_Esd_Widget *child, int slot)
+{
+	if (slot == FT_ESD_WIDGET_RENDER && child->Background)
+		return; // Drawn by the background layer
+#if FT_ESD_WIDGET_PROFILE
+	if (slot == FT_ESD_WIDGET_RENDER && Ft_Esd_WidgetProfileSink)
+		Ft_Esd_Widget_RenderProfiled(child);
+	else
+#endif
+	if (slot == FT_ESD_WIDGET_RENDER && (child->Cached || child->Secondary))
+		Ft_Esd_Widget_RenderCached(child);
+	else
+		child->Slots->Table[slot](child);
+}
+
+#if FT_ESD_WIDGET_FLAT
+// Appends the children of a widget in the order Ft_Esd_Widget_Render visits them
+static bool Ft_Esd_Widget_FlatAppend(Ft_Esd_Widget *context)
+{
+	Ft_Esd_Widget *child;
+	for (child = context->Last; child; child = child->Previous)
+	{
+		uint16_t index = s_Ft_Esd_Widget_FlatNodeCount;
+		Ft_Esd_WidgetFlatNode *node;
+		if (index >= FT_ESD_WIDGET_FLAT_NODES)
+			return false;
+		node = &s_Ft_Esd_Widget_FlatNodes[index];
+		++s_Ft_Esd_Widget_FlatNodeCount;
+		node->Widget = child;
+		node->Expand = (child->Slots->Render == (void (*)(void *))Ft_Esd_Widget_Render) && !child->Cached && !child->Secondary && !child->Background && !child->Unordered;
+		if (node->Expand && !Ft_Esd_Widget_FlatAppend(child))
+			return false;
+		node->Skip = s_Ft_Esd_Widget_FlatNodeCount - index - 1;
+	}
+	return true;
+}
+
+static Ft_Esd_WidgetFlatRoot *Ft_Esd_Widget_FlatFind(Ft_Esd_Widget *context)
+{
+	Ft_Esd_WidgetFlatRoot *root;
+	uint16_t i;
+
+	if (s_Ft_Esd_Widget_FlatVersion != s_Ft_Esd_Widget_TreeVersion)
+	{
+		if (s_Ft_Esd_Widget_FlatDepth)
+			return 0; // Changed while rendering from an array, which must stay in place
+		s_Ft_Esd_Widget_FlatVersion = s_Ft_Esd_Widget_TreeVersion;
+		s_Ft_Esd_Widget_FlatNodeCount = 0;
+		s_Ft_Esd_Widget_FlatRootCount = 0;
+	}
+
+	for (i = 0; i < s_Ft_Esd_Widget_FlatRootCount; ++i)
+	{
+		if (s_Ft_Esd_Widget_FlatRoots[i].Widget == context)
+			return s_Ft_Esd_Widget_FlatRoots[i].Failed ? 0 : &s_Ft_Esd_Widget_FlatRoots[i];
+	}
+	if (s_Ft_Esd_Widget_FlatRootCount >= FT_ESD_WIDGET_FLAT_ROOTS)
+		return 0;
+
+	root = &s_Ft_Esd_Widget_FlatRoots[s_Ft_Esd_Widget_FlatRootCount++];
+	root->Widget = context;
+	root->First = s_Ft_Esd_Widget_FlatNodeCount;
+	root->Failed = !Ft_Esd_Widget_FlatAppend(context);
+	if (root->Failed)
+	{
+		eve_printf_debug("Flat widget array full, increase FT_ESD_WIDGET_FLAT_NODES\n");
+		s_Ft_Esd_Widget_FlatNodeCount = root->First;
+		return 0;
+	}
+	root->Count = s_Ft_Esd_Widget_FlatNodeCount - root->First;
+	return root;
+}
+
+// Render the children of a widget from its flat array, returns false when it must be done recursively
+static bool Ft_Esd_Widget_RenderFlat(Ft_Esd_Widget *context)
+{
+	Ft_Esd_WidgetFlatRoot *root;
+	const Ft_Esd_WidgetFlatNode *node;
+	const Ft_Esd_WidgetFlatNode *end;
+
+#if FT_ESD_WIDGET_PROFILE
+	if (Ft_Esd_WidgetProfileSink)
+		return false; // Every widget is measured through its own slot
+#endif
+	root = Ft_Esd_Widget_FlatFind(context);
+	if (!root)
+		return false;
+
+	++s_Ft_Esd_Widget_FlatDepth;
+	node = &s_Ft_Esd_Widget_FlatNodes[root->First];
+	end = node + root->Count;
+	while (node < end)
+	{
+		Ft_Esd_Widget *const widget = node->Widget;
+		if (!(widget->Active && widget->GlobalValid))
+		{
+			node += node->Skip + 1; // Skip the whole subtree
+		}
+		else if (node->Expand)
+		{
+			++node; // Continue with the children
+		}
+		else
+		{
+			Ft_Esd_Widget_CallSlot(widget, FT_ESD_WIDGET_RENDER);
+			++node;
+		}
+	}
+	--s_Ft_Esd_Widget_FlatDepth;
+	return true;
+}
+#endif
+
+static Ft_Esd_WidgetUnordered *Ft_Esd_Widget_FindUnordered(Ft_Esd_Widget *context)
+{
+	int i;
+	for (i = 0; i < FT_ESD_WIDGET_UNORDERED_COUNT; ++i)
+	{
+		if (s_Ft_Esd_Widget_Unordered[i].Widget == context)
+			return &s_Ft_Esd_Widget_Unordered[i];
+	}
+	return 0;
+}
+
+// Primitive, bitmap handle and color the display list is left in, in order of priority
+static uint32_t Ft_Esd_Widget_StateKey()
+{
+#if EVE_DL_OPTIMIZE
+	EVE_HalContext *phost = Esd_GetHost();
+	return ((uint32_t)(phost->DlPrimitive & 0xF) << 28) | ((uint32_t)(EVE_DL_STATE.Handle & 0x1F) << 23) | ((EVE_DL_STATE.ColorRGB >> 1) & 0x7FFFFF);
+#else
+	return 0;
+#endif
+}
+
+// Collect the children in tree render order, the sorting of the previous frames starts over
+static void Ft_Esd_Widget_CollectUnordered(Ft_Esd_Widget *context, Ft_Esd_WidgetUnordered *entry)
+{
+	Ft_Esd_Widget *child;
+	entry->Version = s_Ft_Esd_Widget_TreeVersion;
+	entry->Count = 0;
+	entry->Failed = false;
+	for (child = context->Last; child; child = child->Previous)
+	{
+		if (entry->Count >= FT_ESD_WIDGET_UNORDERED_CHILDREN)
+		{
+			eve_printf_debug("Too many children to sort, increase FT_ESD_WIDGET_UNORDERED_CHILDREN\n");
+			entry->Failed = true;
+			return;
+		}
+		entry->Children[entry->Count] = child;
+		entry->Keys[entry->Count] = 0;
+		++entry->Count;
+	}
+}
+
+// Stable, so children with the same state keep their tree order between frames
+static void Ft_Esd_Widget_SortUnordered(Ft_Esd_WidgetUnordered *entry)
+{
+	uint16_t i;
+	for (i = 1; i < entry->Count; ++i)
+	{
+		Ft_Esd_Widget *child = entry->Children[i];
+		uint32_t key = entry->Keys[i];
+		uint16_t j = i;
+		while (j > 0 && (entry->Keys[j - 1] > key || (entry->Keys[j - 1] == key && entry->Children[j - 1]->ClassId > child->ClassId)))
+		{
+			entry->Children[j] = entry->Children[j - 1];
+			entry->Keys[j] = entry->Keys[j - 1];
+			--j;
+		}
+		entry->Children[j] = child;
+		entry->Keys[j] = key;
+	}
+}
+
+// Render the children sorted by the state they left on the previous frame, returns false when it must be done in tree order
+static bool Ft_Esd_Widget_RenderUnordered(Ft_Esd_Widget *context)
+{
+	Ft_Esd_WidgetUnordered *entry = Ft_Esd_Widget_FindUnordered(context);
+	bool changed = false;
+	uint16_t i;
+
+	if (!entry)
+		return false;
+	if (entry->Version != s_Ft_Esd_Widget_TreeVersion)
+		Ft_Esd_Widget_CollectUnordered(context, entry);
+	if (entry->Failed)
+		return false;
+
+	for (i = 0; i < entry->Count; ++i)
+	{
+		Ft_Esd_Widget *const child = entry->Children[i];
+		uint32_t key;
+		if (child->Parent != context)
+			continue; // Detached while rendering, collected again next frame
+		if (!(child->Active && child->GlobalValid))
+			continue;
+		Ft_Esd_Widget_CallSlot(child, FT_ESD_WIDGET_RENDER);
+		key = Ft_Esd_Widget_StateKey();
+		if (key != entry->Keys[i])
+		{
+			entry->Keys[i] = key;
+			changed = true;
+		}
+	}
+
+	if (changed)
+		Ft_Esd_Widget_SortUnordered(entry);
+	return true;
+}
+
 void Ft_Esd_Widget_IterateChildSlot(Ft_Esd_Widget *context, int slot)
 {
 	Ft_Esd_Widget *child = context->First;
@@ -80,7 +625,7 @@ void Ft_Esd_Widget_IterateChildActiveValidSlot(Ft_Esd_Widget *context, int slot)
 	{
 		Ft_Esd_Widget *const next = child->Next;
 		if (child->Active && child->GlobalValid)
-			child->Slots->Table[slot](child);
+			Ft_Esd_Widget_CallSlot(child, slot);
 		child = child->Parent ? child->Next : next;
 	}
 }
@@ -92,7 +637,7 @@ void Ft_Esd_Widget_IterateChildActiveValidSlotReverse(Ft_Esd_Widget *context, in
 	{
 		Ft_Esd_Widget *const previous = child->Previous;
 		if (child->Active && child->GlobalValid)
-			child->Slots->Table[slot](child);
+			Ft_Esd_Widget_CallSlot(child, slot);
 		child = child->Parent ? child->Previous : previous;
 	}
 }
@@ -104,7 +649,7 @@ void Ft_Esd_Widget_IterateChildVisibleSlot(Ft_Esd_Widget *context, int slot)
 	{
 		Ft_Esd_Widget *const next = child->Next;
 		if (child->Active && child->GlobalValid && Ft_Esd_Rect16_Intersects(child->GlobalRect, Ft_Esd_ScissorRect))
-			child->Slots->Table[slot](child);
+			Ft_Esd_Widget_CallSlot(child, slot);
 		child = child->Parent ? child->Next : next;
 	}
 }
@@ -116,11 +661,30 @@ void Ft_Esd_Widget_IterateChildVisibleSlotReverse(Ft_Esd_Widget *context, int sl
 	{
 		Ft_Esd_Widget *const previous = child->Previous;
 		if (child->Active && child->GlobalValid && Ft_Esd_Rect16_Intersects(child->GlobalRect, Ft_Esd_ScissorRect))
-			child->Slots->Table[slot](child);
+			Ft_Esd_Widget_CallSlot(child, slot);
 		child = child->Parent ? child->Previous : previous;
 	}
 }
 
+void Ft_Esd_Widget_IterateChildVisibleSlotOrdered(Ft_Esd_Widget *context, int slot, ft_bool_t horizontal)
+{
+	Ft_Esd_Rect16 scissor = Ft_Esd_ScissorRect;
+	ft_int16_t end = horizontal ? (scissor.X + scissor.Width) : (scissor.Y + scissor.Height);
+	Ft_Esd_Widget *child = context->First;
+	while (child)
+	{
+		Ft_Esd_Widget *const next = child->Next;
+		if (child->Active && child->GlobalValid)
+		{
+			if ((horizontal ? child->GlobalX : child->GlobalY) >= end)
+				break; // This and all following children are past the visible area
+			if (Ft_Esd_Rect16_Intersects(child->GlobalRect, scissor))
+				Ft_Esd_Widget_CallSlot(child, slot);
+		}
+		child = child->Parent ? child->Next : next;
+	}
+}
+
 void Ft_Esd_Widget_FlagCustomIdle(Ft_Esd_Widget *context)
 {
 	context->DefaultIdle = false;
@@ -180,6 +744,8 @@ void Ft_Esd_Widget_Update(struct Ft_Esd_Widget *context)
 	bool recalculate = context->Recalculate;
 	if (recalculate)
 	{
+		// Layout or active state changed, the frame needs to be rendered again
+		Ft_Esd_Widget_Damage(context);
 		context->Recalculate = 0;
 		Ft_Esd_Widget *child = context->First;
 		while (child)
@@ -203,6 +769,12 @@ void Ft_Esd_Widget_Update(struct Ft_Esd_Widget *context)
 
 void Ft_Esd_Widget_Render(struct Ft_Esd_Widget *context)
 {
+	if (context->Unordered && Ft_Esd_Widget_RenderUnordered(context))
+		return;
+#if FT_ESD_WIDGET_FLAT
+	if (Ft_Esd_Widget_RenderFlat(context))
+		return;
+#endif
 	Ft_Esd_Widget_IterateChildActiveValidSlotReverse(context, FT_ESD_WIDGET_RENDER);
 }
 
@@ -245,6 +817,12 @@ void Ft_Esd_Widget_PostGlobalRect(Ft_Esd_Widget *context)
 	context->Recalculate = 1;
 }
 
+void Ft_Esd_Widget_PostStructure(Ft_Esd_Widget *context)
+{
+	(void)context;
+	++s_Ft_Esd_Widget_TreeVersion;
+}
+
 void Ft_Esd_Widget_Detach_Internal(Ft_Esd_Widget *context)
 {
 	Ft_Esd_Widget *const parent = context->Parent;
@@ -263,6 +841,7 @@ void Ft_Esd_Widget_Detach_Internal(Ft_Esd_Widget *context)
 	context->Next = 0;
 	context->GlobalValid = FT_FALSE;
 	parent->Recalculate = FT_TRUE;
+	Ft_Esd_Widget_PostStructure(parent);
 }
 
 void Ft_Esd_Widget_Detach(Ft_Esd_Widget *context)
@@ -296,6 +875,7 @@ void Ft_Esd_Widget_LocalInsertTop(Ft_Esd_Widget *context, Ft_Esd_Widget *parent)
 	if (!parent->Last)
 		parent->Last = context;
 	parent->Recalculate = 1;
+	Ft_Esd_Widget_PostStructure(parent);
 	if (!activeBefore && Ft_Esd_Widget_GetActive(context))
 		context->Slots->Enable(context);
 }
@@ -323,6 +903,7 @@ void Ft_Esd_Widget_LocalInsertBottom(Ft_Esd_Widget *context, Ft_Esd_Widget *pare
 	if (!parent->First)
 		parent->First = context;
 	parent->Recalculate = 1;
+	Ft_Esd_Widget_PostStructure(parent);
 	if (!activeBefore && Ft_Esd_Widget_GetActive(context))
 		context->Slots->Enable(context);
 }
@@ -484,6 +1065,155 @@ void Ft_Esd_Widget_GetGlobalRect(Ft_Esd_Widget *context, ft_int16_t *x, ft_int16
 	*height = context->GlobalHeight;
 }
 
+// Display list cache entry of a widget, shared by the cached and secondary flags
+static Ft_Esd_WidgetDlCache *Ft_Esd_Widget_ClaimDlCache(Ft_Esd_Widget *context)
+{
+	Ft_Esd_WidgetDlCache *entry = Ft_Esd_Widget_FindDlCache(context);
+	if (entry)
+		return entry;
+	entry = Ft_Esd_Widget_FindDlCache(0);
+	if (!entry)
+	{
+		eve_printf_debug("No display list cache available for widget, increase FT_ESD_WIDGET_DLCACHE_COUNT\n");
+		return 0;
+	}
+	memset(entry, 0, sizeof(Ft_Esd_WidgetDlCache));
+	entry->DlCache.GpuHandle = GA_HANDLE_INVALID;
+	entry->SnapshotHandle = GA_HANDLE_INVALID;
+	entry->Widget = context;
+	return entry;
+}
+
+static void Ft_Esd_Widget_ReleaseDlCache(Ft_Esd_Widget *context, ft_bool_t keep)
+{
+	Ft_Esd_WidgetDlCache *entry = Ft_Esd_Widget_FindDlCache(context);
+	if (!entry)
+		return;
+	Esd_DlCache_Invalidate(&entry->DlCache);
+	Ft_Esd_Widget_DropSnapshot(entry);
+	if (!keep)
+		entry->Widget = 0;
+}
+
+void Ft_Esd_Widget_SetCached(Ft_Esd_Widget *context, ft_bool_t cached)
+{
+	if (cached && !Ft_Esd_Widget_ClaimDlCache(context))
+		return;
+	if (!cached)
+		Ft_Esd_Widget_ReleaseDlCache(context, context->Secondary);
+	if (context->Cached != cached)
+		Ft_Esd_Widget_PostStructure(context); // Cached widgets are not inlined in flat arrays
+	context->Cached = cached;
+	context->Snapshot = FT_FALSE;
+	context->Damaged = FT_FALSE;
+}
+
+void Ft_Esd_Widget_SetUnordered(Ft_Esd_Widget *context, ft_bool_t unordered)
+{
+	Ft_Esd_WidgetUnordered *entry = Ft_Esd_Widget_FindUnordered(context);
+	if (unordered && !entry)
+	{
+		entry = Ft_Esd_Widget_FindUnordered(0);
+		if (!entry)
+		{
+			eve_printf_debug("No sorting slot available for widget, increase FT_ESD_WIDGET_UNORDERED_COUNT\n");
+			return;
+		}
+		memset(entry, 0, sizeof(Ft_Esd_WidgetUnordered));
+		entry->Widget = context;
+		entry->Version = s_Ft_Esd_Widget_TreeVersion - 1; // Collected on the first render
+	}
+	else if (!unordered && entry)
+	{
+		entry->Widget = 0;
+	}
+	if (context->Unordered != unordered)
+		Ft_Esd_Widget_PostStructure(context); // Unordered widgets are not inlined in flat arrays
+	context->Unordered = unordered;
+}
+
+void Ft_Esd_Widget_SetSecondary(Ft_Esd_Widget *context, ft_bool_t secondary)
+{
+	if (secondary && !Ft_Esd_Widget_ClaimDlCache(context))
+		return;
+	if (!secondary)
+		Ft_Esd_Widget_ReleaseDlCache(context, context->Cached);
+	if (context->Secondary != secondary)
+		Ft_Esd_Widget_PostStructure(context); // Secondary widgets are not inlined in flat arrays
+	context->Secondary = secondary;
+}
+
+// Background layer callback of the context
+static void Ft_Esd_Widget_RenderBackground(Ft_Esd_Widget *context)
+{
+	if (context->Cached || context->Secondary)
+		Ft_Esd_Widget_RenderCached(context);
+	else
+		context->Slots->Render(context);
+}
+
+void Ft_Esd_Widget_SetBackgroundLayer(Ft_Esd_Widget *context, ft_bool_t background)
+{
+	Esd_Context *ec = Esd_CurrentContext;
+	Ft_Esd_Widget *previous = (ec->RenderBackground == (Esd_Callback)Ft_Esd_Widget_RenderBackground) ? (Ft_Esd_Widget *)ec->BackgroundContext : 0;
+	if (background)
+	{
+		if (previous && previous != context)
+			previous->Background = FT_FALSE;
+		Esd_Background_Set((Esd_Callback)Ft_Esd_Widget_RenderBackground, context);
+	}
+	else if (previous == context)
+	{
+		Esd_Background_Set(0, 0);
+	}
+	if (context->Background != background)
+		Ft_Esd_Widget_PostStructure(context); // Background widgets are not inlined in flat arrays
+	context->Background = background;
+}
+
+void Ft_Esd_Widget_SetBitmapCached(Ft_Esd_Widget *context, ft_bool_t cached)
+{
+	Ft_Esd_Widget_SetCached(context, cached);
+	// CMD_SNAPSHOT2 is not available on FT80x, keep the display list cache there
+	context->Snapshot = context->Cached && (EVE_CHIPID >= EVE_FT810);
+}
+
+void Ft_Esd_Widget_Damage(Ft_Esd_Widget *context)
+{
+	// Only cached widgets keep the flag, they are the ones that need to record again
+	Ft_Esd_Widget *widget = context;
+	while (widget)
+	{
+		if (widget->Cached)
+			widget->Damaged = FT_TRUE;
+		if (widget->Background)
+			Esd_Background_Invalidate();
+		widget = widget->Parent;
+	}
+	Esd_Invalidate();
+}
+
+void Ft_Esd_Widget_Bind(Ft_Esd_Widget *context, Esd_BindingSubscription *subscription, Esd_BindingCell *cell)
+{
+	Esd_Binding_Subscribe(subscription, cell, (void (*)(void *))Ft_Esd_Widget_Damage, context);
+}
+
+ft_bool_t Ft_Esd_Widget_RenderPreload(Ft_Esd_Widget *context)
+{
+	EVE_HalContext *phost = Esd_GetHost();
+
+	// Bypasses the display list caches, the masked output must not be replayed once shown
+	Esd_CurrentContext->Preloading = true;
+	EVE_CoDl_saveContext(phost);
+	EVE_CoDl_colorMask(phost, 0, 0, 0, 0);
+	EVE_CoDl_tagMask(phost, false);
+	context->Slots->Render(context);
+	EVE_CoDl_restoreContext(phost);
+	Esd_CurrentContext->Preloading = false;
+
+	return !Esd_AsyncLoad_Pending();
+}
+
 void Ft_Esd_Widget_Free(Ft_Esd_Widget *context)
 {
 	// eve_printf_debug("Request free widget\n");
@@ -494,6 +1224,12 @@ void Ft_Esd_Widget_Free(Ft_Esd_Widget *context)
 #endif
 		return; // ERROR
 	}
+	if (context->Cached)
+		Ft_Esd_Widget_SetCached(context, FT_FALSE);
+	if (context->Secondary)
+		Ft_Esd_Widget_SetSecondary(context, FT_FALSE);
+	if (context->Background)
+		Ft_Esd_Widget_SetBackgroundLayer(context, FT_FALSE);
 	memset(context, 0, sizeof(Ft_Esd_Widget)); // Safety wipe
 	context->Slots = &s_Ft_Esd_Widget__NoopSlots;
 	Esd_DeferredFree(context);
@@ -136,6 +136,12 @@ typedef struct Ft_Esd_Widget
 			bool Instanced : 1; // Widget is allocated dynamically in memory and needs to be deleted
 			bool GlobalValid : 1; // Global rectangle has been set by the parent layout
 			bool DefaultIdle : 1; // This widget and none of the child widget implement an idle function
+			bool Cached : 1; // Render output of this widget is recorded once and replayed with CMD_APPEND, call Ft_Esd_Widget_SetCached to change this
+			bool Damaged : 1; // Something inside this cached widget changed since it was recorded, set by Ft_Esd_Widget_Damage
+			bool Snapshot : 1; // Cached widget is drawn from a RAM_G snapshot of its render output, call Ft_Esd_Widget_SetBitmapCached to change this
+			bool Unordered : 1; // Children do not overlap and are rendered sorted by display list state, call Ft_Esd_Widget_SetUnordered to change this
+			bool Background : 1; // Widget is drawn by the background layer of the context rather than in tree order, call Ft_Esd_Widget_SetBackgroundLayer to change this
+			bool Secondary : 1; // Rendered from a recording refreshed every few frames while quality is reduced, call Ft_Esd_Widget_SetSecondary to change this
 		};
 		uint32_t Flags;
 	};
@@ -150,6 +156,9 @@ void Ft_Esd_Widget_PostLocalRect(Ft_Esd_Widget *context);
 // Call after changing GlobalRect variables
 void Ft_Esd_Widget_PostGlobalRect(Ft_Esd_Widget *context);
 
+// Call after changing the First, Last, Previous or Next links of widgets in the tree
+void Ft_Esd_Widget_PostStructure(Ft_Esd_Widget *context);
+
 void Ft_Esd_Widget_IterateChildSlot(Ft_Esd_Widget *context, int slot);
 void Ft_Esd_Widget_IterateChildSlotReverse(Ft_Esd_Widget *context, int slot);
 void Ft_Esd_Widget_IterateChildActiveSlot(Ft_Esd_Widget *context, int slot);
@@ -158,6 +167,8 @@ void Ft_Esd_Widget_IterateChildActiveValidSlot(Ft_Esd_Widget *context, int slot)
 void Ft_Esd_Widget_IterateChildActiveValidSlotReverse(Ft_Esd_Widget *context, int slot);
 void Ft_Esd_Widget_IterateChildVisibleSlot(Ft_Esd_Widget *context, int slot);
 void Ft_Esd_Widget_IterateChildVisibleSlotReverse(Ft_Esd_Widget *context, int slot);
+// Visible iteration for children laid out in increasing position along one axis, stops at the first child past the scissor
+void Ft_Esd_Widget_IterateChildVisibleSlotOrdered(Ft_Esd_Widget *context, int slot, ft_bool_t horizontal);
 void Ft_Esd_Widget_IterateChildClippedSlot(Ft_Esd_Widget *context, int slot, ft_bool_t (*visible)(Ft_Esd_Widget *));
 void Ft_Esd_Widget_IterateChildClippedSlotReverse(Ft_Esd_Widget *context, int slot, ft_bool_t (*visible)(Ft_Esd_Widget *));
 
@@ -260,9 +271,98 @@ void Ft_Esd_Widget_ScrollGlobalRect(Ft_Esd_Widget *context, ft_int16_t x, ft_int
 // Get GlobalRect from a widget. Called by the designer simulation. Equivalent to GlobalX etc
 void Ft_Esd_Widget_GetGlobalRect(Ft_Esd_Widget *context, ft_int16_t *x, ft_int16_t *y, ft_int16_t *width, ft_int16_t *height);
 
+// Keep the render output of a widget and its children in a display list cache, for static subtrees.
+// The recording is replayed until the widget or one of its children is damaged, or the display list state it was recorded in changes
+ESD_FUNCTION(Ft_Esd_Widget_SetCached, DisplayName = "Set Cached", Category = EsdLayoutUtilities)
+ESD_PARAMETER(context, Type = Ft_Esd_Widget *)
+ESD_PARAMETER(cached, Type = ft_bool_t, Default = true)
+void Ft_Esd_Widget_SetCached(Ft_Esd_Widget *context, ft_bool_t cached);
+
+// Render a widget and its children once, capture the result from the screen with CMD_SNAPSHOT2, and draw it as a single bitmap afterwards.
+// For opaque widgets that are expensive to draw and not overlapped by siblings. Damage the widget when its properties change
+ESD_FUNCTION(Ft_Esd_Widget_SetBitmapCached, DisplayName = "Set Bitmap Cached", Category = EsdLayoutUtilities)
+ESD_PARAMETER(context, Type = Ft_Esd_Widget *)
+ESD_PARAMETER(cached, Type = ft_bool_t, Default = true)
+void Ft_Esd_Widget_SetBitmapCached(Ft_Esd_Widget *context, ft_bool_t cached);
+
+// Render the children of a widget in the order that needs the fewest display list state changes, rather than in tree order.
+// Children are sorted by the primitive, bitmap handle and color they left the display list in on the previous frame.
+// Only for containers such as icon grids, where no two children overlap
+ESD_FUNCTION(Ft_Esd_Widget_SetUnordered, DisplayName = "Set Unordered", Category = EsdLayoutUtilities)
+ESD_PARAMETER(context, Type = Ft_Esd_Widget *)
+ESD_PARAMETER(unordered, Type = ft_bool_t, Default = true)
+void Ft_Esd_Widget_SetUnordered(Ft_Esd_Widget *context, ft_bool_t unordered);
+
+// Draw a widget and its children as the static background layer of the screen, see Esd_Background.h.
+// It is captured once into a full screen bitmap, and the rest of the tree is drawn above it, whatever its position in the tree.
+// Damaging the widget or one of its children captures it again. There is one background layer at a time
+ESD_FUNCTION(Ft_Esd_Widget_SetBackgroundLayer, DisplayName = "Set Background Layer", Category = EsdLayoutUtilities)
+ESD_PARAMETER(context, Type = Ft_Esd_Widget *)
+ESD_PARAMETER(background, Type = ft_bool_t, Default = true)
+void Ft_Esd_Widget_SetBackgroundLayer(Ft_Esd_Widget *context, ft_bool_t background);
+
+// Mark a widget and its children as secondary content, such as status readouts and decorations. While render quality
+// is reduced, see Esd_Quality.h, its render output is recorded once every FT_ESD_WIDGET_SECONDARY_FRAMES frames and
+// replayed in between. Damage to a cached secondary widget waits for the next refresh. Uses a display list cache entry
+ESD_FUNCTION(Ft_Esd_Widget_SetSecondary, DisplayName = "Set Secondary", Category = EsdLayoutUtilities)
+ESD_PARAMETER(context, Type = Ft_Esd_Widget *)
+ESD_PARAMETER(secondary, Type = ft_bool_t, Default = true)
+void Ft_Esd_Widget_SetSecondary(Ft_Esd_Widget *context, ft_bool_t secondary);
+
+// Call when what a widget renders changes, so cached parents record it again. Layout changes call this automatically
+ESD_FUNCTION(Ft_Esd_Widget_Damage, DisplayName = "Damage", Category = EsdLayoutUtilities)
+ESD_PARAMETER(context, Type = Ft_Esd_Widget *)
+void Ft_Esd_Widget_Damage(Ft_Esd_Widget *context);
+
+// Damage the widget whenever the bound cell changes, see Esd_Binding.h. The subscription is usually a field of the widget,
+// unsubscribe it from the End slot
+void Ft_Esd_Widget_Bind(Ft_Esd_Widget *context, Esd_BindingSubscription *subscription, Esd_BindingCell *cell);
+
+// Render a widget with color and tag writes masked, so the bitmaps it uses are loaded into RAM_G without it appearing on screen.
+// Bitmaps from files are queued on the background loader even when AsyncLoad is not set. Returns FT_TRUE once nothing is left to load
+ft_bool_t Ft_Esd_Widget_RenderPreload(Ft_Esd_Widget *context);
+
 // Safe way to free a widget. Must already be deactivated and ended. Uses a queue to free while not iterating through slots
 void Ft_Esd_Widget_Free(Ft_Esd_Widget *context);
 
+// Record the host time and command words of the Render slot of each widget instance, excluding its children.
+// Every FT_ESD_WIDGET_PROFILE_FRAMES frames a Ft_Esd_WidgetProfileSummary followed by its records is passed to Ft_Esd_WidgetProfileSink,
+// on FT9XX typically written to the usbdbg CDC endpoint. Command words are counted only with EVE_HAL_STATS
+#ifndef FT_ESD_WIDGET_PROFILE
+#define FT_ESD_WIDGET_PROFILE 0
+#endif
+#ifndef FT_ESD_WIDGET_PROFILE_FRAMES
+#define FT_ESD_WIDGET_PROFILE_FRAMES 60
+#endif
+#ifndef FT_ESD_WIDGET_PROFILE_COUNT
+#define FT_ESD_WIDGET_PROFILE_COUNT 64 // Widget instances recorded per window, any further instances are counted as dropped
+#endif
+#define FT_ESD_WIDGET_PROFILE_MAGIC 0x46505745UL // "EWPF"
+
+// Binary records, little endian
+typedef struct Ft_Esd_WidgetProfileRecord
+{
+	esd_classid_t ClassId;
+	uint32_t Instance; // Address of the widget
+	uint32_t Calls;
+	uint32_t Micros; // Total over the window
+	uint32_t CmdWords; // Total over the window
+} Ft_Esd_WidgetProfileRecord;
+
+typedef struct Ft_Esd_WidgetProfileSummary
+{
+	uint32_t Magic; // FT_ESD_WIDGET_PROFILE_MAGIC
+	uint32_t Frame; // Frame number at the end of the window
+	uint16_t Frames; // Number of frames in the window
+	uint16_t Count; // Number of records following the summary
+	uint32_t Dropped; // Render calls of instances that did not fit the table
+} Ft_Esd_WidgetProfileSummary;
+
+#if FT_ESD_WIDGET_PROFILE
+// Receives the summary and the records at the end of every window, nothing is recorded when not set
+extern void (*Ft_Esd_WidgetProfileSink)(const uint8_t *data, uint32_t size);
+#endif
+
 // Check if the widget is within the current screen scissor area
 ESD_FUNCTION(Ft_Esd_Widget_IsVisible, Type = ft_bool + t, DisplayName = "Is Visible", Category = EsdLayoutUtilities)
 ESD_PARAMETER(context, Type = Ft_Esd_Widget *)
@@ -61,7 +61,7 @@ void Ft_Esd_Animation_Render(Ft_Esd_Animation *context)
 {
 	void *owner = context->Owner;
 	Ft_Esd_Animation_Render_Impl(context);
-	context->RenderComplete(owner);
+	ESD_SIGNAL_EMIT(context, RenderComplete, owner);
 	Ft_Esd_Widget_Render((Ft_Esd_Widget *)context); 
 }
 
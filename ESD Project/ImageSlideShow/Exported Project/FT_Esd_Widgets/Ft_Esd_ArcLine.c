@@ -2,7 +2,10 @@
 #include "Ft_Esd_Dl.h"
 #include "Ft_Esd_ArcLine.h"
 
-#include <math.h>
+#include "Esd_Math.h"
+#include "Esd_DlCache.h"
+
+#include <string.h>
 
 enum Ft_Esd_ArcLine_SectionType
 {
@@ -35,6 +38,7 @@ void Ft_Esd_ArcLine_Draw_Arc_Above(float angle, int x, int y, int radius, ft_arg
 void Ft_Esd_ArcLine_Draw_Arc_Below(float angle, int x, int y, int radius, ft_argb32_t color, ft_bool_t isClockwise, float refAngle);
 void Ft_Esd_ArcLine_Draw_Line(int x0, int y0, int x1, int y1);
 void Ft_Esd_ArcLine_GetTanglePoint(float angle, float radius, float *x, float *y, ft_bool_t isClockwise);
+void Ft_Esd_ArcLine_GetTanglePointInt(int angle, int radius, int *x, int *y, ft_bool_t isClockwise);
 
 void Ft_Esd_ArcLine_Draw_Sectors(int sectorMask, int x, int y, int side);
 void Ft_Esd_ArcLine_Draw_SectorArea(int x, int y, int radius, ft_bool_t isClockwise, int origin, int value);
@@ -51,12 +55,105 @@ ESD_PARAMETER(origin, Type = int)
 ESD_PARAMETER(value, Type = int)
 void Ft_Esd_ArcLine_Render_Func(Ft_Esd_ArcLine *context, int x, int y, int radius, int border, ft_argb32_t color, ft_bool_t isClockwise, int origin, int value);
 
+// Number of arc lines that can have their geometry cached at the same time
+#ifndef FT_ESD_ARCLINE_DLCACHE_COUNT
+#define FT_ESD_ARCLINE_DLCACHE_COUNT 4
+#endif
+
+// Everything the generated display list depends on
+typedef struct
+{
+	Ft_Esd_Rect16 GlobalRect;
+	Ft_Esd_Rect16 Scissor;
+	int X, Y, Radius, Border;
+	int Origin, Value;
+	ft_argb32_t Color;
+	ft_bool_t IsClockwise;
+	ft_bool_t ShowStartPoint;
+	ft_bool_t ShowEndPoint;
+	ft_bool_t ShowPointShadow;
+} Ft_Esd_ArcLine_CacheKey;
+
+typedef struct
+{
+	Ft_Esd_ArcLine *Widget;
+	Ft_Esd_ArcLine_CacheKey Key;
+	Esd_DlCache DlCache;
+} Ft_Esd_ArcLine_Cache;
+
+static Ft_Esd_ArcLine_Cache s_Ft_Esd_ArcLine_Cache[FT_ESD_ARCLINE_DLCACHE_COUNT];
+static int s_Ft_Esd_ArcLine_CacheNext = 0;
+
+static void Ft_Esd_ArcLine_Render_Geometry(Ft_Esd_ArcLine *context, int x, int y, int radius, int border, ft_argb32_t color, ft_bool_t isClockwise, int origin, int value);
+
+static Ft_Esd_ArcLine_Cache *Ft_Esd_ArcLine_GetCache(Ft_Esd_ArcLine *context)
+{
+	Ft_Esd_ArcLine_Cache *entry;
+	int i;
+	for (i = 0; i < FT_ESD_ARCLINE_DLCACHE_COUNT; ++i)
+	{
+		if (s_Ft_Esd_ArcLine_Cache[i].Widget == context)
+			return &s_Ft_Esd_ArcLine_Cache[i];
+	}
+
+	// Take over the oldest entry
+	entry = &s_Ft_Esd_ArcLine_Cache[s_Ft_Esd_ArcLine_CacheNext];
+	s_Ft_Esd_ArcLine_CacheNext = (s_Ft_Esd_ArcLine_CacheNext + 1) % FT_ESD_ARCLINE_DLCACHE_COUNT;
+	if (entry->Widget)
+		Esd_DlCache_Invalidate(&entry->DlCache);
+	else
+		entry->DlCache.GpuHandle = GA_HANDLE_INVALID;
+	memset(&entry->Key, 0, sizeof(entry->Key));
+	entry->Widget = context;
+	return entry;
+}
+
 void Ft_Esd_ArcLine_Render_Func(Ft_Esd_ArcLine *context, int x, int y, int radius, int border, ft_argb32_t color, ft_bool_t isClockwise, int origin, int value)
 {
-	EVE_HalContext *phost = Esd_GetHost();
+	Ft_Esd_ArcLine_CacheKey key;
+	Ft_Esd_ArcLine_Cache *entry;
 
 	if (radius <= 0)
 		return;
+	if (x + radius + radius < 0)
+		return;
+
+	memset(&key, 0, sizeof(key));
+	key.GlobalRect = context->Widget.GlobalRect;
+	key.Scissor = Ft_Esd_Dl_Scissor_Get();
+	key.X = x;
+	key.Y = y;
+	key.Radius = radius;
+	key.Border = border;
+	key.Origin = origin;
+	key.Value = value;
+	key.Color = color;
+	key.IsClockwise = isClockwise;
+	key.ShowStartPoint = context->ShowStartPoint;
+	key.ShowEndPoint = context->ShowEndPoint;
+	key.ShowPointShadow = context->ShowPointShadow;
+
+	entry = Ft_Esd_ArcLine_GetCache(context);
+	if (memcmp(&entry->Key, &key, sizeof(key)))
+	{
+		// Changed since the last frame, don't stall on recording while the arc is animating
+		Esd_DlCache_Invalidate(&entry->DlCache);
+		entry->Key = key;
+		Ft_Esd_ArcLine_Render_Geometry(context, x, y, radius, border, color, isClockwise, origin, value);
+		return;
+	}
+
+	if (Esd_DlCache_Begin(&entry->DlCache))
+	{
+		Ft_Esd_ArcLine_Render_Geometry(context, x, y, radius, border, color, isClockwise, origin, value);
+		Esd_DlCache_End(&entry->DlCache);
+	}
+}
+
+static void Ft_Esd_ArcLine_Render_Geometry(Ft_Esd_ArcLine *context, int x, int y, int radius, int border, ft_argb32_t color, ft_bool_t isClockwise, int origin, int value)
+{
+	EVE_HalContext *phost = Esd_GetHost();
+
 	int a = ((color & 0xFF000000)) >> 24;
 	int r = ((color & 0x00FF0000)) >> 16;
 	int g = ((color & 0x0000FF00)) >> 8;
@@ -70,11 +167,6 @@ void Ft_Esd_ArcLine_Render_Func(Ft_Esd_ArcLine *context, int x, int y, int radiu
 	int endAngle = origin + value;
 	int endSector = (endAngle / 90) % 4;
 
-	if (x + radius + radius < 0)
-	{
-		// printf("x too small  %d, %d, %d\n", x, y, radius);
-		return;
-	}
 	// printf("x, y, radius %d, %d, %d\n", x, y, radius);
 	// printf("innerRadius, endAngle, originSector %d, %d, %d\n", innerRadius, endAngle, originSector);
 
@@ -432,21 +524,25 @@ void Ft_Esd_ArcLine_GetTanglePoint(float angle, float radius, float *x, float *y
 	float x0 = *x;
 	float y0 = *y;
 
-	if (angle > 360)
-		angle -= 360;
-	else if (angle < 0)
-		angle += 360;
-
 	// printf(">Angle: %f , x,y,r,pr: %d,%d,%d,%d\n", angle, x,y,radius,pointRadius);
-	float dA = angle * (3.14159265f / 180.0f);
-	float dY = (float)sin(dA) * (radius);
-	float dX = (float)cos(dA) * (radius);
+	uint16_t dA = Esd_Math_DegToAngle(angle);
+	float dY = (float)Esd_Math_SinQ16(dA) * radius * (1.0f / 65536.0f);
+	float dX = (float)Esd_Math_CosQ16(dA) * radius * (1.0f / 65536.0f);
 	*x = x0 + dX;
 	*y = y0 + ((isClockwise) ? dY : -dY);
 	// printf(">x,y: %d,%d\n", x,y);
 	// DrawCirle(x, y, pointRadius >> 1, color, 0xFFFFFFFF);
 }
 
+// Integer degrees and coordinates, rounds down like the float version truncated by its callers
+void Ft_Esd_ArcLine_GetTanglePointInt(int angle, int radius, int *x, int *y, ft_bool_t isClockwise)
+{
+	uint16_t dA = ESD_ANGLE_DEG(angle);
+	int32_t dY = Esd_Math_SinQ16(dA) * radius;
+	*x += (Esd_Math_CosQ16(dA) * radius) >> 16;
+	*y += ((isClockwise) ? dY : -dY) >> 16;
+}
+
 void Ft_Esd_ArcLine_Draw_SectorArea(int x, int y, int radius, ft_bool_t isClockwise, int origin, int value)
 {
 	while (origin < 0)
@@ -635,22 +731,22 @@ void Ft_Esd_ArcLine_Draw_Arc_Left(float angle, int x, int y, int radius, ft_argb
 	// x = x + 1;
 	EVE_CoDl_vertex2f(phost, x, y);
 
-	float dY = 0;
-	float dX = 0;
+	int dY = 0;
+	int dX = 0;
 	if (type == Full)
 	{
-		dY = (float)((isClockwise) ? radius : -radius);
+		dY = (isClockwise) ? radius : -radius;
 	}
 	else
 	{
-		dA = dA * (3.14159265f / 180.0f);
-		dY = (float)sin(dA) * ((float)radius);
-		dX = (float)cos(dA) * ((float)radius);
+		uint16_t rot = Esd_Math_DegToAngle(dA);
+		dY = Esd_Math_SinQ16(rot) * radius / 65536;
+		dX = Esd_Math_CosQ16(rot) * radius / 65536;
 	}
 	// printf("EDGE_STRIP_L from\n x: %d ; y: %d\n", x, y);
 	int x0 = x, y0 = y;
-	x = (isClockwise) ? x - (int)dX : x - (int)dX;
-	y = (isClockwise) ? y - (int)dY : y - (int)dY + 1;
+	x = (isClockwise) ? x - dX : x - dX;
+	y = (isClockwise) ? y - dY : y - dY + 1;
 	// printf("x: %d ; y: %d\n", x, y);
 	EVE_CoDl_vertex2f(phost, x, y);
 
@@ -706,23 +802,23 @@ void Ft_Esd_ArcLine_Draw_Arc_Right(float angle, int x, int y, int radius, ft_arg
 	EVE_CoCmd_dl(phost, BEGIN(EDGE_STRIP_R));
 	EVE_CoDl_vertex2f(phost, x, y);
 
-	float dY = 0;
-	float dX = 0;
+	int dY = 0;
+	int dX = 0;
 	if (type == Full)
 	{
-		dY = (float)((isClockwise) ? radius : -radius);
+		dY = (isClockwise) ? radius : -radius;
 		// printf("full angle\n");
 	}
 	else
 	{
-		dA = dA * (3.14159265f / 180.0f);
-		dY = (float)sin(dA) * ((float)radius);
-		dX = (float)cos(dA) * ((float)radius);
+		uint16_t rot = Esd_Math_DegToAngle(dA);
+		dY = Esd_Math_SinQ16(rot) * radius / 65536;
+		dX = Esd_Math_CosQ16(rot) * radius / 65536;
 	}
 	int x0 = x, y0 = y;
 	// printf("EDGE_STRIP_R from\n x: %d ; y: %d to ", x, y);
-	x = (isClockwise) ? x + (int)dX : x + (int)dX;
-	y = (isClockwise) ? y + (int)dY : y + (int)dY;
+	x = (isClockwise) ? x + dX : x + dX;
+	y = (isClockwise) ? y + dY : y + dY;
 	// printf("x: %d ; y: %d\n", x, y);
 	EVE_CoDl_vertex2f(phost, x, y);
 	EVE_CoDl_end(phost);
@@ -778,23 +874,23 @@ void Ft_Esd_ArcLine_Draw_Arc_Above(float angle, int x, int y, int radius, ft_arg
 	// y = y + 1;
 	EVE_CoDl_vertex2f(phost, x, y);
 
-	float dY = 0;
-	float dX = 0;
+	int dY = 0;
+	int dX = 0;
 	if (type == Full)
 	{
-		dX = (float)((isClockwise) ? radius : -radius);
+		dX = (isClockwise) ? radius : -radius;
 		// printf("EDGE_STRIP_A Full\n", x, y);
 	}
 	else
 	{
-		dA = dA * (3.14159265f / 180.0f);
-		dY = (float)cos(dA) * ((float)radius);
-		dX = (float)sin(dA) * ((float)radius);
+		uint16_t rot = Esd_Math_DegToAngle(dA);
+		dY = Esd_Math_CosQ16(rot) * radius / 65536;
+		dX = Esd_Math_SinQ16(rot) * radius / 65536;
 	}
 	int x0 = x, y0 = y;
 	// printf("EDGE_STRIP_A from\n x: %d ; y: %d\n", x, y);
-	x = (isClockwise) ? x + (int)dX + 1 : x + (int)dX - 1;
-	y = (isClockwise) ? y - (int)dY : y - (int)dY;
+	x = (isClockwise) ? x + dX + 1 : x + dX - 1;
+	y = (isClockwise) ? y - dY : y - dY;
 	// printf("x: %d ; y: %d\n", x, y);
 	EVE_CoDl_vertex2f(phost, x, y);
 	EVE_CoDl_end(phost);
@@ -849,28 +945,28 @@ void Ft_Esd_ArcLine_Draw_Arc_Below(float angle, int x, int y, int radius, ft_arg
 	// y = y - 1;
 	EVE_CoDl_vertex2f(phost, x, y);
 
-	float dY = 0;
-	float dX = 0;
+	int dY = 0;
+	int dX = 0;
 	if (type == Full)
 	{
-		dX = (float)((isClockwise) ? radius : -radius);
+		dX = (isClockwise) ? radius : -radius;
 		// printf("EDGE_STRIP_B Full\n", x, y);
 	}
 	else
 	{
-		dA = dA * (3.14159265f / 180.0f);
-		dY = (float)cos(dA) * ((float)radius);
-		dX = (float)sin(dA) * ((float)radius);
+		uint16_t rot = Esd_Math_DegToAngle(dA);
+		dY = Esd_Math_CosQ16(rot) * radius / 65536;
+		dX = Esd_Math_SinQ16(rot) * radius / 65536;
 	}
 	// if (direction != Clockwise)
 	//	printf("EDGE_STRIP_B from  x: %d ; y: %d ", x, y);
 	// printf("EDGE_STRIP_B direction: %d\n", (int)direction);
-	// x = (isClockwise) ? x - (int)dX + 1: x - (int)dX + 3;
+	// x = (isClockwise) ? x - dX + 1: x - dX + 3;
 	int x0 = x, y0 = y;
-	x = (isClockwise) ? x - (int)dX : x - (int)dX + 2;
-	// x = (isClockwise) ? x - (int)dX : x - (int)dX + 1;
+	x = (isClockwise) ? x - dX : x - dX + 2;
+	// x = (isClockwise) ? x - dX : x - dX + 1;
 
-	y = (isClockwise) ? y + (int)dY : y + (int)dY;
+	y = (isClockwise) ? y + dY : y + dY;
 	// if (direction != Clockwise)
 	//	printf(" to x: %d ; y: %d\n", x, y);
 	// printf("x: %d ; y: %d\n", x, y);
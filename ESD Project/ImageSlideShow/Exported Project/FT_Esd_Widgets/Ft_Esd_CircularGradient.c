@@ -14,8 +14,7 @@
 extern ESD_CORE_EXPORT EVE_HalContext *Esd_Host;
 extern ESD_CORE_EXPORT Esd_GpuAlloc *Esd_GAlloc;
 
-static Ft_Esd_GpuHandle pythagGpuHandle;
-static Ft_Esd_GpuHandle gaussGpuHandle;
+static Esd_GpuHandle s_RampGpuHandle = GA_HANDLE_INIT;
 
 /* TODO: Use deflate compressed format for embedding */
 
@@ -59,50 +58,51 @@ static void CircularGradient_BitmapTransform(int dir, int w, int h)
 	}
 }
 
-void writeBitmapIntoGPUMemory(uint8_t gradientType)
+// Mirror a half ramp into the command buffer, the first half is the ramp as is
+static void CircularGradient_WriteRamp(const uint8_t *raw, uint32_t size)
 {
 	EVE_HalContext *phost = Esd_GetHost();
+	uint32_t mark = EVE_Hal_scratchMark(phost);
+	uint8_t *mirrored = (uint8_t *)EVE_Hal_scratchAlloc(phost, size);
+	uint32_t count;
 
-	if (gradientType == ESD_PYTHAGOREAN)
-	{
-		uint8_t pythag_raw_symmetric[sizeof(pythag_raw) << 1];
-		uint32_t size = sizeof(pythag_raw), count = size;
-		while (count)
-		{
-			pythag_raw_symmetric[size + count - 1] = pythag_raw_symmetric[size - count] = pythag_raw[size - count];
-			count--;
-		}
-
-		pythagGpuHandle = Ft_Esd_GpuAlloc_Alloc(Ft_Esd_GAlloc, BITMAP_TOTAL_SIZE, GA_GC_FLAG);
-		uint32_t addr = Ft_Esd_GpuAlloc_Get(Ft_Esd_GAlloc, pythagGpuHandle);
-
-		EVE_Cmd_startFunc(phost);
-		EVE_Cmd_wr32(phost, CMD_MEMWRITE);
-		EVE_Cmd_wr32(phost, addr);
-		EVE_Cmd_wr32(phost, sizeof(pythag_raw_symmetric));
-		EVE_Cmd_wrMem(phost, pythag_raw_symmetric, sizeof(pythag_raw_symmetric));
-		EVE_Cmd_endFunc(phost);
-	}
-	else
+	eve_assert((size << 1) == BITMAP_TOTAL_SIZE);
+	EVE_Cmd_wrMem(phost, raw, size);
+	if (!mirrored)
 	{
-		uint8_t gauss_raw_symmetric[sizeof(gauss_raw) << 1];
-		uint32_t size = sizeof(gauss_raw), count = size;
-		while (count)
-		{
-			gauss_raw_symmetric[size + count - 1] = gauss_raw_symmetric[size - count] = gauss_raw[size - count];
-			count--;
-		}
-
-		gaussGpuHandle = Ft_Esd_GpuAlloc_Alloc(Ft_Esd_GAlloc, BITMAP_TOTAL_SIZE, GA_GC_FLAG);
-		uint32_t addr = Ft_Esd_GpuAlloc_Get(Ft_Esd_GAlloc, gaussGpuHandle);
-
-		EVE_Cmd_startFunc(phost);
-		EVE_Cmd_wr32(phost, CMD_MEMWRITE);
-		EVE_Cmd_wr32(phost, addr);
-		EVE_Cmd_wr32(phost, sizeof(gauss_raw_symmetric));
-		EVE_Cmd_wrMem(phost, gauss_raw_symmetric, sizeof(gauss_raw_symmetric));
-		EVE_Cmd_endFunc(phost);
+		for (count = size; count; --count)
+			EVE_Cmd_wr8(phost, raw[count - 1]);
+		return;
 	}
+	for (count = 0; count < size; ++count)
+		mirrored[count] = raw[size - 1 - count];
+	EVE_Cmd_wrMem(phost, mirrored, size);
+	EVE_Hal_scratchRelease(phost, mark);
+}
+
+/* Both ramps share one allocation for all instances. It is not garbage collected,
+so it is uploaded once and only again after RAM_G has been reset. */
+static uint32_t CircularGradient_GetRamps()
+{
+	EVE_HalContext *phost = Esd_GetHost();
+	uint32_t addr = Esd_GpuAlloc_Get(Esd_GAlloc, s_RampGpuHandle);
+	if (addr != GA_INVALID)
+		return addr;
+
+	s_RampGpuHandle = Esd_GpuAlloc_Alloc(Esd_GAlloc, BITMAP_TOTAL_SIZE * 2, 0);
+	addr = Esd_GpuAlloc_Get(Esd_GAlloc, s_RampGpuHandle);
+	if (addr == GA_INVALID)
+		return GA_INVALID;
+
+	EVE_Cmd_startFunc(phost);
+	EVE_Cmd_wr32(phost, CMD_MEMWRITE);
+	EVE_Cmd_wr32(phost, addr);
+	EVE_Cmd_wr32(phost, BITMAP_TOTAL_SIZE * 2);
+	CircularGradient_WriteRamp(pythag_raw, sizeof(pythag_raw));
+	CircularGradient_WriteRamp(gauss_raw, sizeof(gauss_raw));
+	EVE_Cmd_endFunc(phost);
+	Esd_GpuAlloc_Seal(Esd_GAlloc, s_RampGpuHandle);
+	return addr;
 }
 
 ESD_METHOD(Circular_Gradient_Widget_Render_Circular, Context = Ft_Esd_CircularGradient)
@@ -131,25 +131,14 @@ ft_void_t Circular_Gradient_Widget_Render_Circular(Ft_Esd_CircularGradient *cont
 
 	EVE_CoDl_bitmapHandle(phost, handle);
 
-	if (gradientType == ESD_PYTHAGOREAN)
-	{
-		uint32_t addr = Esd_GpuAlloc_Get(Esd_GAlloc, pythagGpuHandle);
-		if (addr == GA_INVALID)
-			writeBitmapIntoGPUMemory(gradientType);
-		if (EVE_CHIPID >= EVE_FT810)
-		{
-			EVE_CoCmd_setBitmap(phost, addr, L8, BITMAP_WIDTH, BITMAP_HEIGHT); // FIXME: Implement an FT800 software fallback for CMD_SETBITMAP
-		}
-	}
-	else
+	uint32_t addr = CircularGradient_GetRamps();
+	if (addr == GA_INVALID)
+		return;
+	if (gradientType != ESD_PYTHAGOREAN)
+		addr += BITMAP_TOTAL_SIZE;
+	if (EVE_CHIPID >= EVE_FT810)
 	{
-		uint32_t addr = Esd_GpuAlloc_Get(Esd_GAlloc, gaussGpuHandle);
-		if (addr == GA_INVALID)
-			writeBitmapIntoGPUMemory(gradientType);
-		if (EVE_CHIPID >= EVE_FT810)
-		{
-			EVE_CoCmd_setBitmap(phost, addr, L8, BITMAP_WIDTH, BITMAP_HEIGHT);
-		}
+		EVE_CoCmd_setBitmap(phost, addr, L8, BITMAP_WIDTH, BITMAP_HEIGHT); // FIXME: Implement an FT800 software fallback for CMD_SETBITMAP
 	}
 	EVE_CoDl_bitmapSize(phost, BILINEAR, REPEAT, REPEAT, w, h);
 
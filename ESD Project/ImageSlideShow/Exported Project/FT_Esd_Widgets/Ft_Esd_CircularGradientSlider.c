@@ -1,5 +1,6 @@
 #include "Ft_Esd.h"
 #include "Ft_Esd_CircularGradientSlider.h"
+#include "Esd_Math.h"
 
 ESD_METHOD(Ft_Esd_CircularGradientSlider_Function, Context = Ft_Esd_CircularGradientSlider)
 ESD_PARAMETER(x, Type = int)
@@ -30,13 +31,12 @@ void Ft_Esd_CircularGradientSlider_Function(Ft_Esd_CircularGradientSlider *conte
 	int origin = context->OriginA;
 	int getA = context->GetA;
 
-	float dA = (float)(angle + origin) * (3.14159265f / 180.0f);
-	float dY = (float)sin(dA) * (rad);
-	float dX = (float)cos(dA) * (rad);
-	dY = -dY;
+	uint16_t dA = ESD_ANGLE_DEG(angle + origin);
+	int dY = -((Esd_Math_SinQ16(dA) * rad) / 65536);
+	int dX = (Esd_Math_CosQ16(dA) * rad) / 65536;
 
-	int cx = (int)dX + cxx;
-	int cy = (int)dY + cyy;
+	int cx = dX + cxx;
+	int cy = dY + cyy;
 
 	if ((tx >= (cx - border)) && (tx <= (cx + border)))
 	{
@@ -56,13 +56,12 @@ void Ft_Esd_CircularGradientSlider_Function(Ft_Esd_CircularGradientSlider *conte
 		}
 	}
 
-	dA = (float)origin * (3.14159265f / 180.0f);
-	dY = (float)sin(dA) * (rad);
-	dX = (float)cos(dA) * (rad);
-	dY = -dY;
+	dA = ESD_ANGLE_DEG(origin);
+	dY = -((Esd_Math_SinQ16(dA) * rad) / 65536);
+	dX = (Esd_Math_CosQ16(dA) * rad) / 65536;
 
-	int cpx = (int)dX + cxx;
-	int cpy = (int)dY + cyy;
+	int cpx = dX + cxx;
+	int cpy = dY + cyy;
 
 	if ((tx >= (cpx - border)) && (tx <= (cpx + border)))
 	{
@@ -11,6 +11,8 @@ Introduction:
 This widget draws a analog clock.
 All of its hands can be set.
 Co-processor command CMD_CLOCK is used internally.
+The face is generated without hands and replayed from a display list cache,
+the hands are drawn over it as single lines.
 */
 
 #include "Ft_Esd_Clock.h"
@@ -18,6 +20,9 @@ Co-processor command CMD_CLOCK is used internally.
 #include "Esd_Context.h"
 #include "Ft_Esd_CoCmd.h"
 #include "Ft_Esd_Dl.h"
+#include "Ft_Esd_Dial.h"
+
+#include <string.h>
 
 ESD_CORE_EXPORT void Esd_Noop(void *context);
 Ft_Esd_Theme * Ft_Esd_Clock_Theme__Default(void *context) { return Ft_Esd_Theme_GetCurrent(); }
@@ -151,7 +156,34 @@ void Ft_Esd_Clock_Render(Ft_Esd_Clock *context)
 	ft_uint32_t left_3 = context->Ms(owner);
 	ft_uint32_t right_3 = 1000UL;
 	ft_uint32_t ms = left_3 % right_3;
-	Ft_Gpu_CoCmd_Clock(phost_1, x, y, r, options, height, m, s_1, ms);
+	Ft_Esd_DialKey key;
+	memset(&key, 0, sizeof(key));
+	key.Scissor = Ft_Esd_Dl_Scissor_Get();
+	key.X = x;
+	key.Y = y;
+	key.R = r;
+	key.Options = options;
+	key.BgColor = c_1;
+	key.Color = c_2;
+	key.Alpha = alpha;
+	key.Tag = s;
+	if (Ft_Esd_Dial_BeginFace(context, &key))
+	{
+		// The face does not depend on the time
+		Ft_Gpu_CoCmd_Clock(phost_1, x, y, r, options | OPT_NOHANDS, 0, 0, 0, 0);
+		Ft_Esd_Dial_EndFace(context);
+	}
+	{
+		// Hands advance continuously, as with CMD_CLOCK
+		ft_argb32_t hand = ((ft_argb32_t)alpha << 24) | (c_2 & 0xFFFFFFUL);
+		uint32_t secMs = (s_1 % 60) * 1000UL + ms;
+		uint32_t minSec = ((uint32_t)m % 60) * 60UL + s_1 % 60;
+		uint32_t hourMin = ((uint32_t)height % 12) * 60UL + m % 60;
+		Ft_Esd_Dial_Needle(x, y, (uint16_t)((hourMin * ESD_ANGLE_TURN) / 720), (r * 9) >> 4, max(r >> 4, 2), hand);
+		Ft_Esd_Dial_Needle(x, y, (uint16_t)((minSec * ESD_ANGLE_TURN) / 3600), (r * 13) >> 4, max(r >> 5, 2), hand);
+		Ft_Esd_Dial_Needle(x, y, (uint16_t)((secMs * (ESD_ANGLE_TURN >> 4)) / 3750), (r * 14) >> 4, 1, hand);
+		Esd_Render_PointF((int32_t)x << 4, (int32_t)y << 4, (int32_t)max(r >> 4, 2) << 4, hand);
+	}
 	ft_uint8_t s_2 = 255;
 	Ft_Esd_Dl_TAG(s_2);
 	Ft_Esd_Widget_Render((Ft_Esd_Widget *)context); 
@@ -2,6 +2,7 @@
 #include "Ft_Esd_ColorPicker.h"
 #define _USE_MATH_DEFINES 1
 #include <math.h>
+#include "Esd_Math.h"
 
 ESD_FUNCTION(getSat, Type = double, DisplayName = "Get Saturation", Category = Ft_Esd_ColorPicker)
 ESD_PARAMETER(x0, Type = int)
@@ -23,43 +24,8 @@ ESD_PARAMETER(x1, Type = int)
 ESD_PARAMETER(y1, Type = int)
 double getHue(int x0, int y0, int x1, int y1)
 {
-	double angleInRadian, angleInDegree;
-	if (x0 == x1)
-	{
-		if (y1 < y0)
-			return 90;
-		else if (y1 > y0)
-			return 270;
-		else
-			return 0;
-	}
-	else if (x1 > x0)
-	{
-		if (y1 > y0)
-		{
-			angleInRadian = atan2((y1 - y0), (x1 - x0));
-			angleInDegree = 360 - (angleInRadian * 180 / M_PI);
-		}
-		else
-		{
-			angleInRadian = atan2((y0 - y1), (x1 - x0));
-			angleInDegree = angleInRadian * 180 / M_PI;
-		}
-	}
-	else
-	{
-		if (y1 > y0)
-		{
-			angleInRadian = atan2((y1 - y0), (x0 - x1));
-			angleInDegree = 180 + (angleInRadian * 180 / M_PI);
-		}
-		else
-		{
-			angleInRadian = atan2((y0 - y1), (x0 - x1));
-			angleInDegree = 180 - (angleInRadian * 180 / M_PI);
-		}
-	}
-	return angleInDegree;
+	// Screen y grows downward, hue runs counter-clockwise from the +x axis
+	return (double)Esd_Math_Atan2(y0 - y1, x1 - x0) * 360.0 / ESD_ANGLE_TURN;
 }
 
 ESD_FUNCTION(hsvToRgb, Type = ft_argb32_t, DisplayName = "HSV to RGB", Category = Ft_Esd_ColorPicker)
@@ -0,0 +1,74 @@
+
+#include "Ft_Esd_Dial.h"
+
+#include "Esd_Render.h"
+#include "Esd_DlCache.h"
+
+#include <string.h>
+
+typedef struct
+{
+	void *Widget;
+	Ft_Esd_DialKey Key;
+	Esd_DlCache DlCache;
+	bool Recording;
+} Ft_Esd_DialCache;
+
+static Ft_Esd_DialCache s_Ft_Esd_DialCache[FT_ESD_DIAL_DLCACHE_COUNT];
+static int s_Ft_Esd_DialCacheNext = 0;
+
+static Ft_Esd_DialCache *Ft_Esd_Dial_GetCache(void *widget)
+{
+	Ft_Esd_DialCache *entry;
+	int i;
+	for (i = 0; i < FT_ESD_DIAL_DLCACHE_COUNT; ++i)
+	{
+		if (s_Ft_Esd_DialCache[i].Widget == widget)
+			return &s_Ft_Esd_DialCache[i];
+	}
+
+	// Take over the oldest entry
+	entry = &s_Ft_Esd_DialCache[s_Ft_Esd_DialCacheNext];
+	s_Ft_Esd_DialCacheNext = (s_Ft_Esd_DialCacheNext + 1) % FT_ESD_DIAL_DLCACHE_COUNT;
+	if (entry->Widget)
+		Esd_DlCache_Invalidate(&entry->DlCache);
+	else
+		entry->DlCache.GpuHandle = GA_HANDLE_INVALID;
+	memset(&entry->Key, 0, sizeof(entry->Key));
+	entry->Recording = false;
+	entry->Widget = widget;
+	return entry;
+}
+
+bool Ft_Esd_Dial_BeginFace(void *widget, const Ft_Esd_DialKey *key)
+{
+	Ft_Esd_DialCache *entry = Ft_Esd_Dial_GetCache(widget);
+	entry->Recording = false;
+	if (memcmp(&entry->Key, key, sizeof(Ft_Esd_DialKey)))
+	{
+		// Changed since the last frame, record once it holds still
+		Esd_DlCache_Invalidate(&entry->DlCache);
+		entry->Key = *key;
+		return true;
+	}
+	entry->Recording = Esd_DlCache_Begin(&entry->DlCache);
+	return entry->Recording;
+}
+
+void Ft_Esd_Dial_EndFace(void *widget)
+{
+	Ft_Esd_DialCache *entry = Ft_Esd_Dial_GetCache(widget);
+	if (entry->Recording)
+		Esd_DlCache_End(&entry->DlCache);
+	entry->Recording = false;
+}
+
+void Ft_Esd_Dial_Needle(int16_t x, int16_t y, uint16_t angle, int32_t length, int32_t width, esd_argb32_t color)
+{
+	// Q16 times 1/16 pixel, rounded
+	int32_t dx = (Esd_Math_SinQ16(angle) * length + (1L << 11)) >> 12;
+	int32_t dy = (Esd_Math_CosQ16(angle) * length + (1L << 11)) >> 12;
+	Esd_Render_LineF((int32_t)x << 4, (int32_t)y << 4, ((int32_t)x << 4) + dx, ((int32_t)y << 4) - dy, width << 3, color);
+}
+
+/* end of file */
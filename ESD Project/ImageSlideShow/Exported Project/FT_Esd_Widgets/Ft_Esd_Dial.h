@@ -0,0 +1,46 @@
+
+#ifndef FT_ESD_DIAL__H
+#define FT_ESD_DIAL__H
+
+#include "Esd_Base.h"
+#include "Esd_Math.h"
+
+/*
+Static dial faces and host drawn needles for Ft_Esd_Gauge and Ft_Esd_Clock.
+CMD_GAUGE and CMD_CLOCK generate the face, ticks and needles into the display list
+on every frame. The face is instead generated with OPT_NOPOINTER or OPT_NOHANDS,
+recorded once into an Esd_DlCache fragment and replayed with CMD_APPEND, while the
+needles are drawn as single lines on top of it.
+*/
+
+// Number of dials that can have their face cached at the same time
+#ifndef FT_ESD_DIAL_DLCACHE_COUNT
+#define FT_ESD_DIAL_DLCACHE_COUNT 8
+#endif
+
+// Everything the face depends on
+typedef struct
+{
+	Esd_Rect16 Scissor;
+	int16_t X, Y, R;
+	uint16_t Options;
+	uint16_t Major, Minor;
+	uint16_t Range;
+	uint32_t BgColor;
+	uint32_t Color;
+	uint8_t Alpha;
+	uint8_t Tag;
+} Ft_Esd_DialKey;
+
+// Replays the recorded face of the widget and returns false, or returns true when the face must be rendered by the caller
+bool Ft_Esd_Dial_BeginFace(void *widget, const Ft_Esd_DialKey *key);
+
+// Call after rendering the face when Ft_Esd_Dial_BeginFace returned true
+void Ft_Esd_Dial_EndFace(void *widget);
+
+// Draws a needle from the center, angle is clockwise from 12 o'clock
+void Ft_Esd_Dial_Needle(int16_t x, int16_t y, uint16_t angle, int32_t length, int32_t width, esd_argb32_t color);
+
+#endif /* #ifndef FT_ESD_DIAL__H */
+
+/* end of file */
@@ -59,67 +59,37 @@ void Ft_Esd_Elements_PanelRaised(ft_argb32_t color, ft_int16_t x, ft_int16_t y,
 
 void Ft_Esd_Elements_CircleSunken(ft_argb32_t color, ft_int16_t x, ft_int16_t y, ft_int16_t radius)
 {
-	Ft_Gpu_Hal_Context_t *phost = Ft_Esd_Host;
 #if 0
+	Ft_Gpu_Hal_Context_t *phost = Ft_Esd_Host;
 	// Abuse CMD_CLOCK
 	Ft_Gpu_CoCmd_BgColor(phost, color);
 	Ft_Gpu_CoCmd_Clock(phost, x, y, radius, OPT_NOTICKS | OPT_NOHANDS, 0, 0, 0, 0);
 #else
+	// Shades first, a batch window groups them with those of neighbouring circles
 	ft_int32_t ps = ((ft_int32_t)radius << 4);
-	ft_int32_t x2 = ((ft_int32_t)x << 2);
-	ft_int32_t y2 = ((ft_int32_t)y << 2);
-	EVE_CoDl_begin(phost, FTPOINTS);
-	EVE_CoDl_vertexFormat(phost, 2);
-	Ft_Esd_Dl_POINT_SIZE(ps);
-	Ft_Esd_Dl_COLOR_A(color >> 24);
-	Ft_Esd_Dl_COLOR_RGB(0xFFFFFF);
-	EVE_CoDl_vertex2f(phost, x2 + 2, y2 + 2);
-	Ft_Esd_Dl_COLOR_RGB(0x000000);
-	EVE_CoDl_vertex2f(phost, x2 - 3, y2 - 3);
-	Ft_Esd_Dl_COLOR_RGB(color);
-	EVE_CoDl_vertex2f(phost, x2, y2);
-#if FT_ESD_DL_END
-	EVE_CoDl_end(phost);
-#endif
+	ft_int32_t x4 = ((ft_int32_t)x << 4);
+	ft_int32_t y4 = ((ft_int32_t)y << 4);
+	ft_argb32_t shade = color & 0xFF000000UL;
+	Esd_Render_PointF(x4 + 8, y4 + 8, ps, shade | 0xFFFFFF);
+	Esd_Render_PointF(x4 - 12, y4 - 12, ps, shade);
+	Esd_Render_PointF(x4, y4, ps, color);
 #endif
 }
 
 void Ft_Esd_Elements_CircleRaised(ft_argb32_t color, ft_int16_t x, ft_int16_t y, ft_int16_t radius)
 {
-	Ft_Gpu_Hal_Context_t *phost = Ft_Esd_Host;
 	ft_int32_t ps = ((ft_int32_t)radius << 4);
-	ft_int32_t x2 = ((ft_int32_t)x << 2);
-	ft_int32_t y2 = ((ft_int32_t)y << 2);
-	EVE_CoDl_begin(phost, FTPOINTS);
-	EVE_CoDl_vertexFormat(phost, 2);
-	Ft_Esd_Dl_POINT_SIZE(ps);
-	Ft_Esd_Dl_COLOR_A(color >> 24);
-	Ft_Esd_Dl_COLOR_RGB(0x000000);
-	EVE_CoDl_vertex2f(phost, x2 + 4, y2 + 4);
-	Ft_Esd_Dl_COLOR_RGB(0xFFFFFF);
-	EVE_CoDl_vertex2f(phost, x2 - 2, y2 - 2);
-	Ft_Esd_Dl_COLOR_RGB(color);
-	EVE_CoDl_vertex2f(phost, x2, y2);
-#if FT_ESD_DL_END
-	EVE_CoDl_end(phost);
-#endif
+	ft_int32_t x4 = ((ft_int32_t)x << 4);
+	ft_int32_t y4 = ((ft_int32_t)y << 4);
+	ft_argb32_t shade = color & 0xFF000000UL;
+	Esd_Render_PointF(x4 + 16, y4 + 16, ps, shade);
+	Esd_Render_PointF(x4 - 8, y4 - 8, ps, shade | 0xFFFFFF);
+	Esd_Render_PointF(x4, y4, ps, color);
 }
 
 void Ft_Esd_Elements_CircleFlat(ft_rgb32_t color, ft_int16_t x, ft_int16_t y, ft_int16_t radius)
 {
-	Ft_Gpu_Hal_Context_t *phost = Ft_Esd_Host;
-	ft_int32_t ps = ((ft_int32_t)radius << 4);
-	ft_int32_t x2 = ((ft_int32_t)x << 2);
-	ft_int32_t y2 = ((ft_int32_t)y << 2);
-	EVE_CoDl_begin(phost, FTPOINTS);
-	EVE_CoDl_vertexFormat(phost, 2);
-	Ft_Esd_Dl_POINT_SIZE(ps);
-	Ft_Esd_Dl_COLOR_A(color >> 24);
-	Ft_Esd_Dl_COLOR_RGB(color);
-	EVE_CoDl_vertex2f(phost, x2, y2);
-#if FT_ESD_DL_END
-	EVE_CoDl_end(phost);
-#endif
+	Esd_Render_PointF((ft_int32_t)x << 4, (ft_int32_t)y << 4, (ft_int32_t)radius << 4, color);
 }
 
 void Ft_Esd_Elements_Panel(Ft_Esd_Theme *theme, ft_int16_t x, ft_int16_t y, ft_int16_t width, ft_int16_t height, ft_int16_t radius, ft_bool_t raised)
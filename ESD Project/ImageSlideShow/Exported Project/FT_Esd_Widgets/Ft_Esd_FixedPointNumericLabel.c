@@ -1,5 +1,6 @@
 #include "Ft_Esd.h"
 #include "Ft_Esd_FixedPointNumericLabel.h"
+#include "Esd_Format.h"
 
 #define MAX_Digit (11) // when negative, 10 digits only
 #define Size_Buffer (MAX_Digit + 3) // null char required, .
@@ -63,28 +64,23 @@ void Ft_Esd_FixedPointNumericLabel_UpdateNumberString(Ft_Esd_FixedPointNumericLa
 		context->NDigit = 0;
 	}
 
-#pragma warning(push)
-#pragma warning(disable : 4996)
 	ft_float_t value = context->Value(owner);
 	if (context->EnablePadding(owner) && context->NDigit > 0)
 	{
 		if (context->IsZeroLeading(owner))
-		{ //  Zero Padding
-			// eve_printf_debug("%0*.*f", context->NDigit, context->NDigitAfterDot, value);
-			sprintf(context->Number, "%0*.*f", context->NDigit, context->NDigitAfterDot, value);
+		{ //  Zero Padding, same as "%0*.*f"
+			Esd_FormatFixed(context->Number, Size_Buffer, value, context->NDigit, context->NDigitAfterDot, ESD_FORMAT_ZERO);
 		}
 		else
-		{ // Space Padding
-			// eve_printf_debug("% *.*f", context->NDigit, context->NDigitAfterDot, value);
-			sprintf(context->Number, "% *.*f", context->NDigit, context->NDigitAfterDot, value);
+		{ // Space Padding, same as "% *.*f"
+			Esd_FormatFixed(context->Number, Size_Buffer, value, context->NDigit, context->NDigitAfterDot, ESD_FORMAT_SPACE);
 		}
 	}
 	else
 	{
-		// eve_printf_debug("% *.*f\n", context->NDigit, context->NDigitAfterDot, value);
-		sprintf(context->Number, "% *.*f", context->NDigit, context->NDigitAfterDot, value);
+		// Same as "% *.*f"
+		Esd_FormatFixed(context->Number, Size_Buffer, value, context->NDigit, context->NDigitAfterDot, ESD_FORMAT_SPACE);
 	}
-#pragma warning(pop)
 }
 
 ESD_METHOD(Ft_Esd_FixedPointNumericLabel_Start_Signal, Context = Ft_Esd_FixedPointNumericLabel)
@@ -10,6 +10,8 @@ Comment :
 Introduction:
 This widget draws a gauge.
 It internally calls co-processor command CMD_GAUGE.
+The dial is generated without pointer and replayed from a display list cache,
+the pointer is drawn over it as a single line.
 */
 
 #include "Ft_Esd_Gauge.h"
@@ -17,6 +19,9 @@ It internally calls co-processor command CMD_GAUGE.
 #include "Esd_Context.h"
 #include "Ft_Esd_CoCmd.h"
 #include "Ft_Esd_Dl.h"
+#include "Ft_Esd_Dial.h"
+
+#include <string.h>
 
 ESD_CORE_EXPORT void Esd_Noop(void *context);
 Ft_Esd_Theme * Ft_Esd_Gauge_Theme__Default(void *context) { return Ft_Esd_Theme_GetCurrent(); }
@@ -132,7 +137,32 @@ void Ft_Esd_Gauge_Render(Ft_Esd_Gauge *context)
 	ft_uint16_t minor = context->Minor(owner);
 	ft_uint16_t val = context->Val(owner);
 	ft_uint16_t range = context->Range(owner);
-	Ft_Gpu_CoCmd_Gauge(phost_1, x, y, r, options, major, minor, val, range);
+	Ft_Esd_DialKey key;
+	memset(&key, 0, sizeof(key));
+	key.Scissor = Ft_Esd_Dl_Scissor_Get();
+	key.X = x;
+	key.Y = y;
+	key.R = r;
+	key.Options = (uint16_t)options;
+	key.Major = major;
+	key.Minor = minor;
+	key.Range = range;
+	key.BgColor = c_1;
+	key.Color = c_2;
+	key.Alpha = alpha;
+	if (Ft_Esd_Dial_BeginFace(context, &key))
+	{
+		// The face does not depend on the value
+		Ft_Gpu_CoCmd_Gauge(phost_1, x, y, r, options | OPT_NOPOINTER, major, minor, 0, range);
+		Ft_Esd_Dial_EndFace(context);
+	}
+	if (if_2 && range)
+	{
+		// Sweeps 270 degrees clockwise from the bottom left, as CMD_GAUGE does
+		ft_uint16_t v = val > range ? range : val;
+		uint16_t angle = (uint16_t)(ESD_ANGLE_DEG(225) + (uint16_t)(((uint32_t)v * ESD_ANGLE_DEG(270)) / range));
+		Ft_Esd_Dial_Needle(x, y, angle, (r * 13) >> 4, max(r >> 4, 2), ((ft_argb32_t)alpha << 24) | (c_2 & 0xFFFFFFUL));
+	}
 	Ft_Esd_Widget_Render((Ft_Esd_Widget *)context); 
 }
 
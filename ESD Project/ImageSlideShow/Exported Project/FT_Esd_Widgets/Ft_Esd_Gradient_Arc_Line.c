@@ -3,10 +3,10 @@
 #include "Ft_Esd.h"
 #include "Ft_Esd_Gradient_Arc_Line.h"
 
-#include <math.h>
+#include "Esd_Math.h"
 
 extern void Ft_Esd_CircleLine_Draw_Point(int x, int y, int radius);
-extern void Ft_Esd_ArcLine_GetTanglePoint(float angle, float radius, float *x, float *y, ft_bool_t isClockwise);
+extern void Ft_Esd_ArcLine_GetTanglePointInt(int angle, int radius, int *x, int *y, ft_bool_t isClockwise);
 
 typedef enum
 {
@@ -90,7 +90,7 @@ SectorName IndicateSectorClock(int angleValue)
 void Ft_Esd_DrawGradientSector(SectorName sectorID, ft_bool_t isClockwise, int *pSecValue, SectorType secType, int RBig, int CX, int CY)
 {
 	EVE_HalContext *phost = Esd_GetHost();
-	float nX, nY;
+	int nX, nY;
 	int angleDraw;
 
 	if (pSecValue[sectorID] >= 90) // no need to draw
@@ -145,8 +145,8 @@ void Ft_Esd_DrawGradientSector(SectorName sectorID, ft_bool_t isClockwise, int *
 		}
 		nX = CX, nY = CY;
 		EVE_CoCmd_dl(phost, VERTEX2F(CX, CY));
-		Ft_Esd_ArcLine_GetTanglePoint(angleDraw, RBig, &nX, &nY, isClockwise);
-		EVE_CoCmd_dl(phost, VERTEX2F((int)nX, (int)nY));
+		Ft_Esd_ArcLine_GetTanglePointInt(angleDraw, RBig, &nX, &nY, isClockwise);
+		EVE_CoCmd_dl(phost, VERTEX2F(nX, nY));
 		break;
 	}
 	case BOTTOM_RIGHT: {
@@ -163,8 +163,8 @@ void Ft_Esd_DrawGradientSector(SectorName sectorID, ft_bool_t isClockwise, int *
 		}
 		nX = CX, nY = CY;
 		EVE_CoCmd_dl(phost, VERTEX2F(CX, CY));
-		Ft_Esd_ArcLine_GetTanglePoint(angleDraw, RBig, &nX, &nY, isClockwise);
-		EVE_CoCmd_dl(phost, VERTEX2F((int)nX, (int)nY));
+		Ft_Esd_ArcLine_GetTanglePointInt(angleDraw, RBig, &nX, &nY, isClockwise);
+		EVE_CoCmd_dl(phost, VERTEX2F(nX, nY));
 		break;
 	}
 	case BOTTOM_LEFT: {
@@ -181,8 +181,8 @@ void Ft_Esd_DrawGradientSector(SectorName sectorID, ft_bool_t isClockwise, int *
 		}
 		nX = CX, nY = CY;
 		EVE_CoCmd_dl(phost, VERTEX2F(CX, CY));
-		Ft_Esd_ArcLine_GetTanglePoint(angleDraw, RBig, &nX, &nY, isClockwise);
-		EVE_CoCmd_dl(phost, VERTEX2F((int)nX, (int)nY));
+		Ft_Esd_ArcLine_GetTanglePointInt(angleDraw, RBig, &nX, &nY, isClockwise);
+		EVE_CoCmd_dl(phost, VERTEX2F(nX, nY));
 		break;
 	}
 	case TOP_LEFT: {
@@ -199,8 +199,8 @@ void Ft_Esd_DrawGradientSector(SectorName sectorID, ft_bool_t isClockwise, int *
 		}
 		nX = CX, nY = CY;
 		EVE_CoCmd_dl(phost, VERTEX2F(CX, CY));
-		Ft_Esd_ArcLine_GetTanglePoint(angleDraw, RBig, &nX, &nY, isClockwise);
-		EVE_CoCmd_dl(phost, VERTEX2F((int)nX, (int)nY));
+		Ft_Esd_ArcLine_GetTanglePointInt(angleDraw, RBig, &nX, &nY, isClockwise);
+		EVE_CoCmd_dl(phost, VERTEX2F(nX, nY));
 		break;
 	}
 	default: {
@@ -236,7 +236,7 @@ void Ft_Esd_GArcLine_DrawArc(Ft_Esd_Gradient_Arc_Line *context, ft_bool_t isCloc
 	if (sameSector)
 	{
 		// printf("Special case same sector draw!\n");
-		float nX = CX, nY = CY;
+		int nX = CX, nY = CY;
 
 		if (remainAngle <= 270)
 		{
@@ -249,53 +249,53 @@ void Ft_Esd_GArcLine_DrawArc(Ft_Esd_Gradient_Arc_Line *context, ft_bool_t isCloc
 			case TOP_RIGHT: {
 				EVE_CoCmd_dl(phost, BEGIN(EDGE_STRIP_A));
 				EVE_CoCmd_dl(phost, VERTEX2F(CX-10, CY));
-				Ft_Esd_ArcLine_GetTanglePoint(startAngle - 90, RBig, &nX, &nY, isClockwise);
-				EVE_CoCmd_dl(phost, VERTEX2F((int)nX, (int)nY));
+				Ft_Esd_ArcLine_GetTanglePointInt(startAngle - 90, RBig, &nX, &nY, isClockwise);
+				EVE_CoCmd_dl(phost, VERTEX2F(nX, nY));
 
 				EVE_CoCmd_dl(phost, BEGIN(EDGE_STRIP_R));
 				EVE_CoCmd_dl(phost, VERTEX2F(CX, CY));
 				nX = CX, nY = CY;
-				Ft_Esd_ArcLine_GetTanglePoint(endAngle - 90, RBig, &nX, &nY, isClockwise);
-				EVE_CoCmd_dl(phost, VERTEX2F((int)nX, (int)nY));
+				Ft_Esd_ArcLine_GetTanglePointInt(endAngle - 90, RBig, &nX, &nY, isClockwise);
+				EVE_CoCmd_dl(phost, VERTEX2F(nX, nY));
 				break;
 			}
 			case BOTTOM_RIGHT: {
 				EVE_CoCmd_dl(phost, BEGIN(EDGE_STRIP_R));
 				EVE_CoCmd_dl(phost, VERTEX2F(CX, CY));
-				Ft_Esd_ArcLine_GetTanglePoint(startAngle - 90, RBig, &nX, &nY, isClockwise);
-				EVE_CoCmd_dl(phost, VERTEX2F((int)nX, (int)nY));
+				Ft_Esd_ArcLine_GetTanglePointInt(startAngle - 90, RBig, &nX, &nY, isClockwise);
+				EVE_CoCmd_dl(phost, VERTEX2F(nX, nY));
 
 				EVE_CoCmd_dl(phost, BEGIN(EDGE_STRIP_B));
 				EVE_CoCmd_dl(phost, VERTEX2F(CX-10, CY));
 				nX = CX, nY = CY;
-				Ft_Esd_ArcLine_GetTanglePoint(endAngle - 90, RBig, &nX, &nY, isClockwise);
-				EVE_CoCmd_dl(phost, VERTEX2F((int)nX, (int)nY));
+				Ft_Esd_ArcLine_GetTanglePointInt(endAngle - 90, RBig, &nX, &nY, isClockwise);
+				EVE_CoCmd_dl(phost, VERTEX2F(nX, nY));
 				break;
 			}
 			case BOTTOM_LEFT: {
 				EVE_CoCmd_dl(phost, BEGIN(EDGE_STRIP_L));
 				EVE_CoCmd_dl(phost, VERTEX2F(CX, CY));
-				Ft_Esd_ArcLine_GetTanglePoint(endAngle - 90, RBig, &nX, &nY, isClockwise);
-				EVE_CoCmd_dl(phost, VERTEX2F((int)nX, (int)nY));
+				Ft_Esd_ArcLine_GetTanglePointInt(endAngle - 90, RBig, &nX, &nY, isClockwise);
+				EVE_CoCmd_dl(phost, VERTEX2F(nX, nY));
 
 				EVE_CoCmd_dl(phost, BEGIN(EDGE_STRIP_B));
 				EVE_CoCmd_dl(phost, VERTEX2F(CX-10, CY));
 				nX = CX, nY = CY;
-				Ft_Esd_ArcLine_GetTanglePoint(startAngle - 90, RBig, &nX, &nY, isClockwise);
-				EVE_CoCmd_dl(phost, VERTEX2F((int)nX, (int)nY));
+				Ft_Esd_ArcLine_GetTanglePointInt(startAngle - 90, RBig, &nX, &nY, isClockwise);
+				EVE_CoCmd_dl(phost, VERTEX2F(nX, nY));
 				break;
 			}
 			case TOP_LEFT: {
 				EVE_CoCmd_dl(phost, BEGIN(EDGE_STRIP_L));
 				EVE_CoCmd_dl(phost, VERTEX2F(CX, CY));
-				Ft_Esd_ArcLine_GetTanglePoint(startAngle - 90, RBig, &nX, &nY, isClockwise);
-				EVE_CoCmd_dl(phost, VERTEX2F((int)nX, (int)nY));
+				Ft_Esd_ArcLine_GetTanglePointInt(startAngle - 90, RBig, &nX, &nY, isClockwise);
+				EVE_CoCmd_dl(phost, VERTEX2F(nX, nY));
 
 				EVE_CoCmd_dl(phost, BEGIN(EDGE_STRIP_A));
 				EVE_CoCmd_dl(phost, VERTEX2F(CX-10, CY));
 				nX = CX, nY = CY;
-				Ft_Esd_ArcLine_GetTanglePoint(endAngle - 90, RBig, &nX, &nY, isClockwise);
-				EVE_CoCmd_dl(phost, VERTEX2F((int)nX, (int)nY));
+				Ft_Esd_ArcLine_GetTanglePointInt(endAngle - 90, RBig, &nX, &nY, isClockwise);
+				EVE_CoCmd_dl(phost, VERTEX2F(nX, nY));
 				break;
 			}
 
@@ -331,16 +331,16 @@ void Ft_Esd_GArcLine_DrawArc(Ft_Esd_Gradient_Arc_Line *context, ft_bool_t isCloc
 				EVE_CoCmd_dl(phost, BEGIN(EDGE_STRIP_R));
 				EVE_CoCmd_dl(phost, VERTEX2F(CX, CY)); // CENTER
 				nX = CX, nY = CY;
-				Ft_Esd_ArcLine_GetTanglePoint(endAngle - 90, RBig, &nX, &nY, isClockwise);
-				EVE_CoCmd_dl(phost, VERTEX2F((int)nX, (int)nY)); // Bottom angle
+				Ft_Esd_ArcLine_GetTanglePointInt(endAngle - 90, RBig, &nX, &nY, isClockwise);
+				EVE_CoCmd_dl(phost, VERTEX2F(nX, nY)); // Bottom angle
 
 				EVE_CoCmd_dl(phost, STENCIL_FUNC(EQUAL, 10, 255));
 				EVE_CoCmd_dl(phost, STENCIL_OP(ZERO, INCR));
 				EVE_CoCmd_dl(phost, BEGIN(EDGE_STRIP_A));
 				nX = CX, nY = CY;
 				EVE_CoCmd_dl(phost, VERTEX2F(CX, CY)); // Center
-				Ft_Esd_ArcLine_GetTanglePoint(startAngle - 90, RBig, &nX, &nY, isClockwise);
-				EVE_CoCmd_dl(phost, VERTEX2F((int)nX, (int)nY)); // Upper angle
+				Ft_Esd_ArcLine_GetTanglePointInt(startAngle - 90, RBig, &nX, &nY, isClockwise);
+				EVE_CoCmd_dl(phost, VERTEX2F(nX, nY)); // Upper angle
 
 				// This one to reset the outsize of cut part to zero
 				// Because the outsize of cutting part have a difference value in stencil buffer
@@ -358,16 +358,16 @@ void Ft_Esd_GArcLine_DrawArc(Ft_Esd_Gradient_Arc_Line *context, ft_bool_t isCloc
 				EVE_CoCmd_dl(phost, BEGIN(EDGE_STRIP_R));
 				EVE_CoCmd_dl(phost, VERTEX2F(CX, CY)); // CENTER
 				nX = CX, nY = CY;
-				Ft_Esd_ArcLine_GetTanglePoint(startAngle - 90, RBig, &nX, &nY, isClockwise);
-				EVE_CoCmd_dl(phost, VERTEX2F((int)nX, (int)nY)); // Bottom angle
+				Ft_Esd_ArcLine_GetTanglePointInt(startAngle - 90, RBig, &nX, &nY, isClockwise);
+				EVE_CoCmd_dl(phost, VERTEX2F(nX, nY)); // Bottom angle
 
 				EVE_CoCmd_dl(phost, STENCIL_FUNC(EQUAL, 10, 255));
 				EVE_CoCmd_dl(phost, STENCIL_OP(ZERO, INCR));
 				EVE_CoCmd_dl(phost, BEGIN(EDGE_STRIP_B));
 				nX = CX, nY = CY;
 				EVE_CoCmd_dl(phost, VERTEX2F(CX, CY)); // Center
-				Ft_Esd_ArcLine_GetTanglePoint(endAngle - 90, RBig, &nX, &nY, isClockwise);
-				EVE_CoCmd_dl(phost, VERTEX2F((int)nX, (int)nY)); // Upper angle
+				Ft_Esd_ArcLine_GetTanglePointInt(endAngle - 90, RBig, &nX, &nY, isClockwise);
+				EVE_CoCmd_dl(phost, VERTEX2F(nX, nY)); // Upper angle
 
 				// This one to reset the outsize of cut part to zero
 				// Because the outsize of cutting part have a difference value in stencil buffer
@@ -385,16 +385,16 @@ void Ft_Esd_GArcLine_DrawArc(Ft_Esd_Gradient_Arc_Line *context, ft_bool_t isCloc
 				EVE_CoCmd_dl(phost, BEGIN(EDGE_STRIP_L));
 				EVE_CoCmd_dl(phost, VERTEX2F(CX, CY)); // CENTER
 				nX = CX, nY = CY;
-				Ft_Esd_ArcLine_GetTanglePoint(endAngle - 90, RBig, &nX, &nY, isClockwise);
-				EVE_CoCmd_dl(phost, VERTEX2F((int)nX, (int)nY)); // Bottom angle
+				Ft_Esd_ArcLine_GetTanglePointInt(endAngle - 90, RBig, &nX, &nY, isClockwise);
+				EVE_CoCmd_dl(phost, VERTEX2F(nX, nY)); // Bottom angle
 
 				EVE_CoCmd_dl(phost, STENCIL_FUNC(EQUAL, 10, 255));
 				EVE_CoCmd_dl(phost, STENCIL_OP(ZERO, INCR));
 				EVE_CoCmd_dl(phost, BEGIN(EDGE_STRIP_B));
 				nX = CX, nY = CY;
 				EVE_CoCmd_dl(phost, VERTEX2F(CX, CY)); // Center
-				Ft_Esd_ArcLine_GetTanglePoint(startAngle - 90, RBig, &nX, &nY, isClockwise);
-				EVE_CoCmd_dl(phost, VERTEX2F((int)nX, (int)nY)); // Upper angle
+				Ft_Esd_ArcLine_GetTanglePointInt(startAngle - 90, RBig, &nX, &nY, isClockwise);
+				EVE_CoCmd_dl(phost, VERTEX2F(nX, nY)); // Upper angle
 
 				// This one to reset the outsize of cut part to zero
 				// Because the outsize of cutting part have a difference value in stencil buffer
@@ -412,16 +412,16 @@ void Ft_Esd_GArcLine_DrawArc(Ft_Esd_Gradient_Arc_Line *context, ft_bool_t isCloc
 				EVE_CoCmd_dl(phost, BEGIN(EDGE_STRIP_L));
 				EVE_CoCmd_dl(phost, VERTEX2F(CX, CY)); // CENTER
 				nX = CX, nY = CY;
-				Ft_Esd_ArcLine_GetTanglePoint(startAngle - 90, RBig, &nX, &nY, isClockwise);
-				EVE_CoCmd_dl(phost, VERTEX2F((int)nX, (int)nY)); // Bottom angle
+				Ft_Esd_ArcLine_GetTanglePointInt(startAngle - 90, RBig, &nX, &nY, isClockwise);
+				EVE_CoCmd_dl(phost, VERTEX2F(nX, nY)); // Bottom angle
 
 				EVE_CoCmd_dl(phost, STENCIL_FUNC(EQUAL, 10, 255));
 				EVE_CoCmd_dl(phost, STENCIL_OP(ZERO, INCR));
 				EVE_CoCmd_dl(phost, BEGIN(EDGE_STRIP_A));
 				nX = CX, nY = CY;
 				EVE_CoCmd_dl(phost, VERTEX2F(CX, CY)); // Center
-				Ft_Esd_ArcLine_GetTanglePoint(endAngle - 90, RBig, &nX, &nY, isClockwise);
-				EVE_CoCmd_dl(phost, VERTEX2F((int)nX, (int)nY)); // Upper angle
+				Ft_Esd_ArcLine_GetTanglePointInt(endAngle - 90, RBig, &nX, &nY, isClockwise);
+				EVE_CoCmd_dl(phost, VERTEX2F(nX, nY)); // Upper angle
 
 				// This one to reset the outsize of cut part to zero
 				// Because the outsize of cutting part have a difference value in stencil buffer
@@ -485,11 +485,11 @@ void Ft_Esd_GArcLine_DrawArc(Ft_Esd_Gradient_Arc_Line *context, ft_bool_t isCloc
 		EVE_CoCmd_dl(phost, STENCIL_FUNC(EQUAL, 0, 0));
 		EVE_CoCmd_dl(phost, STENCIL_OP(KEEP, ZERO));
 		EVE_CoCmd_dl(phost, BEGIN(POINTS));
-		float endPointRadius = (RBig - RSmall) / 2;
-		float _x = CX, _y = CY;
-		EVE_CoCmd_dl(phost, POINT_SIZE((int)endPointRadius));
-		Ft_Esd_ArcLine_GetTanglePoint(endAngle - 90, RBig - endPointRadius, &_x, &_y, isClockwise);
-		EVE_CoCmd_dl(phost, VERTEX2F((int)_x, (int)_y));
+		int endPointRadius = (RBig - RSmall) / 2;
+		int _x = CX, _y = CY;
+		EVE_CoCmd_dl(phost, POINT_SIZE(endPointRadius));
+		Ft_Esd_ArcLine_GetTanglePointInt(endAngle - 90, RBig - endPointRadius, &_x, &_y, isClockwise);
+		EVE_CoCmd_dl(phost, VERTEX2F(_x, _y));
 	}
 
 	// Draw an start point
@@ -498,11 +498,11 @@ void Ft_Esd_GArcLine_DrawArc(Ft_Esd_Gradient_Arc_Line *context, ft_bool_t isCloc
 		EVE_CoCmd_dl(phost, STENCIL_FUNC(EQUAL, 0, 0));
 		EVE_CoCmd_dl(phost, STENCIL_OP(KEEP, ZERO));
 		EVE_CoCmd_dl(phost, BEGIN(POINTS));
-		float endPointRadius = (RBig - RSmall) / 2;
-		float _x = CX, _y = CY;
-		EVE_CoCmd_dl(phost, POINT_SIZE((int)endPointRadius));
-		Ft_Esd_ArcLine_GetTanglePoint(startAngle - 90, RBig - endPointRadius, &_x, &_y, isClockwise);
-		EVE_CoCmd_dl(phost, VERTEX2F((int)_x, (int)_y));
+		int endPointRadius = (RBig - RSmall) / 2;
+		int _x = CX, _y = CY;
+		EVE_CoCmd_dl(phost, POINT_SIZE(endPointRadius));
+		Ft_Esd_ArcLine_GetTanglePointInt(startAngle - 90, RBig - endPointRadius, &_x, &_y, isClockwise);
+		EVE_CoCmd_dl(phost, VERTEX2F(_x, _y));
 	}
 	// Draw the ring layer
 	// Small ring
@@ -569,14 +569,14 @@ void Ft_Esd_Gradient_Arc_Line_Func(Ft_Esd_Gradient_Arc_Line *context, int x, int
 	// Paint the gradient color for ring
 	EVE_CoCmd_dl(phost, STENCIL_FUNC(EQUAL, 1, 255));
 	EVE_CoCmd_dl(phost, STENCIL_OP(KEEP, KEEP));
-	float GStartX = (float)(context->G_X + (context->G_W / 2));
-	float GStartY = (float)context->G_Y;
-	float GEndX = (float)(context->G_X + (context->G_W / 2));
-	float GEndY = (float)context->G_Y;
+	int GStartX = context->G_X + (context->G_W / 2);
+	int GStartY = context->G_Y;
+	int GEndX = context->G_X + (context->G_W / 2);
+	int GEndY = context->G_Y;
 	int GradientAngle = 0;
-	Ft_Esd_ArcLine_GetTanglePoint((float)GradientAngle, (context->G_W / 2), &GStartX, &GStartY, true);
-	Ft_Esd_ArcLine_GetTanglePoint((float)GradientAngle + (float)180, (context->G_W / 2), &GEndX, &GEndY, true);
-	EVE_CoCmd_gradient(phost, (int)GStartX, (int)GStartY, endColor, (int)GEndX, (int)GEndY, startColor);
+	Ft_Esd_ArcLine_GetTanglePointInt(GradientAngle, (context->G_W / 2), &GStartX, &GStartY, true);
+	Ft_Esd_ArcLine_GetTanglePointInt(GradientAngle + 180, (context->G_W / 2), &GEndX, &GEndY, true);
+	EVE_CoCmd_gradient(phost, GStartX, GStartY, endColor, GEndX, GEndY, startColor);
 	/// EVE_CoCmd_gradient(phost, context->G_X + (context->G_W / 2), context->G_Y, startColor, context->G_X + (context->G_W / 2), context->G_Y + context->G_H, endColor);
 	// Esd_Render_MultiGradient(context->G_X, context->G_Y, context->G_W, context->G_H, startColor, endColor, startColor, endColor);
 	EVE_CoCmd_dl(phost, STENCIL_FUNC(NEVER, 1, 255));
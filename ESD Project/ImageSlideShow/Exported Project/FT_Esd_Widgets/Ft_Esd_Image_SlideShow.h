@@ -58,6 +58,12 @@ typedef struct
 	int Duration;
 	ESD_VARIABLE(Animation, Type = Esd_ImageAnimation, Default = IMAGE_RIGHT_TO_LEFT, Public)
 	int Animation;
+	ESD_VARIABLE(Prefetch, Type = bool, Default = true, Public)
+	bool Prefetch;
+	ESD_VARIABLE(TransitionMs, Type = int, Min = 100, Max = 5000, Default = 800, Public)
+	int TransitionMs;
+	ESD_VARIABLE(SharedClock, Type = bool, Default = true, Public)
+	bool SharedClock;
 	ESD_VARIABLE(VariableTest, Type = int, Default = 0, Private)
 	int VariableTest;
 	ESD_VARIABLE(totalNum, Type = int, Default = 0, Private)
@@ -96,6 +102,14 @@ typedef struct
 	int Variable_9;
 	ESD_VARIABLE(Variable_10, Type = int, Private)
 	int Variable_10;
+	ESD_VARIABLE(TransitionStart, Type = uint32_t, Default = 0, Private)
+	uint32_t TransitionStart;
+	ESD_VARIABLE(TransitionScale, Type = int, Default = 256, Private)
+	int TransitionScale;
+	ESD_VARIABLE(SharedFollowing, Type = bool, Default = false, Private)
+	bool SharedFollowing;
+	ESD_VARIABLE(SharedSlot, Type = uint32_t, Default = 0, Private)
+	uint32_t SharedSlot;
 	Ft_Esd_Timer ESD_Timer;
 	Ft_Esd_Layout_Fixed Fixed_Positioning;
 	Ft_Esd_Image ESD_Image_2;
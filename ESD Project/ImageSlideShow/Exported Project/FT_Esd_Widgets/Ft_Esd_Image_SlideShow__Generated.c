@@ -21,7 +21,6 @@ int Ft_Esd_Image_SlideShow_Array_Input__Default(void *context, size_t *size) { *
 
 static Ft_Esd_BitmapCell Ft_Esd_Image_SlideShow_ESD_Image_2_BitmapCell__Property(void *context);
 static Ft_Esd_BitmapCell Ft_Esd_Image_SlideShow_ESD_Image_BitmapCell__Property(void *context);
-static ft_argb32_t Ft_Esd_Image_SlideShow_ESD_Rectangle_Widget_Color__Property(void *context) { return 0x64636363UL; }
 
 static Ft_Esd_WidgetSlots s_Ft_Esd_Image_SlideShow__Slots = {
 	(void(*)(void *))Ft_Esd_Widget_Initialize,
@@ -101,7 +100,7 @@ void Ft_Esd_Image_SlideShow__ESD_Rectangle_Widget__Initializer(Ft_Esd_Image_Slid
 	object->Widget.LocalY = 0;
 	object->Widget.LocalWidth = 400;
 	object->Widget.LocalHeight = 300;
-	object->Color = Ft_Esd_Image_SlideShow_ESD_Rectangle_Widget_Color__Property;
+	ESD_INPUT_CONSTANT(object, Color, 0x64636363UL);
 	Ft_Esd_Widget_InsertBottom((Ft_Esd_Widget *)object, (Ft_Esd_Widget *)context);
 }
 
@@ -120,6 +119,9 @@ void Ft_Esd_Image_SlideShow__Initializer(Ft_Esd_Image_SlideShow *context)
 	context->Speed = 1L;
 	context->Duration = 15L;
 	context->Animation = IMAGE_RIGHT_TO_LEFT;
+	context->Prefetch = 1;
+	context->TransitionMs = 800L;
+	context->SharedClock = 1;
 	context->VariableTest = 0L;
 	context->totalNum = 0L;
 	context->Array_Input = Ft_Esd_Image_SlideShow_Array_Input__Default;
@@ -139,6 +141,10 @@ void Ft_Esd_Image_SlideShow__Initializer(Ft_Esd_Image_SlideShow *context)
 	context->Variable_7 = 0L;
 	context->Variable_9 = 0L;
 	context->Variable_10 = 0L;
+	context->TransitionStart = 0UL;
+	context->TransitionScale = 256L;
+	context->SharedFollowing = 0;
+	context->SharedSlot = 0UL;
 	Ft_Esd_Image_SlideShow__ESD_Timer__Initializer(context);
 	Ft_Esd_Image_SlideShow__Fixed_Positioning__Initializer(context);
 	Ft_Esd_Image_SlideShow__ESD_Image_2__Initializer(context);
@@ -151,6 +157,7 @@ ESD_CORE_EXPORT Esd_Rect16 Esd_Scissor_Set(Esd_Rect16);
 
 static esd_argb32_t Ft_Esd_Image_SlideShow_Local_Method(Ft_Esd_Image_SlideShow *context, int a, int r, int g, int b);
 static esd_argb32_t Ft_Esd_Image_SlideShow_Local_Method_1(Ft_Esd_Image_SlideShow *context, int a, int r, int g, int b);
+static int Ft_Esd_Image_SlideShow_Transition_Progress(Ft_Esd_Image_SlideShow *context);
 
 void Ft_Esd_Image_SlideShow_Update__Builtin(Ft_Esd_Image_SlideShow *context)
 {
@@ -160,6 +167,32 @@ void Ft_Esd_Image_SlideShow_Update__Builtin(Ft_Esd_Image_SlideShow *context)
 	Esd_BitmapCell* ptrAry = context->Array_Input(context, &sizeAry);
 	int update_variable = sizeAry;
 	context->totalNum = update_variable;
+	uint32_t shared_period = (uint32_t)context->Duration * 1000UL;
+	bool if_shared = context->SharedClock && Esd_IsSharedClockSynced() && sizeAry > 0 && shared_period;
+	bool shared_fire = false;
+	if (if_shared != context->SharedFollowing)
+	{
+		// The own timer only runs while there is no clock shared with the other panels
+		context->SharedFollowing = if_shared;
+		context->SharedSlot = 0UL;
+		if (if_shared)
+			Ft_Esd_Timer_Halt(&context->ESD_Timer);
+		else
+			Ft_Esd_Timer_Run(&context->ESD_Timer);
+	}
+	if (if_shared)
+	{
+		// Slides change on the grid of Duration of the shared time, and every panel shows image
+		// slot % size, so panels started at different times show the same one
+		uint32_t shared_slot = Esd_GetSharedMillis() / shared_period;
+		if (shared_slot != context->SharedSlot)
+		{
+			context->SharedSlot = shared_slot;
+			context->Variable_2 = (int)(shared_slot % sizeAry);
+			context->Variable_3 = context->Variable_2;
+			shared_fire = true;
+		}
+	}
 	int 	arrayIndex_1 = context->Variable_3;
 	if(arrayIndex_1<0)  arrayIndex_1=0;
 	size_t sizeAry_1 = 0;
@@ -174,16 +207,33 @@ void Ft_Esd_Image_SlideShow_Update__Builtin(Ft_Esd_Image_SlideShow *context)
  	context->BitmapVar = update_variable_1;
 	Esd_BitmapCell update_variable_2 = context->Bitmap;
 	context->Variable_4 = update_variable_2;
+	bool if_prefetch = context->Prefetch && !context->Variable_6;
+	if (if_prefetch)
+	{
+		// Keep the image shown after the next timer interval resident in RAM_G,
+		// loading it while the current image is displayed rather than on the transition
+		Esd_BitmapCell_Persist(context->BitmapVar);
+	}
 	int left = context->Duration;
 	int right = 1000L;
 	int update_variable_3 = left * right;
 	context->ESD_Timer.TimeoutMs = update_variable_3;
-	Ft_Esd_Timer_Update(&context->ESD_Timer);
+	if (shared_fire)
+	{
+		Esd_Invalidate();
+		Ft_Esd_Image_SlideShow_ESD_Timer_Fired__Signal(context);
+		// Measured from the start of the slot, a panel that is a frame late catches up on the same progress
+		context->TransitionStart = Esd_GetMillis() - (Esd_GetSharedMillis() % shared_period);
+	}
+	else if (!if_shared)
+	{
+		Ft_Esd_Timer_Update(&context->ESD_Timer);
+	}
 	bool update_variable_4 = context->Variable_6;
 	Ft_Esd_Widget_SetActive((Ft_Esd_Widget *)&context->ESD_Image_2, update_variable_4);
-	ft_int16_t update_variable_5 = context->Widget.GlobalWidth;
+	ft_int16_t update_variable_5 = (context->Widget.GlobalWidth * context->TransitionScale) >> 8;
 	Ft_Esd_Widget_SetWidth((Ft_Esd_Widget *)&context->ESD_Image_2, update_variable_5);
-	ft_int16_t update_variable_6 = context->Widget.GlobalHeight;
+	ft_int16_t update_variable_6 = (context->Widget.GlobalHeight * context->TransitionScale) >> 8;
 	Ft_Esd_Widget_SetHeight((Ft_Esd_Widget *)&context->ESD_Image_2, update_variable_6);
 	uint8_t update_variable_7 = context->Scaling;
 	context->ESD_Image_2.Scaling = update_variable_7;
@@ -462,6 +512,65 @@ void Ft_Esd_Image_SlideShow_Update(Ft_Esd_Image_SlideShow *context)
 		}
 		case 6L:
 		{
+			// Incoming image blended over the resident one with COLOR_A only
+			int progress = Ft_Esd_Image_SlideShow_Transition_Progress(context);
+			Ft_Esd_Widget_SetX((Ft_Esd_Widget *)&context->ESD_Image_2, 0);
+			Ft_Esd_Widget_SetY((Ft_Esd_Widget *)&context->ESD_Image_2, 0);
+			context->TransitionScale = 256L;
+			if (progress < 256)
+			{
+				context->Variable_6 = 1;
+				context->ESD_Image_2.Color = Ft_Esd_Image_SlideShow_Local_Method(context, progress, 255, 255, 255);
+			}
+			else
+			{
+				context->Variable_5 = context->Variable_4;
+				context->Variable_6 = 0;
+			}
+			break;
+		}
+		case 7L:
+		{
+			// Incoming image pushes the resident one out to the left, both only move their vertices
+			int progress = Ft_Esd_Image_SlideShow_Transition_Progress(context);
+			int offset = (context->Widget.GlobalWidth * progress) >> 8;
+			context->ESD_Image_2.Color = 0xffffffffUL;
+			context->TransitionScale = 256L;
+			Ft_Esd_Widget_SetY((Ft_Esd_Widget *)&context->ESD_Image_2, 0);
+			if (progress < 256)
+			{
+				context->Variable_6 = 1;
+				Ft_Esd_Widget_SetX((Ft_Esd_Widget *)&context->ESD_Image_2, context->Widget.GlobalWidth - offset);
+				Ft_Esd_Widget_SetX((Ft_Esd_Widget *)&context->ESD_Image, -offset);
+			}
+			else
+			{
+				context->Variable_5 = context->Variable_4;
+				context->Variable_6 = 0;
+				Ft_Esd_Widget_SetX((Ft_Esd_Widget *)&context->ESD_Image, 0);
+			}
+			break;
+		}
+		case 8L:
+		{
+			// Incoming image grows from the centre through BITMAP_TRANSFORM and fades in
+			int progress = Ft_Esd_Image_SlideShow_Transition_Progress(context);
+			if (progress < 256)
+			{
+				context->Variable_6 = 1;
+				context->TransitionScale = progress;
+				Ft_Esd_Widget_SetX((Ft_Esd_Widget *)&context->ESD_Image_2, (context->Widget.GlobalWidth * (256 - progress)) >> 9);
+				Ft_Esd_Widget_SetY((Ft_Esd_Widget *)&context->ESD_Image_2, (context->Widget.GlobalHeight * (256 - progress)) >> 9);
+				context->ESD_Image_2.Color = Ft_Esd_Image_SlideShow_Local_Method(context, progress, 255, 255, 255);
+			}
+			else
+			{
+				context->Variable_5 = context->Variable_4;
+				context->Variable_6 = 0;
+				context->TransitionScale = 256L;
+				Ft_Esd_Widget_SetX((Ft_Esd_Widget *)&context->ESD_Image_2, 0);
+				Ft_Esd_Widget_SetY((Ft_Esd_Widget *)&context->ESD_Image_2, 0);
+			}
 			break;
 		}
 		default:
@@ -484,6 +593,15 @@ static esd_argb32_t Ft_Esd_Image_SlideShow_Local_Method_1(Ft_Esd_Image_SlideShow
 	return (a << 24) | (r << 16) | (g << 8) | b;
 }
 
+// Progress of the timed transitions from 0 to 256, based on the frame time rather than the number of frames
+static int Ft_Esd_Image_SlideShow_Transition_Progress(Ft_Esd_Image_SlideShow *context)
+{
+	uint32_t elapsed = Esd_GetMillis() - context->TransitionStart;
+	if (context->TransitionMs <= 0 || elapsed >= (uint32_t)context->TransitionMs)
+		return 256;
+	return (int)((elapsed << 8) / (uint32_t)context->TransitionMs);
+}
+
 void Ft_Esd_Image_SlideShow_ESD_Timer_Fired__Signal(void *c)
 {
 	Ft_Esd_Image_SlideShow *context = (Ft_Esd_Image_SlideShow *)c;
@@ -491,6 +609,8 @@ void Ft_Esd_Image_SlideShow_ESD_Timer_Fired__Signal(void *c)
 	int set_variable = context->Variable_2;
 	context->VariableTest = set_variable;
 	Ft_Esd_Timer_Halt(&context->ESD_Timer);
+	context->TransitionStart = Esd_GetMillis();
+	Ft_Esd_Widget_SetX((Ft_Esd_Widget *)&context->ESD_Image, 0);
 	int left_32 = context->VariableTest;
 	int right_31 = 1L;
 	int left_31 = left_32 + right_31;
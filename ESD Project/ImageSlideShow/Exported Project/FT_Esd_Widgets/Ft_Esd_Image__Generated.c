@@ -58,7 +58,7 @@ void Ft_Esd_Image_Render(Ft_Esd_Image *context)
 {
 	void *owner = context->Owner;
 	Ft_Esd_Image_Render_Bitmap(context);
-	context->RenderComplete(owner);
+	ESD_SIGNAL_EMIT(context, RenderComplete, owner);
 	Ft_Esd_Widget_Render((Ft_Esd_Widget *)context); 
 }
 
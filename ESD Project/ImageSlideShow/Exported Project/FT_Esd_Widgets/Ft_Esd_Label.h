@@ -50,6 +50,11 @@ typedef struct
 	ft_uint8_t AutoResize;
 	ESD_VARIABLE(BackGroundAlpha, Type = ft_uint8_t, Min = 0, Max = 255, SingleStep = 1, Public)
 	ft_uint8_t BackGroundAlpha;
+	/* Render the text once into a bitmap, and draw the bitmap while the text is unchanged */
+	ESD_VARIABLE(Prerender, DisplayName = "Pre-render Text", Type = bool, Default = false, Public)
+	bool Prerender;
+	ESD_VARIABLE(TextRun, Type = Esd_TextRun, Private)
+	Esd_TextRun TextRun;
 	ESD_INPUT(Alpha, Type = ft_uint8_t, Min = 0, Max = 255, SingleStep = 1, Default = 255)
 	ft_uint8_t(* Alpha)(void *context);
 	ESD_INPUT(Theme, Type = Ft_Esd_Theme *, EditRole = Library, Default = Ft_Esd_Theme_GetCurrent)
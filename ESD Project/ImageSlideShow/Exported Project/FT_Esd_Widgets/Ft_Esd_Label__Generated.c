@@ -55,6 +55,15 @@ void Ft_Esd_Label__Initializer(Ft_Esd_Label *context)
 	context->Widget.LocalHeight = 36;
 	context->AutoResize = ESD_AUTORESIZE_HEIGHT;
 	context->BackGroundAlpha = 0;
+	context->Prerender = false;
+	context->TextRun.Font = 0;
+	context->TextRun.Hash = 0;
+	context->TextRun.TextWidth = 0;
+	context->TextRun.BitmapInfo.GpuHandle = GA_HANDLE_INVALID;
+	context->TextRun.BitmapInfo.PaletteGpuHandle = GA_HANDLE_INVALID;
+	context->TextRun.BitmapInfo.AdditionalInfo = 0;
+	context->TextRun.BitmapInfo.Thumbnail = 0;
+	context->TextRun.BitmapInfo.Loading = 0;
 	context->Alpha = Ft_Esd_Label_Alpha__Default;
 	context->Theme = Ft_Esd_Label_Theme__Default;
 	context->Font = Ft_Esd_Label_Font__Default;
@@ -248,7 +257,16 @@ void Ft_Esd_Label_Render(Ft_Esd_Label *context)
 	}
 	uint16_t xOffset = Esd_GetFontXOffset(fontInfo_2);
 	const char * s = context->Text(owner);
-	Ft_Gpu_CoCmd_Text_Ex(phost, x_2, y_1, font, options, bottom, baseLine, capsHeight, xOffset, s);
+	Esd_Font_LoadText(fontInfo, s);
+	int if_9 = context->Prerender;
+	if (if_9)
+	{
+		Esd_Render_TextRun(&context->TextRun, fontInfo, font, x_2, y_1, options, bottom, baseLine, capsHeight, xOffset, s);
+	}
+	else
+	{
+		Ft_Gpu_CoCmd_Text_Ex(phost, x_2, y_1, font, options, bottom, baseLine, capsHeight, xOffset, s);
+	}
 	Ft_Esd_Widget_Render((Ft_Esd_Widget *)context); 
 }
 
@@ -24,6 +24,8 @@ void Ft_Esd_Layout_Dynamic_Switch__Initializer(Ft_Esd_Layout_Dynamic_Switch *con
 	context->AutoResize = FT_FALSE;
 	context->Current = 0;
 	context->Next = 0;
+	context->Preload = 0;
+	context->Preloaded = FT_FALSE;
 	context->animationduration = 500L;
 	context->elapsedtime = 0L;
 	context->animationmode = FT_FALSE;
@@ -44,7 +46,8 @@ void Ft_Esd_Layout_Dynamic_Switch_Update(Ft_Esd_Layout_Dynamic_Switch *context)
 		child = context->Widget.Last;
 		while (child)
 		{
-			if (child->Active)
+			// The preloaded page is active, but only becomes current through ShowPreload
+			if (child->Active && child != context->Preload)
 			{
 				if (child == next && !context->animationmode)
 				{
@@ -129,6 +132,15 @@ void Ft_Esd_Layout_Dynamic_Switch_Update(Ft_Esd_Layout_Dynamic_Switch *context)
 				    context->Widget.GlobalWidth,
 				    context->Widget.GlobalHeight);
 			}
+			else if (child == context->Preload)
+			{
+				// Laid out where it will be shown, so it requests the same bitmaps
+				Ft_Esd_Widget_SetGlobalRect(child,
+				    context->Widget.GlobalX,
+				    context->Widget.GlobalY,
+				    context->Widget.GlobalWidth,
+				    context->Widget.GlobalHeight);
+			}
 			else if (child == next)
 			{
 				child->GlobalValid = FT_FALSE;
@@ -152,7 +164,12 @@ void Ft_Esd_Layout_Dynamic_Switch_Update(Ft_Esd_Layout_Dynamic_Switch *context)
 void Ft_Esd_Layout_Dynamic_Switch_Render(Ft_Esd_Layout_Dynamic_Switch *context)
 {
 	EVE_HalContext *phost = Esd_GetHost();
+	Ft_Esd_Widget *preload = context->Preload;
+	ft_bool_t preloadValid = preload && preload->GlobalValid;
 
+	// Kept out of the regular pass, it is rendered masked until its bitmaps are loaded
+	if (preload)
+		preload->GlobalValid = FT_FALSE;
 	if (context->animationmode)
 	{
 		Ft_Esd_Widget_IterateChildActiveValidSlotReverse((Ft_Esd_Widget *)context, FT_ESD_WIDGET_RENDER);
@@ -164,6 +181,42 @@ void Ft_Esd_Layout_Dynamic_Switch_Render(Ft_Esd_Layout_Dynamic_Switch *context)
 	{
 		Ft_Esd_Widget_IterateChildActiveValidSlotReverse((Ft_Esd_Widget *)context, FT_ESD_WIDGET_RENDER);
 	}
+	if (preload)
+		preload->GlobalValid = preloadValid;
+	if (preloadValid && !context->Preloaded)
+	{
+		context->Preloaded = Ft_Esd_Widget_RenderPreload(preload);
+		if (context->Preloaded)
+			Ft_Esd_Widget_Damage(&context->Widget);
+	}
+}
+
+void Ft_Esd_Layout_Dynamic_Switch_Preload(Ft_Esd_Layout_Dynamic_Switch *context, Ft_Esd_Widget *page)
+{
+	if (page == context->Current || page == context->Preload)
+		return;
+	if (context->Preload)
+		Ft_Esd_Widget_SetActive(context->Preload, FT_FALSE);
+	context->Preload = page;
+	context->Preloaded = FT_FALSE;
+	if (page)
+		Ft_Esd_Widget_SetActive(page, FT_TRUE);
+}
+
+ft_bool_t Ft_Esd_Layout_Dynamic_Switch_IsPreloaded(Ft_Esd_Layout_Dynamic_Switch *context)
+{
+	return context->Preload && context->Preloaded;
+}
+
+void Ft_Esd_Layout_Dynamic_Switch_ShowPreload(Ft_Esd_Layout_Dynamic_Switch *context)
+{
+	if (!context->Preload)
+		return;
+
+	// Now an active child other than the current one, so the next Update starts the fade
+	context->Preload = 0;
+	context->Preloaded = FT_FALSE;
+	context->Widget.Recalculate = FT_TRUE;
 }
 
 void Ft_Esd_Layout_Dynamic_Switch_Idle(Ft_Esd_Layout_Dynamic_Switch *context)
@@ -54,6 +54,8 @@ typedef struct
 
 	Ft_Esd_Widget *Current;
 	Ft_Esd_Widget *Next;
+	Ft_Esd_Widget *Preload;
+	ft_bool_t Preloaded;
 
 	ESD_VARIABLE(animationduration, Type = ft_uint32_t, DisplayName = "Animation Duration (ms)", Default = 500, Public, Min = 500, Max = 20000)
 	ft_uint32_t animationduration;
@@ -80,6 +82,22 @@ void Ft_Esd_Layout_Dynamic_Switch_Render(Ft_Esd_Layout_Dynamic_Switch *context);
 ESD_SLOT(Idle)
 void Ft_Esd_Layout_Dynamic_Switch_Idle(Ft_Esd_Layout_Dynamic_Switch *context);
 
+// Activate a child widget without showing it. Its bitmaps are loaded in the background while the current page stays on screen
+ESD_FUNCTION(Ft_Esd_Layout_Dynamic_Switch_Preload, DisplayName = "Preload Page", Category = EsdLayoutUtilities)
+ESD_PARAMETER(context, Type = Ft_Esd_Layout_Dynamic_Switch *)
+ESD_PARAMETER(page, Type = Ft_Esd_Widget *)
+void Ft_Esd_Layout_Dynamic_Switch_Preload(Ft_Esd_Layout_Dynamic_Switch *context, Ft_Esd_Widget *page);
+
+// Returns FT_TRUE once the preloaded page has nothing left to load
+ESD_FUNCTION(Ft_Esd_Layout_Dynamic_Switch_IsPreloaded, Type = ft_bool_t, DisplayName = "Is Page Preloaded", Category = EsdLayoutUtilities)
+ESD_PARAMETER(context, Type = Ft_Esd_Layout_Dynamic_Switch *)
+ft_bool_t Ft_Esd_Layout_Dynamic_Switch_IsPreloaded(Ft_Esd_Layout_Dynamic_Switch *context);
+
+// Fade to the preloaded page, once loaded it does not stall the frame in which it first appears
+ESD_FUNCTION(Ft_Esd_Layout_Dynamic_Switch_ShowPreload, DisplayName = "Show Preloaded Page", Category = EsdLayoutUtilities)
+ESD_PARAMETER(context, Type = Ft_Esd_Layout_Dynamic_Switch *)
+void Ft_Esd_Layout_Dynamic_Switch_ShowPreload(Ft_Esd_Layout_Dynamic_Switch *context);
+
 #endif /* FT_ESD_LAYOUT_DYNAMIC_SWITCH_H */
 
 /* end of file */
@@ -1,5 +1,8 @@
 #include "Ft_Esd.h"
 #include "Ft_Esd_Numberpad.h"
+#include "Esd_DlCache.h"
+
+#include <string.h>
 
 extern ESD_CORE_EXPORT EVE_HalContext *Esd_Host;
 
@@ -9,6 +12,80 @@ typedef struct
 
 } ListOfPoints;
 
+// Number of number pads that can have their keys cached at the same time
+#ifndef FT_ESD_NUMBERPAD_DLCACHE_COUNT
+#define FT_ESD_NUMBERPAD_DLCACHE_COUNT 2
+#endif
+
+// Everything the key labels and touch areas depend on
+typedef struct
+{
+	int X;
+	int Y;
+	int Width;
+	int Height;
+	uint16_t Font;
+	uint16_t BaseLine;
+	uint16_t CapsHeight;
+	uint16_t XOffset;
+	Ft_Esd_Rect16 Scissor;
+} Ft_Esd_NumberpadKey;
+
+// The labels do not change when a key is pressed, the highlight is drawn on top of them,
+// so one recording of all keys serves both the up and the pressed state
+typedef struct
+{
+	Ft_Esd_Numberpad *Widget;
+	Ft_Esd_NumberpadKey Key;
+	ft_bool_t Steady; // Key unchanged since the previous frame
+	Esd_DlCache Labels;
+	Esd_DlCache TouchArea;
+} Ft_Esd_NumberpadCache;
+
+static Ft_Esd_NumberpadCache s_NumberpadCache[FT_ESD_NUMBERPAD_DLCACHE_COUNT];
+static int s_NumberpadCacheNext = 0;
+
+static Ft_Esd_NumberpadCache *findNumberpadCache(Ft_Esd_Numberpad *context)
+{
+	for (int i = 0; i < FT_ESD_NUMBERPAD_DLCACHE_COUNT; ++i)
+	{
+		if (s_NumberpadCache[i].Widget == context)
+			return &s_NumberpadCache[i];
+	}
+	return NULL;
+}
+
+static void releaseNumberpadCache(Ft_Esd_NumberpadCache *entry)
+{
+	Esd_DlCache_Invalidate(&entry->Labels);
+	Esd_DlCache_Invalidate(&entry->TouchArea);
+	entry->Widget = NULL;
+}
+
+static Ft_Esd_NumberpadCache *getNumberpadCache(Ft_Esd_Numberpad *context)
+{
+	Ft_Esd_NumberpadCache *entry = findNumberpadCache(context);
+	if (entry)
+		return entry;
+
+	// Take over the oldest entry
+	entry = &s_NumberpadCache[s_NumberpadCacheNext];
+	s_NumberpadCacheNext = (s_NumberpadCacheNext + 1) % FT_ESD_NUMBERPAD_DLCACHE_COUNT;
+	if (entry->Widget)
+	{
+		releaseNumberpadCache(entry);
+	}
+	else
+	{
+		entry->Labels.GpuHandle = GA_HANDLE_INVALID;
+		entry->TouchArea.GpuHandle = GA_HANDLE_INVALID;
+	}
+	memset(&entry->Key, 0, sizeof(entry->Key));
+	entry->Steady = FT_FALSE;
+	entry->Widget = context;
+	return entry;
+}
+
 ESD_METHOD(Ft_Esd_Draw_Display, Context = Ft_Esd_Numberpad)
 ESD_PARAMETER(x, Type = int)
 ESD_PARAMETER(y, Type = int)
@@ -26,6 +103,31 @@ void Ft_Esd_Draw_Display(Ft_Esd_Numberpad *context, int x, int y, int width, int
 	}
 
 	EVE_HalContext *phost = Esd_GetHost();
+	Ft_Esd_NumberpadCache *cache = getNumberpadCache(context);
+	Ft_Esd_NumberpadKey key;
+	memset(&key, 0, sizeof(key));
+	key.X = x;
+	key.Y = y;
+	key.Width = width;
+	key.Height = height;
+	key.Font = context->myFont;
+	key.BaseLine = context->baseLine;
+	key.CapsHeight = context->capsHeight;
+	key.XOffset = context->xOffset;
+	key.Scissor = Ft_Esd_Dl_Scissor_Get();
+	cache->Steady = !memcmp(&cache->Key, &key, sizeof(key));
+	if (!cache->Steady)
+	{
+		// Changed since the last frame, record once it holds still
+		Esd_DlCache_Invalidate(&cache->Labels);
+		Esd_DlCache_Invalidate(&cache->TouchArea);
+		cache->Key = key;
+	}
+	else if (!Esd_DlCache_Begin(&cache->Labels))
+	{
+		return;
+	}
+
 	width = width / 6;
 	height = height / 8;
 
@@ -40,6 +142,9 @@ void Ft_Esd_Draw_Display(Ft_Esd_Numberpad *context, int x, int y, int width, int
 	EVE_CoCmd_text_ex(phost, x + (3 * width), y + (5 * height), context->myFont, OPT_CENTER, 0, context->baseLine, context->capsHeight, context->xOffset, "8");
 	EVE_CoCmd_text_ex(phost, x + (5 * width), y + (5 * height), context->myFont, OPT_CENTER, 0, context->baseLine, context->capsHeight, context->xOffset, "9");
 	EVE_CoCmd_text_ex(phost, x + (3 * width), y + (7 * height), context->myFont, OPT_CENTER, 0, context->baseLine, context->capsHeight, context->xOffset, "0");
+
+	if (cache->Steady)
+		Esd_DlCache_End(&cache->Labels);
 }
 
 ESD_METHOD(Ft_Esd_Create_TouchArea, Context = Ft_Esd_Numberpad)
@@ -53,16 +158,24 @@ void Ft_Esd_Create_TouchArea(Ft_Esd_Numberpad *context, int x, int y, int width,
 	int value = (1 << 24) | 0x00FFFFFF;
 	EVE_CoDl_colorArgb_ex(phost, value);
 
-	for (int i = 1; i < 8; i += 2)
-		for (int j = 1; j < 6; j += 2)
-		{
-			if ((i == 7 && j == 1))
-				; // do nothing; do not create touch area the space beside number 0
-			else if (i == 7 && j == 5)
-				; // do nothing; do not create touch area the space beside number 0
-			else
-				Ft_Esd_CircleLine_Draw_Point(x + j * (width / 6), y + i * (height / 8), 15);
-		}
+	// Same geometry as the labels drawn earlier in the frame
+	Ft_Esd_NumberpadCache *cache = findNumberpadCache(context);
+	bool record = cache && cache->Steady;
+	if (!record || Esd_DlCache_Begin(&cache->TouchArea))
+	{
+		for (int i = 1; i < 8; i += 2)
+			for (int j = 1; j < 6; j += 2)
+			{
+				if ((i == 7 && j == 1))
+					; // do nothing; do not create touch area the space beside number 0
+				else if (i == 7 && j == 5)
+					; // do nothing; do not create touch area the space beside number 0
+				else
+					Ft_Esd_CircleLine_Draw_Point(x + j * (width / 6), y + i * (height / 8), 15);
+			}
+		if (record)
+			Esd_DlCache_End(&cache->TouchArea);
+	}
 
 	EVE_CoCmd_dl(phost, RESTORE_CONTEXT());
 }
@@ -341,5 +454,9 @@ void Ft_Esd_Free_Signal(Ft_Esd_Numberpad *context)
 		esd_free(context->Container);
 		context->Container = NULL;
 	}
+
+	Ft_Esd_NumberpadCache *cache = findNumberpadCache(context);
+	if (cache)
+		releaseNumberpadCache(cache);
 	// ...
 }
@@ -1,5 +1,6 @@
 #include "Ft_Esd.h"
 #include "Ft_Esd_NumericLabel.h"
+#include "Esd_Format.h"
 
 #define MAX_Digit (11) // when negative, 10 digits only
 #define Size_Buffer (MAX_Digit + 3) // null char required, 0x for hex
@@ -66,29 +67,24 @@ void Ft_Esd_NumericLabel_UpdateNumberString(Ft_Esd_NumericLabel *context)
 		context->NDigit = 0;
 	}
 
-#pragma warning(push)
-#pragma warning(disable : 4996)
 	int value = context->Value(owner);
 	ft_bool_t isHex = context->IsHexDisplay(owner);
 	if (context->EnablePadding(owner) && context->NDigit > 0)
 	{
 		if (context->IsZeroLeading(owner))
-		{ //  Zero Padding
-			// eve_printf_debug((isHex) ? "0x%0*X\n" : "%0*d\n", context->NDigit, value);
-			eve_sprintf(context->Number, (isHex) ? "0x%0*X" : "%0*d", context->NDigit, value);
+		{ //  Zero Padding, same as "0x%0*X" or "%0*d"
+			Esd_FormatInt(context->Number, Size_Buffer, value, context->NDigit, ((isHex) ? ESD_FORMAT_HEX : 0) | ESD_FORMAT_ZERO);
 		}
 		else
-		{ // Space Padding
-			// eve_printf_debug((isHex) ? "0x% *X\n": "% *d\n", context->NDigit, value);
-			eve_sprintf(context->Number, (isHex) ? "0x% *X" : "% *d", context->NDigit, value);
+		{ // Space Padding, same as "0x% *X" or "% *d"
+			Esd_FormatInt(context->Number, Size_Buffer, value, context->NDigit, ((isHex) ? ESD_FORMAT_HEX : 0) | ESD_FORMAT_SPACE);
 		}
 	}
 	else
 	{
-		// eve_printf_debug((isHex) ? "0x%X\n" : "%d\n", value);
-		eve_sprintf(context->Number, (isHex) ? "0x%X" : "%d", value);
+		// Same as "0x%X" or "%d"
+		Esd_FormatInt(context->Number, Size_Buffer, value, 0, (isHex) ? ESD_FORMAT_HEX : 0);
 	}
-#pragma warning(pop)
 }
 
 ESD_METHOD(Ft_Esd_NumericLabel_Start_Signal, Context = Ft_Esd_NumericLabel)
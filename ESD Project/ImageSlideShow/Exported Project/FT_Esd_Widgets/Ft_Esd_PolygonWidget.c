@@ -7,6 +7,10 @@ C Source
 #include "Ft_Esd_Widget.h"
 #include "Ft_Esd_Primitives.h"
 #include "Ft_Esd_PolygonWidget.h"
+#include "Esd_Context.h"
+#include "Esd_DlCache.h"
+
+#include <string.h>
 
 #define WIDTH 800.00
 #define HEIGHT 480.00
@@ -17,35 +21,106 @@ ft_int32_t polygonHeight = 250;
 ft_int32_t X_Array[MAX_VERTEX];
 ft_int32_t Y_Array[MAX_VERTEX];
 
-ESD_METHOD(DrawPolygon, Context = Ft_Esd_PolygonWidget)
-ESD_PARAMETER(color, Type = ft_argb32_t, Default = 0x00000000)
-ESD_PARAMETER(fillOrBorder, Type = ft_bool_t, Default = FT_FALSE)
+// Number of polygon widgets that can have their display list cached at the same time
+#ifndef FT_ESD_POLYGON_DLCACHE_COUNT
+#define FT_ESD_POLYGON_DLCACHE_COUNT 4
+#endif
 
-void drawPolygon(ft_argb32_t color, ft_bool_t fillOrBorder, int vertices)
+// Everything the generated display list depends on
+typedef struct
 {
-	int a = ((color & 0xFF000000)) >> 24;
-	int r = ((color & 0x00FF0000)) >> 16;
-	int g = ((color & 0x0000FF00)) >> 8;
-	int b = ((color & 0x000000FF));
+	ft_int32_t X[MAX_VERTEX];
+	ft_int32_t Y[MAX_VERTEX];
+	ft_uint32_t Vertices;
+	Ft_Esd_Rect16 Scissor;
+	ft_argb32_t BorderColor;
+	ft_argb32_t FillColor;
+	ft_int16_t BorderWidth;
+} Ft_Esd_PolygonKey;
 
-	Esd_Dl_COLOR_ARGB(color);
-#if (EVE_DL_OPTIMIZE)
-	Esd_GetHost()->DlPrimitive = 0;
-#endif
-	EVE_CoDl_saveContext(Ft_Esd_Host);
+typedef struct
+{
+	Ft_Esd_PolygonWidget *Widget;
+	Ft_Esd_PolygonKey Key;
+	Esd_DlCache DlCache;
+} Ft_Esd_PolygonCache;
 
-	if (fillOrBorder)
+static Ft_Esd_PolygonCache s_PolygonCache[FT_ESD_POLYGON_DLCACHE_COUNT];
+static int s_PolygonCacheNext = 0;
+
+// Fills of the same color are accumulated into the stencil buffer and covered at once
+static struct
+{
+	ft_bool_t Active;
+	ft_bool_t Pending;
+	ft_argb32_t Color;
+	Ft_Esd_Rect16 Rect;
+} s_PolygonBatch;
+
+static Ft_Esd_PolygonCache *getPolygonCache(Ft_Esd_PolygonWidget *context)
+{
+	Ft_Esd_PolygonCache *entry;
+	for (int i = 0; i < FT_ESD_POLYGON_DLCACHE_COUNT; ++i)
 	{
-		Ft_Gpu_Hal_WrCmd32(Ft_Esd_Host, COLOR_MASK(0, 0, 0, 0));
-		Ft_Gpu_Hal_WrCmd32(Ft_Esd_Host, STENCIL_OP(KEEP, INVERT));
-		Ft_Gpu_Hal_WrCmd32(Ft_Esd_Host, STENCIL_FUNC(ALWAYS, 255, 255));
-		Ft_Gpu_Hal_WrCmd32(Ft_Esd_Host, BEGIN(EDGE_STRIP_B));
+		if (s_PolygonCache[i].Widget == context)
+			return &s_PolygonCache[i];
 	}
+
+	// Take over the oldest entry
+	entry = &s_PolygonCache[s_PolygonCacheNext];
+	s_PolygonCacheNext = (s_PolygonCacheNext + 1) % FT_ESD_POLYGON_DLCACHE_COUNT;
+	if (entry->Widget)
+		Esd_DlCache_Invalidate(&entry->DlCache);
 	else
+		entry->DlCache.GpuHandle = GA_HANDLE_INVALID;
+	memset(&entry->Key, 0, sizeof(entry->Key));
+	entry->Widget = context;
+	return entry;
+}
+
+// Bounding box of the drawn vertices, in pixels
+static Ft_Esd_Rect16 getPolygonRect(int vertices)
+{
+	ft_int32_t minX = X_Array[0], minY = Y_Array[0];
+	ft_int32_t maxX = X_Array[0], maxY = Y_Array[0];
+	for (int i = 1; i < vertices; ++i)
 	{
-		Ft_Gpu_Hal_WrCmd32(Ft_Esd_Host, BEGIN(LINE_STRIP));
+		if ((X_Array[i] < 0) || (Y_Array[i] < 0))
+			continue;
+		if (X_Array[i] < minX)
+			minX = X_Array[i];
+		if (X_Array[i] > maxX)
+			maxX = X_Array[i];
+		if (Y_Array[i] < minY)
+			minY = Y_Array[i];
+		if (Y_Array[i] > maxY)
+			maxY = Y_Array[i];
 	}
-	
+	Ft_Esd_Rect16 rect = {
+		.X = minX, .Y = minY, .Width = maxX - minX + 1, .Height = maxY - minY + 1
+	};
+	return rect;
+}
+
+static void setPolygonScissor(Ft_Esd_Rect16 rect)
+{
+	rect = Ft_Esd_Rect16_Crop(rect, Ft_Esd_Dl_Scissor_Get());
+	Ft_Gpu_Hal_WrCmd32(Ft_Esd_Host, SCISSOR_XY(rect.X, rect.Y));
+	Ft_Gpu_Hal_WrCmd32(Ft_Esd_Host, SCISSOR_SIZE(rect.Width, rect.Height));
+}
+
+// Invert the stencil inside the polygon. Columns below the box are inverted an even number of times, so the pass is scissored to it
+static void stencilPolygon(int vertices, Ft_Esd_Rect16 rect)
+{
+#if (EVE_DL_OPTIMIZE)
+	Esd_GetHost()->DlPrimitive = 0;
+#endif
+	EVE_CoDl_saveContext(Ft_Esd_Host);
+	setPolygonScissor(rect);
+	Ft_Gpu_Hal_WrCmd32(Ft_Esd_Host, COLOR_MASK(0, 0, 0, 0));
+	Ft_Gpu_Hal_WrCmd32(Ft_Esd_Host, STENCIL_OP(KEEP, INVERT));
+	Ft_Gpu_Hal_WrCmd32(Ft_Esd_Host, STENCIL_FUNC(ALWAYS, 255, 255));
+	Ft_Gpu_Hal_WrCmd32(Ft_Esd_Host, BEGIN(EDGE_STRIP_B));
 	EVE_CoDl_vertexFormat(Ft_Esd_Host, 3);
 
 	for (int i = 0; i < vertices; ++i)
@@ -57,20 +132,88 @@ void drawPolygon(ft_argb32_t color, ft_bool_t fillOrBorder, int vertices)
 
 	EVE_CoDl_vertex2f(Ft_Esd_Host, X_Array[0] << 3, Y_Array[0] << 3);
 	EVE_CoDl_end(Ft_Esd_Host);
+	EVE_CoDl_restoreContext(Ft_Esd_Host);
+}
+
+// Paint where the stencil is set, inverting it back to zero as it goes
+static void coverPolygon(ft_argb32_t color, Ft_Esd_Rect16 rect)
+{
+#if (EVE_DL_OPTIMIZE)
+	Esd_GetHost()->DlPrimitive = 0;
+#endif
+	EVE_CoDl_saveContext(Ft_Esd_Host);
+	Esd_Dl_COLOR_ARGB(color);
+	setPolygonScissor(rect);
+	Ft_Gpu_Hal_WrCmd32(Ft_Esd_Host, STENCIL_OP(KEEP, INVERT));
+	Ft_Gpu_Hal_WrCmd32(Ft_Esd_Host, STENCIL_FUNC(EQUAL, 255, 255));
+	Ft_Gpu_Hal_WrCmd32(Ft_Esd_Host, BEGIN(EDGE_STRIP_R));
+	EVE_CoDl_vertexFormat(Ft_Esd_Host, 3);
+	EVE_CoDl_vertex2f(Ft_Esd_Host, 0, 0);
+	EVE_CoDl_vertex2f(Ft_Esd_Host, 0, 511 << 4);
+	EVE_CoDl_end(Ft_Esd_Host);
+	EVE_CoDl_restoreContext(Ft_Esd_Host);
+}
+
+static void flushPolygonBatch()
+{
+	if (s_PolygonBatch.Pending)
+	{
+		coverPolygon(s_PolygonBatch.Color, s_PolygonBatch.Rect);
+		s_PolygonBatch.Pending = FT_FALSE;
+	}
+}
+
+ESD_METHOD(DrawPolygon, Context = Ft_Esd_PolygonWidget)
+ESD_PARAMETER(color, Type = ft_argb32_t, Default = 0x00000000)
+ESD_PARAMETER(fillOrBorder, Type = ft_bool_t, Default = FT_FALSE)
 
+void drawPolygon(ft_argb32_t color, ft_bool_t fillOrBorder, int vertices)
+{
 	if (fillOrBorder)
 	{
-		Ft_Gpu_Hal_WrCmd32(Ft_Esd_Host, COLOR_MASK(1, 1, 1, 1));
-		Ft_Gpu_Hal_WrCmd32(Ft_Esd_Host, STENCIL_FUNC(EQUAL, 255, 255));
-		Ft_Gpu_Hal_WrCmd32(Ft_Esd_Host, BEGIN(EDGE_STRIP_R));
-		EVE_CoDl_vertex2f(Ft_Esd_Host, 0, 0);
-		EVE_CoDl_vertex2f(Ft_Esd_Host, 0, 511 << 4);
-		EVE_CoDl_end(Ft_Esd_Host);
+		Ft_Esd_Rect16 rect = getPolygonRect(vertices);
+		stencilPolygon(vertices, rect);
+		coverPolygon(color, rect);
+		return;
+	}
+
+	Esd_Dl_COLOR_ARGB(color);
+#if (EVE_DL_OPTIMIZE)
+	Esd_GetHost()->DlPrimitive = 0;
+#endif
+	EVE_CoDl_saveContext(Ft_Esd_Host);
+	Ft_Gpu_Hal_WrCmd32(Ft_Esd_Host, BEGIN(LINE_STRIP));
+	EVE_CoDl_vertexFormat(Ft_Esd_Host, 3);
+
+	for (int i = 0; i < vertices; ++i)
+	{
+		if ((X_Array[i] < 0) || (Y_Array[i] < 0))
+			continue;
+		EVE_CoDl_vertex2f(Ft_Esd_Host, X_Array[i] << 3, Y_Array[i] << 3);
 	}
 
+	EVE_CoDl_vertex2f(Ft_Esd_Host, X_Array[0] << 3, Y_Array[0] << 3);
+	EVE_CoDl_end(Ft_Esd_Host);
 	EVE_CoDl_restoreContext(Ft_Esd_Host);
 }
 
+// Start batching polygon fills. Borderless polygons of the same fill color drawn until Ft_Esd_PolygonWidget_EndBatch share one cover pass.
+// Overlapping polygons in one batch cancel out where they overlap
+ESD_FUNCTION(Ft_Esd_PolygonWidget_BeginBatch, DisplayName = "Begin Polygon Batch", Category = EsdBasicWidgets)
+void Ft_Esd_PolygonWidget_BeginBatch()
+{
+	flushPolygonBatch();
+	s_PolygonBatch.Active = FT_TRUE;
+}
+
+// Draw the pending batched fills and stop batching
+ESD_FUNCTION(Ft_Esd_PolygonWidget_EndBatch, DisplayName = "End Polygon Batch", Category = EsdBasicWidgets)
+void Ft_Esd_PolygonWidget_EndBatch()
+{
+	flushPolygonBatch();
+	s_PolygonBatch.Active = FT_FALSE;
+}
+
 ESD_METHOD(Ft_Esd_PolygonWidget_DrawPolygon, Context = Ft_Esd_PolygonWidget)
 ESD_PARAMETER(xPos, Type = ft_int32_t, Default = 0)
 ESD_PARAMETER(yPos, Type = ft_int32_t, Default = 0)
@@ -86,24 +229,89 @@ ft_void_t Ft_Esd_PolygonWidget_DrawPolygon(Ft_Esd_PolygonWidget *context,
     ft_argb32_t borderColor,
     ft_argb32_t fillColor)
 {
+	// Also called from Start and Update, display list output is only wanted while rendering
+	if (Esd_CurrentContext->LoopState != ESD_LOOPSTATE_RENDER)
+		return;
+
 	size_t sizeX = 0, sizeY = 0;
 	int* ArrayX = context->VertexsX(context, &sizeX);
 	int* ArrayY = context->VertexsY(context, &sizeY);
 	ft_uint32_t vertices = fmin(sizeX, sizeY);
+	if (vertices > MAX_VERTEX)
+		vertices = MAX_VERTEX;
 	if(vertices > 0 && ArrayX != NULL && ArrayY != NULL)
 	{
-		Esd_Dl_LINE_WIDTH(borderWidth << 3);
 		for(int i = 0; i < vertices; i++)
 		{
 			X_Array[i] = ArrayX[i] >= 0 ? ArrayX[i] + xPos : ArrayX[i];
 			Y_Array[i] = ArrayY[i] >= 0 ? ArrayY[i] + yPos : ArrayY[i];
 		}
+
+		if (s_PolygonBatch.Active && 0 == borderWidth)
+		{
+			Ft_Esd_Rect16 rect = getPolygonRect(vertices);
+			if (s_PolygonBatch.Pending && s_PolygonBatch.Color != fillColor)
+				flushPolygonBatch();
+			stencilPolygon(vertices, rect);
+			if (s_PolygonBatch.Pending)
+			{
+				ft_int16_t x1 = s_PolygonBatch.Rect.X + s_PolygonBatch.Rect.Width;
+				ft_int16_t y1 = s_PolygonBatch.Rect.Y + s_PolygonBatch.Rect.Height;
+				if (rect.X + rect.Width > x1)
+					x1 = rect.X + rect.Width;
+				if (rect.Y + rect.Height > y1)
+					y1 = rect.Y + rect.Height;
+				if (rect.X < s_PolygonBatch.Rect.X)
+					s_PolygonBatch.Rect.X = rect.X;
+				if (rect.Y < s_PolygonBatch.Rect.Y)
+					s_PolygonBatch.Rect.Y = rect.Y;
+				s_PolygonBatch.Rect.Width = x1 - s_PolygonBatch.Rect.X;
+				s_PolygonBatch.Rect.Height = y1 - s_PolygonBatch.Rect.Y;
+			}
+			else
+			{
+				s_PolygonBatch.Rect = rect;
+				s_PolygonBatch.Color = fillColor;
+				s_PolygonBatch.Pending = FT_TRUE;
+			}
+			return;
+		}
+
+		// Anything else draws on top of the batched fills
+		flushPolygonBatch();
+
+		Ft_Esd_PolygonKey key;
+		memset(&key, 0, sizeof(key));
+		memcpy(key.X, X_Array, vertices * sizeof(ft_int32_t));
+		memcpy(key.Y, Y_Array, vertices * sizeof(ft_int32_t));
+		key.Vertices = vertices;
+		key.Scissor = Ft_Esd_Dl_Scissor_Get();
+		key.BorderColor = borderColor;
+		key.FillColor = fillColor;
+		key.BorderWidth = borderWidth;
+
+		Ft_Esd_PolygonCache *cache = getPolygonCache(context);
+		if (memcmp(&cache->Key, &key, sizeof(key)))
+		{
+			// Changed since the last frame, record once it holds still
+			Esd_DlCache_Invalidate(&cache->DlCache);
+			cache->Key = key;
+		}
+		else if (!Esd_DlCache_Begin(&cache->DlCache))
+		{
+			return;
+		}
+
+		Esd_Dl_LINE_WIDTH(borderWidth << 3);
 		drawPolygon(fillColor, FT_TRUE, vertices);
 
 		if (0 != borderWidth)
 		{
 			drawPolygon(borderColor, FT_FALSE, vertices);
 		}
+
+		if (cache->DlCache.Recording)
+			Esd_DlCache_End(&cache->DlCache);
 	}
 }
 
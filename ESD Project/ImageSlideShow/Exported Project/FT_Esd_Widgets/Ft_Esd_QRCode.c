@@ -4,12 +4,115 @@
 #include "qrcodegen.h"
 
 extern ESD_CORE_EXPORT Esd_GpuAlloc *Esd_GAlloc;
-static uint8_t qrcode[qrcodegen_BUFFER_LEN_MAX];
+
+// Number of QR code widgets that remember what their uploaded bitmap contains
+#ifndef FT_ESD_QRCODE_CACHE_COUNT
+#define FT_ESD_QRCODE_CACHE_COUNT 4
+#endif
+
+typedef struct
+{
+	Ft_Esd_QRCode *Widget;
+	uint32_t Hash;
+} Ft_Esd_QRCodeCache;
+
+static Ft_Esd_QRCodeCache s_Ft_Esd_QRCode_Cache[FT_ESD_QRCODE_CACHE_COUNT];
+static int s_Ft_Esd_QRCode_CacheNext = 0;
+
+// FNV-1a hash of the text and the error correction level
+static uint32_t QRCode_Hash(const char *text, enum qrcodegen_Ecc ecl)
+{
+	uint32_t hash = 2166136261UL;
+	hash ^= (uint8_t)ecl;
+	hash *= 16777619UL;
+	while (*text)
+	{
+		hash ^= (uint8_t)*text++;
+		hash *= 16777619UL;
+	}
+	return hash;
+}
+
+static Ft_Esd_QRCodeCache *QRCode_GetCache(Ft_Esd_QRCode *context)
+{
+	Ft_Esd_QRCodeCache *entry;
+	int i;
+	for (i = 0; i < FT_ESD_QRCODE_CACHE_COUNT; ++i)
+	{
+		if (s_Ft_Esd_QRCode_Cache[i].Widget == context)
+			return &s_Ft_Esd_QRCode_Cache[i];
+	}
+	entry = &s_Ft_Esd_QRCode_Cache[s_Ft_Esd_QRCode_CacheNext];
+	s_Ft_Esd_QRCode_CacheNext = (s_Ft_Esd_QRCode_CacheNext + 1) % FT_ESD_QRCODE_CACHE_COUNT;
+	entry->Widget = 0;
+	return entry;
+}
+
+// Bytes of packed rows collected before they are written to the command buffer, a multiple of 4
+#ifndef FT_ESD_QRCODE_CHUNK
+#define FT_ESD_QRCODE_CHUNK 64
+#endif
+
+// Bytes in an L1 row of the largest QR code
+#define FT_ESD_QRCODE_STRIDE_MAX ((qrcodegen_VERSION_MAX * 4 + 17 + 7) / 8)
+
+static const uint8_t c_Ft_Esd_QRCode_Reverse[16] = {
+	0x0, 0x8, 0x4, 0xC, 0x2, 0xA, 0x6, 0xE, 0x1, 0x9, 0x5, 0xD, 0x3, 0xB, 0x7, 0xF
+};
+
+// Pack one row of modules into L1, leftmost module in the most significant bit, padded with light modules.
+// qrcodegen stores the modules after the size byte, row after row without padding, leftmost module in the least significant bit,
+// so each output byte takes the 8 modules starting at its bit offset from at most two bytes of the buffer
+static void QRCode_PackRow(const uint8_t *qrcode, int size, int y, uint8_t *row)
+{
+	const uint8_t *modules = &qrcode[1];
+	uint32_t first = (uint32_t)y * size;
+	int x;
+	for (x = 0; x < size; x += 8)
+	{
+		uint32_t bit = first + x;
+		const uint8_t *src = &modules[bit >> 3];
+		int shift = bit & 7;
+		int count = min(size - x, 8);
+		uint32_t bits = src[0] >> shift;
+		if (shift + count > 8)
+			bits |= (uint32_t)src[1] << (8 - shift);
+		bits &= (1UL << count) - 1;
+		*row++ = (uint8_t)((c_Ft_Esd_QRCode_Reverse[bits & 0xF] << 4) | c_Ft_Esd_QRCode_Reverse[(bits >> 4) & 0xF]);
+	}
+}
+
+// Stream the bitmap rows through CMD_MEMWRITE, without building the image in host memory first
+static bool QRCode_Upload(const uint8_t *qrcode, int size, uint32_t addr, uint32_t stride)
+{
+	EVE_HalContext *phost = Ft_Esd_Host;
+	uint8_t chunk[FT_ESD_QRCODE_CHUNK + FT_ESD_QRCODE_STRIDE_MAX];
+	uint32_t fill = 0;
+	int y;
+
+	EVE_CoCmd_memWrite(phost, addr, stride * size);
+	for (y = 0; y < size; ++y)
+	{
+		QRCode_PackRow(qrcode, size, y, &chunk[fill]);
+		fill += stride;
+		if (fill >= FT_ESD_QRCODE_CHUNK)
+		{
+			// Only the last write may be padded
+			if (!EVE_Cmd_wrMem(phost, chunk, FT_ESD_QRCODE_CHUNK))
+				return false;
+			fill -= FT_ESD_QRCODE_CHUNK;
+			memmove(chunk, &chunk[FT_ESD_QRCODE_CHUNK], fill);
+		}
+	}
+	return !fill || EVE_Cmd_wrMem(phost, chunk, fill);
+}
 
 static void Render_Scale_QRCodeImage(int16_t x, int16_t y, Esd_BitmapCell bitmapCell, esd_int32_f16_t xscale, esd_int32_f16_t yscale, int16_t width, int16_t height)
 {
 	EVE_HalContext *phost;
 	Esd_BitmapInfo *bitmapInfo;
+	Esd_TransformState state;
+	Esd_Transform transform;
 	uint16_t cell;
 	uint8_t handle;
 
@@ -24,16 +127,16 @@ static void Render_Scale_QRCodeImage(int16_t x, int16_t y, Esd_BitmapCell bitmap
 	Esd_CoDl_BitmapSize(handle, NEAREST, BORDER, BORDER, width, height);
 
 	EVE_CoDl_colorArgb_ex(phost, 0xffffffffUL);
-	EVE_CoDl_saveContext(phost);
-	EVE_CoCmd_scale(Ft_Esd_Host, xscale, yscale);
-	EVE_CoCmd_setMatrix(Ft_Esd_Host);
+	Esd_Transform_Identity(&transform);
+	Esd_Transform_Scale(&transform, xscale, yscale);
+	Esd_CoDl_BeginTransform(&state);
+	Esd_CoDl_Transform(&state, &transform);
 
 	EVE_CoDl_begin(phost, BITMAPS);
 	Esd_CoDl_Bitmap_Vertex(x, y, handle, cell);
 
 	EVE_CoDl_end(phost);
-	EVE_CoCmd_loadIdentity(Ft_Esd_Host);
-	EVE_CoDl_restoreContext(phost);
+	Esd_CoDl_EndTransform(&state);
 }
 
 static void PrepareQRcode(Ft_Esd_QRCode *context)
@@ -41,7 +144,25 @@ static void PrepareQRcode(Ft_Esd_QRCode *context)
 
 	char *text = context->URL;
 	enum qrcodegen_Ecc errCorLvl = qrcodegen_Ecc_LOW; // Error correction level
-	uint8_t tempBuffer[qrcodegen_BUFFER_LEN_MAX];
+	Ft_Esd_QRCodeCache *cache = QRCode_GetCache(context);
+	uint32_t hash = QRCode_Hash(text, errCorLvl);
+
+	// Same content and the bitmap is still in RAM_G
+	if (cache->Widget == context && cache->Hash == hash
+	    && Ft_Esd_GpuAlloc_Get(Ft_Esd_GAlloc, context->BitmapInfo.GpuHandle) != GA_INVALID)
+		return;
+	cache->Widget = 0;
+
+	// Work buffers only live while generating
+	uint32_t mark = EVE_Hal_scratchMark(Ft_Esd_Host);
+	uint8_t *qrcode = (uint8_t *)EVE_Hal_scratchAlloc(Ft_Esd_Host, qrcodegen_BUFFER_LEN_MAX);
+	uint8_t *tempBuffer = (uint8_t *)EVE_Hal_scratchAlloc(Ft_Esd_Host, qrcodegen_BUFFER_LEN_MAX);
+	if (!qrcode || !tempBuffer)
+	{
+		EVE_Hal_scratchRelease(Ft_Esd_Host, mark);
+		return;
+	}
+
 	bool generateQRCodeOk = qrcodegen_encodeText(text, tempBuffer, qrcode, errCorLvl,
 	    qrcodegen_VERSION_MIN, qrcodegen_VERSION_MAX, qrcodegen_Mask_AUTO, true);
 
@@ -50,8 +171,6 @@ static void PrepareQRcode(Ft_Esd_QRCode *context)
 		unsigned int size = qrcodegen_getSize(qrcode);
 		eve_printf_debug("Size of QRCode matrix: %d", size);
 
-		unsigned char pixelsOf8 = 0x0;
-
 		// Set bitmap options
 		context->BitmapInfo.Width = size;
 		context->BitmapInfo.Height = size;
@@ -73,7 +192,10 @@ static void PrepareQRcode(Ft_Esd_QRCode *context)
 		Ft_Esd_BitmapInfo *bitmapInfo = &context->BitmapInfo;
 
 		if (bitmapInfo->Size <= 0)
-			return ~0;
+		{
+			EVE_Hal_scratchRelease(Ft_Esd_Host, mark);
+			return;
+		}
 
 		ft_uint32_t addr = Ft_Esd_GpuAlloc_Get(Ft_Esd_GAlloc, context->BitmapInfo.GpuHandle);
 		if (addr == ~0)
@@ -84,52 +206,25 @@ static void PrepareQRcode(Ft_Esd_QRCode *context)
 			if (addr == ~0)
 			{
 				eve_printf_debug("Cannot allocate memory");
+				EVE_Hal_scratchRelease(Ft_Esd_Host, mark);
 				return;
 			}
 		}
 
-		// Converse to little endian and add padding
-		unsigned int validPixelsOnRow = size / 8;
-		unsigned pixelPos = 0;
-		for (int y = 0; y < size; y++)
+		if (!QRCode_Upload(qrcode, size, addr, bitmapInfo->Stride))
 		{
-			int countPix = 0;
-			for (int x = 0; x < size; x++)
-			{
-				if (qrcodegen_getModule(qrcode, x, y))
-				{
-					unsigned char bitPos = x % 8;
-					unsigned char mask = 0x80;
-					pixelsOf8 = pixelsOf8 | (mask >> bitPos);
-				}
-
-				if (countPix != validPixelsOnRow)
-				{
-					if ((x + 1) % 8 == 0)
-					{
-						tempBuffer[pixelPos] = pixelsOf8;
-						pixelsOf8 = 0;
-						pixelPos++;
-						countPix++;
-					}
-				}
-				else
-				{
-					if (x == size - 1)
-					{
-						tempBuffer[pixelPos] = pixelsOf8;
-						pixelsOf8 = 0;
-						pixelPos++;
-					}
-				}
-			}
+			eve_printf_debug("Cannot upload QRCode");
+			EVE_Hal_scratchRelease(Ft_Esd_Host, mark);
+			return;
 		}
-		EVE_Hal_wrMem(Ft_Esd_Host, addr, (uint8_t *)tempBuffer, context->BitmapInfo.Size);
+		cache->Widget = context;
+		cache->Hash = hash;
 	}
 	else
 	{
 		eve_printf_debug("Cannot generate QRCode\n");
 	}
+	EVE_Hal_scratchRelease(Ft_Esd_Host, mark);
 }
 
 ESD_METHOD(Ft_Esd_QRCode_Render_Signal, Context = Ft_Esd_QRCode)
@@ -148,9 +243,7 @@ void Ft_Esd_QRCode_Render_Signal(Ft_Esd_QRCode *context)
 ESD_METHOD(Ft_Esd_QRCode_Update_Signal, Context = Ft_Esd_QRCode)
 void Ft_Esd_QRCode_Update_Signal(Ft_Esd_QRCode *context)
 {
-	if (strcmp(context->LastURL, context->URL) != 0)
-	{
-		PrepareQRcode(context);
-		context->LastURL = context->URL;
-	}
+	// Checked by content hash every update, the text may be edited in place
+	PrepareQRcode(context);
+	context->LastURL = context->URL;
 }
@@ -42,12 +42,16 @@ typedef struct
 	/* corner radius */
 	ESD_INPUT(Radius, Type = ft_int32_t, Min = 0, Default = 1)
 	ft_int32_t(* Radius)(void *context);
+	ft_int32_t Radius__Value;
 	ESD_INPUT(Border_Width, DisplayName = "Border Width", Type = int, Default = 0)
 	int(* Border_Width)(void *context);
+	int Border_Width__Value;
 	ESD_INPUT(Border_Color, Type = ft_argb32_t, Default = #00ffffff)
 	ft_argb32_t(* Border_Color)(void *context);
+	ft_argb32_t Border_Color__Value;
 	ESD_INPUT(Color, Type = ft_argb32_t, Default = #ffffff)
 	ft_argb32_t(* Color)(void *context);
+	ft_argb32_t Color__Value;
 } Ft_Esd_Rectangle;
 
 void Ft_Esd_Rectangle__Initializer(Ft_Esd_Rectangle *context);
@@ -1,6 +1,6 @@
 #include "Ft_Esd_RingSlider.h"
 #include "Ft_Esd.h"
-#include <math.h>
+#include "Esd_Math.h"
 
 #include "Ft_Esd_TouchTag.h"
 
@@ -35,25 +35,21 @@ void Ft_Esd_Circle_Render_Func(Ft_Esd_RingSlider *context, int x, int y, int wid
 	else
 		RadiusOfRing = height / 2;
 
-	double DistanceFrCenter = RadiusOfRing - (ringWidth / 2);
+	int DistanceFrCenter = RadiusOfRing - (ringWidth / 2);
 
-	double tempAngle = 0;
-	double opposite = 0;
-	double adjacent = 0;
+	int tempAngle = 0;
+	int opposite = 0;
+	int adjacent = 0;
 
 	if (clockwise)
 		tempAngle = ((360 - origin) + (360 - angle)) % 360;
 	else
 		tempAngle = (origin + angle) % 360;
 
-	if (tempAngle == 0)
-		tempAngle = 360;
+	opposite = (Esd_Math_SinQ16(ESD_ANGLE_DEG(tempAngle)) * DistanceFrCenter) / 65536;
+	adjacent = (Esd_Math_CosQ16(ESD_ANGLE_DEG(tempAngle)) * DistanceFrCenter) / 65536;
 
-	tempAngle = tempAngle * M_PI / 180.0f;
-	opposite = sin(tempAngle) * DistanceFrCenter;
-	adjacent = opposite / tan(tempAngle);
-
-	Ft_Esd_CircleLine_Draw_Point(x + (int)adjacent, y - (int)opposite, radius);
+	Ft_Esd_CircleLine_Draw_Point(x + adjacent, y - opposite, radius);
 	EVE_CoCmd_dl(phost, RESTORE_CONTEXT());
 	EVE_CoDl_tag(phost, 255);
 }
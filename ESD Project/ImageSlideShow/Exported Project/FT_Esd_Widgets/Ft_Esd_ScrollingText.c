@@ -10,12 +10,21 @@ ESD_PARAMETER(str, Type = char *, Default = "Str")
 int Ft_Esd_ScrollingTextCheckValue(Ft_Esd_ScrollingText *context, int x, int fontBaseLine, int fontHeight, char * str)
 {
 	EVE_HalContext *phost = Esd_GetHost();
-	int size = 0;
-    while (str[size] != '\0') size++;		//  find the string length
-	int font = max(fontBaseLine, fontHeight);	  //  find maxmum numbers from fontBaseLine and fontHeight.
-	int v = font * size * 425;
-	v = v/1000;
-	v = -v;
+	Esd_FontInfo *fontInfo = context->Font_Resource ? context->Font_Resource : Esd_GetRomFont(context->Font);
+	int v;
+	if (fontInfo)
+	{
+		v = -(int)Esd_Font_MeasureText(fontInfo, str);
+	}
+	else
+	{
+		int size = 0;
+		while (str[size] != '\0') size++;		//  find the string length
+		int font = max(fontBaseLine, fontHeight);	  //  find maxmum numbers from fontBaseLine and fontHeight.
+		v = font * size * 425;
+		v = v/1000;
+		v = -v;
+	}
 	int www = phost->Width;
 	int GX = context->GlobalX;
 	v = v - GX;
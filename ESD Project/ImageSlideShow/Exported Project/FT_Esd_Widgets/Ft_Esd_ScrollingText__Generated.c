@@ -58,6 +58,7 @@ void Ft_Esd_ScrollingText__ESD_Label__Initializer(Ft_Esd_ScrollingText *context)
 	object->FontResource = Ft_Esd_ScrollingText_ESD_Label_FontResource__Property;
 	object->Text = Ft_Esd_ScrollingText_ESD_Label_Text__Property;
 	object->AlignY = Ft_Esd_ScrollingText_ESD_Label_AlignY__Property;
+	object->Prerender = true;
 	Ft_Esd_Widget_InsertBottom((Ft_Esd_Widget *)object, (Ft_Esd_Widget *)&context->Fixed_Positioning);
 }
 
@@ -5,6 +5,7 @@
 #include "Ft_Esd_Primitives.h"
 
 #include "Ft_Esd_CoCmd.h"
+#include "Esd_BitmapSave.h"
 
 #include <stdio.h>
 
@@ -82,6 +82,17 @@ void Ft_Esd_Sketch_Clear(Ft_Esd_Sketch *context);
 ESD_SLOT(Disable)
 void Ft_Esd_Sketch_Disable(Ft_Esd_Sketch *context);
 
+// Save the drawing to the SD card in the background, see Esd_BitmapSave.h. Returns false when a save is still in progress
+ESD_FUNCTION(Ft_Esd_Sketch_Save, Type = ft_bool_t, DisplayName = "Save Sketch", Category = EsdWidgetUtilities)
+ESD_PARAMETER(context, Type = Ft_Esd_Sketch *)
+ESD_PARAMETER(filename, Type = const char *, Default = "SIGN.BIN")
+ft_bool_t Ft_Esd_Sketch_Save(Ft_Esd_Sketch *context, const char *filename);
+
+// Whether the last save is still being written
+ESD_FUNCTION(Ft_Esd_Sketch_Saving, Type = ft_bool_t, DisplayName = "Sketch Saving", Category = EsdWidgetUtilities)
+ESD_PARAMETER(context, Type = Ft_Esd_Sketch *)
+ft_bool_t Ft_Esd_Sketch_Saving(Ft_Esd_Sketch *context);
+
 #endif /* Ft_Esd_Sketch__H */
 
 /* end of file */
@@ -0,0 +1,105 @@
+
+#include "Ft_Esd_Sprite.h"
+
+#include <stddef.h>
+
+static Ft_Esd_WidgetSlots s_Ft_Esd_Sprite__Slots = {
+	(void (*)(void *))Ft_Esd_Widget_Initialize,
+	(void (*)(void *))Ft_Esd_Sprite_Start,
+	(void (*)(void *))Ft_Esd_Widget_Enable,
+	(void (*)(void *))Ft_Esd_Sprite_Update,
+	(void (*)(void *))Ft_Esd_Sprite_Render,
+	(void (*)(void *))Ft_Esd_Widget_Idle,
+	(void (*)(void *))Ft_Esd_Widget_Disable,
+	(void (*)(void *))Ft_Esd_Sprite_End,
+};
+
+static Esd_BitmapInfo *Ft_Esd_Sprite_Bitmap__Default(void *context) { return NULL; }
+
+static void Ft_Esd_Sprite_Advanced(Esd_Sprite *sprite)
+{
+	Ft_Esd_Sprite *context = (Ft_Esd_Sprite *)((char *)sprite - offsetof(Ft_Esd_Sprite, Sprite));
+	Ft_Esd_Widget_Damage(&context->Widget);
+}
+
+void Ft_Esd_Sprite__Initializer(Ft_Esd_Sprite *context)
+{
+	Ft_Esd_Widget__Initializer((Ft_Esd_Widget *)context);
+	context->Widget.ClassId = Ft_Esd_Sprite_CLASSID;
+	context->Widget.Slots = &s_Ft_Esd_Sprite__Slots;
+	context->Widget.LocalWidth = 64;
+	context->Widget.LocalHeight = 64;
+	context->Bitmap = Ft_Esd_Sprite_Bitmap__Default;
+	context->FirstCell = 0;
+	context->Frames = 1;
+	context->FrameMs = 100;
+	context->Loop = FT_TRUE;
+	context->AutoPlay = FT_TRUE;
+	context->Color = 0xffffffffUL;
+	Esd_Sprite_Initialize(&context->Sprite, NULL, 0, 1, 100, true);
+	context->Sprite.Advanced = Ft_Esd_Sprite_Advanced;
+}
+
+// Picks up property changes without restarting the sequence
+static void Ft_Esd_Sprite_Sync(Ft_Esd_Sprite *context)
+{
+	Esd_Sprite *sprite = &context->Sprite;
+	Esd_BitmapInfo *info = context->Bitmap(context->Owner);
+	ft_uint16_t frames = context->Frames ? context->Frames : 1;
+	ft_uint16_t frameMs = context->FrameMs ? context->FrameMs : 1;
+
+	if (info != sprite->Info || context->FirstCell != sprite->FirstCell || frames != sprite->Frames)
+	{
+		sprite->Info = info;
+		sprite->FirstCell = context->FirstCell;
+		sprite->Frames = frames;
+		Esd_Sprite_Seek(sprite, 0);
+		Ft_Esd_Widget_Damage(&context->Widget);
+	}
+	sprite->FrameMs = frameMs;
+	sprite->Loop = context->Loop;
+}
+
+void Ft_Esd_Sprite_Start(Ft_Esd_Sprite *context)
+{
+	Ft_Esd_Widget_Start(&context->Widget);
+	Ft_Esd_Sprite_Sync(context);
+	if (context->AutoPlay)
+		Esd_Sprite_Play(&context->Sprite);
+}
+
+void Ft_Esd_Sprite_Update(Ft_Esd_Sprite *context)
+{
+	Ft_Esd_Sprite_Sync(context);
+	Ft_Esd_Widget_Update(&context->Widget);
+}
+
+void Ft_Esd_Sprite_Render(Ft_Esd_Sprite *context)
+{
+	EVE_HalContext *phost = Esd_GetHost();
+	EVE_CoDl_colorArgb_ex(phost, context->Color);
+	Esd_Sprite_Render(&context->Sprite, context->Widget.GlobalX, context->Widget.GlobalY);
+}
+
+void Ft_Esd_Sprite_End(Ft_Esd_Sprite *context)
+{
+	Esd_Sprite_Stop(&context->Sprite);
+	Ft_Esd_Widget_End(&context->Widget);
+}
+
+void Ft_Esd_Sprite_Play(Ft_Esd_Sprite *context)
+{
+	Esd_Sprite_Play(&context->Sprite);
+}
+
+void Ft_Esd_Sprite_Stop(Ft_Esd_Sprite *context)
+{
+	Esd_Sprite_Stop(&context->Sprite);
+}
+
+void Ft_Esd_Sprite_Seek(Ft_Esd_Sprite *context, ft_uint16_t frame)
+{
+	Esd_Sprite_Seek(&context->Sprite, frame);
+}
+
+/* end of file */
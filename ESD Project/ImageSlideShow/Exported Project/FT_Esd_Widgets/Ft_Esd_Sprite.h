@@ -0,0 +1,117 @@
+/**
+ * This source code ("the Software") is provided by Bridgetek Pte Ltd
+ * ("Bridgetek") subject to the licence terms set out
+ *   http://brtchip.com/BRTSourceCodeLicenseAgreement/ ("the Licence Terms").
+ * You must read the Licence Terms before downloading or using the Software.
+ * By installing or using the Software you agree to the Licence Terms. If you
+ * do not agree to the Licence Terms then do not download or use the Software.
+ *
+ * Without prejudice to the Licence Terms, here is a summary of some of the key
+ * terms of the Licence Terms (and in the event of any conflict between this
+ * summary and the Licence Terms then the text of the Licence Terms will
+ * prevail).
+ *
+ * The Software is provided "as is".
+ * There are no warranties (or similar) in relation to the quality of the
+ * Software. You use it at your own risk.
+ * The Software should not be used in, or for, any medical device, system or
+ * appliance. There are exclusions of Bridgetek liability for certain types of loss
+ * such as: special loss or damage; incidental loss or damage; indirect or
+ * consequential loss or damage; loss of income; loss of business; loss of
+ * profits; loss of revenue; loss of contracts; business interruption; loss of
+ * the use of money or anticipated savings; loss of information; loss of
+ * opportunity; loss of goodwill or reputation; and/or loss of, damage to or
+ * corruption of data.
+ * There is a monetary cap on Bridgetek's liability.
+ * The Software may have subsequently been amended by another user and then
+ * distributed by that other user ("Adapted Software").  If so that user may
+ * have additional licence terms that apply to those amendments. However, Bridgetek
+ * has no liability in relation to those amendments.
+ */
+
+
+#ifndef FT_ESD_SPRITE_H
+#define FT_ESD_SPRITE_H
+
+#include "Ft_Esd_Widget.h"
+#include "Esd_Sprite.h"
+
+/*
+Frame animation from the cells of a single bitmap, for animated icons on FT81X.
+The frames are advanced by the shared sprite scheduler in Esd_Update, see Esd_Sprite.h,
+and the widget is damaged only when its cell changes.
+*/
+
+#define Ft_Esd_Sprite_CLASSID 0x5B3E90D4
+ESD_SYMBOL(Ft_Esd_Sprite_CLASSID, Type = esd_classid_t)
+
+// Plays the cells of a bitmap as an animation
+ESD_WIDGET(Ft_Esd_Sprite, DisplayName = "Sprite", Icon = ":/icons/film.png", Include = "Ft_Esd_Sprite.h", Category = EsdWidgets, Width = 64, Height = 64, Callback)
+typedef struct
+{
+	union
+	{
+		void *Owner;
+		Ft_Esd_Widget Widget;
+	};
+
+	// Bitmap with the frames as consecutive cells
+	ESD_INPUT(Bitmap, Type = Esd_BitmapInfo *)
+	Esd_BitmapInfo *(*Bitmap)(void *context);
+
+	ESD_VARIABLE(FirstCell, DisplayName = "First Cell", Type = ft_uint16_t, Default = 0, Public)
+	ft_uint16_t FirstCell;
+
+	ESD_VARIABLE(Frames, Type = ft_uint16_t, Default = 1, Min = 1, Public)
+	ft_uint16_t Frames;
+
+	// Duration of each frame in milliseconds
+	ESD_VARIABLE(FrameMs, DisplayName = "Frame Time", Type = ft_uint16_t, Default = 100, Min = 1, Public)
+	ft_uint16_t FrameMs;
+
+	ESD_VARIABLE(Loop, Type = ft_bool_t, Default = true, Public)
+	ft_bool_t Loop;
+
+	// Start playing when the widget starts
+	ESD_VARIABLE(AutoPlay, DisplayName = "Auto Play", Type = ft_bool_t, Default = true, Public)
+	ft_bool_t AutoPlay;
+
+	ESD_VARIABLE(Color, Type = ft_argb32_t, Default = #ffffffff, Public)
+	ft_argb32_t Color;
+
+	Esd_Sprite Sprite;
+
+} Ft_Esd_Sprite;
+
+void Ft_Esd_Sprite__Initializer(Ft_Esd_Sprite *context);
+
+ESD_SLOT(Start)
+void Ft_Esd_Sprite_Start(Ft_Esd_Sprite *context);
+
+ESD_SLOT(Update)
+void Ft_Esd_Sprite_Update(Ft_Esd_Sprite *context);
+
+ESD_SLOT(Render)
+void Ft_Esd_Sprite_Render(Ft_Esd_Sprite *context);
+
+ESD_SLOT(End)
+void Ft_Esd_Sprite_End(Ft_Esd_Sprite *context);
+
+ESD_FUNCTION(Ft_Esd_Sprite_Play, DisplayName = "Play Sprite", Category = EsdWidgetUtilities)
+ESD_PARAMETER(context, Type = Ft_Esd_Sprite *)
+void Ft_Esd_Sprite_Play(Ft_Esd_Sprite *context);
+
+// Stop on the current frame
+ESD_FUNCTION(Ft_Esd_Sprite_Stop, DisplayName = "Stop Sprite", Category = EsdWidgetUtilities)
+ESD_PARAMETER(context, Type = Ft_Esd_Sprite *)
+void Ft_Esd_Sprite_Stop(Ft_Esd_Sprite *context);
+
+// Show a frame, counted from FirstCell
+ESD_FUNCTION(Ft_Esd_Sprite_Seek, DisplayName = "Seek Sprite", Category = EsdWidgetUtilities)
+ESD_PARAMETER(context, Type = Ft_Esd_Sprite *)
+ESD_PARAMETER(frame, Type = ft_uint16_t)
+void Ft_Esd_Sprite_Seek(Ft_Esd_Sprite *context, ft_uint16_t frame);
+
+#endif /* FT_ESD_SPRITE_H */
+
+/* end of file */
@@ -0,0 +1,212 @@
+
+#include "Ft_Esd_TrendChart.h"
+#include "Esd_Utility.h"
+
+extern ESD_CORE_EXPORT Esd_GpuAlloc *Esd_GAlloc;
+
+// Ring positions are in 1/8 pixel, so the ring spans up to 2048 pixels in VERTEX2F range
+#define FT_ESD_TRENDCHART_VERTEX_FORMAT 3
+
+static Ft_Esd_WidgetSlots s_Ft_Esd_TrendChart__Slots = {
+	(void (*)(void *))Ft_Esd_Widget_Initialize,
+	(void (*)(void *))Ft_Esd_Widget_Start,
+	(void (*)(void *))Ft_Esd_Widget_Enable,
+	(void (*)(void *))Ft_Esd_Widget_Update,
+	(void (*)(void *))Ft_Esd_TrendChart_Render,
+	(void (*)(void *))Ft_Esd_Widget_Idle,
+	(void (*)(void *))Ft_Esd_Widget_Disable,
+	(void (*)(void *))Ft_Esd_TrendChart_End,
+};
+
+void Ft_Esd_TrendChart__Initializer(Ft_Esd_TrendChart *context)
+{
+	Ft_Esd_Widget__Initializer((Ft_Esd_Widget *)context);
+	context->Widget.ClassId = Ft_Esd_TrendChart_CLASSID;
+	context->Widget.Slots = &s_Ft_Esd_TrendChart__Slots;
+	context->Widget.LocalWidth = 300;
+	context->Widget.LocalHeight = 120;
+	context->Samples = 128;
+	context->Min = 0;
+	context->Max = 100;
+	context->Color = 0xff3f9fffUL;
+	context->LineWidth = 32;
+	context->Pushed = 0;
+	context->Uploaded = 0;
+	context->Ring = GA_HANDLE_INVALID;
+	context->RingSlots = 0;
+	context->Step = 0;
+}
+
+void Ft_Esd_TrendChart_End(Ft_Esd_TrendChart *context)
+{
+	Esd_DeferredGpuFree(context->Ring);
+	context->Ring = GA_HANDLE_INVALID;
+	Ft_Esd_Widget_End(&context->Widget);
+}
+
+void Ft_Esd_TrendChart_Push(Ft_Esd_TrendChart *context, int value)
+{
+	context->Values[context->Pushed % FT_ESD_TRENDCHART_MAX_SAMPLES] = value;
+	++context->Pushed;
+	Ft_Esd_Widget_Damage(&context->Widget);
+}
+
+void Ft_Esd_TrendChart_Clear(Ft_Esd_TrendChart *context)
+{
+	context->Pushed = 0;
+	context->Uploaded = 0;
+	Ft_Esd_Widget_Damage(&context->Widget);
+}
+
+static int Ft_Esd_TrendChart_SampleCount(Ft_Esd_TrendChart *context)
+{
+	int samples = context->Samples;
+	if (samples < 16)
+		return 16; // Keeps the ring within twice the width
+	if (samples > FT_ESD_TRENDCHART_MAX_SAMPLES)
+		return FT_ESD_TRENDCHART_MAX_SAMPLES;
+	return samples;
+}
+
+// VERTEX2F word of a sample, relative to the left of its ring slot and the top of the chart
+static ft_uint32_t Ft_Esd_TrendChart_Vertex(Ft_Esd_TrendChart *context, ft_uint32_t sample)
+{
+	ft_int32_t height = (ft_int32_t)context->RingHeight << 3;
+	ft_int32_t range = context->RingMax - context->RingMin;
+	ft_int32_t value = context->Values[sample % FT_ESD_TRENDCHART_MAX_SAMPLES] - context->RingMin;
+	ft_int32_t y = range ? height - (ft_int32_t)(((int64_t)value * height) / range) : height;
+	if (y < 0)
+		y = 0;
+	else if (y > height)
+		y = height;
+	return VERTEX2F((ft_int32_t)(sample % context->RingSlots) * context->Step, y);
+}
+
+// Writes samples first to last - 1 into their ring slots, one wrMem per run of adjacent slots
+static void Ft_Esd_TrendChart_Write(Ft_Esd_TrendChart *context, ft_uint32_t addr, ft_uint32_t first, ft_uint32_t last)
+{
+	EVE_HalContext *phost = Esd_GetHost();
+	ft_uint32_t words[FT_ESD_TRENDCHART_SLACK];
+
+	while (first < last)
+	{
+		ft_uint32_t slot = first % context->RingSlots;
+		ft_uint32_t n = 0;
+		while (first < last && n < FT_ESD_TRENDCHART_SLACK && (slot + n) < context->RingSlots)
+			words[n++] = Ft_Esd_TrendChart_Vertex(context, first++);
+		EVE_Hal_wrMem(phost, addr + slot * 4, (const uint8_t *)words, n * 4);
+	}
+}
+
+// Allocates a new ring for the current layout and writes the samples in view
+static ft_uint32_t Ft_Esd_TrendChart_Rebuild(Ft_Esd_TrendChart *context)
+{
+	int samples = Ft_Esd_TrendChart_SampleCount(context);
+	ft_uint32_t addr;
+	ft_uint32_t first;
+
+	// The previous frame may still append from the old ring
+	Esd_DeferredGpuFree(context->Ring);
+	context->RingSlots = (ft_uint16_t)(samples + FT_ESD_TRENDCHART_SLACK);
+	// Fixed, so defragmentation does not move it while samples are written directly
+	context->Ring = Esd_GpuAlloc_Alloc(Esd_GAlloc, (ft_uint32_t)context->RingSlots * 4, GA_GC_FLAG | GA_FIXED_FLAG);
+	addr = Esd_GpuAlloc_Get(Esd_GAlloc, context->Ring);
+	if (addr == GA_INVALID)
+	{
+		context->Ring = GA_HANDLE_INVALID;
+		return GA_INVALID;
+	}
+
+	context->RingWidth = context->Widget.GlobalWidth;
+	context->RingHeight = context->Widget.GlobalHeight;
+	context->RingSamples = context->Samples;
+	context->RingMin = context->Min;
+	context->RingMax = context->Max;
+	context->Step = (ft_int16_t)(((ft_int32_t)context->RingWidth << 3) / (samples - 1));
+
+	// Nothing references the new ring yet, so every sample in view is written at once
+	first = context->Pushed > (ft_uint32_t)samples ? context->Pushed - samples : 0;
+	context->Uploaded = context->Pushed;
+	while (first < context->Uploaded)
+	{
+		ft_uint32_t last = first + FT_ESD_TRENDCHART_SLACK;
+		if (last > context->Uploaded)
+			last = context->Uploaded;
+		Ft_Esd_TrendChart_Write(context, addr, first, last);
+		first = last;
+	}
+	return addr;
+}
+
+void Ft_Esd_TrendChart_Render(Ft_Esd_TrendChart *context)
+{
+	EVE_HalContext *phost = Esd_GetHost();
+	int samples = Ft_Esd_TrendChart_SampleCount(context);
+	ft_uint32_t addr;
+	ft_uint32_t count;
+	ft_uint32_t first, firstSlot, run;
+	ft_int32_t x;
+
+	if (EVE_CHIPID < EVE_FT810)
+	{
+		eve_printf_debug_once("Trend chart requires VERTEX_TRANSLATE\n");
+		return;
+	}
+
+	addr = Esd_GpuAlloc_Get(Esd_GAlloc, context->Ring);
+	if (addr == GA_INVALID
+	    || context->RingWidth != context->Widget.GlobalWidth
+	    || context->RingHeight != context->Widget.GlobalHeight
+	    || context->RingSamples != context->Samples
+	    || context->RingMin != context->Min
+	    || context->RingMax != context->Max
+	    || (context->Pushed - context->Uploaded) > (ft_uint32_t)samples)
+	{
+		addr = Ft_Esd_TrendChart_Rebuild(context);
+		if (addr == GA_INVALID)
+			return;
+	}
+	else if (context->Uploaded != context->Pushed)
+	{
+		// Falls behind when more than the slack arrives in one frame, and catches up over the next frames
+		ft_uint32_t last = context->Uploaded + FT_ESD_TRENDCHART_SLACK;
+		if (last > context->Pushed)
+			last = context->Pushed;
+		Ft_Esd_TrendChart_Write(context, addr, context->Uploaded, last);
+		context->Uploaded = last;
+		if (last != context->Pushed)
+			Esd_Invalidate();
+	}
+
+	count = context->Uploaded < (ft_uint32_t)samples ? context->Uploaded : (ft_uint32_t)samples;
+	if (count < 2)
+		return;
+
+	// The newest sample is at the right edge
+	first = context->Uploaded - count;
+	firstSlot = first % context->RingSlots;
+	run = context->RingSlots - firstSlot;
+	if (run > count)
+		run = count;
+	x = (((ft_int32_t)context->Widget.GlobalX + context->RingWidth) << 4) - (ft_int32_t)(count - 1) * context->Step * 2;
+
+	EVE_CoDl_saveContext(phost);
+	EVE_CoDl_colorArgb_ex(phost, context->Color);
+	EVE_CoDl_lineWidth(phost, context->LineWidth);
+	EVE_CoDl_vertexFormat(phost, FT_ESD_TRENDCHART_VERTEX_FORMAT);
+	EVE_CoDl_vertexTranslateY(phost, context->Widget.GlobalY << 4);
+	EVE_CoDl_begin(phost, LINE_STRIP);
+	// Translate is in 1/16 pixel, the ring in 1/8
+	EVE_CoDl_vertexTranslateX(phost, (ft_int16_t)(x - (ft_int32_t)firstSlot * context->Step * 2));
+	EVE_CoCmd_append(phost, addr + firstSlot * 4, run * 4);
+	if (run < count)
+	{
+		// Wrapped, the strip continues from slot 0
+		EVE_CoDl_vertexTranslateX(phost, (ft_int16_t)(x + (ft_int32_t)run * context->Step * 2));
+		EVE_CoCmd_append(phost, addr, (count - run) * 4);
+	}
+	EVE_CoDl_end(phost);
+	EVE_CoDl_restoreContext(phost);
+}
+
+/* end of file */
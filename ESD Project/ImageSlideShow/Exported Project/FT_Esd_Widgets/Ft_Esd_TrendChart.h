@@ -0,0 +1,128 @@
+/**
+ * This source code ("the Software") is provided by Bridgetek Pte Ltd
+ * ("Bridgetek") subject to the licence terms set out
+ *   http://brtchip.com/BRTSourceCodeLicenseAgreement/ ("the Licence Terms").
+ * You must read the Licence Terms before downloading or using the Software.
+ * By installing or using the Software you agree to the Licence Terms. If you
+ * do not agree to the Licence Terms then do not download or use the Software.
+ *
+ * Without prejudice to the Licence Terms, here is a summary of some of the key
+ * terms of the Licence Terms (and in the event of any conflict between this
+ * summary and the Licence Terms then the text of the Licence Terms will
+ * prevail).
+ *
+ * The Software is provided "as is".
+ * There are no warranties (or similar) in relation to the quality of the
+ * Software. You use it at your own risk.
+ * The Software should not be used in, or for, any medical device, system or
+ * appliance. There are exclusions of Bridgetek liability for certain types of loss
+ * such as: special loss or damage; incidental loss or damage; indirect or
+ * consequential loss or damage; loss of income; loss of business; loss of
+ * profits; loss of revenue; loss of contracts; business interruption; loss of
+ * the use of money or anticipated savings; loss of information; loss of
+ * opportunity; loss of goodwill or reputation; and/or loss of, damage to or
+ * corruption of data.
+ * There is a monetary cap on Bridgetek's liability.
+ * The Software may have subsequently been amended by another user and then
+ * distributed by that other user ("Adapted Software").  If so that user may
+ * have additional licence terms that apply to those amendments. However, Bridgetek
+ * has no liability in relation to those amendments.
+ */
+
+
+#ifndef FT_ESD_TRENDCHART_H
+#define FT_ESD_TRENDCHART_H
+
+#include "Ft_Esd_Widget.h"
+
+/*
+Scrolling line chart of the most recent Samples values, for sensor trends that arrive continuously.
+Each sample is converted once into a VERTEX2F word and written to a ring of display list words in RAM_G,
+so a new sample costs a 4 byte write. Render draws the ring as a LINE_STRIP with one or two CMD_APPEND,
+and scrolls it with VERTEX_TRANSLATE_X, instead of sending every point in the command buffer each frame.
+The ring has FT_ESD_TRENDCHART_SLACK more slots than are drawn, new samples only overwrite slots that the
+frame still being processed by the coprocessor does not append. The host keeps a copy of the values, so
+the ring is rebuilt when the size, range or number of samples changes. Requires FT81X or newer.
+*/
+
+// Most samples kept on the host, the largest value of Samples
+#ifndef FT_ESD_TRENDCHART_MAX_SAMPLES
+#define FT_ESD_TRENDCHART_MAX_SAMPLES 256
+#endif
+
+// Ring slots beyond those drawn, at most this many samples are written to RAM_G per frame
+#ifndef FT_ESD_TRENDCHART_SLACK
+#define FT_ESD_TRENDCHART_SLACK 8
+#endif
+
+#define Ft_Esd_TrendChart_CLASSID 0x7C41D2A9
+ESD_SYMBOL(Ft_Esd_TrendChart_CLASSID, Type = esd_classid_t)
+
+// Line chart which scrolls as samples are pushed
+ESD_WIDGET(Ft_Esd_TrendChart, DisplayName = "Trend Chart", Icon = ":/icons/chart-up.png", Include = "Ft_Esd_TrendChart.h", Category = EsdWidgets, Width = 300, Height = 120, Callback)
+typedef struct
+{
+	union
+	{
+		void *Owner;
+		Ft_Esd_Widget Widget;
+	};
+
+	// Number of samples across the width of the chart
+	ESD_VARIABLE(Samples, Type = int, Default = 128, Min = 16, Max = FT_ESD_TRENDCHART_MAX_SAMPLES, Public)
+	int Samples;
+
+	// Value at the bottom edge
+	ESD_VARIABLE(Min, Type = int, Default = 0, Public)
+	int Min;
+
+	// Value at the top edge
+	ESD_VARIABLE(Max, Type = int, Default = 100, Public)
+	int Max;
+
+	ESD_VARIABLE(Color, Type = ft_argb32_t, Default = #ff3f9fff, Public)
+	ft_argb32_t Color;
+
+	// Line width in 1/16 pixel
+	ESD_VARIABLE(LineWidth, DisplayName = "Line Width", Type = ft_int16_t, Default = 32, Public)
+	ft_int16_t LineWidth;
+
+	ft_int32_t Values[FT_ESD_TRENDCHART_MAX_SAMPLES]; // Host copy of the latest values, by sample number
+	ft_uint32_t Pushed; // Number of samples pushed
+	ft_uint32_t Uploaded; // Number of samples written to the ring
+
+	Esd_GpuHandle Ring;
+	ft_uint16_t RingSlots;
+	ft_int16_t Step; // Horizontal distance between samples in 1/8 pixel
+
+	// Layout the ring was built for
+	ft_int16_t RingWidth;
+	ft_int16_t RingHeight;
+	int RingSamples;
+	int RingMin;
+	int RingMax;
+
+} Ft_Esd_TrendChart;
+
+void Ft_Esd_TrendChart__Initializer(Ft_Esd_TrendChart *context);
+
+ESD_SLOT(Render)
+void Ft_Esd_TrendChart_Render(Ft_Esd_TrendChart *context);
+
+ESD_SLOT(End)
+void Ft_Esd_TrendChart_End(Ft_Esd_TrendChart *context);
+
+// Append a sample, the chart scrolls left by one step
+ESD_FUNCTION(Ft_Esd_TrendChart_Push, DisplayName = "Push Sample", Category = EsdWidgetUtilities)
+ESD_PARAMETER(context, Type = Ft_Esd_TrendChart *)
+ESD_PARAMETER(value, Type = int)
+void Ft_Esd_TrendChart_Push(Ft_Esd_TrendChart *context, int value);
+
+// Remove all samples
+ESD_FUNCTION(Ft_Esd_TrendChart_Clear, DisplayName = "Clear Samples", Category = EsdWidgetUtilities)
+ESD_PARAMETER(context, Type = Ft_Esd_TrendChart *)
+void Ft_Esd_TrendChart_Clear(Ft_Esd_TrendChart *context);
+
+#endif /* FT_ESD_TRENDCHART_H */
+
+/* end of file */
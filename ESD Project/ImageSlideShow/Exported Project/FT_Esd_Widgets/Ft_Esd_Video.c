@@ -44,7 +44,9 @@ void Ft_Esd_Video_Playing(Ft_Esd_Video *context)
 	}
 	else
 	{
-		Esd_CoWidget_PlayBgVideo(bitmapCell);
+		/* Loops on the open file when the video has an index, otherwise Ft_Esd_Video_Loop_Play restarts it */
+		if (Esd_CoWidget_PlayBgVideo(bitmapCell))
+			Esd_CoWidget_LoopBgVideo(context->Loop);
 	}
 }
 ESD_METHOD(Ft_Esd_Video_Loop_Play, Context = Ft_Esd_Video)
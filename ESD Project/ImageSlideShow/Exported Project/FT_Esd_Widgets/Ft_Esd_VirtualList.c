@@ -0,0 +1,214 @@
+
+#include "Ft_Esd_VirtualList.h"
+#include "Ft_Esd_Dl.h"
+
+static Ft_Esd_WidgetSlots s_Ft_Esd_VirtualList__Slots = {
+	(void (*)(void *))Ft_Esd_Widget_Initialize,
+	(void (*)(void *))Ft_Esd_VirtualList_Start,
+	(void (*)(void *))Ft_Esd_Widget_Enable,
+	(void (*)(void *))Ft_Esd_VirtualList_Update,
+	(void (*)(void *))Ft_Esd_VirtualList_Render,
+	(void (*)(void *))Ft_Esd_VirtualList_Idle,
+	(void (*)(void *))Ft_Esd_Widget_Disable,
+	(void (*)(void *))Ft_Esd_Widget_End,
+};
+
+static void Ft_Esd_VirtualList_BindRow__Noop(void *context, Ft_Esd_Widget *row, int index) { }
+
+static int Ft_Esd_VirtualList_Touch_Scroll_X__Property(void *c)
+{
+	return ((Ft_Esd_VirtualList *)c)->Widget.GlobalX;
+}
+
+static int Ft_Esd_VirtualList_Touch_Scroll_Y__Property(void *c)
+{
+	return ((Ft_Esd_VirtualList *)c)->Widget.GlobalY;
+}
+
+static int Ft_Esd_VirtualList_Touch_Scroll_Width__Property(void *c)
+{
+	return ((Ft_Esd_VirtualList *)c)->Widget.GlobalWidth;
+}
+
+static int Ft_Esd_VirtualList_Touch_Scroll_Height__Property(void *c)
+{
+	return ((Ft_Esd_VirtualList *)c)->Widget.GlobalHeight;
+}
+
+static ft_bool_t Ft_Esd_VirtualList_Touch_Scroll_EnableXScroll__Property(void *c)
+{
+	return FT_FALSE;
+}
+
+static ft_bool_t Ft_Esd_VirtualList_Touch_Scroll_EnableYScroll__Property(void *c)
+{
+	return FT_TRUE;
+}
+
+// The touch offset runs from 0 at the first row down to minus the scrollable height
+static int Ft_Esd_VirtualList_Touch_Scroll_MinY__Property(void *c)
+{
+	Ft_Esd_VirtualList *context = (Ft_Esd_VirtualList *)c;
+	int scrollable = context->Count * context->RowHeight - context->Widget.GlobalHeight;
+	return scrollable > 0 ? -scrollable : 0;
+}
+
+void Ft_Esd_VirtualList__Initializer(Ft_Esd_VirtualList *context)
+{
+	Ft_Esd_Widget__Initializer((Ft_Esd_Widget *)context);
+	context->Widget.ClassId = Ft_Esd_VirtualList_CLASSID;
+	context->Widget.Slots = &s_Ft_Esd_VirtualList__Slots;
+	context->Widget.LocalWidth = 200;
+	context->Widget.LocalHeight = 200;
+	context->Count = 0;
+	context->RowHeight = 40;
+	context->Margin = 1;
+	context->BindRow = Ft_Esd_VirtualList_BindRow__Noop;
+	context->NbRows = 0;
+	context->Scroll = 0;
+	context->LastScroll = -1;
+	context->LastCount = -1;
+
+	Ft_Esd_TouchScrollLogic *object = &context->Touch_Scroll;
+	Ft_Esd_TouchScrollLogic__Initializer(object);
+	object->Owner = (void *)context;
+	object->X = Ft_Esd_VirtualList_Touch_Scroll_X__Property;
+	object->Y = Ft_Esd_VirtualList_Touch_Scroll_Y__Property;
+	object->Width = Ft_Esd_VirtualList_Touch_Scroll_Width__Property;
+	object->Height = Ft_Esd_VirtualList_Touch_Scroll_Height__Property;
+	object->EnableXScroll = Ft_Esd_VirtualList_Touch_Scroll_EnableXScroll__Property;
+	object->EnableYScroll = Ft_Esd_VirtualList_Touch_Scroll_EnableYScroll__Property;
+	object->MinY = Ft_Esd_VirtualList_Touch_Scroll_MinY__Property;
+}
+
+void Ft_Esd_VirtualList_Start(Ft_Esd_VirtualList *context)
+{
+	Ft_Esd_Widget_Start((Ft_Esd_Widget *)context);
+	Ft_Esd_TouchScrollLogic_Start(&context->Touch_Scroll);
+}
+
+ft_bool_t Ft_Esd_VirtualList_AddRow(Ft_Esd_VirtualList *context, Ft_Esd_Widget *row)
+{
+	if (context->NbRows >= FT_ESD_VIRTUALLIST_MAX_ROWS)
+		return FT_FALSE;
+	context->Rows[context->NbRows] = row;
+	context->RowIndex[context->NbRows] = -1;
+	++context->NbRows;
+	Ft_Esd_Widget_InsertBottom(row, (Ft_Esd_Widget *)context);
+	Ft_Esd_Widget_SetActive(row, FT_FALSE);
+	context->LastScroll = -1;
+	return FT_TRUE;
+}
+
+// Binds and places the row widgets of the rows in view, and deactivates the others
+static void Ft_Esd_VirtualList_Recalculate(Ft_Esd_VirtualList *context)
+{
+	ft_int16_t rowHeight = context->RowHeight;
+	if (!context->NbRows)
+		return;
+
+	int first = context->Scroll / rowHeight - context->Margin;
+	int last = (context->Scroll + context->Widget.GlobalHeight - 1) / rowHeight + context->Margin;
+	if (first < 0)
+		first = 0;
+	if (last >= context->Count)
+		last = context->Count - 1;
+	if (last - first >= context->NbRows)
+		last = first + context->NbRows - 1; // Pool too small, the bottom of the view stays empty
+
+	for (ft_uint8_t i = 0; i < context->NbRows; ++i)
+	{
+		Ft_Esd_Widget *row = context->Rows[i];
+
+		// Row index n lives in slot n % NbRows, so a slot only changes hands when its row leaves the range
+		int index = first + (i - first % context->NbRows + context->NbRows) % context->NbRows;
+		if (index > last)
+		{
+			context->RowIndex[i] = -1;
+			Ft_Esd_Widget_SetActive(row, FT_FALSE);
+			continue;
+		}
+		if (index != context->RowIndex[i])
+		{
+			context->RowIndex[i] = index;
+			context->BindRow(context->Owner, row, index);
+			Ft_Esd_Widget_Damage(row);
+		}
+		Ft_Esd_Widget_SetActive(row, FT_TRUE);
+		Ft_Esd_Widget_ScrollGlobalRect(row,
+		    context->Widget.GlobalX,
+		    context->Widget.GlobalY + (ft_int16_t)(index * rowHeight - context->Scroll),
+		    context->Widget.GlobalWidth,
+		    rowHeight);
+	}
+}
+
+void Ft_Esd_VirtualList_Update(Ft_Esd_VirtualList *context)
+{
+	Ft_Esd_TouchScrollLogic_Update(&context->Touch_Scroll);
+
+	int maxScroll = -Ft_Esd_VirtualList_Touch_Scroll_MinY__Property(context);
+	int scroll = -Ft_Esd_TouchScrollLogic_ScrolledY(&context->Touch_Scroll);
+	if (scroll > maxScroll)
+		scroll = maxScroll; // Count or height changed since the last touch
+	if (scroll < 0)
+		scroll = 0;
+	context->Scroll = scroll;
+
+	bool recalculate = context->Widget.Recalculate;
+	if (recalculate || scroll != context->LastScroll || context->Count != context->LastCount)
+	{
+		context->Widget.Recalculate = FT_FALSE;
+		Ft_Esd_VirtualList_Recalculate(context);
+		context->LastScroll = scroll;
+		context->LastCount = context->Count;
+	}
+	Ft_Esd_Widget_IterateChildActiveSlot((Ft_Esd_Widget *)context, FT_ESD_WIDGET_UPDATE);
+	if (recalculate)
+		Ft_Esd_Widget_CheckDefaultIdle(&context->Widget);
+}
+
+void Ft_Esd_VirtualList_Render(Ft_Esd_VirtualList *context)
+{
+	// The margin rows are bound but clipped, only the rows in view are drawn
+	if (Esd_Scissor_Push(context->Widget.GlobalRect))
+		Ft_Esd_Widget_IterateChildVisibleSlot((Ft_Esd_Widget *)context, FT_ESD_WIDGET_RENDER);
+	Esd_Scissor_Pop();
+}
+
+void Ft_Esd_VirtualList_Idle(Ft_Esd_VirtualList *context)
+{
+	Ft_Esd_Widget_IterateChildActiveSlot((Ft_Esd_Widget *)context, FT_ESD_WIDGET_IDLE);
+}
+
+void Ft_Esd_VirtualList_ScrollTo(Ft_Esd_VirtualList *context, int index)
+{
+	Ft_Esd_TouchScrollLogic *touch = &context->Touch_Scroll;
+	int offset = -(index * context->RowHeight);
+	int minY = Ft_Esd_VirtualList_Touch_Scroll_MinY__Property(context);
+	if (offset < minY)
+		offset = minY;
+	if (offset > 0)
+		offset = 0;
+
+	// Stops any fling, which continues from lastOffsetY
+	touch->offsetY = offset;
+	touch->lastOffsetY = offset;
+	touch->dY = 0.0;
+	touch->OldDy = 0.0;
+	touch->speedYAvg = 0.0;
+}
+
+void Ft_Esd_VirtualList_Rebind(Ft_Esd_VirtualList *context)
+{
+	for (ft_uint8_t i = 0; i < context->NbRows; ++i)
+		context->RowIndex[i] = -1;
+	context->Widget.Recalculate = FT_TRUE;
+}
+
+int Ft_Esd_VirtualList_TopIndex(Ft_Esd_VirtualList *context)
+{
+	return context->Scroll / context->RowHeight;
+}
+
+/* end of file */
@@ -0,0 +1,126 @@
+/**
+ * This source code ("the Software") is provided by Bridgetek Pte Ltd
+ * ("Bridgetek") subject to the licence terms set out
+ *   http://brtchip.com/BRTSourceCodeLicenseAgreement/ ("the Licence Terms").
+ * You must read the Licence Terms before downloading or using the Software.
+ * By installing or using the Software you agree to the Licence Terms. If you
+ * do not agree to the Licence Terms then do not download or use the Software.
+ *
+ * Without prejudice to the Licence Terms, here is a summary of some of the key
+ * terms of the Licence Terms (and in the event of any conflict between this
+ * summary and the Licence Terms then the text of the Licence Terms will
+ * prevail).
+ *
+ * The Software is provided "as is".
+ * There are no warranties (or similar) in relation to the quality of the
+ * Software. You use it at your own risk.
+ * The Software should not be used in, or for, any medical device, system or
+ * appliance. There are exclusions of Bridgetek liability for certain types of loss
+ * such as: special loss or damage; incidental loss or damage; indirect or
+ * consequential loss or damage; loss of income; loss of business; loss of
+ * profits; loss of revenue; loss of contracts; business interruption; loss of
+ * the use of money or anticipated savings; loss of information; loss of
+ * opportunity; loss of goodwill or reputation; and/or loss of, damage to or
+ * corruption of data.
+ * There is a monetary cap on Bridgetek's liability.
+ * The Software may have subsequently been amended by another user and then
+ * distributed by that other user ("Adapted Software").  If so that user may
+ * have additional licence terms that apply to those amendments. However, Bridgetek
+ * has no liability in relation to those amendments.
+ */
+
+
+#ifndef FT_ESD_VIRTUALLIST_H
+#define FT_ESD_VIRTUALLIST_H
+
+#include "Ft_Esd_Widget.h"
+#include "Ft_Esd_TouchScrollLogic.h"
+
+/*
+Vertical list of Count rows of RowHeight, for data sets too large to build one widget subtree per row.
+Only the rows on screen, plus Margin rows on either side, have a widget. The application adds a pool
+of row widgets with Ft_Esd_VirtualList_AddRow, and the list recycles them as it scrolls, calling
+BindRow whenever a row widget is moved to another data index. Row index n always uses the same pool
+slot while on screen, so scrolling by one row rebinds a single widget, and the render cost depends
+only on the height of the list.
+*/
+
+// Most row widgets in the pool of a list
+#ifndef FT_ESD_VIRTUALLIST_MAX_ROWS
+#define FT_ESD_VIRTUALLIST_MAX_ROWS 24
+#endif
+
+#define Ft_Esd_VirtualList_CLASSID 0x5A3C71E4
+ESD_SYMBOL(Ft_Esd_VirtualList_CLASSID, Type = esd_classid_t)
+
+// Scrolling list which only keeps widgets for the visible rows
+ESD_WIDGET(Ft_Esd_VirtualList, DisplayName = "Virtual List", Icon = ":/icons/ui-scroll-pane.png", Include = "Ft_Esd_VirtualList.h", Category = EsdLayouts, Width = 200, Height = 200, Callback, Layout)
+typedef struct
+{
+	union
+	{
+		void *Owner;
+		Ft_Esd_Widget Widget;
+	};
+
+	// Number of rows in the data set
+	ESD_VARIABLE(Count, Type = int, Default = 0, Public)
+	int Count;
+
+	ESD_VARIABLE(RowHeight, DisplayName = "Row Height", Type = ft_int16_t, Default = 40, Min = 1, Public)
+	ft_int16_t RowHeight;
+
+	// Rows bound ahead of scrolling into view, on either side
+	ESD_VARIABLE(Margin, Type = ft_uint8_t, Default = 1, Public)
+	ft_uint8_t Margin;
+
+	// Called with the row widget and its new data index, the row reads its data from that index
+	void (*BindRow)(void *context, Ft_Esd_Widget *row, int index);
+
+	Ft_Esd_Widget *Rows[FT_ESD_VIRTUALLIST_MAX_ROWS];
+	int RowIndex[FT_ESD_VIRTUALLIST_MAX_ROWS]; // Data index each row widget is bound to, -1 when unbound
+	ft_uint8_t NbRows;
+
+	int Scroll; // Pixels scrolled from the first row
+	int LastScroll;
+	int LastCount;
+
+	Ft_Esd_TouchScrollLogic Touch_Scroll;
+
+} Ft_Esd_VirtualList;
+
+void Ft_Esd_VirtualList__Initializer(Ft_Esd_VirtualList *context);
+
+ESD_SLOT(Start)
+void Ft_Esd_VirtualList_Start(Ft_Esd_VirtualList *context);
+
+ESD_SLOT(Update)
+void Ft_Esd_VirtualList_Update(Ft_Esd_VirtualList *context);
+
+ESD_SLOT(Render)
+void Ft_Esd_VirtualList_Render(Ft_Esd_VirtualList *context);
+
+ESD_SLOT(Idle)
+void Ft_Esd_VirtualList_Idle(Ft_Esd_VirtualList *context);
+
+// Add an initialized row widget to the pool of the list, returns FT_FALSE when the pool is full
+ft_bool_t Ft_Esd_VirtualList_AddRow(Ft_Esd_VirtualList *context, Ft_Esd_Widget *row);
+
+// Scroll so the row with this index is at the top
+ESD_FUNCTION(Ft_Esd_VirtualList_ScrollTo, DisplayName = "Scroll To Row", Category = EsdLayoutUtilities)
+ESD_PARAMETER(context, Type = Ft_Esd_VirtualList *)
+ESD_PARAMETER(index, Type = int)
+void Ft_Esd_VirtualList_ScrollTo(Ft_Esd_VirtualList *context, int index);
+
+// Bind all visible rows again, after the data behind them changed
+ESD_FUNCTION(Ft_Esd_VirtualList_Rebind, DisplayName = "Rebind Rows", Category = EsdLayoutUtilities)
+ESD_PARAMETER(context, Type = Ft_Esd_VirtualList *)
+void Ft_Esd_VirtualList_Rebind(Ft_Esd_VirtualList *context);
+
+// Index of the row at the top of the list
+ESD_OUTPUT(TopIndex, Type = int)
+int Ft_Esd_VirtualList_TopIndex(Ft_Esd_VirtualList *context);
+
+#endif /* FT_ESD_VIRTUALLIST_H */
+
+/* end of file */
@@ -61,6 +61,59 @@ EVE_HAL_EXPORT uint16_t EVE_Cmd_rp(EVE_HalContext *phost)
 	return rp;
 }
 
+/* Read REG_CMD_READ and REG_CMD_WRITE in one transfer */
+static void rdRpWp(EVE_HalContext *phost, uint16_t *rp, uint16_t *wp)
+{
+	uint32_t addr[2];
+	uint32_t value[2];
+	endFunc(phost);
+	addr[0] = REG_CMD_READ;
+	addr[1] = REG_CMD_WRITE;
+	EVE_Hal_rdRegs(phost, value, addr, 2);
+	*rp = value[0] & EVE_CMD_FIFO_MASK;
+	*wp = value[1] & EVE_CMD_FIFO_MASK;
+	if (EVE_CMD_FAULT(*rp))
+		phost->CmdFault = true;
+}
+
+#if EVE_CMD_FUTURES
+/* Read the results of the pending futures which the coprocessor has passed.
+Must run before free space reported by the coprocessor is written, the results are in that space */
+static void updateFutures(EVE_HalContext *phost, uint16_t rp, uint16_t wp)
+{
+	uint16_t pending = (wp - rp) & EVE_CMD_FIFO_MASK;
+	uint32_t addr[3];
+	uint8_t i, j;
+
+	for (i = 0; i < EVE_CMD_FUTURES && phost->CmdFuturesPending; ++i)
+	{
+		EVE_HalCmdFuture *future = &phost->CmdFutures[i];
+		uint16_t remaining;
+		if (future->State != EVE_CMD_FUTURE_PENDING)
+			continue;
+		if (phost->CmdFault)
+		{
+			future->State = EVE_CMD_FUTURE_FAILED;
+			--phost->CmdFuturesPending;
+			continue;
+		}
+
+		/* Passed once the end is no longer ahead of the read pointer */
+		remaining = (future->End - rp) & EVE_CMD_FIFO_MASK;
+		if (remaining && remaining <= pending)
+			continue;
+
+		for (j = 0; j < future->Words; ++j)
+			addr[j] = RAM_CMD + ((future->Address + (j << 2)) & EVE_CMD_FIFO_MASK);
+		EVE_Hal_rdRegs(phost, future->Result, addr, future->Words);
+		future->State = EVE_CMD_FUTURE_READY;
+		--phost->CmdFuturesPending;
+	}
+}
+#else
+#define updateFutures(phost, rp, wp) eve_noop()
+#endif
+
 /**
  * @brief Write to Coprocessor
  *
@@ -98,6 +151,14 @@ EVE_HAL_EXPORT uint16_t EVE_Cmd_space(EVE_HalContext *phost)
 		space = EVE_Hal_rd16(phost, REG_CMDB_SPACE) & EVE_CMD_FIFO_MASK;
 		if (EVE_CMD_FAULT(space))
 			phost->CmdFault = true;
+#if EVE_CMD_FUTURES
+		if (phost->CmdFuturesPending)
+		{
+			/* The read pointer only moves forward, so it covers at least the space read above */
+			rdRpWp(phost, &rp, &wp);
+			updateFutures(phost, rp, wp);
+		}
+#endif
 		phost->CmdSpace = space;
 		return space;
 	}
@@ -106,11 +167,274 @@ EVE_HAL_EXPORT uint16_t EVE_Cmd_space(EVE_HalContext *phost)
 		wp = EVE_Cmd_wp(phost);
 		rp = EVE_Cmd_rp(phost);
 		space = (rp - wp - 4) & EVE_CMD_FIFO_MASK;
+		updateFutures(phost, rp, wp);
 		phost->CmdSpace = space;
 		return space;
 	}
 }
 
+#if EVE_CMD_CAPTURE
+
+#define EVE_CAPTURE_NO_RECORD 0xFFFFFFFFUL
+
+static uint8_t s_CaptureBuffer[EVE_CMD_CAPTURE_BUFFER_SIZE];
+static uint32_t s_CaptureUsed = 0;
+static uint32_t s_CaptureRecord = EVE_CAPTURE_NO_RECORD; /* Offset of the open command record header in s_CaptureBuffer */
+static uint32_t s_CaptureFrames = 0; /* Frames left to capture, 0 to continue until stopped */
+static bool s_CaptureArmed = false; /* Capture starts at the next CMD_SWAP */
+
+static void capturePut32(uint32_t offset, uint32_t value)
+{
+	s_CaptureBuffer[offset] = value & 0xFF;
+	s_CaptureBuffer[offset + 1] = (value >> 8) & 0xFF;
+	s_CaptureBuffer[offset + 2] = (value >> 16) & 0xFF;
+	s_CaptureBuffer[offset + 3] = value >> 24;
+}
+
+static void captureClose(EVE_HalContext *phost)
+{
+	phost->CmdCapture = false;
+	s_CaptureArmed = false;
+	s_CaptureUsed = 0;
+	s_CaptureRecord = EVE_CAPTURE_NO_RECORD;
+	EVE_Util_closeCaptureFile(phost);
+}
+
+/* Make room for at least `size` bytes, closes the open command record when the buffer is written out */
+static bool captureReserve(EVE_HalContext *phost, uint32_t size)
+{
+	if (s_CaptureUsed + size <= EVE_CMD_CAPTURE_BUFFER_SIZE)
+		return true;
+	eve_assert(s_CaptureRecord == EVE_CAPTURE_NO_RECORD || !((s_CaptureUsed - s_CaptureRecord) & 0x3));
+	s_CaptureRecord = EVE_CAPTURE_NO_RECORD;
+	if (!EVE_Util_writeCaptureFile(phost, s_CaptureBuffer, s_CaptureUsed))
+	{
+		eve_printf_debug("Capture file write failed\n");
+		captureClose(phost);
+		return false;
+	}
+	s_CaptureUsed = 0;
+	return true;
+}
+
+static void captureCmd(EVE_HalContext *phost, const void *buffer, uint32_t size, bool progmem)
+{
+	uint32_t i;
+	for (i = 0; i < size; ++i)
+	{
+		if (s_CaptureRecord == EVE_CAPTURE_NO_RECORD || s_CaptureUsed == EVE_CMD_CAPTURE_BUFFER_SIZE)
+		{
+			if (!captureReserve(phost, 8))
+				return;
+			s_CaptureRecord = s_CaptureUsed;
+			capturePut32(s_CaptureRecord, EVE_CAPTURE_RECORD(EVE_CAPTURE_CMD, 0));
+			s_CaptureUsed += 4;
+		}
+		s_CaptureBuffer[s_CaptureUsed++] = progmem
+		    ? ((eve_progmem_const uint8_t *)(uintptr_t)buffer)[i]
+		    : ((const uint8_t *)buffer)[i];
+		capturePut32(s_CaptureRecord, EVE_CAPTURE_RECORD(EVE_CAPTURE_CMD, s_CaptureUsed - s_CaptureRecord - 4));
+	}
+}
+
+static void captureZeros(EVE_HalContext *phost, uint32_t size)
+{
+	static const uint8_t zeros[4] = { 0 };
+	while (size)
+	{
+		uint32_t n = min(size, 4);
+		captureCmd(phost, zeros, n, false);
+		size -= n;
+	}
+}
+
+static void captureTransfer(EVE_HalContext *phost, const void *buffer, uint32_t transfer, bool progmem, bool string)
+{
+	if (string)
+	{
+		/* String, the terminator, then zero padding */
+		uint32_t len = (uint32_t)strnlen((const char *)buffer, transfer) + 1;
+		if (len > transfer)
+			len = transfer;
+		captureCmd(phost, buffer, len, false);
+		captureZeros(phost, transfer - len);
+	}
+	else
+	{
+		captureCmd(phost, buffer, transfer, progmem);
+	}
+}
+
+EVE_HAL_EXPORT void EVE_Cmd_captureMem(EVE_HalContext *phost, uint32_t addr, const void *buffer, uint32_t size, bool progmem)
+{
+	const uint8_t *src = (const uint8_t *)buffer;
+	s_CaptureRecord = EVE_CAPTURE_NO_RECORD;
+	while (size && phost->CmdCapture)
+	{
+		uint32_t n, i;
+		if (!captureReserve(phost, 12))
+			return;
+		n = min(size, (EVE_CMD_CAPTURE_BUFFER_SIZE - s_CaptureUsed - 8) & ~0x3UL);
+		capturePut32(s_CaptureUsed, EVE_CAPTURE_RECORD(EVE_CAPTURE_MEM, n));
+		capturePut32(s_CaptureUsed + 4, addr);
+		s_CaptureUsed += 8;
+		for (i = 0; i < n; ++i)
+			s_CaptureBuffer[s_CaptureUsed++] = progmem ? ((eve_progmem_const uint8_t *)(uintptr_t)src)[i] : src[i];
+		while (s_CaptureUsed & 0x3)
+			s_CaptureBuffer[s_CaptureUsed++] = 0;
+		src += n;
+		addr += n;
+		size -= n;
+	}
+}
+
+EVE_HAL_EXPORT bool EVE_Cmd_startCapture(EVE_HalContext *phost, const char *filename, uint32_t frames)
+{
+	if (phost->CmdCapture || s_CaptureArmed)
+		return false;
+	if (!EVE_Util_openCaptureFile(phost, filename))
+		return false;
+	capturePut32(0, EVE_CAPTURE_MAGIC);
+	capturePut32(4, EVE_CHIPID);
+	s_CaptureUsed = 8;
+	s_CaptureRecord = EVE_CAPTURE_NO_RECORD;
+	s_CaptureFrames = frames;
+	s_CaptureArmed = true;
+	return true;
+}
+
+EVE_HAL_EXPORT void EVE_Cmd_stopCapture(EVE_HalContext *phost)
+{
+	if (!phost->CmdCapture && !s_CaptureArmed)
+		return;
+	if (s_CaptureUsed && !EVE_Util_writeCaptureFile(phost, s_CaptureBuffer, s_CaptureUsed))
+		eve_printf_debug("Capture file write failed\n");
+	captureClose(phost);
+}
+
+EVE_HAL_EXPORT void EVE_Cmd_captureSwap(EVE_HalContext *phost)
+{
+	if (s_CaptureArmed)
+	{
+		/* Start with a complete frame */
+		s_CaptureArmed = false;
+		phost->CmdCapture = true;
+		return;
+	}
+	if (!phost->CmdCapture)
+		return;
+
+	s_CaptureRecord = EVE_CAPTURE_NO_RECORD;
+	if (!captureReserve(phost, 4))
+		return;
+	capturePut32(s_CaptureUsed, EVE_CAPTURE_RECORD(EVE_CAPTURE_FRAME, 0));
+	s_CaptureUsed += 4;
+	if (s_CaptureFrames && !--s_CaptureFrames)
+		EVE_Cmd_stopCapture(phost);
+}
+
+#endif
+
+#if EVE_CMD_FAULT_TRACE
+
+EVE_HAL_EXPORT void (*EVE_Cmd_faultSink)(EVE_HalContext *phost, const EVE_CmdFaultReport *report) = EVE_Cmd_printFault;
+
+static void traceBytes(EVE_HalContext *phost, const void *buffer, uint32_t size, bool progmem)
+{
+	uint32_t i = 0;
+
+	/* Only the newest words are kept, whole words at the start of a long transfer are skipped */
+	if (size > (EVE_CMD_FAULT_TRACE_WORDS * 4) && !(phost->CmdTraceBytes & 0x3))
+	{
+		i = (size - (EVE_CMD_FAULT_TRACE_WORDS * 4)) & ~0x3UL;
+		phost->CmdTraceBytes += i;
+	}
+	for (; i < size; ++i)
+	{
+		uint32_t *word = &phost->CmdTrace[(phost->CmdTraceBytes >> 2) & (EVE_CMD_FAULT_TRACE_WORDS - 1)];
+		uint32_t shift = (phost->CmdTraceBytes & 0x3) << 3;
+		uint8_t value = progmem
+		    ? ((eve_progmem_const uint8_t *)(uintptr_t)buffer)[i]
+		    : ((const uint8_t *)buffer)[i];
+		if (!shift)
+			*word = 0;
+		*word |= (uint32_t)value << shift;
+		++phost->CmdTraceBytes;
+	}
+}
+
+static void traceZeros(EVE_HalContext *phost, uint32_t size)
+{
+	static const uint8_t zeros[4] = { 0 };
+	while (size)
+	{
+		uint32_t n = min(size, 4);
+		traceBytes(phost, zeros, n, false);
+		size -= n;
+	}
+}
+
+static void traceTransfer(EVE_HalContext *phost, const void *buffer, uint32_t transfer, bool progmem, bool string)
+{
+	if (string)
+	{
+		/* String, the terminator, then zero padding */
+		uint32_t len = (uint32_t)strnlen((const char *)buffer, transfer) + 1;
+		if (len > transfer)
+			len = transfer;
+		traceBytes(phost, buffer, len, false);
+		traceZeros(phost, transfer - len);
+	}
+	else
+	{
+		traceBytes(phost, buffer, transfer, progmem);
+	}
+}
+
+EVE_HAL_EXPORT void EVE_Cmd_printFault(EVE_HalContext *phost, const EVE_CmdFaultReport *report)
+{
+	uint32_t i;
+
+	eve_printf("Coprocessor fault, REG_CMD_READ 0x%04x, REG_CMD_WRITE 0x%04x: %s\n",
+	    (unsigned int)report->Rp, (unsigned int)report->Wp, report->Error);
+	for (i = 0; i < report->Count; i += 4)
+	{
+		/* Offset of the first word of the line in the command FIFO */
+		uint32_t offset = (report->Wp - ((report->Count - i) << 2)) & EVE_CMD_FIFO_MASK;
+		eve_printf("  %03x:", (unsigned int)offset);
+		for (uint32_t j = i; j < i + 4 && j < report->Count; ++j)
+			eve_printf(" %08x", (unsigned int)report->Words[j]);
+		eve_printf("\n");
+	}
+}
+
+/* Report the last command words and the error, costs a few register reads */
+static void traceFault(EVE_HalContext *phost, uint16_t rp, char *err)
+{
+	uint32_t words[EVE_CMD_FAULT_TRACE_WORDS];
+	uint32_t count = phost->CmdTraceBytes >> 2;
+	uint32_t first;
+	EVE_CmdFaultReport report;
+
+	if (!EVE_Cmd_faultSink)
+		return;
+
+	if (count > EVE_CMD_FAULT_TRACE_WORDS)
+		count = EVE_CMD_FAULT_TRACE_WORDS;
+	first = (phost->CmdTraceBytes >> 2) - count;
+	for (uint32_t i = 0; i < count; ++i)
+		words[i] = phost->CmdTrace[(first + i) & (EVE_CMD_FAULT_TRACE_WORDS - 1)];
+
+	report.Words = words;
+	report.Count = count;
+	report.Rp = rp;
+	report.Wp = EVE_Hal_rd16(phost, REG_CMD_WRITE) & EVE_CMD_FIFO_MASK;
+	report.Error = err;
+	EVE_Cmd_faultSink(phost, &report);
+}
+
+#endif
+
 /**
  * @brief Start transfer data to EVE
  *
@@ -118,6 +442,10 @@ EVE_HAL_EXPORT uint16_t EVE_Cmd_space(EVE_HalContext *phost)
  */
 static void startBufferTransfer(EVE_HalContext *phost)
 {
+#if EVE_ASYNC_TRANSFER
+	/* An asynchronous write still holds the transfer open until it completes, and may close it then */
+	EVE_Hal_transferWait(phost);
+#endif
 	if (phost->Status != EVE_STATUS_WRITING)
 	{
 		if (EVE_Hal_supportCmdB(phost))
@@ -202,16 +530,33 @@ static uint32_t wrBuffer(EVE_HalContext *phost, const void *buffer, uint32_t siz
 			{
 				EVE_Hal_transferMem(phost, NULL, &((uint8_t *)buffer)[transfered], transfer);
 			}
+#if EVE_CMD_CAPTURE
+			if (phost->CmdCapture)
+				captureTransfer(phost, &((uint8_t *)buffer)[transfered], transfer, progmem, string);
+#endif
+#if EVE_CMD_FAULT_TRACE
+			traceTransfer(phost, &((uint8_t *)buffer)[transfered], transfer, progmem, string);
+#endif
 			if (!string && (transfer & 0x3))
 			{
 				uint32_t pad = 4 - (transfer & 0x3);
 				uint8_t padding[4] = { 0 };
 				eve_assert((transfered + transfer) == size);
 				EVE_Hal_transferMem(phost, NULL, padding, pad);
+#if EVE_CMD_CAPTURE
+				if (phost->CmdCapture)
+					captureCmd(phost, padding, pad, false);
+#endif
+#if EVE_CMD_FAULT_TRACE
+				traceBytes(phost, padding, pad, false);
+#endif
 				transfer += pad;
 				eve_assert(!(transfer & 0x3));
 			}
 			transfered += transfer;
+#if EVE_HAL_STATS
+			phost->Stats.CmdWords += transfer >> 2;
+#endif
 			if (!phost->CmdFunc) /* Keep alive while writing function */
 			{
 				EVE_Hal_endTransfer(phost);
@@ -264,6 +609,46 @@ EVE_HAL_EXPORT bool EVE_Cmd_wrMem(EVE_HalContext *phost, const uint8_t *buffer,
 	return wrBuffer(phost, buffer, size, false, false) == size;
 }
 
+#if EVE_ASYNC_TRANSFER
+/**
+ * @brief Write buffer to Coprocessor's comand fifo without waiting for the SPI transfer
+ *
+ * @param phost Pointer to Hal context
+ * @param buffer Data buffer, must remain valid until the write completes
+ * @param size Size to write, a multiple of 4 bytes
+ * @return true True if ok
+ * @return false False if error
+ */
+EVE_HAL_EXPORT bool EVE_Cmd_wrMemAsync(EVE_HalContext *phost, const uint8_t *buffer, uint32_t size)
+{
+	eve_assert(!phost->CmdWaiting);
+	eve_assert(phost->CmdBufferIndex == 0);
+	eve_assert(!phost->CmdFunc);
+	eve_assert(!(size & 0x3));
+
+	if (phost->CmdSpace < size && !EVE_Cmd_waitSpace(phost, size))
+		return false;
+	eve_assert(size <= EVE_CMD_FIFO_SIZE - 4);
+	if (!size)
+		return true;
+
+	startBufferTransfer(phost);
+	EVE_Hal_transferMemAsync(phost, buffer, size, true);
+#if EVE_CMD_CAPTURE
+	if (phost->CmdCapture)
+		captureTransfer(phost, buffer, size, false, false);
+#endif
+#if EVE_CMD_FAULT_TRACE
+	traceTransfer(phost, buffer, size, false, false);
+#endif
+#if EVE_HAL_STATS
+	phost->Stats.CmdWords += size >> 2;
+#endif
+	phost->CmdSpace -= size;
+	return true;
+}
+#endif
+
 /**
  * @brief Write buffer in ProgMem to Coprocessor's comand fifo
  *
@@ -297,6 +682,31 @@ EVE_HAL_EXPORT uint32_t EVE_Cmd_wrString(EVE_HalContext *phost, const char *str,
 	return transfered;
 }
 
+/**
+ * @brief Write a string of known length into Coprocessor's command fifo
+ *
+ * @param phost Pointer to Hal context
+ * @param str String to write, does not need to be terminated
+ * @param length Length of the string, excluding the terminator
+ * @return uint32_t Number of bytes transfered, including terminator and padding
+ */
+EVE_HAL_EXPORT uint32_t EVE_Cmd_wrStringN(EVE_HalContext *phost, const char *str, uint32_t length)
+{
+	uint32_t body = length & ~0x3UL;
+	uint32_t tail = length & 0x3UL;
+	uint8_t last[4] = { 0 };
+	uint32_t transfered;
+	eve_assert(!phost->CmdWaiting);
+	eve_assert(phost->CmdBufferIndex == 0);
+
+	/* Whole words as a block, the remaining bytes with the terminator in the last word */
+	transfered = body ? wrBuffer(phost, str, body, false, false) : 0;
+	if (transfered != body)
+		return transfered; /* Coprocessor fault */
+	memcpy(last, &str[body], tail);
+	return transfered + wrBuffer(phost, last, 4, false, false);
+}
+
 /**
  * @brief Write a byte to Coprocessor's command fifo
  *
@@ -360,7 +770,11 @@ EVE_HAL_EXPORT bool EVE_Cmd_wr16(EVE_HalContext *phost, uint16_t value)
  * @return true True if ok
  * @return false False if error
  */
+#if EVE_SINGLE_TARGET_FT811
+EVE_HAL_EXPORT bool EVE_CmdImpl_wr32(EVE_HalContext *phost, uint32_t value)
+#else
 EVE_HAL_EXPORT bool EVE_Cmd_wr32(EVE_HalContext *phost, uint32_t value)
+#endif
 {
 	eve_assert(!phost->CmdWaiting);
 	eve_assert(phost->CmdBufferIndex == 0);
@@ -368,6 +782,9 @@ EVE_HAL_EXPORT bool EVE_Cmd_wr32(EVE_HalContext *phost, uint32_t value)
 	if (phost->CmdSpace < 4 && !EVE_Cmd_waitSpace(phost, 4))
 		return false;
 
+#if EVE_ASYNC_TRANSFER
+	EVE_Hal_transferWait(phost);
+#endif
 	if (phost->Status != EVE_STATUS_WRITING)
 	{
 		if (EVE_Hal_supportCmdB(phost))
@@ -380,6 +797,17 @@ EVE_HAL_EXPORT bool EVE_Cmd_wr32(EVE_HalContext *phost, uint32_t value)
 		}
 	}
 	EVE_Hal_transfer32(phost, value);
+	EVE_Cmd_traceWord(phost, value);
+#if EVE_HAL_STATS
+	++phost->Stats.CmdWords;
+#endif
+#if EVE_CMD_CAPTURE
+	if (phost->CmdCapture)
+	{
+		uint8_t bytes[4] = { value & 0xFF, (value >> 8) & 0xFF, (value >> 16) & 0xFF, value >> 24 };
+		captureCmd(phost, bytes, 4, false);
+	}
+#endif
 	if (!phost->CmdFunc) /* Keep alive while writing function */
 	{
 		EVE_Hal_endTransfer(phost);
@@ -410,6 +838,14 @@ EVE_HAL_EXPORT uint16_t EVE_Cmd_moveWp(EVE_HalContext *phost, uint16_t bytes)
 	prevWp = EVE_Cmd_wp(phost);
 	wp = (prevWp + bytes) & EVE_CMD_FIFO_MASK;
 	EVE_Hal_wr16(phost, REG_CMD_WRITE, wp);
+	phost->CmdSpace -= bytes; /* The skipped bytes hold the command result, which must not be written over */
+#if EVE_CMD_CAPTURE
+	if (phost->CmdCapture)
+		captureZeros(phost, bytes); /* Overwritten by the result when replayed through REG_CMDB_WRITE */
+#endif
+#if EVE_CMD_FAULT_TRACE
+	traceZeros(phost, bytes); /* Result space, not read back */
+#endif
 
 	return prevWp;
 }
@@ -435,6 +871,16 @@ static bool checkWait(EVE_HalContext *phost, uint16_t rpOrSpace)
 		err[0] = '\0';
 		/* Coprocessor fault */
 		phost->CmdWaiting = false;
+#if EVE_CMD_FAULT_TRACE || defined(_DEBUG)
+		if (EVE_CHIPID >= EVE_BT815)
+		{
+			EVE_Hal_rdMem(phost, (uint8_t *)err, RAM_ERR_REPORT, 128);
+			err[127] = '\0';
+		}
+#endif
+#if EVE_CMD_FAULT_TRACE
+		traceFault(phost, EVE_Hal_rd16(phost, REG_CMD_READ), err);
+#endif
 #if defined(_DEBUG)
 		if (!phost->DebugMessageVisible)
 		{
@@ -442,7 +888,6 @@ static bool checkWait(EVE_HalContext *phost, uint16_t rpOrSpace)
 			debugBackupRamG(phost);
 			if (EVE_CHIPID >= EVE_BT815)
 			{
-				EVE_Hal_rdMem(phost, (uint8_t *)err, RAM_ERR_REPORT, 128);
 				eve_printf_debug("%s\n", err);
 				EVE_Hal_displayMessage(phost, err, 128);
 			}
@@ -507,16 +952,21 @@ EVE_HAL_EXPORT bool EVE_Cmd_waitFlush(EVE_HalContext *phost)
 
 	eve_assert(!phost->CmdWaiting);
 	phost->CmdWaiting = true;
-	while ((rp = EVE_Cmd_rp(phost)) != (wp = EVE_Cmd_wp(phost)))
+	for (;;)
 	{
+		rdRpWp(phost, &rp, &wp);
+		if (rp == wp)
+			break;
 		if (!handleWait(phost, rp))
 		{
+			updateFutures(phost, rp, wp);
 			phost->CmdSpace = (rp - wp - 4) & EVE_CMD_FIFO_MASK;
 			return false;
 		}
 	}
 
 	/* Command buffer empty */
+	updateFutures(phost, rp, wp);
 	phost->CmdSpace = EVE_CMD_FIFO_SIZE - 4;
 	phost->CmdWaiting = false;
 	return true;
@@ -549,12 +999,20 @@ EVE_HAL_EXPORT uint32_t EVE_Cmd_waitSpace(EVE_HalContext *phost, uint32_t size)
 		return 0;
 #endif
 
-	/* Wait until there's sufficient space */
-	while (space < size)
+	if (space < size)
 	{
-		space = EVE_Cmd_space(phost);
-		if (!handleWait(phost, space))
-			return 0;
+		/* The host is writing faster than the coprocessor consumes, so resume only once a larger chunk
+		is free, this way the following small writes are served from the cached space without polling.
+		Stop at the requested size as soon as the coprocessor stops draining, it may be waiting on the host */
+		uint16_t target = (uint16_t)min(max(size, EVE_CMD_SPACE_CHUNK), EVE_CMD_FIFO_SIZE - 4);
+		uint16_t prevSpace;
+		do
+		{
+			prevSpace = space;
+			space = EVE_Cmd_space(phost);
+			if (!handleWait(phost, space))
+				return 0;
+		} while (space < size || (space < target && space > prevSpace));
 	}
 
 	/* Sufficient space */
@@ -579,8 +1037,7 @@ EVE_HAL_EXPORT bool EVE_Cmd_waitLogo(EVE_HalContext *phost)
 
 	do
 	{
-		rp = EVE_Cmd_rp(phost);
-		wp = EVE_Cmd_wp(phost);
+		rdRpWp(phost, &rp, &wp);
 		if (!handleWait(phost, rp))
 			return false;
 
@@ -600,8 +1057,11 @@ EVE_HAL_EXPORT bool EVE_Cmd_waitRead32(EVE_HalContext *phost, uint32_t ptr, uint
 
 	eve_assert(!phost->CmdWaiting);
 	phost->CmdWaiting = true;
-	while ((rp = EVE_Cmd_rp(phost)) != (wp = EVE_Cmd_wp(phost)))
+	for (;;)
 	{
+		rdRpWp(phost, &rp, &wp);
+		if (rp == wp)
+			break;
 		if (EVE_Hal_rd32(phost, ptr) == value)
 		{
 			/* Expected value has been read */
@@ -610,12 +1070,14 @@ EVE_HAL_EXPORT bool EVE_Cmd_waitRead32(EVE_HalContext *phost, uint32_t ptr, uint
 		}
 		if (!handleWait(phost, rp))
 		{
+			updateFutures(phost, rp, wp);
 			phost->CmdSpace = (rp - wp - 4) & EVE_CMD_FIFO_MASK;
 			return false;
 		}
 	}
 
 	/* Command buffer empty */
+	updateFutures(phost, rp, wp);
 	phost->CmdSpace = EVE_CMD_FIFO_SIZE - 4;
 	phost->CmdWaiting = false;
 	return EVE_Hal_rd32(phost, ptr) == value;
@@ -630,4 +1092,136 @@ EVE_HAL_EXPORT void EVE_Cmd_restore(EVE_HalContext *phost)
 	EVE_Cmd_space(phost);
 }
 
+#if EVE_CMD_FUTURES
+
+static EVE_HalCmdFuture *getFuture(EVE_HalContext *phost, EVE_CmdFuture handle)
+{
+	uint8_t idx = handle & 0xFF;
+	EVE_HalCmdFuture *future;
+	if (idx >= EVE_CMD_FUTURES)
+		return NULL;
+	future = &phost->CmdFutures[idx];
+	if (future->State == EVE_CMD_FUTURE_FREE || future->Sequence != (handle >> 8))
+		return NULL; /* Already taken, or the slot was reused */
+	return future;
+}
+
+/* Track the result of the command which was just written.
+Returns EVE_CMD_FUTURE_INVALID in case a coprocessor fault occurred */
+EVE_HAL_EXPORT EVE_CmdFuture EVE_Cmd_future(EVE_HalContext *phost, uint16_t resAddr, uint8_t words)
+{
+	EVE_HalCmdFuture *future = NULL;
+	uint8_t idx = phost->CmdFutureNext;
+	uint8_t i;
+
+	eve_assert(words && words <= 3);
+	if (resAddr == 0xFFFF || phost->CmdFault)
+		return EVE_CMD_FUTURE_INVALID;
+
+	/* Take a free slot, or else the one of a result that was left unclaimed */
+	for (i = 0; i < EVE_CMD_FUTURES && !future; ++i)
+	{
+		if (phost->CmdFutures[idx].State == EVE_CMD_FUTURE_FREE)
+			future = &phost->CmdFutures[idx];
+		else
+			idx = (idx + 1) % EVE_CMD_FUTURES;
+	}
+	for (i = 0; i < EVE_CMD_FUTURES && !future; ++i)
+	{
+		if (phost->CmdFutures[idx].State != EVE_CMD_FUTURE_PENDING)
+			future = &phost->CmdFutures[idx];
+		else
+			idx = (idx + 1) % EVE_CMD_FUTURES;
+	}
+	if (!future)
+	{
+		/* All pending, resolve them the blocking way and reuse the oldest */
+		if (!EVE_Cmd_waitFlush(phost))
+			return EVE_CMD_FUTURE_INVALID;
+		idx = phost->CmdFutureNext;
+		future = &phost->CmdFutures[idx];
+	}
+
+	future->Address = resAddr;
+	future->End = (resAddr + (words << 2)) & EVE_CMD_FIFO_MASK;
+	future->Words = words;
+	future->State = EVE_CMD_FUTURE_PENDING;
+	future->Sequence = ++phost->CmdFutureSequence;
+	++phost->CmdFuturesPending;
+	phost->CmdFutureNext = (idx + 1) % EVE_CMD_FUTURES;
+	return (EVE_CmdFuture)(((uint16_t)future->Sequence << 8) | idx);
+}
+
+/* Check whether the result is available without waiting, polls the read pointer while pending.
+Returns true once EVE_Cmd_futureGet will not wait */
+EVE_HAL_EXPORT bool EVE_Cmd_futurePoll(EVE_HalContext *phost, EVE_CmdFuture handle)
+{
+	EVE_HalCmdFuture *future = getFuture(phost, handle);
+	uint16_t rp;
+	uint16_t wp;
+
+	if (!future)
+		return true;
+	if (future->State == EVE_CMD_FUTURE_PENDING)
+	{
+		rdRpWp(phost, &rp, &wp);
+		updateFutures(phost, rp, wp);
+	}
+	return future->State != EVE_CMD_FUTURE_PENDING;
+}
+
+/* Get the result, waits only until the coprocessor has passed the command, and frees the handle.
+Returns false in case a coprocessor fault occurred, or when the handle is no longer valid */
+EVE_HAL_EXPORT bool EVE_Cmd_futureGet(EVE_HalContext *phost, EVE_CmdFuture handle, uint32_t *result, uint8_t words)
+{
+	EVE_HalCmdFuture *future = getFuture(phost, handle);
+	uint16_t rp;
+	uint16_t wp;
+	uint8_t i;
+
+	if (!future)
+		return false;
+
+	if (future->State == EVE_CMD_FUTURE_PENDING)
+	{
+		eve_assert(!phost->CmdWaiting);
+		phost->CmdWaiting = true;
+		for (;;)
+		{
+			rdRpWp(phost, &rp, &wp);
+			updateFutures(phost, rp, wp);
+			if (future->State != EVE_CMD_FUTURE_PENDING)
+				break;
+			if (!handleWait(phost, rp))
+				return false; /* Stays pending, may be retried */
+		}
+		phost->CmdWaiting = false;
+	}
+
+	if (future->State != EVE_CMD_FUTURE_READY)
+	{
+		future->State = EVE_CMD_FUTURE_FREE;
+		return false;
+	}
+	eve_assert(words <= future->Words);
+	for (i = 0; i < words; ++i)
+		result[i] = future->Result[i];
+	future->State = EVE_CMD_FUTURE_FREE;
+	return true;
+}
+
+/* Fail all pending futures, called when the coprocessor is reset */
+EVE_HAL_EXPORT void EVE_Cmd_cancelFutures(EVE_HalContext *phost)
+{
+	uint8_t i;
+	for (i = 0; i < EVE_CMD_FUTURES; ++i)
+	{
+		if (phost->CmdFutures[i].State == EVE_CMD_FUTURE_PENDING)
+			phost->CmdFutures[i].State = EVE_CMD_FUTURE_FAILED;
+	}
+	phost->CmdFuturesPending = 0;
+}
+
+#endif
+
 /* end of file */
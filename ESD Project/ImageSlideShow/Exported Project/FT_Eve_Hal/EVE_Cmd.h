@@ -38,6 +38,7 @@
 #ifndef EVE_CMD__H
 #define EVE_CMD__H
 #include "EVE_HalDefs.h"
+#include "EVE_GpuDefs.h"
 
 /********************
 ** COPROCESSOR CMD **
@@ -72,6 +73,14 @@ Waits if there is not enough space in the command buffer.
 Returns false in case a coprocessor fault occurred */
 EVE_HAL_EXPORT bool EVE_Cmd_wrMem(EVE_HalContext *phost, const uint8_t *buffer, uint32_t size);
 
+#if EVE_ASYNC_TRANSFER
+/* Write a buffer of at most EVE_CMD_FIFO_SIZE - 4 bytes, a multiple of 4, to the command buffer,
+without waiting for it to be clocked out. See EVE_Hal_transferMemAsync, the buffer must remain valid
+until the next HAL call. Waits if there is not enough space in the command buffer.
+Returns false in case a coprocessor fault occurred */
+EVE_HAL_EXPORT bool EVE_Cmd_wrMemAsync(EVE_HalContext *phost, const uint8_t *buffer, uint32_t size);
+#endif
+
 /* Write a progmem buffer to the command buffer.
 Waits if there is not enough space in the command buffer.
 Returns false in case a coprocessor fault occurred */
@@ -83,6 +92,12 @@ Parameter `maxLength` can be set up to `EVE_CMD_STRING_MAX`.
 Returns false in case a coprocessor fault occurred */
 EVE_HAL_EXPORT uint32_t EVE_Cmd_wrString(EVE_HalContext *phost, const char *str, uint32_t maxLength);
 
+/* Write a string of known length to the command buffer, terminated and padded to 4 bytes.
+The string is copied as a block without scanning for the terminator, and may be split over
+the available space, so it is not limited to half of the command buffer.
+Returns the number of bytes written including the terminator and padding */
+EVE_HAL_EXPORT uint32_t EVE_Cmd_wrStringN(EVE_HalContext *phost, const char *str, uint32_t length);
+
 /* Write a 8-bit value to the command buffer.
 Uses a cache to write 4 bytes at once.
 Waits if there is not enough space in the command buffer.
@@ -96,11 +111,71 @@ Waits if there is not enough space in the command buffer.
 Returns false in case a coprocessor fault occurred */
 EVE_HAL_EXPORT bool EVE_Cmd_wr16(EVE_HalContext *phost, uint16_t value);
 
+#if EVE_CMD_FAULT_TRACE
+
+/* Coprocessor fault report, see EVE_Cmd_faultSink */
+typedef struct EVE_CmdFaultReport
+{
+	const uint32_t *Words; /* Last words written to the command FIFO, oldest first */
+	uint32_t Count; /* Number of words, up to EVE_CMD_FAULT_TRACE_WORDS */
+	uint16_t Rp; /* REG_CMD_READ as read at the fault */
+	uint16_t Wp; /* REG_CMD_WRITE, the newest word ends here */
+	const char *Error; /* Coprocessor error string, empty before BT815 */
+} EVE_CmdFaultReport;
+
+/* Called once per coprocessor fault, before the fault is handled by the caller of the wait.
+Defaults to EVE_Cmd_printFault, set to NULL to skip the report */
+EVE_HAL_EXPORT extern void (*EVE_Cmd_faultSink)(EVE_HalContext *phost, const EVE_CmdFaultReport *report);
+
+/* Print the report with eve_printf, so it also goes out in release builds */
+EVE_HAL_EXPORT void EVE_Cmd_printFault(EVE_HalContext *phost, const EVE_CmdFaultReport *report);
+
+/* Keep a word written to the command FIFO for the fault report */
+static inline void EVE_Cmd_traceWord(EVE_HalContext *phost, uint32_t value)
+{
+	phost->CmdTrace[(phost->CmdTraceBytes >> 2) & (EVE_CMD_FAULT_TRACE_WORDS - 1)] = value;
+	phost->CmdTraceBytes += 4;
+}
+
+#else
+
+#define EVE_Cmd_traceWord(phost, value) eve_noop()
+
+#endif
+
 /* Write a value to the command buffer.
 Wire endianness is handled by the transfer.
 Waits if there is not enough space in the command buffer.
 Returns false in case a coprocessor fault occurred */
+#if EVE_SINGLE_TARGET_FT811
+EVE_HAL_EXPORT bool EVE_CmdImpl_wr32(EVE_HalContext *phost, uint32_t value);
+static inline bool EVE_Cmd_wr32(EVE_HalContext *phost, uint32_t value)
+{
+#if EVE_CMD_CAPTURE
+	if (phost->CmdSpace < 4 || phost->CmdCapture)
+#else
+	if (phost->CmdSpace < 4)
+#endif
+		return EVE_CmdImpl_wr32(phost, value);
+
+#if EVE_ASYNC_TRANSFER
+	EVE_Hal_transferWait(phost);
+#endif
+	if (phost->Status != EVE_STATUS_WRITING)
+		EVE_Hal_startTransfer(phost, EVE_TRANSFER_WRITE, REG_CMDB_WRITE);
+	EVE_Hal_transfer32(phost, value);
+	EVE_Cmd_traceWord(phost, value);
+#if EVE_HAL_STATS
+	++phost->Stats.CmdWords;
+#endif
+	if (!phost->CmdFunc) /* Keep alive while writing function */
+		EVE_Hal_endTransfer(phost);
+	phost->CmdSpace -= 4;
+	return true;
+}
+#else
 EVE_HAL_EXPORT bool EVE_Cmd_wr32(EVE_HalContext *phost, uint32_t value);
+#endif
 
 /* Move the write pointer forward by the specified number of bytes.
 Returns the previous write pointer */
@@ -127,6 +202,61 @@ EVE_HAL_EXPORT bool EVE_Cmd_waitRead32(EVE_HalContext *phost, uint32_t ptr, uint
 Call this after manually writing the the coprocessor buffer */
 EVE_HAL_EXPORT void EVE_Cmd_restore(EVE_HalContext *phost);
 
+/* Capture file format, all words little endian.
+The file starts with EVE_CAPTURE_MAGIC and the chip id, followed by records.
+Each record starts with a word combining the record type and the data size in bytes,
+data of memory records is preceded by the address and padded to 4 bytes */
+#define EVE_CAPTURE_MAGIC 0x43455645UL /* "EVEC" */
+#define EVE_CAPTURE_CMD 1 /* Bytes written into the command FIFO */
+#define EVE_CAPTURE_MEM 2 /* Bytes written to an address with EVE_Hal_wrMem */
+#define EVE_CAPTURE_FRAME 3 /* CMD_SWAP was sent, no data */
+#define EVE_CAPTURE_RECORD(type, size) (((uint32_t)(type) << 24) | ((size)&0xFFFFFF))
+
+#if EVE_CMD_CAPTURE
+
+/* Capture the following frames into a file on the SD card, for replay with EVE_Util_replayCmdFile.
+Capture starts after the next CMD_SWAP and ends after `frames` more swaps, 0 keeps going until
+EVE_Cmd_stopCapture. Records the command FIFO and RAM_G writes, register writes are not captured.
+Returns false if the file cannot be created or a capture is already running */
+EVE_HAL_EXPORT bool EVE_Cmd_startCapture(EVE_HalContext *phost, const char *filename, uint32_t frames);
+
+/* End the capture and close the file */
+EVE_HAL_EXPORT void EVE_Cmd_stopCapture(EVE_HalContext *phost);
+
+/* Called after CMD_SWAP was written */
+EVE_HAL_EXPORT void EVE_Cmd_captureSwap(EVE_HalContext *phost);
+
+/* Called by EVE_Hal_wrMem and EVE_Hal_wrProgMem while capturing */
+EVE_HAL_EXPORT void EVE_Cmd_captureMem(EVE_HalContext *phost, uint32_t addr, const void *buffer, uint32_t size, bool progmem);
+
+#endif
+
+#if EVE_CMD_FUTURES
+
+/* Track the result of the command which was just written, at `resAddr` as returned by EVE_Cmd_moveWp.
+The result is read back once the coprocessor has passed it, while the host keeps writing.
+If all slots are pending, waits for the command buffer to empty.
+Returns EVE_CMD_FUTURE_INVALID in case a coprocessor fault occurred */
+EVE_HAL_EXPORT EVE_CmdFuture EVE_Cmd_future(EVE_HalContext *phost, uint16_t resAddr, uint8_t words);
+
+/* Check whether the result is available without waiting.
+Returns true once EVE_Cmd_futureGet will not wait */
+EVE_HAL_EXPORT bool EVE_Cmd_futurePoll(EVE_HalContext *phost, EVE_CmdFuture future);
+
+/* Get the result and free the handle, waits until the coprocessor has passed the command.
+Unclaimed results are dropped when their slot is needed for a newer future.
+Returns false in case a coprocessor fault occurred, or when the handle is no longer valid */
+EVE_HAL_EXPORT bool EVE_Cmd_futureGet(EVE_HalContext *phost, EVE_CmdFuture future, uint32_t *result, uint8_t words);
+
+/* Fail all pending futures, the coprocessor will not pass them anymore */
+EVE_HAL_EXPORT void EVE_Cmd_cancelFutures(EVE_HalContext *phost);
+
+#else
+
+#define EVE_Cmd_cancelFutures(phost) eve_noop()
+
+#endif
+
 #endif /* #ifndef EVE_HAL_INCL__H */
 
 /* end of file */
\ No newline at end of file
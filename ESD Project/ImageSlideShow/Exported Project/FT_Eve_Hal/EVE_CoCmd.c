@@ -35,6 +35,7 @@
 ***********************************************************************
 **********************************************************************/
 
+#if !(EVE_SINGLE_TARGET_FT811 && !EVE_CMD_HOOKS)
 EVE_HAL_EXPORT void EVE_CoCmd_d(EVE_HalContext *phost, uint32_t cmd)
 {
 #if EVE_CMD_HOOKS
@@ -44,6 +45,7 @@ EVE_HAL_EXPORT void EVE_CoCmd_d(EVE_HalContext *phost, uint32_t cmd)
 
 	EVE_Cmd_wr32(phost, cmd);
 }
+#endif
 
 EVE_HAL_EXPORT void EVE_CoCmd_dd(EVE_HalContext *phost, uint32_t cmd, uint32_t d0)
 {
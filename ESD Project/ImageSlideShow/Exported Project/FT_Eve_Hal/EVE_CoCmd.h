@@ -64,7 +64,14 @@ Commands are organized as follows:
 /* Reusable templates for basic commands to save on compiled code space */
 /* d: uint32_t, w: uint16_t */
 /* z: nul-terminated string, z_s: nul-terminated string with known length */
+#if EVE_SINGLE_TARGET_FT811 && !EVE_CMD_HOOKS
+static inline void EVE_CoCmd_d(EVE_HalContext *phost, uint32_t cmd)
+{
+	EVE_Cmd_wr32(phost, cmd);
+}
+#else
 EVE_HAL_EXPORT void EVE_CoCmd_d(EVE_HalContext *phost, uint32_t cmd);
+#endif
 EVE_HAL_EXPORT void EVE_CoCmd_dd(EVE_HalContext *phost, uint32_t cmd, uint32_t d0);
 EVE_HAL_EXPORT void EVE_CoCmd_ddd(EVE_HalContext *phost, uint32_t cmd, uint32_t d0, uint32_t d1);
 EVE_HAL_EXPORT void EVE_CoCmd_dddd(EVE_HalContext *phost, uint32_t cmd, uint32_t d0, uint32_t d1, uint32_t d2);
@@ -106,10 +113,34 @@ EVE_HAL_EXPORT void EVE_CoCmd_dwwwwwwz_s(EVE_HalContext *phost, uint32_t cmd,
     uint16_t w0, uint16_t w1, uint16_t w2, uint16_t w3,
     uint16_t w4, uint16_t w5, const char *s, uint32_t len);
 
+/* Approximate number of display list words generated by coprocessor widgets, for EVE_DL_ESTIMATE.
+Text based widgets add one word per character on top of this */
+#define EVE_DL_ESTIMATE_TEXT 6
+#define EVE_DL_ESTIMATE_NUMBER 16
+#define EVE_DL_ESTIMATE_BUTTON 32
+#define EVE_DL_ESTIMATE_KEY 24 /* Per key */
+#define EVE_DL_ESTIMATE_TOGGLE 40
+#define EVE_DL_ESTIMATE_GRADIENT 16
+#define EVE_DL_ESTIMATE_PROGRESS 24
+#define EVE_DL_ESTIMATE_SLIDER 32
+#define EVE_DL_ESTIMATE_SCROLLBAR 32
+#define EVE_DL_ESTIMATE_GAUGE 24 /* Plus two words per tick */
+#define EVE_DL_ESTIMATE_CLOCK 160
+#define EVE_DL_ESTIMATE_DIAL 32
+#define EVE_DL_ESTIMATE_SPINNER 64
+
+#if EVE_DL_ESTIMATE
+EVE_HAL_EXPORT void EVE_CoDlImpl_estimate(EVE_HalContext *phost, uint32_t words);
+#define EVE_DL_ESTIMATE_ADD(phost, words) EVE_CoDlImpl_estimate(phost, words)
+#else
+#define EVE_DL_ESTIMATE_ADD(phost, words) ((void)(words))
+#endif
+
 /** Write a display list instruction. Example: EVE_CoCmd_dl(DISPLAY()); */
 static inline void EVE_CoCmd_dl(EVE_HalContext *phost, uint32_t dl)
 {
 	EVE_CoCmd_d(phost, dl);
+	EVE_DL_ESTIMATE_ADD(phost, 1);
 }
 
 #define EVE_MULTI_TARGET_CHECK(cmd, condition)
@@ -120,6 +151,42 @@ EVE_HAL_EXPORT void EVE_CoDlImpl_resetCoState(EVE_HalContext *phost);
 
 #define EVE_CO_SCRATCH_HANDLE (EVE_CHIPID >= EVE_FT810 ? phost->CoScratchHandle : 15)
 
+#if EVE_CMD_PEEPHOLE
+
+/* Peephole optimizer hook on the display list words written through EVE_CoCmd.
+Drops state instructions which repeat the current value, END followed by BEGIN of
+the same primitive so the vertices of both go into one batch, and SAVE_CONTEXT
+directly followed by RESTORE_CONTEXT. END and SAVE_CONTEXT are held back until the
+next instruction, words written with EVE_Cmd_* directly bypass the optimizer */
+EVE_HAL_EXPORT int EVE_CoCmd_peephole(EVE_HalContext *phost, uint32_t cmd, uint32_t state);
+
+/* Install the optimizer as CoCmdHook, a hook that is already set is called first */
+EVE_HAL_EXPORT void EVE_CoCmd_peepholeEnable(EVE_HalContext *phost);
+
+/* Write any held instruction and put back the previous hook */
+EVE_HAL_EXPORT void EVE_CoCmd_peepholeDisable(EVE_HalContext *phost);
+
+/* Write any held instruction and forget the known state.
+Call before reading REG_CMD_DL or recording a display list fragment for replay elsewhere */
+EVE_HAL_EXPORT void EVE_CoCmd_peepholeFlush(EVE_HalContext *phost);
+
+/* Drop any held instruction and forget the known state, the coprocessor was reset */
+EVE_HAL_EXPORT void EVE_CoCmd_peepholeReset(EVE_HalContext *phost);
+
+/* Number of words removed by the optimizer in the previous frame */
+static inline uint32_t EVE_CoCmd_peepholeRemoved(EVE_HalContext *phost)
+{
+	return phost->CoCmdHook == EVE_CoCmd_peephole ? phost->Peephole.RemovedFrame : 0;
+}
+
+#else
+
+#define EVE_CoCmd_peepholeFlush(phost) eve_noop()
+#define EVE_CoCmd_peepholeReset(phost) eve_noop()
+#define EVE_CoCmd_peepholeRemoved(phost) (0)
+
+#endif
+
 /**********************************************************************
 ***********************************************************************
 **********************************************************************/
@@ -143,6 +210,9 @@ static inline void EVE_CoCmd_dlStart(EVE_HalContext *phost)
 static inline void EVE_CoCmd_swap(EVE_HalContext *phost)
 {
 	EVE_CoCmd_d(phost, CMD_SWAP);
+#if EVE_CMD_CAPTURE
+	EVE_Cmd_captureSwap(phost);
+#endif
 }
 
 ESD_FUNCTION(EVE_CoCmd_interrupt, Type = void, Category = _GroupHidden, Inline, Include = "Esd_Core.h")
@@ -339,6 +409,7 @@ ESD_PARAMETER(num, Type = uint32_t, Default = 0, Min = 0, Max = 2048)
 static inline void EVE_CoCmd_append(EVE_HalContext *phost, uint32_t ptr, uint32_t num)
 {
 	EVE_CoCmd_ddd(phost, CMD_APPEND, ptr, num);
+	EVE_DL_ESTIMATE_ADD(phost, num >> 2);
 }
 
 /**
@@ -416,6 +487,45 @@ EVE_HAL_EXPORT bool EVE_CoCmd_loadImage_progMem(EVE_HalContext *phost, uint32_t
  */
 EVE_HAL_EXPORT bool EVE_CoCmd_getProps(EVE_HalContext *phost, uint32_t *ptr, uint32_t *w, uint32_t *h);
 
+#if EVE_CMD_FUTURES
+
+/**
+ * @brief Send CMD_MEMCRC without waiting for the result
+ *
+ * @param phost Pointer to Hal context
+ * @param ptr starting address of the memory block
+ * @param num number of bytes in the source memory block
+ * @return EVE_CmdFuture Handle to get the CRC-32 from with EVE_Cmd_futureGet, one word
+ */
+EVE_HAL_EXPORT EVE_CmdFuture EVE_CoCmd_memCrc_future(EVE_HalContext *phost, uint32_t ptr, uint32_t num);
+
+/**
+ * @brief Send CMD_REGREAD without waiting for the result
+ *
+ * @param phost Pointer to Hal context
+ * @param ptr address of register to read
+ * @return EVE_CmdFuture Handle to get the register value from with EVE_Cmd_futureGet, one word
+ */
+EVE_HAL_EXPORT EVE_CmdFuture EVE_CoCmd_regRead_future(EVE_HalContext *phost, uint32_t ptr);
+
+/**
+ * @brief Send CMD_GETPTR without waiting for the result
+ *
+ * @param phost Pointer to Hal context
+ * @return EVE_CmdFuture Handle to get the end address from with EVE_Cmd_futureGet, one word
+ */
+EVE_HAL_EXPORT EVE_CmdFuture EVE_CoCmd_getPtr_future(EVE_HalContext *phost);
+
+/**
+ * @brief Send CMD_GETPROPS without waiting for the result
+ *
+ * @param phost Pointer to Hal context
+ * @return EVE_CmdFuture Handle to get the address, width and height from with EVE_Cmd_futureGet, three words
+ */
+EVE_HAL_EXPORT EVE_CmdFuture EVE_CoCmd_getProps_future(EVE_HalContext *phost);
+
+#endif
+
 
 /**
  * @brief Send CMD_SNAPSHOT2
@@ -812,6 +922,7 @@ ESD_PARAMETER(rgb1, Type = esd_rgb32_t, Default = 0) // COLOR
 static inline void EVE_CoCmd_gradient(EVE_HalContext *phost, int16_t x0, int16_t y0, uint32_t rgb0, int16_t x1, int16_t y1, uint32_t rgb1)
 {
 	EVE_CoCmd_dwwdwwd(phost, CMD_GRADIENT, x0, y0, rgb0, x1, y1, rgb1);
+	EVE_DL_ESTIMATE_ADD(phost, EVE_DL_ESTIMATE_GRADIENT);
 
 #if (EVE_DL_OPTIMIZE)
 	phost->DlPrimitive = 0;
@@ -844,6 +955,19 @@ EVE_HAL_EXPORT void EVE_CoCmd_text(EVE_HalContext *phost, int16_t x, int16_t y,
  */
 EVE_HAL_EXPORT void EVE_CoCmd_text_s(EVE_HalContext *phost, int16_t x, int16_t y, int16_t font, uint16_t options, const char *s, uint32_t length);
 
+/**
+ * @brief Send CMD_TEXT with a string of known length, which does not need to be terminated
+ *
+ * @param phost Pointer to Hal context
+ * @param x x-coordinate of text base, in pixels
+ * @param y y-coordinate of text base, in pixels
+ * @param font Font to use for text, 0-31
+ * @param options Text option
+ * @param s Text, UTF-8 encoding, without nul characters
+ * @param length Number of bytes of text
+ */
+EVE_HAL_EXPORT void EVE_CoCmd_textN(EVE_HalContext *phost, int16_t x, int16_t y, int16_t font, uint16_t options, const char *s, uint32_t length);
+
 ESD_RENDER(EVE_CoCmd_text_ex, Type = void, Category = _GroupHidden, Include = "Esd_Core.h")
 ESD_PARAMETER(phost, Type = EVE_HalContext *, Default = Esd_GetHost, Hidden, Internal, Static) // PHOST
 ESD_PARAMETER(x, Type = int16_t, Default = 0) // SCREEN_SIZE
@@ -932,6 +1056,7 @@ ESD_PARAMETER(range, Type = uint16_t, Default = 0)
 static inline void EVE_CoCmd_progress(EVE_HalContext *phost, int16_t x, int16_t y, int16_t w, int16_t h, uint16_t options, uint16_t val, uint16_t range)
 {
 	EVE_CoCmd_dwwwwwww(phost, CMD_PROGRESS, x, y, w, h, options, val, range);
+	EVE_DL_ESTIMATE_ADD(phost, EVE_DL_ESTIMATE_PROGRESS);
 
 #if (EVE_DL_OPTIMIZE)
 	phost->DlPrimitive = 0;
@@ -962,6 +1087,7 @@ ESD_PARAMETER(range, Type = uint16_t, Default = 0)
 static inline void EVE_CoCmd_slider(EVE_HalContext *phost, int16_t x, int16_t y, int16_t w, int16_t h, uint16_t options, uint16_t val, uint16_t range)
 {
 	EVE_CoCmd_dwwwwwww(phost, CMD_SLIDER, x, y, w, h, options, val, range);
+	EVE_DL_ESTIMATE_ADD(phost, EVE_DL_ESTIMATE_SLIDER);
 
 #if (EVE_DL_OPTIMIZE)
 	phost->DlPrimitive = 0;
@@ -994,6 +1120,7 @@ ESD_PARAMETER(range, Type = uint16_t, Default = 0)
 static inline void EVE_CoCmd_scrollbar(EVE_HalContext *phost, int16_t x, int16_t y, int16_t w, int16_t h, uint16_t options, uint16_t val, uint16_t size, uint16_t range)
 {
 	EVE_CoCmd_dwwwwwwww(phost, CMD_SCROLLBAR, x, y, w, h, options, val, size, range);
+	EVE_DL_ESTIMATE_ADD(phost, EVE_DL_ESTIMATE_SCROLLBAR);
 
 #if (EVE_DL_OPTIMIZE)
 	phost->DlPrimitive = 0;
@@ -1041,6 +1168,7 @@ ESD_PARAMETER(range, Type = uint16_t, Default = 0)
 static inline void EVE_CoCmd_gauge(EVE_HalContext *phost, int16_t x, int16_t y, int16_t r, uint16_t options, uint16_t major, uint16_t minor, uint16_t val, uint16_t range)
 {
 	EVE_CoCmd_dwwwwwwww(phost, CMD_GAUGE, x, y, r, options, major, minor, val, range);
+	EVE_DL_ESTIMATE_ADD(phost, EVE_DL_ESTIMATE_GAUGE + 2 * (uint32_t)major * minor);
 
 #if (EVE_DL_OPTIMIZE)
 	phost->DlPrimitive = 0;
@@ -1073,6 +1201,7 @@ ESD_PARAMETER(ms, Type = uint16_t, Default = 0)
 static inline void EVE_CoCmd_clock(EVE_HalContext *phost, int16_t x, int16_t y, int16_t r, uint16_t options, uint16_t h, uint16_t m, uint16_t s, uint16_t ms)
 {
 	EVE_CoCmd_dwwwwwwww(phost, CMD_CLOCK, x, y, r, options, h, m, s, ms);
+	EVE_DL_ESTIMATE_ADD(phost, EVE_DL_ESTIMATE_CLOCK);
 
 #if (EVE_DL_OPTIMIZE)
 	phost->DlPrimitive = 0;
@@ -1099,6 +1228,7 @@ ESD_PARAMETER(val, Type = uint16_t, Default = 0)
 static inline void EVE_CoCmd_dial(EVE_HalContext *phost, int16_t x, int16_t y, int16_t r, uint16_t options, uint16_t val)
 {
 	EVE_CoCmd_dwwwww(phost, CMD_DIAL, x, y, r, options, val);
+	EVE_DL_ESTIMATE_ADD(phost, EVE_DL_ESTIMATE_DIAL);
 
 #if (EVE_DL_OPTIMIZE)
 	phost->DlPrimitive = 0;
@@ -1152,6 +1282,7 @@ EVE_HAL_EXPORT uint32_t EVE_CoCmd_calibrate(EVE_HalContext *phost);
 static inline void EVE_CoCmd_spinner(EVE_HalContext *phost, int16_t x, int16_t y, uint16_t style, uint16_t scale)
 {
 	EVE_CoCmd_dwwww(phost, CMD_SPINNER, x, y, style, scale);
+	EVE_DL_ESTIMATE_ADD(phost, EVE_DL_ESTIMATE_SPINNER);
 
 #if (EVE_DL_OPTIMIZE)
 	phost->DlPrimitive = 0;
@@ -170,6 +170,79 @@ EVE_HAL_EXPORT bool EVE_CoCmd_getProps(EVE_HalContext *phost, uint32_t *ptr, uin
 	return true;
 }
 
+#if EVE_CMD_FUTURES
 
+EVE_HAL_EXPORT EVE_CmdFuture EVE_CoCmd_memCrc_future(EVE_HalContext *phost, uint32_t ptr, uint32_t num)
+{
+	uint16_t resAddr;
+
+#if EVE_CMD_HOOKS
+	if (phost->CoCmdHook && phost->CoCmdHook(phost, CMD_MEMCRC, 0))
+		return EVE_CMD_FUTURE_INVALID;
+#endif
+
+	EVE_Cmd_startFunc(phost);
+	EVE_Cmd_wr32(phost, CMD_MEMCRC);
+	EVE_Cmd_wr32(phost, ptr);
+	EVE_Cmd_wr32(phost, num);
+	resAddr = EVE_Cmd_moveWp(phost, 4);
+	EVE_Cmd_endFunc(phost);
+
+	return EVE_Cmd_future(phost, resAddr, 1);
+}
+
+EVE_HAL_EXPORT EVE_CmdFuture EVE_CoCmd_regRead_future(EVE_HalContext *phost, uint32_t ptr)
+{
+	uint16_t resAddr;
+
+#if EVE_CMD_HOOKS
+	if (phost->CoCmdHook && phost->CoCmdHook(phost, CMD_REGREAD, 0))
+		return EVE_CMD_FUTURE_INVALID;
+#endif
+
+	EVE_Cmd_startFunc(phost);
+	EVE_Cmd_wr32(phost, CMD_REGREAD);
+	EVE_Cmd_wr32(phost, ptr);
+	resAddr = EVE_Cmd_moveWp(phost, 4);
+	EVE_Cmd_endFunc(phost);
+
+	return EVE_Cmd_future(phost, resAddr, 1);
+}
+
+EVE_HAL_EXPORT EVE_CmdFuture EVE_CoCmd_getPtr_future(EVE_HalContext *phost)
+{
+	uint16_t resAddr;
+
+#if EVE_CMD_HOOKS
+	if (phost->CoCmdHook && phost->CoCmdHook(phost, CMD_GETPTR, 0))
+		return EVE_CMD_FUTURE_INVALID;
+#endif
+
+	EVE_Cmd_startFunc(phost);
+	EVE_Cmd_wr32(phost, CMD_GETPTR);
+	resAddr = EVE_Cmd_moveWp(phost, 4);
+	EVE_Cmd_endFunc(phost);
+
+	return EVE_Cmd_future(phost, resAddr, 1);
+}
+
+EVE_HAL_EXPORT EVE_CmdFuture EVE_CoCmd_getProps_future(EVE_HalContext *phost)
+{
+	uint16_t resAddr;
+
+#if EVE_CMD_HOOKS
+	if (phost->CoCmdHook && phost->CoCmdHook(phost, CMD_GETPROPS, 0))
+		return EVE_CMD_FUTURE_INVALID;
+#endif
+
+	EVE_Cmd_startFunc(phost);
+	EVE_Cmd_wr32(phost, CMD_GETPROPS);
+	resAddr = EVE_Cmd_moveWp(phost, 12);
+	EVE_Cmd_endFunc(phost);
+
+	return EVE_Cmd_future(phost, resAddr, 3);
+}
+
+#endif
 
 /* end of file */
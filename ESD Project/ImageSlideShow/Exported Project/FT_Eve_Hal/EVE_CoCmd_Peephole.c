@@ -0,0 +1,268 @@
+/**
+ * This source code ("the Software") is provided by Bridgetek Pte Ltd
+ * ("Bridgetek") subject to the licence terms set out
+ *   http://brtchip.com/BRTSourceCodeLicenseAgreement/ ("the Licence Terms").
+ * You must read the Licence Terms before downloading or using the Software.
+ * By installing or using the Software you agree to the Licence Terms. If you
+ * do not agree to the Licence Terms then do not download or use the Software.
+ *
+ * Without prejudice to the Licence Terms, here is a summary of some of the key
+ * terms of the Licence Terms (and in the event of any conflict between this
+ * summary and the Licence Terms then the text of the Licence Terms will
+ * prevail).
+ *
+ * The Software is provided "as is".
+ * There are no warranties (or similar) in relation to the quality of the
+ * Software. You use it at your own risk.
+ * The Software should not be used in, or for, any medical device, system or
+ * appliance. There are exclusions of Bridgetek liability for certain types of loss
+ * such as: special loss or damage; incidental loss or damage; indirect or
+ * consequential loss or damage; loss of income; loss of business; loss of
+ * profits; loss of revenue; loss of contracts; business interruption; loss of
+ * the use of money or anticipated savings; loss of information; loss of
+ * opportunity; loss of goodwill or reputation; and/or loss of, damage to or
+ * corruption of data.
+ * There is a monetary cap on Bridgetek's liability.
+ * The Software may have subsequently been amended by another user and then
+ * distributed by that other user ("Adapted Software").  If so that user may
+ * have additional licence terms that apply to those amendments. However, Bridgetek
+ * has no liability in relation to those amendments.
+ */
+
+#include "EVE_Platform.h"
+
+#if EVE_CMD_PEEPHOLE
+
+#include <string.h>
+
+#define EVE_PEEPHOLE_UNKNOWN 0xFF /* Primitive not known, after a coprocessor command */
+#define EVE_PEEPHOLE_NONE 0xFE /* No primitive, after END */
+
+#define EVE_PEEPHOLE_OP_BEGIN 31
+#define EVE_PEEPHOLE_OP_END 33
+#define EVE_PEEPHOLE_OP_SAVE 34
+#define EVE_PEEPHOLE_OP_RESTORE 35
+#define EVE_PEEPHOLE_OP_CLEAR 38
+
+/* Instructions which only set global graphics state, a repeated value is a no-op.
+Excludes the per-handle bitmap state, which depends on BITMAP_HANDLE */
+static const uint32_t s_StateOps[2] = {
+	0x1FFFFE7CUL, /* CLEAR_COLOR_RGB to CELL, ALPHA_FUNC to SCISSOR_SIZE */
+	0x00001C81UL, /* COLOR_MASK, VERTEX_FORMAT, PALETTE_SOURCE, VERTEX_TRANSLATE_X and Y */
+};
+
+/* Instructions an END can be moved past, none of them draw or depend on the primitive */
+static const uint32_t s_PassEndOps[2] = {
+	0x1FFFFFFEUL, /* BITMAP_SOURCE to SCISSOR_SIZE */
+	0x0000FF81UL, /* COLOR_MASK, VERTEX_FORMAT to BITMAP_SWIZZLE */
+};
+
+static inline bool inSet(const uint32_t *set, uint32_t op)
+{
+	return op < 64 && ((set[op >> 5] >> (op & 31)) & 1);
+}
+
+static inline bool isStrip(uint8_t prim)
+{
+	/* A new BEGIN of the same strip primitive starts a new strip */
+	return prim == LINE_STRIP || prim == EDGE_STRIP_R || prim == EDGE_STRIP_L || prim == EDGE_STRIP_A || prim == EDGE_STRIP_B;
+}
+
+static void invalidate(EVE_HalPeephole *pp)
+{
+	pp->Valid[0] = 0;
+	pp->Valid[1] = 0;
+}
+
+static void flushHeld(EVE_HalContext *phost)
+{
+	EVE_HalPeephole *pp = &phost->Peephole;
+	if (!pp->HasHeld)
+		return;
+	pp->HasHeld = false;
+	if (pp->Held == END())
+		pp->Primitive = EVE_PEEPHOLE_NONE;
+	EVE_Cmd_wr32(phost, pp->Held);
+}
+
+static int beginPrimitive(EVE_HalPeephole *pp, uint32_t cmd)
+{
+	uint8_t prim = cmd & 0xF;
+	if (prim == pp->Primitive && !isStrip(prim))
+	{
+		/* Vertices continue the current batch */
+		++pp->Removed;
+		return 1;
+	}
+	pp->Primitive = prim;
+	return 0;
+}
+
+static void restoreContext(EVE_HalPeephole *pp)
+{
+	if (pp->Depth == 0 || pp->Depth >= EVE_DL_STATE_STACK_SIZE)
+	{
+		/* Unbalanced or nested deeper than tracked */
+		invalidate(pp);
+	}
+	else
+	{
+		/* Only what was written since the save goes back to an older value */
+		pp->Valid[0] &= ~pp->Changed[pp->Depth][0];
+		pp->Valid[1] &= ~pp->Changed[pp->Depth][1];
+		pp->Changed[pp->Depth - 1][0] |= pp->Changed[pp->Depth][0];
+		pp->Changed[pp->Depth - 1][1] |= pp->Changed[pp->Depth][1];
+	}
+	if (pp->Depth)
+		--pp->Depth;
+	pp->Primitive = EVE_PEEPHOLE_UNKNOWN;
+}
+
+EVE_HAL_EXPORT int EVE_CoCmd_peephole(EVE_HalContext *phost, uint32_t cmd, uint32_t state)
+{
+	EVE_HalPeephole *pp = &phost->Peephole;
+	uint32_t op;
+
+	if (pp->Next && pp->Next(phost, cmd, state))
+		return 1;
+
+	if ((cmd >> 30) == 3)
+	{
+		/* Coprocessor command, may write any display list state */
+		flushHeld(phost);
+		invalidate(pp);
+		pp->Primitive = EVE_PEEPHOLE_UNKNOWN;
+		if (cmd == CMD_DLSTART)
+		{
+			pp->RemovedFrame = pp->Removed;
+			pp->Removed = 0;
+			pp->Depth = 0;
+		}
+		return 0;
+	}
+
+	if (cmd >> 30)
+	{
+		/* VERTEX2F or VERTEX2II */
+		flushHeld(phost);
+		if ((cmd >> 30) == 2)
+			pp->Valid[0] &= ~((1UL << 5) | (1UL << 6)); /* Don't rely on BITMAP_HANDLE and CELL after a handle was given per vertex */
+		return 0;
+	}
+
+	op = cmd >> 24;
+	if (pp->HasHeld)
+	{
+		if (pp->Held == SAVE_CONTEXT() && cmd == RESTORE_CONTEXT())
+		{
+			/* Nothing in between */
+			pp->HasHeld = false;
+			--pp->Depth;
+			pp->Removed += 2;
+			return 1;
+		}
+		if (pp->Held == END() && op == EVE_PEEPHOLE_OP_BEGIN)
+		{
+			/* BEGIN ends the previous primitive by itself */
+			pp->HasHeld = false;
+			++pp->Removed;
+			return beginPrimitive(pp, cmd);
+		}
+		if (pp->Held != END() || !inSet(s_PassEndOps, op))
+			flushHeld(phost);
+	}
+
+	switch (op)
+	{
+	case EVE_PEEPHOLE_OP_BEGIN:
+		return beginPrimitive(pp, cmd);
+	case EVE_PEEPHOLE_OP_END:
+		if (pp->Primitive == EVE_PEEPHOLE_NONE)
+		{
+			++pp->Removed;
+			return 1;
+		}
+		pp->Held = cmd;
+		pp->HasHeld = true;
+		return 1;
+	case EVE_PEEPHOLE_OP_SAVE:
+		++pp->Depth;
+		if (pp->Depth < EVE_DL_STATE_STACK_SIZE)
+		{
+			pp->Changed[pp->Depth][0] = 0;
+			pp->Changed[pp->Depth][1] = 0;
+		}
+		pp->Held = cmd;
+		pp->HasHeld = true;
+		return 1;
+	case EVE_PEEPHOLE_OP_RESTORE:
+		restoreContext(pp);
+		return 0;
+	default:
+		break;
+	}
+
+	if (inSet(s_StateOps, op))
+	{
+		uint32_t bit = 1UL << (op & 31);
+		if ((pp->Valid[op >> 5] & bit) && pp->State[op] == cmd)
+		{
+			++pp->Removed;
+			return 1;
+		}
+		pp->State[op] = cmd;
+		pp->Valid[op >> 5] |= bit;
+		if (pp->Depth < EVE_DL_STATE_STACK_SIZE)
+			pp->Changed[pp->Depth][op >> 5] |= bit;
+		return 0;
+	}
+
+	if (op == EVE_PEEPHOLE_OP_CLEAR || inSet(s_PassEndOps, op))
+		return 0;
+
+	/* DISPLAY, CALL, JUMP, RETURN, MACRO, or unknown */
+	invalidate(pp);
+	pp->Primitive = EVE_PEEPHOLE_UNKNOWN;
+	return 0;
+}
+
+EVE_HAL_EXPORT void EVE_CoCmd_peepholeEnable(EVE_HalContext *phost)
+{
+	if (phost->CoCmdHook == EVE_CoCmd_peephole)
+		return;
+	memset(&phost->Peephole, 0, sizeof(EVE_HalPeephole));
+	phost->Peephole.Next = phost->CoCmdHook;
+	phost->Peephole.Primitive = EVE_PEEPHOLE_UNKNOWN;
+	phost->CoCmdHook = EVE_CoCmd_peephole;
+}
+
+EVE_HAL_EXPORT void EVE_CoCmd_peepholeDisable(EVE_HalContext *phost)
+{
+	if (phost->CoCmdHook != EVE_CoCmd_peephole)
+		return;
+	flushHeld(phost);
+	phost->CoCmdHook = phost->Peephole.Next;
+}
+
+EVE_HAL_EXPORT void EVE_CoCmd_peepholeFlush(EVE_HalContext *phost)
+{
+	if (phost->CoCmdHook != EVE_CoCmd_peephole)
+		return;
+	flushHeld(phost);
+	invalidate(&phost->Peephole);
+	phost->Peephole.Primitive = EVE_PEEPHOLE_UNKNOWN;
+}
+
+EVE_HAL_EXPORT void EVE_CoCmd_peepholeReset(EVE_HalContext *phost)
+{
+	if (phost->CoCmdHook != EVE_CoCmd_peephole)
+		return;
+	phost->Peephole.HasHeld = false;
+	phost->Peephole.Depth = 0;
+	invalidate(&phost->Peephole);
+	phost->Peephole.Primitive = EVE_PEEPHOLE_UNKNOWN;
+}
+
+#endif
+
+/* end of file */
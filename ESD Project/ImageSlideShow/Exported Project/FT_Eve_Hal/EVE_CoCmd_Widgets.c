@@ -37,6 +37,7 @@
 EVE_HAL_EXPORT void EVE_CoCmd_text(EVE_HalContext *phost, int16_t x, int16_t y, int16_t font, uint16_t options, const char *s, ...)
 {
 	va_list args;
+	uint32_t len;
 
 #if EVE_CMD_HOOKS
 	if (phost->CoCmdHook && phost->CoCmdHook(phost, CMD_TEXT, 0))
@@ -57,9 +58,10 @@ EVE_HAL_EXPORT void EVE_CoCmd_text(EVE_HalContext *phost, int16_t x, int16_t y,
 	EVE_Cmd_wr16(phost, y);
 	EVE_Cmd_wr16(phost, font);
 	EVE_Cmd_wr16(phost, options);
-	EVE_Cmd_wrString(phost, s, EVE_CMD_STRING_MAX);
+	len = EVE_Cmd_wrString(phost, s, EVE_CMD_STRING_MAX);
 	EVE_Cmd_endFunc(phost);
 	va_end(args);
+	EVE_DL_ESTIMATE_ADD(phost, EVE_DL_ESTIMATE_TEXT + len);
 
 #if (EVE_DL_OPTIMIZE)
 	phost->DlPrimitive = 0;
@@ -68,6 +70,8 @@ EVE_HAL_EXPORT void EVE_CoCmd_text(EVE_HalContext *phost, int16_t x, int16_t y,
 
 EVE_HAL_EXPORT void EVE_CoCmd_text_s(EVE_HalContext *phost, int16_t x, int16_t y, int16_t font, uint16_t options, const char *s, uint32_t length)
 {
+	uint32_t len;
+
 #if EVE_CMD_HOOKS
 	if (phost->CoCmdHook && phost->CoCmdHook(phost, CMD_TEXT, 0))
 		return;
@@ -86,8 +90,40 @@ EVE_HAL_EXPORT void EVE_CoCmd_text_s(EVE_HalContext *phost, int16_t x, int16_t y
 	EVE_Cmd_wr16(phost, y);
 	EVE_Cmd_wr16(phost, font);
 	EVE_Cmd_wr16(phost, options);
-	EVE_Cmd_wrString(phost, s, length);
+	len = EVE_Cmd_wrString(phost, s, length);
 	EVE_Cmd_endFunc(phost);
+	EVE_DL_ESTIMATE_ADD(phost, EVE_DL_ESTIMATE_TEXT + len);
+
+#if (EVE_DL_OPTIMIZE)
+	phost->DlPrimitive = 0;
+#endif
+}
+
+EVE_HAL_EXPORT void EVE_CoCmd_textN(EVE_HalContext *phost, int16_t x, int16_t y, int16_t font, uint16_t options, const char *s, uint32_t length)
+{
+	uint32_t len;
+
+#if EVE_CMD_HOOKS
+	if (phost->CoCmdHook && phost->CoCmdHook(phost, CMD_TEXT, 0))
+		return;
+#endif
+
+	if (font >= 32)
+	{
+		if (font != 63)
+			eve_printf_debug("Invalid font handle specified: %i\n", (int)font);
+		return;
+	}
+
+	EVE_Cmd_startFunc(phost);
+	EVE_Cmd_wr32(phost, CMD_TEXT);
+	EVE_Cmd_wr16(phost, x);
+	EVE_Cmd_wr16(phost, y);
+	EVE_Cmd_wr16(phost, font);
+	EVE_Cmd_wr16(phost, options);
+	len = EVE_Cmd_wrStringN(phost, s, length);
+	EVE_Cmd_endFunc(phost);
+	EVE_DL_ESTIMATE_ADD(phost, EVE_DL_ESTIMATE_TEXT + len);
 
 #if (EVE_DL_OPTIMIZE)
 	phost->DlPrimitive = 0;
@@ -115,6 +151,7 @@ EVE_HAL_EXPORT void EVE_CoCmd_text_ex(EVE_HalContext *phost, int16_t x, int16_t
 EVE_HAL_EXPORT void EVE_CoCmd_button(EVE_HalContext *phost, int16_t x, int16_t y, int16_t w, int16_t h, int16_t font, uint16_t options, const char *s, ...)
 {
 	va_list args;
+	uint32_t len;
 
 #if EVE_CMD_HOOKS
 	if (phost->CoCmdHook && phost->CoCmdHook(phost, CMD_BUTTON, 0))
@@ -135,9 +172,10 @@ EVE_HAL_EXPORT void EVE_CoCmd_button(EVE_HalContext *phost, int16_t x, int16_t y
 	EVE_Cmd_wr32(phost, (((uint32_t)y << 16) | (x & 0xffff)));
 	EVE_Cmd_wr32(phost, (((uint32_t)h << 16) | (w & 0xffff)));
 	EVE_Cmd_wr32(phost, (((uint32_t)options << 16) | (font & 0xffff)));
-	EVE_Cmd_wrString(phost, s, EVE_CMD_STRING_MAX);
+	len = EVE_Cmd_wrString(phost, s, EVE_CMD_STRING_MAX);
 	EVE_Cmd_endFunc(phost);
 	va_end(args);
+	EVE_DL_ESTIMATE_ADD(phost, EVE_DL_ESTIMATE_BUTTON + len);
 
 #if (EVE_DL_OPTIMIZE)
 	phost->DlPrimitive = 0;
@@ -146,6 +184,8 @@ EVE_HAL_EXPORT void EVE_CoCmd_button(EVE_HalContext *phost, int16_t x, int16_t y
 
 EVE_HAL_EXPORT void EVE_CoCmd_keys(EVE_HalContext *phost, int16_t x, int16_t y, int16_t w, int16_t h, int16_t font, uint16_t options, const char *s)
 {
+	uint32_t len;
+
 #if EVE_CMD_HOOKS
 	if (phost->CoCmdHook && phost->CoCmdHook(phost, CMD_KEYS, 0))
 		return;
@@ -166,8 +206,9 @@ EVE_HAL_EXPORT void EVE_CoCmd_keys(EVE_HalContext *phost, int16_t x, int16_t y,
 	EVE_Cmd_wr16(phost, h);
 	EVE_Cmd_wr16(phost, font);
 	EVE_Cmd_wr16(phost, options);
-	EVE_Cmd_wrString(phost, s, EVE_CMD_STRING_MAX);
+	len = EVE_Cmd_wrString(phost, s, EVE_CMD_STRING_MAX);
 	EVE_Cmd_endFunc(phost);
+	EVE_DL_ESTIMATE_ADD(phost, EVE_DL_ESTIMATE_KEY * len);
 
 #if (EVE_DL_OPTIMIZE)
 	phost->DlPrimitive = 0;
@@ -177,6 +218,7 @@ EVE_HAL_EXPORT void EVE_CoCmd_keys(EVE_HalContext *phost, int16_t x, int16_t y,
 EVE_HAL_EXPORT void EVE_CoCmd_toggle(EVE_HalContext *phost, int16_t x, int16_t y, int16_t w, int16_t font, uint16_t options, uint16_t state, const char *s, ...)
 {
 	va_list args;
+	uint32_t len;
 
 #if EVE_CMD_HOOKS
 	if (phost->CoCmdHook && phost->CoCmdHook(phost, CMD_TOGGLE, 0))
@@ -200,9 +242,10 @@ EVE_HAL_EXPORT void EVE_CoCmd_toggle(EVE_HalContext *phost, int16_t x, int16_t y
 	EVE_Cmd_wr16(phost, font);
 	EVE_Cmd_wr16(phost, options);
 	EVE_Cmd_wr16(phost, state);
-	EVE_Cmd_wrString(phost, s, EVE_CMD_STRING_MAX);
+	len = EVE_Cmd_wrString(phost, s, EVE_CMD_STRING_MAX);
 	EVE_Cmd_endFunc(phost);
 	va_end(args);
+	EVE_DL_ESTIMATE_ADD(phost, EVE_DL_ESTIMATE_TOGGLE + len);
 
 #if (EVE_DL_OPTIMIZE)
 	phost->DlPrimitive = 0;
@@ -231,6 +274,7 @@ EVE_HAL_EXPORT void EVE_CoCmd_number(EVE_HalContext *phost, int16_t x, int16_t y
 	EVE_Cmd_wr16(phost, options);
 	EVE_Cmd_wr32(phost, n);
 	EVE_Cmd_endFunc(phost);
+	EVE_DL_ESTIMATE_ADD(phost, EVE_DL_ESTIMATE_NUMBER);
 
 #if (EVE_DL_OPTIMIZE)
 	phost->DlPrimitive = 0;
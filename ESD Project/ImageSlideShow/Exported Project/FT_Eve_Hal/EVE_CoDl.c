@@ -48,6 +48,11 @@ EVE_HAL_EXPORT void EVE_CoDlImpl_resetDlState(EVE_HalContext *phost)
 	phost->DlState[0].ColorRGB = 0xFFFFFF;
 	phost->DlState[0].ColorA = 0xFF;
 	phost->DlState[0].Handle = 0x3F; /* Invalid value */
+	phost->DlState[0].StencilFunc = STENCIL_FUNC(ALWAYS, 0, 255) & 0xFFFFFF;
+	phost->DlState[0].BlendFunc = BLEND_FUNC(SRC_ALPHA, ONE_MINUS_SRC_ALPHA) & 0xFF;
+	phost->DlState[0].StencilOp = STENCIL_OP(KEEP, KEEP) & 0xFF;
+	phost->DlState[0].StencilMask = 0xFF;
+	phost->DlState[0].ColorMask = COLOR_MASK(1, 1, 1, 1) & 0xFF;
 #endif
 	phost->DlState[0].VertexFormat = 4;
 #else
@@ -57,6 +62,7 @@ EVE_HAL_EXPORT void EVE_CoDlImpl_resetDlState(EVE_HalContext *phost)
 		.LineWidth = 16,
 		.PointSize = 16,
 		.ColorRGB = 0xFFFFFF,
+		.StencilFunc = STENCIL_FUNC(ALWAYS, 0, 255) & 0xFFFFFF,
 #endif
 #if (EVE_DL_CACHE_SCISSOR)
 		.ScissorWidth = (uint16_t)phost->Width,
@@ -65,6 +71,10 @@ EVE_HAL_EXPORT void EVE_CoDlImpl_resetDlState(EVE_HalContext *phost)
 #if (EVE_DL_OPTIMIZE)
 		.ColorA = 0xFF,
 		.Handle = 0x3F, /* Invalid value */
+		.BlendFunc = BLEND_FUNC(SRC_ALPHA, ONE_MINUS_SRC_ALPHA) & 0xFF,
+		.StencilOp = STENCIL_OP(KEEP, KEEP) & 0xFF,
+		.StencilMask = 0xFF,
+		.ColorMask = COLOR_MASK(1, 1, 1, 1) & 0xFF,
 #endif
 #if EVE_DL_OPTIMIZE
 		    .VertexFormat = 4,
@@ -77,9 +87,39 @@ EVE_HAL_EXPORT void EVE_CoDlImpl_resetDlState(EVE_HalContext *phost)
 
 #if (EVE_DL_OPTIMIZE)
 	phost->DlPrimitive = 0;
+	phost->DlElidedFrame = phost->DlElided;
+	phost->DlElided = 0;
+#endif
+
+#if EVE_DL_ESTIMATE
+	phost->DlEstimateFrame = phost->DlEstimate;
+	phost->DlEstimate = 0;
+#endif
+
+#if EVE_HAL_STATS
+	phost->StatsFrame = phost->Stats;
+	memset(&phost->Stats, 0, sizeof(EVE_HalStats));
 #endif
 }
 
+#if EVE_DL_ESTIMATE
+EVE_HAL_EXPORT void EVE_CoDlImpl_estimate(EVE_HalContext *phost, uint32_t words)
+{
+	uint32_t before = phost->DlEstimate;
+	phost->DlEstimate += words;
+	if (phost->DlEstimate > phost->DlEstimatePeak)
+		phost->DlEstimatePeak = phost->DlEstimate;
+
+	/* Warn only once per frame, when the limit is crossed */
+	if (before < EVE_DL_ESTIMATE_WARN && phost->DlEstimate >= EVE_DL_ESTIMATE_WARN)
+	{
+		eve_printf_debug("Display list estimate reached %i words\n", (int)phost->DlEstimate);
+		if (phost->CbDlEstimate)
+			phost->CbDlEstimate(phost, phost->DlEstimate);
+	}
+}
+#endif
+
 EVE_HAL_EXPORT void EVE_CoDlImpl_resetCoState(EVE_HalContext *phost)
 {
 #if (EVE_DL_OPTIMIZE)
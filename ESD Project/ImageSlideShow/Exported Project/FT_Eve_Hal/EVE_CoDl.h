@@ -61,6 +61,16 @@ Compatibility:
 EVE_HAL_EXPORT void EVE_CoDlImpl_resetDlState(EVE_HalContext *phost);
 EVE_HAL_EXPORT void EVE_CoDlImpl_resetCoState(EVE_HalContext *phost);
 
+/* Number of redundant state words that were not written to the display list in the previous frame */
+static inline uint32_t EVE_CoDl_elidedWords(EVE_HalContext *phost)
+{
+#if EVE_DL_OPTIMIZE
+	return phost->DlElidedFrame;
+#else
+	return 0;
+#endif
+}
+
 static inline void EVE_CoDl_display(EVE_HalContext *phost)
 {
 	EVE_CoCmd_dl(phost, DISPLAY());
@@ -157,6 +167,10 @@ inline static void EVE_CoDl_colorRgb_ex(EVE_HalContext *phost, uint32_t c)
 #if EVE_DL_OPTIMIZE
 		EVE_DL_STATE.ColorRGB = rgb;
 	}
+	else
+	{
+		++phost->DlElided;
+	}
 #endif
 }
 
@@ -180,6 +194,10 @@ inline static void EVE_CoDl_colorA(EVE_HalContext *phost, uint8_t alpha)
 #if EVE_DL_OPTIMIZE
 		EVE_DL_STATE.ColorA = alpha;
 	}
+	else
+	{
+		++phost->DlElided;
+	}
 #endif
 }
 
@@ -207,6 +225,10 @@ inline static void EVE_CoDl_bitmapHandle(EVE_HalContext *phost, uint8_t handle)
 #if EVE_DL_OPTIMIZE
 		EVE_DL_STATE.Handle = handle;
 	}
+	else
+	{
+		++phost->DlElided;
+	}
 #endif
 }
 
@@ -224,6 +246,10 @@ inline static void EVE_CoDl_cell(EVE_HalContext *phost, uint8_t cell)
 #if EVE_DL_OPTIMIZE
 		EVE_DL_STATE.Cell = cell;
 	}
+	else
+	{
+		++phost->DlElided;
+	}
 #endif
 }
 
@@ -252,12 +278,40 @@ static inline void EVE_CoDl_alphaFunc(EVE_HalContext *phost, uint8_t func, uint8
 
 static inline void EVE_CoDl_stencilFunc(EVE_HalContext *phost, uint8_t func, uint8_t ref, uint8_t mask)
 {
-	EVE_CoCmd_dl(phost, STENCIL_FUNC(func, ref, mask));
+	uint32_t stencilFunc = STENCIL_FUNC(func, ref, mask);
+	uint32_t bits = stencilFunc & 0xFFFFFF;
+#if EVE_DL_OPTIMIZE
+	if (bits != EVE_DL_STATE.StencilFunc)
+	{
+#endif
+		EVE_CoCmd_dl(phost, stencilFunc);
+#if EVE_DL_OPTIMIZE
+		EVE_DL_STATE.StencilFunc = bits;
+	}
+	else
+	{
+		++phost->DlElided;
+	}
+#endif
 }
 
 static inline void EVE_CoDl_blendFunc(EVE_HalContext *phost, uint8_t src, uint8_t dst)
 {
-	EVE_CoCmd_dl(phost, BLEND_FUNC(src, dst));
+	uint32_t blendFunc = BLEND_FUNC(src, dst);
+	uint8_t bits = (uint8_t)blendFunc;
+#if EVE_DL_OPTIMIZE
+	if (bits != EVE_DL_STATE.BlendFunc)
+	{
+#endif
+		EVE_CoCmd_dl(phost, blendFunc);
+#if EVE_DL_OPTIMIZE
+		EVE_DL_STATE.BlendFunc = bits;
+	}
+	else
+	{
+		++phost->DlElided;
+	}
+#endif
 }
 
 static inline void EVE_CoDl_blendFunc_default(EVE_HalContext *phost)
@@ -267,7 +321,21 @@ static inline void EVE_CoDl_blendFunc_default(EVE_HalContext *phost)
 
 static inline void EVE_CoDl_stencilOp(EVE_HalContext *phost, uint8_t sfail, uint8_t spass)
 {
-	EVE_CoCmd_dl(phost, STENCIL_OP(sfail, spass));
+	uint32_t stencilOp = STENCIL_OP(sfail, spass);
+	uint8_t bits = (uint8_t)stencilOp;
+#if EVE_DL_OPTIMIZE
+	if (bits != EVE_DL_STATE.StencilOp)
+	{
+#endif
+		EVE_CoCmd_dl(phost, stencilOp);
+#if EVE_DL_OPTIMIZE
+		EVE_DL_STATE.StencilOp = bits;
+	}
+	else
+	{
+		++phost->DlElided;
+	}
+#endif
 }
 
 ESD_FUNCTION(EVE_CoDl_pointSize, Type = void, Category = EveRenderFunctions, Inline)
@@ -283,6 +351,10 @@ inline static void EVE_CoDl_pointSize(EVE_HalContext *phost, int16_t size)
 #if EVE_DL_OPTIMIZE
 		EVE_DL_STATE.PointSize = size;
 	}
+	else
+	{
+		++phost->DlElided;
+	}
 #endif
 }
 
@@ -299,6 +371,10 @@ inline static void EVE_CoDl_lineWidth(EVE_HalContext *phost, int16_t width)
 #if EVE_DL_OPTIMIZE
 		EVE_DL_STATE.LineWidth = width;
 	}
+	else
+	{
+		++phost->DlElided;
+	}
 #endif
 }
 
@@ -314,7 +390,19 @@ static inline void EVE_CoDl_clearTag(EVE_HalContext *phost, uint8_t s)
 
 static inline void EVE_CoDl_stencilMask(EVE_HalContext *phost, uint8_t mask)
 {
-	EVE_CoCmd_dl(phost, STENCIL_MASK(mask));
+#if EVE_DL_OPTIMIZE
+	if (mask != EVE_DL_STATE.StencilMask)
+	{
+#endif
+		EVE_CoCmd_dl(phost, STENCIL_MASK(mask));
+#if EVE_DL_OPTIMIZE
+		EVE_DL_STATE.StencilMask = mask;
+	}
+	else
+	{
+		++phost->DlElided;
+	}
+#endif
 }
 
 static inline void EVE_CoDl_tagMask(EVE_HalContext *phost, bool mask)
@@ -431,6 +519,10 @@ static inline void EVE_CoDl_bitmapTransform_identity(EVE_HalContext *phost)
 #if EVE_DL_OPTIMIZE
 		EVE_DL_STATE.BitmapTransform = false;
 	}
+	else
+	{
+		++phost->DlElided;
+	}
 #endif
 }
 
@@ -446,6 +538,12 @@ static inline void EVE_CoDl_scissorXY(EVE_HalContext *phost, uint16_t x, uint16_
 		EVE_DL_STATE.ScissorY = y;
 #endif
 	}
+#if EVE_DL_OPTIMIZE && EVE_DL_CACHE_SCISSOR
+	else
+	{
+		++phost->DlElided;
+	}
+#endif
 }
 
 static inline void EVE_CoDl_scissorSize(EVE_HalContext *phost, uint16_t width, uint16_t height)
@@ -460,6 +558,12 @@ static inline void EVE_CoDl_scissorSize(EVE_HalContext *phost, uint16_t width, u
 		EVE_DL_STATE.ScissorHeight = height;
 #endif
 	}
+#if EVE_DL_OPTIMIZE && EVE_DL_CACHE_SCISSOR
+	else
+	{
+		++phost->DlElided;
+	}
+#endif
 }
 
 static inline void EVE_CoDl_call(EVE_HalContext *phost, uint16_t dest)
@@ -499,12 +603,30 @@ static inline void EVE_CoDl_begin(EVE_HalContext *phost, uint8_t prim)
 #if EVE_DL_OPTIMIZE
 		phost->DlPrimitive = prim;
 	}
+	else
+	{
+		++phost->DlElided;
+	}
 #endif
 }
 
 static inline void EVE_CoDl_colorMask(EVE_HalContext *phost, bool r, bool g, bool b, bool a)
 {
-	EVE_CoCmd_dl(phost, COLOR_MASK(r, g, b, a));
+	uint32_t colorMask = COLOR_MASK(r, g, b, a);
+	uint8_t bits = (uint8_t)colorMask;
+#if EVE_DL_OPTIMIZE
+	if (bits != EVE_DL_STATE.ColorMask)
+	{
+#endif
+		EVE_CoCmd_dl(phost, colorMask);
+#if EVE_DL_OPTIMIZE
+		EVE_DL_STATE.ColorMask = bits;
+	}
+	else
+	{
+		++phost->DlElided;
+	}
+#endif
 }
 
 ESD_FUNCTION(EVE_CoDl_end, Type = void, Category = EveRenderFunctions, Inline)
@@ -583,6 +705,10 @@ static inline void EVE_CoDl_vertexFormat(EVE_HalContext *phost, uint8_t frac)
 #if EVE_DL_OPTIMIZE
 			EVE_DL_STATE.VertexFormat = frac;
 		}
+		else
+		{
+			++phost->DlElided;
+		}
 #endif
 	}
 	else
@@ -606,6 +732,10 @@ inline static void EVE_CoDl_paletteSource(EVE_HalContext *phost, uint32_t addr)
 #if EVE_DL_OPTIMIZE
 			EVE_DL_STATE.PaletteSource = addr;
 		}
+		else
+		{
+			++phost->DlElided;
+		}
 #endif
 	}
 }
@@ -614,7 +744,19 @@ static inline void EVE_CoDl_vertexTranslateX(EVE_HalContext *phost, int16_t x)
 {
 	if (EVE_CHIPID >= EVE_FT810)
 	{
-		EVE_CoCmd_dl(phost, VERTEX_TRANSLATE_X(x));
+#if EVE_DL_OPTIMIZE
+		if (x != EVE_DL_STATE.VertexTranslateX)
+		{
+#endif
+			EVE_CoCmd_dl(phost, VERTEX_TRANSLATE_X(x));
+#if EVE_DL_OPTIMIZE
+			EVE_DL_STATE.VertexTranslateX = x;
+		}
+		else
+		{
+			++phost->DlElided;
+		}
+#endif
 	}
 	else
 	{
@@ -625,7 +767,19 @@ static inline void EVE_CoDl_vertexTranslateY(EVE_HalContext *phost, int16_t y)
 {
 	if (EVE_CHIPID >= EVE_FT810)
 	{
-		EVE_CoCmd_dl(phost, VERTEX_TRANSLATE_Y(y));
+#if EVE_DL_OPTIMIZE
+		if (y != EVE_DL_STATE.VertexTranslateY)
+		{
+#endif
+			EVE_CoCmd_dl(phost, VERTEX_TRANSLATE_Y(y));
+#if EVE_DL_OPTIMIZE
+			EVE_DL_STATE.VertexTranslateY = y;
+		}
+		else
+		{
+			++phost->DlElided;
+		}
+#endif
 	}
 	else
 	{
@@ -422,6 +422,16 @@ These may only be set by one of the platform target definitions, and should not
 #define EVE_CHIPID EVE_SUPPORT_CHIPID
 #define EVE_GEN EVE_SUPPORT_GEN
 
+/* Build for the FT811 on this board only. With a single EVE_SUPPORT_CHIPID all EVE_CHIPID and
+EVE_Hal_support* checks already fold to constants, this additionally inlines EVE_Cmd_wr32 and
+EVE_CoCmd_d into their callers, keeping only the wait for FIFO space out of line */
+#ifndef EVE_SINGLE_TARGET_FT811
+#define EVE_SINGLE_TARGET_FT811 1
+#endif
+#if EVE_SINGLE_TARGET_FT811 && (EVE_SUPPORT_CHIPID != EVE_FT811)
+#error EVE_SINGLE_TARGET_FT811 requires EVE_SUPPORT_CHIPID EVE_FT811
+#endif
+
 ///////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////
@@ -464,7 +474,70 @@ These may only be set by one of the platform target definitions, and should not
 #define EVE_DL_STATE_STACK_SIZE 4
 #define EVE_DL_STATE_STACK_MASK 3
 
+/* Largest gap in bytes between two registers that EVE_Hal_rdRegs reads through instead of starting a new transfer.
+A new read transfer costs the address and dummy bytes, 4 or 5 bytes of clocking */
+#define EVE_HAL_RDREGS_GAP 8
+
+#ifndef EVE_DL_ESTIMATE
+#define EVE_DL_ESTIMATE 0 /* Keep a running estimate of the display list words emitted in the current frame, including the expansion of coprocessor widgets */
+#endif
+#define EVE_DL_ESTIMATE_WARN 1920 /* Estimated number of display list words at which CbDlEstimate is called, RAM_DL holds 2048 */
+
+/* Once the command FIFO is found full, wait for at least this many free bytes before continuing to write,
+as long as the coprocessor keeps draining. Avoids reading REG_CMDB_SPACE for every following small write */
+#define EVE_CMD_SPACE_CHUNK 1024
+
+#ifndef EVE_HAL_STATS
+#define EVE_HAL_STATS 0 /* Count transfers, bytes, register polls and command words in Stats of EVE_HalContext, rolled over into StatsFrame at every CMD_DLSTART. Transfer counters are kept by the platform implementation */
+#endif
+
+#ifndef EVE_CMD_PEEPHOLE
+#define EVE_CMD_PEEPHOLE 0 /* Peephole optimizer on the display list words passing through EVE_CoCmd, see EVE_CoCmd_peepholeEnable. Requires the command hooks */
+#endif
+
+#if EVE_CMD_PEEPHOLE
+#define EVE_CMD_HOOKS 1
+#else
 #define EVE_CMD_HOOKS 0 /* Allow adding a callback hook into EVE_CoCmd calls using CoCmdHook in EVE_HalContext */
+#endif
+
+#ifndef EVE_CMD_FUTURES
+#define EVE_CMD_FUTURES 4 /* Number of command results that can be pending at once through the EVE_CoCmd_*_future functions, read back once the coprocessor has passed them. 0 disables */
+#endif
+
+#ifndef EVE_CMD_CAPTURE
+#define EVE_CMD_CAPTURE 0 /* Allow capturing the command stream and RAM_G writes into a file on the SD card, see EVE_Cmd_startCapture */
+#endif
+#define EVE_CMD_CAPTURE_BUFFER_SIZE 1024 /* Captured data is written to the file in blocks of this many bytes, a multiple of 4 */
+
+#ifndef EVE_CMD_FAULT_TRACE
+#define EVE_CMD_FAULT_TRACE 1 /* Keep the last words written to the command FIFO, and report them with the coprocessor error on fault, see EVE_Cmd_faultSink */
+#endif
+#define EVE_CMD_FAULT_TRACE_WORDS 16 /* Number of command words kept for the fault report, a power of two */
+
+#if defined(FT9XX_PLATFORM)
+#define EVE_ASYNC_TRANSFER 1 /* Allow bulk writes to be clocked out by the SPIM FIFO interrupt while the host continues working */
+#else
+#define EVE_ASYNC_TRANSFER 0
+#endif
+
+#if defined(FT9XX_PLATFORM)
+#define EVE_INTERRUPT 1 /* Latch falling edges of the EVE INT_N line with a host GPIO interrupt, see EVE_Hal_enableInterrupts */
+#else
+#define EVE_INTERRUPT 0
+#endif
+
+#ifndef EVE_HAL_SCRATCH_SIZE
+#define EVE_HAL_SCRATCH_SIZE 8192 /* Size in bytes of the default scratch arena, see EVE_Hal_scratchAlloc. QR code generation takes the most, two buffers of 3918 bytes */
+#endif
+
+/* Number of entries in the cluster link map table kept for each opened asset file.
+A file split over N fragments needs 2 * N + 2 entries, files that don't fit fall back to walking the FAT chain */
+#define EVE_LOADFILE_LINKMAP_SIZE 32
+
+/* Number of contiguous files in the SD card root directory indexed when the card is mounted.
+Indexed files are opened by EVE_Util_openAsset without a directory lookup, 0 disables the index */
+#define EVE_LOADFILE_INDEX_SIZE 32
 
 
 ///////////////////////////////////////////////////////////////////////
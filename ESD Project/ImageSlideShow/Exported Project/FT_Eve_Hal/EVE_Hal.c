@@ -80,7 +80,11 @@ EVE_HAL_EXPORT void EVE_Hal_defaults(EVE_HalParameters *parameters)
 
 EVE_HAL_EXPORT void EVE_Hal_defaultsEx(EVE_HalParameters *parameters, size_t deviceIdx)
 {
+	static uint32_t s_Scratch[EVE_HAL_SCRATCH_SIZE >> 2];
+
 	memset(parameters, 0, sizeof(EVE_HalParameters));
+	parameters->Scratch = s_Scratch;
+	parameters->ScratchSize = sizeof(s_Scratch);
 	eve_assert_do(EVE_HalImpl_defaults(parameters, deviceIdx));
 }
 
@@ -97,6 +101,8 @@ EVE_HAL_EXPORT bool EVE_Hal_open(EVE_HalContext *phost, const EVE_HalParameters
 	memset(phost, 0, sizeof(EVE_HalContext));
 	phost->UserContext = parameters->UserContext;
 	phost->CbCmdWait = parameters->CbCmdWait;
+	phost->Scratch = (uint8_t *)parameters->Scratch;
+	phost->ScratchSize = parameters->Scratch ? (parameters->ScratchSize & ~3UL) : 0;
 	return EVE_HalImpl_open(phost, parameters);
 }
 
@@ -118,6 +124,29 @@ EVE_HAL_EXPORT void EVE_Hal_close(EVE_HalContext *phost)
 	memset(phost, 0, sizeof(EVE_HalContext));
 }
 
+/**
+ * @brief Take a work buffer from the scratch arena
+ *
+ * @param phost Pointer to Hal context
+ * @param size Size in bytes
+ * @return void* Word aligned buffer, or NULL if the arena is exhausted
+ */
+EVE_HAL_EXPORT void *EVE_Hal_scratchAlloc(EVE_HalContext *phost, uint32_t size)
+{
+	uint32_t used = phost->ScratchUsed;
+	size = (size + 3) & ~3UL;
+	if (size > phost->ScratchSize - used)
+	{
+		eve_printf_debug("Scratch arena exhausted, %u of %u bytes in use, %u requested\n",
+		    (unsigned int)used, (unsigned int)phost->ScratchSize, (unsigned int)size);
+		return NULL;
+	}
+	phost->ScratchUsed = used + size;
+	if (phost->ScratchUsed > phost->ScratchPeak)
+		phost->ScratchPeak = phost->ScratchUsed;
+	return &phost->Scratch[used];
+}
+
 /**
  * @brief Idle handler for Eve_Hal framework
  *
@@ -195,6 +224,45 @@ EVE_HAL_EXPORT void EVE_Hal_rdMem(EVE_HalContext *phost, uint8_t *result, uint32
 	EVE_Hal_endTransfer(phost);
 }
 
+/**
+ * @brief Read a list of 32-bit registers
+ *
+ * Registers at ascending addresses no further than EVE_HAL_RDREGS_GAP bytes apart
+ * are read in a single transfer, otherwise a new transfer is started.
+ *
+ * @param phost Pointer to Hal context
+ * @param result Buffer receiving one value per register
+ * @param addr Register addresses, 4-byte aligned
+ * @param count Number of registers
+ */
+EVE_HAL_EXPORT void EVE_Hal_rdRegs(EVE_HalContext *phost, uint32_t *result, const uint32_t *addr, uint32_t count)
+{
+	uint32_t i;
+	uint32_t next = 0; /* Address the open transfer will read next */
+
+	for (i = 0; i < count; ++i)
+	{
+		eve_assert(!(addr[i] & 0x3));
+		if (i == 0 || addr[i] < next || (addr[i] - next) > EVE_HAL_RDREGS_GAP)
+		{
+			if (i)
+				EVE_Hal_endTransfer(phost);
+			EVE_Hal_startTransfer(phost, EVE_TRANSFER_READ, addr[i]);
+			next = addr[i];
+		}
+		while (next < addr[i])
+		{
+			/* Read through the gap */
+			EVE_Hal_transfer32(phost, 0);
+			next += 4;
+		}
+		result[i] = EVE_Hal_transfer32(phost, 0);
+		next += 4;
+	}
+	if (count)
+		EVE_Hal_endTransfer(phost);
+}
+
 /**
  * @brief Write 8 bits to Coprocessor's memory
  *
@@ -250,6 +318,10 @@ EVE_HAL_EXPORT void EVE_Hal_wrMem(EVE_HalContext *phost, uint32_t addr, const ui
 	EVE_Hal_startTransfer(phost, EVE_TRANSFER_WRITE, addr);
 	EVE_Hal_transferMem(phost, NULL, buffer, size);
 	EVE_Hal_endTransfer(phost);
+#if EVE_CMD_CAPTURE
+	if (phost->CmdCapture)
+		EVE_Cmd_captureMem(phost, addr, buffer, size, false);
+#endif
 }
 
 /**
@@ -265,6 +337,10 @@ EVE_HAL_EXPORT void EVE_Hal_wrProgMem(EVE_HalContext *phost, uint32_t addr, eve_
 	EVE_Hal_startTransfer(phost, EVE_TRANSFER_WRITE, addr);
 	EVE_Hal_transferProgMem(phost, NULL, buffer, size);
 	EVE_Hal_endTransfer(phost);
+#if EVE_CMD_CAPTURE
+	if (phost->CmdCapture)
+		EVE_Cmd_captureMem(phost, addr, (const void *)(uintptr_t)buffer, size, true);
+#endif
 }
 
 /**
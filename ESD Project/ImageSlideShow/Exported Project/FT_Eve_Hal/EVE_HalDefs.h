@@ -99,6 +99,8 @@ typedef bool (*EVE_Callback)(EVE_HalContext *phost);
 typedef int (*EVE_CoCmdHook)(EVE_HalContext *phost, uint32_t cmd, uint32_t state);
 /* Hook into coprocessor reset */
 typedef void (*EVE_ResetCallback)(EVE_HalContext *phost, bool fault);
+/* Called when the display list size estimate of the current frame reaches EVE_DL_ESTIMATE_WARN */
+typedef void (*EVE_DlEstimateCallback)(EVE_HalContext *phost, uint32_t words);
 
 
 typedef enum EVE_HOST_T
@@ -138,6 +140,13 @@ typedef struct EVE_HalParameters
 
 
 	uint8_t PowerDownPin; /* FT8XX power down pin number */
+#if EVE_INTERRUPT
+	uint8_t InterruptPin; /* FT8XX INT_N pin number */
+#endif
+
+	/* Memory for the scratch arena, word aligned. Defaults to a static buffer of EVE_HAL_SCRATCH_SIZE bytes */
+	void *Scratch;
+	uint32_t ScratchSize;
 
 
 } EVE_HalParameters;
@@ -150,8 +159,11 @@ typedef struct EVE_HalDlState
 #if (EVE_DL_OPTIMIZE)
 	uint32_t PaletteSource;
 	uint32_t ColorRGB;
+	uint32_t StencilFunc; // Parameter bits of STENCIL_FUNC
 	int16_t LineWidth;
 	int16_t PointSize;
+	int16_t VertexTranslateX;
+	int16_t VertexTranslateY;
 #endif
 #if (EVE_DL_CACHE_SCISSOR)
 	uint16_t ScissorX;
@@ -163,6 +175,10 @@ typedef struct EVE_HalDlState
 	uint8_t ColorA;
 	uint8_t Handle; // Current handle
 	uint8_t Cell; // Current cell
+	uint8_t BlendFunc; // Parameter bits of BLEND_FUNC
+	uint8_t StencilOp; // Parameter bits of STENCIL_OP
+	uint8_t StencilMask;
+	uint8_t ColorMask; // Parameter bits of COLOR_MASK
 #endif
 	uint8_t VertexFormat; // Current vertex format
 #if (EVE_DL_OPTIMIZE)
@@ -171,6 +187,60 @@ typedef struct EVE_HalDlState
 } EVE_HalDlState;
 #endif
 
+#if EVE_CMD_PEEPHOLE
+/* Number of display list opcodes tracked by the peephole optimizer */
+#define EVE_PEEPHOLE_OPCODES 48
+
+typedef struct EVE_HalPeephole
+{
+	EVE_CoCmdHook Next; /* Hook that was installed before the optimizer, called first */
+	uint32_t State[EVE_PEEPHOLE_OPCODES]; /* Last written value of each state instruction */
+	uint32_t Valid[2]; /* Opcodes with a known value in State */
+	uint32_t Changed[EVE_DL_STATE_STACK_SIZE][2]; /* Opcodes written since the matching SAVE_CONTEXT */
+	uint32_t Held; /* END or SAVE_CONTEXT held back to fold with the next instruction */
+	uint32_t Removed; /* Words removed since CMD_DLSTART */
+	uint32_t RemovedFrame; /* Words removed in the previous frame */
+	uint8_t Depth; /* SAVE_CONTEXT nesting */
+	uint8_t Primitive; /* Primitive of the last BEGIN, 0xFF when unknown */
+	bool HasHeld;
+} EVE_HalPeephole;
+#endif
+
+#if EVE_CMD_FUTURES
+#if (EVE_CMD_FUTURES > 254)
+#error EVE_CMD_FUTURES must be less than 255
+#endif
+/* Handle to a command result, combines the slot index with the sequence number of the slot */
+typedef uint16_t EVE_CmdFuture;
+#define EVE_CMD_FUTURE_INVALID 0xFFFF
+
+#define EVE_CMD_FUTURE_FREE 0
+#define EVE_CMD_FUTURE_PENDING 1 /* Command not yet passed by the coprocessor */
+#define EVE_CMD_FUTURE_READY 2 /* Result has been read */
+#define EVE_CMD_FUTURE_FAILED 3 /* Coprocessor faulted or was reset before passing the command */
+
+typedef struct EVE_HalCmdFuture
+{
+	uint32_t Result[3];
+	uint16_t Address; /* Offset of the result in RAM_CMD */
+	uint16_t End; /* Write pointer after the command */
+	uint8_t Words; /* Number of result words */
+	uint8_t State;
+	uint8_t Sequence;
+} EVE_HalCmdFuture;
+#endif
+
+#if EVE_HAL_STATS
+typedef struct EVE_HalStats
+{
+	uint32_t Transfers; /* Number of EVE_Hal_startTransfer calls, each costs a chip select and the address */
+	uint32_t BytesWritten; /* Bytes clocked out, including the address and dummy bytes */
+	uint32_t BytesRead; /* Bytes clocked in */
+	uint32_t RegPolls; /* Read transfers addressed to RAM_REG */
+	uint32_t CmdWords; /* 32-bit words written into the command FIFO */
+} EVE_HalStats;
+#endif
+
 typedef struct EVE_HalContext
 {
 	/* Pointer to user context */
@@ -189,11 +259,50 @@ typedef struct EVE_HalContext
 	EVE_CoCmdHook CoCmdHook;
 #endif
 
+#if EVE_CMD_PEEPHOLE
+	EVE_HalPeephole Peephole; /* State of the optimizer installed by EVE_CoCmd_peepholeEnable */
+#endif
+
+#if EVE_DL_ESTIMATE
+	/* Called once per frame when the display list estimate reaches EVE_DL_ESTIMATE_WARN */
+	EVE_DlEstimateCallback CbDlEstimate;
+	uint32_t DlEstimate; /* Estimated display list words since CMD_DLSTART */
+	uint32_t DlEstimateFrame; /* Estimate of the previous frame */
+	uint32_t DlEstimatePeak; /* Largest estimate of any frame */
+#endif
+
+#if EVE_HAL_STATS
+	EVE_HalStats Stats; /* Traffic since CMD_DLSTART */
+	EVE_HalStats StatsFrame; /* Traffic of the previous frame */
+#endif
+
 	EVE_STATUS_T Status;
 
+#if EVE_ASYNC_TRANSFER
+	/* Asynchronous write transfer state, owned by the SPIM interrupt while AsyncBusy is set */
+	const uint8_t *volatile AsyncBuffer;
+	volatile uint32_t AsyncRemaining;
+	volatile bool AsyncBusy; /* Cleared by the interrupt once the SPIM FIFO has drained */
+	bool AsyncPending; /* Set until the completion has been processed in the main context */
+	bool AsyncEndTransfer; /* Close the transfer once the asynchronous write completes */
+#endif
+
+#if EVE_INTERRUPT
+	/* INT_N state, InterruptFired and InterruptMillis are set by the GPIO interrupt */
+	uint8_t InterruptPin;
+	uint8_t InterruptMask; /* Flags enabled in REG_INT_MASK, 0 when interrupts are off */
+	volatile bool InterruptFired; /* Falling edge seen since the last EVE_Hal_armInterrupt */
+	volatile uint32_t InterruptMillis; /* EVE_millis at the falling edge */
+#endif
 
 	uint8_t PCLK;
 
+	/* Scratch arena for work buffers that only live for the duration of one operation */
+	uint8_t *Scratch;
+	uint32_t ScratchSize;
+	uint32_t ScratchUsed;
+	uint32_t ScratchPeak; /* Largest ScratchUsed so far, for sizing the arena */
+
 	/* User space width and height,
 	based on REG_HSIZE, REG_VSIZE and REG_ROTATE */
 	uint32_t Width;
@@ -203,6 +312,7 @@ typedef struct EVE_HalContext
 
 	EVE_SPI_CHANNELS_T SpiChannels; /* Variable to contain single/dual/quad channels */
 	uint8_t SpiDummyBytes; /* Number of dummy bytes as 1 or 2 for SPI read */
+	uint16_t SpiDivider; /* SPI clock divider of the host, 0 for the platform default */
 
 	uint8_t SpiCsPin; /* SPI chip select number of FT8XX chip */
 	uint8_t PowerDownPin; /* FT8XX power down pin number */
@@ -215,10 +325,20 @@ typedef struct EVE_HalContext
 
 	uint16_t CmdSpace; /* Free space, cached value */
 
+#if EVE_CMD_FUTURES
+	/* Results of commands which are read back from RAM_CMD once the coprocessor has passed them.
+	Resolved whenever free space is refreshed, before the host can write over them */
+	EVE_HalCmdFuture CmdFutures[EVE_CMD_FUTURES];
+	uint8_t CmdFuturesPending;
+	uint8_t CmdFutureNext; /* Slot tried first for the next future */
+	uint8_t CmdFutureSequence;
+#endif
+
 	/* Media FIFO state */
 	uint32_t MediaFifoAddress;
 	uint32_t MediaFifoSize;
 	FIL LoadFileObj;
+	DWORD LoadFileLinkMap[EVE_LOADFILE_LINKMAP_SIZE];
 	ptrdiff_t LoadFileRemaining;
 
 	/* Display list optimization and compatibility caches */
@@ -228,6 +348,8 @@ typedef struct EVE_HalContext
 #endif
 #if (EVE_DL_OPTIMIZE)
 	uint8_t DlPrimitive;
+	uint32_t DlElided; /* Display list words skipped as redundant since CMD_DLSTART */
+	uint32_t DlElidedFrame; /* Display list words skipped in the previous frame */
 	uint32_t CoFgColor;
 	uint32_t CoBgColor;
 	bool CoBitmapTransform; /* BitmapTransform other than identity is set on the coprocessor */
@@ -239,7 +361,15 @@ typedef struct EVE_HalContext
 	uint8_t DebugBackup[RAM_ERR_REPORT_MAX];
 #endif
 
+#if EVE_CMD_FAULT_TRACE
+	uint32_t CmdTrace[EVE_CMD_FAULT_TRACE_WORDS]; /* Last words written to the command FIFO */
+	uint32_t CmdTraceBytes; /* Bytes written to the command FIFO, wraps around */
+#endif
+
 	/* Status flags */
+#if EVE_CMD_CAPTURE
+	bool CmdCapture; /* Flagged while command and RAM_G writes are captured */
+#endif
 	bool CmdFunc; /* Flagged while transfer to cmd is kept open */
 	bool CmdFault; /* Flagged when coprocessor is in fault mode and needs to be reset */
 	bool CmdWaiting; /* Flagged while waiting for CMD write (to check during any function that may be called by CbCmdWait) */
@@ -312,6 +442,7 @@ EVE_HAL_EXPORT uint8_t EVE_Hal_rd8(EVE_HalContext *phost, uint32_t addr);
 EVE_HAL_EXPORT uint16_t EVE_Hal_rd16(EVE_HalContext *phost, uint32_t addr);
 EVE_HAL_EXPORT uint32_t EVE_Hal_rd32(EVE_HalContext *phost, uint32_t addr);
 EVE_HAL_EXPORT void EVE_Hal_rdMem(EVE_HalContext *phost, uint8_t *result, uint32_t addr, uint32_t size);
+EVE_HAL_EXPORT void EVE_Hal_rdRegs(EVE_HalContext *phost, uint32_t *result, const uint32_t *addr, uint32_t count);
 
 EVE_HAL_EXPORT void EVE_Hal_wr8(EVE_HalContext *phost, uint32_t addr, uint8_t v);
 EVE_HAL_EXPORT void EVE_Hal_wr16(EVE_HalContext *phost, uint32_t addr, uint16_t v);
@@ -320,6 +451,26 @@ EVE_HAL_EXPORT void EVE_Hal_wrMem(EVE_HalContext *phost, uint32_t addr, const ui
 EVE_HAL_EXPORT void EVE_Hal_wrProgMem(EVE_HalContext *phost, uint32_t addr, eve_progmem_const uint8_t *buffer, uint32_t size);
 EVE_HAL_EXPORT void EVE_Hal_wrString(EVE_HalContext *phost, uint32_t addr, const char *str, uint32_t index, uint32_t size, uint32_t padMask);
 
+/*************
+** SCRATCH **
+*************/
+
+/* Takes a word aligned work buffer from the scratch arena, NULL when the arena is exhausted.
+Work buffers are given back all at once with EVE_Hal_scratchRelease, to the mark taken before the first one.
+Do not keep them past the operation, nor across anything that may yield to other users of the arena */
+EVE_HAL_EXPORT void *EVE_Hal_scratchAlloc(EVE_HalContext *phost, uint32_t size);
+
+static inline uint32_t EVE_Hal_scratchMark(EVE_HalContext *phost)
+{
+	return phost->ScratchUsed;
+}
+
+static inline void EVE_Hal_scratchRelease(EVE_HalContext *phost, uint32_t mark)
+{
+	eve_assert(mark <= phost->ScratchUsed);
+	phost->ScratchUsed = mark;
+}
+
 /*********
 ** CAPS **
 *********/
@@ -444,6 +595,11 @@ EVE_HAL_EXPORT bool EVE_Hal_powerCycle(EVE_HalContext *phost, bool up);
 /* Switch EVE to different SPI channel mode */
 EVE_HAL_EXPORT void EVE_Hal_setSPI(EVE_HalContext *phost, EVE_SPI_CHANNELS_T numchnls, uint8_t numdummy);
 
+#if defined(FT9XX_PLATFORM)
+/* Change the SPI clock of the host, keeping the channel mode. The chip needs no change */
+EVE_HAL_EXPORT void EVE_Hal_setSPIDivider(EVE_HalContext *phost, uint16_t divider);
+#endif
+
 /* Restore platform to previously configured EVE SPI channel mode */
 EVE_HAL_EXPORT void EVE_Hal_restoreSPI(EVE_HalContext *phost);
 
@@ -497,6 +653,10 @@ Uses the back of RAM_G. */
 
 EVE_HAL_EXPORT uint32_t EVE_millis();
 EVE_HAL_EXPORT uint64_t EVE_millis64();
+#if defined(FT9XX_PLATFORM)
+/* Microseconds, derived from the millisecond timer count. Wraps after ~71 minutes */
+EVE_HAL_EXPORT uint32_t EVE_micros();
+#endif
 EVE_HAL_EXPORT void EVE_sleep(uint32_t ms);
 
 #endif /* #ifndef EVE_HAL_INCL__H */
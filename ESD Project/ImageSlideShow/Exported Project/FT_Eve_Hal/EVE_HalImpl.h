@@ -77,6 +77,33 @@ EVE_HAL_EXPORT uint32_t EVE_Hal_transfer32(EVE_HalContext *phost, uint32_t value
 
 EVE_HAL_EXPORT void EVE_Hal_flush(EVE_HalContext *phost);
 
+#if EVE_ASYNC_TRANSFER
+/* Start writing a memory buffer using the currently open write transfer, without waiting for it to complete.
+The buffer must remain valid until `EVE_Hal_transferDone` returns true. Any other HAL call waits for the write to complete first.
+When `endTransfer` is set, the transfer is closed automatically once the write completes. */
+EVE_HAL_EXPORT void EVE_Hal_transferMemAsync(EVE_HalContext *phost, const uint8_t *buffer, uint32_t size, bool endTransfer);
+
+/* Poll for completion of an asynchronous write */
+EVE_HAL_EXPORT bool EVE_Hal_transferDone(EVE_HalContext *phost);
+
+/* Wait for an asynchronous write to complete */
+EVE_HAL_EXPORT void EVE_Hal_transferWait(EVE_HalContext *phost);
+#endif
+
+#if EVE_INTERRUPT
+/* Enable the specified REG_INT_FLAGS bits on INT_N, and latch the falling edges on the host. Pass 0 to disable */
+EVE_HAL_EXPORT void EVE_Hal_enableInterrupts(EVE_HalContext *phost, uint8_t mask);
+
+/* Clear InterruptFired and the pending flags in EVE, so the next event produces a new edge. Returns the flags that were pending */
+EVE_HAL_EXPORT uint8_t EVE_Hal_armInterrupt(EVE_HalContext *phost);
+
+/* Check whether INT_N has fired since the last EVE_Hal_armInterrupt, without accessing SPI */
+static inline bool EVE_Hal_interruptFired(EVE_HalContext *phost)
+{
+	return phost->InterruptFired;
+}
+#endif
+
 /*********
 ** MISC **
 *********/
@@ -42,6 +42,38 @@ static const pad_dir_t s_SpimFuncSS[4] = { pad_spim_ss0, pad_spim_ss1, pad_spim_
 #endif
 #define GPIO_SS_NB (sizeof(s_SpimGpioSS) / sizeof(s_SpimGpioSS[0]))
 
+/* Size of the SPIM FIFO, as configured in setSPI */
+#define EVE_SPIM_FIFO_SIZE 64
+
+/* SPIM clock divider of the 100 MHz peripheral clock, unless EVE_Hal_setSPIDivider selected another */
+#ifndef EVE_SPIM_DIVIDER
+#define EVE_SPIM_DIVIDER 4
+#endif
+
+/* Reads of at least this many bytes, such as snapshots, RAM_G backups and memory compares, use the bulk read mode */
+#ifndef EVE_SPIM_BULK_READ_MIN
+#define EVE_SPIM_BULK_READ_MIN 256
+#endif
+
+/* Receive FIFO trigger level of the bulk read mode. Register reads keep the low latency level of 1 set in setSPI */
+#ifndef EVE_SPIM_BULK_RX_TRIGGER
+#define EVE_SPIM_BULK_RX_TRIGGER 32
+#endif
+
+#if EVE_ASYNC_TRANSFER
+/* Context currently owning the SPIM transmit interrupt */
+static EVE_HalContext *volatile s_AsyncHost = NULL;
+
+static void spimIsr();
+#endif
+
+#if EVE_INTERRUPT
+/* Context which has the EVE INT_N interrupt enabled */
+static EVE_HalContext *volatile s_InterruptHost = NULL;
+
+static void gpioIsr();
+#endif
+
 /*********
 ** INIT **
 *********/
@@ -52,6 +84,12 @@ static const pad_dir_t s_SpimFuncSS[4] = { pad_spim_ss0, pad_spim_ss1, pad_spim_
  */
 void EVE_HalImpl_initialize()
 {
+#if EVE_ASYNC_TRANSFER
+	interrupt_attach(interrupt_spim, (uint8_t)interrupt_spim, spimIsr);
+#endif
+#if EVE_INTERRUPT
+	interrupt_attach(interrupt_gpio, (uint8_t)interrupt_gpio, gpioIsr);
+#endif
 }
 
 /**
@@ -92,6 +130,9 @@ EVE_HAL_EXPORT bool EVE_Hal_isDevice(EVE_HalContext *phost, size_t deviceIdx)
 bool EVE_HalImpl_defaults(EVE_HalParameters *parameters, size_t deviceIdx)
 {
 	parameters->PowerDownPin = GPIO_FT800_PWD;
+#if EVE_INTERRUPT
+	parameters->InterruptPin = GPIO_FT800_INT;
+#endif
 	parameters->SpiCsPin = deviceIdx < GPIO_SS_NB ? deviceIdx : 0; // SS0-3
 	return true;
 }
@@ -108,6 +149,10 @@ void setSPI(EVE_HalContext *phost, EVE_SPI_CHANNELS_T numchnls, uint8_t numdummy
 	uint8_t spimGpio = s_SpimGpioSS[phost->SpiCsPin];
 	pad_dir_t spimFunc = s_SpimFuncSS[phost->SpiCsPin];
 
+#if EVE_ASYNC_TRANSFER
+	EVE_Hal_transferWait(phost);
+#endif
+
 	/* Reconfigure the SPI */
 	eve_assert_do(!sys_enable(sys_device_spi_master));
 	gpio_function(GPIO_SPIM_CLK, pad_spim_sck); /* GPIO27 to SPIM_CLK */
@@ -131,11 +176,11 @@ void setSPI(EVE_HalContext *phost, EVE_SPI_CHANNELS_T numchnls, uint8_t numdummy
 
 	gpio_write(spimGpio, 1);
 
-	/* Change clock frequency to 25 MHz (100 MHz / 4) */
-	eve_assert_do(!spi_init(SPIM, spi_dir_master, spi_mode_0, 4));
+	/* 25 MHz (100 MHz / 4) by default */
+	eve_assert_do(!spi_init(SPIM, spi_dir_master, spi_mode_0, phost->SpiDivider ? phost->SpiDivider : EVE_SPIM_DIVIDER));
 
 	/* Enable FIFO of QSPI */
-	spi_option(SPIM, spi_option_fifo_size, 64);
+	spi_option(SPIM, spi_option_fifo_size, EVE_SPIM_FIFO_SIZE);
 	spi_option(SPIM, spi_option_fifo, 1);
 	spi_option(SPIM, spi_option_fifo_receive_trigger, 1);
 
@@ -176,6 +221,14 @@ bool EVE_HalImpl_open(EVE_HalContext *phost, const EVE_HalParameters *parameters
 	gpio_dir(phost->PowerDownPin, pad_dir_output);
 	gpio_write(phost->PowerDownPin, 0);
 
+#if EVE_INTERRUPT
+	/* INT_N is open drain, active low. Interrupts stay off in EVE until EVE_Hal_enableInterrupts */
+	phost->InterruptPin = parameters->InterruptPin;
+	gpio_function(phost->InterruptPin, pad_func_0);
+	gpio_dir(phost->InterruptPin, pad_dir_input);
+	gpio_pull(phost->InterruptPin, pad_pull_pullup);
+#endif
+
 	/* Initialize single channel */
 	setSPI(phost, EVE_SPI_SINGLE_CHANNEL, 1);
 
@@ -195,6 +248,13 @@ bool EVE_HalImpl_open(EVE_HalContext *phost, const EVE_HalParameters *parameters
  */
 void EVE_HalImpl_close(EVE_HalContext *phost)
 {
+#if EVE_INTERRUPT
+	if (s_InterruptHost == phost)
+	{
+		gpio_interrupt_disable(phost->InterruptPin);
+		s_InterruptHost = NULL;
+	}
+#endif
 	phost->Status = EVE_STATUS_CLOSED;
 	--g_HalPlatform.OpenedDevices;
 	spi_close(SPIM, phost->SpiCsPin);
@@ -223,6 +283,9 @@ void EVE_HalImpl_idle(EVE_HalContext *phost)
  */
 void EVE_Hal_startTransfer(EVE_HalContext *phost, EVE_TRANSFER_T rw, uint32_t addr)
 {
+#if EVE_ASYNC_TRANSFER
+	EVE_Hal_transferWait(phost);
+#endif
 	eve_assert(phost->Status == EVE_STATUS_OPENED);
 
 	if (rw == EVE_TRANSFER_READ)
@@ -235,6 +298,11 @@ void EVE_Hal_startTransfer(EVE_HalContext *phost, EVE_TRANSFER_T rw, uint32_t ad
 		spi_open(SPIM, phost->SpiCsPin);
 		spi_writen(SPIM, spidata, 3 + phost->SpiDummyBytes);
 		phost->Status = EVE_STATUS_READING;
+#if EVE_HAL_STATS
+		phost->Stats.BytesWritten += 3 + phost->SpiDummyBytes;
+		if ((addr & ~0xFFFUL) == RAM_REG)
+			++phost->Stats.RegPolls;
+#endif
 	}
 	else
 	{
@@ -247,7 +315,13 @@ void EVE_Hal_startTransfer(EVE_HalContext *phost, EVE_TRANSFER_T rw, uint32_t ad
 		spi_writen(SPIM, spidata, 3);
 
 		phost->Status = EVE_STATUS_WRITING;
+#if EVE_HAL_STATS
+		phost->Stats.BytesWritten += 3;
+#endif
 	}
+#if EVE_HAL_STATS
+	++phost->Stats.Transfers;
+#endif
 }
 
 /**
@@ -257,6 +331,11 @@ void EVE_Hal_startTransfer(EVE_HalContext *phost, EVE_TRANSFER_T rw, uint32_t ad
  */
 void EVE_Hal_endTransfer(EVE_HalContext *phost)
 {
+#if EVE_ASYNC_TRANSFER
+	EVE_Hal_transferWait(phost);
+	if (phost->Status == EVE_STATUS_OPENED)
+		return; /* Already closed on completion of an asynchronous write */
+#endif
 	eve_assert(phost->Status == EVE_STATUS_READING || phost->Status == EVE_STATUS_WRITING);
 
 	spi_close(SPIM, phost->SpiCsPin);
@@ -283,7 +362,24 @@ void EVE_Hal_flush(EVE_HalContext *phost)
  */
 static inline void rdBuffer(EVE_HalContext *phost, uint8_t *buffer, uint32_t size)
 {
-	spi_readn(SPIM, buffer, size);
+#if EVE_ASYNC_TRANSFER
+	EVE_Hal_transferWait(phost);
+#endif
+#if EVE_HAL_STATS
+	phost->Stats.BytesRead += size;
+#endif
+	if (size >= EVE_SPIM_BULK_READ_MIN)
+	{
+		/* Whole FIFOs are moved in bursts at the higher trigger level, the tail at the low latency level */
+		uint32_t bulk = size & ~(uint32_t)(EVE_SPIM_FIFO_SIZE - 1);
+		spi_option(SPIM, spi_option_fifo_receive_trigger, EVE_SPIM_BULK_RX_TRIGGER);
+		spi_readn(SPIM, buffer, bulk);
+		spi_option(SPIM, spi_option_fifo_receive_trigger, 1);
+		buffer += bulk;
+		size -= bulk;
+	}
+	if (size)
+		spi_readn(SPIM, buffer, size);
 }
 
 /**
@@ -295,9 +391,128 @@ static inline void rdBuffer(EVE_HalContext *phost, uint8_t *buffer, uint32_t siz
  */
 static inline void wrBuffer(EVE_HalContext *phost, const uint8_t *buffer, uint32_t size)
 {
+#if EVE_ASYNC_TRANSFER
+	EVE_Hal_transferWait(phost);
+#endif
 	spi_writen(SPIM, buffer, size);
+#if EVE_HAL_STATS
+	phost->Stats.BytesWritten += size;
+#endif
+}
+
+#if EVE_ASYNC_TRANSFER
+/**
+ * @brief SPIM transmit FIFO empty interrupt, refills the FIFO from the pending asynchronous write
+ *
+ */
+static void spimIsr()
+{
+	EVE_HalContext *phost = s_AsyncHost;
+	uint32_t chunk;
+
+	if (!spi_is_interrupted(SPIM, spi_interrupt_transmit_empty))
+		return;
+
+	if (!phost || !phost->AsyncRemaining)
+	{
+		/* FIFO has drained after the last chunk */
+		spi_disable_interrupt(SPIM, spi_interrupt_transmit_empty);
+		s_AsyncHost = NULL;
+		if (phost)
+			phost->AsyncBusy = false;
+		return;
+	}
+
+	chunk = min(phost->AsyncRemaining, EVE_SPIM_FIFO_SIZE);
+	spi_writen(SPIM, phost->AsyncBuffer, chunk);
+	phost->AsyncBuffer += chunk;
+	phost->AsyncRemaining -= chunk;
+}
+
+/**
+ * @brief Start writing a block of data to Coprocessor without waiting for it to complete
+ *
+ * @param phost Pointer to Hal context
+ * @param buffer Data buffer to write, must remain valid until the write completes
+ * @param size Size of buffer
+ * @param endTransfer Close the transfer once the write completes
+ */
+void EVE_Hal_transferMemAsync(EVE_HalContext *phost, const uint8_t *buffer, uint32_t size, bool endTransfer)
+{
+	EVE_Hal_transferWait(phost);
+	eve_assert(phost->Status == EVE_STATUS_WRITING);
+#if EVE_HAL_STATS
+	phost->Stats.BytesWritten += size;
+#endif
+
+	if (size <= EVE_SPIM_FIFO_SIZE)
+	{
+		/* Not worth the interrupt overhead */
+		spi_writen(SPIM, buffer, size);
+		if (endTransfer)
+			EVE_Hal_endTransfer(phost);
+		return;
+	}
+
+	phost->AsyncBuffer = buffer;
+	phost->AsyncRemaining = size;
+	phost->AsyncEndTransfer = endTransfer;
+	phost->AsyncPending = true;
+	phost->AsyncBusy = true;
+	s_AsyncHost = phost;
+
+	/* The FIFO is empty at this point, so the interrupt fires right away to send the first chunk */
+	spi_enable_interrupt(SPIM, spi_interrupt_transmit_empty);
+}
+
+/**
+ * @brief Process the completion of an asynchronous write in the main context
+ *
+ * @param phost Pointer to Hal context
+ */
+static void completeAsync(EVE_HalContext *phost)
+{
+	while (phost->AsyncBusy)
+		eve_noop();
+
+	phost->AsyncPending = false;
+	if (phost->AsyncEndTransfer)
+	{
+		phost->AsyncEndTransfer = false;
+		spi_close(SPIM, phost->SpiCsPin);
+		phost->Status = EVE_STATUS_OPENED;
+	}
 }
 
+/**
+ * @brief Poll for completion of an asynchronous write
+ *
+ * @param phost Pointer to Hal context
+ * @return true True if no asynchronous write is in progress
+ * @return false False if the write is still being clocked out
+ */
+bool EVE_Hal_transferDone(EVE_HalContext *phost)
+{
+	if (!phost->AsyncPending)
+		return true;
+	if (phost->AsyncBusy)
+		return false;
+	completeAsync(phost);
+	return true;
+}
+
+/**
+ * @brief Wait for an asynchronous write to complete
+ *
+ * @param phost Pointer to Hal context
+ */
+void EVE_Hal_transferWait(EVE_HalContext *phost)
+{
+	if (phost->AsyncPending)
+		completeAsync(phost);
+}
+#endif
+
 /**
  * @brief Write 8 bit to Coprocessor
  *
@@ -307,6 +522,15 @@ static inline void wrBuffer(EVE_HalContext *phost, const uint8_t *buffer, uint32
  */
 static inline uint8_t transfer8(EVE_HalContext *phost, uint8_t value)
 {
+#if EVE_ASYNC_TRANSFER
+	EVE_Hal_transferWait(phost);
+#endif
+#if EVE_HAL_STATS
+	if (phost->Status == EVE_STATUS_READING)
+		++phost->Stats.BytesRead;
+	else
+		++phost->Stats.BytesWritten;
+#endif
 	if (phost->Status == EVE_STATUS_READING)
 	{
 		spi_read(SPIM, value);
@@ -506,6 +730,9 @@ uint32_t EVE_Hal_transferString(EVE_HalContext *phost, const char *str, uint32_t
  */
 void EVE_Hal_hostCommand(EVE_HalContext *phost, uint8_t cmd)
 {
+#if EVE_ASYNC_TRANSFER
+	EVE_Hal_transferWait(phost);
+#endif
 	eve_assert(phost->Status == EVE_STATUS_OPENED);
 
 	uint8_t hcmd[4] = { 0 };
@@ -527,6 +754,9 @@ void EVE_Hal_hostCommand(EVE_HalContext *phost, uint8_t cmd)
  */
 void EVE_Hal_hostCommandExt3(EVE_HalContext *phost, uint32_t cmd)
 {
+#if EVE_ASYNC_TRANSFER
+	EVE_Hal_transferWait(phost);
+#endif
 	eve_assert(phost->Status == EVE_STATUS_OPENED);
 
 	uint8_t hcmd[4] = { 0 };
@@ -552,6 +782,11 @@ bool EVE_Hal_powerCycle(EVE_HalContext *phost, bool up)
 	{
 		gpio_write(phost->PowerDownPin, 0);
 		EVE_sleep(20);
+#if EVE_INTERRUPT
+		/* EVE comes back with interrupts disabled */
+		phost->InterruptMask = 0;
+		phost->InterruptFired = false;
+#endif
 		setSPI(phost, EVE_SPI_SINGLE_CHANNEL, 1);
 		gpio_write(phost->PowerDownPin, 1);
 		EVE_sleep(20);
@@ -566,6 +801,64 @@ bool EVE_Hal_powerCycle(EVE_HalContext *phost, bool up)
 	return true;
 }
 
+#if EVE_INTERRUPT
+/**
+ * @brief GPIO interrupt, latches a falling edge on INT_N
+ *
+ */
+static void gpioIsr()
+{
+	EVE_HalContext *phost = s_InterruptHost;
+
+	if (phost && gpio_is_interrupted(phost->InterruptPin) && !phost->InterruptFired)
+	{
+		phost->InterruptMillis = EVE_millis();
+		phost->InterruptFired = true;
+	}
+}
+
+/**
+ * @brief Enable EVE interrupt flags on the INT_N line
+ *
+ * @param phost Pointer to Hal context
+ * @param mask Interrupt flags to enable, 0 to disable interrupts
+ */
+void EVE_Hal_enableInterrupts(EVE_HalContext *phost, uint8_t mask)
+{
+	EVE_Hal_wr8(phost, REG_INT_EN, 0);
+	gpio_interrupt_disable(phost->InterruptPin);
+	phost->InterruptMask = mask;
+	if (!mask)
+	{
+		if (s_InterruptHost == phost)
+			s_InterruptHost = NULL;
+		return;
+	}
+
+	s_InterruptHost = phost;
+	EVE_Hal_wr8(phost, REG_INT_MASK, mask);
+	EVE_Hal_wr8(phost, REG_INT_EN, 1);
+	EVE_Hal_armInterrupt(phost);
+	gpio_interrupt_enable(phost->InterruptPin, gpio_int_edge_falling);
+}
+
+/**
+ * @brief Clear pending EVE interrupt flags, which releases INT_N for the next falling edge
+ *
+ * @param phost Pointer to Hal context
+ * @return uint8_t Interrupt flags that were pending
+ */
+uint8_t EVE_Hal_armInterrupt(EVE_HalContext *phost)
+{
+	if (!phost->InterruptMask)
+		return 0;
+
+	/* Clear the host flag first, an edge after the read below must not be lost */
+	phost->InterruptFired = false;
+	return EVE_Hal_rd8(phost, REG_INT_FLAGS);
+}
+#endif
+
 /**
  * @brief Set number of SPI channel
  *
@@ -594,6 +887,18 @@ void EVE_Hal_setSPI(EVE_HalContext *phost, EVE_SPI_CHANNELS_T numchnls, uint8_t
 	setSPI(phost, numchnls, numdummy);
 }
 
+/**
+ * @brief Set the SPIM clock divider, on the host side only
+ *
+ * @param phost Pointer to Hal context
+ * @param divider 2 to 512 in powers of two, 0 for the default EVE_SPIM_DIVIDER
+ */
+void EVE_Hal_setSPIDivider(EVE_HalContext *phost, uint16_t divider)
+{
+	phost->SpiDivider = divider;
+	setSPI(phost, phost->SpiChannels, phost->SpiDummyBytes);
+}
+
 void EVE_Hal_restoreSPI(EVE_HalContext *phost)
 {
 	if (EVE_CHIPID < EVE_FT810)
@@ -777,7 +1082,7 @@ void EVE_Mcu_release()
 *********/
 
 /* Globals for interrupt implementation */
-static uint32_t s_TotalMilliseconds = 0;
+static volatile uint32_t s_TotalMilliseconds = 0;
 static uint64_t s_TotalMilliseconds64 = 0;
 
 /**
@@ -834,6 +1139,29 @@ uint64_t EVE_millis64()
 	return s_TotalMilliseconds64;
 }
 
+/**
+ * @brief Get clock in microsecond
+ *
+ * The millisecond timer counts up at 1 MHz (100 MHz / FT900_TIMER_PRESCALE_VALUE),
+ * and overflows every FT900_TIMER_OVERFLOW_VALUE counts
+ *
+ * @return uint32_t Clock in microseconds
+ */
+uint32_t EVE_micros()
+{
+	uint32_t ms;
+	uint16_t count;
+
+	/* Retry if the millisecond tick happened while reading the count */
+	do
+	{
+		ms = s_TotalMilliseconds;
+		timer_read(FT900_FT_MILLIS_TIMER, &count);
+	} while (ms != s_TotalMilliseconds);
+
+	return (ms * 1000) + count;
+}
+
 /**
  * @brief Clear the interrupt and increment the counter
  *
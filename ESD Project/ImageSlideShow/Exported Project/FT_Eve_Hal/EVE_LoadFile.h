@@ -45,6 +45,10 @@ On embedded platforms, filename character set depends on the filesystem library.
 EVE_HAL_EXPORT bool EVE_Util_loadSdCard(EVE_HalContext *phost);
 EVE_HAL_EXPORT bool EVE_Util_sdCardReady(EVE_HalContext *phost);
 
+/* Check for SD card insertion or removal at most once every EVE_SDCARD_POLL_MS milliseconds.
+Cheap enough to call every frame. Returns whether the SD card is mounted */
+EVE_HAL_EXPORT bool EVE_Util_pollSdCard(EVE_HalContext *phost);
+
 EVE_HAL_EXPORT bool EVE_Util_loadRawFile(EVE_HalContext *phost, uint32_t address, const char *filename);
 EVE_HAL_EXPORT bool EVE_Util_loadInflateFile(EVE_HalContext *phost, uint32_t address, const char *filename);
 
@@ -52,9 +56,34 @@ EVE_HAL_EXPORT bool EVE_Util_loadInflateFile(EVE_HalContext *phost, uint32_t add
 The image format is provided as output to the optional format argument */
 EVE_HAL_EXPORT bool EVE_Util_loadImageFile(EVE_HalContext *phost, uint32_t address, const char *filename, uint32_t *format);
 
-/* Load a file into the coprocessor FIFO */
+/* Load a file into the coprocessor FIFO, in whole sectors that are read while the previous one is sent.
+If transfered is set, the file may be streamed partially, as far as the FIFO has space without waiting,
+and will be kept open until it has been sent completely or EVE_Util_closeCmdFile is called.
+Filename may be omitted in subsequent calls. As a slice may end in the middle of a command,
+no other command may be sent until the whole file has been written */
 EVE_HAL_EXPORT bool EVE_Util_loadCmdFile(EVE_HalContext *phost, const char *filename, uint32_t *transfered);
 
+/* Bytes of the file kept open by a partial EVE_Util_loadCmdFile that remain to be sent */
+EVE_HAL_EXPORT uint32_t EVE_Util_cmdFileRemaining(EVE_HalContext *phost);
+
+EVE_HAL_EXPORT void EVE_Util_closeCmdFile(EVE_HalContext *phost);
+
+/* Timing of a replayed capture */
+typedef struct EVE_CaptureStats
+{
+	uint32_t Frames;
+	uint32_t CmdBytes; /* Bytes written into the command FIFO */
+	uint32_t MemBytes; /* Bytes written with EVE_Hal_wrMem */
+	uint32_t TotalMs; /* Until the coprocessor finished the last command */
+	uint32_t FrameMinMs; /* Shortest and longest time between swaps as seen by the host, */
+	uint32_t FrameMaxMs; /* once the FIFO is full this follows the coprocessor */
+} EVE_CaptureStats;
+
+/* Replay a file written by EVE_Cmd_startCapture as fast as the coprocessor takes it.
+RAM_G and registers must be in the state they were in when the capture started.
+Returns false if the file is not a capture or a coprocessor fault occurred */
+EVE_HAL_EXPORT bool EVE_Util_replayCmdFile(EVE_HalContext *phost, const char *filename, EVE_CaptureStats *stats);
+
 /* Read a file into a buffer, returns the number of bytes read */
 EVE_HAL_EXPORT size_t EVE_Util_readFile(EVE_HalContext *phost, uint8_t *buffer, size_t size, const char *filename);
 
@@ -65,8 +94,70 @@ and stop once the coprocessor has processed it.
 Filename may be omitted in subsequent calls */
 EVE_HAL_EXPORT bool EVE_Util_loadMediaFile(EVE_HalContext *phost, const char *filename, uint32_t *transfered);
 
+/* Refill ahead from the file kept open by a partial EVE_Util_loadMediaFile.
+Does nothing while the media FIFO holds at least watermark bytes, otherwise
+fills the free space with whole sector reads. Never waits on the coprocessor,
+suitable for idle and wait callbacks. Returns the number of bytes written */
+EVE_HAL_EXPORT uint32_t EVE_Util_fillMediaFile(EVE_HalContext *phost, uint32_t watermark);
+
+/* Reposition the file kept open by a partial EVE_Util_loadMediaFile, so the media FIFO
+is fed size bytes from offset onwards. Seeks through the cluster link map table.
+Once repositioned, the file stays open at the end of the range for further seeks,
+until EVE_Util_closeFile is called. Returns false if no media file is open */
+EVE_HAL_EXPORT bool EVE_Util_seekMediaFile(EVE_HalContext *phost, uint32_t offset, uint32_t size);
+
 EVE_HAL_EXPORT void EVE_Util_closeFile(EVE_HalContext *phost);
 
+#if EVE_CMD_CAPTURE
+/* File written by the command stream capture, see EVE_Cmd_startCapture */
+EVE_HAL_EXPORT bool EVE_Util_openCaptureFile(EVE_HalContext *phost, const char *filename);
+EVE_HAL_EXPORT bool EVE_Util_writeCaptureFile(EVE_HalContext *phost, const void *buffer, uint32_t size);
+EVE_HAL_EXPORT void EVE_Util_closeCaptureFile(EVE_HalContext *phost);
+#endif
+
+/* File written sequentially, replaced when it exists */
+typedef struct EVE_WriteFile
+{
+	FIL File;
+} EVE_WriteFile;
+
+EVE_HAL_EXPORT bool EVE_Util_openWriteFile(EVE_HalContext *phost, EVE_WriteFile *file, const char *filename);
+EVE_HAL_EXPORT bool EVE_Util_writeFile(EVE_HalContext *phost, EVE_WriteFile *file, const void *buffer, uint32_t size);
+
+/* Returns false when the data could not be flushed to the card */
+EVE_HAL_EXPORT bool EVE_Util_closeWriteFile(EVE_HalContext *phost, EVE_WriteFile *file);
+
+/* Handle to an asset file kept open for random access.
+Seeking uses a cluster link map table built at open, so it does not walk the FAT chain.
+Whole sectors of a contiguous file are read directly from the card, bypassing FatFS */
+typedef struct EVE_Asset
+{
+	FIL File;
+	DWORD LinkMap[EVE_LOADFILE_LINKMAP_SIZE];
+	uint32_t Size;
+	DWORD Sector; /* First sector when the file clusters are contiguous, 0 otherwise */
+	bool FastSeek; /* False if the file is too fragmented for the link map table */
+	bool Indexed; /* Opened from the asset index, there is no FatFS file object */
+} EVE_Asset;
+
+/* Open an asset file for random access.
+Files in the root directory are looked up in the index built at mount time first */
+EVE_HAL_EXPORT bool EVE_Util_openAsset(EVE_HalContext *phost, EVE_Asset *asset, const char *filename);
+
+/* Read from an asset at the given offset into a buffer, returns the number of bytes read */
+EVE_HAL_EXPORT size_t EVE_Util_readAsset(EVE_HalContext *phost, EVE_Asset *asset, uint32_t offset, uint8_t *buffer, size_t size);
+
+/* Load a region of an asset into RAM_G, for example one cell of a sprite atlas */
+EVE_HAL_EXPORT bool EVE_Util_loadAssetRegion(EVE_HalContext *phost, EVE_Asset *asset, uint32_t offset, uint32_t address, uint32_t size);
+
+/* Write a region of a compressed asset to the coprocessor, as the data of a CMD_INFLATE
+that was sent before. Lets a large inflate be fed over several calls, the region sizes
+must be a multiple of 4 bytes except at the end of the file. Until the whole stream has
+been written, the coprocessor stays inside CMD_INFLATE, no other command may be sent */
+EVE_HAL_EXPORT bool EVE_Util_inflateAssetRegion(EVE_HalContext *phost, EVE_Asset *asset, uint32_t offset, uint32_t size);
+
+EVE_HAL_EXPORT void EVE_Util_closeAsset(EVE_HalContext *phost, EVE_Asset *asset);
+
 #ifdef _WIN32
 
 EVE_HAL_EXPORT bool EVE_Util_loadRawFileW(EVE_HalContext *phost, uint32_t address, const wchar_t *filename);
@@ -32,9 +32,194 @@
 #include "EVE_LoadFile.h"
 #include "EVE_Platform.h"
 #include "ff.h"
+#include "diskio.h"
 static bool s_FatFSLoaded = false;
 static FATFS s_FatFS;
 
+/* Interval of the card detect in EVE_Util_pollSdCard */
+#ifndef EVE_SDCARD_POLL_MS
+#define EVE_SDCARD_POLL_MS 500
+#endif
+static uint32_t s_SdCardPollMs = 0;
+
+/* Size of the file read buffer. A multiple of the 512 byte sector size lets FatFS read
+whole sectors straight into the buffer with multi-block SD transfers */
+#ifndef EVE_LOADFILE_BUFFER_SIZE
+#define EVE_LOADFILE_BUFFER_SIZE 4096
+#endif
+static uint32_t s_LoadFileBuffer[EVE_LOADFILE_BUFFER_SIZE >> 2];
+/* Set while the media FIFO is being fed from the open file, a refill from a wait callback must not interleave */
+static bool s_MediaFileBusy = false;
+/* Set once the media file has been repositioned, it then stays open at the end of its range for the next seek */
+static bool s_MediaFileHeld = false;
+#if EVE_ASYNC_TRANSFER
+/* Second buffer for the raw file loader, filled from the SD card while the first one is clocked out over SPI */
+static uint32_t s_LoadFileBackBuffer[EVE_LOADFILE_BUFFER_SIZE >> 2];
+#endif
+
+/* Command files are sent in whole sectors, as much as the coprocessor FIFO takes in one write */
+#ifndef EVE_LOADFILE_CMD_CHUNK
+#define EVE_LOADFILE_CMD_CHUNK ((EVE_CMD_FIFO_SIZE >> 1) & ~511UL)
+#endif
+/* Command file kept open by a partial EVE_Util_loadCmdFile */
+static EVE_Asset s_CmdFile;
+static uint32_t s_CmdFileOffset = 0;
+static bool s_CmdFileOpen = false;
+
+#if EVE_LOADFILE_INDEX_SIZE
+/* Contiguous file in the root directory, found by the hash of its name */
+typedef struct
+{
+	uint32_t Hash;
+	DWORD Sector; /* First sector, 0 if the entry is unusable because of a hash collision */
+	uint32_t Size;
+} EVE_AssetIndexEntry;
+static EVE_AssetIndexEntry s_AssetIndex[EVE_LOADFILE_INDEX_SIZE];
+static uint32_t s_AssetIndexCount = 0;
+#endif
+
+/* Bounce buffer for the partial sectors of an indexed asset */
+static uint32_t s_SectorBuffer[_MAX_SS >> 2];
+
+/**
+ * @brief Build the cluster link map table of an opened file, so seeking does not walk the FAT chain
+ *
+ * @param file Opened file
+ * @param linkMap Link map table
+ * @param size Number of entries in the link map table
+ * @return true True if fast seek is enabled
+ * @return false False if the file is too fragmented, seeking falls back to the FAT chain
+ */
+static bool enableFastSeek(FIL *file, DWORD *linkMap, UINT size)
+{
+	file->cltbl = linkMap;
+	linkMap[0] = size;
+	if (f_lseek(file, CREATE_LINKMAP) == FR_OK)
+		return true;
+	eve_printf_debug("File too fragmented for fast seek, %u link map entries needed\n", (unsigned int)linkMap[0]);
+	file->cltbl = NULL;
+	return false;
+}
+
+#if EVE_LOADFILE_INDEX_SIZE
+/**
+ * @brief Case insensitive FNV-1a hash of a file name, matching how FAT compares names
+ *
+ * @param name File name
+ * @return uint32_t Hash
+ */
+static uint32_t hashName(const char *name)
+{
+	uint32_t hash = 2166136261UL;
+	while (*name)
+	{
+		char c = *name++;
+		if (c >= 'a' && c <= 'z')
+			c -= 'a' - 'A';
+		hash ^= (uint8_t)c;
+		hash *= 16777619UL;
+	}
+	return hash;
+}
+
+/**
+ * @brief Add a file to the asset index
+ *
+ * @param name File name
+ * @param sector First sector
+ * @param size File size
+ */
+static void addAssetIndex(const char *name, DWORD sector, uint32_t size)
+{
+	uint32_t hash = hashName(name);
+	uint32_t i;
+	for (i = 0; i < s_AssetIndexCount; ++i)
+	{
+		if (s_AssetIndex[i].Hash == hash)
+		{
+			/* Collision, neither name can be trusted to the index */
+			s_AssetIndex[i].Sector = 0;
+			return;
+		}
+	}
+	if (s_AssetIndexCount < EVE_LOADFILE_INDEX_SIZE)
+	{
+		s_AssetIndex[s_AssetIndexCount].Hash = hash;
+		s_AssetIndex[s_AssetIndexCount].Sector = sector;
+		s_AssetIndex[s_AssetIndexCount].Size = size;
+		++s_AssetIndexCount;
+	}
+}
+
+/**
+ * @brief Scan the root directory and index the files whose clusters are contiguous
+ *
+ * @param phost Pointer to Hal context, for the long file name buffer
+ */
+static void buildAssetIndex(EVE_HalContext *phost)
+{
+	DIR dir;
+	FILINFO fno;
+	FIL file;
+	DWORD linkMap[4];
+	uint32_t mark = EVE_Hal_scratchMark(phost);
+	char *lfn = (char *)EVE_Hal_scratchAlloc(phost, _MAX_LFN + 1);
+	uint32_t ms = EVE_millis();
+
+	s_AssetIndexCount = 0;
+	if (!lfn)
+		return;
+	lfn[0] = '\0';
+	fno.lfname = lfn;
+	fno.lfsize = _MAX_LFN + 1;
+	if (f_opendir(&dir, "") != FR_OK)
+	{
+		EVE_Hal_scratchRelease(phost, mark);
+		return;
+	}
+
+	while (f_readdir(&dir, &fno) == FR_OK && fno.fname[0])
+	{
+		if ((fno.fattrib & AM_DIR) || !fno.fsize)
+			continue;
+		if (f_open(&file, fno.fname, FA_READ | FA_OPEN_EXISTING) != FR_OK)
+			continue;
+		file.cltbl = linkMap;
+		linkMap[0] = 4; /* Room for a single fragment only */
+		if (f_lseek(&file, CREATE_LINKMAP) == FR_OK)
+		{
+			DWORD sector = s_FatFS.database + (linkMap[2] - 2) * s_FatFS.csize;
+			addAssetIndex(fno.fname, sector, fno.fsize);
+			if (lfn[0])
+				addAssetIndex(lfn, sector, fno.fsize);
+		}
+		f_close(&file);
+	}
+	f_closedir(&dir);
+	EVE_Hal_scratchRelease(phost, mark);
+
+	eve_printf_debug("Indexed %u contiguous files in %u ms\n", (unsigned int)s_AssetIndexCount, (unsigned int)(EVE_millis() - ms));
+}
+
+/**
+ * @brief Find a file in the asset index
+ *
+ * @param filename File name
+ * @return EVE_AssetIndexEntry* Entry, or NULL if the file is not indexed
+ */
+static EVE_AssetIndexEntry *findAssetIndex(const char *filename)
+{
+	uint32_t hash = hashName(filename);
+	uint32_t i;
+	for (i = 0; i < s_AssetIndexCount; ++i)
+	{
+		if (s_AssetIndex[i].Hash == hash)
+			return s_AssetIndex[i].Sector ? &s_AssetIndex[i] : NULL;
+	}
+	return NULL;
+}
+#endif
+
 /**
  * @brief Mount the SDcard
  *
@@ -46,6 +231,7 @@ bool EVE_Util_loadSdCard(EVE_HalContext *phost)
 {
 
 	SDHOST_STATUS status = sdhost_card_detect();
+	s_SdCardPollMs = EVE_millis();
 	if (status == SDHOST_CARD_INSERTED)
 	{
 		if (!s_FatFSLoaded && (f_mount(&s_FatFS, "", 1) != FR_OK))
@@ -58,6 +244,9 @@ bool EVE_Util_loadSdCard(EVE_HalContext *phost)
 			{
 				s_FatFSLoaded = true;
 				eve_printf_debug("FatFS SD card mounted successfully\n");
+#if EVE_LOADFILE_INDEX_SIZE
+				buildAssetIndex(phost);
+#endif
 			}
 		}
 	}
@@ -78,6 +267,20 @@ EVE_HAL_EXPORT bool EVE_Util_sdCardReady(EVE_HalContext *phost)
 	return s_FatFSLoaded;
 }
 
+/**
+ * @brief Rate limited card detect
+ *
+ * @param phost Pointer to Hal context
+ * @return true True if the SD card is mounted
+ * @return false False if not
+ */
+EVE_HAL_EXPORT bool EVE_Util_pollSdCard(EVE_HalContext *phost)
+{
+	if ((EVE_millis() - s_SdCardPollMs) < EVE_SDCARD_POLL_MS)
+		return s_FatFSLoaded;
+	return EVE_Util_loadSdCard(phost);
+}
+
 /**
  * @brief Load a raw file into RAM_G
  *
@@ -89,48 +292,50 @@ EVE_HAL_EXPORT bool EVE_Util_sdCardReady(EVE_HalContext *phost)
  */
 bool EVE_Util_loadRawFile(EVE_HalContext *phost, uint32_t address, const char *filename)
 {
+	EVE_Asset asset;
+	size_t blocklen;
+	uint32_t offset = 0;
+#if EVE_ASYNC_TRANSFER
+	uint8_t *buffers[2] = { (uint8_t *)s_LoadFileBuffer, (uint8_t *)s_LoadFileBackBuffer };
+	uint8_t cur = 0;
+#else
+	uint8_t *buffer = (uint8_t *)s_LoadFileBuffer;
+#endif
 
-	FRESULT fResult;
-	FIL InfSrc;
-
-	UINT blocklen;
-	int32_t filesize;
-	uint8_t buffer[512L];
-	uint32_t addr = address;
-
-	if (!s_FatFSLoaded)
-	{
-		eve_printf_debug("SD card not ready\n");
+	/* Opened as an asset, so contiguous files are read straight from their sectors */
+	if (!EVE_Util_openAsset(phost, &asset, filename))
 		return false;
-	}
 
-	fResult = f_open(&InfSrc, filename, FA_READ | FA_OPEN_EXISTING);
-	if (fResult == FR_DISK_ERR)
-	{
-		eve_printf_debug("Re-mount SD card\n");
-		s_FatFSLoaded = false;
-		sdhost_init();
-		EVE_Util_loadSdCard(phost);
-		fResult = f_open(&InfSrc, filename, FA_READ | FA_OPEN_EXISTING);
-	}
-	if (fResult == FR_OK)
+#if EVE_ASYNC_TRANSFER
+	// RAM_G is written sequentially, so keep a single write transfer open for the whole file,
+	// and read the next chunk from the SD card while the previous one is being sent
+	EVE_Hal_startTransfer(phost, EVE_TRANSFER_WRITE, address);
+	while (offset < asset.Size)
 	{
-		filesize = f_size(&InfSrc);
-		while (filesize > 0)
-		{
-			fResult = f_read(&InfSrc, buffer, 512, &blocklen); // read a chunk of src file
-			filesize -= blocklen;
-			EVE_Hal_wrMem(phost, addr, buffer, blocklen);
-			addr += blocklen;
-		}
-		f_close(&InfSrc);
-		return true;
+		blocklen = EVE_Util_readAsset(phost, &asset, offset, buffers[cur], EVE_LOADFILE_BUFFER_SIZE); // read a chunk of src file
+		if (!blocklen)
+			break;
+		EVE_Hal_transferMemAsync(phost, buffers[cur], blocklen, false);
+#if EVE_CMD_CAPTURE
+		if (phost->CmdCapture)
+			EVE_Cmd_captureMem(phost, address + offset, buffers[cur], blocklen, false);
+#endif
+		offset += blocklen;
+		cur ^= 1;
 	}
-	else
+	EVE_Hal_endTransfer(phost);
+#else
+	while (offset < asset.Size)
 	{
-		eve_printf_debug("Unable to open file: \"%s\"\n", filename);
-		return false;
+		blocklen = EVE_Util_readAsset(phost, &asset, offset, buffer, EVE_LOADFILE_BUFFER_SIZE); // read a chunk of src file
+		if (!blocklen)
+			break;
+		EVE_Hal_wrMem(phost, address + offset, buffer, blocklen);
+		offset += blocklen;
 	}
+#endif
+	EVE_Util_closeAsset(phost, &asset);
+	return true;
 }
 
 /**
@@ -144,51 +349,18 @@ bool EVE_Util_loadRawFile(EVE_HalContext *phost, uint32_t address, const char *f
  */
 bool EVE_Util_loadInflateFile(EVE_HalContext *phost, uint32_t address, const char *filename)
 {
+	EVE_Asset asset;
+	bool loaded;
 
-	FRESULT fResult;
-	FIL InfSrc;
-
-	UINT blocklen;
-	int32_t filesize;
-	uint8_t buffer[512L];
-
-	if (!s_FatFSLoaded)
-	{
-		eve_printf_debug("SD card not ready\n");
+	/* Opened as an asset, so the compressed stream is read in whole sectors, straight from them when contiguous */
+	if (!EVE_Util_openAsset(phost, &asset, filename))
 		return false;
-	}
 
-	fResult = f_open(&InfSrc, filename, FA_READ | FA_OPEN_EXISTING);
-	if (fResult == FR_DISK_ERR)
-	{
-		eve_printf_debug("Re-mount SD card\n");
-		s_FatFSLoaded = false;
-		sdhost_init();
-		EVE_Util_loadSdCard(phost);
-		fResult = f_open(&InfSrc, filename, FA_READ | FA_OPEN_EXISTING);
-	}
-	if (fResult == FR_OK)
-	{
-		EVE_Cmd_wr32(phost, CMD_INFLATE);
-		EVE_Cmd_wr32(phost, address);
-		filesize = f_size(&InfSrc);
-		while (filesize > 0)
-		{
-			fResult = f_read(&InfSrc, buffer, 512, &blocklen); // read a chunk of src file
-			filesize -= blocklen;
-			blocklen += 3;
-			blocklen &= ~3U;
-			if (!EVE_Cmd_wrMem(phost, (uint8_t *)buffer, blocklen))
-				break;
-		}
-		f_close(&InfSrc);
-		return EVE_Cmd_waitFlush(phost);
-	}
-	else
-	{
-		eve_printf_debug("Unable to open file: \"%s\"\n", filename);
-		return false;
-	}
+	EVE_Cmd_wr32(phost, CMD_INFLATE);
+	EVE_Cmd_wr32(phost, address);
+	loaded = EVE_Util_inflateAssetRegion(phost, &asset, 0, asset.Size);
+	EVE_Util_closeAsset(phost, &asset);
+	return loaded && EVE_Cmd_waitFlush(phost);
 }
 
 /**
@@ -209,7 +381,7 @@ bool EVE_Util_loadImageFile(EVE_HalContext *phost, uint32_t address, const char
 
 	UINT blocklen;
 	int32_t filesize;
-	uint8_t buffer[512L];
+	uint8_t *buffer = (uint8_t *)s_LoadFileBuffer;
 
 	if (!s_FatFSLoaded)
 	{
@@ -237,7 +409,9 @@ bool EVE_Util_loadImageFile(EVE_HalContext *phost, uint32_t address, const char
 		filesize = f_size(&InfSrc);
 		while (filesize > 0)
 		{
-			fResult = f_read(&InfSrc, buffer, 512, &blocklen); // read a chunk of src file
+			fResult = f_read(&InfSrc, buffer, EVE_LOADFILE_BUFFER_SIZE, &blocklen); // read a chunk of src file
+			if (fResult != FR_OK || !blocklen)
+				break;
 			filesize -= blocklen;
 			blocklen += 3;
 			blocklen &= ~3U;
@@ -261,53 +435,280 @@ bool EVE_Util_loadImageFile(EVE_HalContext *phost, uint32_t address, const char
 	}
 }
 
+/**
+ * @brief Write the next chunk of a command file, without waiting for the SPI transfer where supported
+ *
+ * @param phost Pointer to Hal context
+ * @param buffer Chunk to write
+ * @param size Size of the chunk, a multiple of 4 bytes
+ * @return true True if ok
+ * @return false False if error
+ */
+static bool wrCmdChunk(EVE_HalContext *phost, const uint8_t *buffer, uint32_t size)
+{
+#if EVE_ASYNC_TRANSFER
+	return EVE_Cmd_wrMemAsync(phost, buffer, size);
+#else
+	return EVE_Cmd_wrMem(phost, buffer, size);
+#endif
+}
+
 bool EVE_Util_loadCmdFile(EVE_HalContext *phost, const char *filename, uint32_t *transfered)
 {
+#if EVE_ASYNC_TRANSFER
+	uint8_t *buffers[2] = { (uint8_t *)s_LoadFileBuffer, (uint8_t *)s_LoadFileBackBuffer };
+#else
+	uint8_t *buffers[2] = { (uint8_t *)s_LoadFileBuffer, (uint8_t *)s_LoadFileBuffer };
+#endif
+	uint8_t cur = 0;
+	bool res = true;
 
-	FRESULT fResult;
-	FIL InfSrc;
+	if (phost->CmdFault)
+		return false;
 
-	UINT blocklen;
-	int32_t filesize;
-	uint8_t buffer[512L];
+	if (!transfered || !s_CmdFileOpen)
+	{
+		/* Opened as an asset, so contiguous files are read straight from their sectors */
+		EVE_Util_closeCmdFile(phost);
+		if (!EVE_Util_openAsset(phost, &s_CmdFile, filename))
+			return false;
+		s_CmdFileOffset = 0;
+		s_CmdFileOpen = true;
+	}
+
+	while (s_CmdFileOffset < s_CmdFile.Size)
+	{
+		uint32_t size = min(EVE_LOADFILE_CMD_CHUNK, s_CmdFile.Size - s_CmdFileOffset);
+		uint32_t padded = (size + 3) & ~3UL;
+		size_t blocklen;
+
+		/* Only ask the coprocessor once the cached space runs short,
+		so the next chunk is read from the SD card while the previous one is being sent */
+		if (phost->CmdSpace < padded)
+		{
+			if (transfered)
+			{
+				if (EVE_Cmd_space(phost) < padded)
+					break; /* Continued by the next call */
+			}
+			else if (!EVE_Cmd_waitSpace(phost, padded))
+			{
+				res = false; /* Coprocessor fault */
+				break;
+			}
+		}
+
+		blocklen = EVE_Util_readAsset(phost, &s_CmdFile, s_CmdFileOffset, buffers[cur], size); // read a chunk of src file
+		if (blocklen != size)
+		{
+			res = false;
+			break;
+		}
+		while (blocklen < padded)
+			buffers[cur][blocklen++] = 0;
+		if (!wrCmdChunk(phost, buffers[cur], padded))
+		{
+			res = false;
+			break;
+		}
+		if (transfered)
+			*transfered += padded;
+		s_CmdFileOffset += size;
+		cur ^= 1;
+	}
+
+#if EVE_ASYNC_TRANSFER
+	/* The buffers are shared with the other loaders */
+	EVE_Hal_transferWait(phost);
+#endif
+	if (!res || s_CmdFileOffset >= s_CmdFile.Size)
+		EVE_Util_closeCmdFile(phost);
+	if (!res)
+		return false;
+	return transfered ? !phost->CmdFault : EVE_Cmd_waitFlush(phost);
+}
+
+uint32_t EVE_Util_cmdFileRemaining(EVE_HalContext *phost)
+{
+	return s_CmdFileOpen ? s_CmdFile.Size - s_CmdFileOffset : 0;
+}
+
+void EVE_Util_closeCmdFile(EVE_HalContext *phost)
+{
+	if (s_CmdFileOpen)
+	{
+		EVE_Util_closeAsset(phost, &s_CmdFile);
+		s_CmdFileOpen = false;
+	}
+}
+
+static uint32_t replayWord(const uint8_t *bytes)
+{
+	return bytes[0] | ((uint32_t)bytes[1] << 8) | ((uint32_t)bytes[2] << 16) | ((uint32_t)bytes[3] << 24);
+}
+
+/* Read exactly size bytes */
+static bool replayRead(FIL *file, void *buffer, UINT size)
+{
+	UINT len;
+	return f_read(file, buffer, size, &len) == FR_OK && len == size;
+}
+
+bool EVE_Util_replayCmdFile(EVE_HalContext *phost, const char *filename, EVE_CaptureStats *stats)
+{
+	FIL file;
+	uint8_t word[8];
+	uint8_t *buffer = (uint8_t *)s_LoadFileBuffer;
+	EVE_CaptureStats res;
+	uint32_t start, frameStart;
+	bool ok = true;
 
 	if (!s_FatFSLoaded)
 	{
 		eve_printf_debug("SD card not ready\n");
 		return false;
 	}
+	if (f_open(&file, filename, FA_READ | FA_OPEN_EXISTING) != FR_OK)
+	{
+		eve_printf_debug("Unable to open file: \"%s\"\n", filename);
+		return false;
+	}
+	if (!replayRead(&file, word, 8) || replayWord(word) != EVE_CAPTURE_MAGIC)
+	{
+		eve_printf_debug("Not a capture file: \"%s\"\n", filename);
+		f_close(&file);
+		return false;
+	}
+	if (replayWord(&word[4]) != EVE_CHIPID)
+		eve_printf_debug("Capture was made on chip %x\n", (unsigned int)replayWord(&word[4]));
 
-	fResult = f_open(&InfSrc, filename, FA_READ | FA_OPEN_EXISTING);
-	if (fResult == FR_DISK_ERR)
+	memset(&res, 0, sizeof(EVE_CaptureStats));
+	res.FrameMinMs = 0xFFFFFFFFUL;
+	if (!EVE_Cmd_waitFlush(phost))
 	{
-		eve_printf_debug("Re-mount SD card\n");
-		s_FatFSLoaded = false;
-		sdhost_init();
-		EVE_Util_loadSdCard(phost);
-		fResult = f_open(&InfSrc, filename, FA_READ | FA_OPEN_EXISTING);
+		f_close(&file);
+		return false;
 	}
-	if (fResult == FR_OK)
+
+	start = EVE_millis();
+	frameStart = start;
+	while (ok && replayRead(&file, word, 4))
 	{
-		filesize = f_size(&InfSrc);
-		while (filesize > 0)
+		uint32_t record = replayWord(word);
+		uint32_t size = record & 0xFFFFFF;
+		uint32_t addr;
+		switch (record >> 24)
 		{
-			fResult = f_read(&InfSrc, buffer, 512, &blocklen); // read a chunk of src file
-			filesize -= blocklen;
-			blocklen += 3;
-			blocklen &= ~3U;
-			if (!EVE_Cmd_wrMem(phost, (uint8_t *)buffer, blocklen))
-				break;
-			if (transfered)
-				*transfered += blocklen;
+		case EVE_CAPTURE_CMD:
+			while (ok && size)
+			{
+				UINT n = min(size, EVE_LOADFILE_BUFFER_SIZE);
+				ok = replayRead(&file, buffer, n) && EVE_Cmd_wrMem(phost, buffer, n);
+				res.CmdBytes += n;
+				size -= n;
+			}
+			break;
+		case EVE_CAPTURE_MEM:
+			ok = replayRead(&file, word, 4);
+			addr = replayWord(word);
+			while (ok && size)
+			{
+				/* Data is padded to 4 bytes in the file */
+				UINT n = min(size, EVE_LOADFILE_BUFFER_SIZE);
+				ok = replayRead(&file, buffer, (n + 3) & ~3U);
+				EVE_Hal_wrMem(phost, addr, buffer, n);
+				res.MemBytes += n;
+				addr += n;
+				size -= n;
+			}
+			break;
+		case EVE_CAPTURE_FRAME:
+		{
+			uint32_t now = EVE_millis();
+			uint32_t delta = now - frameStart;
+			if (delta < res.FrameMinMs)
+				res.FrameMinMs = delta;
+			if (delta > res.FrameMaxMs)
+				res.FrameMaxMs = delta;
+			frameStart = now;
+			++res.Frames;
+			break;
+		}
+		default:
+			eve_printf_debug("Unknown capture record %x\n", (unsigned int)record);
+			ok = false;
+			break;
 		}
-		f_close(&InfSrc);
-		return EVE_Cmd_waitFlush(phost);
 	}
-	else
+	f_close(&file);
+
+	ok = EVE_Cmd_waitFlush(phost) && ok;
+	res.TotalMs = EVE_millis() - start;
+	if (!res.Frames)
+		res.FrameMinMs = 0;
+	eve_printf_debug("Replayed %u frames in %u ms, frame %u to %u ms\n",
+	    (unsigned int)res.Frames, (unsigned int)res.TotalMs, (unsigned int)res.FrameMinMs, (unsigned int)res.FrameMaxMs);
+	if (stats)
+		*stats = res;
+	return ok;
+}
+
+#if EVE_CMD_CAPTURE
+
+static FIL s_CaptureFile;
+
+EVE_HAL_EXPORT bool EVE_Util_openCaptureFile(EVE_HalContext *phost, const char *filename)
+{
+	if (!s_FatFSLoaded)
 	{
-		eve_printf_debug("Unable to open file: \"%s\"\n", filename);
+		eve_printf_debug("SD card not ready\n");
+		return false;
+	}
+	if (f_open(&s_CaptureFile, filename, FA_WRITE | FA_CREATE_ALWAYS) != FR_OK)
+	{
+		eve_printf_debug("Unable to create file: \"%s\"\n", filename);
+		return false;
+	}
+	return true;
+}
+
+EVE_HAL_EXPORT bool EVE_Util_writeCaptureFile(EVE_HalContext *phost, const void *buffer, uint32_t size)
+{
+	UINT written;
+	return f_write(&s_CaptureFile, buffer, size, &written) == FR_OK && written == size;
+}
+
+EVE_HAL_EXPORT void EVE_Util_closeCaptureFile(EVE_HalContext *phost)
+{
+	f_close(&s_CaptureFile);
+}
+
+#endif
+
+EVE_HAL_EXPORT bool EVE_Util_openWriteFile(EVE_HalContext *phost, EVE_WriteFile *file, const char *filename)
+{
+	if (!s_FatFSLoaded)
+	{
+		eve_printf_debug("SD card not ready\n");
+		return false;
+	}
+	if (f_open(&file->File, filename, FA_WRITE | FA_CREATE_ALWAYS) != FR_OK)
+	{
+		eve_printf_debug("Unable to create file: \"%s\"\n", filename);
 		return false;
 	}
+	return true;
+}
+
+EVE_HAL_EXPORT bool EVE_Util_writeFile(EVE_HalContext *phost, EVE_WriteFile *file, const void *buffer, uint32_t size)
+{
+	UINT written;
+	return f_write(&file->File, buffer, size, &written) == FR_OK && written == size;
+}
+
+EVE_HAL_EXPORT bool EVE_Util_closeWriteFile(EVE_HalContext *phost, EVE_WriteFile *file)
+{
+	return f_close(&file->File) == FR_OK;
 }
 
 size_t EVE_Util_readFile(EVE_HalContext *phost, uint8_t *buffer, size_t size, const char *filename)
@@ -346,15 +747,15 @@ size_t EVE_Util_readFile(EVE_HalContext *phost, uint8_t *buffer, size_t size, co
 
 }
 
-bool EVE_Util_loadMediaFile(EVE_HalContext *phost, const char *filename, uint32_t *transfered)
+static bool loadMediaFile(EVE_HalContext *phost, const char *filename, uint32_t *transfered)
 {
 
 	FRESULT fResult = FR_INVALID_OBJECT;
 
 	UINT blocklen;
 	int32_t filesize;
-	uint32_t blockSize = min(512, ((phost->MediaFifoSize >> 3) << 2) - 4);
-	uint8_t buffer[512L];
+	uint32_t blockSize = min(EVE_LOADFILE_BUFFER_SIZE, ((phost->MediaFifoSize >> 3) << 2) - 4);
+	uint8_t *buffer = (uint8_t *)s_LoadFileBuffer;
 
 	if (!s_FatFSLoaded)
 	{
@@ -371,10 +772,7 @@ bool EVE_Util_loadMediaFile(EVE_HalContext *phost, const char *filename, uint32_
 	}
 	else
 	{
-		if (!transfered)
-		{
-			EVE_Util_closeFile(phost);
-		}
+		EVE_Util_closeFile(phost);
 		fResult = f_open(&phost->LoadFileObj, filename, FA_READ | FA_OPEN_EXISTING);
 		if (fResult == FR_DISK_ERR)
 		{
@@ -389,6 +787,8 @@ bool EVE_Util_loadMediaFile(EVE_HalContext *phost, const char *filename, uint32_
 			filesize = f_size(&phost->LoadFileObj);
 			if (transfered)
 			{
+				/* Streamed partially, seeking back on a full FIFO must be cheap */
+				enableFastSeek(&phost->LoadFileObj, phost->LoadFileLinkMap, EVE_LOADFILE_LINKMAP_SIZE);
 				phost->LoadFileRemaining = filesize;
 			}
 			if (filesize == 0)
@@ -456,7 +856,8 @@ bool EVE_Util_loadMediaFile(EVE_HalContext *phost, const char *filename, uint32_
 	}
 	else
 	{
-		f_close(&phost->LoadFileObj);
+		if (!s_MediaFileHeld)
+			f_close(&phost->LoadFileObj);
 		phost->LoadFileRemaining = 0;
 	}
 
@@ -464,15 +865,321 @@ bool EVE_Util_loadMediaFile(EVE_HalContext *phost, const char *filename, uint32_
 
 }
 
+bool EVE_Util_loadMediaFile(EVE_HalContext *phost, const char *filename, uint32_t *transfered)
+{
+	bool res;
+	s_MediaFileBusy = true;
+	res = loadMediaFile(phost, filename, transfered);
+	s_MediaFileBusy = false;
+	return res;
+}
+
+uint32_t EVE_Util_fillMediaFile(EVE_HalContext *phost, uint32_t watermark)
+{
+	uint32_t space;
+	uint32_t total = 0;
+	uint8_t *buffer = (uint8_t *)s_LoadFileBuffer;
+
+	if (s_MediaFileBusy || !phost->LoadFileRemaining || phost->CmdFault)
+		return 0;
+
+	/* Only refill once the level dropped below the watermark, then top up as far as the space allows */
+	space = EVE_MediaFifo_space(phost);
+	if (phost->MediaFifoSize - 4 - space >= watermark)
+		return 0;
+
+	s_MediaFileBusy = true;
+	while (phost->LoadFileRemaining > 0)
+	{
+		FRESULT fResult;
+		UINT blocklen;
+		/* Whole sectors, so FatFS reads straight into the buffer with multi-block transfers */
+		uint32_t size = min(min(space, EVE_LOADFILE_BUFFER_SIZE) & ~511UL, (uint32_t)phost->LoadFileRemaining);
+		if (size < 512 && size < (uint32_t)phost->LoadFileRemaining)
+			break;
+
+		fResult = f_read(&phost->LoadFileObj, buffer, size, &blocklen);
+		if (fResult != FR_OK || !blocklen)
+		{
+			if (fResult == FR_DISK_ERR)
+			{
+				eve_printf_debug("Lost SD card\n");
+				s_FatFSLoaded = false;
+				sdhost_init();
+			}
+			break;
+		}
+
+		phost->LoadFileRemaining -= blocklen;
+		blocklen = (blocklen + 3) & ~3U;
+
+		/* Fits in the free space, never waits */
+		if (!EVE_MediaFifo_wrMem(phost, buffer, blocklen, NULL))
+			break;
+		space -= blocklen;
+		total += blocklen;
+	}
+	s_MediaFileBusy = false;
+
+	if (!phost->LoadFileRemaining && !s_MediaFileHeld)
+		f_close(&phost->LoadFileObj);
+
+	return total;
+}
+
+bool EVE_Util_seekMediaFile(EVE_HalContext *phost, uint32_t offset, uint32_t size)
+{
+	DWORD filesize;
+
+	if (s_MediaFileBusy || (!phost->LoadFileRemaining && !s_MediaFileHeld))
+		return false;
+
+	/* Uses the link map table built when the file was opened for streaming */
+	filesize = f_size(&phost->LoadFileObj);
+	if (offset > filesize)
+		offset = filesize;
+	if (size > filesize - offset)
+		size = filesize - offset;
+	if (f_lseek(&phost->LoadFileObj, offset) != FR_OK)
+	{
+		EVE_Util_closeFile(phost);
+		return false;
+	}
+
+	phost->LoadFileRemaining = size;
+	s_MediaFileHeld = true;
+	return true;
+}
+
 void EVE_Util_closeFile(EVE_HalContext *phost)
 {
-	if (phost->LoadFileRemaining)
+	if (phost->LoadFileRemaining || s_MediaFileHeld)
 	{
 		f_close(&phost->LoadFileObj);
 		phost->LoadFileRemaining = 0;
+		s_MediaFileHeld = false;
 	}
 }
 
+/**
+ * @brief Open an asset file for random access
+ *
+ * @param phost Pointer to Hal context
+ * @param asset Asset handle to initialize
+ * @param filename File to open
+ * @return true True if ok
+ * @return false False if error
+ */
+bool EVE_Util_openAsset(EVE_HalContext *phost, EVE_Asset *asset, const char *filename)
+{
+	FRESULT fResult;
+
+	if (!s_FatFSLoaded)
+	{
+		eve_printf_debug("SD card not ready\n");
+		return false;
+	}
+
+#if EVE_LOADFILE_INDEX_SIZE
+	{
+		EVE_AssetIndexEntry *entry = findAssetIndex(filename);
+		if (entry)
+		{
+			asset->Size = entry->Size;
+			asset->Sector = entry->Sector;
+			asset->FastSeek = true;
+			asset->Indexed = true;
+			return true;
+		}
+	}
+#endif
+
+	asset->Indexed = false;
+	fResult = f_open(&asset->File, filename, FA_READ | FA_OPEN_EXISTING);
+	if (fResult == FR_DISK_ERR)
+	{
+		eve_printf_debug("Re-mount SD card\n");
+		s_FatFSLoaded = false;
+		sdhost_init();
+		EVE_Util_loadSdCard(phost);
+		fResult = f_open(&asset->File, filename, FA_READ | FA_OPEN_EXISTING);
+	}
+	if (fResult != FR_OK)
+	{
+		eve_printf_debug("Unable to open file: \"%s\"\n", filename);
+		return false;
+	}
+
+	asset->Size = f_size(&asset->File);
+	asset->FastSeek = enableFastSeek(&asset->File, asset->LinkMap, EVE_LOADFILE_LINKMAP_SIZE);
+
+	/* A link map with a single fragment means the clusters are contiguous */
+	if (asset->FastSeek && asset->LinkMap[0] == 4)
+	{
+		FATFS *fs = asset->File.fs;
+		asset->Sector = fs->database + (asset->LinkMap[2] - 2) * fs->csize;
+	}
+	else
+	{
+		asset->Sector = 0;
+	}
+	return true;
+}
+
+/**
+ * @brief Read from an asset at the given offset
+ *
+ * @param phost Pointer to Hal context
+ * @param asset Opened asset
+ * @param offset Offset in the file
+ * @param buffer Buffer to read into
+ * @param size Number of bytes to read
+ * @return size_t Number of bytes read
+ */
+size_t EVE_Util_readAsset(EVE_HalContext *phost, EVE_Asset *asset, uint32_t offset, uint8_t *buffer, size_t size)
+{
+	UINT read = 0;
+	size_t done = 0;
+
+	if (offset >= asset->Size)
+		return 0;
+	if (size > asset->Size - offset)
+		size = asset->Size - offset;
+
+	if (asset->Indexed)
+	{
+		/* No file object, bounce the partial sectors at the head and tail */
+		if (!s_FatFSLoaded)
+			return 0;
+		while (size)
+		{
+			uint32_t sectorOffset = offset % _MAX_SS;
+			uint32_t count = size - (size % _MAX_SS);
+			if (sectorOffset || !count)
+				count = min(size, _MAX_SS - sectorOffset);
+			if (sectorOffset || count < _MAX_SS)
+			{
+				if (disk_read(s_FatFS.drv, (BYTE *)s_SectorBuffer, asset->Sector + offset / _MAX_SS, 1) != RES_OK)
+					break;
+				memcpy(buffer, (uint8_t *)s_SectorBuffer + sectorOffset, count);
+			}
+			else if (disk_read(s_FatFS.drv, buffer, asset->Sector + offset / _MAX_SS, count / _MAX_SS) != RES_OK)
+			{
+				break;
+			}
+			offset += count;
+			buffer += count;
+			size -= count;
+			done += count;
+		}
+		if (size)
+		{
+			eve_printf_debug("Lost SD card\n");
+			s_FatFSLoaded = false;
+			sdhost_init();
+		}
+		return done;
+	}
+
+	if (asset->Sector && !(offset % _MAX_SS) && size >= _MAX_SS)
+	{
+		/* Contiguous file, read whole sectors straight from the card with a single multi-block command */
+		UINT count = size / _MAX_SS;
+		if (disk_read(asset->File.fs->drv, buffer, asset->Sector + offset / _MAX_SS, count) != RES_OK)
+		{
+			eve_printf_debug("Lost SD card\n");
+			s_FatFSLoaded = false;
+			sdhost_init();
+			return 0;
+		}
+		done = count * _MAX_SS;
+		if (done == size)
+			return done;
+		offset += done;
+		buffer += done;
+		size -= done;
+	}
+
+	if (offset != f_tell(&asset->File) && f_lseek(&asset->File, offset) != FR_OK)
+		return done;
+	if (f_read(&asset->File, buffer, size, &read) != FR_OK)
+		return done;
+	return done + read;
+}
+
+/**
+ * @brief Load a region of an asset into RAM_G
+ *
+ * @param phost Pointer to Hal context
+ * @param asset Opened asset
+ * @param offset Offset of the region in the file
+ * @param address Address to write
+ * @param size Size of the region
+ * @return true True if ok
+ * @return false False if error
+ */
+bool EVE_Util_loadAssetRegion(EVE_HalContext *phost, EVE_Asset *asset, uint32_t offset, uint32_t address, uint32_t size)
+{
+	uint8_t *buffer = (uint8_t *)s_LoadFileBuffer;
+	size_t blocklen;
+
+	if (offset + size > asset->Size)
+		return false;
+
+	while (size > 0)
+	{
+		blocklen = EVE_Util_readAsset(phost, asset, offset, buffer, min(size, EVE_LOADFILE_BUFFER_SIZE));
+		if (!blocklen)
+			return false;
+		EVE_Hal_wrMem(phost, address, buffer, blocklen);
+		offset += blocklen;
+		address += blocklen;
+		size -= blocklen;
+	}
+	return true;
+}
+
+/**
+ * @brief Feed a region of a compressed asset to an open CMD_INFLATE
+ *
+ * @param phost Pointer to Hal context
+ * @param asset Opened asset
+ * @param offset Offset of the region in the file
+ * @param size Size of the region
+ * @return true True if ok
+ * @return false False if error
+ */
+bool EVE_Util_inflateAssetRegion(EVE_HalContext *phost, EVE_Asset *asset, uint32_t offset, uint32_t size)
+{
+	uint8_t *buffer = (uint8_t *)s_LoadFileBuffer;
+	size_t blocklen;
+
+	if (offset + size > asset->Size)
+		return false;
+
+	while (size > 0)
+	{
+		blocklen = EVE_Util_readAsset(phost, asset, offset, buffer, min(size, EVE_LOADFILE_BUFFER_SIZE));
+		offset += blocklen;
+		size -= blocklen;
+		if (!blocklen || ((blocklen & 3) && offset != asset->Size))
+			return false; /* The stream would lose word alignment */
+
+		/* Only the end of the stream is padded */
+		if (!EVE_Cmd_wrMem(phost, buffer, (blocklen + 3) & ~3U))
+			return false;
+	}
+	return true;
+}
+
+void EVE_Util_closeAsset(EVE_HalContext *phost, EVE_Asset *asset)
+{
+	if (asset->Indexed)
+		return;
+	f_close(&asset->File);
+	asset->File.cltbl = NULL;
+}
+
 // pico sd simple test
 
 /**
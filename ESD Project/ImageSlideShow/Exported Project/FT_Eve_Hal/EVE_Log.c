@@ -0,0 +1,101 @@
+/**
+ * This source code ("the Software") is provided by Bridgetek Pte Ltd
+ * ("Bridgetek") subject to the licence terms set out
+ *   http://brtchip.com/BRTSourceCodeLicenseAgreement/ ("the Licence Terms").
+ * You must read the Licence Terms before downloading or using the Software.
+ * By installing or using the Software you agree to the Licence Terms. If you
+ * do not agree to the Licence Terms then do not download or use the Software.
+ *
+ * Without prejudice to the Licence Terms, here is a summary of some of the key
+ * terms of the Licence Terms (and in the event of any conflict between this
+ * summary and the Licence Terms then the text of the Licence Terms will
+ * prevail).
+ *
+ * The Software is provided "as is".
+ * There are no warranties (or similar) in relation to the quality of the
+ * Software. You use it at your own risk.
+ * The Software should not be used in, or for, any medical device, system or
+ * appliance. There are exclusions of Bridgetek liability for certain types of loss
+ * such as: special loss or damage; incidental loss or damage; indirect or
+ * consequential loss or damage; loss of income; loss of business; loss of
+ * profits; loss of revenue; loss of contracts; business interruption; loss of
+ * the use of money or anticipated savings; loss of information; loss of
+ * opportunity; loss of goodwill or reputation; and/or loss of, damage to or
+ * corruption of data.
+ * There is a monetary cap on Bridgetek's liability.
+ * The Software may have subsequently been amended by another user and then
+ * distributed by that other user ("Adapted Software").  If so that user may
+ * have additional licence terms that apply to those amendments. However, Bridgetek
+ * has no liability in relation to those amendments.
+ */
+
+#include "EVE_Platform.h"
+
+#if EVE_DEFERRED_LOG
+
+/* Each message is stored as the format pointer, the argument count, and the arguments */
+static uintptr_t s_LogQueue[EVE_LOG_QUEUE_WORDS];
+static uint32_t s_LogHead; /* Next word to write */
+static uint32_t s_LogTail; /* Next word to print */
+static uint32_t s_LogDropped;
+static uint32_t s_LogReported; /* Dropped count already printed */
+
+#define EVE_LOG_WORD(i) s_LogQueue[(i) & (EVE_LOG_QUEUE_WORDS - 1)]
+
+EVE_HAL_EXPORT void EVE_Log_push(const char *fmt, const uintptr_t *args, uint8_t argc)
+{
+	uint8_t i;
+
+	if (argc > EVE_LOG_MAX_ARGS)
+		argc = EVE_LOG_MAX_ARGS;
+
+	if (EVE_LOG_QUEUE_WORDS - (s_LogHead - s_LogTail) < 2u + argc)
+	{
+		++s_LogDropped;
+		return;
+	}
+
+	EVE_LOG_WORD(s_LogHead) = (uintptr_t)fmt;
+	EVE_LOG_WORD(s_LogHead + 1) = argc;
+	for (i = 0; i < argc; ++i)
+		EVE_LOG_WORD(s_LogHead + 2 + i) = args[i];
+	s_LogHead += 2u + argc;
+}
+
+EVE_HAL_EXPORT bool EVE_Log_flush(uint32_t max)
+{
+	uint32_t count = 0;
+
+	while (s_LogTail != s_LogHead && (!max || count < max))
+	{
+		uintptr_t a[EVE_LOG_MAX_ARGS] = { 0 };
+		const char *fmt = (const char *)EVE_LOG_WORD(s_LogTail);
+		uint8_t argc = (uint8_t)EVE_LOG_WORD(s_LogTail + 1);
+		uint8_t i;
+
+		for (i = 0; i < argc; ++i)
+			a[i] = EVE_LOG_WORD(s_LogTail + 2 + i);
+		s_LogTail += 2u + argc;
+
+		/* Unused trailing arguments are ignored by the formatter */
+		eve_printf(fmt, a[0], a[1], a[2], a[3], a[4], a[5], a[6], a[7], a[8], a[9], a[10], a[11]);
+		++count;
+	}
+
+	if (s_LogDropped != s_LogReported)
+	{
+		eve_printf("[EVE Log] %u messages dropped\n", (unsigned int)(s_LogDropped - s_LogReported));
+		s_LogReported = s_LogDropped;
+	}
+
+	return s_LogTail == s_LogHead;
+}
+
+EVE_HAL_EXPORT uint32_t EVE_Log_dropped()
+{
+	return s_LogDropped;
+}
+
+#endif
+
+/* end of file */
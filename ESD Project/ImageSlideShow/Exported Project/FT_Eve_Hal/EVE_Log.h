@@ -0,0 +1,108 @@
+/**
+ * This source code ("the Software") is provided by Bridgetek Pte Ltd
+ * ("Bridgetek") subject to the licence terms set out
+ *   http://brtchip.com/BRTSourceCodeLicenseAgreement/ ("the Licence Terms").
+ * You must read the Licence Terms before downloading or using the Software.
+ * By installing or using the Software you agree to the Licence Terms. If you
+ * do not agree to the Licence Terms then do not download or use the Software.
+ *
+ * Without prejudice to the Licence Terms, here is a summary of some of the key
+ * terms of the Licence Terms (and in the event of any conflict between this
+ * summary and the Licence Terms then the text of the Licence Terms will
+ * prevail).
+ *
+ * The Software is provided "as is".
+ * There are no warranties (or similar) in relation to the quality of the
+ * Software. You use it at your own risk.
+ * The Software should not be used in, or for, any medical device, system or
+ * appliance. There are exclusions of Bridgetek liability for certain types of loss
+ * such as: special loss or damage; incidental loss or damage; indirect or
+ * consequential loss or damage; loss of income; loss of business; loss of
+ * profits; loss of revenue; loss of contracts; business interruption; loss of
+ * the use of money or anticipated savings; loss of information; loss of
+ * opportunity; loss of goodwill or reputation; and/or loss of, damage to or
+ * corruption of data.
+ * There is a monetary cap on Bridgetek's liability.
+ * The Software may have subsequently been amended by another user and then
+ * distributed by that other user ("Adapted Software").  If so that user may
+ * have additional licence terms that apply to those amendments. However, Bridgetek
+ * has no liability in relation to those amendments.
+ */
+
+/*
+Deferred debug log.
+
+With EVE_DEFERRED_LOG enabled, eve_printf_debug only stores the format
+string pointer and up to EVE_LOG_MAX_ARGS raw arguments in a word queue.
+The text is formatted later by EVE_Log_flush, which ESD calls from the
+idle path, so the update and render path never run the formatter.
+
+Arguments are captured as uintptr_t. Integers and pointers are fine,
+64-bit and floating point arguments are not supported. Strings passed
+for %s must still be valid when the queue is flushed.
+*/
+
+#ifndef EVE_LOG__H
+#define EVE_LOG__H
+
+#include "EVE_Config.h"
+
+#ifndef EVE_DEFERRED_LOG
+#define EVE_DEFERRED_LOG 0
+#endif
+
+/* Size of the queue in words, a message takes two words plus one per argument.
+Must be a power of two */
+#ifndef EVE_LOG_QUEUE_WORDS
+#define EVE_LOG_QUEUE_WORDS 256
+#endif
+
+#define EVE_LOG_MAX_ARGS 12
+
+#if EVE_DEFERRED_LOG
+
+/* Queue a message, dropped when the queue is full */
+EVE_HAL_EXPORT void EVE_Log_push(const char *fmt, const uintptr_t *args, uint8_t argc);
+
+/* Format and print up to max queued messages, 0 for all.
+Returns true when the queue is empty */
+EVE_HAL_EXPORT bool EVE_Log_flush(uint32_t max);
+
+/* Number of messages dropped because the queue was full */
+EVE_HAL_EXPORT uint32_t EVE_Log_dropped();
+
+#define EVE_LOG_ARG(x) ((uintptr_t)(x))
+#define EVE_LOG_ARGS_0()
+#define EVE_LOG_ARGS_1(a) , EVE_LOG_ARG(a)
+#define EVE_LOG_ARGS_2(a, b) EVE_LOG_ARGS_1(a), EVE_LOG_ARG(b)
+#define EVE_LOG_ARGS_3(a, b, c) EVE_LOG_ARGS_2(a, b), EVE_LOG_ARG(c)
+#define EVE_LOG_ARGS_4(a, b, c, d) EVE_LOG_ARGS_3(a, b, c), EVE_LOG_ARG(d)
+#define EVE_LOG_ARGS_5(a, b, c, d, e) EVE_LOG_ARGS_4(a, b, c, d), EVE_LOG_ARG(e)
+#define EVE_LOG_ARGS_6(a, b, c, d, e, f) EVE_LOG_ARGS_5(a, b, c, d, e), EVE_LOG_ARG(f)
+#define EVE_LOG_ARGS_7(a, b, c, d, e, f, g) EVE_LOG_ARGS_6(a, b, c, d, e, f), EVE_LOG_ARG(g)
+#define EVE_LOG_ARGS_8(a, b, c, d, e, f, g, h) EVE_LOG_ARGS_7(a, b, c, d, e, f, g), EVE_LOG_ARG(h)
+#define EVE_LOG_ARGS_9(a, b, c, d, e, f, g, h, i) EVE_LOG_ARGS_8(a, b, c, d, e, f, g, h), EVE_LOG_ARG(i)
+#define EVE_LOG_ARGS_10(a, b, c, d, e, f, g, h, i, j) EVE_LOG_ARGS_9(a, b, c, d, e, f, g, h, i), EVE_LOG_ARG(j)
+#define EVE_LOG_ARGS_11(a, b, c, d, e, f, g, h, i, j, k) EVE_LOG_ARGS_10(a, b, c, d, e, f, g, h, i, j), EVE_LOG_ARG(k)
+#define EVE_LOG_ARGS_12(a, b, c, d, e, f, g, h, i, j, k, l) EVE_LOG_ARGS_11(a, b, c, d, e, f, g, h, i, j, k), EVE_LOG_ARG(l)
+#define EVE_LOG_COUNT_(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, n, ...) n
+#define EVE_LOG_COUNT(...) EVE_LOG_COUNT_(0, ##__VA_ARGS__, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0)
+#define EVE_LOG_CAT_(a, b) a##b
+#define EVE_LOG_CAT(a, b) EVE_LOG_CAT_(a, b)
+
+#define EVE_LOG_DEFER(fmt, ...)                                                                                 \
+	do                                                                                                          \
+	{                                                                                                           \
+		const uintptr_t eve_log_args_[] = { 0 EVE_LOG_CAT(EVE_LOG_ARGS_, EVE_LOG_COUNT(__VA_ARGS__))(__VA_ARGS__) }; \
+		EVE_Log_push(fmt, &eve_log_args_[1], EVE_LOG_COUNT(__VA_ARGS__));                                       \
+	} while (false)
+
+#else
+
+#define EVE_Log_flush(max) (true)
+
+#endif
+
+#endif /* #ifndef EVE_LOG__H */
+
+/* end of file */
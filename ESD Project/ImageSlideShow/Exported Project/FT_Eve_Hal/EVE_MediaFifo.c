@@ -83,6 +83,15 @@ void EVE_MediaFifo_close(EVE_HalContext *phost)
 	phost->MediaFifoSize = 0;
 }
 
+void EVE_MediaFifo_discard(EVE_HalContext *phost)
+{
+	if (!phost->MediaFifoSize)
+		return;
+
+	/* The host owns the write pointer, moving it back onto the read pointer empties the FIFO */
+	EVE_Hal_wr32(phost, REG_MEDIAFIFO_WRITE, EVE_Hal_rd32(phost, REG_MEDIAFIFO_READ));
+}
+
 /* Get the current read pointer. */
 uint32_t EVE_MediaFifo_rp(EVE_HalContext *phost)
 {
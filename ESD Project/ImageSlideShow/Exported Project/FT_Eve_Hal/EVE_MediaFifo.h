@@ -52,6 +52,10 @@ EVE_HAL_EXPORT bool EVE_MediaFifo_set(EVE_HalContext *phost, uint32_t address, u
 Indication for HAL only */
 EVE_HAL_EXPORT void EVE_MediaFifo_close(EVE_HalContext *phost);
 
+/* Drop the data queued in the media FIFO.
+Only valid while no coprocessor function is reading from it */
+EVE_HAL_EXPORT void EVE_MediaFifo_discard(EVE_HalContext *phost);
+
 /* Get the current read pointer. */
 EVE_HAL_EXPORT uint32_t EVE_MediaFifo_rp(EVE_HalContext *phost);
 
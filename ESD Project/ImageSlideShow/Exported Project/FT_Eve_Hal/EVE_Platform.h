@@ -55,6 +55,7 @@ extern "C" {
 #include "EVE_ILI9488.h"
 #include "EVE_Util.h"
 #include "EVE_LoadFile.h"
+#include "EVE_Log.h"
 
 #include "tinyprintf.h"
 
@@ -117,11 +118,16 @@ extern "C" {
 		static bool eve_printf_debug_once_flag = false; \
 		if (!eve_printf_debug_once_flag)                \
 		{                                               \
-			eve_printf(fmt, ##__VA_ARGS__);             \
+			eve_printf_debug(fmt, ##__VA_ARGS__);       \
 			eve_printf_debug_once_flag = true;          \
 		}                                               \
 	} while (false)
+#if EVE_DEFERRED_LOG
+/* Queued, formatted by EVE_Log_flush from the idle path */
+#define eve_printf_debug(fmt, ...) EVE_LOG_DEFER(fmt, ##__VA_ARGS__)
+#else
 #define eve_printf_debug(fmt, ...) eve_printf(fmt, ##__VA_ARGS__)
+#endif
 #define eve_assert(cond)                                                                                                           \
 	do                                                                                                                             \
 	{                                                                                                                              \
@@ -1093,6 +1093,21 @@ EVE_HAL_EXPORT bool EVE_Util_config(EVE_HalContext *phost, EVE_ConfigParameters
 	return true;
 }
 
+EVE_HAL_EXPORT bool EVE_Util_setPclk(EVE_HalContext *phost, uint8_t pclk)
+{
+	if (!phost->PCLK || !pclk)
+		return false;
+	if (pclk == phost->PCLK)
+		return true;
+
+	/* Let a pending swap land first, the new divider then applies from the next refresh */
+	while (EVE_Hal_rd8(phost, REG_DLSWAP) != 0)
+		;
+	EVE_Hal_wr8(phost, REG_PCLK, pclk);
+	phost->PCLK = pclk;
+	return true;
+}
+
 EVE_HAL_EXPORT void EVE_Util_shutdown(EVE_HalContext *phost)
 {
 	if (EVE_CHIPID >= EVE_FT810)
@@ -1199,6 +1214,8 @@ EVE_HAL_EXPORT bool EVE_Util_resetCoprocessor(EVE_HalContext *phost)
 	}
 
 	/* Default */
+	EVE_Cmd_cancelFutures(phost);
+	EVE_CoCmd_peepholeReset(phost);
 	phost->CmdFault = false;
 
 	/* Set REG_CPURESET to 0, to restart the coprocessor */
@@ -132,6 +132,12 @@ EVE_HAL_EXPORT bool EVE_Util_configDefaultsEx(EVE_HalContext *phost, EVE_ConfigP
 /* Boot up the device. Configures the display, resets or initializes coprocessor state. */
 EVE_HAL_EXPORT bool EVE_Util_config(EVE_HalContext *phost, EVE_ConfigParameters *config);
 
+/* Changes the pixel clock divider of a running display at a refresh boundary, without touching
+the other timing registers. These are counted in pixel clocks, so they stay valid, and the refresh
+rate scales with 1 / pclk. A larger divider gives the graphics engine more system clocks per line.
+The panel must accept the resulting pixel clock. Returns false when the display is not running. */
+EVE_HAL_EXPORT bool EVE_Util_setPclk(EVE_HalContext *phost, uint8_t pclk);
+
 /* Complementary of bootup. Does not close the HAL context. */
 EVE_HAL_EXPORT void EVE_Util_shutdown(EVE_HalContext *phost);
 
@@ -42,6 +42,7 @@ typedef struct
 	};
 	Ft_Esd_Layout_Switch Switch_Page;
 	FirstPage *Main_Page;
+	Ft_Esd_LazyPage Main_Page__Lazy;
 } AppScreen;
 
 void AppScreen__Initializer(AppScreen *context);
@@ -88,23 +88,26 @@ void AppScreen__Initializer(AppScreen *context)
 	context->Widget.LocalHeight = 300;
 	AppScreen__Switch_Page__Initializer(context);
 	context->Main_Page = 0;
+	context->Main_Page__Lazy.Page = (Ft_Esd_Widget **)&context->Main_Page;
+	context->Main_Page__Lazy.Validate = (void (*)(void *))AppScreen__Main_Page__Validate;
+	context->Main_Page__Lazy.Destroy = (void (*)(void *))AppScreen__Main_Page__Destroy;
+	context->Main_Page__Lazy.Owner = (void *)context;
+	context->Main_Page__Lazy.NextLazy = 0;
+	context->Main_Page__Lazy.HiddenMillis = 0;
+	context->Main_Page__Lazy.Registered = 0;
+	context->Main_Page__Lazy.Hidden = 0;
 }
 
 void AppScreen_Start(AppScreen *context)
 {
 	void *owner = context->Owner;
 	Ft_Esd_Widget_Start((Ft_Esd_Widget *)context);
-	AppScreen__Main_Page__Validate(context);
-	Ft_Esd_Widget_SetActive(context->Main_Page, 1);
+	Ft_Esd_Layout_Switch_ShowLazy(&context->Switch_Page, &context->Main_Page__Lazy);
 }
 
 void AppScreen_Update(AppScreen *context)
 {
 	void *owner = context->Owner;
-	if (context->Main_Page && !context->Main_Page->Widget.Active)
-	{
-		AppScreen__Main_Page__Destroy(context);
-	}
 	Ft_Esd_Widget_Update((Ft_Esd_Widget *)context);
 }
 
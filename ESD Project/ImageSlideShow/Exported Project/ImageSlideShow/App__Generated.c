@@ -9,6 +9,7 @@ C Source
 
 #include "DefaultTheme.h"
 #include "Ft_Esd_Theme.h"
+#include "Esd_PerfGate.h"
 #include "stdlib.h"
 
 ESD_CORE_EXPORT void Esd_Noop(void *context);
@@ -169,9 +170,17 @@ int main(int argc, char *argv[])
 			return EXIT_FAILURE;
 	}
 	Esd_Loop(&s_Esd);
+#if ESD_PERFGATE
+	// Headless benchmark run, compare the recorded traffic against the baseline
+	bool perfPass = Esd_PerfGate_Check(argc > 1 ? argv[1] : "perfgate_baseline.txt", argc > 2 ? argv[2] : "perfgate_result.txt");
+#endif
 	Esd_Close(&s_Esd);
 	
 	Esd_Release();
+#if ESD_PERFGATE
+	if (!perfPass)
+		return EXIT_FAILURE;
+#endif
 	return EXIT_SUCCESS;
 }
 
@@ -15,9 +15,9 @@ Ft_Esd_BitmapInfo barbecue__Info = {
 	.Format = RGB565,
 	.Stride = 640,
 	.Size = 153600,
-	.File = "barbecue.raw",
+	.File = "barbecue.bin",
 	.Cells = 1,
-	.Compressed = 0,
+	.Compressed = 1,
 	.Persistent = 0,
 	.Type = ESD_RESOURCE_FILE,
 };
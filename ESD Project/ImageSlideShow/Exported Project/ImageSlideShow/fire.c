@@ -15,9 +15,9 @@ Ft_Esd_BitmapInfo fire__Info = {
 	.Format = RGB565,
 	.Stride = 640,
 	.Size = 153600,
-	.File = "fire.raw",
+	.File = "fire.bin",
 	.Cells = 1,
-	.Compressed = 0,
+	.Compressed = 1,
 	.Persistent = 0,
 	.Type = ESD_RESOURCE_FILE,
 };
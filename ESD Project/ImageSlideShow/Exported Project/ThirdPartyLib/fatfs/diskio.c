@@ -22,6 +22,47 @@ static int sd_ready = 0;
 // Even when accessed from multiple threads (FS_REENTRANCY == 1)
 static unsigned long __attribute__ ((aligned (32))) temp[128];
 
+#if DISKIO_CACHE_SECTORS
+// LRU cache of single sector reads. FatFs reads FAT and directory sectors one at a time
+// through its window, while bulk file data is read as multiple sectors straight into the
+// caller's buffer. So in practice this holds the metadata of recently opened files,
+// and reopening assets in the same folder does not go back to the card.
+static unsigned long __attribute__ ((aligned (32))) cache_data[DISKIO_CACHE_SECTORS][128];
+static DWORD cache_sector[DISKIO_CACHE_SECTORS];
+static unsigned long cache_age[DISKIO_CACHE_SECTORS]; // 0 when the entry is unused
+static unsigned long cache_clock = 0;
+
+/** Drop all cached sectors, when the card changes */
+static void cache_invalidate(void) {
+	memset(cache_age, 0, sizeof(cache_age));
+}
+
+/** Find a cached sector
+ *  @param sector The logical sector address
+ *  @return Index of the entry, or -1 if not cached */
+static int cache_find(DWORD sector) {
+	int i;
+	for (i = 0; i < DISKIO_CACHE_SECTORS; i++) {
+		if (cache_age[i] && cache_sector[i] == sector) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+/** Find the least recently used entry
+ *  @return Index of the entry to replace */
+static int cache_victim(void) {
+	int i, victim = 0;
+	for (i = 1; i < DISKIO_CACHE_SECTORS; i++) {
+		if (cache_age[i] < cache_age[victim]) {
+			victim = i;
+		}
+	}
+	return victim;
+}
+#endif
+
 /* FatFS Functions ******************/
 
 /** Initialise a drive
@@ -30,6 +71,10 @@ static unsigned long __attribute__ ((aligned (32))) temp[128];
 DSTATUS disk_initialize(BYTE pdrv) {
 	DSTATUS stat = 0;
 
+#if DISKIO_CACHE_SECTORS
+	cache_invalidate();
+#endif
+
 	if (sd_ready || !sd_init) {
 		// sdhost_sys_init();
 		sdhost_init();
@@ -68,6 +113,9 @@ DSTATUS disk_status(BYTE pdrv) {
 		if (sd_ready) {
 			sd_ready = 0;
 			sdhost_init();
+#if DISKIO_CACHE_SECTORS
+			cache_invalidate();
+#endif
 		}
 	}
 
@@ -93,6 +141,24 @@ DRESULT disk_read(BYTE pdrv, BYTE* buff, DWORD sector, UINT count) {
 	SDHOST_STATUS sdHostStatus = SDHOST_OK;
 	int i;
 
+#if DISKIO_CACHE_SECTORS
+	if (count == 1) {
+		i = cache_find(sector);
+		if (i < 0) {
+			i = cache_victim();
+			cache_age[i] = 0;
+			if (sdhost_transfer_data(SDHOST_READ, (void*) cache_data[i],
+			SDHOST_BLK_SIZE, sector) != SDHOST_OK) {
+				return RES_ERROR;
+			}
+			cache_sector[i] = sector;
+		}
+		cache_age[i] = ++cache_clock;
+		memcpy(buff, cache_data[i], SDHOST_BLK_SIZE);
+		return RES_OK;
+	}
+#endif
+
 	if (((unsigned int) buff & 3) != 0) {
 
 		//print("%%%%%%%%%% READ - DISKIO - buffer NOT 32 bit aligned %%%%%%%%%%%%%%%");
@@ -128,6 +194,15 @@ DRESULT disk_write(BYTE pdrv, const BYTE* buff, DWORD sector, UINT count) {
 	SDHOST_STATUS sdHostStatus = SDHOST_OK;
 	int i;
 
+#if DISKIO_CACHE_SECTORS
+	// Drop cached copies of the sectors being overwritten
+	for (i = 0; i < DISKIO_CACHE_SECTORS; i++) {
+		if (cache_age[i] && cache_sector[i] >= sector && cache_sector[i] - sector < count) {
+			cache_age[i] = 0;
+		}
+	}
+#endif
+
 	if (((unsigned int) buff & 3) != 0) {
 
 		//	print("%%%%%%%%%% WRITE - DISKIO - buffer NOT 32 bit aligned %%%%%%%%%%%%%%%");
@@ -26,6 +26,11 @@ typedef enum {
 	RES_PARERR		/* 4: Invalid Parameter */
 } DRESULT;
 
+/* Number of 512 byte sectors kept in the single sector read cache (0:Disable) */
+#ifndef DISKIO_CACHE_SECTORS
+#define DISKIO_CACHE_SECTORS	8
+#endif
+
 /*---------------------------------------*/
 /* Prototypes for disk control functions */
 
@@ -125,6 +125,7 @@ void ff_rel_grant (
 
 
 #if _USE_LFN == 3	/* LFN with a working buffer on the heap */
+#include "Esd_Base.h"	/* Counted with the host heap usage */
 /*------------------------------------------------------------------------*/
 /* Allocate a memory block                                                */
 /*------------------------------------------------------------------------*/
@@ -135,7 +136,7 @@ void* ff_memalloc (	/* Returns pointer to the allocated memory block */
 	UINT msize		/* Number of bytes to allocate */
 )
 {
-	return malloc(msize);
+	return esd_heap_alloc(msize);
 }
 
 
@@ -147,7 +148,7 @@ void ff_memfree (
 	void* mblock	/* Pointer to the memory block to free */
 )
 {
-	free(mblock);
+	esd_heap_free(mblock);
 }
 
 #endif
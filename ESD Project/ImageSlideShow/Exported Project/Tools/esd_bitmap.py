@@ -0,0 +1,74 @@
+#!/usr/bin/env python3
+"""Convert bitmaps saved to the SD card by Esd_BitmapSave, such as sketch signatures, to PGM, see Esd_BitmapSave.h.
+
+Usage:
+    esd_bitmap.py SIGN.BIN [--output FILE] [--invert]
+
+L8 and L1 bitmaps are supported. Without --output the PGM is written next to the input file.
+"""
+
+import argparse
+import os
+import struct
+import sys
+
+BITMAP_MAGIC = b"ESKB"
+L1 = 1
+L8 = 3
+
+
+def decode(data, size):
+    out = bytearray()
+    offset = 0
+    while offset < len(data) and len(out) < size:
+        token = data[offset]
+        offset += 1
+        if token & 0x80:
+            out += bytes([data[offset]]) * ((token & 0x7F) + 1)
+            offset += 1
+        else:
+            out += data[offset : offset + token + 1]
+            offset += token + 1
+    if len(out) != size:
+        raise ValueError("%d bytes decoded, expected %d" % (len(out), size))
+    return bytes(out)
+
+
+def luminance(pixels, fmt, width, height, stride):
+    out = bytearray()
+    for y in range(height):
+        row = pixels[y * stride : (y + 1) * stride]
+        if fmt == L8:
+            out += row[:width]
+        else:
+            out += bytes(255 if row[x >> 3] & (0x80 >> (x & 7)) else 0 for x in range(width))
+    return bytes(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("input")
+    parser.add_argument("--output")
+    parser.add_argument("--invert", action="store_true", help="dark strokes on white")
+    args = parser.parse_args()
+
+    with open(args.input, "rb") as f:
+        data = f.read()
+    if data[:4] != BITMAP_MAGIC:
+        sys.exit("%s: not a saved bitmap" % args.input)
+    width, height, stride, fmt = struct.unpack_from("<HHHH", data, 4)
+    if fmt not in (L1, L8):
+        sys.exit("%s: unsupported format %d" % (args.input, fmt))
+
+    pixels = luminance(decode(data[12:], stride * height), fmt, width, height, stride)
+    if args.invert:
+        pixels = bytes(255 - p for p in pixels)
+    name = args.output or os.path.splitext(args.input)[0] + ".pgm"
+    with open(name, "wb") as f:
+        f.write(b"P5\n%d %d\n255\n" % (width, height))
+        f.write(pixels)
+    print("%s: %d x %d" % (name, width, height))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,130 @@
+#!/usr/bin/env python3
+"""Pack resource files into a single resource bundle, loaded by Esd_Bundle_Open in Esd_ResourceInfo.c.
+
+Each resource is stored under its file name relative to the root directory, which must match the File
+name of its Esd_ResourceInfo. The .esdm metadata file next to a resource, if any, is stored in the index.
+Payloads start on a sector boundary, so resources are read from the card with whole sector reads.
+The CRC-32 of each raw or deflated resource as loaded into RAM_G is stored as well, so the contents
+can be checked against CMD_MEMCRC in the background.
+
+Usage:
+    esd_bundle.py [--root DIR] [--deflate] output.esdb file...
+
+With --deflate, raw resources are compressed and loaded through CMD_INFLATE.
+"""
+
+import argparse
+import os
+import struct
+import sys
+import zlib
+
+BUNDLE_SIGNATURE = 0x42445345  # "ESDB"
+BUNDLE_VERSION = 1
+BUNDLE_HEADER = 16
+BUNDLE_ENTRY = 16
+BUNDLE_ALIGN = 512
+BUNDLE_ENTRIES = 128  # ESD_BUNDLE_ENTRIES
+CRC_ENTRY = 8
+
+METADATA_MAX = 64  # ESD_METADATA_MAX
+METADATA_COMPRESSION = 6
+
+RESOURCE_RAW = 0
+RESOURCE_DEFLATE = 1
+RESOURCE_IMAGE = 2
+
+
+def name_hash(name):
+    """FNV-1a, same as Esd_Bundle_Hash"""
+    h = 2166136261
+    for c in name.encode("utf-8"):
+        h ^= c
+        h = (h * 16777619) & 0xFFFFFFFF
+    return h
+
+
+def align(value, alignment):
+    return (value + alignment - 1) & ~(alignment - 1)
+
+
+def content_crc(payload, compression):
+    """CRC-32 and size of the resource as loaded into RAM_G, compared against CMD_MEMCRC by Esd_GpuAlloc_Scrub"""
+    if compression == RESOURCE_RAW:
+        content = payload
+    elif compression == RESOURCE_DEFLATE:
+        content = zlib.decompress(payload)
+    else:
+        return 0, 0  # Decoded by the coprocessor, not known ahead
+    return zlib.crc32(content) & 0xFFFFFFFF, len(content)
+
+
+def read_resource(path, name, deflate):
+    with open(path, "rb") as f:
+        payload = f.read()
+    metadata = b""
+    if os.path.exists(path + ".esdm"):
+        with open(path + ".esdm", "rb") as f:
+            metadata = bytearray(f.read())
+        if len(metadata) > METADATA_MAX:
+            sys.exit("%s: metadata larger than %d bytes" % (name, METADATA_MAX))
+    compression = metadata[METADATA_COMPRESSION] if len(metadata) > METADATA_COMPRESSION and metadata[0] else RESOURCE_RAW
+    if compression > RESOURCE_IMAGE:
+        sys.exit("%s: compression %d cannot be bundled" % (name, compression))
+    if deflate and compression == RESOURCE_RAW:
+        payload = zlib.compress(payload, 9)
+        compression = RESOURCE_DEFLATE
+        if metadata:
+            metadata[METADATA_COMPRESSION] = compression
+    return name_hash(name), payload, compression, bytes(metadata), content_crc(payload, compression)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--root", default=".", help="directory the resource file names are relative to")
+    parser.add_argument("--deflate", action="store_true", help="compress raw resources")
+    parser.add_argument("output")
+    parser.add_argument("files", nargs="+")
+    args = parser.parse_args()
+
+    entries = []
+    for path in args.files:
+        name = os.path.relpath(path, args.root).replace(os.sep, "/")
+        entries.append((name,) + read_resource(path, name, args.deflate))
+    if len(entries) > BUNDLE_ENTRIES:
+        sys.exit("%d resources, the loader supports %d" % (len(entries), BUNDLE_ENTRIES))
+
+    # Sorted by hash for the binary search of Esd_Bundle_Find
+    entries.sort(key=lambda e: e[1])
+    for a, b in zip(entries, entries[1:]):
+        if a[1] == b[1]:
+            sys.exit("%s and %s have the same name hash" % (a[0], b[0]))
+
+    metadata_offset = BUNDLE_HEADER + len(entries) * BUNDLE_ENTRY
+    crc_offset = metadata_offset + len(entries) * METADATA_MAX
+    offset = align(crc_offset + len(entries) * CRC_ENTRY, BUNDLE_ALIGN)
+    index = bytearray(struct.pack("<IHHII", BUNDLE_SIGNATURE, BUNDLE_VERSION, len(entries), metadata_offset, crc_offset))
+    table = bytearray()
+    crcs = bytearray()
+    payloads = []
+    for name, h, payload, compression, metadata, crc in entries:
+        index += struct.pack("<IIIBBH", h, offset, len(payload), compression, len(metadata), 0)
+        table += metadata.ljust(METADATA_MAX, b"\0")
+        crcs += struct.pack("<II", *crc)
+        payloads.append((offset, payload))
+        offset = align(offset + len(payload), BUNDLE_ALIGN)
+
+    with open(args.output, "wb") as f:
+        f.write(index)
+        f.write(table)
+        f.write(crcs)
+        for payload_offset, payload in payloads:
+            f.write(b"\0" * (payload_offset - f.tell()))
+            f.write(payload)
+        f.write(b"\0" * (offset - f.tell()))
+
+    print("%s: %d resources, %d bytes" % (args.output, len(entries), offset))
+
+
+if __name__ == "__main__":
+    main()
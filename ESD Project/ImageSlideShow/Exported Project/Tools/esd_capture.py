@@ -0,0 +1,124 @@
+#!/usr/bin/env python3
+"""Receive the remote screen captures of a running project, see Esd_Capture.h.
+
+The stream is read from the serial port the capture sink writes to. Unchanged rows are kept from the previous
+capture, so the image is only complete from the first key frame on. Every complete capture is written as a binary
+PPM file, capture_00000.ppm and on, or only the latest to a single file with --output.
+
+Usage:
+    esd_capture.py /dev/ttyACM0 [--output FILE] [--count N]
+
+Other bytes on the stream are skipped. Requires pyserial.
+"""
+
+import argparse
+import struct
+import sys
+
+import serial
+
+CAPTURE_MAGIC = b"ESCP"
+KEYFRAME_FLAG = 0x0001
+END = 0xFFFF
+RGB565 = 7
+
+
+class Reader:
+    def __init__(self, port):
+        self.port = port
+        self.pending = b""
+
+    def read(self, size):
+        while len(self.pending) < size:
+            self.pending += self.port.read(max(size - len(self.pending), self.port.in_waiting))
+        data, self.pending = self.pending[:size], self.pending[size:]
+        return data
+
+    def sync(self):
+        """Skips to the next capture header"""
+        while True:
+            found = self.pending.find(CAPTURE_MAGIC)
+            if found >= 0:
+                self.pending = self.pending[found + len(CAPTURE_MAGIC) :]
+                return
+            self.pending = self.pending[-(len(CAPTURE_MAGIC) - 1) :]
+            self.pending += self.port.read(max(1, self.port.in_waiting))
+
+
+def decode_row(data, width):
+    pixels = []
+    offset = 0
+    while offset < len(data):
+        (token,) = struct.unpack_from("<H", data, offset)
+        offset += 2
+        if token & 0x8000:
+            (pixel,) = struct.unpack_from("<H", data, offset)
+            offset += 2
+            pixels.extend([pixel] * (token & 0x7FFF))
+        else:
+            pixels.extend(struct.unpack_from("<%dH" % token, data, offset))
+            offset += token * 2
+    if len(pixels) != width:
+        raise ValueError("row of %d pixels, expected %d" % (len(pixels), width))
+    return pixels
+
+
+def rgb888(row):
+    out = bytearray()
+    for p in row:
+        r, g, b = (p >> 11) & 0x1F, (p >> 5) & 0x3F, p & 0x1F
+        out += bytes(((r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2)))
+    return bytes(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("port")
+    parser.add_argument("--output", help="overwrite this file with every capture")
+    parser.add_argument("--count", type=int, default=0, help="stop after this many captures")
+    args = parser.parse_args()
+
+    image = None
+    keyed = False
+    written = 0
+    with serial.Serial(args.port, timeout=1.0) as port:
+        reader = Reader(port)
+        while not args.count or written < args.count:
+            reader.sync()
+            millis, width, height, fmt, flags = struct.unpack("<IHHHH", reader.read(12))
+            if fmt != RGB565:
+                continue
+            if flags & KEYFRAME_FLAG or image is None or len(image) != height:
+                image = [bytes(width * 3)] * height
+                keyed = bool(flags & KEYFRAME_FLAG)
+            rows = 0
+            try:
+                while True:
+                    record = reader.read(4)
+                    if record == CAPTURE_MAGIC:
+                        reader.pending = record + reader.pending
+                        raise ValueError("next capture started")
+                    y, size = struct.unpack("<HH", record)
+                    if y == END:
+                        break
+                    if y >= height:
+                        raise ValueError("row %d outside of the capture" % y)
+                    image[y] = rgb888(decode_row(reader.read(size), width))
+                    rows += 1
+            except ValueError as e:
+                # Cut short, the target sends a key frame next
+                print("capture at %d ms dropped: %s" % (millis, e), file=sys.stderr)
+                keyed = False
+                continue
+            if not keyed:
+                continue
+            name = args.output or "capture_%05d.ppm" % written
+            with open(name, "wb") as f:
+                f.write(b"P6\n%d %d\n255\n" % (width, height))
+                f.write(b"".join(image))
+            print("%s: %d ms, %d rows changed" % (name, millis, rows))
+            written += 1
+
+
+if __name__ == "__main__":
+    main()
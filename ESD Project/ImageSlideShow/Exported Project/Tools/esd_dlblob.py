@@ -0,0 +1,125 @@
+#!/usr/bin/env python3
+"""Turn a RAM_DL dump of a static page into a precompiled display list fragment, see Esd_DlCache.h.
+
+The dump is the little endian display list as written by the coprocessor, saved from the emulator or read
+back from RAM_DL on the device, up to REG_CMD_DL or the first DISPLAY. The commands are wrapped in
+SAVE_CONTEXT and RESTORE_CONTEXT and written as a program memory array, with a header declaring it and a
+NAME_DlPreload(cache) macro for Esd_DlCache_Preload.
+
+Usage:
+    esd_dlblob.py dump.bin NAME [--output-dir DIR] [--keep-clear]
+
+The fragment is replayed from RAM_G, so anything that depends on where the application put its resources
+is rejected: BITMAP_SOURCE, PALETTE_SOURCE, CALL, JUMP, RETURN, MACRO, and the bitmap handles below 16 that
+Esd assigns at run time. ROM fonts on handles 16 to 31 are accepted. CLEAR is dropped unless --keep-clear,
+so the fragment can be appended to a frame that already cleared the screen.
+"""
+
+import argparse
+import os
+import struct
+import sys
+
+RAM_DL_SIZE = 8192
+
+DISPLAY = 0x00
+BITMAP_SOURCE = 0x01
+BITMAP_HANDLE = 0x05
+CALL = 0x1D
+JUMP = 0x1E
+SAVE_CONTEXT = 0x22
+RESTORE_CONTEXT = 0x23
+RETURN = 0x24
+MACRO = 0x25
+CLEAR = 0x26
+PALETTE_SOURCE = 0x2A
+LAST_OPCODE = 0x2D  # NOP
+
+REJECTED = {
+    BITMAP_SOURCE: "BITMAP_SOURCE",
+    CALL: "CALL",
+    JUMP: "JUMP",
+    RETURN: "RETURN",
+    MACRO: "MACRO",
+    PALETTE_SOURCE: "PALETTE_SOURCE",
+}
+
+ROM_HANDLE_MIN = 16
+
+
+def check(words, keep_clear):
+    out = []
+    for i, word in enumerate(words):
+        kind = word >> 30
+        if kind == 1:  # VERTEX2F
+            out.append(word)
+            continue
+        if kind == 2:  # VERTEX2II
+            handle = (word >> 7) & 0x1F
+            if handle < ROM_HANDLE_MIN:
+                raise ValueError("word %d: VERTEX2II on run time bitmap handle %d" % (i, handle))
+            out.append(word)
+            continue
+        opcode = word >> 24
+        if opcode == DISPLAY:
+            break
+        if opcode > LAST_OPCODE:
+            raise ValueError("word %d: unknown command 0x%08X" % (i, word))
+        if opcode in REJECTED:
+            raise ValueError("word %d: %s refers to run time state" % (i, REJECTED[opcode]))
+        if opcode == BITMAP_HANDLE and (word & 0x1F) < ROM_HANDLE_MIN:
+            raise ValueError("word %d: run time bitmap handle %d" % (i, word & 0x1F))
+        if opcode == CLEAR and not keep_clear:
+            continue
+        out.append(word)
+    return [SAVE_CONTEXT << 24] + out + [RESTORE_CONTEXT << 24]
+
+
+def c_array(words):
+    data = struct.pack("<%dI" % len(words), *words)
+    lines = []
+    for offset in range(0, len(data), 16):
+        lines.append("\t" + " ".join("0x%02X," % b for b in data[offset : offset + 16]))
+    return "\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("dump")
+    parser.add_argument("name", help="C identifier prefix, also the output file name")
+    parser.add_argument("--output-dir", default=".")
+    parser.add_argument("--keep-clear", action="store_true", help="keep the CLEAR commands of the page")
+    args = parser.parse_args()
+
+    with open(args.dump, "rb") as f:
+        data = f.read(RAM_DL_SIZE)
+    if len(data) % 4:
+        sys.exit("%s: not a whole number of display list commands" % args.dump)
+    try:
+        words = check(struct.unpack("<%dI" % (len(data) // 4), data), args.keep_clear)
+    except ValueError as e:
+        sys.exit("%s: %s" % (args.dump, e))
+
+    size = len(words) * 4
+    source = os.path.basename(args.dump)
+    guard = args.name.upper() + "_DL__H"
+    with open(os.path.join(args.output_dir, args.name + "_Dl.h"), "w") as f:
+        f.write("\n#ifndef %s\n#define %s\n\n" % (guard, guard))
+        f.write('#include "Esd_DlCache.h"\n\n')
+        f.write("// Generated by esd_dlblob.py from %s, do not edit\n" % source)
+        f.write("#define %s_DlSize %d\n" % (args.name, size))
+        f.write("extern eve_progmem_const uint8_t %s_Dl[%s_DlSize];\n\n" % (args.name, args.name))
+        f.write("// Replays the page from RAM_G with CMD_APPEND once it has been uploaded by Esd_DlCache_Begin\n")
+        f.write("#define %s_DlPreload(cache) Esd_DlCache_Preload((cache), %s_Dl, %s_DlSize)\n\n" % (args.name, args.name, args.name))
+        f.write("#endif /* #ifndef %s */\n\n/* end of file */\n" % guard)
+    with open(os.path.join(args.output_dir, args.name + "_Dl.c"), "w") as f:
+        f.write('\n#include "%s_Dl.h"\n\n' % args.name)
+        f.write("// Generated by esd_dlblob.py from %s, do not edit\n" % source)
+        f.write("eve_progmem_const uint8_t %s_Dl[%s_DlSize] = {\n" % (args.name, args.name))
+        f.write(c_array(words))
+        f.write("\n};\n\n/* end of file */\n")
+    print("%s: %d commands, %d bytes" % (args.name, len(words), size))
+
+
+if __name__ == "__main__":
+    main()
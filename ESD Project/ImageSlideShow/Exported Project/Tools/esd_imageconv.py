@@ -0,0 +1,643 @@
+#!/usr/bin/env python3
+"""Convert images to the cheapest FT81X bitmap format that stays above a quality threshold.
+
+Each image is encoded in every candidate format, decoded back, and compared against the source.
+Of the formats reaching the PSNR threshold, the one with the smallest combined RAM_G and storage
+size is written, together with the generated C source holding its Esd_BitmapInfo initialiser,
+as a drop-in replacement for the file generated by ESD.
+
+Candidates: L8, RGB332, PALETTED565 and PALETTED4444 (median cut, 256 entries), RGB565, ARGB1555,
+ARGB4, and JPEG through CMD_LOADIMAGE, which costs RAM_G as RGB565 but the least storage.
+Source images must be 8-bit, or raw RGB565 as previously exported, given with --raw WIDTHxHEIGHT.
+
+With --thumbnails, quarter and eighth resolution variants are written as well, in the same format,
+and chained through the Thumbnail field, so Esd_Render_Bitmap_Scaled loads only the smallest
+variant that covers the scaled size on screen, 16 or 64 times fewer bytes for an overview.
+
+With --deflate, the bitmap files are zlib compressed to .bin and loaded through CMD_INFLATE,
+reading fewer bytes from the SD card and over SPI. JPEG and palette files are written as they are.
+
+With --tiles WxH, the image is cut into tiles of that size for Esd_TiledImage.h, to show images larger than
+RAM_G in Ft_Esd_ScrollableImageWidget. The tiles are written row by row to NAME.tiles, each with a one pixel
+gutter copied from its neighbours and padded to whole 512 byte sectors, so one tile is one aligned SD read.
+Only the uncompressed formats without a palette are candidates.
+
+With --dither, the RGB332, RGB565, ARGB1555 and ARGB4 candidates are quantized through an 8x8 ordered
+dither instead of rounding, which trades the banding of smooth gradients for a fine regular pattern.
+The quality threshold still applies, so a dithered format is only chosen where it keeps close to the source.
+With --dither-map NAME, the 16x16 ordered dither matrix is also written as an L8 bitmap in program memory,
+NAME.c and NAME.h, for alpha tests against a dither threshold at run time.
+
+With --atlas, images of the same size are packed as the cells of a single bitmap sharing one format,
+palette, allocation and bitmap handle. The generated header then names each cell after its image.
+
+Usage:
+    esd_imageconv.py [--psnr DB] [--raw WxH] [--formats F,F,...] [--atlas NAME] [--thumbnails] [--deflate] [--tiles WxH] [--dither] [--dither-map NAME] output_dir image...
+
+Requires Pillow for other sources than raw RGB565, and for JPEG.
+"""
+
+import argparse
+import math
+import os
+import struct
+import sys
+import zlib
+
+try:
+    from PIL import Image
+except ImportError:
+    Image = None
+
+PALETTE_SIZE = 256
+
+# Generated source, same layout as the files exported by ESD
+SOURCE_TEMPLATE = """/*
+This file is automatically generated
+{name}
+C Source
+*/
+
+#include "{name}.h"
+
+#include "Ft_Gpu.h"
+
+{thumbnails}Ft_Esd_BitmapInfo {name}__Info = {{
+	ESD_BITMAP_DEFAULTS,
+	.Width = {width},
+	.Height = {height},
+	.Format = {format},
+	.Stride = {stride},
+	.Size = {size},
+	.File = "{file}",
+{palette}	.Cells = {cells},
+	.Compressed = {compressed},
+	.Persistent = 0,
+	.Type = ESD_RESOURCE_FILE,
+{thumbnail}}};
+
+Ft_Esd_BitmapCell {name}(ft_uint16_t cell)
+{{
+	return (Ft_Esd_BitmapCell){{ 
+		.Info = &{name}__Info, 
+		.Cell = cell 
+	}};
+}}
+
+
+/* end of file */
+"""
+
+# Smaller resolution variant, declared ahead of the bitmap which refers to it
+THUMBNAIL_TEMPLATE = """static Ft_Esd_BitmapInfo {name}__Info{factor} = {{
+	ESD_BITMAP_DEFAULTS,
+	.Width = {width},
+	.Height = {height},
+	.Format = {format},
+	.Stride = {stride},
+	.Size = {size},
+	.File = "{file}",
+{palette}	.Cells = {cells},
+	.Compressed = {compressed},
+	.Persistent = 0,
+	.Type = ESD_RESOURCE_FILE,
+{thumbnail}}};
+
+"""
+
+THUMBNAIL_FACTORS = (4, 8)
+
+# Image drawn from tiles, which the bitmap itself refers to
+TILED_TEMPLATE = """/*
+This file is automatically generated
+{name}
+C Source
+*/
+
+#include "{name}.h"
+
+#include "Ft_Gpu.h"
+#include "Esd_TiledImage.h"
+
+static Esd_TiledImage {name}__Tiles = {{
+	.File = "{file}",
+	.Format = {format},
+	.TileWidth = {tile_width},
+	.TileHeight = {tile_height},
+	.Columns = {columns},
+	.Rows = {rows},
+	.TileStride = {tile_stride},
+	.TileSize = {tile_size},
+}};
+
+Ft_Esd_BitmapInfo {name}__Info = {{
+	ESD_BITMAP_DEFAULTS,
+	.Width = {width},
+	.Height = {height},
+	.Format = {format},
+	.Stride = {stride},
+	.Cells = 1,
+	.Persistent = 0,
+	.Type = ESD_RESOURCE_FILE,
+	.Tiled = &{name}__Tiles,
+}};
+
+Ft_Esd_BitmapCell {name}(ft_uint16_t cell)
+{{
+	return (Ft_Esd_BitmapCell){{ 
+		.Info = &{name}__Info, 
+		.Cell = cell 
+	}};
+}}
+
+
+/* end of file */
+"""
+
+# Ordered dither matrix in program memory, uploaded to RAM_G like any other bitmap
+DITHER_MAP_SOURCE_TEMPLATE = """/*
+This file is automatically generated
+{name}
+C Source
+*/
+
+#include "{name}.h"
+
+#include "Ft_Gpu.h"
+
+static eve_progmem_const uint8_t {name}__Data[{size}] = {{
+{data}
+}};
+
+Ft_Esd_BitmapInfo {name}__Info = {{
+	ESD_BITMAP_DEFAULTS,
+	.Width = {width},
+	.Height = {width},
+	.Format = L8,
+	.Stride = {width},
+	.Size = {size},
+	.StorageSize = {storage_size},
+	.ProgMem = {name}__Data,
+	.Cells = 1,
+	.Compressed = 0,
+	.Persistent = 0,
+	.Type = ESD_RESOURCE_PROGMEM,
+}};
+
+Ft_Esd_BitmapCell {name}(ft_uint16_t cell)
+{{
+	return (Ft_Esd_BitmapCell){{ 
+		.Info = &{name}__Info, 
+		.Cell = cell 
+	}};
+}}
+
+
+/* end of file */
+"""
+
+DITHER_MAP_HEADER_TEMPLATE = """/*
+This file is automatically generated
+{name}
+Header
+*/
+
+#ifndef {name}__H
+#define {name}__H
+
+#ifndef ESD_FUNCTION
+#define ESD_FUNCTION(name, ...)
+#endif
+
+#include "Ft_DataTypes.h"
+#include "Ft_Esd_BitmapInfo.h"
+
+ESD_FUNCTION({name}, Type = Ft_Esd_BitmapCell, DisplayName = "{name}", Include = "{name}.h", Category = _GroupUserResources, Icon = ":/icons/image.png")
+Ft_Esd_BitmapCell {name}(ft_uint16_t cell);
+
+extern Ft_Esd_BitmapInfo {name}__Info;
+
+#endif /* {name}__H */
+
+/* end of file */
+"""
+
+TILE_FORMATS = ("L8", "RGB332", "RGB565", "ARGB1555", "ARGB4")
+
+# Bits of red, green, blue and alpha of the formats which are dithered. The single alpha bit of ARGB1555 is left as a threshold
+DITHER_BITS = {
+    "RGB332": (3, 3, 2, 8),
+    "RGB565": (5, 6, 5, 8),
+    "ARGB1555": (5, 5, 5, 8),
+    "ARGB4": (4, 4, 4, 4),
+}
+DITHER_SIZE = 8
+DITHER_MAP_SIZE = 16
+TILE_GUTTER = 1
+SECTOR_SIZE = 512
+
+# Header of an atlas, with one accessor for each cell
+HEADER_TEMPLATE = """/*
+This file is automatically generated
+{name}
+Header
+*/
+
+#ifndef {name}__H
+#define {name}__H
+
+#ifndef ESD_FUNCTION
+#define ESD_FUNCTION(name, ...)
+#endif
+
+#include "Ft_DataTypes.h"
+#include "Ft_Esd_BitmapInfo.h"
+
+Ft_Esd_BitmapCell {name}(ft_uint16_t cell);
+
+extern Ft_Esd_BitmapInfo {name}__Info;
+{cells}
+#endif /* {name}__H */
+
+/* end of file */
+"""
+
+CELL_TEMPLATE = """
+ESD_FUNCTION({name}_{icon}, Type = Ft_Esd_BitmapCell, DisplayName = "{icon}", Include = "{name}.h", Category = _GroupUserResources, Icon = ":/icons/image.png", Macro)
+#define {name}_{icon}() ((Ft_Esd_BitmapCell){{ .Info = &{name}__Info, .Cell = {cell} }})
+"""
+
+
+
+def expand(value, bits):
+    """Expand a quantized channel back to 8 bits, the way the GPU does"""
+    value <<= 8 - bits
+    return value | (value >> bits)
+
+
+def q(value, bits):
+    return (value * ((1 << bits) - 1) + 127) // 255
+
+
+class Encoded:
+    def __init__(self, fmt, bpp, data, decoded, palette=None, ext="raw"):
+        self.format = fmt
+        self.bpp = bpp
+        self.data = data
+        self.decoded = decoded
+        self.palette = palette
+        self.ext = ext
+
+
+def bayer(size):
+    """Ordered dither matrix of a power of two size, values 0 to size * size - 1"""
+    matrix = [[0]]
+    while len(matrix) < size:
+        n = len(matrix)
+        matrix = [[4 * matrix[y % n][x % n] + (0, 2, 3, 1)[(y // n) * 2 + (x // n)] for x in range(2 * n)] for y in range(2 * n)]
+    return matrix
+
+
+def dither(pixels, width, fmt):
+    """Offset each channel by up to half a quantization step following the ordered dither matrix,
+    so rounding to the format then produces the dither pattern"""
+    bits = DITHER_BITS[fmt]
+    matrix = bayer(DITHER_SIZE)
+    area = DITHER_SIZE * DITHER_SIZE
+    out = []
+    for i, p in enumerate(pixels):
+        threshold = (matrix[(i // width) % DITHER_SIZE][(i % width) % DITHER_SIZE] + 0.5) / area - 0.5
+        out.append(tuple(v if b >= 8 else min(max(int(round(v + threshold * 255.0 / ((1 << b) - 1))), 0), 255)
+                         for v, b in zip(p, bits)))
+    return out
+
+
+def psnr(source, decoded, alpha):
+    channels = 4 if alpha else 3
+    err = 0
+    for a, b in zip(source, decoded):
+        for c in range(channels):
+            d = a[c] - b[c]
+            err += d * d
+    mse = err / float(len(source) * channels)
+    return float("inf") if not mse else 10.0 * math.log10(255.0 * 255.0 / mse)
+
+
+def encode_direct(fmt, pixels):
+    data = bytearray()
+    decoded = []
+    if fmt == "L8":
+        for r, g, b, a in pixels:
+            l = (r * 77 + g * 150 + b * 29 + 128) >> 8
+            data.append(l)
+            decoded.append((l, l, l, 255))
+        return Encoded(fmt, 1, data, decoded)
+    if fmt == "RGB332":
+        for r, g, b, a in pixels:
+            r, g, b = q(r, 3), q(g, 3), q(b, 2)
+            data.append((r << 5) | (g << 2) | b)
+            decoded.append((expand(r, 3), expand(g, 3), expand(b, 2), 255))
+        return Encoded(fmt, 1, data, decoded)
+    for r, g, b, a in pixels:
+        if fmt == "RGB565":
+            r, g, b = q(r, 5), q(g, 6), q(b, 5)
+            data += struct.pack("<H", (r << 11) | (g << 5) | b)
+            decoded.append((expand(r, 5), expand(g, 6), expand(b, 5), 255))
+        elif fmt == "ARGB1555":
+            r, g, b, a = q(r, 5), q(g, 5), q(b, 5), a >= 128
+            data += struct.pack("<H", (a << 15) | (r << 10) | (g << 5) | b)
+            decoded.append((expand(r, 5), expand(g, 5), expand(b, 5), 255 if a else 0))
+        elif fmt == "ARGB4":
+            r, g, b, a = q(r, 4), q(g, 4), q(b, 4), q(a, 4)
+            data += struct.pack("<H", (a << 12) | (r << 8) | (g << 4) | b)
+            decoded.append((expand(r, 4), expand(g, 4), expand(b, 4), expand(a, 4)))
+    return Encoded(fmt, 2, data, decoded)
+
+
+def median_cut(pixels, channels):
+    """Median cut over the distinct colours, weighted by their count.
+    Returns the palette and the palette index of each distinct colour"""
+    counts = {}
+    for p in pixels:
+        key = p[:channels]
+        counts[key] = counts.get(key, 0) + 1
+
+    def make_box(keys):
+        total = sum(counts[k] for k in keys)
+        score, channel = 0, 0
+        if len(keys) > 1:
+            for c in range(channels):
+                extent = max(k[c] for k in keys) - min(k[c] for k in keys)
+                if extent * total > score:
+                    score, channel = extent * total, c
+        return [score, channel, total, keys]
+
+    boxes = [make_box(list(counts.keys()))]
+    while len(boxes) < PALETTE_SIZE:
+        best = max(range(len(boxes)), key=lambda i: boxes[i][0])
+        score, channel, total, keys = boxes[best]
+        if not score:
+            break
+        keys.sort(key=lambda k: k[channel])
+        acc, split = 0, 1
+        for split in range(1, len(keys)):
+            acc += counts[keys[split - 1]]
+            if acc * 2 >= total:
+                break
+        boxes[best:best + 1] = [make_box(keys[:split]), make_box(keys[split:])]
+
+    palette = []
+    index = {}
+    for i, (score, channel, total, keys) in enumerate(boxes):
+        palette.append(tuple((sum(k[c] * counts[k] for k in keys) + total // 2) // total for c in range(channels)))
+        for k in keys:
+            index[k] = i
+    return palette, index
+
+
+def encode_paletted(fmt, pixels):
+    alpha = fmt == "PALETTED4444"
+    channels = 4 if alpha else 3
+    palette, index = median_cut(pixels, channels)
+    lut = bytearray()
+    entries = []
+    for entry in palette + [(0, 0, 0, 0)] * (PALETTE_SIZE - len(palette)):
+        if alpha:
+            r, g, b, a = q(entry[0], 4), q(entry[1], 4), q(entry[2], 4), q(entry[3], 4)
+            lut += struct.pack("<H", (a << 12) | (r << 8) | (g << 4) | b)
+            entries.append((expand(r, 4), expand(g, 4), expand(b, 4), expand(a, 4)))
+        else:
+            r, g, b = q(entry[0], 5), q(entry[1], 6), q(entry[2], 5)
+            lut += struct.pack("<H", (r << 11) | (g << 5) | b)
+            entries.append((expand(r, 5), expand(g, 6), expand(b, 5), 255))
+    data = bytearray(index[p[:channels]] for p in pixels)
+    decoded = [entries[i] for i in data]
+    return Encoded(fmt, 1, data, decoded, palette=lut)
+
+
+def encode_jpeg(pixels, width, height, quality):
+    import io
+    img = Image.new("RGB", (width, height))
+    img.putdata([p[:3] for p in pixels])
+    buf = io.BytesIO()
+    img.save(buf, "JPEG", quality=quality, optimize=True, subsampling=2)
+    data = buf.getvalue()
+    decoded = [p + (255,) for p in Image.open(io.BytesIO(data)).convert("RGB").getdata()]
+    return Encoded("JPEG", 2, data, decoded, ext="jpg")
+
+
+def downscale(pixels, width, height, cells, factor):
+    """Box filter each cell down by factor, returns the variant size and pixels"""
+    w, h = max(1, width // factor), max(1, height // factor)
+    out = []
+    for c in range(cells):
+        base = c * width * height
+        for y in range(h):
+            y0, y1 = y * height // h, max(y * height // h + 1, (y + 1) * height // h)
+            for x in range(w):
+                x0, x1 = x * width // w, max(x * width // w + 1, (x + 1) * width // w)
+                block = [pixels[base + sy * width + sx] for sy in range(y0, y1) for sx in range(x0, x1)]
+                n = len(block)
+                out.append(tuple((sum(p[i] for p in block) + n // 2) // n for i in range(4)))
+    return w, h, out
+
+
+def encode(fmt, pixels, width, height, args):
+    if fmt == "JPEG":
+        return encode_jpeg(pixels, width, height, args.jpeg_quality)
+    if fmt.startswith("PALETTED"):
+        return encode_paletted(fmt, pixels)
+    if args.dither and fmt in DITHER_BITS:
+        pixels = dither(pixels, width, fmt)
+    return encode_direct(fmt, pixels)
+
+
+def load(path, raw):
+    if raw:
+        width, height = (int(v) for v in raw.lower().split("x"))
+        with open(path, "rb") as f:
+            data = f.read()
+        if len(data) != width * height * 2:
+            sys.exit("%s: expected %d bytes of RGB565" % (path, width * height * 2))
+        pixels = []
+        for (v,) in struct.iter_unpack("<H", data):
+            pixels.append((expand(v >> 11, 5), expand((v >> 5) & 0x3F, 6), expand(v & 0x1F, 5), 255))
+        return width, height, pixels
+    if not Image:
+        sys.exit("Pillow is required to read %s" % path)
+    img = Image.open(path).convert("RGBA")
+    return img.width, img.height, list(img.getdata())
+
+
+def choose(name, width, height, pixels, cells, formats, args):
+    """Encode in each format, returns the cheapest encoding where every cell reaches the threshold"""
+    alpha = any(p[3] != 255 for p in pixels)
+    cell_pixels = width * height
+    best, best_cost = None, None
+    for fmt in formats:
+        # An atlas is decoded as one image, but CMD_LOADIMAGE produces a single cell
+        if fmt == "JPEG" and (not Image or alpha or cells > 1):
+            continue
+        enc = encode(fmt, pixels, width, height, args)
+        quality = min(psnr(pixels[i:i + cell_pixels], enc.decoded[i:i + cell_pixels], alpha)
+                      for i in range(0, len(pixels), cell_pixels))
+        ram = len(pixels) * enc.bpp + (len(enc.palette) if enc.palette else 0)
+        storage = len(enc.data) + (len(enc.palette) if enc.palette else 0)
+        print("%s: %-12s %6.1f dB, %7d B RAM_G, %7d B storage" % (name, fmt, quality, ram, storage))
+        # Halving either size halves the SD reads or the RAM_G residency, both count the same
+        if quality >= args.psnr and (best is None or ram + storage < best_cost):
+            best, best_cost = enc, ram + storage
+    if best is None:
+        sys.exit("%s: no format reaches %.1f dB" % (name, args.psnr))
+    print("%s: using %s" % (name, best.format))
+    return best
+
+
+def write_data(output, name, enc, args):
+    """Write the bitmap and palette files, returns the file name, the palette initialiser, and whether it is deflated"""
+    data, ext = enc.data, enc.ext
+    compressed = args.deflate and ext == "raw"
+    if compressed:
+        data, ext = zlib.compress(bytes(data), 9), "bin"
+        print("%s: deflated to %d of %d B" % (name, len(data), len(enc.data)))
+    file = "%s.%s" % (name, ext)
+    with open(os.path.join(output, file), "wb") as f:
+        f.write(data)
+    palette = ""
+    if enc.palette:
+        palette_file = "%s.lut.raw" % name
+        with open(os.path.join(output, palette_file), "wb") as f:
+            f.write(enc.palette)
+        palette = '\t.PaletteFile = "%s",\n' % palette_file
+    return file, palette, int(compressed)
+
+
+def write_thumbnails(output, name, width, height, pixels, cells, fmt, args):
+    """Encode the variants in the format of the full bitmap, smallest first, returns their source"""
+    source, thumbnail = "", ""
+    for factor in reversed(THUMBNAIL_FACTORS):
+        w, h, small = downscale(pixels, width, height, cells, factor)
+        enc = encode(fmt, small, w, h, args)
+        file, palette, compressed = write_data(output, "%s_%d" % (name, factor), enc, args)
+        source += THUMBNAIL_TEMPLATE.format(name=name, factor=factor, width=w, height=h, format=enc.format,
+                                            stride=w * enc.bpp, size=w * h * cells * enc.bpp, file=file,
+                                            palette=palette, cells=cells, compressed=compressed, thumbnail=thumbnail)
+        thumbnail = "\t.Thumbnail = &%s__Info%d,\n" % (name, factor)
+        print("%s: %dx%d variant, %d B RAM_G" % (name, w, h, w * h * cells * enc.bpp))
+    return source, thumbnail
+
+
+def write(output, name, width, height, pixels, cells, enc, args):
+    file, palette, compressed = write_data(output, name, enc, args)
+    thumbnails, thumbnail = "", ""
+    if args.thumbnails:
+        thumbnails, thumbnail = write_thumbnails(output, name, width, height, pixels, cells, enc.format, args)
+    with open(os.path.join(output, name + ".c"), "w", newline="\n") as f:
+        f.write(SOURCE_TEMPLATE.format(name=name, width=width, height=height, format=enc.format,
+                                       stride=width * enc.bpp, size=width * height * cells * enc.bpp,
+                                       file=file, palette=palette, cells=cells, compressed=compressed,
+                                       thumbnails=thumbnails, thumbnail=thumbnail))
+
+
+def write_tiled(output, name, width, height, pixels, fmt, tile_width, tile_height, args):
+    """Write the tiles, each with its gutter, and the source of the tiled bitmap"""
+    if args.dither and fmt in DITHER_BITS:
+        pixels = dither(pixels, width, fmt)  # Over the whole image, so the pattern runs on across the tiles
+    columns = (width + tile_width - 1) // tile_width
+    rows = (height + tile_height - 1) // tile_height
+    file = "%s.tiles" % name
+    bpp, tile_size = None, None
+    with open(os.path.join(output, file), "wb") as f:
+        for row in range(rows):
+            for column in range(columns):
+                # Coordinates outside of the image repeat its edge, which also pads the last column and row
+                tile = []
+                for y in range(row * tile_height - TILE_GUTTER, (row + 1) * tile_height + TILE_GUTTER):
+                    y = min(max(y, 0), height - 1)
+                    for x in range(column * tile_width - TILE_GUTTER, (column + 1) * tile_width + TILE_GUTTER):
+                        tile.append(pixels[y * width + min(max(x, 0), width - 1)])
+                enc = encode_direct(fmt, tile)
+                bpp = enc.bpp
+                tile_size = (len(enc.data) + SECTOR_SIZE - 1) // SECTOR_SIZE * SECTOR_SIZE
+                f.write(enc.data + bytes(tile_size - len(enc.data)))
+    tile_stride = (tile_width + 2 * TILE_GUTTER) * bpp
+    with open(os.path.join(output, name + ".c"), "w", newline="\n") as f:
+        f.write(TILED_TEMPLATE.format(name=name, file=file, format=fmt, width=width, height=height, stride=width * bpp,
+                                      tile_width=tile_width, tile_height=tile_height, columns=columns, rows=rows,
+                                      tile_stride=tile_stride, tile_size=tile_size))
+    print("%s: %dx%d tiles of %d B, %d B RAM_G each" % (name, columns, rows, tile_size,
+                                                      tile_stride * (tile_height + 2 * TILE_GUTTER)))
+
+
+def write_dither_map(output, name):
+    """Write the dither matrix scaled to the full L8 range as a program memory bitmap"""
+    area = DITHER_MAP_SIZE * DITHER_MAP_SIZE
+    data = bytes(m * 256 // area for row in bayer(DITHER_MAP_SIZE) for m in row)
+    lines = ["\t" + " ".join("0x%02X," % b for b in data[i:i + 16]) for i in range(0, len(data), 16)]
+    with open(os.path.join(output, name + ".c"), "w", newline="\n") as f:
+        f.write(DITHER_MAP_SOURCE_TEMPLATE.format(name=name, width=DITHER_MAP_SIZE, size=len(data),
+                                                  storage_size=(len(data) + 3) >> 2, data="\n".join(lines)))
+    with open(os.path.join(output, name + ".h"), "w", newline="\n") as f:
+        f.write(DITHER_MAP_HEADER_TEMPLATE.format(name=name))
+    print("%s: %dx%d L8 dither matrix, %d B program memory" % (name, DITHER_MAP_SIZE, DITHER_MAP_SIZE, len(data)))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--psnr", type=float, default=38.0, help="minimum quality in dB, default 38")
+    parser.add_argument("--raw", help="sources are raw RGB565 of this size, for example 320x240")
+    parser.add_argument("--formats", default="L8,RGB332,PALETTED565,PALETTED4444,RGB565,ARGB1555,ARGB4,JPEG")
+    parser.add_argument("--jpeg-quality", type=int, default=90)
+    parser.add_argument("--atlas", metavar="NAME", help="pack all images, of the same size, as the cells of one bitmap")
+    parser.add_argument("--thumbnails", action="store_true", help="also write quarter and eighth resolution variants")
+    parser.add_argument("--deflate", action="store_true", help="compress the bitmap files, loaded through CMD_INFLATE")
+    parser.add_argument("--tiles", metavar="WxH", help="cut each image into tiles of this size, for images larger than RAM_G")
+    parser.add_argument("--dither", action="store_true", help="ordered dither the formats with less than 8 bits per channel")
+    parser.add_argument("--dither-map", metavar="NAME", help="also write the dither matrix as an L8 bitmap in program memory")
+    parser.add_argument("output")
+    parser.add_argument("images", nargs="+")
+    args = parser.parse_args()
+    formats = args.formats.split(",")
+
+    if args.dither_map:
+        write_dither_map(args.output, args.dither_map)
+
+    if args.tiles:
+        if args.atlas or args.thumbnails or args.deflate:
+            sys.exit("--tiles cannot be combined with --atlas, --thumbnails or --deflate")
+        tile_width, tile_height = (int(v) for v in args.tiles.lower().split("x"))
+        formats = [fmt for fmt in formats if fmt in TILE_FORMATS]
+        for path in args.images:
+            name = os.path.splitext(os.path.basename(path))[0]
+            width, height, pixels = load(path, args.raw)
+            enc = choose(name, width, height, pixels, 1, formats, args)
+            write_tiled(args.output, name, width, height, pixels, enc.format, tile_width, tile_height, args)
+        return
+
+    if not args.atlas:
+        for path in args.images:
+            name = os.path.splitext(os.path.basename(path))[0]
+            width, height, pixels = load(path, args.raw)
+            write(args.output, name, width, height, pixels, 1, choose(name, width, height, pixels, 1, formats, args), args)
+        return
+
+    # Cells are stacked vertically in RAM_G, cell n starts n * stride * height bytes after the first.
+    # The whole atlas takes one allocation and one bitmap handle, and cells above 127 are paged by Esd_CoDl_PagedCell
+    names, pixels, size = [], [], None
+    for path in args.images:
+        width, height, cell = load(path, args.raw)
+        if size and size != (width, height):
+            sys.exit("%s: %dx%d, the atlas cells are %dx%d" % (path, width, height, size[0], size[1]))
+        size = (width, height)
+        names.append(os.path.splitext(os.path.basename(path))[0])
+        pixels += cell
+    width, height = size
+    cells = len(names)
+    write(args.output, args.atlas, width, height, pixels, cells, choose(args.atlas, width, height, pixels, cells, formats, args), args)
+    with open(os.path.join(args.output, args.atlas + ".h"), "w", newline="\n") as f:
+        f.write(HEADER_TEMPLATE.format(name=args.atlas, cells="".join(
+            CELL_TEMPLATE.format(name=args.atlas, cell=c, icon=icon) for c, icon in enumerate(names))))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,78 @@
+#!/usr/bin/env python3
+"""Send a raw bitmap to a running project for live preview, see Esd_Preview.h.
+
+The data is written by the target straight into RAM_G and replaces the bitmap registered in the given slot
+once complete, without going through the SD card. Without --width the bitmap keeps its layout and the file
+must have the same size as the bitmap it replaces. With --width, --height and --format the layout is
+replaced as well, the stride defaults to the width times the bits per pixel of the format.
+
+Usage:
+    esd_preview.py /dev/ttyACM0 slot file.raw [--format RGB565 --width W --height H [--stride S]]
+
+Requires pyserial.
+"""
+
+import argparse
+import struct
+import sys
+import time
+
+import serial
+
+PREVIEW_MAGIC = 0x57565250
+CHUNK = 64 * 1024
+
+# Bitmap formats accepted for a layout change, with their bits per pixel
+FORMATS = {
+    "ARGB1555": (0, 16),
+    "L1": (1, 1),
+    "L4": (2, 4),
+    "L8": (3, 8),
+    "RGB332": (4, 8),
+    "ARGB2": (5, 8),
+    "ARGB4": (6, 16),
+    "RGB565": (7, 16),
+    "L2": (17, 2),
+}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("port")
+    parser.add_argument("slot", type=int)
+    parser.add_argument("file")
+    parser.add_argument("--format", choices=sorted(FORMATS))
+    parser.add_argument("--width", type=int, default=0)
+    parser.add_argument("--height", type=int, default=0)
+    parser.add_argument("--stride", type=int, default=0)
+    args = parser.parse_args()
+
+    with open(args.file, "rb") as f:
+        data = f.read()
+    if not data:
+        sys.exit("%s: empty file" % args.file)
+
+    fmt = 0
+    stride = args.stride
+    if args.width:
+        if not args.format or not args.height:
+            sys.exit("--width needs --height and --format")
+        fmt, bpp = FORMATS[args.format]
+        stride = stride or (args.width * bpp + 7) // 8
+        if stride * args.height != len(data):
+            sys.exit("%s: %d bytes, the layout needs %d" % (args.file, len(data), stride * args.height))
+
+    header = struct.pack("<IB3xIIHHHH", PREVIEW_MAGIC, args.slot, len(data), fmt, args.width, args.height, stride, 0)
+
+    with serial.Serial(args.port, timeout=1.0) as port:
+        start = time.monotonic()
+        port.write(header)
+        for offset in range(0, len(data), CHUNK):
+            port.write(data[offset : offset + CHUNK])
+        port.flush()
+        elapsed = time.monotonic() - start
+    print("slot %d: %d bytes in %.1f s" % (args.slot, len(data), elapsed))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,116 @@
+#!/usr/bin/env python3
+"""Assign build time RAM_G addresses to the fixed bitmaps of a project, loaded by Esd_GpuAlloc_AllocStatic.
+
+The generated bitmap sources are scanned for their Esd_BitmapInfo initialisers. Persistent bitmaps, or all
+of them with --all, are packed from the start of RAM_G, largest first, and their initialisers are rewritten
+in place with the assigned .Static and .StaticAddress fields. Bitmaps which are no longer part of the layout
+have those fields removed, so the tool can be run again whenever the resources change.
+
+The header defines GA_STATIC_SIZE, the size of the layout, which the dynamic allocator leaves alone.
+Build the project with ESD_RAMG_LAYOUT defined and the header on the include path.
+
+Usage:
+    esd_ramg_layout.py [--header FILE] [--ram-g BYTES] [--all] source.c...
+
+Palettes and coprocessor loaded images keep using the dynamic allocator for their palette.
+"""
+
+import argparse
+import re
+import sys
+
+RAM_G_SIZE = 1024 * 1024  # FT81X
+ALIGN = 4  # Esd_GpuAlloc_Alloc
+
+INFO_PATTERN = re.compile(r"(?:Ft_)?Esd_BitmapInfo\s+(\w+)\s*=\s*\{(.*?)\n\};", re.S)
+STATIC_PATTERN = re.compile(r"\n\t\.Static(?:Address)?\s*=\s*[^,\n]*,")
+SIZE_PATTERN = re.compile(r"\n\t\.Size\s*=\s*(\d+),")
+PERSISTENT_PATTERN = re.compile(r"\.Persistent\s*=\s*1\b")
+
+HEADER_TEMPLATE = """/*
+This file is automatically generated by esd_ramg_layout.py
+Build time RAM_G layout
+*/
+
+#ifndef ESD_RAMG_LAYOUT__H
+#define ESD_RAMG_LAYOUT__H
+
+{entries}
+#define GA_STATIC_SIZE {size}UL
+
+#endif /* ESD_RAMG_LAYOUT__H */
+
+/* end of file */
+"""
+
+
+def align(value, alignment):
+    return (value + alignment - 1) & ~(alignment - 1)
+
+
+def scan(path, include_all):
+    """Returns the source with the static fields stripped, and the bitmaps to place as (name, size)"""
+    with open(path, "r") as f:
+        source = f.read()
+    bitmaps = []
+
+    def strip(match):
+        body = STATIC_PATTERN.sub("", match.group(2))
+        size = SIZE_PATTERN.search(body)
+        if size and (include_all or PERSISTENT_PATTERN.search(body)):
+            bitmaps.append((match.group(1), int(size.group(1))))
+        return match.group(0).replace(match.group(2), body)
+
+    return INFO_PATTERN.sub(strip, source), bitmaps
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--header", default="Esd_RamGLayout.h", help="generated header defining GA_STATIC_SIZE")
+    parser.add_argument("--ram-g", type=int, default=RAM_G_SIZE, help="RAM_G size of the target")
+    parser.add_argument("--all", action="store_true", help="place all bitmaps, not only persistent ones")
+    parser.add_argument("sources", nargs="+")
+    args = parser.parse_args()
+
+    sources = {}
+    bitmaps = []
+    for path in args.sources:
+        source, found = scan(path, args.all)
+        sources[path] = source
+        bitmaps += [(name, size, path) for name, size in found]
+
+    # Largest first keeps the layout stable when small bitmaps are added
+    bitmaps.sort(key=lambda b: (-b[1], b[0]))
+    addresses = {}
+    layout = 0
+    for name, size, path in bitmaps:
+        addresses[name] = layout
+        layout = align(layout + size, ALIGN)
+    if layout > args.ram_g:
+        sys.exit("Layout of %d bytes does not fit RAM_G of %d bytes" % (layout, args.ram_g))
+
+    def place(match):
+        name = match.group(1)
+        if name not in addresses:
+            return match.group(0)
+        fields = "\n\t.Static = 1,\n\t.StaticAddress = 0x%06X," % addresses[name]
+        body = SIZE_PATTERN.sub(lambda m: m.group(0) + fields, match.group(2), count=1)
+        return match.group(0).replace(match.group(2), body)
+
+    for path, source in sources.items():
+        source = INFO_PATTERN.sub(place, source)
+        with open(path, "r") as f:
+            changed = f.read() != source
+        if changed:
+            with open(path, "w") as f:
+                f.write(source)
+
+    entries = "".join("// %s: 0x%06X, %d bytes\n" % (name, addresses[name], size) for name, size, path in bitmaps)
+    with open(args.header, "w") as f:
+        f.write(HEADER_TEMPLATE.format(entries=entries, size=layout))
+
+    print("%s: %d bitmaps, %d of %d bytes" % (args.header, len(bitmaps), layout, args.ram_g))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,384 @@
+/**
+ * @file bsp_bench.c
+ * @brief On-target benchmarks of the IDP-3500-04A BSP
+ *
+ * @author Bridgetek
+ *
+ * @date 2025
+ * 
+ * MIT License
+ *
+ * Copyright (c) [2025] [Bridgetek Pte Ltd (BRTChip)]
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "bsp_debug.h"
+#include "bsp_hwdefs.h"
+#include "bsp_bench.h"
+#include "eve_app.h"
+#include "sdcard.h"
+#include "ff.h"
+
+/* Bytes moved over SPI per bus width, in both directions */
+#define BENCH_SPI_SIZE (256 * 1024UL)
+/* Size of the benchmark file kept on the SD card, written once */
+#define BENCH_SD_FILE "bench.bin"
+#define BENCH_SD_SIZE (1024 * 1024UL)
+#define BENCH_SD_RANDOM_READS 512
+/* Transfer chunk for SPI and SD card reads */
+#define BENCH_CHUNK 4096
+/* Display list words per batch, one batch fits the display list behind a CMD_DLSTART */
+#define BENCH_CMD_BATCH 1024
+#define BENCH_CMD_BATCHES 64
+#define BENCH_INFLATE_ITERATIONS 32
+/* Size of a full screen ARGB4 image, uploaded in one go */
+#define BENCH_UPLOAD_SIZE (150 * 1024UL)
+#define BENCH_FRAMES 120
+
+static uint8_t s_BenchBuffer[BENCH_CHUNK];
+
+/* 128x128 L8 XOR pattern, deflated */
+#define BENCH_INFLATE_RAW_SIZE (128 * 128)
+static eve_progmem_const uint8_t s_BenchInflate[] = {
+	0x78, 0xda, 0xa5, 0x5a, 0xc3, 0x96, 0x26, 0x8c, 0x12, 0xfb, 0x7a, 0x1a, 0xd3, 0xb6, 0x35, 0x6d,
+	0xdb, 0xb6, 0x6d, 0xdb, 0xb6, 0xf9, 0xea, 0xff, 0xad, 0x73, 0x6e, 0x6d, 0xb2, 0xc9, 0x22, 0xcf,
+	0x50, 0x49, 0x55, 0x50, 0x81, 0xa0, 0x3f, 0xc1, 0x21, 0xa1, 0x61, 0x7f, 0xc3, 0x23, 0x22, 0xa3,
+	0xa2, 0x63, 0x62, 0xe3, 0xe2, 0x13, 0x12, 0x93, 0x92, 0x53, 0x52, 0xd3, 0xd2, 0x33, 0x32, 0xb3,
+	0xb2, 0x73, 0x72, 0xff, 0xe5, 0xe5, 0x17, 0x14, 0x16, 0x15, 0x97, 0x94, 0x96, 0x95, 0x57, 0x54,
+	0x56, 0x55, 0xd7, 0xd4, 0xd6, 0xd5, 0x37, 0x34, 0x36, 0x35, 0xb7, 0xb4, 0xb6, 0xb5, 0x77, 0x74,
+	0x76, 0x75, 0xf7, 0xf4, 0xf6, 0xf5, 0x0f, 0x0c, 0x0e, 0x0d, 0x8f, 0x8c, 0x8e, 0x8d, 0x4f, 0x4c,
+	0x4e, 0x4d, 0xcf, 0xcc, 0xce, 0xcd, 0x2f, 0x2c, 0x2e, 0x2d, 0xaf, 0xac, 0xae, 0xad, 0x6f, 0x6c,
+	0x6e, 0x6d, 0xef, 0xec, 0xee, 0xed, 0x1f, 0x1c, 0x1e, 0x1d, 0x9f, 0x9c, 0x9e, 0x9d, 0x5f, 0x5c,
+	0x5e, 0x5d, 0xdf, 0xdc, 0xde, 0xdd, 0x3f, 0x3c, 0x3e, 0x3d, 0xbf, 0xbc, 0xbe, 0xbd, 0x7f, 0x7c,
+	0x7e, 0x7d, 0xff, 0xfc, 0x06, 0x05, 0x82, 0xff, 0x84, 0x86, 0xfc, 0x0d, 0x8b, 0x08, 0x8f, 0x8a,
+	0x8c, 0x89, 0x8e, 0x8b, 0x4d, 0x88, 0x4f, 0x4a, 0x4c, 0x49, 0x4e, 0x4b, 0xcd, 0x48, 0xcf, 0xca,
+	0xcc, 0xc9, 0xfe, 0x97, 0x9b, 0x9f, 0x57, 0x58, 0x50, 0x5c, 0x54, 0x5a, 0x52, 0x5e, 0x56, 0x59,
+	0x51, 0x5d, 0x55, 0x5b, 0x53, 0x5f, 0xd7, 0xd8, 0xd0, 0xdc, 0xd4, 0xda, 0xd2, 0xde, 0xd6, 0xd9,
+	0xd1, 0xdd, 0xd5, 0xdb, 0xd3, 0xdf, 0x37, 0x38, 0x30, 0x3c, 0x34, 0x3a, 0x32, 0x3e, 0x36, 0x39,
+	0x31, 0x3d, 0x35, 0x3b, 0x33, 0x3f, 0xb7, 0xb8, 0xb0, 0xbc, 0xb4, 0xba, 0xb2, 0xbe, 0xb6, 0xb9,
+	0xb1, 0xbd, 0xb5, 0xbb, 0xb3, 0xbf, 0x77, 0x78, 0x70, 0x7c, 0x74, 0x7a, 0x72, 0x7e, 0x76, 0x79,
+	0x71, 0x7d, 0x75, 0x7b, 0x73, 0x7f, 0xf7, 0xf8, 0xf0, 0xfc, 0xf4, 0xfa, 0xf2, 0xfe, 0xf6, 0xf9,
+	0xf1, 0xfd, 0xf5, 0xfb, 0xf3, 0x27, 0x38, 0x10, 0x14, 0xf6, 0x37, 0x24, 0x34, 0x32, 0x2a, 0x3c,
+	0x22, 0x36, 0x2e, 0x3a, 0x26, 0x31, 0x29, 0x3e, 0x21, 0x35, 0x2d, 0x39, 0x25, 0x33, 0x2b, 0x3d,
+	0x23, 0xf7, 0x5f, 0x76, 0x4e, 0x41, 0x61, 0x5e, 0x7e, 0x49, 0x69, 0x51, 0x71, 0x45, 0x65, 0x59,
+	0x79, 0x4d, 0x6d, 0x55, 0x75, 0x43, 0x63, 0x5d, 0x7d, 0x4b, 0x6b, 0x53, 0x73, 0x47, 0x67, 0x5b,
+	0x7b, 0x4f, 0x6f, 0x57, 0xf7, 0xc0, 0x60, 0x5f, 0xff, 0xc8, 0xe8, 0xd0, 0xf0, 0xc4, 0xe4, 0xd8,
+	0xf8, 0xcc, 0xec, 0xd4, 0xf4, 0xc2, 0xe2, 0xdc, 0xfc, 0xca, 0xea, 0xd2, 0xf2, 0xc6, 0xe6, 0xda,
+	0xfa, 0xce, 0xee, 0xd6, 0xf6, 0xc1, 0xe1, 0xde, 0xfe, 0xc9, 0xe9, 0xd1, 0xf1, 0xc5, 0xe5, 0xd9,
+	0xf9, 0xcd, 0xed, 0xd5, 0xf5, 0xc3, 0xe3, 0xdd, 0xfd, 0xcb, 0xeb, 0xd3, 0xf3, 0xc7, 0xe7, 0xdb,
+	0xfb, 0xcf, 0xef, 0xd7, 0x77, 0xf0, 0x9f, 0xa0, 0xc0, 0xdf, 0xb0, 0xd0, 0x90, 0xa8, 0xc8, 0x88,
+	0xf0, 0xb8, 0xd8, 0x98, 0xe8, 0xa4, 0xc4, 0x84, 0xf8, 0xb4, 0xd4, 0x94, 0xe4, 0xac, 0xcc, 0x8c,
+	0xf4, 0x7f, 0xb9, 0x39, 0xd9, 0x85, 0x05, 0xf9, 0x79, 0xa5, 0x25, 0xc5, 0x45, 0x95, 0x15, 0xe5,
+	0x65, 0xb5, 0x35, 0xd5, 0x55, 0x8d, 0x0d, 0xf5, 0x75, 0xad, 0x2d, 0xcd, 0x4d, 0x9d, 0x1d, 0xed,
+	0x6d, 0xbd, 0x3d, 0xdd, 0x5d, 0x83, 0x03, 0xfd, 0x7d, 0xa3, 0x23, 0xc3, 0x43, 0x93, 0x13, 0xe3,
+	0x63, 0xb3, 0x33, 0xd3, 0x53, 0x8b, 0x0b, 0xf3, 0x73, 0xab, 0x2b, 0xcb, 0x4b, 0x9b, 0x1b, 0xeb,
+	0x6b, 0xbb, 0x3b, 0xdb, 0x5b, 0x87, 0x07, 0xfb, 0x7b, 0xa7, 0x27, 0xc7, 0x47, 0x97, 0x17, 0xe7,
+	0x67, 0xb7, 0x37, 0xd7, 0x57, 0x8f, 0x0f, 0xf7, 0x77, 0xaf, 0x2f, 0xcf, 0x4f, 0x9f, 0x1f, 0xef,
+	0x6f, 0xbf, 0x3f, 0xdf, 0x5f, 0x36, 0xfb, 0xc0, 0xff, 0x30, 0x60, 0xb3, 0x37, 0x0c, 0xd8, 0xec,
+	0x0d, 0x03, 0x36, 0x7b, 0xc3, 0x80, 0xcd, 0xde, 0x30, 0x60, 0xb3, 0x37, 0x0c, 0xd8, 0xec, 0x0d,
+	0x03, 0x36, 0x7b, 0xc3, 0x80, 0xcd, 0xde, 0x30, 0x60, 0xb3, 0x37, 0x0c, 0xd8, 0xec, 0x0d, 0x03,
+	0x36, 0x7b, 0xc3, 0x80, 0xcd, 0xde, 0x30, 0x60, 0xb3, 0x37, 0x0c, 0xd8, 0xec, 0x0d, 0x03, 0x36,
+	0x7b, 0xc3, 0x80, 0xcd, 0xde, 0x30, 0x60, 0xb3, 0x37, 0x0c, 0xd8, 0xec, 0x0d, 0x03, 0x36, 0x7b,
+	0xc3, 0x80, 0xcd, 0xde, 0x30, 0x60, 0xb3, 0x37, 0x0c, 0xd8, 0xec, 0x0d, 0x03, 0x36, 0x7b, 0xc3,
+	0x80, 0xcd, 0xde, 0x30, 0x60, 0xb3, 0x37, 0x0c, 0xd8, 0xec, 0x0d, 0x03, 0x36, 0x7b, 0xc3, 0x80,
+	0xcd, 0xde, 0x30, 0x60, 0xb3, 0x37, 0x0c, 0xd8, 0xec, 0x0d, 0x03, 0x36, 0x7b, 0xc3, 0x80, 0xcd,
+	0xde, 0x30, 0x60, 0xb3, 0x37, 0x0c, 0xd8, 0xec, 0x0d, 0x03, 0x36, 0x7b, 0xc3, 0x80, 0xcd, 0xde,
+	0x30, 0x60, 0xb3, 0x37, 0x0c, 0xd8, 0xec, 0x0d, 0x03, 0x36, 0x7b, 0xc3, 0x80, 0xcd, 0xde, 0x30,
+	0x60, 0xb3, 0x37, 0x0c, 0xd8, 0xec, 0x0d, 0x03, 0x36, 0x7b, 0xc3, 0x80, 0xcd, 0xde, 0x30, 0x60,
+	0xb3, 0x37, 0x0c, 0xd8, 0xec, 0x0d, 0x03, 0x36, 0x7b, 0xc3, 0x80, 0xcd, 0xde, 0x30, 0x60, 0xb3,
+	0x37, 0x0c, 0xd8, 0xec, 0x0d, 0x03, 0x36, 0x7b, 0xc3, 0x80, 0xcd, 0xde, 0x30, 0x60, 0xb3, 0x37,
+	0x0c, 0xd8, 0xec, 0x0d, 0x03, 0x36, 0x7b, 0xc3, 0x80, 0xcd, 0xde, 0x30, 0x60, 0xb3, 0x37, 0x0c,
+	0xd8, 0xec, 0x0d, 0x03, 0x36, 0x7b, 0xc3, 0x80, 0xcd, 0xde, 0x30, 0x60, 0xb3, 0x37, 0x0c, 0xd8,
+	0xec, 0x0d, 0x03, 0x36, 0x7b, 0xc3, 0x80, 0xf3, 0x3e, 0xf0, 0xff, 0x3d, 0xe0, 0xbc, 0xf7, 0x3d,
+	0xe0, 0xbc, 0xf7, 0x3d, 0xe0, 0xbc, 0xf7, 0x3d, 0xe0, 0xbc, 0xf7, 0x3d, 0xe0, 0xbc, 0xf7, 0x3d,
+	0xe0, 0xbc, 0xf7, 0x3d, 0xe0, 0xbc, 0xf7, 0x3d, 0xe0, 0xbc, 0xf7, 0x3d, 0xe0, 0xbc, 0xf7, 0x3d,
+	0xe0, 0xbc, 0xf7, 0x3d, 0xe0, 0xbc, 0xf7, 0x3d, 0xe0, 0xbc, 0xf7, 0x3d, 0xe0, 0xbc, 0xf7, 0x3d,
+	0xe0, 0xbc, 0xf7, 0x3d, 0xe0, 0xbc, 0xf7, 0x3d, 0xe0, 0xbc, 0xf7, 0x3d, 0xe0, 0xbc, 0xf7, 0x3d,
+	0xe0, 0xbc, 0xf7, 0x3d, 0xe0, 0xbc, 0xf7, 0x3d, 0xe0, 0xbc, 0xf7, 0x3d, 0xe0, 0xbc, 0xf7, 0x3d,
+	0xe0, 0xbc, 0xf7, 0x3d, 0xe0, 0xbc, 0xf7, 0x3d, 0xe0, 0xbc, 0xf7, 0x3d, 0xe0, 0xbc, 0xf7, 0x3d,
+	0xe0, 0xbc, 0xf7, 0x3d, 0xe0, 0xbc, 0xf7, 0x3d, 0xe0, 0xbc, 0xf7, 0x3d, 0xe0, 0xbc, 0xf7, 0x3d,
+	0xe0, 0xbc, 0xf7, 0x3d, 0xe0, 0xbc, 0xf7, 0x3d, 0xe0, 0xbc, 0xf7, 0x3d, 0xe0, 0xbc, 0xf7, 0x3d,
+	0xe0, 0xbc, 0xf7, 0x3d, 0xe0, 0xbc, 0xf7, 0x3d, 0xe0, 0xbc, 0xf7, 0x3d, 0xe0, 0xbc, 0xf7, 0x3d,
+	0xe0, 0xbc, 0xf7, 0x3d, 0xe0, 0xbc, 0xf7, 0x3d, 0xe0, 0xbc, 0xf7, 0x3d, 0xe0, 0xbc, 0xf7, 0x3d,
+	0xe0, 0xbc, 0xf7, 0x3d, 0xe0, 0xbc, 0xf7, 0x3d, 0xe0, 0xbc, 0xf7, 0x3d, 0xe0, 0xbc, 0xf7, 0x3d,
+	0xe0, 0xbc, 0xf7, 0x3d, 0xe0, 0xbc, 0xf7, 0x3d, 0xe0, 0xbc, 0xf7, 0x3d, 0xe0, 0xbc, 0xf7, 0x3d,
+	0xe0, 0xbc, 0xf7, 0x3d, 0xe0, 0xbc, 0xf7, 0x3d, 0xe0, 0xbc, 0xf7, 0x3d, 0xe0, 0xbc, 0xf7, 0x3d,
+	0xe0, 0xbc, 0xf7, 0x3d, 0xe0, 0xbc, 0xf7, 0x3d, 0xe0, 0xbc, 0xf7, 0x3d, 0xe0, 0xbc, 0xf7, 0x3d,
+	0xe0, 0xbc, 0xf7, 0x3d, 0xe0, 0xbc, 0xf7, 0x3d, 0xe0, 0xbc, 0xf7, 0x3d, 0xe0, 0xbc, 0xf7, 0x3d,
+	0xe0, 0xbc, 0xf7, 0x3d, 0xe0, 0xbc, 0xf7, 0x3d, 0x80, 0xf7, 0x3e, 0x00, 0x7a, 0x00, 0xef, 0x3d,
+	0xea, 0x01, 0xbc, 0xf7, 0xa8, 0x07, 0xf0, 0xde, 0xa3, 0x1e, 0xc0, 0x7b, 0x8f, 0x7a, 0x00, 0xef,
+	0x3d, 0xea, 0x01, 0xbc, 0xf7, 0xa8, 0x07, 0xf0, 0xde, 0xa3, 0x1e, 0xc0, 0x7b, 0x8f, 0x7a, 0x00,
+	0xef, 0x3d, 0xea, 0x01, 0xbc, 0xf7, 0xa8, 0x07, 0xf0, 0xde, 0xa3, 0x1e, 0xc0, 0x7b, 0x8f, 0x7a,
+	0x00, 0xef, 0x3d, 0xea, 0x01, 0xbc, 0xf7, 0xa8, 0x07, 0xf0, 0xde, 0xa3, 0x1e, 0xc0, 0x7b, 0x8f,
+	0x7a, 0x00, 0xef, 0x3d, 0xea, 0x01, 0xbc, 0xf7, 0xa8, 0x07, 0xf0, 0xde, 0xa3, 0x1e, 0xc0, 0x7b,
+	0x8f, 0x7a, 0x00, 0xef, 0x3d, 0xea, 0x01, 0xbc, 0xf7, 0xa8, 0x07, 0xf0, 0xde, 0xa3, 0x1e, 0xc0,
+	0x7b, 0x8f, 0x7a, 0x00, 0xef, 0x3d, 0xea, 0x01, 0xbc, 0xf7, 0xa8, 0x07, 0xf0, 0xde, 0xa3, 0x1e,
+	0xc0, 0x7b, 0x8f, 0x7a, 0x00, 0xef, 0x3d, 0xea, 0x01, 0xbc, 0xf7, 0xa8, 0x07, 0xf0, 0xde, 0xa3,
+	0x1e, 0xc0, 0x7b, 0x8f, 0x7a, 0x00, 0xef, 0x3d, 0xea, 0x01, 0xbc, 0xf7, 0xa8, 0x07, 0xf0, 0xde,
+	0xa3, 0x1e, 0xc0, 0x7b, 0x8f, 0x7a, 0x00, 0xef, 0x3d, 0xea, 0x01, 0xbc, 0xf7, 0xa8, 0x07, 0xf0,
+	0xde, 0xa3, 0x1e, 0xc0, 0x7b, 0x8f, 0x7a, 0x00, 0xef, 0x3d, 0xea, 0x01, 0xbc, 0xf7, 0xa8, 0x07,
+	0xf0, 0xde, 0xa3, 0x1e, 0xc0, 0x7b, 0x8f, 0x7a, 0x00, 0xef, 0x3d, 0xea, 0x01, 0xbc, 0xf7, 0xa8,
+	0x07, 0xf0, 0xde, 0xa3, 0x1e, 0xc0, 0x7b, 0x8f, 0x7a, 0x00, 0xef, 0x3d, 0xea, 0x01, 0xbc, 0xf7,
+	0xa8, 0x07, 0xf0, 0xde, 0xa3, 0x1e, 0xc0, 0x7b, 0x8f, 0x7a, 0x00, 0xef, 0x3d, 0xea, 0x01, 0xbc,
+	0xf7, 0xa8, 0x07, 0xf0, 0xde, 0xa3, 0x1e, 0xc0, 0x7b, 0x8f, 0x7a, 0x00, 0xef, 0x3d, 0xea, 0x01,
+	0xbc, 0xf7, 0xa8, 0x07, 0xf0, 0xde, 0xa3, 0x1e, 0xc0, 0x7b, 0x8f, 0x7a, 0x00, 0xef, 0x3d, 0xea,
+	0x01, 0xbc, 0xf7, 0xa8, 0x07, 0xf0, 0xde, 0xa3, 0x1e, 0x60, 0xfe, 0x3e, 0x40, 0xf2, 0x01, 0xe6,
+	0xef, 0x59, 0x3e, 0xc0, 0xfc, 0x3d, 0xcb, 0x07, 0x98, 0xbf, 0x67, 0xf9, 0x00, 0xf3, 0xf7, 0x2c,
+	0x1f, 0x60, 0xfe, 0x9e, 0xe5, 0x03, 0xcc, 0xdf, 0xb3, 0x7c, 0x80, 0xf9, 0x7b, 0x96, 0x0f, 0x30,
+	0x7f, 0xcf, 0xf2, 0x01, 0xe6, 0xef, 0x59, 0x3e, 0xc0, 0xfc, 0x3d, 0xcb, 0x07, 0x98, 0xbf, 0x67,
+	0xf9, 0x00, 0xf3, 0xf7, 0x2c, 0x1f, 0x60, 0xfe, 0x9e, 0xe5, 0x03, 0xcc, 0xdf, 0xb3, 0x7c, 0x80,
+	0xf9, 0x7b, 0x96, 0x0f, 0x30, 0x7f, 0xcf, 0xf2, 0x01, 0xe6, 0xef, 0x59, 0x3e, 0xc0, 0xfc, 0x3d,
+	0xcb, 0x07, 0x98, 0xbf, 0x67, 0xf9, 0x00, 0xf3, 0xf7, 0x2c, 0x1f, 0x60, 0xfe, 0x9e, 0xe5, 0x03,
+	0xcc, 0xdf, 0xb3, 0x7c, 0x80, 0xf9, 0x7b, 0x96, 0x0f, 0x30, 0x7f, 0xcf, 0xf2, 0x01, 0xe6, 0xef,
+	0x59, 0x3e, 0xc0, 0xfc, 0x3d, 0xcb, 0x07, 0x98, 0xbf, 0x67, 0xf9, 0x00, 0xf3, 0xf7, 0x2c, 0x1f,
+	0x60, 0xfe, 0x9e, 0xe5, 0x03, 0xcc, 0xdf, 0xb3, 0x7c, 0x80, 0xf9, 0x7b, 0x96, 0x0f, 0x30, 0x7f,
+	0xcf, 0xf2, 0x01, 0xe6, 0xef, 0x59, 0x3e, 0xc0, 0xfc, 0x3d, 0xcb, 0x07, 0x98, 0xbf, 0x67, 0xf9,
+	0x00, 0xf3, 0xf7, 0x2c, 0x1f, 0x60, 0xfe, 0x9e, 0xe5, 0x03, 0xcc, 0xdf, 0xb3, 0x7c, 0x80, 0xf9,
+	0x7b, 0x96, 0x0f, 0x30, 0x7f, 0xcf, 0xf2, 0x01, 0xe6, 0xef, 0x59, 0x3e, 0xc0, 0xfc, 0x3d, 0xcb,
+	0x07, 0x98, 0xbf, 0x67, 0xf9, 0x00, 0xf3, 0xf7, 0x2c, 0x1f, 0x60, 0xfe, 0x9e, 0xe5, 0x03, 0xcc,
+	0xdf, 0xb3, 0x7c, 0x80, 0xf9, 0x7b, 0x96, 0x0f, 0x30, 0x7f, 0xcf, 0xf2, 0x01, 0xe6, 0xef, 0x59,
+	0x3e, 0xc0, 0xfc, 0x3d, 0xcb, 0x07, 0x98, 0xbf, 0x67, 0xf9, 0x00, 0xf3, 0xf7, 0x2c, 0x1f, 0x60,
+	0xfe, 0x9e, 0xe5, 0x03, 0xcc, 0xdf, 0xb3, 0x7c, 0x80, 0xf9, 0x7b, 0x96, 0x0f, 0x30, 0x7f, 0xcf,
+	0xf2, 0x01, 0xe6, 0xef, 0x59, 0x3e, 0xc0, 0xfc, 0x3d, 0xcb, 0x07, 0x98, 0xbf, 0x67, 0xf9, 0x00,
+	0xf3, 0xf7, 0x2c, 0x1f, 0x60, 0xfe, 0x9e, 0xe5, 0x03, 0xcc, 0xdf, 0xb3, 0x7c, 0x80, 0xf9, 0x7b,
+	0x96, 0x0f, 0xa8, 0xfd, 0x7d, 0x40, 0xfc, 0x1f, 0x50, 0xfb, 0x7b, 0xf5, 0x7f, 0x40, 0xed, 0xef,
+	0xd5, 0xff, 0x01, 0xb5, 0xbf, 0x57, 0xff, 0x07, 0xd4, 0xfe, 0x5e, 0xfd, 0x1f, 0x50, 0xfb, 0x7b,
+	0xf5, 0x7f, 0x40, 0xed, 0xef, 0xd5, 0xff, 0x01, 0xb5, 0xbf, 0x57, 0xff, 0x07, 0xd4, 0xfe, 0x5e,
+	0xfd, 0x1f, 0x50, 0xfb, 0x7b, 0xf5, 0x7f, 0x40, 0xed, 0xef, 0xd5, 0xff, 0x01, 0xb5, 0xbf, 0x57,
+	0xff, 0x07, 0xd4, 0xfe, 0x5e, 0xfd, 0x1f, 0x50, 0xfb, 0x7b, 0xf5, 0x7f, 0x40, 0xed, 0xef, 0xd5,
+	0xff, 0x01, 0xb5, 0xbf, 0x57, 0xff, 0x07, 0xd4, 0xfe, 0x5e, 0xfd, 0x1f, 0x50, 0xfb, 0x7b, 0xf5,
+	0x7f, 0x40, 0xed, 0xef, 0xd5, 0xff, 0x01, 0xb5, 0xbf, 0x57, 0xff, 0x07, 0xd4, 0xfe, 0x5e, 0xfd,
+	0x1f, 0x50, 0xfb, 0x7b, 0xf5, 0x7f, 0x40, 0xed, 0xef, 0xd5, 0xff, 0x01, 0xb5, 0xbf, 0x57, 0xff,
+	0x07, 0xd4, 0xfe, 0x5e, 0xfd, 0x1f, 0x50, 0xfb, 0x7b, 0xf5, 0x7f, 0x40, 0xed, 0xef, 0xd5, 0xff,
+	0x01, 0xb5, 0xbf, 0x57, 0xff, 0x07, 0xd4, 0xfe, 0x5e, 0xfd, 0x1f, 0x50, 0xfb, 0x7b, 0xf5, 0x7f,
+	0x40, 0xed, 0xef, 0xd5, 0xff, 0x01, 0xb5, 0xbf, 0x57, 0xff, 0x07, 0xd4, 0xfe, 0x5e, 0xfd, 0x1f,
+	0x50, 0xfb, 0x7b, 0xf5, 0x7f, 0x40, 0xed, 0xef, 0xd5, 0xff, 0x01, 0xb5, 0xbf, 0x57, 0xff, 0x07,
+	0xd4, 0xfe, 0x5e, 0xfd, 0x1f, 0x50, 0xfb, 0x7b, 0xf5, 0x7f, 0x40, 0xed, 0xef, 0xd5, 0xff, 0x01,
+	0xb5, 0xbf, 0x57, 0xff, 0x07, 0xd4, 0xfe, 0x5e, 0xfd, 0x1f, 0x50, 0xfb, 0x7b, 0xf5, 0x7f, 0x40,
+	0xed, 0xef, 0xd5, 0xff, 0x01, 0xb5, 0xbf, 0x57, 0xff, 0x07, 0xd4, 0xfe, 0x5e, 0xfd, 0x1f, 0x50,
+	0xfb, 0x7b, 0xf5, 0x7f, 0x40, 0xed, 0xef, 0xd5, 0xff, 0x01, 0xb5, 0xbf, 0x57, 0xff, 0x07, 0xd4,
+	0xfe, 0x5e, 0xfd, 0x1f, 0x50, 0xfb, 0x7b, 0xf5, 0x7f, 0x40, 0xed, 0xef, 0xd5, 0xff, 0x01, 0xb5,
+	0xbf, 0x57, 0xff, 0x07, 0xd4, 0xfe, 0x5e, 0xfd, 0x1f, 0x50, 0xfb, 0x7b, 0xf5, 0x7f, 0x40, 0xed,
+	0xef, 0xd5, 0xff, 0x01, 0xb5, 0xbf, 0x57, 0xff, 0x07, 0xd4, 0xfe, 0x5e, 0xfd, 0x1f, 0x50, 0xfb,
+	0x7b, 0xf5, 0x7f, 0x40, 0xed, 0xef, 0xd5, 0xff, 0x01, 0xb5, 0xbf, 0x57, 0xff, 0x07, 0xd4, 0xfe,
+	0x5e, 0xfd, 0x1f, 0x50, 0xfb, 0x7b, 0xf5, 0x7f, 0x40, 0xed, 0xef, 0xd5, 0xff, 0x01, 0xb5, 0xbf,
+	0x57, 0xff, 0x07, 0xfe, 0x03, 0xf6, 0x2b, 0xe0, 0xe2,
+};
+
+/* Throughput is printed with two decimals, tinyprintf has no floating point */
+static void benchPrintRate(const char *name, uint32_t bytes, uint32_t elapsed)
+{
+	uint32_t rate = elapsed ? (uint32_t)((uint64_t)bytes * 1000 / elapsed) : 0;
+	PR_INFO("BENCH %s: %lu.%02lu MB/s (%lu bytes in %lu ms)\n", name,
+		(unsigned long)(rate / 1000000), (unsigned long)((rate / 10000) % 100),
+		(unsigned long)bytes, (unsigned long)elapsed);
+}
+
+static void benchSpi(EVE_HalContext *phost)
+{
+	static const char *const s_ModeNames[] = { "SPI 1-bit", "SPI 2-bit", "SPI 4-bit" };
+	EVE_SPI_CHANNELS_T bootChannels = phost->SpiChannels;
+	uint8_t dummyBytes = phost->SpiDummyBytes;
+	char name[24];
+
+	memset(s_BenchBuffer, 0xA5, sizeof(s_BenchBuffer));
+
+	/* Only the widths up to the one selected at boot are known to be wired */
+	for (int mode = EVE_SPI_SINGLE_CHANNEL; mode <= (int)bootChannels; mode++) {
+		uint32_t start;
+
+		EVE_Hal_setSPI(phost, (EVE_SPI_CHANNELS_T)mode, dummyBytes);
+		if (EVE_Hal_rd8(phost, REG_ID) != 0x7C) {
+			PR_WARN("BENCH %s: link check fail\n", s_ModeNames[mode]);
+			continue;
+		}
+
+		start = EVE_millis();
+		for (uint32_t done = 0; done < BENCH_SPI_SIZE; done += BENCH_CHUNK)
+			EVE_Hal_wrMem(phost, RAM_G + (done % BENCH_UPLOAD_SIZE), s_BenchBuffer, BENCH_CHUNK);
+		EVE_Hal_flush(phost);
+		strcpy(name, s_ModeNames[mode]);
+		strcat(name, " write");
+		benchPrintRate(name, BENCH_SPI_SIZE, EVE_millis() - start);
+
+		start = EVE_millis();
+		for (uint32_t done = 0; done < BENCH_SPI_SIZE; done += BENCH_CHUNK)
+			EVE_Hal_rdMem(phost, s_BenchBuffer, RAM_G + (done % BENCH_UPLOAD_SIZE), BENCH_CHUNK);
+		strcpy(name, s_ModeNames[mode]);
+		strcat(name, " read");
+		benchPrintRate(name, BENCH_SPI_SIZE, EVE_millis() - start);
+	}
+
+	EVE_Hal_setSPI(phost, bootChannels, dummyBytes);
+}
+
+static void benchSd(void)
+{
+	FIL file;
+	UINT count;
+	uint32_t start;
+	uint32_t seed = 0x12345678;
+	uint32_t bytes = 0;
+
+	if (!sdCardReady()) {
+		PR_WARN("BENCH SD card not mounted, skipped\n");
+		return;
+	}
+
+	/* Create the file once, later runs read the same clusters */
+	if (f_open(&file, BENCH_SD_FILE, FA_READ | FA_OPEN_EXISTING) != FR_OK || f_size(&file) < BENCH_SD_SIZE) {
+		f_close(&file);
+		if (f_open(&file, BENCH_SD_FILE, FA_WRITE | FA_CREATE_ALWAYS) != FR_OK) {
+			PR_WARN("BENCH unable to create %s\n", BENCH_SD_FILE);
+			return;
+		}
+		for (uint32_t done = 0; done < BENCH_SD_SIZE; done += BENCH_CHUNK) {
+			memset(s_BenchBuffer, (int)(done / BENCH_CHUNK), BENCH_CHUNK);
+			if (f_write(&file, s_BenchBuffer, BENCH_CHUNK, &count) != FR_OK || count != BENCH_CHUNK)
+				break;
+		}
+		f_close(&file);
+		if (f_open(&file, BENCH_SD_FILE, FA_READ | FA_OPEN_EXISTING) != FR_OK) {
+			PR_WARN("BENCH unable to open %s\n", BENCH_SD_FILE);
+			return;
+		}
+	}
+
+	start = EVE_millis();
+	while (f_read(&file, s_BenchBuffer, BENCH_CHUNK, &count) == FR_OK && count) {
+		bytes += count;
+	}
+	benchPrintRate("SD sequential read", bytes, EVE_millis() - start);
+
+	/* Single sectors at random aligned offsets, each read costs a seek */
+	bytes = 0;
+	start = EVE_millis();
+	for (int i = 0; i < BENCH_SD_RANDOM_READS; i++) {
+		seed = seed * 1664525UL + 1013904223UL;
+		if (f_lseek(&file, ((seed >> 8) % (BENCH_SD_SIZE / 512)) * 512) != FR_OK
+			|| f_read(&file, s_BenchBuffer, 512, &count) != FR_OK)
+			break;
+		bytes += count;
+	}
+	benchPrintRate("SD random 512 byte read", bytes, EVE_millis() - start);
+
+	f_close(&file);
+}
+
+static void benchCmd(EVE_HalContext *phost)
+{
+	uint32_t words = BENCH_CMD_BATCH * BENCH_CMD_BATCHES;
+	uint32_t start;
+	uint32_t elapsed;
+
+	start = EVE_millis();
+	for (int i = 0; i < BENCH_CMD_BATCHES; i++) {
+		EVE_CoCmd_dlStart(phost);
+		for (int j = 0; j < BENCH_CMD_BATCH; j++)
+			EVE_Cmd_wr32(phost, NOP());
+	}
+	EVE_Cmd_waitFlush(phost);
+	elapsed = EVE_millis() - start;
+	PR_INFO("BENCH EVE_Cmd_wr32: %lu ops/s (%lu words in %lu ms)\n",
+		(unsigned long)(elapsed ? ((uint64_t)words * 1000 / elapsed) : 0),
+		(unsigned long)words, (unsigned long)elapsed);
+}
+
+static void benchInflate(EVE_HalContext *phost)
+{
+	uint32_t start = EVE_millis();
+
+	for (int i = 0; i < BENCH_INFLATE_ITERATIONS; i++) {
+		if (!EVE_CoCmd_inflate_progMem(phost, RAM_G, s_BenchInflate, sizeof(s_BenchInflate)))
+			break;
+	}
+	EVE_Cmd_waitFlush(phost);
+	/* Reported as inflated bytes, the compressed input is about one eighth */
+	benchPrintRate("CMD_INFLATE output", BENCH_INFLATE_RAW_SIZE * BENCH_INFLATE_ITERATIONS, EVE_millis() - start);
+}
+
+static void benchUpload(EVE_HalContext *phost)
+{
+	uint32_t start;
+
+	memset(s_BenchBuffer, 0x5A, sizeof(s_BenchBuffer));
+	start = EVE_millis();
+	EVE_Hal_startTransfer(phost, EVE_TRANSFER_WRITE, RAM_G);
+	for (uint32_t done = 0; done < BENCH_UPLOAD_SIZE; done += BENCH_CHUNK)
+		EVE_Hal_transferMem(phost, NULL, s_BenchBuffer, BENCH_CHUNK);
+	EVE_Hal_endTransfer(phost);
+	EVE_Hal_flush(phost);
+	PR_INFO("BENCH RAM_G upload 150 KB: %lu ms\n", (unsigned long)(EVE_millis() - start));
+}
+
+/* Reference screen, a gradient, a few widgets and a page of text */
+static void benchScreen(EVE_HalContext *phost, int frame)
+{
+	EVE_CoCmd_dlStart(phost);
+	EVE_CoDl_clearColorRgb(phost, 0, 0, 0);
+	EVE_CoDl_clear(phost, 1, 1, 1);
+	EVE_CoCmd_gradient(phost, 0, 0, 0x002040, 0, phost->Height, 0x4080C0);
+	EVE_CoDl_colorRgb(phost, 0xFF, 0xFF, 0xFF);
+	for (int line = 0; line < 10; line++)
+		EVE_CoCmd_text(phost, 8, 8 + line * 20, 26, 0, "The quick brown fox jumps over the lazy dog 0123456789");
+	EVE_CoCmd_button(phost, 8, phost->Height - 56, 120, 48, 28, 0, "Button");
+	EVE_CoCmd_progress(phost, 140, phost->Height - 40, phost->Width - 160, 16, 0, frame % 100, 100);
+	EVE_CoCmd_gauge(phost, phost->Width - 60, 60, 50, 0, 10, 5, frame % 100, 100);
+	EVE_CoDl_display(phost);
+	EVE_CoCmd_swap(phost);
+}
+
+static void benchFrame(EVE_HalContext *phost)
+{
+	uint32_t frames = EVE_Hal_rd32(phost, REG_FRAMES);
+	uint32_t start = EVE_millis();
+	uint32_t elapsed;
+
+	/* Each CMD_DLSTART waits for the previous swap, so the loop runs at the displayed frame rate */
+	for (int i = 0; i < BENCH_FRAMES; i++) {
+		benchScreen(phost, i);
+		EVE_Cmd_waitFlush(phost);
+	}
+	elapsed = EVE_millis() - start;
+	frames = EVE_Hal_rd32(phost, REG_FRAMES) - frames;
+	PR_INFO("BENCH reference screen: %lu.%02lu ms/frame (%lu frames in %lu ms, %lu scanned out)\n",
+		(unsigned long)(elapsed / BENCH_FRAMES), (unsigned long)((elapsed * 100 / BENCH_FRAMES) % 100),
+		(unsigned long)BENCH_FRAMES, (unsigned long)elapsed, (unsigned long)frames);
+}
+
+void bsp_bench(void)
+{
+	EVE_HalContext *phost = Eve_Host();
+
+	PR_INFO("BENCH start\n");
+	benchSd();
+	if (phost) {
+		benchSpi(phost);
+		benchCmd(phost);
+		benchInflate(phost);
+		benchUpload(phost);
+		benchFrame(phost);
+		Eve_Benchmark_ProgMem();
+	}
+	else {
+		PR_WARN("BENCH EVE not initialised, skipped\n");
+	}
+	PR_INFO("BENCH done\n");
+}
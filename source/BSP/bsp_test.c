@@ -35,6 +35,15 @@
 #include "sdcard.h"
 #include "rotary.h"
 #include "max31725.h"
+#include "rs485.h"
+#include "modbus.h"
+#include "timesync.h"
+#include "filecast.h"
+#include "scheduler.h"
+#include "sdlog.h"
+#include "usbdbg_upload.h"
+#include "usbmsc.h"
+#include "bsp_bench.h"
 
 #define SW_BUILDDATE_STR __DATE__
 #define SW_BUILDTIME_STR __TIME__
@@ -46,23 +55,280 @@
 #define ENABLE_LED      1
 #define ENABLE_ROTARY   1
 #define ENABLE_TEMP     1
+#define ENABLE_RS485    1
+#define ENABLE_MODBUS   1
+/* Shared clock for display walls, the station on rotary position 0 is the master */
+#define ENABLE_TIMESYNC 1
+/* Files uploaded to the master over USB are passed on to every station */
+#define ENABLE_FILECAST 1
+#define ENABLE_SDLOG    1
+#define ENABLE_UPLOAD   1
+/* USB stick on the host port as a second asset volume, for boards with the host connector fitted */
+#define ENABLE_USBMSC   0
+/* Benchmark build, set ENABLE_BENCH to one in the project symbols to print the bsp_bench results at boot */
+#ifndef ENABLE_BENCH
+#define ENABLE_BENCH    0
+#endif
+
+/* Touch calibration record on the SD card, recalibrate by holding the screen during power-on */
+#define CALIB_FILE_NAME "calib.bin"
+#define CALIB_MAGIC     0x42494C43 /* "CLIB" */
+
+/* Process value log on the SD card, one record per sample, preallocated on the first boot */
+#define LOG_FILE_NAME "log.bin"
+#define LOG_CAPACITY  (4UL * 1024 * 1024)
+#define LOG_SAMPLE_MS 1000
+#define LOG_SYNC_MS   10000
+
+/* Time the host needs to open the CDC port after enumeration, overlapped with the peripheral init */
+#define BOOT_USB_SETTLE_MS 1000
+
+/* Board temperature refresh, read in the background */
+#define TEMP_SAMPLE_MS 1000
+
+/* Background task periods */
+#define TEMP_TASK_MS   10
+#define USBDBG_TASK_MS 10
+#define SOUND_TASK_MS  5
+#define SDLOG_TASK_MS  20
+#define USBMSC_TASK_MS 10
+#define TIMESYNC_TASK_MS 10
+
+#define RS485_BAUD 115200
+/* Station address is the rotary ID switch position plus this base, address 0 is the broadcast */
+#define MODBUS_ADDRESS_BASE 1
+/* Stations sent each file, at rotary positions 1 onwards */
+#define FILECAST_STATIONS 15
+
+#if ENABLE_RS485 && ENABLE_MODBUS
+/* Holding registers, widgets bind to the same variables */
+static volatile uint16_t mb_temperature; /* 1/256 deg C */
+static volatile uint16_t mb_setpoint;
+
+static const modbus_register_t mb_registers[] = {
+	{ 0, &mb_temperature, false },
+	{ 1, &mb_setpoint, true },
+};
+
+static const modbus_config_t mb_config = {
+	MODBUS_ADDRESS_BASE,
+	mb_registers,
+	sizeof(mb_registers) / sizeof(mb_registers[0]),
+	NULL,
+	EVE_millis,
+};
+#endif
 
 void init_bsp(void);
+#if ENABLE_EVE
+static void calibrate(void);
+#endif
+#if ENABLE_EVE
+#if ENABLE_SD
+typedef struct CalibRecord
+{
+	uint32_t Magic;
+	uint32_t Transform[6];
+	uint32_t Checksum;
+} CalibRecord;
+
+static uint32_t calibChecksum(const CalibRecord *record)
+{
+	uint32_t sum = record->Magic;
+	for (int i = 0; i < 6; i++)
+		sum = ((sum << 1) | (sum >> 31)) + record->Transform[i];
+	return ~sum;
+}
+#endif
+
+/* Restore the stored touch transform, only ask for a tap when there is none or a recalibration is requested */
+static void calibrate(void)
+{
+#if ENABLE_SD
+	CalibRecord record;
+
+	if (Eve_Touched()) {
+		PR_INFO("Touch held during power-on, recalibrating\n");
+	}
+	else if (readFile((uint8_t *)&record, sizeof(record), CALIB_FILE_NAME) == sizeof(record)
+		&& record.Magic == CALIB_MAGIC && record.Checksum == calibChecksum(&record)) {
+		Calibration_Set(record.Transform);
+		PR_INFO("Touch calibration restored\n");
+		return;
+	}
+	else {
+		PR_WARN("No valid touch calibration stored\n");
+	}
+#endif
+
+	if (!Eve_Calibrate()) {
+		PR_WARN("Touch calibration fail\n");
+		return;
+	}
+
+#if ENABLE_SD
+	record.Magic = CALIB_MAGIC;
+	Calibration_Get(record.Transform);
+	record.Checksum = calibChecksum(&record);
+	if (writeFile((const uint8_t *)&record, sizeof(record), CALIB_FILE_NAME) != sizeof(record)) {
+		PR_WARN("Touch calibration not stored\n");
+	}
+#endif
+}
+#endif /* ENABLE_EVE */
+
 #if ENABLE_USBDBG
 void tfp_putc(void* p, char c);
 #endif
 
+/* Background work, pumped by the main loop and while EVE waits on the coprocessor */
+#if ENABLE_TEMP
+static void task_temp(void *ctx)
+{
+	(void)(ctx);
+	max31725_sampler_poll();
+#if ENABLE_RS485 && ENABLE_MODBUS
+	int16_t temp;
+	if (max31725_sample(&temp, NULL))
+		mb_temperature = (uint16_t)temp;
+#endif
+}
+#endif
+
+#if ENABLE_ROTARY
+static void task_rotary(void *ctx)
+{
+	(void)(ctx);
+	if (rotary_poll(EVE_millis())) {
+		PR_INFO("rotary ID changed to %d\n", rotary_id());
+#if ENABLE_RS485 && ENABLE_MODBUS
+		modbus_set_address(MODBUS_ADDRESS_BASE + rotary_id());
+#if ENABLE_TIMESYNC
+		timesync_set_master(rotary_id() == 0);
+#endif
+#if ENABLE_FILECAST
+		filecast_set_master(rotary_id() == 0);
+#endif
+#endif
+	}
+}
+#endif
+
+#if ENABLE_RS485 && ENABLE_MODBUS
+static void task_modbus(void *ctx)
+{
+	(void)(ctx);
+	modbus_poll();
+}
+#endif
+
+#if ENABLE_RS485 && ENABLE_MODBUS && ENABLE_FILECAST && ENABLE_SD && ENABLE_UPLOAD && ENABLE_USBDBG
+/* Runs when an upload ends, the transfer only starts from filecast_task. Stations do not pass files on */
+static void upload_done(const char *name, usbdbg_upload_status_t status)
+{
+	if (status != USBDBG_UPLOAD_OK)
+		return;
+	if (filecast_status() == FILECAST_BUSY)
+		PR_WARN("\"%s\" not distributed, a transfer is running\n", name);
+	else
+		filecast_send(name, MODBUS_ADDRESS_BASE + 1, FILECAST_STATIONS);
+}
+#endif
+
+#if ENABLE_SD && ENABLE_SDLOG
+typedef struct LogRecord
+{
+	uint32_t Timestamp;
+	int16_t Temperature; /* 1/256 deg C */
+	uint16_t Setpoint;
+} LogRecord;
+
+static void task_log(void *ctx)
+{
+	LogRecord record = { 0 };
+	(void)(ctx);
+	record.Timestamp = EVE_millis();
+#if ENABLE_TEMP
+	max31725_sample(&record.Temperature, NULL);
+#endif
+#if ENABLE_RS485 && ENABLE_MODBUS
+	record.Setpoint = mb_setpoint;
+#endif
+	sdlog_write(&record, sizeof(record));
+}
+#endif
+
+#if ENABLE_USBDBG
+static void task_usbdbg(void *ctx)
+{
+	(void)(ctx);
+	usbdbg_try_to_send();
+}
+#endif
+
+static void init_tasks(void)
+{
+	sched_init(EVE_millis);
+#if ENABLE_RS485 && ENABLE_MODBUS
+	sched_add(task_modbus, NULL, SCHED_EVERY_PUMP, 0);
+#endif
+#if ENABLE_RS485 && ENABLE_MODBUS && ENABLE_TIMESYNC
+	sched_add(timesync_task, NULL, TIMESYNC_TASK_MS, 0);
+#endif
+#if ENABLE_RS485 && ENABLE_MODBUS && ENABLE_FILECAST
+	/* Paces the broadcast blocks of the master, the stations write theirs from SD arbiter jobs */
+	sched_add(filecast_task, NULL, SCHED_EVERY_PUMP, 0);
+#endif
+#if ENABLE_TEMP
+	sched_add(task_temp, NULL, TEMP_TASK_MS, 1);
+#endif
+#if ENABLE_ROTARY
+	sched_add(task_rotary, NULL, ROTARY_POLL_MS, 2);
+#endif
+#if ENABLE_USBDBG
+	sched_add(task_usbdbg, NULL, USBDBG_TASK_MS, 3);
+#endif
+#if ENABLE_EVE
+	sched_add(EVE_sound_task, NULL, SOUND_TASK_MS, 4);
+#endif
+#if ENABLE_SD
+	/* Serves the queued card transfers in priority order */
+	sched_add(sdArbiterTask, NULL, SCHED_EVERY_PUMP, 7);
+#endif
+#if ENABLE_USBMSC
+	sched_add(usbmsc_task, NULL, USBMSC_TASK_MS, 8);
+#endif
+#if ENABLE_SD && ENABLE_SDLOG
+	/* Blocks are written one per run, behind the UI */
+	if (sdlog_open(LOG_FILE_NAME, LOG_CAPACITY, LOG_SYNC_MS, EVE_millis) == 0) {
+		sched_add(task_log, NULL, LOG_SAMPLE_MS, 5);
+		sched_add(sdlog_task, NULL, SDLOG_TASK_MS, 6);
+	}
+	else {
+		PR_WARN("SD log not started\n");
+	}
+#endif
+}
+
 int main()
 {
 	init_bsp();
+	init_tasks();
 
 	while (true) {
-		;
+		sched_run();
 	}
 }
 
 void init_bsp(void)
 {
+#if ENABLE_USBDBG
+	uint32_t usbSettled;
+#endif
+#if ENABLE_EVE
+	bool eveReady;
+#endif
+
 	sys_reset_all();
 
 	interrupt_enable_globally();
@@ -77,19 +343,83 @@ void init_bsp(void)
 		uart_parity_none, /* Parity */
 		uart_stop_bits_1); /* No. Stop Bits */
 
+	/* Starts the millisecond clock used to join the boot steps */
+	Gpu_Initialize();
+
 #if ENABLE_USBDBG
 	/* Init the tinyprintf module */
 	init_printf(NULL, tfp_putc);
+	usbdbg_trace_init(EVE_millis);
 	/* Initialize the USB Debugging */
 	usbdbg_init();
-	delayms(1000);
+	/* Keep the log buffered while the host settles instead of idling, it is released once everything is up */
+	usbdbg_hold(true);
+	usbSettled = EVE_millis() + BOOT_USB_SETTLE_MS;
+#if ENABLE_SD && ENABLE_UPLOAD
+	/* Asset files sent by tools/usb_upload.py are written to the card */
+	usbdbg_upload_init(EVE_millis);
+#endif
+#endif
+
+#if ENABLE_SD
+	/* Power the card early, its internal init ramps up while the other peripherals are brought up */
+	initSdHost();
+#endif
+#if ENABLE_EVE
+	/* Put the splash up first, what customers judge is the time until something is on screen */
+	eveReady = Gpu_Init();
+	if (!eveReady) {
+		PR_WARN("EVE initial fail\n");
+	}
+	else {
+		PR_INFO("EVE initialised\n");
+		if (!Eve_Splash())
+			PR_WARN("Splash not shown\n");
+	}
+#endif
+
+#if ENABLE_USBMSC
+	usbmsc_init();
 #endif
 
 	PR_INFO("\n%s\n", APP_TITLE_STR);
 	PR_INFO("Build date: %s, %s\n", SW_BUILDDATE_STR, SW_BUILDTIME_STR);
 
 #if ENABLE_ROTARY
-	PR_INFO("rotary ID %d\n", read_rotary());
+	PR_INFO("rotary ID %d\n", rotary_init());
+#endif
+
+#if ENABLE_RS485
+	if (rs485_init(RS485_BAUD) < 0) {
+		PR_ERROR("RS-485 init fail\n");
+	}
+	else {
+		PR_INFO("RS-485 opened at %ld baud\n", rs485_baud());
+#if ENABLE_MODBUS
+		modbus_init(&mb_config);
+#if ENABLE_ROTARY
+		modbus_set_address(MODBUS_ADDRESS_BASE + rotary_id());
+		PR_INFO("Modbus station %d\n", MODBUS_ADDRESS_BASE + rotary_id());
+#endif
+#if ENABLE_TIMESYNC
+#if ENABLE_ROTARY
+		timesync_init(rotary_id() == 0, EVE_millis);
+#else
+		timesync_init(false, EVE_millis);
+#endif
+#endif
+#if ENABLE_FILECAST
+#if ENABLE_ROTARY
+		filecast_init(rotary_id() == 0, EVE_millis);
+#else
+		filecast_init(false, EVE_millis);
+#endif
+#if ENABLE_SD && ENABLE_UPLOAD && ENABLE_USBDBG
+		usbdbg_upload_set_done(upload_done);
+#endif
+#endif
+#endif
+	}
 #endif
 
 #if ENABLE_LED
@@ -135,11 +465,13 @@ void init_bsp(void)
 			PR_INFO("max31725_deg_C() = %f deg_C\n", temp);
 #endif
 		}
+		if (max31725_sampler_start(TEMP_SAMPLE_MS, EVE_millis) < 0) {
+			PR_WARN("Temperature sampler not started\n");
+		}
 	}
 #endif
 
 #if ENABLE_SD
-	initSdHost();
 	if (!loadSdCard()) {
 		PR_WARN("FATFS mount fail\n");
 	}
@@ -149,15 +481,12 @@ void init_bsp(void)
 #endif /* ENABLE_SD */
 
 #if ENABLE_EVE
-	if (!Gpu_Init())
-	{
-		PR_WARN("EVE initial fail\n");
-	}
-	else {
-		PR_INFO("EVE initialised\n");
-	}
+	if (eveReady)
+		calibrate();
 
-	Eve_Calibrate();
+#if ENABLE_BENCH
+	bsp_bench();
+#endif
 #endif /* ENABLE_EVE */
 
 #if ENABLE_LED
@@ -166,6 +495,14 @@ void init_bsp(void)
 	gpio_write(RGB_LED_GREEN_GPIO, 0);
 	PR_INFO("LED green light\n");
 #endif
+
+#if ENABLE_USBDBG
+	/* Join the remaining settle time, then release the held log */
+	while ((int32_t)(usbSettled - EVE_millis()) > 0)
+		;
+	usbdbg_hold(false);
+	usbdbg_try_to_send();
+#endif
 }
 
 #if ENABLE_USBDBG
@@ -28,8 +28,41 @@ Revision History:
 
 */
 
+#include <string.h>
 #include "EVE_KD2401.h"
 
+/* Init sequence, each entry is the command, the parameter count, then the parameters.
+   KD2401_TABLE_DELAY as command waits for the given milliseconds, KD2401_TABLE_END terminates */
+#define KD2401_TABLE_DELAY 0xFF
+#define KD2401_TABLE_END 0x00
+
+static const uint8_t c_KD2401_Init[] = {
+	0xC0, 2, 0x17, 0x17,
+	0xC1, 1, 0x44,
+	0xC5, 3, 0x00, 0x3A, 0x80,
+	0x36, 1, 0x48,
+	0x3A, 1, 0x60, /* Interface Mode Control */
+	0xB1, 1, 0xA0, /* Frame rate 70HZ */
+	0xB4, 1, 0x02,
+	0xB7, 1, 0xC6,
+	0xE9, 1, 0x00,
+	0xF7, 4, 0xA9, 0x51, 0x2C, 0x82,
+	0xE0, 15, 0x01, 0x13, 0x1E, 0x00, 0x0D, 0x03, 0x3D, 0x55, 0x4F, 0x06, 0x10, 0x0B, 0x2C, 0x32, 0x0F,
+	0xE1, 15, 0x08, 0x10, 0x15, 0x03, 0x0E, 0x03, 0x32, 0x34, 0x44, 0x07, 0x10, 0x0E, 0x23, 0x2E, 0x0F,
+	0xB6, 3, 0x30, 0x02, 0x3B, /* set rgb interface mode, GS, SS */
+	0xB0, 1, 0x00, /* Interface Mode Control */
+	0x2A, 4, 0x00, 0x00, 0x01, 0x3F, /* Column address */
+	0x2B, 4, 0x00, 0x00, 0x01, 0xDF, /* Row address */
+	0x21, 0,
+	0x11, 0, /* Sleep out */
+	KD2401_TABLE_DELAY, 120,
+	0x29, 0, /* display on */
+	0x2C, 0,
+	KD2401_TABLE_END
+};
+
+#if KD2401_BITBANG
+
 void write_data(unsigned char w)
 {
 	unsigned char i;
@@ -88,10 +121,8 @@ void write_command(unsigned char y)
 	KD2401_CS_HIGH;
 }
 
-void KD2401_Bootup()
+static void KD2401_Setup()
 {
-	/* TODO - use the method exposed by EVE HAL library and panlbsp for setting the
-	 * eve and eflash into default states - mainly the CS to be high */
 	/* KD2401 driver - configure pins for bit bang */
 	gpio_function(27, pad_gpio27);
 	gpio_function(28, pad_gpio28); //cs0 for eve
@@ -109,125 +140,130 @@ void KD2401_Bootup()
 	gpio_dir(35, pad_dir_output);//gpios for eflash - ss3#
 	gpio_dir(1, pad_dir_output);//power down
 
-#if 1
 	/* Set the default state of the GPIO */
 	gpio_write(28, 1);
 	gpio_write(33, 1);
 	gpio_write(35, 1);
 	gpio_write(1, 1);
+}
+
+/* Send a burst of table entries, up to the next delay or the end */
+static const uint8_t *KD2401_Send(const uint8_t *entry)
+{
+	while (entry[0] != KD2401_TABLE_END && entry[0] != KD2401_TABLE_DELAY)
+	{
+		uint8_t i;
+		write_command(entry[0]);
+		for (i = 0; i < entry[1]; i++)
+			write_data(entry[2 + i]);
+		entry += 2 + entry[1];
+	}
+	return entry;
+}
+
+#else
+
+/* Size of the largest burst of 9-bit words between two delays in the init table, packed */
+#define KD2401_BURST_MAX 128
+
+static void KD2401_Setup()
+{
+	/* TODO - use the method exposed by EVE HAL library and panlbsp for setting the
+	 * eve and eflash into default states - mainly the CS to be high */
+	gpio_function(28, pad_gpio28); //cs0 for eve
+	gpio_function(35, pad_gpio35); //ss3 for eflash
+	gpio_function(1, pad_gpio1); //power down of FT81x
+	gpio_dir(28, pad_dir_output);
+	gpio_dir(35, pad_dir_output);
+	gpio_dir(1, pad_dir_output);
 	gpio_write(28, 1);
-    gpio_write(1, 1);
-	gpio_write(33, 1);
 	gpio_write(35, 1);
+	gpio_write(1, 1);
+
+	/* KD2401 sits on SS1 of the SPIM, in 3-wire mode with the D/CX bit in front of every byte */
+	sys_enable(sys_device_spi_master);
+	gpio_function(27, pad_spim_sck);
+	gpio_function(29, pad_spim_mosi);
+	gpio_function(30, pad_spim_miso);
+	gpio_function(33, pad_spim_ss1);
+	gpio_dir(27, pad_dir_output);
+	gpio_dir(29, pad_dir_output);
+	gpio_dir(30, pad_dir_input);
+	gpio_dir(33, pad_dir_output);
+
+	spi_init(SPIM, spi_dir_master, spi_mode_0, KD2401_SPI_DIVIDER);
+	spi_option(SPIM, spi_option_bus_width, 1);
+}
+
+static void KD2401_Write(const uint8_t *burst, uint32_t bits)
+{
+	if (bits)
+	{
+		spi_open(SPIM, 1);
+		spi_writen(SPIM, burst, (bits + 7) >> 3);
+		spi_close(SPIM, 1);
+	}
+}
+
+/* Pack a burst of table entries, up to the next delay or the end, as 9-bit words and send them in one SS1 assertion.
+   The controller drops the unfinished word formed by the padding bits when SS1 is released */
+static const uint8_t *KD2401_Send(const uint8_t *entry)
+{
+	static uint8_t burst[KD2401_BURST_MAX];
+	uint32_t bits = 0;
+
+	memset(burst, 0, sizeof(burst));
+	while (entry[0] != KD2401_TABLE_END && entry[0] != KD2401_TABLE_DELAY)
+	{
+		uint8_t i;
+
+		/* Split the burst between entries if it is full */
+		if (((bits + 9 * (1 + entry[1]) + 7) >> 3) + 1 > KD2401_BURST_MAX)
+		{
+			KD2401_Write(burst, bits);
+			memset(burst, 0, sizeof(burst));
+			bits = 0;
+		}
+
+		for (i = 0; i <= entry[1]; i++)
+		{
+			/* D/CX low for the command, high for its parameters */
+			uint16_t word = i ? (0x100 | entry[1 + i]) : entry[0];
+			uint32_t pos = bits >> 3;
+			uint32_t shift = 7 - (bits & 7);
+			burst[pos] |= (uint8_t)((word << shift) >> 8);
+			burst[pos + 1] |= (uint8_t)(word << shift);
+			bits += 9;
+		}
+		entry += 2 + entry[1];
+	}
+
+	KD2401_Write(burst, bits);
+	return entry;
+}
+
 #endif
 
+void KD2401_Bootup()
+{
+	const uint8_t *entry = c_KD2401_Init;
+
+	KD2401_Setup();
 
 	//display driver bring up
+	for (;;)
 	{
-		/***************************************/
-		write_command(0xC0);
-		write_data(0x17);
-		write_data(0x17);
-
-		write_command(0xC1);
-		write_data(0x44);
-
-		write_command(0xC5);
-		write_data(0x00);
-		write_data(0x3A);//
-		write_data(0x80);
-
-		write_command(0x36);
-		write_data(0x48);
-
-		write_command(0x3A); //Interface Mode Control
-		write_data(0x60);
-
-		write_command(0xB1);   //Frame rate 70HZ
-		write_data(0xA0);
-
-		write_command(0xB4);
-		write_data(0x02);
-
-		write_command(0xB7);
-		write_data(0xC6);
-
-		write_command(0xE9);
-		write_data(0x00);
-
-		write_command(0XF7);
-		write_data(0xA9);
-		write_data(0x51);
-		write_data(0x2C);
-		write_data(0x82);
-
-		write_command(0xE0);
-		write_data(0x01);
-		write_data(0x13);
-		write_data(0x1E);
-		write_data(0x00);
-		write_data(0x0D);
-		write_data(0x03);
-		write_data(0x3D);
-		write_data(0x55);
-		write_data(0x4F);
-		write_data(0x06);
-		write_data(0x10);
-		write_data(0x0B);
-		write_data(0x2C);
-		write_data(0x32);
-		write_data(0x0F);
-
-		write_command(0xE1);
-		write_data(0x08);
-		write_data(0x10);
-		write_data(0x15);
-		write_data(0x03);
-		write_data(0x0E);
-		write_data(0x03);
-		write_data(0x32);
-		write_data(0x34);
-		write_data(0x44);
-		write_data(0x07);
-		write_data(0x10);
-		write_data(0x0E);
-		write_data(0x23);
-		write_data(0x2E);
-		write_data(0x0F);
-
-		/**********set rgb interface mode******************/
-		write_command(0xB6);
-		write_data(0x30); //set rgb
-		write_data(0x02); //GS,SS
-		write_data(0x3B);
-
-		write_command(0XB0);  //Interface Mode Control
-		write_data(0x00);
-		 /**************************************************/
-		write_command(0x2A); //Frame rate control
-		write_data(0x00);
-		write_data(0x00);
-		write_data(0x01);
-		write_data(0x3F);
-
-		write_command(0x2B); //Display function control
-		write_data(0x00);
-		write_data(0x00);
-		write_data(0x01);
-		write_data(0xDF);
-
-		write_command(0x21);
-
-		write_command(0x11);
-		delayms(120);
-		write_command(0x29); //display on
-		write_command(0x2c);
-
-#if 0
-		write_command (0x11);
-		delayms(150);
-		write_command (0x29);
-		delayms(50);
+		entry = KD2401_Send(entry);
+		if (entry[0] != KD2401_TABLE_DELAY)
+			break;
+		delayms(entry[1]);
+		entry += 2;
+	}
+
+#if !KD2401_BITBANG
+	/* Leave SS1 deasserted as a GPIO, as the SPIM is handed back to EVE */
+	gpio_function(33, pad_gpio33);
+	gpio_dir(33, pad_dir_output);
+	gpio_write(33, 1);
 #endif
-    }
 }
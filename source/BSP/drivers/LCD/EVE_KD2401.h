@@ -40,6 +40,16 @@ Revision History:
 /***********
 ** MARCOS **
 ***********/
+/* Send the init sequence by bit banging the SPIM pins instead of through the SPIM on SS1 */
+#ifndef KD2401_BITBANG
+#define KD2401_BITBANG 0
+#endif
+
+/* SPIM clock divider for the KD2401, 100MHz / 16 gives 6.25MHz, well within the ILI9488 serial write timing */
+#ifndef KD2401_SPI_DIVIDER
+#define KD2401_SPI_DIVIDER 16
+#endif
+
 /* Macros for KD driver */
 
 #define KD2401_CS_LOW (gpio_write(33, 0))
@@ -48,6 +48,22 @@ static inline void endFunc(EVE_HalContext *phost)
 	}
 }
 
+/**
+ * @brief End read/write to Coprocessor, before reading the command buffer state
+ *
+ * @param phost Pointer to Hal context
+ */
+static inline void endState(EVE_HalContext *phost)
+{
+#if EVE_CMD_RECORD
+	/* The command buffer state must include the recorded commands.
+	Wait functions flush the recording before they start waiting */
+	if (phost->CmdRecordIndex && !phost->CmdWaiting)
+		EVE_Cmd_flushRecord(phost);
+#endif
+	endFunc(phost);
+}
+
 /**
  * @brief Read from Coprocessor
  *
@@ -57,7 +73,7 @@ static inline void endFunc(EVE_HalContext *phost)
 uint16_t EVE_Cmd_rp(EVE_HalContext *phost)
 {
 	uint16_t rp;
-	endFunc(phost);
+	endState(phost);
 	rp = EVE_Hal_rd16(phost, REG_CMD_READ) & EVE_CMD_FIFO_MASK;
 	if (EVE_CMD_FAULT(rp))
 		phost->CmdFault = true;
@@ -72,7 +88,7 @@ uint16_t EVE_Cmd_rp(EVE_HalContext *phost)
  */
 uint16_t EVE_Cmd_wp(EVE_HalContext *phost)
 {
-	endFunc(phost);
+	endState(phost);
 	if (EVE_Hal_supportCmdB(phost))
 	{
 		return EVE_Hal_rd16(phost, REG_CMD_WRITE) & EVE_CMD_FIFO_MASK;
@@ -95,7 +111,7 @@ uint16_t EVE_Cmd_space(EVE_HalContext *phost)
 	uint16_t space;
 	uint16_t wp;
 	uint16_t rp;
-	endFunc(phost);
+	endState(phost);
 	if (EVE_Hal_supportCmdB(phost))
 	{
 		space = EVE_Hal_rd16(phost, REG_CMDB_SPACE) & EVE_CMD_FIFO_MASK;
@@ -227,6 +243,87 @@ static uint32_t wrBuffer(EVE_HalContext *phost, const void *buffer, uint32_t siz
 	return transfered;
 }
 
+#if EVE_CMD_RECORD
+/**
+ * @brief Append a buffer to the command recording, spilling the recording when full
+ *
+ * @param phost Pointer to Hal context
+ * @param buffer Data pointer
+ * @param size Size to write
+ * @return true True if recorded
+ * @return false False if the buffer does not fit in the recording, nothing is recorded
+ */
+static bool recordMem(EVE_HalContext *phost, const uint8_t *buffer, uint32_t size)
+{
+	uint32_t padded = (size + 3) & ~0x3UL;
+
+	if (padded > EVE_CMD_RECORD_SIZE)
+	{
+		/* Keep the order of commands */
+		EVE_Cmd_flushRecord(phost);
+		return false;
+	}
+	if (phost->CmdRecordIndex + padded > EVE_CMD_RECORD_SIZE)
+		EVE_Cmd_flushRecord(phost);
+
+	memcpy(&((uint8_t *)phost->CmdRecord)[phost->CmdRecordIndex], buffer, size);
+	memset(&((uint8_t *)phost->CmdRecord)[phost->CmdRecordIndex + size], 0, padded - size);
+	phost->CmdRecordIndex += (uint16_t)padded;
+	return true;
+}
+
+/**
+ * @brief Start recording commands in host RAM
+ *
+ * @param phost Pointer to Hal context
+ */
+void EVE_Cmd_startRecord(EVE_HalContext *phost)
+{
+	eve_assert(!phost->CmdWaiting);
+	eve_assert(phost->CmdBufferIndex == 0);
+	phost->CmdRecording = true;
+}
+
+/**
+ * @brief Write the recorded commands to the command buffer in a single transfer
+ *
+ * @param phost Pointer to Hal context
+ * @return true True if ok
+ * @return false False if coprocessor fault
+ */
+bool EVE_Cmd_flushRecord(EVE_HalContext *phost)
+{
+	uint32_t size = phost->CmdRecordIndex;
+	bool cmdFunc = phost->CmdFunc;
+	uint32_t transfered;
+
+	if (!size)
+		return true;
+
+	/* The recording stays untouched while it is written, waits for space end up here with nothing left to flush */
+	phost->CmdRecordIndex = 0;
+	phost->CmdFunc = true; /* Keep chip select low across the whole recording */
+	transfered = wrBuffer(phost, phost->CmdRecord, size, false, false);
+	phost->CmdFunc = cmdFunc;
+	if (!cmdFunc && phost->Status == EVE_STATUS_WRITING)
+		EVE_Hal_endTransfer(phost);
+	return transfered == size;
+}
+
+/**
+ * @brief Write the recorded commands to the command buffer, and stop recording
+ *
+ * @param phost Pointer to Hal context
+ * @return true True if ok
+ * @return false False if coprocessor fault
+ */
+bool EVE_Cmd_endRecord(EVE_HalContext *phost)
+{
+	phost->CmdRecording = false;
+	return EVE_Cmd_flushRecord(phost);
+}
+#endif
+
 /**
  * @brief Begin writing a function, keeps the transfer open
  *
@@ -265,9 +362,45 @@ bool EVE_Cmd_wrMem(EVE_HalContext *phost, const uint8_t *buffer, uint32_t size)
 {
 	eve_assert(!phost->CmdWaiting);
 	eve_assert(phost->CmdBufferIndex == 0);
+#if EVE_CMD_RECORD
+	if (phost->CmdRecording && recordMem(phost, buffer, size))
+		return true;
+#endif
 	return wrBuffer(phost, buffer, size, false, false) == size;
 }
 
+#if EVE_ASYNC_TRANSFER
+/**
+ * @brief Write buffer to Coprocessor's comand fifo without waiting for the transfer to complete
+ *
+ * @param phost Pointer to Hal context
+ * @param buffer Data pointer, must remain valid until the transfer completes
+ * @param size Size to write
+ * @return true Write ok
+ * @return false Write error
+ */
+bool EVE_Cmd_wrMemAsync(EVE_HalContext *phost, const uint8_t *buffer, uint32_t size)
+{
+	eve_assert(!phost->CmdWaiting);
+	eve_assert(phost->CmdBufferIndex == 0);
+
+	if (phost->CmdFunc || (size & 0x3) || size > (EVE_CMD_FIFO_SIZE - 4))
+		return EVE_Cmd_wrMem(phost, buffer, size);
+#if EVE_CMD_RECORD
+	if (phost->CmdRecording)
+		return EVE_Cmd_wrMem(phost, buffer, size);
+#endif
+
+	if (phost->CmdSpace < size && !EVE_Cmd_waitSpace(phost, size))
+		return false; /* Coprocessor fault */
+
+	startBufferTransfer(phost);
+	EVE_Hal_transferMemAsync(phost, buffer, size, true);
+	phost->CmdSpace -= (uint16_t)size;
+	return true;
+}
+#endif
+
 /**
  * @brief Write buffer in ProgMem to Coprocessor's comand fifo
  *
@@ -281,6 +414,10 @@ bool EVE_Cmd_wrProgMem(EVE_HalContext *phost, eve_progmem_const uint8_t *buffer,
 {
 	eve_assert(!phost->CmdWaiting);
 	eve_assert(phost->CmdBufferIndex == 0);
+#if EVE_CMD_RECORD
+	/* Program memory is streamed directly, keep the order of commands */
+	EVE_Cmd_flushRecord(phost);
+#endif
 	return wrBuffer(phost, (void *)(uintptr_t)buffer, size, true, false) == size;
 }
 
@@ -297,6 +434,29 @@ uint32_t EVE_Cmd_wrString(EVE_HalContext *phost, const char *str, uint32_t maxLe
 	uint32_t transfered;
 	eve_assert(!phost->CmdWaiting);
 	eve_assert(phost->CmdBufferIndex == 0);
+#if EVE_CMD_RECORD
+	if (phost->CmdRecording)
+	{
+		/* Null-terminated and padded to 4 bytes, as EVE_Hal_transferString */
+		uint32_t length = 0;
+		while (length < maxLength && str[length])
+			++length;
+		transfered = (length + 4) & ~0x3UL;
+		if (transfered > EVE_CMD_RECORD_SIZE)
+		{
+			EVE_Cmd_flushRecord(phost);
+		}
+		else
+		{
+			if (phost->CmdRecordIndex + transfered > EVE_CMD_RECORD_SIZE)
+				EVE_Cmd_flushRecord(phost);
+			memcpy(&((uint8_t *)phost->CmdRecord)[phost->CmdRecordIndex], str, length);
+			memset(&((uint8_t *)phost->CmdRecord)[phost->CmdRecordIndex + length], 0, transfered - length);
+			phost->CmdRecordIndex += (uint16_t)transfered;
+			return transfered;
+		}
+	}
+#endif
 	transfered = wrBuffer(phost, str, maxLength, false, true);
 	return transfered;
 }
@@ -369,6 +529,17 @@ bool EVE_Cmd_wr32(EVE_HalContext *phost, uint32_t value)
 	eve_assert(!phost->CmdWaiting);
 	eve_assert(phost->CmdBufferIndex == 0);
 
+#if EVE_CMD_RECORD
+	if (phost->CmdRecording)
+	{
+		if (phost->CmdRecordIndex + 4 > EVE_CMD_RECORD_SIZE)
+			EVE_Cmd_flushRecord(phost);
+		phost->CmdRecord[phost->CmdRecordIndex >> 2] = value;
+		phost->CmdRecordIndex += 4;
+		return true;
+	}
+#endif
+
 	if (phost->CmdSpace < 4 && !EVE_Cmd_waitSpace(phost, 4))
 		return false;
 
@@ -486,6 +657,16 @@ static bool handleWait(EVE_HalContext *phost, uint16_t rpOrSpace)
 	return true;
 }
 
+#if EVE_INTERRUPT_WAIT
+/** Longest sleep on INT_N between command FIFO polls while waiting for the FIFO to empty.
+Only matters when INT_N is not connected */
+#define EVE_CMD_FLUSH_WAIT_US 2000
+
+/** Longest sleep on INT_N between command FIFO polls while waiting for space.
+INT_CMDEMPTY only signals a completely empty FIFO, so keep polling at a reduced rate */
+#define EVE_CMD_SPACE_WAIT_US 100
+#endif
+
 /**
  * @brief Wait till Command FIFO buffer empty
  *
@@ -499,7 +680,13 @@ bool EVE_Cmd_waitFlush(EVE_HalContext *phost)
 	uint16_t wp;
 
 	eve_assert(!phost->CmdWaiting);
+#if EVE_CMD_RECORD
+	EVE_Cmd_flushRecord(phost);
+#endif
 	phost->CmdWaiting = true;
+#if EVE_INTERRUPT_WAIT
+	EVE_Hal_armInterrupt(phost);
+#endif
 	while ((rp = EVE_Cmd_rp(phost)) != (wp = EVE_Cmd_wp(phost)))
 	{
 		if (!handleWait(phost, rp))
@@ -507,6 +694,11 @@ bool EVE_Cmd_waitFlush(EVE_HalContext *phost)
 			phost->CmdSpace = (rp - wp - 4) & EVE_CMD_FIFO_MASK;
 			return false;
 		}
+#if EVE_INTERRUPT_WAIT
+		/* Sleep until INT_CMDEMPTY rather than polling REG_CMD_READ */
+		if (EVE_Hal_waitInterrupt(phost, EVE_CMD_FLUSH_WAIT_US))
+			EVE_Hal_armInterrupt(phost);
+#endif
 	}
 
 	/* Command buffer empty */
@@ -529,6 +721,9 @@ uint32_t EVE_Cmd_waitSpace(EVE_HalContext *phost, uint32_t size)
 	}
 
 	eve_assert(!phost->CmdWaiting);
+#if EVE_CMD_RECORD
+	EVE_Cmd_flushRecord(phost);
+#endif
 	phost->CmdWaiting = true;
 
 	space = phost->CmdSpace;
@@ -546,6 +741,10 @@ uint32_t EVE_Cmd_waitSpace(EVE_HalContext *phost, uint32_t size)
 	/* Wait until there's sufficient space */
 	while (space < size)
 	{
+#if EVE_INTERRUPT_WAIT
+		if (EVE_Hal_waitInterrupt(phost, EVE_CMD_SPACE_WAIT_US))
+			EVE_Hal_armInterrupt(phost);
+#endif
 		space = EVE_Cmd_space(phost);
 		if (!handleWait(phost, space))
 			return 0;
@@ -569,6 +768,9 @@ bool EVE_Cmd_waitLogo(EVE_HalContext *phost)
 	uint16_t wp;
 
 	eve_assert(!phost->CmdWaiting);
+#if EVE_CMD_RECORD
+	EVE_Cmd_flushRecord(phost);
+#endif
 	phost->CmdWaiting = true;
 
 	do
@@ -595,6 +797,9 @@ bool EVE_Cmd_waitRead32(EVE_HalContext *phost, uint32_t ptr, uint32_t value)
 	uint16_t wp;
 
 	eve_assert(!phost->CmdWaiting);
+#if EVE_CMD_RECORD
+	EVE_Cmd_flushRecord(phost);
+#endif
 	phost->CmdWaiting = true;
 	while ((rp = EVE_Cmd_rp(phost)) != (wp = EVE_Cmd_wp(phost)))
 	{
@@ -78,6 +78,31 @@ Waits if there is not enough space in the command buffer.
 Returns false in case a coprocessor fault occurred */
 bool EVE_Cmd_wrMem(EVE_HalContext *phost, const uint8_t *buffer, uint32_t size);
 
+#if EVE_ASYNC_TRANSFER
+/** Write a buffer to the command buffer without waiting for the SPI transfer to complete.
+Waits if there is not enough space in the command buffer for the whole buffer.
+The buffer must remain valid until `EVE_Hal_transferDone` returns true.
+Falls back to `EVE_Cmd_wrMem` when called while writing a function.
+Returns false in case a coprocessor fault occurred */
+bool EVE_Cmd_wrMemAsync(EVE_HalContext *phost, const uint8_t *buffer, uint32_t size);
+#endif
+
+#if EVE_CMD_RECORD
+/** Start recording commands into host RAM instead of writing them one by one.
+The recording is written to REG_CMDB_WRITE in a single transfer when it fills up,
+on `EVE_Cmd_flushRecord` or `EVE_Cmd_endRecord`, and before any read of the command buffer state,
+so `EVE_Cmd_waitFlush` and commands with output keep working as usual. */
+void EVE_Cmd_startRecord(EVE_HalContext *phost);
+
+/** Write the recorded commands to the command buffer, and keep recording.
+Returns false in case a coprocessor fault occurred */
+bool EVE_Cmd_flushRecord(EVE_HalContext *phost);
+
+/** Write the recorded commands to the command buffer, and stop recording.
+Returns false in case a coprocessor fault occurred */
+bool EVE_Cmd_endRecord(EVE_HalContext *phost);
+#endif
+
 /** Write a progmem buffer to the command buffer.
 Waits if there is not enough space in the command buffer.
 Returns false in case a coprocessor fault occurred */
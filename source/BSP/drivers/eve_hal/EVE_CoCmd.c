@@ -329,6 +329,9 @@ void EVE_CoCmd_setRotate(EVE_HalContext *phost, uint32_t r)
 	EVE_Cmd_wr32(phost, r);
 	EVE_Cmd_endFunc(phost);
 
+	/* The coprocessor updates the touch transform for the new rotation */
+	EVE_Hal_invalidateRegShadow(phost);
+
 	/* Don't keep this in the write buffer */
 	EVE_Hal_flush(phost);
 }
@@ -300,6 +300,7 @@ void EVE_CoCmd_dial(EVE_HalContext *phost, int16_t x, int16_t y, int16_t r, uint
 uint32_t EVE_CoCmd_calibrate(EVE_HalContext *phost)
 {
 	uint16_t resAddr;
+	bool flushed;
 
 #if EVE_CMD_HOOKS
 	if (phost->CoCmdHook && phost->CoCmdHook(phost, CMD_CALIBRATE, 0))
@@ -316,7 +317,12 @@ uint32_t EVE_CoCmd_calibrate(EVE_HalContext *phost)
 #endif
 
 	/* Wait for the result */
-	if (!EVE_Cmd_waitFlush(phost))
+	flushed = EVE_Cmd_waitFlush(phost);
+
+	/* The coprocessor has written the touch transform registers */
+	EVE_Hal_invalidateRegShadow(phost);
+
+	if (!flushed)
 		return 0;
 	return EVE_Hal_rd32(phost, RAM_CMD + resAddr);
 }
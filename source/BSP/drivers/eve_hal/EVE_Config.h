@@ -112,6 +112,13 @@ IDP-3500-04A
 #define EVE_DL_STATE_STACK_MASK 3
 
 #define EVE_CMD_HOOKS 0 /**< Allow adding a callback hook into EVE_CoCmd calls using CoCmdHook in EVE_HalContext */
+#define EVE_ASYNC_TRANSFER 1 /**< Allow bulk writes to be clocked out by the SPIM FIFO interrupt while the host continues working */
+#define EVE_INTERRUPT_WAIT 1 /**< Wait for the EVE INT_N line instead of continuously polling the coprocessor over SPI */
+#define EVE_CMD_RECORD 1 /**< Allow recording coprocessor commands in host RAM using EVE_Cmd_startRecord, to write them in a single transfer */
+#define EVE_CMD_RECORD_SIZE 1024 /**< Size of the command recording buffer in bytes, multiple of 4 */
+#define EVE_REG_SHADOW 0 /**< Keep a host copy of registers only the host writes (sound, backlight, touch transform), serving reads from RAM and skipping writes that don't change the value */
+#define EVE_LOADFILE_BUFFER_SIZE 2048 /**< Size of the buffer file data is read into, multiple of 512 so the SD card is read in whole sectors */
+#define EVE_LOADFILE_MEDIAFIFO_SIZE (16 * 1024L) /**< Size of the media FIFO CMD_LOADIMAGE streams files through, at the end of RAM_G. Set to 0 to stream through the command FIFO instead */
 
 ///////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////
@@ -107,30 +107,137 @@ void EVE_Hal_idle(EVE_HalContext *phost)
 /** @name TRANSFER HELPERS */
 ///@{
 
+#if EVE_REG_SHADOW
+/* Width in bytes of the registers in RegShadow */
+static const uint8_t c_RegShadowSize[EVE_REG_SHADOW_COUNT] = { 1, 1, 2, 2, 1, 4, 4, 4, 4, 4, 4 };
+
+static int regShadowIndex(uint32_t addr)
+{
+	switch (addr)
+	{
+	case REG_VOL_PB: return 0;
+	case REG_VOL_SOUND: return 1;
+	case REG_SOUND: return 2;
+	case REG_PWM_HZ: return 3;
+	case REG_PWM_DUTY: return 4;
+	case REG_TOUCH_TRANSFORM_A: return 5;
+	case REG_TOUCH_TRANSFORM_B: return 6;
+	case REG_TOUCH_TRANSFORM_C: return 7;
+	case REG_TOUCH_TRANSFORM_D: return 8;
+	case REG_TOUCH_TRANSFORM_E: return 9;
+	case REG_TOUCH_TRANSFORM_F: return 10;
+	default: return -1;
+	}
+}
+
+static inline uint32_t regShadowMask(uint8_t size)
+{
+	return size >= 4 ? 0xFFFFFFFFUL : ((1UL << (size << 3)) - 1);
+}
+
+/* Get the shadow value of a register, returns false if not known */
+static bool regShadowRead(EVE_HalContext *phost, uint32_t addr, uint32_t *value)
+{
+	int idx = regShadowIndex(addr);
+	if (idx < 0 || !(phost->RegShadowValid & (1 << idx)))
+		return false;
+	*value = phost->RegShadow[idx];
+	return true;
+}
+
+/* Store a value read from or written to a register, access narrower than the register drops the shadow */
+static void regShadowStore(EVE_HalContext *phost, uint32_t addr, uint32_t value, uint8_t size)
+{
+	int idx = regShadowIndex(addr);
+	if (idx < 0)
+		return;
+	if (size >= c_RegShadowSize[idx])
+	{
+		phost->RegShadow[idx] = value & regShadowMask(c_RegShadowSize[idx]);
+		phost->RegShadowValid |= (1 << idx);
+	}
+	else
+	{
+		phost->RegShadowValid &= ~(1 << idx);
+	}
+}
+
+/* Returns true if the write would not change the register */
+static bool regShadowWrite(EVE_HalContext *phost, uint32_t addr, uint32_t value, uint8_t size)
+{
+	int idx = regShadowIndex(addr);
+	if (idx < 0)
+		return false;
+	if (size >= c_RegShadowSize[idx]
+	    && (phost->RegShadowValid & (1 << idx))
+	    && phost->RegShadow[idx] == (value & regShadowMask(c_RegShadowSize[idx])))
+		return true;
+	regShadowStore(phost, addr, value, size);
+	return false;
+}
+
+/* Drop the shadow when a block transfer touches the shadowed register range */
+static inline void regShadowTouch(EVE_HalContext *phost, uint32_t addr, uint32_t size)
+{
+	if (addr < (REG_TOUCH_TRANSFORM_F + 4) && (addr + size) > REG_VOL_PB)
+		phost->RegShadowValid = 0;
+}
+#endif
+
+void EVE_Hal_invalidateRegShadow(EVE_HalContext *phost)
+{
+#if EVE_REG_SHADOW
+	phost->RegShadowValid = 0;
+#endif
+}
+
 uint8_t EVE_Hal_rd8(EVE_HalContext *phost, uint32_t addr)
 {
 	uint8_t value;
+#if EVE_REG_SHADOW
+	uint32_t shadow;
+	if (regShadowRead(phost, addr, &shadow))
+		return (uint8_t)shadow;
+#endif
 	EVE_Hal_startTransfer(phost, EVE_TRANSFER_READ, addr);
 	value = EVE_Hal_transfer8(phost, 0);
 	EVE_Hal_endTransfer(phost);
+#if EVE_REG_SHADOW
+	regShadowStore(phost, addr, value, 1);
+#endif
 	return value;
 }
 
 uint16_t EVE_Hal_rd16(EVE_HalContext *phost, uint32_t addr)
 {
 	uint16_t value;
+#if EVE_REG_SHADOW
+	uint32_t shadow;
+	if (regShadowRead(phost, addr, &shadow))
+		return (uint16_t)shadow;
+#endif
 	EVE_Hal_startTransfer(phost, EVE_TRANSFER_READ, addr);
 	value = EVE_Hal_transfer16(phost, 0);
 	EVE_Hal_endTransfer(phost);
+#if EVE_REG_SHADOW
+	regShadowStore(phost, addr, value, 2);
+#endif
 	return value;
 }
 
 uint32_t EVE_Hal_rd32(EVE_HalContext *phost, uint32_t addr)
 {
 	uint32_t value;
+#if EVE_REG_SHADOW
+	if (regShadowRead(phost, addr, &value))
+		return value;
+#endif
 	EVE_Hal_startTransfer(phost, EVE_TRANSFER_READ, addr);
 	value = EVE_Hal_transfer32(phost, 0);
 	EVE_Hal_endTransfer(phost);
+#if EVE_REG_SHADOW
+	regShadowStore(phost, addr, value, 4);
+#endif
 	return value;
 }
 
@@ -143,6 +250,10 @@ void EVE_Hal_rdMem(EVE_HalContext *phost, uint8_t *result, uint32_t addr, uint32
 
 void EVE_Hal_wr8(EVE_HalContext *phost, uint32_t addr, uint8_t v)
 {
+#if EVE_REG_SHADOW
+	if (regShadowWrite(phost, addr, v, 1))
+		return;
+#endif
 	EVE_Hal_startTransfer(phost, EVE_TRANSFER_WRITE, addr);
 	EVE_Hal_transfer8(phost, v);
 	EVE_Hal_endTransfer(phost);
@@ -150,6 +261,10 @@ void EVE_Hal_wr8(EVE_HalContext *phost, uint32_t addr, uint8_t v)
 
 void EVE_Hal_wr16(EVE_HalContext *phost, uint32_t addr, uint16_t v)
 {
+#if EVE_REG_SHADOW
+	if (regShadowWrite(phost, addr, v, 2))
+		return;
+#endif
 	EVE_Hal_startTransfer(phost, EVE_TRANSFER_WRITE, addr);
 	EVE_Hal_transfer16(phost, v);
 	EVE_Hal_endTransfer(phost);
@@ -157,6 +272,10 @@ void EVE_Hal_wr16(EVE_HalContext *phost, uint32_t addr, uint16_t v)
 
 void EVE_Hal_wr32(EVE_HalContext *phost, uint32_t addr, uint32_t v)
 {
+#if EVE_REG_SHADOW
+	if (regShadowWrite(phost, addr, v, 4))
+		return;
+#endif
 	EVE_Hal_startTransfer(phost, EVE_TRANSFER_WRITE, addr);
 	EVE_Hal_transfer32(phost, v);
 	EVE_Hal_endTransfer(phost);
@@ -164,13 +283,30 @@ void EVE_Hal_wr32(EVE_HalContext *phost, uint32_t addr, uint32_t v)
 
 void EVE_Hal_wrMem(EVE_HalContext *phost, uint32_t addr, const uint8_t *buffer, uint32_t size)
 {
+#if EVE_REG_SHADOW
+	regShadowTouch(phost, addr, size);
+#endif
 	EVE_Hal_startTransfer(phost, EVE_TRANSFER_WRITE, addr);
 	EVE_Hal_transferMem(phost, NULL, buffer, size);
 	EVE_Hal_endTransfer(phost);
 }
 
+#if EVE_ASYNC_TRANSFER
+void EVE_Hal_wrMemAsync(EVE_HalContext *phost, uint32_t addr, const uint8_t *buffer, uint32_t size)
+{
+#if EVE_REG_SHADOW
+	regShadowTouch(phost, addr, size);
+#endif
+	EVE_Hal_startTransfer(phost, EVE_TRANSFER_WRITE, addr);
+	EVE_Hal_transferMemAsync(phost, buffer, size, true);
+}
+#endif
+
 void EVE_Hal_wrProgMem(EVE_HalContext *phost, uint32_t addr, eve_progmem_const uint8_t *buffer, uint32_t size)
 {
+#if EVE_REG_SHADOW
+	regShadowTouch(phost, addr, size);
+#endif
 	EVE_Hal_startTransfer(phost, EVE_TRANSFER_WRITE, addr);
 	EVE_Hal_transferProgMem(phost, NULL, buffer, size);
 	EVE_Hal_endTransfer(phost);
@@ -232,6 +368,7 @@ void EVE_Host_powerModeSwitch(EVE_HalContext *phost, EVE_POWER_MODE_T pwrmode)
 void EVE_Host_coreReset(EVE_HalContext *phost)
 {
 	EVE_Hal_hostCommand(phost, EVE_CORE_RESET);
+	EVE_Hal_invalidateRegShadow(phost);
 }
 
 /**
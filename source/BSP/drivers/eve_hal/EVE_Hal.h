@@ -100,6 +100,16 @@ void EVE_Hal_idle(EVE_HalContext *phost);
 /** @name TRANSFER HELPERS */
 ///@{
 
+/**
+ * @brief Forget the host copy of the registers kept with EVE_REG_SHADOW
+ *
+ * Call this after a shadowed register was changed without EVE_Hal_wr8/16/32,
+ * for example by the coprocessor or through a raw transfer.
+ *
+ * @param phost Pointer to Hal context
+ */
+void EVE_Hal_invalidateRegShadow(EVE_HalContext *phost);
+
 /**
  * @brief Read 8 bits from Coprocessor's memory
  *
@@ -173,6 +183,19 @@ void EVE_Hal_wr32(EVE_HalContext *phost, uint32_t addr, uint32_t v);
  */
 void EVE_Hal_wrMem(EVE_HalContext *phost, uint32_t addr, const uint8_t *buffer, uint32_t size);
 
+#if EVE_ASYNC_TRANSFER
+/**
+ * @brief Write a buffer to Coprocessor's memory without waiting for the transfer to complete
+ * The buffer must remain valid until `EVE_Hal_transferDone` returns true.
+ *
+ * @param phost Pointer to Hal context
+ * @param addr Address to be write
+ * @param buffer Data to be write
+ * @param size Size of buffer
+ */
+void EVE_Hal_wrMemAsync(EVE_HalContext *phost, uint32_t addr, const uint8_t *buffer, uint32_t size);
+#endif
+
 /**
  * @brief Write a buffer in ProgMem to Coprocessor's memory
  *
@@ -49,6 +49,7 @@
 ** MARCOS **
 ***********/
 #define RAM_ERR_REPORT_MAX 128
+#define EVE_REG_SHADOW_COUNT 11 /**< REG_VOL_PB, REG_VOL_SOUND, REG_SOUND, REG_PWM_HZ, REG_PWM_DUTY, REG_TOUCH_TRANSFORM_A..F */
 
 /*************
 ** TYPEDEFS **
@@ -115,6 +116,9 @@ typedef struct EVE_HalParameters
 	uint32_t DeviceIdx;
 	uint8_t SpiCsPin; /**< SPI chip select number of FT8XX chip */
 	uint8_t PowerDownPin; /**< FT8XX power down pin number */
+#if EVE_INTERRUPT_WAIT
+	uint8_t InterruptPin; /**< FT8XX INT_N pin number */
+#endif
 
 } EVE_HalParameters;
 
@@ -167,6 +171,28 @@ typedef struct EVE_HalContext
 
 	EVE_STATUS_T Status;
 
+#if EVE_ASYNC_TRANSFER
+	/** @name Asynchronous write transfer state, owned by the SPIM interrupt while AsyncBusy is set */
+	///@{
+	const uint8_t *volatile AsyncBuffer;
+	volatile uint32_t AsyncRemaining;
+	volatile bool AsyncBusy; /**< Cleared by the interrupt once the SPIM FIFO has drained */
+	bool AsyncPending; /**< Set until the completion has been processed in the main context */
+	bool AsyncEndTransfer; /**< Close the transfer once the asynchronous write completes */
+	/** Called from the main context once an asynchronous write has completed */
+	EVE_Callback CbTransferDone;
+	///@}
+#endif
+
+#if EVE_INTERRUPT_WAIT
+	/** @name Interrupt wait state */
+	///@{
+	uint8_t InterruptPin; /**< FT8XX INT_N pin number */
+	uint8_t InterruptMask; /**< Flags enabled in REG_INT_MASK, 0 while interrupts are off */
+	volatile bool InterruptFired; /**< Set by the GPIO interrupt on a falling edge of INT_N */
+	///@}
+#endif
+
 	uint8_t PCLK;
 
 	/** @name User space width and height, based on REG_HSIZE, REG_VSIZE and REG_ROTATE */
@@ -179,6 +205,7 @@ typedef struct EVE_HalContext
 	///@{
 	EVE_SPI_CHANNELS_T SpiChannels; /**< Variable to contain single/dual/quad channels */
 	uint8_t SpiDummyBytes; /**< Number of dummy bytes as 1 or 2 for SPI read */
+	uint16_t SpiClockDivider; /**< Host SPI clock divider from the host system clock */
 	uint8_t SpiCsPin; /**< SPI chip select number of FT8XX chip */
 	uint8_t PowerDownPin; /**< FT8XX power down pin number */
 	///@}
@@ -194,6 +221,15 @@ typedef struct EVE_HalContext
 #endif
 	///@}
 
+#if EVE_CMD_RECORD
+	/** @name Command recording buffer, see EVE_Cmd_startRecord */
+	///@{
+	uint32_t CmdRecord[EVE_CMD_RECORD_SIZE >> 2];
+	uint16_t CmdRecordIndex; /**< Bytes recorded */
+	bool CmdRecording;
+	///@}
+#endif
+
 	/** @name Media FIFO state */
 	///@{
 #if defined(EVE_SUPPORT_MEDIAFIFO)
@@ -223,6 +259,14 @@ typedef struct EVE_HalContext
 	uint8_t CoScratchHandle;
 	///@}
 
+#if EVE_REG_SHADOW
+	/** @name Shadow copy of host owned registers, see EVE_REG_SHADOW */
+	///@{
+	uint32_t RegShadow[EVE_REG_SHADOW_COUNT];
+	uint16_t RegShadowValid; /**< One bit per RegShadow entry */
+	///@}
+#endif
+
 #if defined(_DEBUG)
 	bool DebugMessageVisible;
 	uint8_t DebugBackup[RAM_ERR_REPORT_MAX];
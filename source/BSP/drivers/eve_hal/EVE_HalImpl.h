@@ -86,6 +86,19 @@ void EVE_Hal_transferProgMem(EVE_HalContext *phost, uint8_t *result, eve_progmem
 uint32_t EVE_Hal_transferString(EVE_HalContext *phost, const char *str, uint32_t index, uint32_t size, uint32_t padMask);
 
 void EVE_Hal_flush(EVE_HalContext *phost);
+
+#if EVE_ASYNC_TRANSFER
+/** Start writing a memory buffer using the currently open write transfer, without waiting for it to complete.
+The buffer must remain valid until `EVE_Hal_transferDone` returns true. Any other HAL call waits for the write to complete first.
+When `endTransfer` is set, the transfer is closed automatically once the write completes. */
+void EVE_Hal_transferMemAsync(EVE_HalContext *phost, const uint8_t *buffer, uint32_t size, bool endTransfer);
+
+/** Poll for completion of an asynchronous write. Calls `CbTransferDone` once the write has completed */
+bool EVE_Hal_transferDone(EVE_HalContext *phost);
+
+/** Wait for an asynchronous write to complete */
+void EVE_Hal_transferWait(EVE_HalContext *phost);
+#endif
 ///@}
 
 /** @name UTILITY */
@@ -105,6 +118,27 @@ void EVE_Hal_setSPI(EVE_HalContext *phost, EVE_SPI_CHANNELS_T numchnls, uint8_t
 /** Restore platform to previously configured EVE SPI channel mode */
 void EVE_Hal_restoreSPI(EVE_HalContext *phost);
 
+/** Change the host SPI clock divider, keeping the current channel mode.
+Use `EVE_SPI_BOOT_DIVIDER` until the EVE clock is configured */
+void EVE_Hal_setSPIClock(EVE_HalContext *phost, uint16_t divider);
+
+/** Get the current host SPI clock frequency in Hz */
+uint32_t EVE_Hal_spiFrequency(EVE_HalContext *phost);
+
+#if EVE_INTERRUPT_WAIT
+/** Enable the EVE interrupt flags in `mask` (INT_CMDEMPTY, INT_CMDFLAG, INT_SWAP, ...) on INT_N, 0 to disable */
+void EVE_Hal_enableInterrupts(EVE_HalContext *phost, uint8_t mask);
+
+/** Clear the pending EVE interrupt flags and re-arm INT_N. Call before checking the condition to wait for.
+@return The flags which were pending */
+uint8_t EVE_Hal_armInterrupt(EVE_HalContext *phost);
+
+/** Wait up to `timeoutUs` microseconds for INT_N after `EVE_Hal_armInterrupt`, without any SPI traffic.
+Returns immediately with false when interrupts are not enabled.
+@return true when the interrupt fired */
+bool EVE_Hal_waitInterrupt(EVE_HalContext *phost, uint32_t timeoutUs);
+#endif
+
 uint32_t EVE_Hal_currentFrequency(EVE_HalContext *phost);
 ///@}
 
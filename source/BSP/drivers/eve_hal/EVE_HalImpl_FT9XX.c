@@ -38,6 +38,50 @@ static const pad_dir_t s_SpimFuncSS[4] = { pad_spim_ss0, pad_spim_ss1, pad_spim_
 
 #define GPIO_SS_NB (sizeof(s_SpimGpioSS) / sizeof(s_SpimGpioSS[0]))
 
+/** FT9XX system clock, which the SPIM clock is divided from */
+#ifndef FT9XX_SYSTEM_CLOCK
+#define FT9XX_SYSTEM_CLOCK 100000000UL
+#endif
+
+/** SPIM clock divider until the EVE clock is configured. 6.25 MHz (100 MHz / 16), */
+/** below the 11 MHz SPI limit of EVE while it is running from the default clock */
+#ifndef EVE_SPI_BOOT_DIVIDER
+#define EVE_SPI_BOOT_DIVIDER 16
+#endif
+
+/** SPIM clock divider once bootup has completed. 25 MHz (100 MHz / 4), the fastest setting within the 30 MHz SPI limit of FT81X */
+#ifndef EVE_SPI_RUN_DIVIDER
+#define EVE_SPI_RUN_DIVIDER 4
+#endif
+
+/** Size of the RAM bounce buffer used to stream program memory in bulk */
+#ifndef EVE_PROGMEM_BOUNCE_SIZE
+#define EVE_PROGMEM_BOUNCE_SIZE 1024
+#endif
+
+/** Word aligned bounce buffer for EVE_Hal_transferProgMem */
+static uint32_t s_ProgMemBounce[EVE_PROGMEM_BOUNCE_SIZE >> 2];
+
+#if EVE_ASYNC_TRANSFER
+/** Size of the SPIM FIFO, as configured in setSPI */
+#define EVE_SPIM_FIFO_SIZE 64
+
+/** Context currently owning the SPIM transmit interrupt */
+static EVE_HalContext *volatile s_AsyncHost = NULL;
+
+static void spimIsr();
+#endif
+
+#if EVE_INTERRUPT_WAIT
+/** Polling interval of the interrupt flag in EVE_Hal_waitInterrupt */
+#define EVE_INT_WAIT_STEP_US 4
+
+/** Context which has the EVE INT_N interrupt enabled */
+static EVE_HalContext *volatile s_InterruptHost = NULL;
+
+static void gpioIsr();
+#endif
+
 /** @name INIT */
 ///@{
 
@@ -47,6 +91,12 @@ static const pad_dir_t s_SpimFuncSS[4] = { pad_spim_ss0, pad_spim_ss1, pad_spim_
  */
 void EVE_HalImpl_initialize()
 {
+#if EVE_ASYNC_TRANSFER
+	interrupt_attach(interrupt_spim, (uint8_t)interrupt_spim, spimIsr);
+#endif
+#if EVE_INTERRUPT_WAIT
+	interrupt_attach(interrupt_gpio, (uint8_t)interrupt_gpio, gpioIsr);
+#endif
 }
 
 /**
@@ -105,6 +155,9 @@ bool EVE_Hal_isDevice(EVE_HalContext *phost, size_t deviceIdx)
 bool EVE_HalImpl_defaults(EVE_HalParameters *parameters, size_t deviceIdx)
 {
 	parameters->PowerDownPin = GPIO_FT800_PWD;
+#if EVE_INTERRUPT_WAIT
+	parameters->InterruptPin = GPIO_FT800_INT;
+#endif
 	parameters->SpiCsPin = deviceIdx < GPIO_SS_NB ? deviceIdx : 0; // SS0-3
 	return true;
 }
@@ -121,6 +174,10 @@ void setSPI(EVE_HalContext *phost, EVE_SPI_CHANNELS_T numchnls, uint8_t numdummy
 	uint8_t spimGpio = s_SpimGpioSS[phost->SpiCsPin];
 	pad_dir_t spimFunc = s_SpimFuncSS[phost->SpiCsPin];
 
+#if EVE_ASYNC_TRANSFER
+	EVE_Hal_transferWait(phost);
+#endif
+
 	/* Reconfigure the SPI */
 	eve_assert_do(!sys_enable(sys_device_spi_master));
 	gpio_function(GPIO_SPIM_CLK, pad_spim_sck); /* GPIO27 to SPIM_CLK */
@@ -144,8 +201,10 @@ void setSPI(EVE_HalContext *phost, EVE_SPI_CHANNELS_T numchnls, uint8_t numdummy
 
 	gpio_write(spimGpio, 1);
 
-	/* Change clock frequency to 25 MHz (100 MHz / 4) */
-	eve_assert_do(!spi_init(SPIM, spi_dir_master, spi_mode_0, 4));
+	/* Change clock frequency as per the current divider, FT9XX_SYSTEM_CLOCK / SpiClockDivider */
+	if (!phost->SpiClockDivider)
+		phost->SpiClockDivider = EVE_SPI_BOOT_DIVIDER;
+	eve_assert_do(!spi_init(SPIM, spi_dir_master, spi_mode_0, phost->SpiClockDivider));
 
 	/* Enable FIFO of QSPI */
 	spi_option(SPIM, spi_option_fifo_size, 64);
@@ -188,7 +247,16 @@ bool EVE_HalImpl_open(EVE_HalContext *phost, const EVE_HalParameters *parameters
 	gpio_dir(phost->PowerDownPin, pad_dir_output);
 	gpio_write(phost->PowerDownPin, 0);
 
-	/* Initialize single channel */
+#if EVE_INTERRUPT_WAIT
+	/* INT_N is open drain, active low. Interrupts stay off in EVE until EVE_Hal_enableInterrupts */
+	phost->InterruptPin = parameters->InterruptPin;
+	gpio_function(phost->InterruptPin, pad_func_0);
+	gpio_dir(phost->InterruptPin, pad_dir_input);
+	gpio_pull(phost->InterruptPin, pad_pull_pullup);
+#endif
+
+	/* Initialize single channel, at the safe bootup clock */
+	phost->SpiClockDivider = EVE_SPI_BOOT_DIVIDER;
 	setSPI(phost, EVE_SPI_SINGLE_CHANNEL, 1);
 
 	gpio_write(phost->PowerDownPin, 1);
@@ -207,6 +275,13 @@ bool EVE_HalImpl_open(EVE_HalContext *phost, const EVE_HalParameters *parameters
  */
 void EVE_HalImpl_close(EVE_HalContext *phost)
 {
+#if EVE_INTERRUPT_WAIT
+	if (s_InterruptHost == phost)
+	{
+		gpio_interrupt_disable(phost->InterruptPin);
+		s_InterruptHost = NULL;
+	}
+#endif
 	phost->Status = EVE_STATUS_CLOSED;
 	--g_HalPlatform.OpenedDevices;
 	spi_close(SPIM, phost->SpiCsPin);
@@ -235,6 +310,9 @@ void EVE_HalImpl_idle(EVE_HalContext *phost)
  */
 void EVE_Hal_startTransfer(EVE_HalContext *phost, EVE_TRANSFER_T rw, uint32_t addr)
 {
+#if EVE_ASYNC_TRANSFER
+	EVE_Hal_transferWait(phost);
+#endif
 	eve_assert(phost->Status == EVE_STATUS_OPENED);
 
 	if (rw == EVE_TRANSFER_READ)
@@ -269,6 +347,11 @@ void EVE_Hal_startTransfer(EVE_HalContext *phost, EVE_TRANSFER_T rw, uint32_t ad
  */
 void EVE_Hal_endTransfer(EVE_HalContext *phost)
 {
+#if EVE_ASYNC_TRANSFER
+	EVE_Hal_transferWait(phost);
+	if (phost->Status == EVE_STATUS_OPENED)
+		return; /* Already closed on completion of an asynchronous write */
+#endif
 	eve_assert(phost->Status == EVE_STATUS_READING || phost->Status == EVE_STATUS_WRITING);
 
 	spi_close(SPIM, phost->SpiCsPin);
@@ -295,6 +378,9 @@ void EVE_Hal_flush(EVE_HalContext *phost)
  */
 static inline void rdBuffer(EVE_HalContext *phost, uint8_t *buffer, uint32_t size)
 {
+#if EVE_ASYNC_TRANSFER
+	EVE_Hal_transferWait(phost);
+#endif
 	spi_readn(SPIM, buffer, size);
 }
 
@@ -307,9 +393,127 @@ static inline void rdBuffer(EVE_HalContext *phost, uint8_t *buffer, uint32_t siz
  */
 static inline void wrBuffer(EVE_HalContext *phost, const uint8_t *buffer, uint32_t size)
 {
+#if EVE_ASYNC_TRANSFER
+	EVE_Hal_transferWait(phost);
+#endif
 	spi_writen(SPIM, buffer, size);
 }
 
+#if EVE_ASYNC_TRANSFER
+/**
+ * @brief SPIM transmit FIFO empty interrupt, refills the FIFO from the pending asynchronous write
+ *
+ */
+static void spimIsr()
+{
+	EVE_HalContext *phost = s_AsyncHost;
+	uint32_t chunk;
+
+	if (!spi_is_interrupted(SPIM, spi_interrupt_transmit_empty))
+		return;
+
+	if (!phost || !phost->AsyncRemaining)
+	{
+		/* FIFO has drained after the last chunk */
+		spi_disable_interrupt(SPIM, spi_interrupt_transmit_empty);
+		s_AsyncHost = NULL;
+		if (phost)
+			phost->AsyncBusy = false;
+		return;
+	}
+
+	chunk = min(phost->AsyncRemaining, EVE_SPIM_FIFO_SIZE);
+	spi_writen(SPIM, phost->AsyncBuffer, chunk);
+	phost->AsyncBuffer += chunk;
+	phost->AsyncRemaining -= chunk;
+}
+
+/**
+ * @brief Start writing a block of data to Coprocessor without waiting for it to complete
+ *
+ * @param phost Pointer to Hal context
+ * @param buffer Data buffer to write, must remain valid until the write completes
+ * @param size Size of buffer
+ * @param endTransfer Close the transfer once the write completes
+ */
+void EVE_Hal_transferMemAsync(EVE_HalContext *phost, const uint8_t *buffer, uint32_t size, bool endTransfer)
+{
+	EVE_Hal_transferWait(phost);
+	eve_assert(phost->Status == EVE_STATUS_WRITING);
+
+	if (size <= EVE_SPIM_FIFO_SIZE)
+	{
+		/* Not worth the interrupt overhead */
+		spi_writen(SPIM, buffer, size);
+		if (endTransfer)
+			EVE_Hal_endTransfer(phost);
+		if (phost->CbTransferDone)
+			phost->CbTransferDone(phost);
+		return;
+	}
+
+	phost->AsyncBuffer = buffer;
+	phost->AsyncRemaining = size;
+	phost->AsyncEndTransfer = endTransfer;
+	phost->AsyncPending = true;
+	phost->AsyncBusy = true;
+	s_AsyncHost = phost;
+
+	/* The FIFO is empty at this point, so the interrupt fires right away to send the first chunk */
+	spi_enable_interrupt(SPIM, spi_interrupt_transmit_empty);
+}
+
+/**
+ * @brief Process the completion of an asynchronous write in the main context
+ *
+ * @param phost Pointer to Hal context
+ */
+static void completeAsync(EVE_HalContext *phost)
+{
+	while (phost->AsyncBusy)
+		eve_noop();
+
+	phost->AsyncPending = false;
+	if (phost->AsyncEndTransfer)
+	{
+		phost->AsyncEndTransfer = false;
+		spi_close(SPIM, phost->SpiCsPin);
+		phost->Status = EVE_STATUS_OPENED;
+	}
+
+	if (phost->CbTransferDone)
+		phost->CbTransferDone(phost);
+}
+
+/**
+ * @brief Poll for completion of an asynchronous write
+ *
+ * @param phost Pointer to Hal context
+ * @return true True if no asynchronous write is in progress
+ * @return false False if the write is still being clocked out
+ */
+bool EVE_Hal_transferDone(EVE_HalContext *phost)
+{
+	if (!phost->AsyncPending)
+		return true;
+	if (phost->AsyncBusy)
+		return false;
+	completeAsync(phost);
+	return true;
+}
+
+/**
+ * @brief Wait for an asynchronous write to complete
+ *
+ * @param phost Pointer to Hal context
+ */
+void EVE_Hal_transferWait(EVE_HalContext *phost)
+{
+	if (phost->AsyncPending)
+		completeAsync(phost);
+}
+#endif
+
 /**
  * @brief Write 8 bit to Coprocessor
  *
@@ -319,6 +523,9 @@ static inline void wrBuffer(EVE_HalContext *phost, const uint8_t *buffer, uint32
  */
 static inline uint8_t transfer8(EVE_HalContext *phost, uint8_t value)
 {
+#if EVE_ASYNC_TRANSFER
+	EVE_Hal_transferWait(phost);
+#endif
 	if (phost->Status == EVE_STATUS_READING)
 	{
 		spi_read(SPIM, value);
@@ -452,12 +659,14 @@ void EVE_Hal_transferProgMem(EVE_HalContext *phost, uint8_t *result, eve_progmem
 	{
 		eve_assert(!((uintptr_t)buffer & 0x3)); // must be 32-bit aligned
 		eve_assert(!(size & 0x3)); // must be 32-bit aligned
-		eve_progmem_const uint32_t *buf32 = (eve_progmem_const uint32_t *)(void eve_progmem_const *)buffer;
-		size >>= 2;
-		while (size--)
+		/* Copy program memory into RAM in large blocks, and stream each block in one SPI write */
+		while (size)
 		{
-			uint32_t value = *(buf32++);
-			wrBuffer(phost, (uint8_t *)(&value), 4);
+			uint32_t chunk = min(size, (uint32_t)sizeof(s_ProgMemBounce));
+			memcpy_pm2dat(s_ProgMemBounce, buffer, chunk);
+			wrBuffer(phost, (uint8_t *)s_ProgMemBounce, chunk);
+			buffer += chunk;
+			size -= chunk;
 		}
 	}
 }
@@ -518,6 +727,9 @@ uint32_t EVE_Hal_transferString(EVE_HalContext *phost, const char *str, uint32_t
  */
 void EVE_Hal_hostCommand(EVE_HalContext *phost, uint8_t cmd)
 {
+#if EVE_ASYNC_TRANSFER
+	EVE_Hal_transferWait(phost);
+#endif
 	eve_assert(phost->Status == EVE_STATUS_OPENED);
 
 	uint8_t hcmd[4] = { 0 };
@@ -539,6 +751,9 @@ void EVE_Hal_hostCommand(EVE_HalContext *phost, uint8_t cmd)
  */
 void EVE_Hal_hostCommandExt3(EVE_HalContext *phost, uint32_t cmd)
 {
+#if EVE_ASYNC_TRANSFER
+	EVE_Hal_transferWait(phost);
+#endif
 	eve_assert(phost->Status == EVE_STATUS_OPENED);
 
 	uint8_t hcmd[4] = { 0 };
@@ -566,6 +781,11 @@ bool EVE_Hal_powerCycle(EVE_HalContext *phost, bool up)
 	{
 		gpio_write(phost->PowerDownPin, 0);
 		EVE_sleep(20);
+#if EVE_INTERRUPT_WAIT
+		/* EVE comes back with interrupts disabled */
+		phost->InterruptMask = 0;
+#endif
+		phost->SpiClockDivider = EVE_SPI_BOOT_DIVIDER;
 		setSPI(phost, EVE_SPI_SINGLE_CHANNEL, 1);
 		gpio_write(phost->PowerDownPin, 1);
 		EVE_sleep(20);
@@ -610,6 +830,107 @@ void EVE_Hal_restoreSPI(EVE_HalContext *phost)
 	setSPI(phost, phost->SpiChannels, phost->SpiDummyBytes);
 }
 
+/**
+ * @brief Change the SPIM clock divider, keeping the current channel mode
+ *
+ * @param phost Pointer to Hal context
+ * @param divider Clock divider from FT9XX_SYSTEM_CLOCK, 0 to select EVE_SPI_RUN_DIVIDER
+ */
+void EVE_Hal_setSPIClock(EVE_HalContext *phost, uint16_t divider)
+{
+	phost->SpiClockDivider = divider ? divider : EVE_SPI_RUN_DIVIDER;
+	setSPI(phost, phost->SpiChannels, phost->SpiDummyBytes);
+}
+
+/**
+ * @brief Get the current SPIM clock frequency
+ *
+ * @param phost Pointer to Hal context
+ * @return uint32_t SPI clock in Hz
+ */
+uint32_t EVE_Hal_spiFrequency(EVE_HalContext *phost)
+{
+	return phost->SpiClockDivider ? (uint32_t)(FT9XX_SYSTEM_CLOCK / phost->SpiClockDivider) : 0;
+}
+
+#if EVE_INTERRUPT_WAIT
+/**
+ * @brief GPIO interrupt, flags a falling edge on INT_N
+ *
+ */
+static void gpioIsr()
+{
+	EVE_HalContext *phost = s_InterruptHost;
+
+	if (phost && gpio_is_interrupted(phost->InterruptPin))
+		phost->InterruptFired = true;
+}
+
+/**
+ * @brief Enable EVE interrupt flags on the INT_N line
+ *
+ * @param phost Pointer to Hal context
+ * @param mask Interrupt flags to enable, 0 to disable interrupts
+ */
+void EVE_Hal_enableInterrupts(EVE_HalContext *phost, uint8_t mask)
+{
+	EVE_Hal_wr8(phost, REG_INT_EN, 0);
+	gpio_interrupt_disable(phost->InterruptPin);
+	phost->InterruptMask = mask;
+	if (!mask)
+	{
+		if (s_InterruptHost == phost)
+			s_InterruptHost = NULL;
+		return;
+	}
+
+	s_InterruptHost = phost;
+	EVE_Hal_wr8(phost, REG_INT_MASK, mask);
+	EVE_Hal_wr8(phost, REG_INT_EN, 1);
+	EVE_Hal_armInterrupt(phost);
+	gpio_interrupt_enable(phost->InterruptPin, gpio_int_edge_falling);
+}
+
+/**
+ * @brief Clear pending EVE interrupt flags, which releases INT_N for the next falling edge
+ *
+ * @param phost Pointer to Hal context
+ * @return uint8_t Interrupt flags that were pending
+ */
+uint8_t EVE_Hal_armInterrupt(EVE_HalContext *phost)
+{
+	if (!phost->InterruptMask)
+		return 0;
+
+	/* Clear the host flag first, an edge after the read below must not be lost */
+	phost->InterruptFired = false;
+	return EVE_Hal_rd8(phost, REG_INT_FLAGS);
+}
+
+/**
+ * @brief Wait for INT_N without accessing SPI
+ *
+ * @param phost Pointer to Hal context
+ * @param timeoutUs Maximum time to wait in microseconds
+ * @return true True if the interrupt fired
+ * @return false False on timeout, or when interrupts are not enabled
+ */
+bool EVE_Hal_waitInterrupt(EVE_HalContext *phost, uint32_t timeoutUs)
+{
+	if (!phost->InterruptMask)
+		return false;
+
+	while (!phost->InterruptFired)
+	{
+		if (timeoutUs < EVE_INT_WAIT_STEP_US)
+			return false;
+		delayus(EVE_INT_WAIT_STEP_US);
+		timeoutUs -= EVE_INT_WAIT_STEP_US;
+	}
+	return true;
+}
+#endif
+
 /**
  * @brief Get current system clock of Coprocessor
  *
@@ -0,0 +1,68 @@
+/**
+ * @file EVE_LoadFile.h
+ * @brief Eve_Hal framework APIs for loading file
+ *
+ * @author Bridgetek
+ *
+ * @date 2018
+ *
+ * MIT License
+ *
+ * Copyright (c) [2019] [Bridgetek Pte Ltd (BRTChip)]
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef EVE_LOADFILE__H
+#define EVE_LOADFILE__H
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "EVE_Platform.h"
+
+/**********************
+ *  GLOBAL PROTOTYPES
+ **********************/
+
+/*
+On embedded platforms, filename character set depends on the filesystem library.
+The SD card is mounted by loadSdCard of the sdcard driver, a USB stick by usbmsc_task.
+A "0:" or "1:" prefix in the file name selects the SD card or the USB stick, names without
+a prefix are opened on the volume set by EVE_Util_setFileVolume.
+*/
+
+#define EVE_FILE_VOLUME_SD 0
+#define EVE_FILE_VOLUME_USB 1
+
+/** Set the volume of file names without a drive prefix, the SD card by default */
+bool EVE_Util_setFileVolume(uint8_t volume);
+
+/** Load a JPEG or PNG file using CMD_LOADIMAGE.
+The file is streamed through the media FIFO at the end of RAM_G, or through the command FIFO
+when EVE_LOADFILE_MEDIAFIFO_SIZE is 0, so the decoded image must not overlap the media FIFO.
+The image format is provided as output to the optional format argument */
+bool EVE_Util_loadImageFile(EVE_HalContext *phost, uint32_t address, const char *filename, uint32_t *format);
+
+/** Load a JPEG or PNG file using CMD_LOADIMAGE, as EVE_Util_loadImageFile.
+The optional width and height of the decoded image are read with CMD_GETPROPS */
+bool EVE_Util_loadImageFileEx(EVE_HalContext *phost, uint32_t address, const char *filename, uint32_t *format, uint32_t *width, uint32_t *height);
+
+#endif
+/* end of file */
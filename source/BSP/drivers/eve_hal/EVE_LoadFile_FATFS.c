@@ -0,0 +1,223 @@
+/**
+ * @file EVE_LoadFile_FATFS.c
+ * @brief Eve_Hal framework APIs for loading file with FATFS
+ *
+ * @author Bridgetek
+ *
+ * @date 2018
+ *
+ * MIT License
+ *
+ * Copyright (c) [2019] [Bridgetek Pte Ltd (BRTChip)]
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "EVE_LoadFile.h"
+#include "EVE_Platform.h"
+
+#if EVE_ENABLE_FATFS
+#include "ff.h"
+#include "sdcard.h"
+#include "usbmsc.h"
+
+/* Output format of the last CMD_LOADIMAGE, same as read by EVE_CoCmd_loadImage_progMem */
+#define EVE_LOADIMAGE_FORMAT 0x3097e8
+
+static uint8_t s_LoadFileBuffer[EVE_LOADFILE_BUFFER_SIZE];
+static uint8_t s_FileVolume = EVE_FILE_VOLUME_SD;
+
+/* Volume the file is opened from */
+static uint8_t fileVolume(const char *filename)
+{
+	if (filename[0] >= '0' && filename[0] < '0' + FF_VOLUMES && filename[1] == ':')
+		return (uint8_t)(filename[0] - '0');
+	return s_FileVolume;
+}
+
+static bool volumeReady(uint8_t volume)
+{
+	return volume == EVE_FILE_VOLUME_USB ? usbmsc_ready() : sdCardReady();
+}
+
+static FRESULT openFile(FIL *file, const char *filename)
+{
+	FRESULT fResult = f_open(file, filename, FA_READ | FA_OPEN_EXISTING);
+	if (fResult == FR_DISK_ERR && fileVolume(filename) == EVE_FILE_VOLUME_SD)
+	{
+		eve_printf_debug("Re-mount SD card\n");
+		sdhost_init();
+		loadSdCard();
+		fResult = f_open(file, filename, FA_READ | FA_OPEN_EXISTING);
+	}
+	return fResult;
+}
+
+#if EVE_LOADFILE_MEDIAFIFO_SIZE
+/* Streams the file into the media FIFO until the coprocessor is done with the image.
+The media FIFO stops early once the coprocessor has finished, trailing data is not sent */
+static bool streamMediaFifo(EVE_HalContext *phost, FIL *file, uint32_t address)
+{
+	UINT blocklen;
+	uint32_t transfered;
+
+	if (!EVE_MediaFifo_set(phost, RAM_G_SIZE - EVE_LOADFILE_MEDIAFIFO_SIZE, EVE_LOADFILE_MEDIAFIFO_SIZE))
+		return false;
+
+	EVE_CoCmd_loadImage(phost, address, OPT_NODL | OPT_MEDIAFIFO);
+	while (f_read(file, s_LoadFileBuffer, EVE_LOADFILE_BUFFER_SIZE, &blocklen) == FR_OK && blocklen)
+	{
+		blocklen = (blocklen + 3) & ~3U;
+		if (!EVE_MediaFifo_wrMem(phost, s_LoadFileBuffer, blocklen, &transfered) || transfered < blocklen)
+			break; /* Finished with the image, or coprocessor fault */
+	}
+	return true;
+}
+#else
+/* Streams the file as the data following CMD_LOADIMAGE in the command FIFO */
+static bool streamCmdFifo(EVE_HalContext *phost, FIL *file, uint32_t address)
+{
+	UINT blocklen;
+
+	EVE_Cmd_startFunc(phost);
+	EVE_Cmd_wr32(phost, CMD_LOADIMAGE);
+	EVE_Cmd_wr32(phost, address);
+	EVE_Cmd_wr32(phost, OPT_NODL);
+	while (f_read(file, s_LoadFileBuffer, EVE_LOADFILE_BUFFER_SIZE, &blocklen) == FR_OK && blocklen)
+	{
+		if (!EVE_Cmd_wrMem(phost, s_LoadFileBuffer, (blocklen + 3) & ~3U))
+			break;
+	}
+	EVE_Cmd_endFunc(phost);
+	return true;
+}
+#endif
+#endif
+
+/**
+ * @brief Set the volume of file names without a drive prefix
+ *
+ * @param volume EVE_FILE_VOLUME_SD or EVE_FILE_VOLUME_USB
+ * @return true True if ok
+ * @return false False if the volume does not exist
+ */
+bool EVE_Util_setFileVolume(uint8_t volume)
+{
+#if EVE_ENABLE_FATFS
+	char drive[3] = { '0', ':', '\0' };
+
+	drive[0] += volume;
+	if (volume >= FF_VOLUMES || f_chdrive(drive) != FR_OK)
+		return false;
+	s_FileVolume = volume;
+	return true;
+#else
+	return false;
+#endif
+}
+
+/**
+ * @brief Load a JPEG or PNG file into RAM_G using CMD_LOADIMAGE
+ *
+ * @param phost Pointer to Hal context
+ * @param address Address in RAM_G to decode the image to
+ * @param filename File to load
+ * @param format Output format of the decoded image, may be NULL
+ * @param width Width of the decoded image, may be NULL
+ * @param height Height of the decoded image, may be NULL
+ * @return true True if ok
+ * @return false False if error
+ */
+bool EVE_Util_loadImageFileEx(EVE_HalContext *phost, uint32_t address, const char *filename, uint32_t *format, uint32_t *width, uint32_t *height)
+{
+#if EVE_ENABLE_FATFS
+	FIL InfSrc;
+	bool res;
+	uint8_t volume = fileVolume(filename);
+	bool sd = volume == EVE_FILE_VOLUME_SD;
+
+	if (!volumeReady(volume))
+	{
+		eve_printf_debug("%s not ready\n", sd ? "SD card" : "USB stick");
+		return false;
+	}
+
+	if (phost->CmdFault)
+		return false;
+
+	/* Background card users wait until the whole image is streamed, they run from the coprocessor waits.
+	The USB stick has no other users */
+	if (sd && !sdAcquire(SD_CLIENT_ASSET))
+	{
+		eve_printf_debug("SD card busy, cannot open: \"%s\"\n", filename);
+		return false;
+	}
+
+	if (openFile(&InfSrc, filename) != FR_OK)
+	{
+		if (sd)
+			sdRelease(SD_CLIENT_ASSET);
+		eve_printf_debug("Unable to open file: \"%s\"\n", filename);
+		return false;
+	}
+
+#if EVE_LOADFILE_MEDIAFIFO_SIZE
+	res = streamMediaFifo(phost, &InfSrc, address);
+#else
+	res = streamCmdFifo(phost, &InfSrc, address);
+#endif
+	f_close(&InfSrc);
+	if (sd)
+		sdRelease(SD_CLIENT_ASSET);
+
+	/* Image failed to decode, or coprocessor fault */
+	res = EVE_Cmd_waitFlush(phost) && res;
+#if EVE_LOADFILE_MEDIAFIFO_SIZE
+	EVE_MediaFifo_close(phost);
+#endif
+	if (!res)
+		return false;
+
+	if (format)
+		*format = EVE_Hal_rd32(phost, EVE_LOADIMAGE_FORMAT);
+	if (width || height)
+		return EVE_CoCmd_getProps(phost, NULL, width, height);
+	return true;
+#else
+	eve_printf_debug("No filesystem support, cannot open: \"%s\"\n", filename);
+	return false;
+#endif
+}
+
+/**
+ * @brief Load a JPEG or PNG file into RAM_G using CMD_LOADIMAGE
+ *
+ * @param phost Pointer to Hal context
+ * @param address Address in RAM_G to decode the image to
+ * @param filename File to load
+ * @param format Output format of the decoded image, may be NULL
+ * @return true True if ok
+ * @return false False if error
+ */
+bool EVE_Util_loadImageFile(EVE_HalContext *phost, uint32_t address, const char *filename, uint32_t *format)
+{
+	return EVE_Util_loadImageFileEx(phost, address, filename, format, NULL, NULL);
+}
+
+/* end of file */
@@ -99,6 +99,14 @@ static const uint16_t s_DisplayResolutions[EVE_DISPLAY_NB][4] = {
 
 /** VERIFY: Can the emulator handle this? */
 #define TOUCH_DATA_LEN 1172
+/* Layout of c_TouchDataU8: CMD_MEMWRITE holding the touch engine in reset, CMD_INFLATE of the
+   deflated firmware into RAM_JTBOOT, then CMD_MEMWRITE of the touch config and the reset release */
+#define TOUCH_DATA_RESET_LEN 16
+#define TOUCH_DATA_RELEASE_OFS 1140
+/* Inflated firmware as found in RAM_JTBOOT, CRC-32 as computed by CMD_MEMCRC */
+#define TOUCH_FIRMWARE_ADDR 0x30B000UL
+#define TOUCH_FIRMWARE_SIZE 2032
+#define TOUCH_FIRMWARE_CRC 0x3D2D87E8UL
 static eve_progmem_const uint8_t c_TouchDataU8[TOUCH_DATA_LEN] = {
 	26, 255, 255, 255, 32, 32, 48, 0, 4, 0, 0, 0, 2, 0, 0, 0, 34,
 	255, 255, 255, 0, 176, 48, 0, 120, 218, 237, 84, 255, 107, 92,
@@ -194,8 +202,31 @@ static eve_progmem_const uint8_t c_TouchDataU8[TOUCH_DATA_LEN] = {
  */
 static inline void uploadTouchFirmware(EVE_HalContext *phost)
 {
-	/* bug fix pen up section */
-	eve_assert_do(EVE_Cmd_wrProgMem(phost, c_TouchDataU8, TOUCH_DATA_LEN));
+	uint16_t resAddr;
+	uint32_t crc;
+
+	/* Check whether the patch survived in RAM_JTBOOT, as after a warm reset.
+	Issued directly rather than through EVE_CoCmd_memCrc, which can be overridden by hooks */
+	EVE_Cmd_startFunc(phost);
+	EVE_Cmd_wr32(phost, CMD_MEMCRC);
+	EVE_Cmd_wr32(phost, TOUCH_FIRMWARE_ADDR);
+	EVE_Cmd_wr32(phost, TOUCH_FIRMWARE_SIZE);
+	resAddr = EVE_Cmd_moveWp(phost, 4);
+	EVE_Cmd_endFunc(phost);
+	crc = EVE_Cmd_waitFlush(phost) ? EVE_Hal_rd32(phost, RAM_CMD + resAddr) : 0;
+
+	if (crc == TOUCH_FIRMWARE_CRC)
+	{
+		/* Only restart the touch engine on the firmware already present */
+		eve_printf_debug("Touch firmware already present\n");
+		eve_assert_do(EVE_Cmd_wrProgMem(phost, c_TouchDataU8, TOUCH_DATA_RESET_LEN));
+		eve_assert_do(EVE_Cmd_wrProgMem(phost, &c_TouchDataU8[TOUCH_DATA_RELEASE_OFS], TOUCH_DATA_LEN - TOUCH_DATA_RELEASE_OFS));
+	}
+	else
+	{
+		/* bug fix pen up section */
+		eve_assert_do(EVE_Cmd_wrProgMem(phost, c_TouchDataU8, TOUCH_DATA_LEN));
+	}
 	eve_assert_do(EVE_Cmd_waitFlush(phost));
 }
 
@@ -515,6 +546,42 @@ void EVE_Util_configDefaults(EVE_HalContext *phost, EVE_ConfigParameters *config
 
 #define EXTRACT_CHIPID(romChipId) EVE_extendedChipId((((romChipId) >> 8) & 0xFF) | (((romChipId) & (0xFF)) << 8))
 
+/** Scratch location used to verify the SPI channel mode, at the back of RAM_G */
+#define EVE_SPI_VERIFY_ADDR (RAM_G + RAM_G_SIZE - 8)
+
+/**
+ * @brief Verify that the host and EVE agree on the current SPI channel mode
+ *
+ * Reads back a known register and the clock frequency, then round-trips a
+ * test pattern through RAM_G, so that both the wide write and the wide read
+ * path are exercised. The original RAM_G content is restored afterwards.
+ *
+ * @param phost Pointer to Hal context
+ * @param freq Expected value of REG_FREQUENCY
+ * @return true True if the SPI link is working
+ * @return false False if the SPI channel configuration change failed
+ */
+static bool verifySpiChannels(EVE_HalContext *phost, uint32_t freq)
+{
+	uint32_t backup[2];
+	uint32_t readback[2];
+	bool ok;
+
+	if (EVE_Hal_rd8(phost, REG_ID) != 0x7C)
+		return false;
+	if (EVE_Hal_rd32(phost, REG_FREQUENCY) != freq)
+		return false;
+
+	EVE_Hal_rdMem(phost, (uint8_t *)backup, EVE_SPI_VERIFY_ADDR, sizeof(backup));
+	EVE_Hal_wr32(phost, EVE_SPI_VERIFY_ADDR, 0xA55AC33CUL);
+	EVE_Hal_wr32(phost, EVE_SPI_VERIFY_ADDR + 4, 0x0FF01EE1UL);
+	EVE_Hal_rdMem(phost, (uint8_t *)readback, EVE_SPI_VERIFY_ADDR, sizeof(readback));
+	ok = (readback[0] == 0xA55AC33CUL) && (readback[1] == 0x0FF01EE1UL);
+	EVE_Hal_wrMem(phost, EVE_SPI_VERIFY_ADDR, (uint8_t *)backup, sizeof(backup));
+
+	return ok;
+}
+
 /**
  * @brief
  *
@@ -642,6 +709,10 @@ bool EVE_Util_bootup(EVE_HalContext *phost, EVE_BootupParameters *bootup)
 		eve_printf_debug("EVE default clock is %d MHz\n", (unsigned int)(freq / 1000000));
 	}
 
+	/* EVE clock is configured, switch to the runtime SPI clock */
+	EVE_Hal_setSPIClock(phost, bootup->SpiClockDivider);
+	eve_printf_debug("SPI clock %d kHz\n", (unsigned int)(EVE_Hal_spiFrequency(phost) / 1000));
+
 	/* Switch to configured default SPI channel mode */
 	EVE_Hal_setSPI(phost, bootup->SpiChannels, bootup->SpiDummyBytes);
 #ifdef _DEBUG
@@ -658,16 +729,23 @@ bool EVE_Util_bootup(EVE_HalContext *phost, EVE_BootupParameters *bootup)
 #endif
 
 	/* Sanity check after SPI change */
-	if (EVE_Hal_rd32(phost, REG_FREQUENCY) != freq)
+	if (!verifySpiChannels(phost, freq))
 	{
 		eve_printf_debug("SPI channel configuration change failed\n");
 		if (bootup->SpiChannels > EVE_SPI_SINGLE_CHANNEL)
 		{
-			/* Try again with dual channel */
+			/* Try again with one step narrower channel mode, EVE will be back in single channel after the power cycle */
 			--bootup->SpiChannels;
 			eve_printf_debug("Retry with %s channel SPI\n", bootup->SpiChannels ? "Dual" : "Single");
 			return EVE_Util_bootup(phost, bootup);
 		}
+		if (phost->SpiClockDivider < 64)
+		{
+			/* Single channel failed too, try again with half the SPI clock */
+			bootup->SpiClockDivider = phost->SpiClockDivider << 1;
+			eve_printf_debug("Retry with SPI clock divider %d\n", (unsigned int)bootup->SpiClockDivider);
+			return EVE_Util_bootup(phost, bootup);
+		}
 		return false;
 	}
 
@@ -676,6 +754,11 @@ bool EVE_Util_bootup(EVE_HalContext *phost, EVE_BootupParameters *bootup)
 	EVE_Hal_wr16(phost, REG_GPIOX_DIR, 0xffff);
 	EVE_Hal_wr16(phost, REG_GPIOX, 0xffff);
 
+#if EVE_INTERRUPT_WAIT
+	/* Let the command FIFO waits sleep on INT_N */
+	EVE_Hal_enableInterrupts(phost, INT_CMDEMPTY | INT_CMDFLAG | INT_SWAP);
+#endif
+
 	/* Update touch firmware */
 	/* Download new firmware to fix pen up issue */
 	/* It may cause resistive touch not working any more*/
@@ -899,6 +982,11 @@ bool EVE_Util_resetCoprocessor(EVE_HalContext *phost)
 
 	eve_printf_debug("Reset coprocessor\n");
 
+#if EVE_CMD_RECORD
+	/* Recorded commands were meant for the faulted coprocessor */
+	phost->CmdRecordIndex = 0;
+#endif
+
 	/* Set REG_CPURESET to 1, to hold the coprocessor in the reset condition */
 	EVE_Hal_wr8(phost, REG_CPURESET, 1);
 	EVE_Hal_flush(phost);
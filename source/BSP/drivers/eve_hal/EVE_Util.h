@@ -52,6 +52,7 @@ typedef struct EVE_BootupParameters
 	/** SPI */
 	EVE_SPI_CHANNELS_T SpiChannels; /**< Variable to contain single/dual/quad channels */
 	uint8_t SpiDummyBytes; /**< Number of dummy bytes as 1 or 2 for SPI read */
+	uint16_t SpiClockDivider; /**< Host SPI clock divider once the EVE clock is configured, 0 for the platform default */
 
 } EVE_BootupParameters;
 
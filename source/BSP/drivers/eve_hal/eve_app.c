@@ -30,10 +30,18 @@
  */
 
 #include "EVE_Platform.h"
+#include "scheduler.h"
+#include "eve_app.h"
+#include "eve_splash.h"
 
 static EVE_HalContext s_halContext;
 static EVE_HalContext* s_pHalContext;
 
+#define BENCH_PROGMEM_SIZE 1024
+#define BENCH_ITERATIONS 64
+
+static eve_progmem_const uint8_t s_BenchProgMem[BENCH_PROGMEM_SIZE] = { 0 };
+
 static uint32_t a;
 static uint32_t b;
 static uint32_t c;
@@ -41,9 +49,14 @@ static uint32_t d;
 static uint32_t e;
 static uint32_t f;
 
-bool cbCmdWait(struct EVE_HalContext* phost) {
-    (void)(phost); // suspress warning on unused
-    return true;
+/* Bring up the host side of the HAL once, this also starts the EVE_millis clock used to time the boot */
+void Gpu_Initialize(void) {
+    static bool initialized = false;
+    if (!initialized)
+    {
+        EVE_Hal_initialize();
+        initialized = true;
+    }
 }
 
 bool Gpu_Init(void) {
@@ -51,10 +64,11 @@ bool Gpu_Init(void) {
     EVE_HalParameters params;
     s_pHalContext = &s_halContext;
 
-    EVE_Hal_initialize();
+    Gpu_Initialize();
 
     EVE_Hal_defaultsEx(&params, deviceIdx);
-    params.CbCmdWait = cbCmdWait;
+    /* Coprocessor waits run the BSP background work */
+    params.CbCmdWait = sched_cmd_wait;
 
     if (!EVE_Hal_open(s_pHalContext, &params))
     {
@@ -119,6 +133,50 @@ void Calibration_Save(void)
     f = EVE_Hal_rd32(s_pHalContext, REG_TOUCH_TRANSFORM_F);
 }
 
+/* Read the six REG_TOUCH_TRANSFORM coefficients */
+void Calibration_Get(uint32_t *transform)
+{
+    EVE_Hal_rdMem(s_pHalContext, (uint8_t*)transform, REG_TOUCH_TRANSFORM_A, 4 * 6);
+}
+
+/* Write the six REG_TOUCH_TRANSFORM coefficients */
+void Calibration_Set(const uint32_t *transform)
+{
+    EVE_Hal_wrMem(s_pHalContext, REG_TOUCH_TRANSFORM_A, (const uint8_t*)transform, 4 * 6);
+}
+
+/* HAL context opened by Gpu_Init, NULL before */
+EVE_HalContext *Eve_Host(void)
+{
+    return s_pHalContext;
+}
+
+bool Eve_Touched(void)
+{
+    return EVE_Hal_rd32(s_pHalContext, REG_CTOUCH_TOUCH0_XY) != 0x80008000;
+}
+
+bool Eve_Splash(void)
+{
+    /* Nothing else is in RAM_G this early, the application overwrites it once the splash is replaced */
+    if (!EVE_CoCmd_inflate_progMem(s_pHalContext, RAM_G, eve_splash_data, eve_splash_size))
+        return false;
+
+    EVE_CoCmd_dlStart(s_pHalContext);
+    EVE_CoDl_clearColorRgb(s_pHalContext, 0, 0, 0);
+    EVE_CoDl_clear(s_pHalContext, 1, 1, 1);
+    EVE_CoDl_colorRgb(s_pHalContext, 0xff, 0xff, 0xff);
+    EVE_CoDl_bitmapSource(s_pHalContext, RAM_G);
+    EVE_CoDl_bitmapLayout(s_pHalContext, L8, eve_splash_width, eve_splash_height);
+    EVE_CoDl_bitmapSize(s_pHalContext, NEAREST, BORDER, BORDER, eve_splash_width, eve_splash_height);
+    EVE_CoDl_begin(s_pHalContext, BITMAPS);
+    EVE_CoDl_vertex2f_0(s_pHalContext, (s_pHalContext->Width - eve_splash_width) / 2, (s_pHalContext->Height - eve_splash_height) / 2);
+    EVE_CoDl_end(s_pHalContext);
+    EVE_CoDl_display(s_pHalContext);
+    EVE_CoCmd_swap(s_pHalContext);
+    return EVE_Cmd_waitFlush(s_pHalContext);
+}
+
 void EVE_logo(void)
 {
     EVE_CoCmd_dlStart(s_pHalContext);
@@ -129,18 +187,129 @@ void EVE_logo(void)
     EVE_Cmd_waitFlush(s_pHalContext);
 }
 
-void EVE_buzzer(void)
+/* Sound sequencer state, the last written register values avoid rewriting them on every step */
+static const EVE_SoundStep *s_soundPattern = NULL;
+static uint8_t s_soundSteps;
+static uint8_t s_soundStep;
+static uint8_t s_soundRepeat;
+static uint32_t s_soundDue;
+static int16_t s_soundVolume = -1;
+static int32_t s_soundValue = -1;
+
+static void soundWrite(uint16_t sound, uint8_t volume)
 {
-    uint16_t val = (uint16_t)((0xC0 << 8) | 0x50);
-    EVE_Hal_wr8(s_pHalContext, REG_VOL_SOUND, 255);
-    EVE_Hal_wr16(s_pHalContext, REG_SOUND, val);
-    for (uint8_t i = 0; i < 3; i++)
+    if (s_soundVolume != volume)
     {
-        EVE_Hal_wr8(s_pHalContext, REG_PLAY, 1);
-        EVE_sleep(500);
+        EVE_Hal_wr8(s_pHalContext, REG_VOL_SOUND, volume);
+        s_soundVolume = volume;
+    }
+    if (s_soundValue != sound)
+    {
+        EVE_Hal_wr16(s_pHalContext, REG_SOUND, sound);
+        s_soundValue = sound;
     }
-
-    EVE_Hal_wr16(s_pHalContext, REG_SOUND, 0);
     EVE_Hal_wr8(s_pHalContext, REG_PLAY, 1);
 }
 
+static void soundStartStep(uint32_t now)
+{
+    const EVE_SoundStep *step = &s_soundPattern[s_soundStep];
+    soundWrite(step->sound, step->volume);
+    s_soundDue = now + step->duration;
+}
+
+static void soundSilence(void)
+{
+    /* A held note or looping instrument keeps playing until silenced */
+    if (s_soundValue != 0)
+        soundWrite(0, s_soundVolume < 0 ? 0 : (uint8_t)s_soundVolume);
+    s_soundPattern = NULL;
+}
+
+bool EVE_sound_play(const EVE_SoundStep *pattern, uint8_t steps, uint8_t repeat)
+{
+    if (!s_pHalContext || !pattern || !steps)
+        return false;
+
+    s_soundPattern = pattern;
+    s_soundSteps = steps;
+    s_soundStep = 0;
+    s_soundRepeat = repeat;
+    soundStartStep(EVE_millis());
+    return true;
+}
+
+void EVE_sound_stop(void)
+{
+    if (s_soundPattern)
+        soundSilence();
+}
+
+bool EVE_sound_busy(void)
+{
+    return s_soundPattern != NULL;
+}
+
+void EVE_sound_task(void *ctx)
+{
+    uint32_t now;
+    (void)(ctx);
+
+    if (!s_soundPattern)
+        return;
+    now = EVE_millis();
+    if ((int32_t)(now - s_soundDue) < 0)
+        return;
+
+    if (++s_soundStep >= s_soundSteps)
+    {
+        if (!s_soundRepeat)
+        {
+            soundSilence();
+            return;
+        }
+        if (s_soundRepeat != EVE_SOUND_LOOP)
+            --s_soundRepeat;
+        s_soundStep = 0;
+    }
+    soundStartStep(now);
+}
+
+static const EVE_SoundStep s_buzzerPattern[] = {
+    { (uint16_t)((0xC0 << 8) | 0x50), 255, 500 },
+};
+
+void EVE_buzzer(void)
+{
+    EVE_sound_play(s_buzzerPattern, 1, 2);
+}
+
+static void benchmarkPrint(const char *name, uint32_t bytes, uint32_t elapsed)
+{
+    eve_printf("%s: %lu bytes in %lu ms, %lu bytes/s\n", name,
+        (unsigned long)bytes, (unsigned long)elapsed,
+        (unsigned long)(elapsed ? ((uint64_t)bytes * 1000 / elapsed) : 0));
+}
+
+void Eve_Benchmark_ProgMem(void)
+{
+    uint32_t bytes = BENCH_PROGMEM_SIZE * BENCH_ITERATIONS;
+    uint32_t start;
+
+    /* One SPI call per 32-bit word, the way program memory used to be streamed */
+    start = EVE_millis();
+    for (uint32_t i = 0; i < BENCH_ITERATIONS; i++)
+    {
+        EVE_Hal_startTransfer(s_pHalContext, EVE_TRANSFER_WRITE, RAM_G);
+        for (uint32_t j = 0; j < BENCH_PROGMEM_SIZE; j += 4)
+            EVE_Hal_transferProgMem(s_pHalContext, NULL, &s_BenchProgMem[j], 4);
+        EVE_Hal_endTransfer(s_pHalContext);
+    }
+    benchmarkPrint("ProgMem per word", bytes, EVE_millis() - start);
+
+    /* Staged through the bounce buffer in bulk */
+    start = EVE_millis();
+    for (uint32_t i = 0; i < BENCH_ITERATIONS; i++)
+        EVE_Hal_wrProgMem(s_pHalContext, RAM_G, s_BenchProgMem, BENCH_PROGMEM_SIZE);
+    benchmarkPrint("ProgMem bulk", bytes, EVE_millis() - start);
+}
@@ -34,10 +34,43 @@
 
 #include "EVE_Platform.h"
 
+void Gpu_Initialize(void);
 bool Gpu_Init(void);
 bool Eve_Calibrate(void);
+/* Unpack the program memory splash with CMD_INFLATE and swap it in, needs no storage */
+bool Eve_Splash(void);
 void Calibration_Restore(void);
 void Calibration_Save(void);
+void Calibration_Get(uint32_t *transform);
+void Calibration_Set(const uint32_t *transform);
+bool Eve_Touched(void);
+EVE_HalContext *Eve_Host(void);
 
+/* One step of a sound pattern, played with REG_PLAY when the step starts */
+typedef struct
+{
+    uint16_t sound;    /* REG_SOUND value, MIDI note in the high byte and instrument in the low byte, 0 for silence */
+    uint8_t volume;    /* REG_VOL_SOUND */
+    uint16_t duration; /* Milliseconds until the next step */
+} EVE_SoundStep;
+
+/* Repeat count which loops the pattern until EVE_sound_stop */
+#define EVE_SOUND_LOOP 0xFF
+
+/* Start a pattern, replacing the one playing. The pattern must stay valid while it is played.
+ * It is played repeat more times after the first, and silenced after the last step.
+ * Returns false when EVE is not open.
+ */
+bool EVE_sound_play(const EVE_SoundStep *pattern, uint8_t steps, uint8_t repeat);
+void EVE_sound_stop(void);
+bool EVE_sound_busy(void);
+
+/* Advance the pattern, registers are only written when a step starts.
+ * Call from the frame loop, or register as a scheduler task.
+ */
+void EVE_sound_task(void *ctx);
+
+/* Three beeps over 1.5 s, played by EVE_sound_task */
 void EVE_buzzer(void);
+void Eve_Benchmark_ProgMem(void);
 #endif /* APP_H_ */
@@ -0,0 +1,49 @@
+/* Generated by tools/splash_gen.py, 96 x 96 L8 */
+
+#include "eve_splash.h"
+
+const uint16_t eve_splash_width = 96;
+const uint16_t eve_splash_height = 96;
+const uint32_t eve_splash_size = 614;
+
+eve_progmem_const uint8_t eve_splash_data[] = {
+	0x78, 0xDA, 0xBD, 0x5A, 0xA1, 0x8E, 0x83, 0x40, 0x10, 0xC5, 0x93, 0xD4, 0xA3, 0x9B, 0x20, 0xF9,
+	0x84, 0x26, 0x48, 0x10, 0x35, 0xD8, 0x06, 0x87, 0xC5, 0x12, 0x0C, 0x59, 0xBB, 0x9F, 0xD0, 0x20,
+	0xAA, 0xAB, 0xEA, 0x10, 0xFC, 0x00, 0x49, 0x0D, 0x1A, 0xD5, 0xA4, 0x09, 0x3F, 0xD1, 0x90, 0xEC,
+	0x89, 0x4B, 0xAF, 0xED, 0xDD, 0xEC, 0xB2, 0xBB, 0xF0, 0xEE, 0x69, 0x78, 0xA5, 0xB3, 0x3B, 0x6F,
+	0xDE, 0xCE, 0xAC, 0xE3, 0x68, 0x62, 0x13, 0x44, 0x69, 0x5E, 0x56, 0x55, 0x99, 0xA7, 0x51, 0xB0,
+	0x71, 0xD6, 0x84, 0x97, 0xF0, 0x76, 0x14, 0x1F, 0x18, 0x5B, 0x9E, 0x78, 0xAB, 0x90, 0xEF, 0x78,
+	0x2F, 0x24, 0xE8, 0xF9, 0x6E, 0x21, 0x79, 0xC0, 0x6F, 0x42, 0x89, 0x1B, 0x0F, 0xEC, 0xD9, 0x93,
+	0x56, 0x68, 0xA0, 0x4D, 0xEC, 0xD8, 0xD3, 0x5E, 0x68, 0xA2, 0x4F, 0xCD, 0xD9, 0xF7, 0x57, 0x61,
+	0x80, 0xEB, 0xDE, 0x8C, 0x7D, 0x7B, 0x16, 0x86, 0x38, 0x6F, 0x0D, 0xE8, 0xF3, 0x87, 0x30, 0xC6,
+	0x23, 0xD7, 0xDE, 0xEE, 0x17, 0x61, 0x85, 0x8B, 0x5E, 0x42, 0x44, 0xA3, 0xB0, 0xC4, 0x18, 0xE9,
+	0xC4, 0x46, 0x2C, 0xC0, 0x7C, 0x8C, 0xB8, 0x58, 0x04, 0x3E, 0x43, 0x7F, 0x14, 0x0B, 0x71, 0x54,
+	0xD2, 0x9F, 0xC4, 0x62, 0x9C, 0x90, 0x5F, 0xAF, 0xFE, 0x07, 0x5C, 0xAC, 0x02, 0x8E, 0xD8, 0x39,
+	0xF3, 0xBB, 0x28, 0x12, 0xAB, 0x81, 0xCA, 0x03, 0x6F, 0x36, 0xAD, 0x86, 0xA6, 0xE6, 0x8C, 0xF1,
+	0xBA, 0x19, 0x66, 0x13, 0x8D, 0xC8, 0x64, 0xB5, 0x28, 0x74, 0x2C, 0x74, 0x5F, 0xCF, 0xBA, 0x21,
+	0xEB, 0xD4, 0x52, 0x61, 0x14, 0xFC, 0x3B, 0xF3, 0xFF, 0x7E, 0x8F, 0xCF, 0xEE, 0x06, 0x4B, 0xB0,
+	0x95, 0x2B, 0xE6, 0x90, 0xC9, 0xF6, 0x5B, 0x26, 0x0F, 0xD4, 0xE3, 0x97, 0x5C, 0x4B, 0xF5, 0x7E,
+	0x2A, 0x54, 0xF9, 0x58, 0x4C, 0xD2, 0x7A, 0xF0, 0x59, 0xAD, 0x64, 0x8F, 0x35, 0xBE, 0x5A, 0x4F,
+	0xFC, 0x46, 0xF6, 0xE6, 0x47, 0x45, 0x93, 0x15, 0x43, 0x36, 0xAF, 0xB7, 0x4C, 0x56, 0x32, 0xDF,
+	0x4B, 0xB9, 0xE4, 0x99, 0x83, 0x4E, 0xBD, 0x38, 0x48, 0x5E, 0x7E, 0x2B, 0xFA, 0xB4, 0x53, 0x98,
+	0x62, 0xBD, 0x7A, 0x17, 0xD3, 0x8B, 0xD0, 0xBF, 0x7C, 0x0E, 0xFD, 0x01, 0xB1, 0x6E, 0x41, 0x8D,
+	0xE9, 0xF7, 0x7F, 0x7C, 0x51, 0x6B, 0x1F, 0x1C, 0x55, 0x88, 0xDA, 0xA7, 0x09, 0xB4, 0x5D, 0xDA,
+	0xB9, 0x45, 0x0E, 0x14, 0xB2, 0xDC, 0x98, 0x19, 0xA6, 0x46, 0x21, 0xD4, 0x94, 0x85, 0x9D, 0x7C,
+	0x33, 0x7E, 0x9F, 0x5A, 0xE3, 0xDB, 0xB7, 0x01, 0xA7, 0x7E, 0xBA, 0x30, 0xF5, 0x93, 0x05, 0xC5,
+	0xB2, 0x93, 0x85, 0x67, 0x30, 0x37, 0xAC, 0x83, 0x2C, 0x40, 0xD4, 0xE6, 0xCF, 0xCC, 0xF9, 0x33,
+	0x49, 0x0A, 0x78, 0x94, 0x20, 0xDB, 0xF8, 0x79, 0x4A, 0xAE, 0x3D, 0x3A, 0xB9, 0x98, 0x0D, 0x3F,
+	0xA3, 0x53, 0x8C, 0x0A, 0xBF, 0x6F, 0xC3, 0xEF, 0xD3, 0x0B, 0x40, 0x24, 0x6F, 0x67, 0x77, 0xE0,
+	0xE9, 0xC8, 0x14, 0x1E, 0x57, 0x0A, 0x0F, 0x19, 0xA0, 0xD1, 0xD9, 0x10, 0xFF, 0x2A, 0xB4, 0xE3,
+	0x0F, 0x09, 0xAA, 0x0D, 0x25, 0x3E, 0xAE, 0x1D, 0xBF, 0x4B, 0x49, 0x50, 0xB4, 0x4A, 0x72, 0x49,
+	0x53, 0x2C, 0x4A, 0x17, 0x4B, 0x9B, 0x52, 0xE4, 0x52, 0xC2, 0xF7, 0xD4, 0xB6, 0xFC, 0x35, 0xE1,
+	0x83, 0x4A, 0xF3, 0x33, 0x88, 0x89, 0xFF, 0x2E, 0xAB, 0xD5, 0xB6, 0x27, 0xB9, 0x41, 0x2B, 0x34,
+	0x3F, 0x3A, 0x3E, 0xE8, 0xF5, 0x45, 0xEF, 0x4F, 0x74, 0x7E, 0xA1, 0xF5, 0x01, 0xAD, 0x6F, 0x68,
+	0x7D, 0x86, 0xD7, 0x17, 0x74, 0x7D, 0x44, 0xD7, 0x77, 0xB4, 0x3F, 0x41, 0xFB, 0x2B, 0xB8, 0x3F,
+	0x44, 0xFB, 0x5B, 0xB4, 0x3F, 0x87, 0x9F, 0x2F, 0xD0, 0xE7, 0x23, 0xF4, 0xF9, 0x0E, 0x7E, 0x3E,
+	0x45, 0x9F, 0xAF, 0xE1, 0xFD, 0x01, 0x74, 0x7F, 0x03, 0xDE, 0x9F, 0x41, 0xF7, 0x97, 0xE0, 0xFD,
+	0x31, 0x74, 0x7F, 0x0F, 0xDE, 0x9F, 0x84, 0xF7, 0x57, 0xD1, 0xFD, 0x61, 0x78, 0x7F, 0x1B, 0xDE,
+	0x9F, 0x87, 0xCF, 0x17, 0xE0, 0xF3, 0x11, 0xF8, 0x7C, 0x07, 0x3E, 0x9F, 0x82, 0xCF, 0xD7, 0xE0,
+	0xF3, 0x41, 0xF8, 0x7C, 0x13, 0x3E, 0x9F, 0xC5, 0xCF, 0x97, 0xE1, 0xF3, 0x71, 0xFC, 0x7C, 0x1F,
+	0x7F, 0x3F, 0x01, 0x7F, 0xBF, 0x02, 0x7F, 0x3F, 0xE4, 0x1F, 0xEE, 0xB7, 0x3C, 0x61, 0x79, 0x3F,
+	0xE7, 0x0B, 0x5E, 0x16, 0xA7, 0x44,
+};
@@ -0,0 +1,20 @@
+/**
+ * @file eve_splash.h
+ * @brief Boot splash in program memory
+ *
+ * Shown by Eve_Splash as soon as EVE is up, before the SD card is mounted.
+ * The L8 bitmap is compressed with zlib and unpacked by CMD_INFLATE,
+ * eve_splash.c is generated from a greyscale image with tools/splash_gen.py.
+ */
+
+#ifndef EVE_SPLASH_H_
+#define EVE_SPLASH_H_
+
+#include "EVE_Platform.h"
+
+extern const uint16_t eve_splash_width;
+extern const uint16_t eve_splash_height;
+extern const uint32_t eve_splash_size;
+extern eve_progmem_const uint8_t eve_splash_data[];
+
+#endif /* EVE_SPLASH_H_ */
@@ -0,0 +1,817 @@
+/**
+ *  @file filecast.c File distribution to every station of the RS-485 bus
+ *
+ *  @brief
+ *   The master broadcasts a file once, the stations report the blocks they missed, which are sent again
+ **/
+
+#include <stdio.h>
+#include <string.h>
+#include "bsp_debug.h"
+#include "bsp_hwdefs.h"
+#include "ff.h"
+#include "sdcard.h"
+#include "rs485.h"
+#include "modbus.h"
+#include "filecast.h"
+
+#if (FILECAST_QUEUE & (FILECAST_QUEUE - 1)) || FILECAST_QUEUE > 128 || (FILECAST_WINDOW % 8) \
+	|| (6 + FILECAST_BLOCK > MODBUS_FRAME_MAX - 4) || (11 + FILECAST_NAME_MAX > MODBUS_FRAME_MAX - 4)
+#error FILECAST_QUEUE must be a power of two up to 128, FILECAST_WINDOW a multiple of 8, and a block must fit in a frame
+#endif
+
+#define MAX_BLOCKS	  ((FILECAST_MAX_SIZE + FILECAST_BLOCK - 1) / FILECAST_BLOCK)
+#define QUEUE_MASK	  (FILECAST_QUEUE - 1)
+#define CHUNK_SIZE	  (FILECAST_QUEUE * FILECAST_BLOCK)
+#define START_REPEATS 3 /* Start and commit are sent this many times, a station that misses all of them is repaired */
+#define QUERY_RETRIES 2
+#define VERIFY_POLL_MS 200
+
+/* One bit per block, received on a station, still to send on the master */
+static uint32_t blocks[(MAX_BLOCKS + 31) / 32];
+
+/* Blocks waiting for the card on a station, a chunk of the file on the master. Word aligned for the card */
+static uint32_t buffer[CHUNK_SIZE / 4];
+
+static uint32_t (*fc_clock)(void) = NULL;
+static bool fc_master = false;
+static FIL fc_file;
+static bool fc_open = false;
+static char fc_name[FILECAST_NAME_MAX + 1];
+static char fc_temp[FILECAST_NAME_MAX + 5];
+static uint16_t fc_session = 0;
+static uint32_t fc_size = 0;
+static uint32_t fc_crc = 0;
+static uint32_t fc_blocks = 0;
+
+/* Station */
+static filecast_station_t st_state = FILECAST_STATION_IDLE;
+static bool st_opening = false; /* The job closes the file of the previous session and creates the new one */
+static bool st_commit = false;
+static char st_stale[FILECAST_NAME_MAX + 5]; /* Temporary file of an unfinished session */
+static uint32_t st_received = 0;
+static uint32_t st_checked = 0;
+static uint32_t st_crc = 0;
+static uint32_t q_block[FILECAST_QUEUE];
+static uint8_t q_head = 0;
+static uint8_t q_tail = 0;
+
+/* Master */
+typedef enum {
+	M_IDLE,
+	M_OPEN,
+	M_CRC,
+	M_START,
+	M_SEND,
+	M_QUERY,
+	M_COMMIT,
+	M_VERIFY,
+} master_state_t;
+
+static master_state_t m_state = M_IDLE;
+static filecast_status_t m_status = FILECAST_IDLE;
+static uint8_t m_first, m_count;
+static uint16_t m_absent, m_complete, m_failed, m_done; /* One bit per station */
+static uint8_t m_station; /* Index of the station being queried */
+static uint8_t m_windows, m_retries, m_repeats, m_round;
+static bool m_querying, m_resend, m_restart;
+static uint32_t m_from; /* First block of the window asked for */
+static uint32_t m_cursor; /* Next block to send, or the file position while computing the CRC */
+static int32_t m_chunk = -1; /* Chunk of the file in buffer */
+static uint32_t m_idle_since, m_wait_until;
+static uint8_t m_frame[MODBUS_FRAME_MAX - 4];
+static uint8_t m_reply[FILECAST_REPLY_SIZE];
+
+/* CRC-32 one nibble at a time, the same as zlib.crc32 on the host */
+static const uint32_t crc_table[16] = {
+	0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+	0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+};
+
+static uint32_t crc32_update(uint32_t crc, const uint8_t *data, uint32_t len)
+{
+	crc = ~crc;
+	while (len--) {
+		crc ^= *data++;
+		crc = (crc >> 4) ^ crc_table[crc & 0x0F];
+		crc = (crc >> 4) ^ crc_table[crc & 0x0F];
+	}
+	return ~crc;
+}
+
+static uint16_t get16(const uint8_t *p)
+{
+	return (uint16_t)((p[0] << 8) | p[1]);
+}
+
+static uint32_t get32(const uint8_t *p)
+{
+	return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+static void put16(uint8_t *p, uint16_t value)
+{
+	p[0] = (uint8_t)(value >> 8);
+	p[1] = (uint8_t)value;
+}
+
+static void put32(uint8_t *p, uint32_t value)
+{
+	p[0] = (uint8_t)(value >> 24);
+	p[1] = (uint8_t)(value >> 16);
+	p[2] = (uint8_t)(value >> 8);
+	p[3] = (uint8_t)value;
+}
+
+static bool bit_get(uint32_t i)
+{
+	return (blocks[i >> 5] >> (i & 31)) & 1;
+}
+
+static void bit_set(uint32_t i)
+{
+	blocks[i >> 5] |= 1UL << (i & 31);
+}
+
+static void bit_clear(uint32_t i)
+{
+	blocks[i >> 5] &= ~(1UL << (i & 31));
+}
+
+/* First block from i with its bit in the given state, or fc_blocks */
+static uint32_t bit_find(uint32_t i, bool set)
+{
+	uint32_t skip = set ? 0 : 0xFFFFFFFFUL;
+
+	while (i < fc_blocks && bit_get(i) != set) {
+		if (!(i & 31) && blocks[i >> 5] == skip)
+			i += 32;
+		else
+			i++;
+	}
+	return i < fc_blocks ? i : fc_blocks;
+}
+
+static uint32_t block_len(uint32_t i)
+{
+	uint32_t left = fc_size - i * FILECAST_BLOCK;
+	return left < FILECAST_BLOCK ? left : FILECAST_BLOCK;
+}
+
+static void set_names(const char *name, uint32_t len)
+{
+	memcpy(fc_name, name, len);
+	fc_name[len] = '\0';
+	memcpy(fc_temp, fc_name, len);
+	memcpy(fc_temp + len, ".tmp", 5);
+}
+
+/* Station side, the handlers run from modbus_poll and only queue work, the card is written by the job */
+
+static void station_failed(const char *reason)
+{
+	PR_WARN("File \"%s\" not received, %s\n", fc_name, reason);
+	if (fc_open) {
+		f_close(&fc_file);
+		fc_open = false;
+		f_unlink(fc_temp);
+	}
+	st_state = FILECAST_STATION_FAILED;
+}
+
+static bool write_at(uint32_t offset, const void *data, uint32_t len)
+{
+	UINT written;
+
+	return f_lseek(&fc_file, offset) == FR_OK
+		&& f_write(&fc_file, data, len, &written) == FR_OK
+		&& written == len;
+}
+
+/* Runs as a job of the SD_CLIENT_BULK client, writes every queued block per turn */
+static bool station_job(void *ctx)
+{
+	UINT read;
+	uint32_t n;
+
+	(void)(ctx);
+
+	if (st_opening) {
+		st_opening = false;
+		if (fc_open) {
+			f_close(&fc_file);
+			fc_open = false;
+			f_unlink(st_stale);
+		}
+		if (!sdCardReady() || f_open(&fc_file, fc_temp, FA_READ | FA_WRITE | FA_CREATE_ALWAYS) != FR_OK) {
+			station_failed("the file cannot be created");
+			return false;
+		}
+		fc_open = true;
+		/* Contiguous when the card has the space, otherwise the clusters are allocated up front by seeking to the end */
+		if (f_expand(&fc_file, fc_size, 1) != FR_OK && (f_lseek(&fc_file, fc_size) != FR_OK || f_tell(&fc_file) != fc_size)) {
+			station_failed("no space on the card");
+			return false;
+		}
+	}
+
+	if (st_state == FILECAST_STATION_RECEIVING) {
+		while (q_tail != q_head) {
+			uint8_t slot = q_tail & QUEUE_MASK;
+			uint32_t i = q_block[slot];
+			if (!write_at(i * FILECAST_BLOCK, (uint8_t *)buffer + slot * FILECAST_BLOCK, block_len(i))) {
+				station_failed("a write failed");
+				return false;
+			}
+			q_tail++;
+		}
+		if (!st_commit)
+			return false;
+		/* Everything is on the card, read it back for the CRC */
+		st_commit = false;
+		if (f_sync(&fc_file) != FR_OK) {
+			station_failed("a write failed");
+			return false;
+		}
+		st_state = FILECAST_STATION_VERIFYING;
+		st_checked = 0;
+		st_crc = 0;
+		return true;
+	}
+
+	if (st_state != FILECAST_STATION_VERIFYING)
+		return false;
+
+	/* The queue is empty by now, the buffer takes one chunk per turn */
+	n = fc_size - st_checked;
+	if (n > CHUNK_SIZE)
+		n = CHUNK_SIZE;
+	if (f_lseek(&fc_file, st_checked) != FR_OK || f_read(&fc_file, buffer, n, &read) != FR_OK || read != n) {
+		station_failed("a read failed");
+		return false;
+	}
+	st_crc = crc32_update(st_crc, (const uint8_t *)buffer, n);
+	st_checked += n;
+	if (st_checked < fc_size)
+		return true;
+
+	if (st_crc != fc_crc) {
+		station_failed("CRC error");
+		return false;
+	}
+	fc_open = false;
+	if (f_close(&fc_file) != FR_OK) {
+		f_unlink(fc_temp);
+		station_failed("a write failed");
+		return false;
+	}
+	/* The previous file is only removed once the new one is complete */
+	{
+		FRESULT res = f_unlink(fc_name);
+		if ((res != FR_OK && res != FR_NO_FILE) || f_rename(fc_temp, fc_name) != FR_OK) {
+			f_unlink(fc_temp);
+			station_failed("the file cannot be replaced");
+			return false;
+		}
+	}
+	st_state = FILECAST_STATION_DONE;
+	PR_INFO("File \"%s\" received, %lu bytes\n", fc_name, (unsigned long)fc_size);
+	return false;
+}
+
+static void queue_job(void)
+{
+	if (!sdPending(SD_CLIENT_BULK))
+		sdRequest(SD_CLIENT_BULK, station_job, NULL);
+}
+
+static int16_t on_start(uint8_t target, const uint8_t *data, uint32_t len, uint8_t *reply)
+{
+	uint16_t session;
+	uint32_t size;
+
+	(void)(target);
+	(void)(reply);
+	if (len < 11 || !data[10] || data[10] > FILECAST_NAME_MAX || len != 11u + data[10])
+		return -MODBUS_EX_ILLEGAL_VALUE;
+	session = get16(data);
+	if (fc_master || (st_state != FILECAST_STATION_IDLE && session == fc_session))
+		return 0; /* Repeated */
+
+	/* A session that did not finish is dropped, with the blocks still queued */
+	if (fc_open)
+		memcpy(st_stale, fc_temp, sizeof(st_stale));
+	size = get32(data + 2);
+	fc_session = session;
+	fc_size = size;
+	fc_crc = get32(data + 6);
+	fc_blocks = (size + FILECAST_BLOCK - 1) / FILECAST_BLOCK;
+	set_names((const char *)data + 11, data[10]);
+	memset(blocks, 0, sizeof(blocks));
+	q_head = q_tail = 0;
+	st_received = 0;
+	st_commit = false;
+
+	if (!size || size > FILECAST_MAX_SIZE) {
+		PR_WARN("File \"%s\" of %lu bytes is too large\n", fc_name, (unsigned long)size);
+		st_state = FILECAST_STATION_FAILED;
+		return 0;
+	}
+	PR_INFO("Receiving \"%s\", %lu bytes\n", fc_name, (unsigned long)size);
+	st_state = FILECAST_STATION_RECEIVING;
+	st_opening = true;
+	queue_job();
+	return 0;
+}
+
+static int16_t on_data(uint8_t target, const uint8_t *data, uint32_t len, uint8_t *reply)
+{
+	uint32_t i;
+	uint8_t slot;
+
+	(void)(target);
+	(void)(reply);
+	if (fc_master || st_state != FILECAST_STATION_RECEIVING || len < 7 || get16(data) != fc_session)
+		return 0;
+	i = get32(data + 2);
+	if (i >= fc_blocks || len - 6 != block_len(i) || bit_get(i))
+		return 0;
+	/* The card is behind, the block is reported missing and comes again */
+	if ((uint8_t)(q_head - q_tail) >= FILECAST_QUEUE)
+		return 0;
+
+	slot = q_head & QUEUE_MASK;
+	q_block[slot] = i;
+	memcpy((uint8_t *)buffer + slot * FILECAST_BLOCK, data + 6, len - 6);
+	q_head++;
+	bit_set(i);
+	st_received++;
+	queue_job();
+	return 0;
+}
+
+static int16_t on_query(uint8_t target, const uint8_t *data, uint32_t len, uint8_t *reply)
+{
+	uint32_t missing = 0;
+	uint32_t first, k;
+
+	if (fc_master)
+		return -MODBUS_EX_ILLEGAL_FUNCTION;
+	if (target == MODBUS_BROADCAST || len != 6)
+		return -MODBUS_EX_ILLEGAL_VALUE;
+
+	first = get32(data + 2);
+	memset(reply, 0, FILECAST_REPLY_SIZE);
+	if (st_state == FILECAST_STATION_RECEIVING && get16(data) == fc_session) {
+		missing = fc_blocks - st_received;
+		if (missing) {
+			first = bit_find(first, false);
+			for (k = 0; k < FILECAST_WINDOW && first + k < fc_blocks; k++) {
+				if (!bit_get(first + k))
+					reply[11 + (k >> 3)] |= (uint8_t)(1 << (k & 7));
+			}
+		}
+	}
+	put16(reply, fc_session);
+	reply[2] = (uint8_t)st_state;
+	put32(reply + 3, missing);
+	put32(reply + 7, first);
+	return FILECAST_REPLY_SIZE;
+}
+
+static int16_t on_commit(uint8_t target, const uint8_t *data, uint32_t len, uint8_t *reply)
+{
+	(void)(target);
+	(void)(reply);
+	if (len != 2)
+		return -MODBUS_EX_ILLEGAL_VALUE;
+	/* A station still missing blocks waits, the master asks again */
+	if (fc_master || st_state != FILECAST_STATION_RECEIVING || get16(data) != fc_session || st_received != fc_blocks)
+		return 0;
+	st_commit = true;
+	queue_job();
+	return 0;
+}
+
+/* Master side, all in filecast_task */
+
+/* The frames of the master need a silent gap in between, and the bus is shared with the other requests */
+static bool bus_ready(uint32_t now)
+{
+	if (rs485_tx_busy() || modbus_master_status() == MODBUS_MASTER_BUSY) {
+		m_idle_since = now;
+		return false;
+	}
+	return now - m_idle_since >= FILECAST_GAP_MS;
+}
+
+/* Returns 1 once the chunk is in the buffer, 0 while the card is busy, -1 when the read failed */
+static int8_t load_chunk(uint32_t chunk)
+{
+	UINT read;
+	uint32_t offset = chunk * CHUNK_SIZE;
+	uint32_t n = fc_size - offset;
+	bool ok;
+
+	if (m_chunk == (int32_t)chunk)
+		return 1;
+	if (!sdAcquire(SD_CLIENT_BULK))
+		return 0;
+	if (n > CHUNK_SIZE)
+		n = CHUNK_SIZE;
+	ok = f_lseek(&fc_file, offset) == FR_OK && f_read(&fc_file, buffer, n, &read) == FR_OK && read == n;
+	sdRelease(SD_CLIENT_BULK);
+	if (!ok)
+		return -1;
+	m_chunk = (int32_t)chunk;
+	return 1;
+}
+
+static void master_finish(filecast_status_t status)
+{
+	uint8_t i, done = 0;
+
+	if (fc_open) {
+		f_close(&fc_file); /* Read only, nothing is written back */
+		fc_open = false;
+	}
+	for (i = 0; i < m_count; i++) {
+		if (m_done & (1u << i))
+			done++;
+	}
+	if (status == FILECAST_DONE && (m_failed || !m_done))
+		status = FILECAST_FAILED;
+	PR_INFO("File \"%s\" distributed to %d of %d stations\n", fc_name, done, m_count);
+	m_status = status;
+	m_state = M_IDLE;
+}
+
+/* Runs the query of the current station from m_from. Returns 1 with the reply in m_reply,
+ * 0 while it is not sent or not answered yet, -1 when the station did not answer
+ */
+static int8_t query(uint32_t now)
+{
+	modbus_master_status_t status;
+
+	if (!m_querying) {
+		if (!bus_ready(now))
+			return 0;
+		put16(m_frame, fc_session);
+		put32(m_frame + 2, m_from);
+		m_querying = modbus_master_request(m_first + m_station, FILECAST_FC_QUERY, m_frame, 6, m_reply, sizeof(m_reply));
+		return 0;
+	}
+
+	status = modbus_master_status();
+	if (status == MODBUS_MASTER_BUSY)
+		return 0;
+	m_querying = false;
+	if (status == MODBUS_MASTER_DONE && modbus_master_reply_len() == FILECAST_REPLY_SIZE) {
+		m_retries = 0;
+		return 1;
+	}
+	if (++m_retries < QUERY_RETRIES)
+		return 0;
+	m_retries = 0;
+	return -1;
+}
+
+static void next_station(void)
+{
+	m_station++;
+	m_from = 0;
+	m_windows = 0;
+	m_retries = 0;
+}
+
+static void begin_round(void)
+{
+	m_station = 0;
+	m_from = 0;
+	m_windows = 0;
+	m_retries = 0;
+	m_resend = false;
+	m_restart = false;
+	m_state = M_QUERY;
+}
+
+static void begin_commit(void)
+{
+	m_repeats = 0;
+	m_state = M_COMMIT;
+}
+
+static void end_round(uint32_t now)
+{
+	uint16_t waiting;
+
+	if (!m_resend && !m_restart) {
+		if (m_complete)
+			begin_commit();
+		else
+			master_finish(FILECAST_FAILED);
+		return;
+	}
+
+	if (++m_round > FILECAST_MAX_ROUNDS) {
+		waiting = (uint16_t)(((1u << m_count) - 1) & ~(m_absent | m_complete | m_failed));
+		PR_WARN("Stations still missing blocks after %d rounds are left out\n", FILECAST_MAX_ROUNDS);
+		m_failed |= waiting;
+		if (m_complete)
+			begin_commit();
+		else
+			master_finish(FILECAST_FAILED);
+		return;
+	}
+
+	m_cursor = 0;
+	m_wait_until = now;
+	if (m_restart) {
+		/* A station missed the start, it reports every block missing from the next round on */
+		m_repeats = 0;
+		m_state = M_START;
+	}
+	else {
+		m_state = M_SEND;
+	}
+}
+
+static void query_step(uint32_t now)
+{
+	uint16_t bit;
+	uint32_t missing, first, k, covered = 0;
+	int8_t result;
+
+	while (m_station < m_count && ((m_absent | m_complete | m_failed) & (1u << m_station)))
+		next_station();
+	if (m_station >= m_count) {
+		end_round(now);
+		return;
+	}
+
+	bit = (uint16_t)(1u << m_station);
+	result = query(now);
+	if (result == 0)
+		return;
+	if (result < 0) {
+		PR_WARN("Station %d does not answer, left out\n", m_first + m_station);
+		m_absent |= bit;
+		next_station();
+		return;
+	}
+
+	if (get16(m_reply) != fc_session) {
+		m_restart = true;
+		next_station();
+		return;
+	}
+	if (m_reply[2] == FILECAST_STATION_FAILED) {
+		PR_WARN("Station %d failed to store the file\n", m_first + m_station);
+		m_failed |= bit;
+		next_station();
+		return;
+	}
+	missing = get32(m_reply + 3);
+	if (!missing) {
+		m_complete |= bit;
+		next_station();
+		return;
+	}
+
+	/* The blocks missed by every station are sent once in the next round */
+	first = get32(m_reply + 7);
+	for (k = 0; k < FILECAST_WINDOW && first + k < fc_blocks; k++) {
+		if (m_reply[11 + (k >> 3)] & (1 << (k & 7))) {
+			bit_set(first + k);
+			covered++;
+		}
+	}
+	m_resend = true;
+	if (++m_windows < FILECAST_WINDOWS_PER_ROUND && covered < missing && first + FILECAST_WINDOW < fc_blocks)
+		m_from = first + FILECAST_WINDOW;
+	else
+		next_station();
+}
+
+static void verify_step(uint32_t now)
+{
+	uint16_t waiting = m_complete & ~(m_done | m_failed);
+	uint16_t bit;
+	int8_t result;
+
+	if (!waiting) {
+		master_finish(FILECAST_DONE);
+		return;
+	}
+	if ((int32_t)(now - m_wait_until) >= 0) {
+		PR_WARN("Stations did not finish checking the file\n");
+		m_failed |= waiting;
+		master_finish(FILECAST_FAILED);
+		return;
+	}
+
+	if (m_station >= m_count)
+		m_station = 0;
+	bit = (uint16_t)(1u << m_station);
+	if (!(waiting & bit)) {
+		m_station++;
+		return;
+	}
+	if (!m_querying && (int32_t)(now - m_idle_since) < VERIFY_POLL_MS)
+		return;
+
+	result = query(now);
+	if (result == 0)
+		return;
+	if (result > 0) {
+		if (m_reply[2] == FILECAST_STATION_DONE)
+			m_done |= bit;
+		else if (m_reply[2] != FILECAST_STATION_VERIFYING)
+			m_failed |= bit;
+	}
+	m_station++;
+}
+
+static void master_step(uint32_t now)
+{
+	uint32_t i, n;
+	int8_t loaded;
+	bool ok;
+
+	switch (m_state) {
+	case M_IDLE:
+		return;
+
+	case M_OPEN:
+		if (!sdAcquire(SD_CLIENT_BULK))
+			return;
+		if (fc_open)
+			f_close(&fc_file);
+		fc_open = sdCardReady() && f_open(&fc_file, fc_name, FA_READ) == FR_OK;
+		sdRelease(SD_CLIENT_BULK);
+		fc_size = fc_open ? f_size(&fc_file) : 0;
+		if (!fc_size || fc_size > FILECAST_MAX_SIZE) {
+			PR_WARN("File \"%s\" missing, empty or too large to distribute\n", fc_name);
+			master_finish(FILECAST_FAILED);
+			return;
+		}
+		fc_blocks = (fc_size + FILECAST_BLOCK - 1) / FILECAST_BLOCK;
+		fc_crc = 0;
+		m_cursor = 0;
+		m_chunk = -1;
+		m_state = M_CRC;
+		return;
+
+	case M_CRC:
+		/* One chunk per run, the stations check the file they wrote against it */
+		loaded = load_chunk(m_cursor / CHUNK_SIZE);
+		if (loaded == 0)
+			return;
+		if (loaded < 0) {
+			master_finish(FILECAST_FAILED);
+			return;
+		}
+		n = fc_size - m_cursor;
+		if (n > CHUNK_SIZE)
+			n = CHUNK_SIZE;
+		fc_crc = crc32_update(fc_crc, (const uint8_t *)buffer, n);
+		m_cursor += n;
+		if (m_cursor < fc_size)
+			return;
+
+		/* Every block is sent once, then only those reported missing */
+		memset(blocks, 0, sizeof(blocks));
+		for (i = 0; i < fc_blocks; i++)
+			bit_set(i);
+		fc_session = (uint16_t)((fc_session + 1) ^ now);
+		if (!fc_session)
+			fc_session = 1;
+		m_absent = m_complete = m_failed = m_done = 0;
+		m_round = 0;
+		m_querying = false;
+		m_repeats = 0;
+		m_state = M_START;
+		PR_INFO("Distributing \"%s\", %lu bytes to %d stations\n", fc_name, (unsigned long)fc_size, m_count);
+		return;
+
+	case M_START:
+		if (!bus_ready(now))
+			return;
+		n = strlen(fc_name);
+		put16(m_frame, fc_session);
+		put32(m_frame + 2, fc_size);
+		put32(m_frame + 6, fc_crc);
+		m_frame[10] = (uint8_t)n;
+		memcpy(m_frame + 11, fc_name, n);
+		if (!modbus_master_broadcast(FILECAST_FC_START, m_frame, 11 + n) || ++m_repeats < START_REPEATS)
+			return;
+		m_cursor = 0;
+		m_wait_until = now + FILECAST_OPEN_MS;
+		m_state = M_SEND;
+		return;
+
+	case M_SEND:
+		if ((int32_t)(now - m_wait_until) < 0)
+			return;
+		m_cursor = bit_find(m_cursor, true);
+		if (m_cursor >= fc_blocks) {
+			begin_round();
+			return;
+		}
+		if (!bus_ready(now))
+			return;
+		loaded = load_chunk(m_cursor / FILECAST_QUEUE);
+		if (loaded == 0)
+			return;
+		if (loaded < 0) {
+			master_finish(FILECAST_FAILED);
+			return;
+		}
+		n = block_len(m_cursor);
+		put16(m_frame, fc_session);
+		put32(m_frame + 2, m_cursor);
+		memcpy(m_frame + 6, (const uint8_t *)buffer + (m_cursor & QUEUE_MASK) * FILECAST_BLOCK, n);
+		if (modbus_master_broadcast(FILECAST_FC_DATA, m_frame, 6 + n)) {
+			bit_clear(m_cursor);
+			m_cursor++;
+		}
+		return;
+
+	case M_QUERY:
+		query_step(now);
+		return;
+
+	case M_COMMIT:
+		if (!bus_ready(now))
+			return;
+		put16(m_frame, fc_session);
+		ok = modbus_master_broadcast(FILECAST_FC_COMMIT, m_frame, 2);
+		if (!ok || ++m_repeats < START_REPEATS)
+			return;
+		m_station = 0;
+		m_wait_until = now + FILECAST_VERIFY_MS;
+		m_state = M_VERIFY;
+		return;
+
+	case M_VERIFY:
+		verify_step(now);
+		return;
+	}
+}
+
+void filecast_init(bool master, uint32_t (*clock)(void))
+{
+	fc_clock = clock;
+	filecast_set_master(master);
+	modbus_set_function(FILECAST_FC_START, on_start);
+	modbus_set_function(FILECAST_FC_DATA, on_data);
+	modbus_set_function(FILECAST_FC_QUERY, on_query);
+	modbus_set_function(FILECAST_FC_COMMIT, on_commit);
+}
+
+void filecast_set_master(bool master)
+{
+	if (master == fc_master)
+		return;
+	/* A transfer in either role is dropped, an open file is closed on the next one */
+	if (m_status == FILECAST_BUSY)
+		m_status = FILECAST_FAILED;
+	m_state = M_IDLE;
+	m_querying = false;
+	st_state = FILECAST_STATION_IDLE;
+	st_commit = false;
+	q_head = q_tail = 0;
+	fc_master = master;
+}
+
+bool filecast_send(const char *filename, uint8_t first, uint8_t count)
+{
+	uint32_t len = strlen(filename);
+
+	if (!fc_master || m_state != M_IDLE || !len || len > FILECAST_NAME_MAX || !count || count > 16)
+		return false;
+	set_names(filename, len);
+	m_first = first;
+	m_count = count;
+	m_done = 0;
+	m_status = FILECAST_BUSY;
+	m_state = M_OPEN;
+	return true;
+}
+
+filecast_status_t filecast_status(void)
+{
+	return m_status;
+}
+
+uint16_t filecast_stations_done(void)
+{
+	return m_done;
+}
+
+void filecast_task(void *ctx)
+{
+	(void)(ctx);
+	if (fc_master)
+		master_step(fc_clock());
+}
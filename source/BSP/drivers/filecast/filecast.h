@@ -0,0 +1,109 @@
+/**
+ *  @file filecast.h File distribution to every station of the RS-485 bus
+ *
+ *  @brief
+ *   The master broadcasts a file once, the stations report the blocks they missed, which are sent again
+ **/
+
+#ifndef __FILECAST_H__
+#define __FILECAST_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Modbus user defined function codes, all fields are big endian */
+#define FILECAST_FC_START  0x42 /* Broadcast: session u16, size u32, CRC-32 u32, name length u8, name */
+#define FILECAST_FC_DATA   0x43 /* Broadcast: session u16, block u32, FILECAST_BLOCK bytes, less for the last block */
+#define FILECAST_FC_QUERY  0x44 /* To one station: session u16, first block u32 */
+#define FILECAST_FC_COMMIT 0x45 /* Broadcast: session u16, check the file and replace the target with it */
+
+/* The reply to FILECAST_FC_QUERY:
+ *   u16 session of the station
+ *   u8  filecast_station_t
+ *   u32 blocks missing in total
+ *   u32 first missing block at or after the one asked for
+ *   FILECAST_WINDOW / 8 bytes, one bit per block from the first missing one set when it is missing, LSB first
+ */
+#define FILECAST_REPLY_SIZE (11 + FILECAST_WINDOW / 8)
+
+/* Data bytes per frame, a frame takes about 12 ms at 115200 baud */
+#ifndef FILECAST_BLOCK
+#define FILECAST_BLOCK 128
+#endif
+
+/* Largest file, the stations keep one bit per block */
+#ifndef FILECAST_MAX_SIZE
+#define FILECAST_MAX_SIZE (2UL * 1024 * 1024)
+#endif
+
+/* Blocks waiting for the card on a station, also the size of the reads on the master. A power of two */
+#ifndef FILECAST_QUEUE
+#define FILECAST_QUEUE 16
+#endif
+
+/* Blocks reported per query, a multiple of 8 */
+#ifndef FILECAST_WINDOW
+#define FILECAST_WINDOW 256
+#endif
+
+/* Queries per station and repair round, more windows are reported in the next round */
+#ifndef FILECAST_WINDOWS_PER_ROUND
+#define FILECAST_WINDOWS_PER_ROUND 8
+#endif
+
+/* Repair rounds before the stations still missing blocks are given up */
+#ifndef FILECAST_MAX_ROUNDS
+#define FILECAST_MAX_ROUNDS 32
+#endif
+
+/* Silence between the frames of the master, above the 1.75 ms Modbus frame gap on a millisecond clock */
+#ifndef FILECAST_GAP_MS
+#define FILECAST_GAP_MS 3
+#endif
+
+/* Time the stations get to create the file after the start before the data follows, and to check it after
+ * the commit
+ */
+#ifndef FILECAST_OPEN_MS
+#define FILECAST_OPEN_MS 1000
+#endif
+#ifndef FILECAST_VERIFY_MS
+#define FILECAST_VERIFY_MS 30000
+#endif
+
+#define FILECAST_NAME_MAX 32
+
+typedef enum {
+	FILECAST_STATION_IDLE = 0,
+	FILECAST_STATION_RECEIVING,
+	FILECAST_STATION_VERIFYING,
+	FILECAST_STATION_DONE,
+	FILECAST_STATION_FAILED, /* SD card not ready, no space, a write failed or the CRC did not match */
+} filecast_station_t;
+
+typedef enum {
+	FILECAST_IDLE = 0,
+	FILECAST_BUSY,
+	FILECAST_DONE, /* Every station that answered has the file */
+	FILECAST_FAILED, /* The file could not be read, or at least one station does not have it */
+} filecast_status_t;
+
+/* Register the function codes with the Modbus engine, which must be initialised. Stations write
+ * the blocks as jobs of the SD_CLIENT_BULK client, so sdArbiterTask must run.
+ */
+void filecast_init(bool master, uint32_t (*clock)(void));
+void filecast_set_master(bool master);
+
+/* Master, distribute a file of the card to the stations first .. first + count - 1, which write it
+ * under the same name. The file is opened by filecast_task. Returns false while busy.
+ */
+bool filecast_send(const char *filename, uint8_t first, uint8_t count);
+filecast_status_t filecast_status(void);
+
+/* Stations that have the file after the last distribution, bit 0 for the first */
+uint16_t filecast_stations_done(void);
+
+/* Scheduler task, run on every pump */
+void filecast_task(void *ctx);
+
+#endif /* __FILECAST_H__ */
@@ -0,0 +1,497 @@
+/**
+ *  @file modbus.c Modbus RTU engine on the RS-485 driver
+ *
+ *  @brief
+ *   Slave and master for holding registers, frames are parsed in place from the RX ring
+ **/
+
+#include <stdio.h>
+#include <string.h>
+#include "bsp_debug.h"
+#include "bsp_hwdefs.h"
+#include "rs485.h"
+#include "modbus.h"
+
+/* Inter-frame gap above 19200 baud, fixed by the Modbus serial line specification */
+#define T35_FIXED_US 1750
+#define T35_FIXED_BAUD 19200
+
+/* CRC-16/MODBUS, reflected polynomial 0xA001 */
+static const uint16_t crc_table[256] = {
+	0x0000, 0xC0C1, 0xC181, 0x0140, 0xC301, 0x03C0, 0x0280, 0xC241,
+	0xC601, 0x06C0, 0x0780, 0xC741, 0x0500, 0xC5C1, 0xC481, 0x0440,
+	0xCC01, 0x0CC0, 0x0D80, 0xCD41, 0x0F00, 0xCFC1, 0xCE81, 0x0E40,
+	0x0A00, 0xCAC1, 0xCB81, 0x0B40, 0xC901, 0x09C0, 0x0880, 0xC841,
+	0xD801, 0x18C0, 0x1980, 0xD941, 0x1B00, 0xDBC1, 0xDA81, 0x1A40,
+	0x1E00, 0xDEC1, 0xDF81, 0x1F40, 0xDD01, 0x1DC0, 0x1C80, 0xDC41,
+	0x1400, 0xD4C1, 0xD581, 0x1540, 0xD701, 0x17C0, 0x1680, 0xD641,
+	0xD201, 0x12C0, 0x1380, 0xD341, 0x1100, 0xD1C1, 0xD081, 0x1040,
+	0xF001, 0x30C0, 0x3180, 0xF141, 0x3300, 0xF3C1, 0xF281, 0x3240,
+	0x3600, 0xF6C1, 0xF781, 0x3740, 0xF501, 0x35C0, 0x3480, 0xF441,
+	0x3C00, 0xFCC1, 0xFD81, 0x3D40, 0xFF01, 0x3FC0, 0x3E80, 0xFE41,
+	0xFA01, 0x3AC0, 0x3B80, 0xFB41, 0x3900, 0xF9C1, 0xF881, 0x3840,
+	0x2800, 0xE8C1, 0xE981, 0x2940, 0xEB01, 0x2BC0, 0x2A80, 0xEA41,
+	0xEE01, 0x2EC0, 0x2F80, 0xEF41, 0x2D00, 0xEDC1, 0xEC81, 0x2C40,
+	0xE401, 0x24C0, 0x2580, 0xE541, 0x2700, 0xE7C1, 0xE681, 0x2640,
+	0x2200, 0xE2C1, 0xE381, 0x2340, 0xE101, 0x21C0, 0x2080, 0xE041,
+	0xA001, 0x60C0, 0x6180, 0xA141, 0x6300, 0xA3C1, 0xA281, 0x6240,
+	0x6600, 0xA6C1, 0xA781, 0x6740, 0xA501, 0x65C0, 0x6480, 0xA441,
+	0x6C00, 0xACC1, 0xAD81, 0x6D40, 0xAF01, 0x6FC0, 0x6E80, 0xAE41,
+	0xAA01, 0x6AC0, 0x6B80, 0xAB41, 0x6900, 0xA9C1, 0xA881, 0x6840,
+	0x7800, 0xB8C1, 0xB981, 0x7940, 0xBB01, 0x7BC0, 0x7A80, 0xBA41,
+	0xBE01, 0x7EC0, 0x7F80, 0xBF41, 0x7D00, 0xBDC1, 0xBC81, 0x7C40,
+	0xB401, 0x74C0, 0x7580, 0xB541, 0x7700, 0xB7C1, 0xB681, 0x7640,
+	0x7200, 0xB2C1, 0xB381, 0x7340, 0xB101, 0x71C0, 0x7080, 0xB041,
+	0x5000, 0x90C1, 0x9181, 0x5140, 0x9301, 0x53C0, 0x5280, 0x9241,
+	0x9601, 0x56C0, 0x5780, 0x9741, 0x5500, 0x95C1, 0x9481, 0x5440,
+	0x9C01, 0x5CC0, 0x5D80, 0x9D41, 0x5F00, 0x9FC1, 0x9E81, 0x5E40,
+	0x5A00, 0x9AC1, 0x9B81, 0x5B40, 0x9901, 0x59C0, 0x5880, 0x9841,
+	0x8801, 0x48C0, 0x4980, 0x8941, 0x4B00, 0x8BC1, 0x8A81, 0x4A40,
+	0x4E00, 0x8EC1, 0x8F81, 0x4F40, 0x8D01, 0x4DC0, 0x4C80, 0x8C41,
+	0x4400, 0x84C1, 0x8581, 0x4540, 0x8701, 0x47C0, 0x4680, 0x8641,
+	0x8201, 0x42C0, 0x4380, 0x8341, 0x4100, 0x81C1, 0x8081, 0x4040,
+};
+
+static const modbus_config_t *cfg = NULL;
+static uint8_t station = 0;
+static uint16_t t35_us = T35_FIXED_US;
+static uint32_t frame_errors = 0;
+static uint8_t tx_frame[MODBUS_FRAME_MAX];
+
+/* User defined functions get the frame as one block, the RX ring may wrap inside it */
+static uint8_t rx_frame[MODBUS_FRAME_MAX];
+static struct {
+	uint8_t fc;
+	modbus_function_t fn;
+} user_functions[MODBUS_USER_FUNCTIONS];
+static uint32_t frame_time = 0;
+
+/* Updated by the RS-485 RX interrupt, every byte restarts the inter-frame gap */
+static volatile uint16_t last_rx_us = 0;
+static volatile uint32_t frame_len = 0;
+static volatile uint32_t frame_start = 0;
+
+static volatile modbus_master_status_t master_status = MODBUS_MASTER_IDLE;
+static uint8_t master_slave;
+static uint8_t master_fc;
+static uint16_t master_count;
+static uint16_t *master_dest;
+static uint8_t *master_reply;
+static uint32_t master_reply_max;
+static uint32_t master_reply_len;
+static uint32_t master_sent;
+
+static uint16_t gap_clock(void)
+{
+	uint16_t value = 0;
+	timer_read(MODBUS_TIMER, &value);
+	return value;
+}
+
+static void modbus_rx_hook(void)
+{
+	last_rx_us = gap_clock();
+	if (!frame_len && cfg->clock)
+		frame_start = cfg->clock();
+	frame_len++;
+}
+
+static uint16_t rx16(uint32_t offset)
+{
+	return (uint16_t)((rs485_peek(offset) << 8) | rs485_peek(offset + 1));
+}
+
+static void put16(uint8_t *p, uint16_t value)
+{
+	p[0] = (uint8_t)(value >> 8);
+	p[1] = (uint8_t)value;
+}
+
+uint16_t modbus_crc16(const uint8_t *data, uint32_t len)
+{
+	uint16_t crc = 0xFFFF;
+	while (len--)
+		crc = (crc >> 8) ^ crc_table[(crc ^ *data++) & 0xFF];
+	return crc;
+}
+
+/* Over a whole frame including its CRC the result is zero */
+static uint16_t crc_ring(uint32_t len)
+{
+	uint16_t crc = 0xFFFF;
+	uint32_t i;
+	for (i = 0; i < len; i++)
+		crc = (crc >> 8) ^ crc_table[(crc ^ rs485_peek(i)) & 0xFF];
+	return crc;
+}
+
+static void send_frame(uint32_t len)
+{
+	uint16_t crc = modbus_crc16(tx_frame, len);
+	tx_frame[len++] = (uint8_t)crc;
+	tx_frame[len++] = (uint8_t)(crc >> 8);
+	rs485_write(tx_frame, len);
+}
+
+static const modbus_register_t *find_register(uint16_t address)
+{
+	int lo = 0;
+	int hi = (int)cfg->count - 1;
+
+	while (lo <= hi) {
+		int mid = (lo + hi) >> 1;
+		const modbus_register_t *reg = &cfg->registers[mid];
+		if (reg->address == address)
+			return reg;
+		if (reg->address < address)
+			lo = mid + 1;
+		else
+			hi = mid - 1;
+	}
+	return NULL;
+}
+
+static uint8_t read_holding(uint32_t len, uint32_t *reply_len)
+{
+	uint16_t start, count, i;
+
+	if (len != 8)
+		return MODBUS_EX_ILLEGAL_VALUE;
+	start = rx16(2);
+	count = rx16(4);
+	if (count == 0 || count > MODBUS_READ_MAX)
+		return MODBUS_EX_ILLEGAL_VALUE;
+
+	tx_frame[2] = (uint8_t)(count * 2);
+	for (i = 0; i < count; i++) {
+		const modbus_register_t *reg = find_register((uint16_t)(start + i));
+		if (!reg)
+			return MODBUS_EX_ILLEGAL_ADDRESS;
+		put16(&tx_frame[3 + i * 2], *reg->value);
+	}
+	*reply_len = 3 + count * 2;
+	return 0;
+}
+
+static uint8_t write_single(uint32_t len, uint32_t *reply_len)
+{
+	const modbus_register_t *reg;
+
+	if (len != 8)
+		return MODBUS_EX_ILLEGAL_VALUE;
+	reg = find_register(rx16(2));
+	if (!reg || !reg->writable)
+		return MODBUS_EX_ILLEGAL_ADDRESS;
+
+	*reg->value = rx16(4);
+	if (cfg->on_write)
+		cfg->on_write(reg->address);
+
+	/* The reply echoes the request */
+	put16(&tx_frame[2], reg->address);
+	put16(&tx_frame[4], *reg->value);
+	*reply_len = 6;
+	return 0;
+}
+
+static uint8_t write_multiple(uint32_t len, uint32_t *reply_len)
+{
+	uint16_t start, count, i;
+
+	if (len < 9)
+		return MODBUS_EX_ILLEGAL_VALUE;
+	start = rx16(2);
+	count = rx16(4);
+	if (count == 0 || count > MODBUS_WRITE_MAX || rs485_peek(6) != count * 2 || len != 9u + count * 2)
+		return MODBUS_EX_ILLEGAL_VALUE;
+
+	/* All or nothing, check every target before writing */
+	for (i = 0; i < count; i++) {
+		const modbus_register_t *reg = find_register((uint16_t)(start + i));
+		if (!reg || !reg->writable)
+			return MODBUS_EX_ILLEGAL_ADDRESS;
+	}
+	for (i = 0; i < count; i++) {
+		const modbus_register_t *reg = find_register((uint16_t)(start + i));
+		*reg->value = rx16(7 + i * 2);
+		if (cfg->on_write)
+			cfg->on_write(reg->address);
+	}
+
+	put16(&tx_frame[2], start);
+	put16(&tx_frame[4], count);
+	*reply_len = 6;
+	return 0;
+}
+
+static modbus_function_t find_function(uint8_t fc)
+{
+	uint8_t i;
+	for (i = 0; i < MODBUS_USER_FUNCTIONS; i++) {
+		if (user_functions[i].fn && user_functions[i].fc == fc)
+			return user_functions[i].fn;
+	}
+	return NULL;
+}
+
+static uint8_t user_function(modbus_function_t fn, uint32_t len, uint32_t *reply_len)
+{
+	uint32_t i;
+	int16_t result;
+
+	for (i = 2; i < len - 2; i++)
+		rx_frame[i - 2] = rs485_peek(i);
+	result = fn(rs485_peek(0), rx_frame, len - 4, &tx_frame[2]);
+	if (result < 0)
+		return (uint8_t)-result;
+	*reply_len = 2 + (uint32_t)result;
+	return 0;
+}
+
+/* len is that of the whole frame, including the CRC */
+static void serve_request(uint32_t len)
+{
+	uint8_t target = rs485_peek(0);
+	uint8_t fc = rs485_peek(1);
+	uint32_t reply_len = 0;
+	uint8_t ex;
+
+	if (target != station && target != MODBUS_BROADCAST)
+		return;
+
+	switch (fc) {
+	case MODBUS_FC_READ_HOLDING:
+		ex = read_holding(len, &reply_len);
+		break;
+	case MODBUS_FC_WRITE_SINGLE:
+		ex = write_single(len, &reply_len);
+		break;
+	case MODBUS_FC_WRITE_MULTIPLE:
+		ex = write_multiple(len, &reply_len);
+		break;
+	default: {
+		modbus_function_t fn = find_function(fc);
+		ex = fn ? user_function(fn, len, &reply_len) : MODBUS_EX_ILLEGAL_FUNCTION;
+		break;
+	}
+	}
+
+	/* Broadcasts are never answered */
+	if (target == MODBUS_BROADCAST)
+		return;
+
+	tx_frame[0] = station;
+	if (ex) {
+		tx_frame[1] = fc | 0x80;
+		tx_frame[2] = ex;
+		reply_len = 3;
+	}
+	else {
+		tx_frame[1] = fc;
+	}
+	send_frame(reply_len);
+}
+
+static void handle_reply(uint32_t len)
+{
+	uint16_t i;
+
+	if (rs485_peek(0) != master_slave)
+		return;
+
+	if (rs485_peek(1) == (master_fc | 0x80)) {
+		master_status = MODBUS_MASTER_EXCEPTION;
+		return;
+	}
+	if (rs485_peek(1) != master_fc)
+		return;
+
+	if (master_reply) {
+		/* User defined function, the data between the function code and the CRC */
+		uint32_t n = len - 4;
+		if (n > master_reply_max)
+			n = master_reply_max;
+		for (i = 0; i < n; i++)
+			master_reply[i] = rs485_peek(2 + i);
+		master_reply_len = len - 4;
+	}
+	else if (master_fc == MODBUS_FC_READ_HOLDING) {
+		if (len != 5u + master_count * 2 || rs485_peek(2) != master_count * 2)
+			return;
+		for (i = 0; i < master_count; i++)
+			master_dest[i] = rx16(3 + i * 2);
+	}
+	else if (len != 8) {
+		return;
+	}
+	master_status = MODBUS_MASTER_DONE;
+}
+
+void modbus_init(const modbus_config_t *config)
+{
+	uint32_t baud = rs485_baud();
+
+	cfg = config;
+	station = config->address;
+	/* 3.5 characters of 11 bits */
+	t35_us = (baud > T35_FIXED_BAUD || baud == 0) ? T35_FIXED_US : (uint16_t)(38500000UL / baud);
+	master_status = MODBUS_MASTER_IDLE;
+	frame_len = 0;
+
+	/* Free running 1 us counter, sharing the prescaler with the millisecond timer */
+	timer_prescaler(FT900_TIMER_PRESCALE_VALUE);
+	timer_init(MODBUS_TIMER, 0xFFFF, timer_direction_up, timer_prescaler_select_on, timer_mode_continuous);
+	timer_start(MODBUS_TIMER);
+
+	rs485_set_rx_hook(modbus_rx_hook);
+}
+
+void modbus_set_address(uint8_t address)
+{
+	station = address;
+}
+
+void modbus_poll(void)
+{
+	uint32_t len;
+	bool complete;
+
+	if (!cfg)
+		return;
+
+	if (master_status == MODBUS_MASTER_BUSY && cfg->clock
+		&& cfg->clock() - master_sent > MODBUS_MASTER_TIMEOUT_MS)
+		master_status = MODBUS_MASTER_TIMEOUT;
+
+	/* A frame ends after 3.5 silent characters, take exactly the bytes received until then */
+	interrupt_disable_globally();
+	len = frame_len;
+	complete = len && (uint16_t)(gap_clock() - last_rx_us) >= t35_us;
+	if (complete) {
+		frame_len = 0;
+		frame_time = frame_start;
+	}
+	interrupt_enable_globally();
+
+	if (!complete)
+		return;
+
+	if (len < 4 || len > MODBUS_FRAME_MAX || len > rs485_available() || crc_ring(len) != 0) {
+		frame_errors++;
+	}
+	else if (master_status == MODBUS_MASTER_BUSY) {
+		handle_reply(len);
+	}
+	else {
+		serve_request(len);
+	}
+	rs485_consume(len);
+}
+
+static bool master_send(uint8_t slave, uint8_t fc, uint16_t a, uint16_t b)
+{
+	if (!cfg || master_status == MODBUS_MASTER_BUSY || rs485_tx_busy())
+		return false;
+
+	master_slave = slave;
+	master_fc = fc;
+	master_reply = NULL;
+	tx_frame[0] = slave;
+	tx_frame[1] = fc;
+	put16(&tx_frame[2], a);
+	put16(&tx_frame[4], b);
+	master_sent = cfg->clock ? cfg->clock() : 0;
+	master_status = slave == MODBUS_BROADCAST ? MODBUS_MASTER_DONE : MODBUS_MASTER_BUSY;
+	send_frame(6);
+	return true;
+}
+
+bool modbus_master_broadcast(uint8_t fc, const uint8_t *data, uint32_t len)
+{
+	if (!cfg || len > MODBUS_FRAME_MAX - 4 || master_status == MODBUS_MASTER_BUSY || rs485_tx_busy())
+		return false;
+
+	tx_frame[0] = MODBUS_BROADCAST;
+	tx_frame[1] = fc;
+	memcpy(&tx_frame[2], data, len);
+	master_status = MODBUS_MASTER_DONE;
+	send_frame(2 + len);
+	return true;
+}
+
+bool modbus_master_request(uint8_t slave, uint8_t fc, const uint8_t *data, uint32_t len, uint8_t *reply, uint32_t reply_max)
+{
+	if (!cfg || slave == MODBUS_BROADCAST || !reply || len > MODBUS_FRAME_MAX - 4
+		|| master_status == MODBUS_MASTER_BUSY || rs485_tx_busy())
+		return false;
+
+	master_slave = slave;
+	master_fc = fc;
+	master_reply = reply;
+	master_reply_max = reply_max;
+	master_reply_len = 0;
+	tx_frame[0] = slave;
+	tx_frame[1] = fc;
+	memcpy(&tx_frame[2], data, len);
+	master_sent = cfg->clock ? cfg->clock() : 0;
+	master_status = MODBUS_MASTER_BUSY;
+	send_frame(2 + len);
+	return true;
+}
+
+uint32_t modbus_master_reply_len(void)
+{
+	return master_reply_len;
+}
+
+bool modbus_master_read(uint8_t slave, uint16_t start, uint16_t count, uint16_t *dest)
+{
+	if (slave == MODBUS_BROADCAST || count == 0 || count > MODBUS_READ_MAX)
+		return false;
+	if (!master_send(slave, MODBUS_FC_READ_HOLDING, start, count))
+		return false;
+	/* The reply is only parsed by modbus_poll, after this returns */
+	master_count = count;
+	master_dest = dest;
+	return true;
+}
+
+bool modbus_master_write(uint8_t slave, uint16_t address, uint16_t value)
+{
+	return master_send(slave, MODBUS_FC_WRITE_SINGLE, address, value);
+}
+
+bool modbus_set_function(uint8_t fc, modbus_function_t fn)
+{
+	uint8_t i;
+	int8_t slot = -1;
+
+	for (i = 0; i < MODBUS_USER_FUNCTIONS; i++) {
+		if (user_functions[i].fn && user_functions[i].fc == fc) {
+			slot = (int8_t)i;
+			break;
+		}
+		if (!user_functions[i].fn && slot < 0)
+			slot = (int8_t)i;
+	}
+	if (slot < 0)
+		return false;
+	user_functions[slot].fc = fc;
+	user_functions[slot].fn = fn;
+	return true;
+}
+
+uint32_t modbus_frame_time(void)
+{
+	return frame_time;
+}
+
+modbus_master_status_t modbus_master_status(void)
+{
+	return master_status;
+}
+
+uint32_t modbus_errors(void)
+{
+	return frame_errors;
+}
@@ -0,0 +1,107 @@
+/**
+ *  @file modbus.h Modbus RTU engine on the RS-485 driver
+ *
+ *  @brief
+ *   Slave and master for holding registers, frames are parsed in place from the RX ring
+ **/
+
+#ifndef __MODBUS_H__
+#define __MODBUS_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define MODBUS_FRAME_MAX	   256
+#define MODBUS_BROADCAST	   0
+
+/* Registers per request, bounded by the frame size */
+#define MODBUS_READ_MAX		   125
+#define MODBUS_WRITE_MAX	   123
+
+/* Function codes */
+#define MODBUS_FC_READ_HOLDING	 0x03
+#define MODBUS_FC_WRITE_SINGLE	 0x06
+#define MODBUS_FC_WRITE_MULTIPLE 0x10
+
+/* Exception codes */
+#define MODBUS_EX_ILLEGAL_FUNCTION 0x01
+#define MODBUS_EX_ILLEGAL_ADDRESS  0x02
+#define MODBUS_EX_ILLEGAL_VALUE	   0x03
+
+/* User defined function codes that can be handled, see modbus_set_function */
+#ifndef MODBUS_USER_FUNCTIONS
+#define MODBUS_USER_FUNCTIONS 8
+#endif
+
+/* Master wait for a reply before giving up */
+#define MODBUS_MASTER_TIMEOUT_MS 200
+
+/** @brief One holding register bound to an application variable */
+typedef struct {
+	uint16_t		   address;
+	volatile uint16_t *value;
+	bool			   writable;
+} modbus_register_t;
+
+/** @brief Handler of a user defined function code
+ *
+ * data is the frame after the function code, without the CRC, and stays valid until the handler returns.
+ * Writes the reply data that follows the function code into reply, up to MODBUS_FRAME_MAX - 4 bytes,
+ * and returns its length, or the negated exception code. The reply to a broadcast is never sent.
+ */
+typedef int16_t (*modbus_function_t)(uint8_t target, const uint8_t *data, uint32_t len, uint8_t *reply);
+
+/** @brief Engine setup */
+typedef struct {
+	uint8_t					 address;	/* Station address, 1..247 */
+	const modbus_register_t *registers; /* Sorted by address */
+	uint16_t				 count;
+	void (*on_write)(uint16_t address); /* Optional, after a master wrote a register */
+	uint32_t (*clock)(void);			/* Milliseconds, for the master timeout */
+} modbus_config_t;
+
+typedef enum {
+	MODBUS_MASTER_IDLE = 0,
+	MODBUS_MASTER_BUSY,
+	MODBUS_MASTER_DONE,
+	MODBUS_MASTER_EXCEPTION,
+	MODBUS_MASTER_TIMEOUT,
+} modbus_master_status_t;
+
+/* Start the engine on an opened RS-485 port, the configuration must stay valid */
+void modbus_init(const modbus_config_t *config);
+void modbus_set_address(uint8_t address);
+
+/* Handle completed frames, call from the idle loop. Never waits */
+void modbus_poll(void);
+
+/* Serve a user defined function code, such as 65..72 or 100..110, with the handler. NULL removes it.
+ * Returns false when the table is full.
+ */
+bool modbus_set_function(uint8_t fc, modbus_function_t fn);
+
+/* Clock reading at the first byte of the frame being handled, for timestamped requests */
+uint32_t modbus_frame_time(void);
+
+/* Master requests, while one is busy incoming requests are not served */
+bool modbus_master_read(uint8_t slave, uint16_t start, uint16_t count, uint16_t *dest);
+bool modbus_master_write(uint8_t slave, uint16_t address, uint16_t value);
+modbus_master_status_t modbus_master_status(void);
+
+/* Broadcast a user defined function with up to MODBUS_FRAME_MAX - 4 data bytes. The frame is on the wire
+ * right away, so data can carry the time at which it was sent. Returns false while busy.
+ */
+bool modbus_master_broadcast(uint8_t fc, const uint8_t *data, uint32_t len);
+
+/* Send a user defined function to one station. The reply data after the function code is copied to reply,
+ * up to reply_max bytes, once the status is MODBUS_MASTER_DONE. modbus_master_reply_len gives its full length.
+ */
+bool modbus_master_request(uint8_t slave, uint8_t fc, const uint8_t *data, uint32_t len, uint8_t *reply, uint32_t reply_max);
+uint32_t modbus_master_reply_len(void);
+
+uint16_t modbus_crc16(const uint8_t *data, uint32_t len);
+
+/* Frames dropped for a bad CRC or length */
+uint32_t modbus_errors(void);
+
+#endif /* __MODBUS_H__ */
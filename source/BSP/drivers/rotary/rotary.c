@@ -16,4 +16,44 @@ uint8_t read_rotary(void)
 	}
 	id = (uint8_t)((gpio_read(SWITCH_ID0)) | (gpio_read(SWITCH_ID1) << 1) | (gpio_read(SWITCH_ID2) << 2) | (gpio_read(SWITCH_ID3) << 3)) & 0xF;
 	return id;
-}
\ No newline at end of file
+}
+static uint8_t rotary_cached = 0;
+static uint8_t rotary_candidate = 0;
+static uint8_t rotary_same = 0;
+static uint32_t rotary_due = 0;
+
+uint8_t rotary_init(void)
+{
+	rotary_cached = read_rotary();
+	rotary_candidate = rotary_cached;
+	rotary_same = 0;
+	return rotary_cached;
+}
+
+uint8_t rotary_id(void)
+{
+	return rotary_cached;
+}
+
+bool rotary_poll(uint32_t now_ms)
+{
+	uint8_t id;
+
+	if ((int32_t)(now_ms - rotary_due) < 0)
+		return false;
+	rotary_due = now_ms + ROTARY_POLL_MS;
+
+	/* A switch between two detents reads as a mix of both, wait until it settles */
+	id = read_rotary();
+	if (id != rotary_candidate) {
+		rotary_candidate = id;
+		rotary_same = 0;
+		return false;
+	}
+	if (id == rotary_cached || ++rotary_same < ROTARY_DEBOUNCE_READS)
+		return false;
+
+	rotary_cached = id;
+	rotary_same = 0;
+	return true;
+}
@@ -1,6 +1,23 @@
 #ifndef _ROTARY_H_
 #define _ROTARY_H_
 
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Slow re-sampling of the switch, a new position is taken after it read the same this many times */
+#define ROTARY_POLL_MS		 100
+#define ROTARY_DEBOUNCE_READS 3
+
+/* Raw read of the four switch lines */
 uint8_t read_rotary(void);
 
-#endif //_VL53L0X_H_
+/* Sample the switch once and cache the position */
+uint8_t rotary_init(void);
+
+/* Cached position, no GPIO access */
+uint8_t rotary_id(void);
+
+/* Re-sample every ROTARY_POLL_MS with debounce, returns true when the cached position changed */
+bool rotary_poll(uint32_t now_ms);
+
+#endif //_ROTARY_H_
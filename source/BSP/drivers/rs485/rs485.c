@@ -0,0 +1,174 @@
+/**
+ *  @file rs485.c RS-485 half-duplex driver on UART1
+ *
+ *  @brief
+ *   Interrupt driven RX/TX ring buffers with driver-enable turnaround
+ **/
+
+#include <stdio.h>
+#include "bsp_debug.h"
+#include "bsp_hwdefs.h"
+#include "rs485.h"
+
+#define RX_MASK (RS485_RX_BUFFER_SIZE - 1)
+#define TX_MASK (RS485_TX_BUFFER_SIZE - 1)
+
+static uint8_t rx_buf[RS485_RX_BUFFER_SIZE];
+static volatile uint32_t rx_head = 0; /* written by the interrupt */
+static volatile uint32_t rx_tail = 0;
+static volatile uint32_t rx_overruns = 0;
+
+static uint8_t tx_buf[RS485_TX_BUFFER_SIZE];
+static volatile uint32_t tx_head = 0;
+static volatile uint32_t tx_tail = 0; /* written by the interrupt */
+static volatile bool tx_active = false;
+
+static uint32_t current_baud = 0;
+static void (*rx_hook)(void) = NULL;
+
+static void rs485_driver_enable(bool on)
+{
+	gpio_write(GPIO_RS485_DE, on ? 1 : 0);
+}
+
+static void rs485_isr(void)
+{
+	uint8_t c;
+
+	if (uart_is_interrupted(UART1, uart_interrupt_rx)) {
+		uart_read(UART1, &c);
+		if (rx_head - rx_tail < RS485_RX_BUFFER_SIZE) {
+			rx_buf[rx_head & RX_MASK] = c;
+			rx_head++;
+		}
+		else {
+			rx_overruns++;
+		}
+		if (rx_hook)
+			rx_hook();
+	}
+
+	if (uart_is_interrupted(UART1, uart_interrupt_tx)) {
+		if (tx_tail != tx_head) {
+			uart_write(UART1, tx_buf[tx_tail & TX_MASK]);
+			tx_tail++;
+		}
+		else {
+			/* The holding register is empty but the last byte is still shifting out,
+			 * keep driving the line until the transmitter reports its stop bit is done.
+			 * This is at most one character time.
+			 */
+			uart_disable_interrupt(UART1, uart_interrupt_tx);
+			while (!(UART1->LSR_ICR_XON2 & MASK_UART_LSR_TEMT))
+				;
+			rs485_driver_enable(false);
+			tx_active = false;
+		}
+	}
+}
+
+int8_t rs485_init(uint32_t baud)
+{
+	uint16_t divisor;
+	uint8_t prescaler;
+
+	if (baud == 0 || baud > RS485_BAUD_MAX)
+		return -1;
+	if (uart_calculate_baud(baud, 16, RS485_UART_CLOCK, &divisor, &prescaler) != 0)
+		return -1;
+
+	/* Receiver listens while the driver is off */
+	gpio_function(GPIO_RS485_DE, pad_gpio54);
+	gpio_dir(GPIO_RS485_DE, pad_dir_output);
+	gpio_pull(GPIO_RS485_DE, pad_pull_none);
+	rs485_driver_enable(false);
+
+	sys_enable(sys_device_uart1);
+	gpio_function(GPIO_UART1_TX, pad_uart1_txd);
+	gpio_function(GPIO_UART1_RX, pad_uart1_rxd);
+	uart_open(UART1, prescaler, divisor, uart_data_bits_8, uart_parity_none, uart_stop_bits_1);
+
+	rx_head = rx_tail = 0;
+	tx_head = tx_tail = 0;
+	tx_active = false;
+	current_baud = baud;
+
+	interrupt_attach(interrupt_uart1, (int8_t)interrupt_uart1, rs485_isr);
+	uart_enable_interrupt(UART1, uart_interrupt_rx);
+	uart_enable_interrupts_globally(UART1);
+
+	return 0;
+}
+
+uint32_t rs485_baud(void)
+{
+	return current_baud;
+}
+
+uint32_t rs485_write(const uint8_t *data, uint32_t len)
+{
+	uint32_t count = 0;
+
+	while (count < len && tx_head - tx_tail < RS485_TX_BUFFER_SIZE) {
+		tx_buf[tx_head & TX_MASK] = data[count++];
+		tx_head++;
+	}
+
+	if (count) {
+		interrupt_disable_globally();
+		if (!tx_active) {
+			/* Turn the line around, then prime the transmitter with the first byte */
+			tx_active = true;
+			rs485_driver_enable(true);
+			uart_write(UART1, tx_buf[tx_tail & TX_MASK]);
+			tx_tail++;
+			uart_enable_interrupt(UART1, uart_interrupt_tx);
+		}
+		interrupt_enable_globally();
+	}
+
+	return count;
+}
+
+bool rs485_tx_busy(void)
+{
+	return tx_active;
+}
+
+uint32_t rs485_read(uint8_t *data, uint32_t len)
+{
+	uint32_t count = 0;
+
+	while (count < len && rx_tail != rx_head) {
+		data[count++] = rx_buf[rx_tail & RX_MASK];
+		rx_tail++;
+	}
+
+	return count;
+}
+
+uint32_t rs485_available(void)
+{
+	return rx_head - rx_tail;
+}
+
+uint8_t rs485_peek(uint32_t offset)
+{
+	return rx_buf[(rx_tail + offset) & RX_MASK];
+}
+
+void rs485_consume(uint32_t len)
+{
+	uint32_t avail = rx_head - rx_tail;
+	rx_tail += len < avail ? len : avail;
+}
+
+void rs485_set_rx_hook(void (*hook)(void))
+{
+	rx_hook = hook;
+}
+
+uint32_t rs485_rx_overruns(void)
+{
+	return rx_overruns;
+}
@@ -0,0 +1,50 @@
+/**
+ *  @file rs485.h RS-485 half-duplex driver on UART1
+ *
+ *  @brief
+ *   Interrupt driven RX/TX ring buffers with driver-enable turnaround
+ **/
+
+#ifndef __RS485_H__
+#define __RS485_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Ring sizes, must be powers of two */
+#ifndef RS485_RX_BUFFER_SIZE
+#define RS485_RX_BUFFER_SIZE 256
+#endif
+#ifndef RS485_TX_BUFFER_SIZE
+#define RS485_TX_BUFFER_SIZE 256
+#endif
+
+/* UART1 samples every bit 16 times from the 100 MHz peripheral clock */
+#define RS485_UART_CLOCK 100000000UL
+#define RS485_BAUD_MAX	 (RS485_UART_CLOCK / 16)
+
+/* Open UART1 with 8N1 at the given baud rate, returns 0 on success */
+int8_t	 rs485_init(uint32_t baud);
+uint32_t rs485_baud(void);
+
+/* Queue bytes for sending, the transceiver is driven while the queue drains and is
+ * released once the stop bit of the last byte is out. Returns the number of bytes queued.
+ */
+uint32_t rs485_write(const uint8_t *data, uint32_t len);
+bool	 rs485_tx_busy(void);
+
+/* Copy received bytes out of the RX ring, never waits */
+uint32_t rs485_read(uint8_t *data, uint32_t len);
+uint32_t rs485_available(void);
+
+/* In place access for protocol parsers, offset must be below rs485_available() */
+uint8_t	 rs485_peek(uint32_t offset);
+void	 rs485_consume(uint32_t len);
+
+/* Called from the UART interrupt after each received byte */
+void	 rs485_set_rx_hook(void (*hook)(void));
+
+/* Bytes lost because the RX ring was full */
+uint32_t rs485_rx_overruns(void);
+
+#endif /* __RS485_H__ */
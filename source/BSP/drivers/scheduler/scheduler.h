@@ -0,0 +1,65 @@
+/**
+ *  @file scheduler.h Cooperative scheduler for BSP background work
+ *
+ *  @brief
+ *   Run-to-completion tasks in fixed priority order, pumped from the main loop,
+ *   the ESD idle hook and the EVE command wait callback
+ **/
+
+#ifndef __SCHEDULER_H__
+#define __SCHEDULER_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifndef SCHED_MAX_TASKS
+#define SCHED_MAX_TASKS 12
+#endif
+
+/* One-shot jobs waiting for a pump, must be a power of two */
+#ifndef SCHED_MAX_JOBS
+#define SCHED_MAX_JOBS 16
+#endif
+
+/* Time a coprocessor wait may spend on background jobs per callback */
+#ifndef SCHED_WAIT_BUDGET_MS
+#define SCHED_WAIT_BUDGET_MS 1
+#endif
+
+/* Period values with a special meaning */
+#define SCHED_EVERY_PUMP 0			 /* Run on every pump */
+#define SCHED_ON_TRIGGER 0xFFFFFFFFUL /* Run only after sched_trigger() */
+
+typedef void (*sched_fn_t)(void *ctx);
+
+/* Set the millisecond clock used for the task periods */
+void sched_init(uint32_t (*clock)(void));
+
+/* Register a task, lower priority values run first within a pump.
+ * Tasks must not wait on the EVE coprocessor, they can be run from inside a command wait.
+ * Returns the task id, or -1 when the table is full.
+ */
+int8_t sched_add(sched_fn_t fn, void *ctx, uint32_t period_ms, uint8_t priority);
+
+/* Make a task run on the next pump, also from interrupts */
+void sched_trigger(int8_t id);
+
+/* Queue a job to run once, chunked work such as a prefetch posts its next chunk again.
+ * Returns false when the queue is full.
+ */
+bool sched_post(sched_fn_t fn, void *ctx);
+uint8_t sched_pending(void);
+
+/* Run every task that is due once, then queued jobs, a nested call from inside a task returns at once.
+ * Returns the number of tasks and jobs that ran.
+ */
+uint8_t sched_run(void);
+
+/* Like sched_run, but stop taking queued jobs once budget_ms passed. At least one job runs */
+uint8_t sched_run_for(uint32_t budget_ms);
+
+/* Wait hook for EVE_HalParameters.CbCmdWait, runs background work with SCHED_WAIT_BUDGET_MS per call */
+struct EVE_HalContext;
+bool sched_cmd_wait(struct EVE_HalContext *phost);
+
+#endif /* __SCHEDULER_H__ */
@@ -22,6 +22,27 @@ typedef enum {
 } DRESULT;
 
 
+/* Physical drives, also the FatFs volume numbers */
+#define DISKIO_DRV_SD	0	/* SD card on the SD host */
+#define DISKIO_DRV_USB	1	/* USB stick on the USB host port, see usbmsc.h */
+
+
+/* Alignment required for buffers to be transferred by the SD host without a bounce copy */
+#define DISKIO_BUFFER_ALIGN	4
+
+/* Declare a buffer that disk_read/disk_write can transfer in place, for example
+   static BYTE DISKIO_ALIGNED buffer[4096]; */
+#define DISKIO_ALIGNED	__attribute__ ((aligned (DISKIO_BUFFER_ALIGN)))
+
+/* Check whether a buffer can be transferred in place */
+#define DISKIO_IS_ALIGNED(p)	((((unsigned int)(p)) & (DISKIO_BUFFER_ALIGN - 1)) == 0)
+
+/* Number of sectors an unaligned transfer is bounced through at a time */
+#ifndef DISKIO_BOUNCE_SECTORS
+#define DISKIO_BOUNCE_SECTORS	8
+#endif
+
+
 /*---------------------------------------*/
 /* Prototypes for disk control functions */
 
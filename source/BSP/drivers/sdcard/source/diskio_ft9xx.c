@@ -43,6 +43,7 @@
 #include "ff.h"		/* FatFs lower layer API */
 #include "diskio.h"		/* FatFs lower layer API */
 #include "ft900_sdhost.h"
+#include "usbmsc.h"
 #include <string.h>
 
 #define _USE_WRITE	1	/* 1: Enable disk_write function */
@@ -55,10 +56,11 @@
 static int sd_init = 1; // Already initialized externally, only reinitialize when lost
 static int sd_ready = 0;
 
-// A 32 bit aligned buffer of 512 bytes to copy non-aligned sectors to/from FatFs
+// A 32 bit aligned buffer of several sectors to copy non-aligned sectors to/from FatFs.
+// Holding more than one sector lets unaligned transfers still go out as multi-block commands.
 // It's OK to use the same buffer for read/write as FatFS will never read and write at the same time.
 // Even when accessed from multiple threads (FS_REENTRANCY == 1)
-static unsigned long __attribute__ ((aligned (32))) temp[128];
+static unsigned long __attribute__ ((aligned (32))) temp[DISKIO_BOUNCE_SECTORS * (SDHOST_BLK_SIZE / sizeof(unsigned long))];
 
 /* FatFS Functions ******************/
 
@@ -68,6 +70,11 @@ static unsigned long __attribute__ ((aligned (32))) temp[128];
 DSTATUS disk_initialize(BYTE pdrv) {
 	DSTATUS stat = 0;
 
+	if (pdrv == DISKIO_DRV_USB) {
+		// Initialized on enumeration by usbmsc_task
+		return usbmsc_disk_status();
+	}
+
 	if (sd_ready || !sd_init) {
 		// sdhost_sys_init();
 		sdhost_init();
@@ -96,6 +103,10 @@ DSTATUS disk_status(BYTE pdrv) {
 	DSTATUS stat = 0;
 	SDHOST_STATUS sdHostStatus;
 
+	if (pdrv == DISKIO_DRV_USB) {
+		return usbmsc_disk_status();
+	}
+
 	if (!sd_init) {
 		return STA_NOINIT;
 	}
@@ -129,19 +140,27 @@ DSTATUS disk_status(BYTE pdrv) {
 DRESULT disk_read(BYTE pdrv, BYTE* buff, DWORD sector, UINT count) {
 	DRESULT res = RES_OK;
 	SDHOST_STATUS sdHostStatus = SDHOST_OK;
-	int i;
+	UINT n;
+
+	if (pdrv == DISKIO_DRV_USB) {
+		return usbmsc_disk_read(buff, sector, count);
+	}
 
-	if (((unsigned int) buff & 3) != 0) {
+	if (!DISKIO_IS_ALIGNED(buff)) {
 
 		//print("%%%%%%%%%% READ - DISKIO - buffer NOT 32 bit aligned %%%%%%%%%%%%%%%");
-		for (i = 0; i < count; i++) {
+		// Bounce through the aligned buffer, as many sectors at a time as it holds
+		while (count && sdHostStatus == SDHOST_OK) {
+			n = count < DISKIO_BOUNCE_SECTORS ? count : DISKIO_BOUNCE_SECTORS;
 			sdHostStatus = sdhost_transfer_data(SDHOST_READ, (void*) temp,
-			SDHOST_BLK_SIZE, sector);
-			memmove(buff, temp, sizeof(temp));
-			sector++;
-			buff += sizeof(temp);
+			SDHOST_BLK_SIZE * n, sector);
+			memcpy(buff, temp, SDHOST_BLK_SIZE * n);
+			sector += n;
+			buff += SDHOST_BLK_SIZE * n;
+			count -= n;
 		}
 	} else {
+		// Single transfer for the whole run, issued as a multi-block read (CMD18) when count > 1
 		sdHostStatus = sdhost_transfer_data(SDHOST_READ, (void*) buff,
 		SDHOST_BLK_SIZE * count, sector);
 	}
@@ -164,20 +183,28 @@ DRESULT disk_write(BYTE pdrv, const BYTE* buff, DWORD sector, UINT count) {
 	DRESULT res = RES_OK;
 	// Non-aligned writes are inefficient because of this additional move to temp buffer. But thankfully they are rate in FatFS
 	SDHOST_STATUS sdHostStatus = SDHOST_OK;
-	int i;
+	UINT n;
 
-	if (((unsigned int) buff & 3) != 0) {
+	if (pdrv == DISKIO_DRV_USB) {
+		return usbmsc_disk_write(buff, sector, count);
+	}
 
-		//	print("%%%%%%%%%% WRITE - DISKIO - buffer NOT 32 bit aligned %%%%%%%%%%%%%%%");
+	if (!DISKIO_IS_ALIGNED(buff)) {
 
-		for (i = 0; i < count; i++) {
-			memmove(temp, buff, sizeof(temp));
+		//	print("%%%%%%%%%% WRITE - DISKIO - buffer NOT 32 bit aligned %%%%%%%%%%%%%%%");
+		// Bounce through the aligned buffer, as many sectors at a time as it holds
+		while (count && sdHostStatus == SDHOST_OK) {
+			n = count < DISKIO_BOUNCE_SECTORS ? count : DISKIO_BOUNCE_SECTORS;
+			memcpy(temp, buff, SDHOST_BLK_SIZE * n);
 			sdHostStatus = sdhost_transfer_data(SDHOST_WRITE, (void*) temp,
-			SDHOST_BLK_SIZE, sector);
-			sector++;
-			buff += sizeof(temp);
+			SDHOST_BLK_SIZE * n, sector);
+			sector += n;
+			buff += SDHOST_BLK_SIZE * n;
+			count -= n;
 		}
 	} else {
+		// Never split an aligned run, so the card sees one multi-block write (CMD25)
+		// and can program its erase units without intermediate busy periods
 		sdHostStatus = sdhost_transfer_data(SDHOST_WRITE, (void*) buff,
 		SDHOST_BLK_SIZE * count, sector);
 	}
@@ -204,6 +231,10 @@ DRESULT disk_ioctl(BYTE pdrv, BYTE cmd, void* buff) {
 	DWORD csize;
 	BYTE n;
 
+	if (pdrv == DISKIO_DRV_USB) {
+		return usbmsc_disk_ioctl(cmd, buff);
+	}
+
 	switch (cmd) {
 	case CTRL_SYNC:
 		res = RES_OK;
@@ -365,6 +365,7 @@ DWORD ff_wtoupper (DWORD uni);			/* Unicode upper-case conversion */
 #if FF_USE_LFN == 3						/* Dynamic memory allocation */
 void* ff_memalloc (UINT msize);			/* Allocate memory block */
 void ff_memfree (void* mblock);			/* Free memory block */
+void ff_memstat (DWORD* avoided, DWORD* heap);	/* Get pool and heap allocation counters */
 #endif
 
 /* Sync functions */
@@ -41,7 +41,7 @@
 /* This option switches fast seek function. (0:Disable or 1:Enable) */
 
 
-#define FF_USE_EXPAND	0
+#define FF_USE_EXPAND	1
 /* This option switches f_expand function. (0:Disable or 1:Enable) */
 
 
@@ -136,6 +136,13 @@
 /  ff_memfree() exemplified in ffsystem.c, need to be added to the project. */
 
 
+#define FF_MEMPOOL_SIZE	2
+/* This option sets the number of LFN working buffers kept in a static pool by
+/  ff_memalloc() in ffsystem.c when FF_USE_LFN == 3, at least 1. Each block takes
+/  (FF_MAX_LFN + 1) * 2 bytes. A path operation holds one block until it returns,
+/  requests which do not fit in a free block fall back to the heap. */
+
+
 #define FF_LFN_UNICODE	0
 /* This option switches the character encoding on the API when LFN is enabled.
 /
@@ -169,8 +176,9 @@
 / Drive/Volume Configurations
 /---------------------------------------------------------------------------*/
 
-#define FF_VOLUMES		1
+#define FF_VOLUMES		2
 /* Number of volumes (logical drives) to be used. (1-10) */
+/* 0: SD card, 1: USB stick on the USB host port (DISKIO_DRV_SD, DISKIO_DRV_USB) */
 
 
 #define FF_STR_VOLUME_ID	0
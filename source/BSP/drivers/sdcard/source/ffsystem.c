@@ -9,6 +9,32 @@
 
 #if FF_USE_LFN == 3	/* Dynamic memory allocation */
 
+/* LFN working buffers are requested and released by every path operation.
+/  They are taken from a pool of fixed blocks, only larger requests such as
+/  the f_mkfs working buffer go to the heap. */
+
+#if FF_FS_EXFAT
+#define FF_MEMPOOL_BLOCK	((FF_MAX_LFN + 1) * 2 + (FF_MAX_LFN + 44U) / 15 * 32)
+#else
+#define FF_MEMPOOL_BLOCK	((FF_MAX_LFN + 1) * 2)
+#endif
+
+#if FF_MEMPOOL_SIZE < 1
+#error Wrong FF_MEMPOOL_SIZE setting
+#endif
+
+typedef union FF_MEMBLOCK {
+	union FF_MEMBLOCK* next;	/* Next free block */
+	DWORD data[(FF_MEMPOOL_BLOCK + 3) / 4];
+} FF_MEMBLOCK;
+
+static FF_MEMBLOCK MemPool[FF_MEMPOOL_SIZE];
+static FF_MEMBLOCK* MemFree;
+static BYTE MemPoolReady;
+static DWORD MemAvoided;	/* Requests served by the pool */
+static DWORD MemHeap;		/* Requests served by the heap */
+
+
 /*------------------------------------------------------------------------*/
 /* Allocate a memory block                                                */
 /*------------------------------------------------------------------------*/
@@ -17,6 +43,25 @@ void* ff_memalloc (	/* Returns pointer to the allocated memory block (null if no
 	UINT msize		/* Number of bytes to allocate */
 )
 {
+	FF_MEMBLOCK* blk;
+	UINT i;
+
+
+	if (!MemPoolReady) {
+		for (i = 0; i < FF_MEMPOOL_SIZE; i++) {
+			MemPool[i].next = (i + 1 < FF_MEMPOOL_SIZE) ? &MemPool[i + 1] : 0;
+		}
+		MemFree = &MemPool[0];
+		MemPoolReady = 1;
+	}
+
+	blk = MemFree;
+	if (msize <= sizeof (FF_MEMBLOCK) && blk) {
+		MemFree = blk->next;
+		MemAvoided++;
+		return blk;
+	}
+	MemHeap++;
 	return malloc(msize);	/* Allocate a new memory block with POSIX API */
 }
 
@@ -29,9 +74,31 @@ void ff_memfree (
 	void* mblock	/* Pointer to the memory block to free (nothing to do if null) */
 )
 {
+	FF_MEMBLOCK* blk = (FF_MEMBLOCK*)mblock;
+
+
+	if (blk >= &MemPool[0] && blk < &MemPool[FF_MEMPOOL_SIZE]) {
+		blk->next = MemFree;
+		MemFree = blk;
+		return;
+	}
 	free(mblock);	/* Free the memory block with POSIX API */
 }
 
+
+/*------------------------------------------------------------------------*/
+/* Get the allocation counters                                            */
+/*------------------------------------------------------------------------*/
+
+void ff_memstat (
+	DWORD* avoided,	/* Number of requests served without a heap call */
+	DWORD* heap		/* Number of requests passed to malloc */
+)
+{
+	if (avoided) *avoided = MemAvoided;
+	if (heap) *heap = MemHeap;
+}
+
 #endif
 
 
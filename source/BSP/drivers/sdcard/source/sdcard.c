@@ -30,12 +30,23 @@
  */
 #include "bsp_hwdefs.h"
 #include "ff.h"
+#include "diskio.h"
+#include "sdcard.h"
 
-#define MOUNT_POINT ""
+#define MOUNT_POINT "0:" /* DISKIO_DRV_SD, the current drive may be the USB stick */
 
 static bool s_FatFSLoaded = false;
 static FATFS s_FatFS;
 
+typedef struct SdRequest
+{
+	SdJob Job;
+	void *Ctx;
+} SdRequest;
+
+static SdRequest s_Requests[SD_CLIENT_COUNT];
+static int8_t s_Owner = -1; /* Client holding the card */
+
 void initSdHost(void)
 {
 	/* All SD Host pins except CLK need a pull-up to work. The MM900EV*A module does not have external pull-up, so enable internal one */
@@ -79,8 +90,15 @@ bool loadSdCard(void)
 		}
 		else
 		{
+			SdCardInfo info;
 			printf("FatFS SD card mounted successfully\n");
 			s_FatFSLoaded = true;
+			if (sdCardInfo(&info))
+			{
+				printf("SD card: %s, %lu sectors, %lu kHz max clock, high speed %s\n",
+				    info.HighCapacity ? "SDHC/SDXC" : "SDSC", (unsigned long)info.SectorCount,
+				    (unsigned long)info.MaxClockKHz, info.HighSpeedCapable ? "capable" : "not supported");
+			}
 		}
 	}
 	else
@@ -96,6 +114,91 @@ bool sdCardReady(void)
 	return s_FatFSLoaded;
 }
 
+bool sdCardInfo(SdCardInfo *info)
+{
+	/* TRAN_SPEED time value, times 10 */
+	static const uint8_t s_TranSpeedValue[16] = { 0, 10, 12, 13, 15, 20, 25, 30, 35, 40, 45, 50, 55, 60, 70, 80 };
+	/* TRAN_SPEED rate unit in kHz, values above 3 are reserved */
+	static const uint32_t s_TranSpeedUnit[4] = { 100, 1000, 10000, 100000 };
+
+	sdhost_context_t *sd_context = sdhost_get_context();
+	uint8_t *csd = (uint8_t *)&sd_context->CSD[0];
+	DWORD sectors;
+	uint8_t tranSpeed;
+
+	if (!s_FatFSLoaded)
+		return false;
+
+	/* The CSD is stored without its CRC byte, so register bit N is in byte (N - 8) / 8 */
+	tranSpeed = csd[11];
+	info->HighCapacity = !sd_context->isSDSCCard;
+	info->HighSpeedCapable = (csd[10] & 0x40) != 0; /* CCC bit 10, register bit 94 */
+	info->MaxClockKHz = (tranSpeed & 0x04) ? 0
+	    : s_TranSpeedUnit[tranSpeed & 0x03] * s_TranSpeedValue[(tranSpeed >> 3) & 0x0F] / 10;
+	info->SectorCount = (disk_ioctl(0, GET_SECTOR_COUNT, &sectors) == RES_OK) ? sectors : 0;
+	return true;
+}
+
+bool sdAcquire(SdClient client)
+{
+	if (s_Owner >= 0)
+		return false;
+	s_Owner = (int8_t)client;
+	return true;
+}
+
+void sdRelease(SdClient client)
+{
+	if (s_Owner == (int8_t)client)
+		s_Owner = -1;
+}
+
+bool sdBusy(void)
+{
+	return s_Owner >= 0;
+}
+
+bool sdRequest(SdClient client, SdJob job, void *ctx)
+{
+	SdRequest *request = &s_Requests[client];
+	if (request->Job)
+		return false;
+	request->Job = job;
+	request->Ctx = ctx;
+	return true;
+}
+
+bool sdPending(SdClient client)
+{
+	return s_Requests[client].Job != NULL;
+}
+
+void sdArbiterTask(void *ctx)
+{
+	(void)(ctx);
+
+	/* Also runs from inside a coprocessor wait, while a direct transfer may be holding the card */
+	if (s_Owner >= 0)
+		return;
+
+	for (int client = 0; client < SD_CLIENT_COUNT; client++)
+	{
+		SdRequest request = s_Requests[client];
+		bool more;
+
+		if (!request.Job)
+			continue;
+
+		s_Requests[client].Job = NULL;
+		s_Owner = (int8_t)client;
+		more = request.Job(request.Ctx);
+		s_Owner = -1;
+		if (more && !s_Requests[client].Job)
+			s_Requests[client] = request;
+		return;
+	}
+}
+
 size_t readFile(uint8_t *buffer, size_t size, const char *filename)
 {
 	// Read up to `size` number of bytes from the file into `buffer`, then return the number of read bytes
@@ -107,6 +210,11 @@ size_t readFile(uint8_t *buffer, size_t size, const char *filename)
 		printf("SD card not ready\n");
 		return false;
 	}
+	if (!sdAcquire(SD_CLIENT_ASSET))
+	{
+		printf("SD card busy\n");
+		return 0;
+	}
 
 	fResult = f_open(&InfSrc, filename, FA_READ | FA_OPEN_EXISTING);
 	if (fResult == FR_DISK_ERR)
@@ -122,13 +230,49 @@ size_t readFile(uint8_t *buffer, size_t size, const char *filename)
 		size_t read;
 		fResult = f_read(&InfSrc, buffer, size, &read);
 		f_close(&InfSrc);
+		sdRelease(SD_CLIENT_ASSET);
 		return read;
 	}
 	else
 	{
+		sdRelease(SD_CLIENT_ASSET);
 		printf("Unable to open file: \"%s\"\n", filename);
 		return 0;
 	}
 }
 
+size_t writeFile(const uint8_t *buffer, size_t size, const char *filename)
+{
+	// Replace the file with `size` bytes from `buffer`, then return the number of written bytes
+	FRESULT fResult;
+	FIL InfDst;
+	size_t written = 0;
+
+	if (!s_FatFSLoaded)
+	{
+		printf("SD card not ready\n");
+		return 0;
+	}
+	if (!sdAcquire(SD_CLIENT_ASSET))
+	{
+		printf("SD card busy\n");
+		return 0;
+	}
+
+	fResult = f_open(&InfDst, filename, FA_WRITE | FA_CREATE_ALWAYS);
+	if (fResult == FR_OK)
+	{
+		fResult = f_write(&InfDst, buffer, size, &written);
+		f_close(&InfDst);
+		sdRelease(SD_CLIENT_ASSET);
+		return (fResult == FR_OK) ? written : 0;
+	}
+	else
+	{
+		sdRelease(SD_CLIENT_ASSET);
+		printf("Unable to create file: \"%s\"\n", filename);
+		return 0;
+	}
+}
+
 /* end of file */
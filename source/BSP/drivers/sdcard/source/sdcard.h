@@ -44,12 +44,56 @@
 On embedded platforms, filename character set depends on the filesystem library.
 */
 
+/** Card parameters, decoded from the card registers read by sdhost_card_init */
+typedef struct SdCardInfo
+{
+	bool HighCapacity; /**< SDHC/SDXC card with block addressing */
+	bool HighSpeedCapable; /**< Card implements the switch function class (CMD6) */
+	uint32_t MaxClockKHz; /**< Maximum bus clock in default speed mode, from TRAN_SPEED */
+	uint32_t SectorCount; /**< Number of 512 byte sectors */
+} SdCardInfo;
+
 /** Load SD card */
 void initSdHost(void);
 bool loadSdCard(void);
 bool sdCardReady(void);
 
+/** Decode the parameters of the initialized card, returns false if no card is mounted */
+bool sdCardInfo(SdCardInfo *info);
+
+/*
+Access arbiter. The users of the card take turns in order of priority, so each keeps the
+card for complete large transfers instead of interleaving small ones. A user either holds
+the card around a transfer it makes directly, or queues a job which sdArbiterTask runs once
+the card is free. Lower values are served first.
+*/
+typedef enum SdClient
+{
+	SD_CLIENT_MEDIA, /**< Media FIFO refills, playback stalls when late */
+	SD_CLIENT_ASSET, /**< Asset and file loads */
+	SD_CLIENT_LOG, /**< Data logger flushes */
+	SD_CLIENT_BULK, /**< Background file transfers, such as the RS-485 file distribution */
+	SD_CLIENT_COUNT
+} SdClient;
+
+/* Runs one transfer, returns true when the client has more work queued */
+typedef bool (*SdJob)(void *ctx);
+
+/* Take the card for a direct transfer, false while another transfer holds it */
+bool sdAcquire(SdClient client);
+void sdRelease(SdClient client);
+bool sdBusy(void);
+
+/* Queue the job of a client, one per client. Returns false when the client already has one waiting */
+bool sdRequest(SdClient client, SdJob job, void *ctx);
+bool sdPending(SdClient client);
+
+/* Scheduler task, runs the job of the first waiting client when the card is free.
+A job with more work stays queued, and continues on the next run unless a higher priority client is waiting */
+void sdArbiterTask(void *ctx);
+
 size_t readFile(uint8_t* buffer, size_t size, const char* filename);
+size_t writeFile(const uint8_t* buffer, size_t size, const char* filename);
 
 #endif
 /* end of file */
@@ -0,0 +1,261 @@
+/**
+ *  @file sdlog.c Buffered data logger on the SD card
+ *
+ *  @brief
+ *   Records are collected in a RAM ring and written to a preallocated file in whole blocks
+ **/
+
+#include <stdio.h>
+#include <string.h>
+#include "bsp_debug.h"
+#include "bsp_hwdefs.h"
+#include "ff.h"
+#include "sdcard.h"
+#include "sdlog.h"
+
+#if (SDLOG_BLOCK_SIZE % 512) || (SDLOG_RING_SIZE % SDLOG_BLOCK_SIZE) || (SDLOG_RING_SIZE & (SDLOG_RING_SIZE - 1))
+#error SDLOG_RING_SIZE must be a power of two multiple of SDLOG_BLOCK_SIZE, a multiple of 512
+#endif
+
+#define RING_MASK (SDLOG_RING_SIZE - 1)
+
+/* Header words */
+#define HDR_MAGIC	 0
+#define HDR_CAPACITY 1
+#define HDR_USED	 2
+#define HDR_CHECK	 3
+
+static FIL log_file;
+static bool log_open = false;
+
+/* Word aligned, so the blocks go straight from the ring to the card */
+static uint32_t ring[SDLOG_RING_SIZE / 4];
+static uint32_t header[SDLOG_HEADER_SIZE / 4];
+
+/* The tail stays block aligned, a partial block written by a sync is written again once full */
+static uint32_t ring_head = 0;
+static uint32_t ring_tail = 0;
+static uint32_t committed = 0; /* record bytes in the file before the ring tail */
+static uint32_t synced = 0; /* record bytes in the header */
+static uint32_t log_capacity = 0;
+static uint32_t dropped = 0;
+
+static uint32_t sync_period = 0;
+static uint32_t last_sync = 0;
+static uint32_t (*log_clock)(void) = NULL;
+static volatile bool sync_requested = false;
+
+static uint32_t header_check(void)
+{
+	return ~(header[HDR_MAGIC] ^ header[HDR_CAPACITY] ^ header[HDR_USED]);
+}
+
+static bool write_at(uint32_t offset, const void *data, uint32_t len)
+{
+	UINT written;
+
+	return f_lseek(&log_file, offset) == FR_OK
+		&& f_write(&log_file, data, len, &written) == FR_OK
+		&& written == len;
+}
+
+static bool write_block(void)
+{
+	if (!write_at(SDLOG_HEADER_SIZE + committed, (uint8_t *)ring + (ring_tail & RING_MASK), SDLOG_BLOCK_SIZE))
+		return false;
+	committed += SDLOG_BLOCK_SIZE;
+	ring_tail += SDLOG_BLOCK_SIZE;
+	return true;
+}
+
+/* Write the partial block at the tail and the header, then flush the file */
+static bool write_sync(void)
+{
+	uint32_t pending = ring_head - ring_tail;
+
+	if (pending && !write_at(SDLOG_HEADER_SIZE + committed, (uint8_t *)ring + (ring_tail & RING_MASK), pending))
+		return false;
+
+	header[HDR_USED] = committed + pending;
+	header[HDR_CHECK] = header_check();
+	if (!write_at(0, header, SDLOG_HEADER_SIZE) || f_sync(&log_file) != FR_OK)
+		return false;
+
+	synced = committed + pending;
+	if (log_clock)
+		last_sync = log_clock();
+	return true;
+}
+
+static void log_failed(void)
+{
+	PR_WARN("SD log write failed, logging stopped\n");
+	f_close(&log_file);
+	log_open = false;
+}
+
+static bool log_due(void)
+{
+	return sync_requested || ring_head - ring_tail >= SDLOG_BLOCK_SIZE
+		|| (synced != committed + (ring_head - ring_tail) && (!log_clock || log_clock() - last_sync >= sync_period));
+}
+
+/* One transfer while holding the card, everything on a sync request */
+static void log_step(void)
+{
+	if (sync_requested) {
+		sync_requested = false;
+		while (ring_head - ring_tail >= SDLOG_BLOCK_SIZE) {
+			if (!write_block()) {
+				log_failed();
+				return;
+			}
+		}
+		if (!write_sync())
+			log_failed();
+		return;
+	}
+
+	if (ring_head - ring_tail >= SDLOG_BLOCK_SIZE) {
+		if (!write_block())
+			log_failed();
+		return;
+	}
+
+	if (!write_sync())
+		log_failed();
+}
+
+int8_t sdlog_open(const char *filename, uint32_t capacity, uint32_t sync_ms, uint32_t (*clock)(void))
+{
+	UINT read;
+	uint32_t size = (capacity + SDLOG_BLOCK_SIZE - 1) & ~(SDLOG_BLOCK_SIZE - 1);
+	uint32_t used;
+	bool created = false;
+
+	sdlog_close();
+	if (!sdCardReady() || !size)
+		return -1;
+
+	if (f_open(&log_file, filename, FA_READ | FA_WRITE | FA_OPEN_ALWAYS) != FR_OK) {
+		PR_WARN("Unable to open log file: \"%s\"\n", filename);
+		return -1;
+	}
+
+	if (f_size(&log_file) == 0) {
+		/* New log, all clusters at once so the writes never search the FAT */
+		if (f_expand(&log_file, SDLOG_HEADER_SIZE + size, 1) != FR_OK) {
+			PR_WARN("No contiguous space for the log file: \"%s\"\n", filename);
+			f_close(&log_file);
+			return -2;
+		}
+		memset(header, 0, sizeof(header));
+		header[HDR_MAGIC] = SDLOG_MAGIC;
+		header[HDR_CAPACITY] = size;
+		used = 0;
+		created = true;
+	}
+	else if (f_read(&log_file, header, SDLOG_HEADER_SIZE, &read) != FR_OK || read != SDLOG_HEADER_SIZE
+		|| header[HDR_MAGIC] != SDLOG_MAGIC || header[HDR_CAPACITY] != size || header[HDR_CHECK] != header_check()
+		|| header[HDR_USED] > size || f_size(&log_file) < SDLOG_HEADER_SIZE + size) {
+		PR_WARN("Not a log file of this capacity: \"%s\"\n", filename);
+		f_close(&log_file);
+		return -3;
+	}
+	else {
+		used = header[HDR_USED];
+	}
+
+	/* Continue after the last complete block, the records past it go back into the ring */
+	log_capacity = size;
+	committed = used & ~(SDLOG_BLOCK_SIZE - 1);
+	ring_tail = 0;
+	ring_head = used - committed;
+	if (ring_head && (f_lseek(&log_file, SDLOG_HEADER_SIZE + committed) != FR_OK
+		|| f_read(&log_file, ring, ring_head, &read) != FR_OK || read != ring_head)) {
+		f_close(&log_file);
+		return -1;
+	}
+
+	sync_period = sync_ms;
+	log_clock = clock;
+	sync_requested = false;
+	log_open = true;
+	synced = used;
+	if (created && !write_sync()) {
+		log_failed();
+		return -1;
+	}
+	PR_INFO("SD log \"%s\" open, %lu of %lu bytes used\n", filename, (unsigned long)used, (unsigned long)size);
+	return 0;
+}
+
+void sdlog_close(void)
+{
+	if (!log_open)
+		return;
+
+	/* Shutting down, does not wait for the queued job */
+	sync_requested = true;
+	log_step();
+	if (log_open) {
+		f_close(&log_file);
+		log_open = false;
+	}
+}
+
+bool sdlog_is_open(void)
+{
+	return log_open;
+}
+
+bool sdlog_write(const void *record, uint32_t len)
+{
+	uint32_t pending = ring_head - ring_tail;
+	uint32_t idx, first;
+
+	if (!log_open || len > SDLOG_RING_SIZE - pending || committed + pending + len > log_capacity) {
+		dropped++;
+		return false;
+	}
+
+	idx = ring_head & RING_MASK;
+	first = (len < SDLOG_RING_SIZE - idx) ? len : (SDLOG_RING_SIZE - idx);
+	memcpy((uint8_t *)ring + idx, record, first);
+	memcpy(ring, (const uint8_t *)record + first, len - first);
+	ring_head += len;
+	return true;
+}
+
+void sdlog_sync_request(void)
+{
+	sync_requested = true;
+}
+
+static bool log_job(void *ctx)
+{
+	(void)(ctx);
+
+	if (!log_open || !log_due())
+		return false;
+	log_step();
+	return log_open && log_due();
+}
+
+void sdlog_task(void *ctx)
+{
+	(void)(ctx);
+
+	if (log_open && !sdPending(SD_CLIENT_LOG) && log_due())
+		sdRequest(SD_CLIENT_LOG, log_job, NULL);
+}
+
+uint32_t sdlog_used(void)
+{
+	return committed + (ring_head - ring_tail);
+}
+
+uint32_t sdlog_dropped(void)
+{
+	return dropped;
+}
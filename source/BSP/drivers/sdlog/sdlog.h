@@ -0,0 +1,59 @@
+/**
+ *  @file sdlog.h Buffered data logger on the SD card
+ *
+ *  @brief
+ *   Records are collected in a RAM ring and written to a preallocated file in whole blocks
+ **/
+
+#ifndef __SDLOG_H__
+#define __SDLOG_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Size of each file write, a multiple of the 512 byte sector */
+#ifndef SDLOG_BLOCK_SIZE
+#define SDLOG_BLOCK_SIZE 2048
+#endif
+
+/* Record ring, a power of two and a multiple of SDLOG_BLOCK_SIZE */
+#ifndef SDLOG_RING_SIZE
+#define SDLOG_RING_SIZE 8192
+#endif
+
+/* The first sector of the file holds the header, the records follow.
+ * The header keeps the number of record bytes, so a log is continued after a reset
+ * and a reader ignores the preallocated space past the last sync.
+ */
+#define SDLOG_HEADER_SIZE 512
+#define SDLOG_MAGIC		  0x474F4C53 /* "SLOG" */
+
+/* Open or continue the log file with room for capacity bytes of records, allocated as one
+ * contiguous area when the file is created. Buffered records are synced every sync_ms.
+ * Returns 0 on success, negative when the card is not ready, the space cannot be allocated
+ * or the file is not a log of the same capacity.
+ */
+int8_t	 sdlog_open(const char *filename, uint32_t capacity, uint32_t sync_ms, uint32_t (*clock)(void));
+void	 sdlog_close(void);
+bool	 sdlog_is_open(void);
+
+/* Append a record to the ring, never waits on the card.
+ * Returns false and counts the record as dropped when the ring or the file is full.
+ */
+bool	 sdlog_write(const void *record, uint32_t len);
+
+/* Write the buffered records and the header on the next turn of the log, also from interrupts,
+ * for example on a power fail warning
+ */
+void	 sdlog_sync_request(void);
+
+/* Scheduler task, queues the writes as a job of the SD_CLIENT_LOG client, which writes one
+ * block per turn, or everything on a sync request. sdArbiterTask must run as well.
+ */
+void	 sdlog_task(void *ctx);
+
+/* Record bytes in the file including the ring, and records lost */
+uint32_t sdlog_used(void);
+uint32_t sdlog_dropped(void);
+
+#endif /* __SDLOG_H__ */
@@ -54,6 +54,30 @@
 static bool is_registered = false;
 static bool is_initialized = false;
 
+/* Background sampler, a read of the temperature register is split into
+ * interrupt steps: register pointer write, repeated start with the first
+ * byte ACKed, then the last byte NACKed with a stop.
+ */
+typedef enum {
+	SAMPLE_IDLE = 0,
+	SAMPLE_POINTER,
+	SAMPLE_MSB,
+	SAMPLE_LSB,
+} sample_state_t;
+
+static volatile sample_state_t sample_state = SAMPLE_IDLE;
+static uint8_t sample_msb;
+static uint32_t sample_period;
+static uint32_t sample_due;
+static uint32_t sample_started;
+static uint32_t (*sample_clock)(void) = NULL;
+
+/* Last result, written by the I2C interrupt */
+static volatile int16_t sample_value;
+static volatile uint32_t sample_time;
+static volatile bool sample_valid = false;
+static volatile uint32_t sample_errors = 0;
+
 static int8_t read_temp_sensor_registers(uint8_t addr, uint8_t startReg, uint8_t* regData, int numBytes)
 {
 	int8_t ret_val = 0;
@@ -123,3 +147,113 @@ int max31725_init(void)
 	}
 	return 0;
 }
+
+static void sample_abort(void)
+{
+	sample_state = SAMPLE_IDLE;
+	sample_errors++;
+	/* Release the bus, the next period starts over */
+	I2CM->I2CM_CNTL_STATUS = MASK_I2CM_CNTL_STOP;
+}
+
+static void max31725_isr(void)
+{
+	uint8_t status;
+
+	if (!i2cm_is_interrupted(MASK_I2CM_FIFO_INT_PEND_I2C_INT))
+		return;
+
+	status = I2CM->I2CM_CNTL_STATUS;
+	if (status & (MASK_I2CM_STATUS_ERROR | MASK_I2CM_STATUS_ARB_LOST)) {
+		sample_abort();
+		return;
+	}
+
+	switch (sample_state) {
+	case SAMPLE_POINTER:
+		sample_state = SAMPLE_MSB;
+		I2CM->I2CM_SLV_ADDR = TEMP_SENSOR_ADDRESS | 1;
+		I2CM->I2CM_CNTL_STATUS = MASK_I2CM_CNTL_START | MASK_I2CM_CNTL_RUN | MASK_I2CM_CNTL_ACK;
+		break;
+	case SAMPLE_MSB:
+		sample_msb = I2CM->I2CM_DATA;
+		sample_state = SAMPLE_LSB;
+		I2CM->I2CM_CNTL_STATUS = MASK_I2CM_CNTL_RUN | MASK_I2CM_CNTL_STOP;
+		break;
+	case SAMPLE_LSB:
+		/* Two's complement with 8 fractional bits, already 1/256 deg C */
+		sample_value = (int16_t)(((uint16_t)sample_msb << 8) | I2CM->I2CM_DATA);
+		sample_time = sample_started;
+		sample_valid = true;
+		sample_state = SAMPLE_IDLE;
+		break;
+	default:
+		break;
+	}
+}
+
+int max31725_sampler_start(uint32_t period_ms, uint32_t (*clock)(void))
+{
+	int iRet = max31725_init();
+	if (iRet)
+		return iRet;
+
+	sample_clock = clock;
+	sample_period = period_ms;
+	sample_due = clock();
+	sample_state = SAMPLE_IDLE;
+
+	interrupt_attach(interrupt_i2cm, (int8_t)interrupt_i2cm, max31725_isr);
+	i2cm_interrupt_enable(MASK_I2CM_FIFO_INT_ENABLE_I2C_INT);
+	return 0;
+}
+
+void max31725_sampler_poll(void)
+{
+	uint32_t now;
+
+	if (!sample_clock)
+		return;
+
+	now = sample_clock();
+	if (sample_state != SAMPLE_IDLE) {
+		/* A transfer that never completed, the bus is reset on the next start */
+		if ((int32_t)(now - sample_started) > MAX31725_SAMPLE_TIMEOUT_MS)
+			sample_abort();
+		return;
+	}
+	if ((int32_t)(now - sample_due) < 0)
+		return;
+
+	sample_due = now + sample_period;
+	sample_started = now;
+	sample_state = SAMPLE_POINTER;
+
+	/* The sensor is left in continuous conversion by max31725_init, only the latest result is fetched */
+	sys_i2c_swop(0);
+	I2CM->I2CM_SLV_ADDR = TEMP_SENSOR_ADDRESS;
+	I2CM->I2CM_DATA = REG_TEMPERATURE;
+	I2CM->I2CM_CNTL_STATUS = MASK_I2CM_CNTL_START | MASK_I2CM_CNTL_RUN;
+}
+
+bool max31725_sample(int16_t *deg_c_q8, uint32_t *timestamp)
+{
+	bool valid;
+
+	interrupt_disable_globally();
+	valid = sample_valid;
+	if (valid) {
+		if (deg_c_q8)
+			*deg_c_q8 = sample_value;
+		if (timestamp)
+			*timestamp = sample_time;
+	}
+	interrupt_enable_globally();
+
+	return valid;
+}
+
+uint32_t max31725_sample_errors(void)
+{
+	return sample_errors;
+}
@@ -8,7 +8,24 @@
 #ifndef __MAX31725_H__
 #define __MAX31725_H__
 
+#include <stdint.h>
+#include <stdbool.h>
+
+/* A sample transfer that is not finished after this long is aborted */
+#define MAX31725_SAMPLE_TIMEOUT_MS 50
+
 int	  max31725_init(void);
 float max31725_deg_C(void);
 
+/* Background sampling: the temperature is read every period_ms through the I2C master
+ * interrupt, max31725_sampler_poll() starts a read when it is due and never waits on the bus.
+ * clock returns milliseconds and stamps each sample. max31725_deg_C() must not be used once it runs.
+ */
+int		 max31725_sampler_start(uint32_t period_ms, uint32_t (*clock)(void));
+void	 max31725_sampler_poll(void);
+
+/* Latest sample in 1/256 deg C and its timestamp, false until the first read completed */
+bool	 max31725_sample(int16_t *deg_c_q8, uint32_t *timestamp);
+uint32_t max31725_sample_errors(void);
+
 #endif /* __MAX31725_H__ */
\ No newline at end of file
@@ -0,0 +1,130 @@
+/**
+ *  @file timesync.c Shared millisecond clock over the RS-485 bus
+ *
+ *  @brief
+ *   The master broadcasts its clock, the other stations follow it with an offset to their own clock
+ **/
+
+#include <stdio.h>
+#include "bsp_debug.h"
+#include "modbus.h"
+#include "timesync.h"
+
+/* Uptimes differ by days, so the offset is kept in whole milliseconds with a fraction in 1/16 ms
+ * for the filter, a new sample moves it by an eighth of the error
+ */
+#define FRACTION_SHIFT 4
+#define FILTER_SHIFT   3
+
+static uint32_t (*ts_clock)(void) = NULL;
+static bool ts_master = false;
+static bool ts_synced = false;
+static uint32_t ts_offset = 0;
+static int32_t ts_fraction = 0; /* 0..15 */
+static uint32_t ts_last = 0; /* Local time of the last sample */
+static uint32_t ts_due = 0;
+
+/* The sample is the master time against the local time at the first byte of the frame.
+ * The master reads its clock just before the frame goes out, so both are the same moment
+ * but for one character time, well below the millisecond.
+ */
+static int16_t timesync_broadcast(uint8_t target, const uint8_t *data, uint32_t len, uint8_t *reply)
+{
+	uint32_t master_time, local;
+	int32_t error;
+
+	(void)(target);
+	(void)(reply);
+	if (len != 4)
+		return -MODBUS_EX_ILLEGAL_VALUE;
+	if (ts_master)
+		return 0;
+
+	master_time = ((uint32_t)data[0] << 24) | ((uint32_t)data[1] << 16) | ((uint32_t)data[2] << 8) | data[3];
+	local = modbus_frame_time();
+	error = (int32_t)(master_time - local - ts_offset);
+
+	if (!ts_synced || error > TIMESYNC_STEP_MS || error < -TIMESYNC_STEP_MS) {
+		if (ts_synced)
+			PR_WARN("Time sync stepped by %ld ms\n", error);
+		ts_offset = master_time - local;
+		ts_fraction = 0;
+		ts_synced = true;
+	}
+	else {
+		ts_fraction += ((error << FRACTION_SHIFT) - ts_fraction) >> FILTER_SHIFT;
+		ts_offset += (uint32_t)(ts_fraction >> FRACTION_SHIFT);
+		ts_fraction &= (1 << FRACTION_SHIFT) - 1;
+	}
+	ts_last = local;
+	return 0;
+}
+
+void timesync_init(bool master, uint32_t (*clock)(void))
+{
+	ts_clock = clock;
+	ts_synced = false;
+	ts_due = clock();
+	timesync_set_master(master);
+	modbus_set_function(TIMESYNC_FC, timesync_broadcast);
+}
+
+void timesync_set_master(bool master)
+{
+	if (master == ts_master)
+		return;
+	/* A new master starts from its own clock, the others step to it on its first broadcast */
+	ts_master = master;
+	ts_synced = false;
+	ts_offset = 0;
+	ts_fraction = 0;
+}
+
+void timesync_task(void *ctx)
+{
+	uint8_t data[4];
+	uint32_t now;
+
+	(void)(ctx);
+	now = ts_clock();
+
+	if (!ts_master) {
+		if (ts_synced && now - ts_last > TIMESYNC_HOLDOVER_MS) {
+			PR_WARN("Time sync lost\n");
+			ts_synced = false;
+		}
+		return;
+	}
+
+	if ((int32_t)(now - ts_due) < 0)
+		return;
+
+	/* Retried on the next run while the bus is busy */
+	now = ts_clock();
+	data[0] = (uint8_t)(now >> 24);
+	data[1] = (uint8_t)(now >> 16);
+	data[2] = (uint8_t)(now >> 8);
+	data[3] = (uint8_t)now;
+	if (modbus_master_broadcast(TIMESYNC_FC, data, sizeof(data)))
+		ts_due = now + TIMESYNC_PERIOD_MS;
+}
+
+bool timesync_offset(int32_t *offset)
+{
+	if (ts_master) {
+		*offset = 0;
+		return true;
+	}
+	if (!ts_synced)
+		return false;
+	/* Rounded to the nearest millisecond */
+	*offset = (int32_t)(ts_offset + (ts_fraction >> (FRACTION_SHIFT - 1)));
+	return true;
+}
+
+uint32_t timesync_millis(void)
+{
+	int32_t offset = 0;
+	timesync_offset(&offset);
+	return ts_clock() + (uint32_t)offset;
+}
@@ -0,0 +1,51 @@
+/**
+ *  @file timesync.h Shared millisecond clock over the RS-485 bus
+ *
+ *  @brief
+ *   The master broadcasts its clock, the other stations follow it with an offset to their own clock
+ **/
+
+#ifndef __TIMESYNC_H__
+#define __TIMESYNC_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Modbus user defined function code of the time broadcast, 4 bytes of master time follow */
+#define TIMESYNC_FC 0x41
+
+/* Master broadcast period */
+#ifndef TIMESYNC_PERIOD_MS
+#define TIMESYNC_PERIOD_MS 1000
+#endif
+
+/* A sample further than this from the current offset is taken as is, instead of being filtered in,
+ * for example after the master restarted
+ */
+#ifndef TIMESYNC_STEP_MS
+#define TIMESYNC_STEP_MS 50
+#endif
+
+/* The last offset is kept this long without a broadcast, the clocks drift apart by about 5 ms a minute at worst */
+#ifndef TIMESYNC_HOLDOVER_MS
+#define TIMESYNC_HOLDOVER_MS 60000
+#endif
+
+/* Register the broadcast with the Modbus engine, which must be initialised. The master is
+ * synchronised to itself and sends its clock from timesync_task.
+ */
+void timesync_init(bool master, uint32_t (*clock)(void));
+void timesync_set_master(bool master);
+
+/* Scheduler task, sends the broadcast when due on the master */
+void timesync_task(void *ctx);
+
+/* Offset to add to the local clock to get the shared time. Returns false while not synchronised.
+ * Fits Esd_Parameters.SharedClock of the ESD framework.
+ */
+bool timesync_offset(int32_t *offset);
+
+/* Shared time, the local clock while not synchronised */
+uint32_t timesync_millis(void);
+
+#endif /* __TIMESYNC_H__ */
@@ -254,6 +254,7 @@ static USB_CDC_line_coding cdc_line_coding = {
 
 /* END CDC Configuration */
 
+// Single producer ring: Head is only written by usbdbg_write_byte, Tail only by usbdbg_drain
 volatile static uint32_t Head;
 volatile static uint32_t Tail;
 
@@ -264,10 +265,90 @@ volatile static uint32_t Tail;
 #define Z_NumElem() ((Head - Tail) & BUFF_MOD)
 uint8_t cdc_tx_buffer[BUFF_SIZE];
 
+// While held, output stays in the ring buffer until usbdbg_hold(false)
+volatile static bool s_Hold = false;
+
+// Bytes dropped because the ring was full
+volatile static uint32_t s_Dropped = 0;
+
+// Packets taken from the OUT endpoint per poll while the receiver has room
+#define RX_PACKETS_MAX 16
+
+static const usbdbg_receiver_t *s_Receiver = NULL;
+
+void usbdbg_set_receiver(const usbdbg_receiver_t *receiver)
+{
+  s_Receiver = receiver;
+}
+
+void usbdbg_hold(bool hold)
+{
+  s_Hold = hold;
+}
+
+uint32_t usbdbg_dropped(void)
+{
+  return s_Dropped;
+}
+
 void usbdbg_write_byte(uint8_t b)
 {
-  if (!Z_IsBuffFull())
-    cdc_tx_buffer[Head++ & BUFF_MOD] = b;
+  // Never wait for the host, logging must not change the timing of the caller
+  if (Z_IsBuffFull())
+  {
+    ++s_Dropped;
+    return;
+  }
+  cdc_tx_buffer[Head & BUFF_MOD] = b;
+  Head = Head + 1; // Publish the byte only once it is stored
+}
+
+bool usbdbg_write(const uint8_t *data, uint32_t len)
+{
+  uint32_t head = Head;
+  uint32_t i;
+
+  // All or nothing, so a binary record is never cut in the stream
+  if (BUFF_MOD - Z_NumElem() < len)
+  {
+    s_Dropped += len;
+    return false;
+  }
+  for (i = 0; i < len; ++i)
+    cdc_tx_buffer[(head + i) & BUFF_MOD] = data[i];
+  Head = head + len;
+  return true;
+}
+
+// Queue packets from the ring into the IN endpoint until both of its buffers are taken, without waiting for the host.
+// The endpoint reads straight from the ring, so each packet is the longest contiguous span up to CDC_DATA_EP_SIZE.
+// Runs from the endpoint interrupt when a packet has gone out, and from usbdbg_try_to_send to restart an idle endpoint
+static void usbdbg_drain(void)
+{
+  while (!s_Hold && !Z_IsBuffEmpty() && !USBD_ep_buffer_full(CDC_EP_DATA_IN))
+  {
+    uint32_t tail = Tail & BUFF_MOD;
+    uint32_t len;
+    int32_t sent;
+
+    // Up to the end of the buffer, the wrapped part goes with the next packet
+    len = Z_NumElem();
+    if (tail + len > BUFF_SIZE)
+      len = BUFF_SIZE - tail;
+    if (len > CDC_DATA_EP_SIZE)
+      len = CDC_DATA_EP_SIZE;
+
+    sent = USBD_transfer(CDC_EP_DATA_IN, &cdc_tx_buffer[tail], len);
+    if (sent <= 0)
+      break;
+    Tail = Tail + sent;
+  }
+}
+
+static void usbdbg_data_in_cb(USBD_ENDPOINT_NUMBER ep_number)
+{
+  (void)ep_number;
+  usbdbg_drain();
 }
 
 void powermanagement_ISR(void)
@@ -644,7 +725,7 @@ void usbdbg_init(void)
         USBD_create_endpoint(CDC_EP_DATA_OUT, USBD_EP_BULK, USBD_DIR_OUT,
                              CDC_DATA_USBD_EP_SIZE, USBD_DB_ON, NULL /*ep_cb*/);
         USBD_create_endpoint(CDC_EP_DATA_IN, USBD_EP_BULK, USBD_DIR_IN,
-                             CDC_DATA_USBD_EP_SIZE, USBD_DB_ON, NULL /*ep_cb*/);
+                             CDC_DATA_USBD_EP_SIZE, USBD_DB_ON, usbdbg_data_in_cb);
 
         cdc_send_serial_state_notification();
         break;
@@ -663,88 +744,37 @@ void usbdbg_init(void)
   }
 }
 
-void send_over_usb(uint8_t *p, uint32_t len)
-{
-  uint32_t sent = len;
-  while (sent)
-  {
-    sent -= USBD_transfer(CDC_EP_DATA_IN, p, sent);
-  }
-}
-
 void usbdbg_main(void)
 {
-  int8_t status;
-
-  do
-  {
-
-    while (!USBD_ep_buffer_full(CDC_EP_DATA_IN) && !Z_IsBuffEmpty())
-    {
-      // Read in a packet of data from the UART.
-      // (up to the size of the ring buffer)
-      uint32_t len = Z_NumElem();
-      if ((Tail & BUFF_MOD) + len <= BUFF_SIZE)
-      { // no rollover?
-        send_over_usb(&cdc_tx_buffer[Tail & BUFF_MOD], len);
-        Tail += len;
-      }
-      else
-      {
-        // This assumes that all the data will get transferred in USBD_transfer(), otherwise you need a loop
-        len -= BUFF_SIZE - (Tail & BUFF_MOD);
-        send_over_usb(&cdc_tx_buffer[Tail & BUFF_MOD], BUFF_SIZE - (Tail & BUFF_MOD));
-        Tail += BUFF_SIZE - (Tail & BUFF_MOD);
-        send_over_usb(&cdc_tx_buffer[Tail & BUFF_MOD], len);
-        Tail += len;
-      }
-    }
-
-    // If data is available on the USB OUT endpoint and there is space
-    // in the ring buffer to receive it then read it in from the host.
-    if ((USBD_ep_buffer_full(CDC_EP_DATA_OUT)))
-    { //&& (uart0BufferOut_avail >= CDC_DATA_EP_SIZE)
-      uint8_t bufUsb2Uart[CDC_DATA_EP_SIZE] = {0};
-      // Read in a packet of data from the CDC DATA interface.
-      USBD_transfer(CDC_EP_DATA_OUT, (uint8_t *)&bufUsb2Uart, CDC_DATA_EP_SIZE);
-    }
-    status = (USBD_get_state() < USBD_STATE_DEFAULT) ? USBD_ERR_NOT_CONFIGURED : USBD_OK;
-    (void)status;
-  } while (0);
+  usbdbg_try_to_send();
 }
 
 void usbdbg_try_to_send(void)
 {
   int8_t status;
+  uint32_t i;
+
+  if (s_Hold)
+    return;
 
-  while (!USBD_ep_buffer_full(CDC_EP_DATA_IN) && !Z_IsBuffEmpty())
+  // Restart the drain if the endpoint went idle, the endpoint interrupt takes over from there
+  interrupt_disable_globally();
+  usbdbg_drain();
+  interrupt_enable_globally();
+
+  // Read in packets from the CDC DATA interface straight into the memory of the receiver while it has room,
+  // otherwise they stay in the endpoint and the host is held off
+  for (i = 0; i < RX_PACKETS_MAX; ++i)
   {
-    // Read in a packet of data from the UART.
-    // (up to the size of the ring buffer)
-    uint32_t len = Z_NumElem();
-    if ((Tail & BUFF_MOD) + len <= BUFF_SIZE)
-    { // no rollover?
-      send_over_usb(&cdc_tx_buffer[Tail & BUFF_MOD], len);
-      Tail += len;
-    }
-    else
-    {
-      // This assumes that all the data will get transferred in USBD_transfer(), otherwise you need a loop
-      len -= BUFF_SIZE - (Tail & BUFF_MOD);
-      send_over_usb(&cdc_tx_buffer[Tail & BUFF_MOD], BUFF_SIZE - (Tail & BUFF_MOD));
-      Tail += BUFF_SIZE - (Tail & BUFF_MOD);
-      send_over_usb(&cdc_tx_buffer[Tail & BUFF_MOD], len);
-      Tail += len;
-    }
-  }
+    static uint32_t discard[CDC_DATA_EP_SIZE / 4];
+    uint8_t *buffer = s_Receiver ? s_Receiver->buffer() : (uint8_t *)discard;
+    int32_t len;
 
-  // If data is available on the USB OUT endpoint and there is space
-  // in the ring buffer to receive it then read it in from the host.
-  if ((USBD_ep_buffer_full(CDC_EP_DATA_OUT)))
-  { //&& (uart0BufferOut_avail >= CDC_DATA_EP_SIZE)
-    uint8_t bufUsb2Uart[CDC_DATA_EP_SIZE] = {0};
-    // Read in a packet of data from the CDC DATA interface.
-    USBD_transfer(CDC_EP_DATA_OUT, (uint8_t *)&bufUsb2Uart, CDC_DATA_EP_SIZE);
+    if (!buffer || !USBD_ep_buffer_full(CDC_EP_DATA_OUT))
+      break;
+    len = USBD_transfer(CDC_EP_DATA_OUT, buffer, CDC_DATA_EP_SIZE);
+    if (len > 0 && s_Receiver)
+      s_Receiver->received(buffer, (uint32_t)len);
   }
   status = (USBD_get_state() < USBD_STATE_DEFAULT) ? USBD_ERR_NOT_CONFIGURED : USBD_OK;
   (void)status;
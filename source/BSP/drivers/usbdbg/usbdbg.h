@@ -149,9 +149,23 @@
   #define DPRINTF_INFO(str, ...)
 #endif
 
+/* Consumer of the OUT endpoint. buffer is called on every usbdbg_try_to_send, and returns where the next packet
+   is to be read to, with room for CDC_DATA_EP_SIZE bytes, or NULL to hold off the host. The endpoint delivers
+   straight into that memory, received is then called with the same pointer. Without a receiver, packets are
+   discarded */
+typedef struct usbdbg_receiver
+{
+  uint8_t *(*buffer)(void);
+  void (*received)(uint8_t *data, uint32_t len);
+} usbdbg_receiver_t;
+
 void usbdbg_init(void);
 void usbdbg_main(void);
 void usbdbg_write_byte(uint8_t b);
+bool usbdbg_write(const uint8_t *data, uint32_t len);
 void usbdbg_try_to_send(void);
+void usbdbg_hold(bool hold);
+uint32_t usbdbg_dropped(void);
+void usbdbg_set_receiver(const usbdbg_receiver_t *receiver);
 
 #endif /* INCLUDES_USBDBG_H_ */
@@ -0,0 +1,48 @@
+/*
+ * @file usbdbg_trace.c
+ *
+ * Binary trace records on the USB debug stream, see usbdbg_trace.h
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "usbdbg.h"
+#include "usbdbg_trace.h"
+
+static uint32_t (*s_Clock)(void) = NULL;
+
+void usbdbg_trace_init(uint32_t (*clock)(void))
+{
+  s_Clock = clock;
+}
+
+void usbdbg_trace_emit(const char *fmt, const uint32_t *args, uint32_t argc)
+{
+  uint8_t record[2 + 4 * (2 + USBDBG_TRACE_MAX_ARGS)];
+  uint32_t words[2 + USBDBG_TRACE_MAX_ARGS];
+  uint32_t i;
+  uint32_t len;
+
+  if (argc > USBDBG_TRACE_MAX_ARGS)
+    argc = USBDBG_TRACE_MAX_ARGS;
+
+  words[0] = (uint32_t)(uintptr_t)fmt;
+  words[1] = s_Clock ? s_Clock() : 0;
+  for (i = 0; i < argc; ++i)
+    words[2 + i] = args[i];
+
+  record[0] = USBDBG_TRACE_MARKER;
+  record[1] = (uint8_t)argc;
+  len = 2;
+  for (i = 0; i < 2 + argc; ++i)
+  {
+    record[len++] = (uint8_t)words[i];
+    record[len++] = (uint8_t)(words[i] >> 8);
+    record[len++] = (uint8_t)(words[i] >> 16);
+    record[len++] = (uint8_t)(words[i] >> 24);
+  }
+
+  if (usbdbg_write(record, len))
+    usbdbg_try_to_send();
+}
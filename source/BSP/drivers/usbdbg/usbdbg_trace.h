@@ -0,0 +1,54 @@
+/*
+ * @file usbdbg_trace.h
+ *
+ * Binary trace records on the USB debug stream.
+ *
+ * Instead of formatting text on the target, a record carries the address of the format string, a timestamp and
+ * up to four 32-bit arguments. tools/trace_decode.py looks the format strings up in the ELF file and prints the
+ * text on the host. Records can be mixed with regular text output, the marker byte never occurs in ASCII text.
+ *
+ * Record layout, little endian:
+ *   uint8_t  USBDBG_TRACE_MARKER
+ *   uint8_t  number of arguments
+ *   uint32_t format string address
+ *   uint32_t timestamp
+ *   uint32_t arguments[]
+ */
+
+#ifndef INCLUDES_USBDBG_TRACE_H_
+#define INCLUDES_USBDBG_TRACE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define USBDBG_TRACE_MARKER 0xA5
+#define USBDBG_TRACE_MAX_ARGS 4
+
+/* Set the timestamp source, timestamps are zero until set */
+void usbdbg_trace_init(uint32_t (*clock)(void));
+
+/* Queue one record, dropped as a whole when the ring is full */
+void usbdbg_trace_emit(const char *fmt, const uint32_t *args, uint32_t argc);
+
+#define USBDBG_TRACE_U32(x) ((uint32_t)(uintptr_t)(x))
+#define USBDBG_TRACE_ARGS_0()
+#define USBDBG_TRACE_ARGS_1(a) , USBDBG_TRACE_U32(a)
+#define USBDBG_TRACE_ARGS_2(a, b) , USBDBG_TRACE_U32(a), USBDBG_TRACE_U32(b)
+#define USBDBG_TRACE_ARGS_3(a, b, c) , USBDBG_TRACE_U32(a), USBDBG_TRACE_U32(b), USBDBG_TRACE_U32(c)
+#define USBDBG_TRACE_ARGS_4(a, b, c, d) , USBDBG_TRACE_U32(a), USBDBG_TRACE_U32(b), USBDBG_TRACE_U32(c), USBDBG_TRACE_U32(d)
+#define USBDBG_TRACE_COUNT_(_0, _1, _2, _3, _4, n, ...) n
+#define USBDBG_TRACE_COUNT(...) USBDBG_TRACE_COUNT_(0, ##__VA_ARGS__, 4, 3, 2, 1, 0)
+#define USBDBG_TRACE_CAT_(a, b) a##b
+#define USBDBG_TRACE_CAT(a, b) USBDBG_TRACE_CAT_(a, b)
+
+/* Trace with a printf style format string literal and up to four integer or pointer arguments.
+   String arguments are only expanded by the decoder when they point to constant data in the ELF */
+#define USBDBG_TRACE(fmt, ...)                                                                                     \
+	do                                                                                                             \
+	{                                                                                                              \
+		static const char usbdbg_trace_fmt_[] = fmt;                                                               \
+		const uint32_t usbdbg_trace_args_[] = { 0 USBDBG_TRACE_CAT(USBDBG_TRACE_ARGS_, USBDBG_TRACE_COUNT(__VA_ARGS__))(__VA_ARGS__) }; \
+		usbdbg_trace_emit(usbdbg_trace_fmt_, &usbdbg_trace_args_[1], USBDBG_TRACE_COUNT(__VA_ARGS__));           \
+	} while (false)
+
+#endif /* INCLUDES_USBDBG_TRACE_H_ */
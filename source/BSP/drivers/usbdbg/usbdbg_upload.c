@@ -0,0 +1,298 @@
+/*
+ * @file usbdbg_upload.c
+ *
+ * File upload to the SD card over the USB debug port, see usbdbg_upload.h
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "bsp_hwdefs.h"
+#include "ff.h"
+#include "sdcard.h"
+#include "usbdbg.h"
+#include "usbdbg_upload.h"
+
+#if (USBDBG_UPLOAD_BLOCK % 512) || (USBDBG_UPLOAD_BLOCK < CDC_DATA_EP_SIZE)
+#error USBDBG_UPLOAD_BLOCK must be a multiple of 512
+#endif
+
+#define HEADER_SIZE 13
+
+// Word aligned, so full blocks go straight to a multi-sector write
+static uint32_t s_Blocks[2][USBDBG_UPLOAD_BLOCK / 4];
+static uint32_t s_Fill[2];
+static bool s_Full[2];
+static uint8_t s_Receiving; // Block being filled
+static uint8_t s_Writing; // Next block to write, blocks are written in the order they were filled
+
+// Packets which do not fit in place: the header, and those continuing into the other block
+static uint32_t s_Bounce[CDC_DATA_EP_SIZE / 4];
+
+static bool s_Active = false;
+static bool s_Open = false;
+static bool s_Failed = false;
+static bool s_JobQueued = false;
+static uint32_t s_Size;
+static uint32_t s_Crc; // From the header
+static uint32_t s_RxCrc;
+static uint32_t s_Received;
+static uint32_t s_LastRx;
+static uint32_t (*s_Clock)(void) = NULL;
+static void (*s_Done)(const char *name, usbdbg_upload_status_t status) = NULL;
+
+static char s_Name[USBDBG_UPLOAD_NAME_MAX + 1];
+static char s_TempName[USBDBG_UPLOAD_NAME_MAX + 5];
+static FIL s_File;
+
+// CRC-32 one nibble at a time, the same as zlib.crc32 on the host
+static const uint32_t s_CrcTable[16] = {
+  0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+  0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+};
+
+static uint32_t crc32_update(uint32_t crc, const uint8_t *data, uint32_t len)
+{
+  crc = ~crc;
+  while (len--)
+  {
+    crc ^= *data++;
+    crc = (crc >> 4) ^ s_CrcTable[crc & 0x0F];
+    crc = (crc >> 4) ^ s_CrcTable[crc & 0x0F];
+  }
+  return ~crc;
+}
+
+static uint32_t get32(const uint8_t *p)
+{
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static void send_status(usbdbg_upload_status_t status)
+{
+  uint8_t record[7];
+
+  record[0] = USBDBG_UPLOAD_MARKER;
+  record[1] = 'U';
+  record[2] = (uint8_t)status;
+  record[3] = (uint8_t)s_RxCrc;
+  record[4] = (uint8_t)(s_RxCrc >> 8);
+  record[5] = (uint8_t)(s_RxCrc >> 16);
+  record[6] = (uint8_t)(s_RxCrc >> 24);
+  usbdbg_write(record, sizeof(record));
+}
+
+static void finish(usbdbg_upload_status_t status)
+{
+  if (s_Open)
+  {
+    if (f_close(&s_File) != FR_OK && status == USBDBG_UPLOAD_OK)
+      status = USBDBG_UPLOAD_FILE_ERROR;
+    s_Open = false;
+  }
+  if (status == USBDBG_UPLOAD_OK)
+  {
+    // The previous file is only removed once the new one is complete
+    FRESULT res = f_unlink(s_Name);
+    if ((res != FR_OK && res != FR_NO_FILE) || f_rename(s_TempName, s_Name) != FR_OK)
+      status = USBDBG_UPLOAD_FILE_ERROR;
+  }
+  if (status != USBDBG_UPLOAD_OK)
+    f_unlink(s_TempName);
+
+  s_Active = false;
+  send_status(status);
+  if (s_Done)
+    s_Done(s_Name, status);
+}
+
+// Runs as a job of the SD arbiter, one block per turn
+static bool upload_job(void *ctx)
+{
+  (void)ctx;
+
+  if (!s_Active)
+  {
+    s_JobQueued = false;
+    return false;
+  }
+
+  if (!s_Open && !s_Failed)
+  {
+    if (!sdCardReady() || f_open(&s_File, s_TempName, FA_WRITE | FA_CREATE_ALWAYS) != FR_OK)
+    {
+      s_Failed = true;
+    }
+    else
+    {
+      // Contiguous when the card has the space, otherwise the clusters are allocated as the blocks are written
+      s_Open = true;
+      if (f_expand(&s_File, s_Size, 1) != FR_OK)
+        f_lseek(&s_File, 0);
+    }
+  }
+
+  if (s_Full[s_Writing])
+  {
+    UINT written;
+    if (!s_Failed && (f_write(&s_File, s_Blocks[s_Writing], s_Fill[s_Writing], &written) != FR_OK || written != s_Fill[s_Writing]))
+      s_Failed = true;
+    s_Fill[s_Writing] = 0;
+    s_Full[s_Writing] = false;
+    s_Writing ^= 1;
+  }
+
+  if (s_Received == s_Size && !s_Full[0] && !s_Full[1])
+  {
+    finish(s_Failed ? USBDBG_UPLOAD_FILE_ERROR
+                    : (s_RxCrc != s_Crc ? USBDBG_UPLOAD_CRC_ERROR : USBDBG_UPLOAD_OK));
+    s_JobQueued = false;
+    return false;
+  }
+
+  s_JobQueued = s_Full[s_Writing];
+  return s_JobQueued;
+}
+
+static void queue_job(void)
+{
+  if (!s_JobQueued && (s_Full[s_Writing] || s_Received == s_Size))
+    s_JobQueued = sdRequest(SD_CLIENT_ASSET, upload_job, NULL);
+}
+
+// Takes n bytes which are in place at the end of the receiving block
+static void commit(uint32_t n)
+{
+  uint8_t *block = (uint8_t *)s_Blocks[s_Receiving];
+
+  s_RxCrc = crc32_update(s_RxCrc, block + s_Fill[s_Receiving], n);
+  s_Fill[s_Receiving] += n;
+  s_Received += n;
+
+  if (s_Fill[s_Receiving] == USBDBG_UPLOAD_BLOCK || s_Received == s_Size)
+  {
+    s_Full[s_Receiving] = true;
+    s_Receiving ^= 1;
+  }
+}
+
+static void store(const uint8_t *data, uint32_t len)
+{
+  // Bytes past the announced size are dropped
+  if (len > s_Size - s_Received)
+    len = s_Size - s_Received;
+
+  while (len)
+  {
+    uint8_t *block = (uint8_t *)s_Blocks[s_Receiving];
+    uint32_t n = USBDBG_UPLOAD_BLOCK - s_Fill[s_Receiving];
+    if (n > len)
+      n = len;
+
+    memcpy(block + s_Fill[s_Receiving], data, n);
+    commit(n);
+    data += n;
+    len -= n;
+  }
+}
+
+static bool parse_header(const uint8_t *data, uint32_t len)
+{
+  uint32_t nameLen;
+
+  if (len < HEADER_SIZE || get32(data) != USBDBG_UPLOAD_MAGIC)
+    return false; // Not an upload, discarded
+
+  nameLen = data[12];
+  if (!nameLen || nameLen > USBDBG_UPLOAD_NAME_MAX || HEADER_SIZE + nameLen > len || !get32(data + 4))
+  {
+    s_RxCrc = 0;
+    send_status(USBDBG_UPLOAD_HEADER_ERROR);
+    return false;
+  }
+
+  memcpy(s_Name, data + HEADER_SIZE, nameLen);
+  s_Name[nameLen] = '\0';
+  memcpy(s_TempName, s_Name, nameLen);
+  memcpy(s_TempName + nameLen, ".tmp", 5);
+
+  s_Size = get32(data + 4);
+  s_Crc = get32(data + 8);
+  s_RxCrc = 0;
+  s_Received = 0;
+  s_Fill[0] = s_Fill[1] = 0;
+  s_Full[0] = s_Full[1] = false;
+  s_Receiving = s_Writing = 0;
+  s_Failed = false;
+  s_Active = true;
+
+  // Data sent together with the header
+  store(data + HEADER_SIZE + nameLen, len - HEADER_SIZE - nameLen);
+  return true;
+}
+
+static uint8_t *upload_buffer(void)
+{
+  if (!s_Active)
+    return (uint8_t *)s_Bounce;
+
+  if (s_Clock && s_Received < s_Size && s_Clock() - s_LastRx > USBDBG_UPLOAD_TIMEOUT_MS && !s_Full[0] && !s_Full[1])
+  {
+    // The host went away, the next header starts over
+    s_Received = s_Size;
+    s_Failed = true;
+    queue_job();
+    return (uint8_t *)s_Bounce;
+  }
+
+  queue_job();
+
+  if (s_Full[s_Receiving])
+    return NULL;
+  if (USBDBG_UPLOAD_BLOCK - s_Fill[s_Receiving] >= CDC_DATA_EP_SIZE)
+    return (uint8_t *)s_Blocks[s_Receiving] + s_Fill[s_Receiving];
+
+  // A packet may continue into the other block
+  return s_Full[s_Receiving ^ 1] ? NULL : (uint8_t *)s_Bounce;
+}
+
+static void upload_received(uint8_t *data, uint32_t len)
+{
+  if (s_Clock)
+    s_LastRx = s_Clock();
+
+  if (!s_Active)
+  {
+    parse_header(data, len);
+  }
+  else if (s_Received < s_Size)
+  {
+    if (data != (uint8_t *)s_Bounce)
+      commit(len < s_Size - s_Received ? len : s_Size - s_Received);
+    else
+      store(data, len);
+  }
+  queue_job();
+}
+
+static const usbdbg_receiver_t s_Receiver = {
+  upload_buffer,
+  upload_received
+};
+
+void usbdbg_upload_init(uint32_t (*clock)(void))
+{
+  s_Clock = clock;
+  usbdbg_set_receiver(&s_Receiver);
+}
+
+void usbdbg_upload_set_done(void (*done)(const char *name, usbdbg_upload_status_t status))
+{
+  s_Done = done;
+}
+
+bool usbdbg_upload_busy(void)
+{
+  return s_Active;
+}
@@ -0,0 +1,67 @@
+/*
+ * @file usbdbg_upload.h
+ *
+ * File upload to the SD card over the OUT endpoint of the USB debug port.
+ *
+ * The host sends a header, then the file data. Packets are read straight into two blocks, one is written to the card
+ * as a job of the SD arbiter while the other fills, and the host is held off while both are full. The file is
+ * written to a temporary name next to the target, and only replaces the target once the CRC-32 (as zlib.crc32)
+ * of the data matches the header. tools/usb_upload.py implements the host side.
+ *
+ * Header layout, little endian, sent as its own transfer:
+ *   uint32_t USBDBG_UPLOAD_MAGIC
+ *   uint32_t file size
+ *   uint32_t CRC-32 of the file data
+ *   uint8_t  name length, followed by the name without terminator
+ *
+ * When the upload completes or fails, a status record is queued on the debug stream:
+ *   uint8_t  USBDBG_UPLOAD_MARKER
+ *   uint8_t  'U'
+ *   uint8_t  usbdbg_upload_status_t
+ *   uint32_t CRC-32 of the received data
+ *
+ * Bytes received outside of an upload are discarded, as before.
+ */
+
+#ifndef INCLUDES_USBDBG_UPLOAD_H_
+#define INCLUDES_USBDBG_UPLOAD_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define USBDBG_UPLOAD_MAGIC 0x444C5055 /* "UPLD" */
+#define USBDBG_UPLOAD_MARKER 0xA6
+#define USBDBG_UPLOAD_NAME_MAX 64
+
+/* An upload is abandoned when the host sends nothing for this long */
+#ifndef USBDBG_UPLOAD_TIMEOUT_MS
+#define USBDBG_UPLOAD_TIMEOUT_MS 2000
+#endif
+
+/* Size of each of the two blocks, a multiple of the 512 byte sector */
+#ifndef USBDBG_UPLOAD_BLOCK
+#define USBDBG_UPLOAD_BLOCK 4096
+#endif
+
+typedef enum
+{
+  USBDBG_UPLOAD_OK = 0,
+  USBDBG_UPLOAD_CRC_ERROR,
+  USBDBG_UPLOAD_FILE_ERROR, /* SD card not ready, or a write failed */
+  USBDBG_UPLOAD_HEADER_ERROR
+} usbdbg_upload_status_t;
+
+/* Take over the OUT endpoint of the debug port, clock returns milliseconds for the timeout.
+ * The blocks are written by sdArbiterTask, usbdbg_try_to_send receives the packets
+ */
+void usbdbg_upload_init(uint32_t (*clock)(void));
+
+/* Called from the job of the SD arbiter when an upload completes or fails, with the card still held.
+ * Queue follow-up work from it rather than accessing the card
+ */
+void usbdbg_upload_set_done(void (*done)(const char *name, usbdbg_upload_status_t status));
+
+/* True while a file is being received or written */
+bool usbdbg_upload_busy(void);
+
+#endif /* INCLUDES_USBDBG_UPLOAD_H_ */
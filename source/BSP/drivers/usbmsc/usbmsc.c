@@ -0,0 +1,175 @@
+/**
+ *  @file usbmsc.c USB mass storage on the FT900 USB host port
+ *
+ *  @brief
+ *   Bulk-only mass storage through the BOMS driver of the FT900 USB host stack
+ **/
+
+#include <stdio.h>
+#include <string.h>
+#include <ft900_usb.h>
+#include <ft900_usbh.h>
+#include <ft900_usbh_boms.h>
+#include "bsp_debug.h"
+#include "usbmsc.h"
+
+#if USBMSC_MAX_SECTORS * 512 > 0xFFFF
+#error USBMSC_MAX_SECTORS must fit the 16 bit transfer length of USBH_BOMS_read
+#endif
+
+static USBH_BOMS_context boms;
+static FATFS usb_fs;
+static bool host_started = false;
+static bool attached = false; /* BOMS interface found on the enumerated device */
+static bool mounted = false;
+
+/* The first mass storage interface of the device on the root port */
+static bool find_boms(USBH_interface_handle *interface)
+{
+	USBH_device_handle device;
+	uint8_t usb_class, usb_subclass, usb_protocol;
+
+	if (USBH_get_device_list(USBH_ROOT_HUB_HANDLE, USBH_ROOT_HUB_PORT, &device) != USBH_OK)
+		return false;
+	if (USBH_get_interface_list(device, interface) != USBH_OK)
+		return false;
+
+	do {
+		if (USBH_interface_get_class_info(*interface, &usb_class, &usb_subclass, &usb_protocol) == USBH_OK
+			&& usb_class == USB_CLASS_MASS_STORAGE
+			&& usb_subclass == USB_SUBCLASS_MASS_STORAGE_SCSI
+			&& usb_protocol == USB_PROTOCOL_MASS_STORAGE_BOMS)
+			return true;
+	} while (USBH_get_next_interface(*interface, interface) == USBH_OK);
+
+	return false;
+}
+
+static void attach(void)
+{
+	USBH_interface_handle interface;
+
+	if (!find_boms(&interface)) {
+		PR_WARN("USB device is not a mass storage device\n");
+		return;
+	}
+	if (USBH_BOMS_init(interface, 0, &boms) != USBH_BOMS_OK) {
+		PR_WARN("USB mass storage init failed\n");
+		return;
+	}
+	attached = true;
+
+	if (f_mount(&usb_fs, USBMSC_VOLUME, 1) != FR_OK) {
+		PR_WARN("FatFS USB mount failed\n");
+		return;
+	}
+	mounted = true;
+	PR_INFO("FatFS USB stick mounted on %s\n", USBMSC_VOLUME);
+}
+
+static void detach(void)
+{
+	if (mounted) {
+		f_mount(NULL, USBMSC_VOLUME, 0);
+		PR_INFO("USB stick removed\n");
+	}
+	attached = false;
+	mounted = false;
+}
+
+void usbmsc_init(void)
+{
+	USBH_initialise(NULL);
+	host_started = true;
+}
+
+void usbmsc_task(void *ctx)
+{
+	USBH_STATE state;
+
+	(void)ctx;
+	if (!host_started)
+		return;
+
+	/* Enumerates a new device and runs the completed transfers */
+	USBH_process();
+
+	if (USBH_get_connect_state(USBH_ROOT_HUB_HANDLE, USBH_ROOT_HUB_PORT, &state) != USBH_OK)
+		state = USBH_STATE_NOTCONNECTED;
+
+	if (state == USBH_STATE_ENUMERATED) {
+		if (!attached)
+			attach();
+	}
+	else if (attached) {
+		detach();
+	}
+}
+
+bool usbmsc_ready(void)
+{
+	return mounted;
+}
+
+DSTATUS usbmsc_disk_status(void)
+{
+	return attached ? 0 : STA_NOINIT | STA_NODISK;
+}
+
+DRESULT usbmsc_disk_read(BYTE *buff, LBA_t sector, UINT count)
+{
+	UINT n;
+
+	if (!attached)
+		return RES_NOTRDY;
+
+	/* Each run is a single command, the stick streams it without a status phase per sector */
+	while (count) {
+		n = count < USBMSC_MAX_SECTORS ? count : USBMSC_MAX_SECTORS;
+		if (USBH_BOMS_read(&boms, sector, n * 512, buff) != USBH_BOMS_OK)
+			return RES_ERROR;
+		sector += n;
+		buff += n * 512;
+		count -= n;
+	}
+	return RES_OK;
+}
+
+DRESULT usbmsc_disk_write(const BYTE *buff, LBA_t sector, UINT count)
+{
+	UINT n;
+
+	if (!attached)
+		return RES_NOTRDY;
+
+	while (count) {
+		n = count < USBMSC_MAX_SECTORS ? count : USBMSC_MAX_SECTORS;
+		if (USBH_BOMS_write(&boms, sector, n * 512, (uint8_t *)buff) != USBH_BOMS_OK)
+			return RES_ERROR;
+		sector += n;
+		buff += n * 512;
+		count -= n;
+	}
+	return RES_OK;
+}
+
+DRESULT usbmsc_disk_ioctl(BYTE cmd, void *buff)
+{
+	if (!attached)
+		return RES_NOTRDY;
+
+	switch (cmd) {
+	case CTRL_SYNC:
+		/* Writes complete with their status phase */
+		return RES_OK;
+	case GET_SECTOR_SIZE:
+		*(WORD *)buff = 512;
+		return RES_OK;
+	case GET_BLOCK_SIZE:
+		/* Not reported over BOMS */
+		*(DWORD *)buff = 1;
+		return RES_OK;
+	default:
+		return RES_PARERR;
+	}
+}
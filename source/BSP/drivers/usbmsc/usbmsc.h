@@ -0,0 +1,43 @@
+/**
+ *  @file usbmsc.h USB mass storage on the FT900 USB host port
+ *
+ *  @brief
+ *   A USB stick on the host port is mounted as the second FatFs volume, "1:",
+ *   next to the SD card on "0:"
+ **/
+
+#ifndef __USBMSC_H__
+#define __USBMSC_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "ff.h"
+#include "diskio.h"
+
+/* Mount point of the stick, DISKIO_DRV_USB as a drive prefix */
+#define USBMSC_VOLUME "1:"
+
+/* Largest run of sectors sent as one READ(10)/WRITE(10) command, longer runs are split */
+#ifndef USBMSC_MAX_SECTORS
+#define USBMSC_MAX_SECTORS 64
+#endif
+
+/* Start the USB host, the stick is mounted by usbmsc_task once enumerated */
+void usbmsc_init(void);
+
+/* Scheduler task, runs the host stack and mounts or drops the volume as the stick comes and goes.
+ * The run that enumerates a new stick takes a few hundred milliseconds.
+ */
+void usbmsc_task(void *ctx);
+
+/* True while the volume is mounted */
+bool usbmsc_ready(void);
+
+/* Media access for diskio_ft9xx.c, the same sector interface as the SD card */
+DSTATUS usbmsc_disk_status(void);
+DRESULT usbmsc_disk_read(BYTE *buff, LBA_t sector, UINT count);
+DRESULT usbmsc_disk_write(const BYTE *buff, LBA_t sector, UINT count);
+DRESULT usbmsc_disk_ioctl(BYTE cmd, void *buff);
+
+#endif /* __USBMSC_H__ */
@@ -0,0 +1,18 @@
+/*
+ * bsp_bench.h
+ *
+ */
+#ifndef _BSP_BENCH_H_
+#define _BSP_BENCH_H_
+
+/**
+ * @brief Run the on-target benchmarks and print the results with PR_INFO
+ *
+ * Measures SPI throughput per bus width, SD card sequential and random reads,
+ * EVE_Cmd_wr32 rate, CMD_INFLATE throughput, a 150 KB RAM_G upload and the
+ * frame time of a reference screen. Call after the SD card and EVE are initialised.
+ * Overwrites RAM_G and the display list.
+ */
+void bsp_bench(void);
+
+#endif /* _BSP_BENCH_H_ */
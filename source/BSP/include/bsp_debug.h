@@ -6,9 +6,30 @@
 #include <stdbool.h>
 
 #include "usbdbg.h"
+#include "usbdbg_trace.h"
 #include "tinyprintf.h"
 
-#if ENABLE_USBDBG
+/* Set to 0 to compile all log output out, format strings and arguments included */
+#ifndef ENABLE_LOG
+#define ENABLE_LOG 1
+#endif
+
+/* Set to 1 to send the log as binary trace records over USB, see usbdbg_trace.h. At most 4 arguments per message */
+#ifndef ENABLE_TRACE
+#define ENABLE_TRACE 0
+#endif
+
+#if !ENABLE_LOG
+#define PR_ERROR(fmt, ...) do { } while (false)
+#define PR_WARN(fmt, ...) do { } while (false)
+#define PR_INFO(fmt, ...) do { } while (false)
+#define eve_printf(fmt, ...) do { } while (false)
+#elif ENABLE_USBDBG && ENABLE_TRACE
+#define PR_ERROR(fmt, ...) USBDBG_TRACE("[ERROR]" fmt, ##__VA_ARGS__)
+#define PR_WARN(fmt, ...) USBDBG_TRACE("[WARNING]" fmt, ##__VA_ARGS__)
+#define PR_INFO(fmt, ...) USBDBG_TRACE("[INFO]" fmt, ##__VA_ARGS__)
+#define eve_printf(fmt, ...) USBDBG_TRACE(fmt, ##__VA_ARGS__)
+#elif ENABLE_USBDBG
 #define PR_ERROR(fmt, ...)              \
 	do                                  \
 	{                                   \
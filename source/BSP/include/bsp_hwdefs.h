@@ -31,6 +31,8 @@
 #define GPIO_UART0_RX (49)
 #define GPIO_UART1_TX (52)
 #define GPIO_UART1_RX (53)
+/** @brief RS-485 transceiver driver enable, high while transmitting */
+#define GPIO_RS485_DE (54)
 
 #define GPIO_SPIM_CLK (27)
 #define GPIO_SPIM_SS0 (28)
@@ -82,6 +84,9 @@
 #define FT900_TIMER_PRESCALE_VALUE (100)
 #define FT900_TIMER_OVERFLOW_VALUE (1000)
 
+/* Free running microsecond counter for the Modbus inter-frame gap, read without interrupts */
+#define MODBUS_TIMER (timer_select_c)
+
 #ifndef RTC_PRESENT
 #ifdef FT900_PLATFORM_RTC_I2C
 #define RTC_PRESENT (1)
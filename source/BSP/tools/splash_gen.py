@@ -0,0 +1,80 @@
+#!/usr/bin/env python3
+"""Convert a greyscale image to the program memory boot splash of the BSP, see eve_splash.h.
+
+The image is stored as an L8 bitmap compressed with zlib, so it is unpacked into RAM_G by CMD_INFLATE
+straight from flash before any storage is mounted. Without an input a plain ring is generated.
+
+Usage:
+    splash_gen.py [logo.pgm] [--output drivers/eve_hal/eve_splash.c]
+
+The input must be a binary PGM (P5) with a maximum value of 255.
+"""
+
+import argparse
+import math
+import sys
+import zlib
+
+RING_SIZE = 96
+
+
+def read_pgm(name):
+    with open(name, "rb") as f:
+        data = f.read()
+    fields = []
+    offset = 0
+    while len(fields) < 4:
+        while data[offset : offset + 1].isspace():
+            offset += 1
+        if data[offset : offset + 1] == b"#":
+            offset = data.index(b"\n", offset)
+            continue
+        end = offset
+        while not data[end : end + 1].isspace():
+            end += 1
+        fields.append(data[offset:end])
+        offset = end
+    if fields[0] != b"P5" or int(fields[3]) != 255:
+        sys.exit("%s: not an 8 bit binary PGM" % name)
+    width, height = int(fields[1]), int(fields[2])
+    offset += 1
+    return width, height, data[offset : offset + width * height]
+
+
+def ring():
+    pixels = bytearray()
+    c = (RING_SIZE - 1) / 2.0
+    for y in range(RING_SIZE):
+        for x in range(RING_SIZE):
+            d = math.hypot(x - c, y - c)
+            # Antialiased ring between 60% and 100% of the radius
+            v = min(c - d, d - 0.6 * c) + 0.5
+            pixels.append(int(255 * max(0.0, min(1.0, v))))
+    return RING_SIZE, RING_SIZE, bytes(pixels)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("input", nargs="?")
+    parser.add_argument("--output", default="drivers/eve_hal/eve_splash.c")
+    args = parser.parse_args()
+
+    width, height, pixels = read_pgm(args.input) if args.input else ring()
+    packed = zlib.compress(pixels, 9)
+    lines = []
+    for i in range(0, len(packed), 16):
+        lines.append("\t" + ", ".join("0x%02X" % b for b in packed[i : i + 16]) + ",")
+
+    with open(args.output, "w") as f:
+        f.write("/* Generated by tools/splash_gen.py, %d x %d L8 */\n\n" % (width, height))
+        f.write('#include "eve_splash.h"\n\n')
+        f.write("const uint16_t eve_splash_width = %d;\n" % width)
+        f.write("const uint16_t eve_splash_height = %d;\n" % height)
+        f.write("const uint32_t eve_splash_size = %d;\n\n" % len(packed))
+        f.write("eve_progmem_const uint8_t eve_splash_data[] = {\n")
+        f.write("\n".join(lines) + "\n};\n")
+    print("%s: %d x %d, %d bytes deflated" % (args.output, width, height, len(packed)))
+
+
+if __name__ == "__main__":
+    main()
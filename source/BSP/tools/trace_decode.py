@@ -0,0 +1,120 @@
+#!/usr/bin/env python3
+"""Decode the USB debug stream of the BSP, expanding the binary trace records of usbdbg_trace.h.
+
+Text output is passed through as is. Format strings and constant string arguments are read from the ELF file
+of the firmware which produced the stream.
+
+Usage:
+    trace_decode.py firmware.elf capture.bin
+    trace_decode.py firmware.elf /dev/ttyACM0     (requires pyserial)
+
+Requires pyelftools.
+"""
+
+import re
+import struct
+import sys
+
+from elftools.elf.elffile import ELFFile
+
+TRACE_MARKER = 0xA5
+TRACE_MAX_ARGS = 4
+
+# printf conversions, with the length modifiers Python does not know about
+FORMAT_SPEC = re.compile(r"%([-+ #0]*\d*(?:\.\d+)?)(?:hh|h|ll|l|z|t)?([diouxXcsp%])")
+
+
+class Image:
+    """Constant data of the firmware, by load address"""
+
+    def __init__(self, path):
+        self.sections = []
+        with open(path, "rb") as f:
+            elf = ELFFile(f)
+            for section in elf.iter_sections():
+                if section["sh_addr"] and section["sh_type"] == "SHT_PROGBITS":
+                    self.sections.append((section["sh_addr"], section.data()))
+
+    def string(self, addr):
+        for base, data in self.sections:
+            if base <= addr < base + len(data):
+                end = data.find(b"\0", addr - base)
+                return data[addr - base:end if end >= 0 else len(data)].decode("latin-1")
+        return None
+
+
+def expand(image, fmt, args):
+    args = list(args)
+
+    def convert(match):
+        flags, conv = match.group(1), match.group(2)
+        if conv == "%":
+            return "%"
+        value = args.pop(0) if args else 0
+        if conv == "s":
+            text = image.string(value)
+            return ("%" + flags + "s") % (text if text is not None else "<0x%08x>" % value)
+        if conv == "p":
+            return "0x%08x" % value
+        if conv in "di":
+            value = struct.unpack("<i", struct.pack("<I", value))[0]
+        elif conv == "u":
+            conv = "d"
+        elif conv == "c":
+            value = chr(value & 0xFF)
+        return ("%" + flags + conv) % value
+
+    return FORMAT_SPEC.sub(convert, fmt)
+
+
+def decode(image, stream, out):
+    buffer = b""
+    while True:
+        chunk = stream.read(1)
+        if not chunk:
+            break
+        buffer += chunk
+        while buffer:
+            if buffer[0] != TRACE_MARKER:
+                out.write(chr(buffer[0]))
+                buffer = buffer[1:]
+                continue
+            if len(buffer) < 2:
+                break
+            argc = buffer[1]
+            if argc > TRACE_MAX_ARGS:
+                # Not a record, resynchronize on the next byte
+                buffer = buffer[1:]
+                continue
+            size = 2 + 4 * (2 + argc)
+            if len(buffer) < size:
+                break
+            words = struct.unpack_from("<%dI" % (2 + argc), buffer, 2)
+            fmt = image.string(words[0])
+            if fmt is None:
+                out.write("[%10u] <unknown format 0x%08x>\n" % (words[1], words[0]))
+            else:
+                out.write("[%10u] %s" % (words[1], expand(image, fmt, words[2:])))
+            buffer = buffer[size:]
+        out.flush()
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.stderr.write(__doc__)
+        return 1
+    image = Image(sys.argv[1])
+    if sys.argv[2].startswith("/dev/") or sys.argv[2].upper().startswith("COM"):
+        import serial
+        stream = serial.Serial(sys.argv[2], 115200)
+    else:
+        stream = open(sys.argv[2], "rb")
+    try:
+        decode(image, stream, sys.stdout)
+    except KeyboardInterrupt:
+        pass
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,93 @@
+#!/usr/bin/env python3
+"""Upload asset files to the SD card of the BSP over the USB debug port, see usbdbg_upload.h.
+
+Each file is sent with a header carrying its size and CRC-32. The target writes it under a temporary name and
+replaces the file on the card once the CRC matches, then reports the result on the debug stream. Debug text
+received meanwhile is passed through to stdout.
+
+Usage:
+    usb_upload.py /dev/ttyACM0 file... [--name NAME] [--timeout SECONDS]
+
+The name on the card defaults to the file name without its directory. Requires pyserial.
+"""
+
+import argparse
+import os
+import struct
+import sys
+import time
+import zlib
+
+import serial
+
+UPLOAD_MAGIC = 0x444C5055
+UPLOAD_MARKER = b"\xa6U"
+NAME_MAX = 64
+CHUNK = 64 * 1024
+
+STATUS = {0: "ok", 1: "CRC error", 2: "file error", 3: "header error"}
+
+
+def wait_status(port, timeout):
+    """Returns the status and the CRC reported by the target, passing other output through"""
+    pending = b""
+    deadline = time.monotonic() + timeout
+    while time.monotonic() < deadline:
+        pending += port.read(port.in_waiting or 1)
+        found = pending.find(UPLOAD_MARKER)
+        if found < 0:
+            keep = pending[-1:] if pending.endswith(UPLOAD_MARKER[:1]) else b""
+            sys.stdout.buffer.write(pending[: len(pending) - len(keep)])
+            pending = keep
+            continue
+        sys.stdout.buffer.write(pending[:found])
+        while len(pending) < found + 7 and time.monotonic() < deadline:
+            pending += port.read(found + 7 - len(pending))
+        if len(pending) >= found + 7:
+            status, crc = struct.unpack_from("<BI", pending, found + 2)
+            return status, crc
+    return None, None
+
+
+def upload(port, path, name, timeout):
+    with open(path, "rb") as f:
+        data = f.read()
+    encoded = name.encode()
+    if not data or not encoded or len(encoded) > NAME_MAX:
+        sys.exit("%s: empty file or name longer than %d bytes" % (path, NAME_MAX))
+
+    crc = zlib.crc32(data) & 0xFFFFFFFF
+    port.write(struct.pack("<IIIB", UPLOAD_MAGIC, len(data), crc, len(encoded)) + encoded)
+    port.flush()
+
+    start = time.monotonic()
+    for offset in range(0, len(data), CHUNK):
+        port.write(data[offset : offset + CHUNK])
+    port.flush()
+
+    status, target_crc = wait_status(port, timeout)
+    elapsed = time.monotonic() - start
+    if status is None:
+        sys.exit("%s: no answer from the target" % name)
+    if status != 0:
+        sys.exit("%s: %s, target CRC %08X, expected %08X" % (name, STATUS.get(status, status), target_crc, crc))
+    print("%s: %d bytes in %.1f s, %.0f kB/s" % (name, len(data), elapsed, len(data) / 1024.0 / max(elapsed, 1e-3)))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("port")
+    parser.add_argument("files", nargs="+")
+    parser.add_argument("--name", help="name on the card, for a single file")
+    parser.add_argument("--timeout", type=float, default=10.0, help="time to wait for the result after the data")
+    args = parser.parse_args()
+    if args.name and len(args.files) > 1:
+        sys.exit("--name needs a single file")
+
+    with serial.Serial(args.port, timeout=0.1) as port:
+        for path in args.files:
+            upload(port, path, args.name or os.path.basename(path), args.timeout)
+
+
+if __name__ == "__main__":
+    main()
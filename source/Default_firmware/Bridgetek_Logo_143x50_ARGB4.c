@@ -1,187 +0,0 @@
-/*
-This file is generated by EAB
-*/
-
-#include <stdint.h>
-
-uint8_t data [14300] = {
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  85,   4,  35,  83, 255,  15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,  51,  19,  34, 179,  18, 242,  35, 130, 136,   8,   0,   0,   0,   0,   0,   0,   0,   0,   0,  15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  35, 131,  34, 242,  34, 243,  34, 242,  35, 114,   0,   0,   0,   0,  51,  35,  34, 131,  51, 132,   8,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  52,  19,  34, 210,  34, 242,  34, 243,  51, 130,   0,   0,  51,  51,  34, 226,  34, 242,  51, 179,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  50,   3,  50, 115,  68,  20,   0,   0,  52,  19,  34, 194,  34, 146,   0,   0,  50,  50,  34, 243,  34, 242,  34, 242,
- 50, 179,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  51,   4,  34, 178,  34, 242,  34, 178,  69,   4,   0,   0,  68,   4,   0,  16,  35,  51,  34, 243,  34, 243,  34, 242,  34, 242,  51,  67,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  34,  99,  34, 243,  34, 242,  34, 242,  34, 179,  68,   4,   0,   0,
- 50,  51,  34, 226,  34, 242,  34, 242,  34, 242,  34,  66,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  51,   4,  34, 147,  34, 243,  34, 242,  50, 131,   0,   0,  50,  51,  34, 242,  34, 242,  34, 242,  34, 242,  50,  67,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  16,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  16,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  51,   3,  34, 162,  51,  35,   0,   0,
- 52,   3,  34, 147,  35, 131,   0,   0,  35,  51,  34, 242,  34, 242,  34, 243,  34, 242,  50,  67,   0,   0,   0,   0,  68,  36,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 173,  22, 140,  82, 140,  82, 124,  65, 124,  82, 124,  82, 124,  82, 123,  82, 123,  66, 140,  67, 140,  35, 140,  20,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  15,   0, 140,  50, 124,  82, 124,  82, 124,  81, 140,  50,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 124,  50, 140,  66, 123,  82, 124,  82, 140,  66,  15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255,   0, 124,  66,
-140,  81, 124,  82, 124,  65, 124,  34,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  68,   4,  35, 178,  34, 243,  34, 227,  34,  35,   0,   0,   0,   0,   0,   0,  50,  51,  34, 242,  34, 242,  34, 242,  34, 242,  35,  83,   0,   0,   0,  16,  50,  82,  50, 163,   0,  16,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 156,  21, 123, 242, 124, 242, 140, 242, 124, 241, 123, 242, 124, 241, 124, 242, 124, 242, 124, 242, 124, 242, 124, 210, 124,  35,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 136,   0, 124, 194, 140, 242, 124, 242, 124, 242, 140, 130,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255,   0, 124, 130, 124, 242, 124, 242, 123, 242, 124, 195, 255,  15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 143,   4, 124, 226, 124, 242, 124, 242, 139, 242, 124, 114, 255,  16,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,  35,  67,  34, 242,  34, 242,  34, 242,  34, 210,  67,  20,   0,   0,  51,  67,  34, 227,  34, 242,  34, 242,  34, 242,  35,  67,   0,  16,   0,   0,  50,  82,  34, 242,  35, 179,   8,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 156,  21, 139, 241, 124, 241, 139, 242, 123, 242, 123, 241, 139, 242, 123, 242, 140, 242, 139, 242, 124, 242,
-140, 242, 123, 178, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 136,   0, 124, 194, 140, 241, 140, 241, 140, 242, 140, 130,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255,   0, 124, 130, 139, 241, 140, 241, 124, 241, 124, 211, 255,  15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 141,  19, 140,  19, 139,  19, 140,  19, 140,   2,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0, 143,   4, 124, 226, 124, 242, 140, 242, 139, 241, 140, 114, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  35,  82,  34, 242,  34, 242,  34, 130,   0,   6,  51,  51,  34, 242,  18, 242,  34, 242,  34, 242,  51,  67,   0,   0,   0,   0,  51,  98,  34, 243,
- 34, 242,  35, 179,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 155,  21, 124, 242, 123, 242, 124, 241, 123, 241, 124, 241, 140, 242, 124, 241, 140, 242, 123, 242, 124, 242, 123, 242, 140, 242, 157,  21,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 120,   0, 124, 194,
-124, 242, 124, 242, 139, 241, 124, 114,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255,   0, 124, 130, 124, 242, 124, 241, 124, 241, 123, 210, 255,  15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 143,   8, 124, 147, 123, 242, 124, 242, 124, 241, 124, 178,  15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 143,   4, 139, 226, 124, 242, 124, 241, 124, 242, 124, 114, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,  68,  20,  50, 162,  51,  83,   0,   0,   0,   0,  35,  83,  34, 130,   0,   0,  34,  51,  34, 242,  34, 242,  34, 242,  34, 242,  51,  83,   0,   0,   0,   0,  50,  83,  34, 242,  34, 242,  34, 242,  51, 179,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 156,  21, 124, 242, 124, 242, 123, 241, 140, 242,
-124, 210, 139,  83, 124,  83, 124, 241, 124, 241, 123, 241, 123, 242, 139, 242, 123,  34,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 171,  20, 173,  20, 172,  20, 141,  20, 140,   4,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255,   0, 139, 130, 123, 242, 123, 242, 124, 242, 139, 194,
-255,  15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 143,  24, 140, 162, 140, 241, 124, 241, 124, 242, 124, 194,  15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 143,  20, 124, 226, 140, 242, 123, 242, 140, 242, 124, 114, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  51,  19,  35, 163,  34, 242,  34, 242,  51,  83,   0,   0,   0,   0,   0,   0,  35,  51,  34, 242,  34, 242,  34, 242,  18, 242,  35,  67,
-  0,   0,   0,   0,  51,  99,  33, 242,  34, 242,  34, 242,  34, 242,  51, 163,   8,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 156,  21, 124, 242, 140, 241, 124, 242, 139, 242, 124, 194, 255,   0, 255,   0, 139, 162, 123, 242, 123, 242, 124, 241, 124, 242, 124,  49,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255,   0, 140, 130, 124, 242, 124, 242, 140, 242, 124, 194, 255,  15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  16,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 143,   8, 140, 163, 124, 242, 124, 242, 124, 242, 124, 178,  15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 143,  20, 140, 210, 124, 241, 124, 242, 124, 242, 124, 114, 255,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  51,  35,  34, 226,  34, 242,  34, 242,  34, 242,  52,  51,   0,   0,  35,  51,  34, 226,  34, 242,  34, 242,  34, 242,  35,  67,   0,   0,   0,   0,  35,  99,  34, 242,  34, 242,  34, 242,  34, 242,  34, 242,  35, 179,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0, 156,  21, 124, 242, 124, 242, 123, 242, 124, 242, 123, 194,   0,   0, 255,  15, 124, 162, 123, 242, 140, 241, 124, 242, 124, 241, 123,  34,   0,   0, 255,   0, 157,  53, 156,  53, 157,  53, 140,  53, 173,  22, 140,  51, 124,  99, 140,  99, 140,  50, 143,  24,  15,   0, 156,  52, 141,  68, 157,  52, 141,  52, 157,  36,   0,   0,   0,   0, 255,   0, 140,  35, 124,  83, 124,  98, 124,  82,
-141,   3, 140, 130, 123, 241, 140, 242, 140, 242, 124, 194, 255,  15,   0,   0,   0,   0, 139,   3, 140,  66, 140, 115, 139,  98, 140,  35, 187,   6, 140,  53, 157,  68, 141,  52, 157,  68, 175,   6,   0,   0,   0,   0, 255,   0, 140,  20, 141,  67, 124,  98, 140, 114, 140, 115, 123,  98, 140,  51, 155,  21,  15,   0,   0,   0,  15,   0, 140,  53, 140, 179, 140, 242, 124, 241, 123, 241, 124, 194,
-140,  53, 156,  52, 190,   6,   0,   0,   0,   0, 108,  21, 156,  51, 139,  83, 140,  98, 140, 114, 140,  98, 124,  67, 141,  19, 255,  16,   0,   0,   0,   0, 143,   4, 139, 210, 123, 242, 124, 242, 139, 241, 139, 114, 255,   0, 157,  36, 141,  69, 156,  52, 157,  68, 140,  36,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  51,  51,  34, 226,  34, 242,  51, 130,   0,   0,  51,  51,  34, 243,
- 18, 242,  34, 242,  34, 242,  51,  83,   0,  16,   0,   0,  35,  83,  34, 242,  34, 242,  18, 242,  34, 243,  34, 242,  34, 242,  50, 178,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 156,  21, 140, 241, 123, 241, 123, 241, 124, 242, 124, 194,  15,   0, 255,   0, 124, 162, 124, 242, 123, 242, 124, 242, 124, 242, 140,  35,   0,   0, 124,   4,
-140, 209, 123, 241, 123, 242, 140, 242, 140, 131, 124, 242, 123, 242, 123, 242, 124, 242, 140,  99, 135,   0, 123, 210, 140, 241, 124, 242, 124, 241, 140, 130,   0,   0,  15,   0, 140,  66, 124, 241, 124, 242, 123, 242, 124, 242, 140, 210, 124, 162, 140, 241, 140, 242, 124, 242, 124, 210, 255,  15,   0,   0, 138,   2, 140, 178, 139, 241, 124, 242, 124, 241, 124, 242, 124, 130, 123, 242, 124, 242,
-123, 242, 124, 241, 155,  20,   0,   0,  15,   0, 123,  82, 123, 226, 140, 241, 124, 242, 124, 242, 124, 241, 140, 241, 124, 241, 124, 210, 124,  66,  15,   0, 143,   0, 124, 210, 123, 242, 140, 242, 124, 241, 124, 242, 123, 242, 124, 241, 124, 242, 140,  37,   0,   0, 140,  51, 139, 210, 124, 242, 123, 241, 123, 242, 124, 242, 124, 242, 124, 242, 124, 242, 140, 115, 107,   6,   0,   0, 143,   4,
-140, 226, 124, 242, 124, 241, 123, 242, 140, 114, 156,   4, 124, 210, 124, 242, 123, 241, 140, 242, 124,  82,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  51,  51,  50, 130,   0,   0,  51,  51,  34, 227,  34, 242,  34, 242,  34, 242,  35,  67,   0,   0,   0,   0,  50,  99,  18, 242,  34, 242,  34, 242,  34, 242,  34, 242,  34, 243,  34, 242,  51, 178,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 156,  21, 124, 242, 123, 242, 124, 241, 124, 242, 140, 194, 157,  19, 141,  20, 140, 194, 140, 242, 124, 242, 140, 242, 124, 226, 158,   7,   0,   0, 140,   4, 139, 226, 124, 242, 123, 242, 124, 242, 140, 242, 140, 241, 124, 241, 124, 241, 124, 241, 140, 162, 143,   0, 123, 194, 123, 242, 124, 242, 124, 241, 140, 130,   0,   0,
-255,   0, 140, 194, 123, 241, 123, 241, 140, 241, 140, 242, 124, 242, 124, 241, 124, 242, 140, 242, 124, 242, 124, 210, 255,  15,   0,   0, 140,  66, 124, 242, 123, 242, 124, 241, 123, 241, 140, 242, 123, 241, 124, 242, 140, 242, 124, 242, 140, 242, 157,  19,   0,   0, 139,  35, 123, 242, 124, 242, 124, 242, 124, 241, 123, 242, 124, 242, 124, 242, 124, 241, 124, 241, 124, 242, 124,  51, 143,   0,
-140, 210, 124, 242, 124, 242, 124, 242, 140, 242, 140, 241, 123, 241, 124, 241, 156,  36, 141,  18, 140, 226, 124, 242, 124, 242, 140, 241, 139, 242, 124, 241, 124, 242, 124, 242, 140, 241, 123, 242, 140,  82,   0,   0, 143,   4, 124, 226, 124, 242, 123, 242, 140, 241, 123, 130, 124,  67, 139, 241, 124, 242, 140, 241, 124, 225, 141,  19,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,  35,  51,  34, 226,  34, 242,  18, 242,  34, 242,  35,  67,   0,   0,   0,   0,  51,  99,  18, 243,  34, 242,  34, 242,  34, 242,  34, 242,  34, 242,  18, 242,  34, 242,  35, 178,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 140,  21, 124, 242, 124, 242, 124, 241, 140, 242, 140, 242, 140, 242, 140, 241, 124, 241, 123, 242,
-124, 242, 140, 242, 140,  98,  15,   0,   0,   0, 140,  20, 139, 226, 124, 242, 140, 242, 139, 242, 124, 241, 124, 242, 124, 242, 124, 242, 124, 242, 123, 177, 143,  16, 124, 194, 139, 242, 124, 242, 124, 242, 140, 130,   0,   0, 136,   0, 124, 226, 124, 241, 123, 242, 140, 242, 123, 242, 140, 242, 123, 241, 123, 241, 124, 242, 124, 241, 124, 195, 255,  15, 255,   0, 140, 130, 124, 242, 123, 242,
-123, 242, 124, 242, 139, 226, 139, 242, 140, 241, 124, 242, 124, 242, 124, 241, 141,  20, 255,   0, 124, 114, 140, 241, 124, 241, 124, 242, 124, 242, 140, 131, 124, 163, 123, 242, 140, 241, 124, 241, 140, 242, 124, 114, 143,   0, 140, 194, 124, 242, 123, 241, 124, 241, 123, 242, 124, 242, 140, 242, 123, 242, 140,  36, 140,  51, 124, 242, 123, 241, 140, 242, 124, 241, 140, 162, 140, 131, 124, 242,
-124, 242, 124, 241, 123, 241, 124, 178, 255,   0, 143,   4, 140, 226, 139, 242, 124, 242, 123, 241, 139, 114, 124, 162, 139, 242, 124, 241, 139, 242, 124, 178, 136,   8,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  51,  50,  34, 242,  34, 242,  34, 242,  34, 242,  34,  66,   0,   0,   0,   0,  51,  83,  34, 242,  34, 242,  34, 243,  34, 242,  34, 242,  34, 242,  34, 242,
- 34, 242,  34, 242,  50, 179,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 156,  21, 124, 242, 124, 241, 124, 242, 124, 241, 123, 242, 123, 242, 124, 242, 124, 242, 124, 241, 124, 211, 140,  67, 255,   0,   0,   0,   0,   0, 123,   3, 123, 226, 124, 242, 140, 241, 124, 242, 124, 131, 141,   5, 124, 242, 140, 241, 123, 242, 140, 178, 143,   0,
-124, 194, 124, 242, 124, 241, 123, 242, 139, 130,   0,   0, 136,   0, 124, 225, 124, 242, 124, 241, 140, 242, 123, 178, 172,   6, 123, 162, 139, 242, 124, 242, 123, 241, 123, 194, 255,  15, 143,   8, 140, 179, 139, 242, 123, 241, 139, 242, 124, 178,  91,   5, 140,  67, 124, 242, 123, 242, 124, 242, 123, 242, 140,  19, 255,   0, 124, 162, 123, 242, 123, 242, 124, 241, 123, 210,  91,   0, 221,  13,
-140, 226, 123, 242, 124, 241, 140, 241, 140, 146, 255,   0, 173,  22, 140, 162, 124, 242, 139, 242, 124, 241, 140, 179, 141,   5, 156,   6, 143,   8, 140,  83, 124, 242, 140, 242, 140, 242, 140, 242, 157,  20, 136,   0, 139, 162, 124, 242, 139, 242, 124, 242, 124, 226, 143,   7, 143,  20, 124, 226, 124, 241, 124, 242, 140, 242, 140, 130, 139, 242, 124, 241, 124, 242, 123, 242, 123,  82,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  51,  19,  34, 226,  34, 242,  34, 242,  34, 242,  51,  67,   0,   0,   0,  16,  35,  82,  18, 242,  34, 242,  34, 242,  34, 242,  34, 242,  34, 242,  34, 242,  34, 242,  34, 243,  34, 242,  50, 179,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 156,  21, 123, 242, 124, 242, 124, 241,
-124, 242, 124, 242, 124, 241, 123, 242, 123, 241, 123, 241, 140, 242, 124, 242, 123,  82,  15,   0,   0,   0, 140,   4, 124, 225, 124, 242, 124, 241, 140, 242, 140,  99, 125,   3, 123, 242, 124, 242, 124, 242, 124, 161, 143,   0, 124, 194, 140, 241, 124, 242, 140, 242, 139, 130,   0,   0, 136,   0, 124, 210, 124, 241, 124, 242, 123, 242, 140, 163, 143,   8, 140, 130, 140, 242, 124, 241, 123, 242,
-124, 211, 255,  15, 143,   8, 140, 178, 140, 242, 124, 242, 140, 242, 124, 161,  15,   0, 140,  67, 123, 242, 124, 242, 124, 242, 123, 242, 141,   4, 255,   0, 124, 163, 140, 242, 123, 241, 123, 242, 124, 209, 136,   0, 255,  12, 124, 226, 124, 241, 139, 242, 139, 242, 124, 146,  15,   0, 143,   8, 140, 147, 123, 241, 124, 241, 124, 242, 124, 194,  15,   0,   0,   0,   0,   0, 140,  98, 124, 242,
-140, 242, 124, 242, 123, 242, 172,  21,  15,   0, 124, 162, 124, 241, 124, 242, 124, 241, 124, 210, 187,   6, 143,   4, 140, 226, 139, 242, 124, 242, 124, 241, 124, 194, 139, 242, 124, 242, 123, 241, 124, 241, 140,  19,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  50,  98,  34, 242,  34, 242,  34, 242,  35,  67,   0,   0,   0,   0,  51,  99,  34, 242,  34, 242,  34, 242,
- 34, 242,  34, 242,  34, 242,  34, 242,  34, 242,  34, 242,  34, 242,  34, 242,  51, 179,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 156,  21, 140, 242, 123, 242, 123, 241, 140, 242, 124, 226, 140, 131, 140, 146, 124, 242, 123, 241, 140, 241, 124, 241, 124, 241, 140,  35,   0,   0, 140,   4, 140, 226, 139, 242, 123, 242, 123, 241, 140,  99,
-139,   3, 123, 178, 124, 178, 123, 178, 139, 130, 143,   0, 123, 210, 124, 242, 123, 242, 139, 241, 140, 130,   0,   0, 136,   0, 124, 210, 124, 241, 124, 241, 124, 242, 124, 162, 143,  24, 124, 130, 124, 241, 124, 242, 124, 242, 124, 194, 255,  15, 143,   8, 139, 179, 124, 241, 140, 241, 123, 241, 123, 162,  15,   0, 140,  68, 124, 241, 139, 242, 124, 242, 123, 242, 157,  19, 255,   0, 140, 163,
-140, 242, 124, 242, 124, 242, 124, 242, 140, 146, 124, 146, 123, 242, 124, 242, 140, 242, 124, 241, 140, 146,  15,   0, 143,   8, 140, 163, 123, 242, 124, 242, 124, 242, 124, 194,  15,   0,   0,   0,   0,   0, 140,  99, 139, 242, 139, 242, 123, 242, 123, 241, 140, 162, 124, 163, 140, 226, 124, 242, 124, 242, 139, 242, 124, 226, 187,   5, 143,   4, 139, 226, 123, 241, 124, 242, 124, 241, 123, 242,
-124, 242, 123, 242, 139, 241, 124, 162, 135,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  50, 131,  18, 242,  34, 243,  35, 163,   0,   0,   0,   0,  68,  20,  34, 242,  34, 242,  34, 242,  34, 242,  34, 243,  34, 242,  34, 243,  34, 242,  18, 242,  34, 243,  34, 243,  34, 242,  34, 179,   8,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0, 156,  21, 123, 242, 124, 241, 124, 242, 140, 241, 139, 194, 255,   0, 255,   0, 140, 130, 124, 241, 123, 241, 139, 241, 124, 241, 124,  99, 255,   0, 140,   4, 123, 226, 124, 242, 140, 242, 140, 242, 140,  99,  15,   0, 255,   0, 255,   0, 255,   0,  15,   0, 136,   0, 123, 194, 124, 242, 124, 241, 139, 241, 124, 130,   0,   0, 136,   0, 140, 210, 123, 242, 123, 241, 140, 241,
-140, 163, 143,  24, 140, 146, 124, 242, 124, 241, 140, 242, 124, 194, 255,  15, 143,  24, 124, 178, 124, 241, 124, 242, 140, 242, 123, 162,  15,   0, 124,  67, 124, 241, 123, 241, 139, 242, 123, 241, 141,  20, 255,   0, 124, 178, 140, 242, 124, 242, 124, 242, 124, 241, 123, 242, 123, 242, 140, 242, 123, 242, 124, 242, 140, 241, 124, 146,  15,   0, 143,   8, 124, 147, 140, 242, 140, 241, 124, 241,
-140, 178,  15,   0,   0,   0,   0,   0, 140,  99, 123, 242, 123, 242, 140, 241, 139, 241, 124, 241, 124, 242, 123, 242, 140, 241, 124, 242, 123, 242, 123, 210, 186,   6, 143,   3, 124, 226, 123, 242, 139, 242, 124, 242, 124, 242, 123, 242, 124, 241, 123, 242, 140, 130, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  35,  83,  34, 242,  34, 243,  33, 242,  35,  99,
-  0,  16,   0,   0,  34,  50,  34, 242,  34, 242,  34, 242,  34, 242,  34, 242,  34, 243,  34, 242,  34, 242,  34, 242,  34, 242,  34, 242,  51, 179,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 156,  21, 124, 242, 124, 242, 124, 242, 139, 242, 124, 194,   0,   0,   0,   0, 124, 114, 140, 242, 124, 242, 140, 241, 139, 242, 139, 114,  15,   0,
-140,   4, 123, 226, 124, 241, 124, 242, 124, 242, 140,  99,  15,   0,   0,   0,   0,   0,   0,   0,   0,   0, 136,   0, 124, 194, 123, 241, 140, 241, 123, 242, 140, 130,   0,   0, 136,   0, 140, 210, 124, 242, 123, 241, 124, 242, 140, 162, 143,   7, 139, 131, 123, 241, 140, 242, 140, 241, 123, 194, 255,  15, 143,  24, 140, 179, 140, 242, 140, 241, 124, 241, 140, 162,  15,   0, 140,  67, 123, 242,
-124, 242, 140, 242, 123, 241, 156,  19, 255,   0, 123, 162, 123, 242, 124, 242, 124, 242, 139, 242, 124, 242, 140, 242, 123, 242, 124, 242, 140, 242, 124, 241, 124, 146,  15,   0, 127,   8, 124, 162, 140, 242, 139, 242, 124, 242, 139, 178,  15,  16,   0,   0,   0,   0, 140,  99, 140, 242, 123, 242, 140, 242, 124, 242, 124, 242, 124, 242, 124, 242, 140, 242, 124, 241, 139, 242, 140, 210, 255,   8,
-140,  20, 123, 210, 123, 242, 124, 242, 124, 242, 123, 226, 140, 242, 140, 242, 139, 242, 123, 210, 141,   3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  51,   3,  34, 211,  34, 243,  34, 242,  34, 242,  50,  99,   0,   0,   0,   0,  35,  67,  34, 226,  34, 242,  34, 242,  34, 242,  18, 242,  34, 242,  34, 242,  34, 242,  34, 242,  34, 242,  35, 179,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 155,  21, 124, 242, 124, 242, 140, 241, 124, 242, 124, 194,   0,   0,   0,   0, 140,  98, 140, 241, 124, 242, 139, 242, 124, 242, 124, 146,  15,   0, 140,   3, 139, 210, 124, 242, 123, 241, 140, 242, 124,  99,  15,   0,   0,   0,   0,   0,   0,   0,   0,   0, 119,   0, 124, 194, 123, 242, 140, 242, 140, 241, 140, 130,
-  0,   0, 136,   0, 123, 209, 140, 242, 124, 241, 139, 241, 124, 163, 143,   8, 123, 130, 123, 242, 140, 242, 124, 242, 124, 194, 255,  15, 143,   8, 124, 163, 140, 242, 124, 241, 124, 242, 139, 178,  15,   0, 140,  67, 124, 242, 124, 242, 124, 241, 124, 242, 141,  20, 255,   0, 124, 162, 124, 242, 123, 242, 140, 242, 124, 210, 157,  38, 173,  38, 156,  38, 156,  38, 156,  38, 173,  38, 173,  23,
-  0,   0, 143,   8, 124, 162, 124, 242, 124, 242, 124, 242, 124, 178,  15,   0,   0,   0,   0,   0, 140,  99, 140, 242, 123, 242, 124, 242, 123, 242, 173,  53, 173,  22, 173,  38, 157,  38, 157,  38, 157,  22, 172,  22,   0,   0, 143,   4, 124, 210, 124, 241, 123, 242, 140, 241, 139, 147, 123, 242, 124, 242, 140, 242, 124, 242, 141,  51,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,  51,  35,  34, 227,  34, 242,  34, 243,  34, 242,  35,  99,   0,   0,   0,   0,  51,  67,  34, 242,  34, 243,  34, 242,  18, 242,  34, 242,  34, 242,  34, 242,  34, 242,  34, 243,  50, 178,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 156,  21, 124, 242, 123, 242, 123, 242, 124, 242, 123, 194, 255,   0,  15,   0, 124, 114,
-123, 242, 123, 242, 123, 242, 124, 242, 140, 131,  15,   0, 140,   4, 140, 226, 124, 241, 123, 242, 124, 242, 140,  99,  15,   0,   0,   0,   0,   0,   0,   0,   0,   0, 136,  16, 140, 194, 123, 242, 124, 242, 140, 242, 124, 130,   0,   0, 136,   0, 124, 210, 124, 242, 124, 241, 124, 242, 139, 162, 143,   8, 139, 130, 124, 242, 139, 241, 124, 241, 123, 194, 255,  15, 143,   8, 140, 162, 123, 242,
-140, 242, 140, 242, 124, 162,  15,   0, 140,  68, 124, 241, 140, 241, 124, 242, 123, 241, 141,  19, 255,   0, 140, 179, 123, 242, 124, 241, 123, 241, 124, 210, 136,  16,   0,   0, 140,  51, 140,  35, 124,  51, 140,  35, 140,  35,   0,   0, 143,   8, 140, 162, 124, 242, 123, 241, 123, 242, 140, 178,  15,  16,   0,   0,   0,   0, 141,  98, 124, 241, 123, 242, 124, 241, 123, 242, 157,  20,   0,   0,
-140,  36, 140,  35, 140,  35, 140,  51, 140,  35,   0,   0, 143,  20, 124, 226, 140, 242, 139, 242, 139, 241, 140, 114, 124, 194, 123, 242, 124, 242, 123, 241, 124, 146, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  51,  19,  34, 210,  34, 242,  34, 242,  34, 242,  35,  98,   0,   0,   0,   0,  51,  67,  34, 242,  34, 242,  34, 242,  34, 242,  34, 243,
- 34, 242,  34, 242,  34, 242,  50, 179,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 156,  21, 124, 242, 124, 242, 124, 241, 123, 241, 123, 210, 140,  52, 140,  68, 139, 194, 140, 242, 139, 242, 139, 242, 123, 241, 124,  98,   0,   0, 140,   4, 123, 210, 124, 242, 139, 241, 124, 241, 140,  99,  15,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-136,   0, 140, 194, 124, 241, 140, 242, 123, 242, 124, 130,   0,   0, 136,  16, 140, 210, 140, 242, 124, 242, 124, 242, 123, 162, 171,   6, 139, 146, 140, 242, 124, 242, 124, 241, 124, 210, 255,  15, 143,   8, 124, 162, 124, 242, 124, 241, 140, 241, 123, 178, 255,   0, 140,  67, 124, 241, 124, 242, 140, 241, 124, 242, 141,  19, 255,   0, 124, 163, 123, 242, 139, 242, 124, 242, 124, 210, 136,   0,
-143,   0, 140, 194, 140, 242, 124, 242, 123, 241, 139, 130,  15,   0, 143,   8, 140, 162, 123, 241, 140, 241, 124, 242, 140, 194, 255,   0,   0,   0, 255,   0, 140,  83, 124, 241, 124, 242, 124, 241, 123, 241, 156,  20, 136,   0, 140, 130, 123, 242, 124, 241, 140, 242, 124, 210, 255,   8, 143,   4, 124, 226, 123, 241, 139, 241, 140, 242, 124, 114, 140, 130, 124, 242, 124, 242, 139, 242, 140, 225,
-156,   5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  50,  67,  35, 162,  68,   3,  35,  35,  34, 226,  34, 242,  34, 243,  34, 242,  51,  83,   0,   0,   0,   0,  34,  67,  34, 242,  34, 242,  34, 242,  34, 243,  18, 243,  34, 243,  34, 242,  50, 179,   8,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 156,  20, 124, 241, 123, 242,
-123, 242, 124, 242, 124, 242, 140, 242, 140, 242, 124, 242, 124, 242, 124, 242, 124, 242, 140, 242, 140,  67,   0,   0, 140,   3, 124, 226, 140, 241, 140, 241, 139, 242, 140,  99,  15,   0,   0,   0,   0,   0,   0,   0,   0,   0, 136,   0, 140, 194, 123, 242, 124, 241, 140, 241, 124, 130,   0,   0, 136,   0, 139, 210, 124, 241, 124, 242, 124, 242, 140, 242, 124, 226, 124, 242, 124, 241, 123, 241,
-124, 242, 140, 194, 255,  15, 255,  15, 124, 162, 124, 241, 139, 241, 140, 241, 139, 242, 123, 146, 123, 194, 123, 241, 139, 241, 123, 242, 123, 242, 157,  19, 255,   0, 124, 130, 124, 241, 140, 242, 124, 242, 124, 242, 140, 130, 140, 114, 139, 242, 124, 242, 124, 242, 123, 242, 124, 130,   0,   0, 136,   8, 140, 147, 140, 242, 139, 241, 139, 241, 123, 242, 124, 178, 140, 162, 191,   5, 140,  51,
-124, 242, 140, 242, 140, 242, 124, 241, 140, 162, 140, 114, 123, 226, 124, 241, 124, 242, 139, 242, 123, 194, 255,   0, 143,   4, 140, 210, 140, 242, 140, 242, 124, 242, 124, 130, 140,  51, 124, 241, 124, 242, 140, 242, 124, 241, 140,  67,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  50,  67,  34, 242,  34, 242,  35, 162,  84,  21,  67,  35,  34, 226,  34, 242,  34, 242,  34, 242,  51,  83,
-  0,   0,   0,   0,  51,  50,  34, 242,  34, 243,  34, 242,  18, 242,  34, 242,  34, 242,  34, 178,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 155,  21, 140, 242, 124, 241, 124, 242, 124, 242, 124, 242, 124, 241, 139, 242, 123, 242, 123, 242, 123, 242, 140, 242, 124, 226, 158,  21,   0,   0, 139,  20, 123, 226, 124, 242, 124, 241, 140, 242,
-140,  99,  15,   0,   0,   0,   0,   0,   0,   0,   0,   0, 136,   0, 124, 194, 124, 242, 124, 242, 140, 242, 124, 130,   0,   0, 255,   0, 124, 178, 140, 242, 140, 242, 140, 242, 140, 242, 124, 242, 124, 242, 124, 242, 124, 241, 124, 242, 140, 195, 255,  15,   0,   0, 140,  82, 124, 242, 140, 242, 124, 241, 140, 242, 140, 242, 124, 242, 124, 241, 124, 242, 140, 242, 139, 242, 157,  19,   0,   0,
-124,  51, 124, 242, 139, 242, 123, 241, 140, 241, 123, 241, 124, 241, 124, 242, 124, 242, 123, 242, 140, 242, 139,  82,   0,   0, 255,   0, 140, 131, 124, 242, 123, 242, 124, 242, 123, 241, 139, 242, 123, 210, 140,   8, 173,   5, 124, 226, 123, 242, 124, 241, 123, 242, 139, 242, 124, 242, 123, 242, 124, 242, 124, 241, 123, 241, 124, 146,  15,   0, 143,   4, 140, 226, 123, 241, 140, 241, 140, 242,
-140, 114, 157,   4, 140, 225, 140, 242, 123, 242, 124, 242, 124, 162, 255,   0,   0,   0,   0,   0,   0,   0,  51,  35,  34, 242,  34, 242,  34, 242,  34, 242,  51,  51,   0,   0,  51,  19,  34, 211,  34, 242,  34, 243,  34, 242,  51,  83,   0,   0,   0,   0,  51,  51,  34, 242,  34, 242,  34, 242,  34, 243,  34, 242,  35, 179,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0, 156,  21, 124, 242, 140, 242, 140, 242, 124, 241, 123, 241, 124, 242, 124, 242, 124, 242, 123, 241, 124, 242, 123, 225, 140,  50,   0,   0,   0,   0, 140,   4, 139, 226, 140, 242, 124, 241, 123, 242, 140,  99,  15,  16,   0,   0,   0,   0,   0,   0,   0,   0, 136,   0, 140, 194, 124, 242, 124, 242, 124, 242, 140, 130,   0,   0,  15,   0, 123,  66, 123, 241, 124, 242,
-124, 241, 124, 242, 124, 241, 124, 146, 124, 242, 123, 242, 140, 242, 140, 195, 255,  15,   0,   0, 157,  19, 124, 210, 140, 242, 124, 241, 124, 241, 123, 242, 140, 163, 140, 242, 140, 242, 124, 241, 123, 241, 141,  19,   0,   0, 255,   0, 140, 130, 140, 241, 123, 242, 124, 241, 123, 242, 140, 242, 140, 242, 124, 242, 124, 242, 140, 162, 172,   4,   0,   0,   0,   0, 124,  35, 124, 226, 140, 242,
-124, 242, 124, 241, 140, 242, 123, 210, 140,  23,  15,   0, 124,  82, 123, 242, 123, 242, 124, 241, 123, 242, 124, 242, 124, 242, 124, 242, 140, 241, 140, 210, 124,  19,   0,   0, 143,   4, 123, 226, 124, 242, 123, 242, 140, 242, 124, 114, 136,   0, 124, 146, 124, 242, 124, 241, 124, 242, 124, 242, 124,  19,   0,   0,   0,   0,   0,   0, 136,   8,  50, 131,  34, 242,  34, 227,  51,  67,   0,   0,
-  0,   0, 135,   8,  50,  35,  34, 211,  34, 242,  34, 242,  34, 242,  34,  83,   0,   0,   0,   0,  51,  67,  34, 242,  34, 242,  34, 243,  34, 243,  51, 178,   8,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 174,   6, 124,  99, 124,  99, 139,  98, 124,  82, 140,  98, 124,  98, 124,  99, 139,  99, 124,  98, 140,  51, 174,   4,  15,   0,   0,   0,
-  0,   0, 136,   0, 140,  83, 124,  98, 140,  99, 124,  99, 140,  36,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255,   0, 124,  83, 140,  99, 139,  99, 140,  99, 140,  51,   0,   0,   0,   0, 255,   0, 140,  67, 123, 146, 140, 162, 140, 146, 140,  66, 139,  35, 123,  98, 140,  99, 124,  99, 140,  83,  15,  15,   0,   0,   0,   0, 190,   6, 140,  83, 124, 130, 124, 114, 140,  51, 140,  67,
-124, 242, 124, 242, 123, 242, 124, 241, 141,  19,   0,   0,   0,   0, 136,   0, 140,  51, 124, 114, 124, 146, 124, 146, 124, 162, 124, 162, 140, 130, 140,  51,  90,   5,   0,   0,   0,   0,   0,   0,   0,   0, 140,  19, 140, 115, 123, 162, 124, 162, 140, 146, 140, 130, 127,   8,   0,   0,  15,   0, 140,  19, 140,  98, 139, 146, 139, 146, 124, 162, 124, 146, 140, 130, 140,  82, 158,  18,   0,   0,
-  0,   0, 136,  24, 124,  83, 140,  98, 140,  98, 140,  98, 140,  51, 255,   0, 156,  51, 140,  99, 140,  99, 124,  98, 140,  98, 156,  20,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  35, 130,  34,  51,   0,   0,   8,   8,  35, 115,  34, 162,  34,  21,  51,  35,  34, 226,  34, 242,  18, 242,  34, 243,  51,  99,   0,   0,   0,   0,  51,  67,  34, 242,  34, 243,  34, 242,  51, 179,   8,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  15,   0,  15,   0,  15,   0,  15,   0,  15,   0,  15,  16,  15,   0,  15,   0,  15,  16,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  15,   0,  15,   0,  15,   0,  15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  15,   0,  15,   0,  15,   0,  15,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255,   0,  15,   0, 255,   0,   0,   0,   0,   0,  15,   0,  15,   0,  15,   0,  15,   0,   0,   0,   0,   0, 141,  19, 140,  67, 124,  67, 139,  82, 124,  51, 255,   0, 141,  67, 123, 242, 140, 242, 124, 242, 124, 241, 156,  19,   0,   0,   0,   0,   0,   0,   0,   0, 255,   0, 255,   0,   0,   0,   0,   0, 255,   0, 255,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255,   0,  15,   0,   0,   0, 255,   0, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255,   0, 255,   0,   0,   0,   0,   0,  15,   0, 136,  16,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  15,   0,  15,   0,  15,   0,  15,   0,   0,   0,   0,   0,   0,   0,  15,   0,  15,   0,  15,   0,  15,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  34, 114,  34, 243,  34, 242,  34, 163,  67,   4,  50,  35,  34, 226,  34, 242,  18, 242,  34, 242,  34,  99,   0,   0,   0,   0,  35,  51,  34, 242,  18, 242,  34, 178,   0,  16,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 140,  35,
-123, 242, 123, 242, 123, 242, 124, 210, 140,  82, 139, 162, 124, 242, 123, 242, 140, 242, 140, 242, 158,  23,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  51,  67,  34, 242,  18, 242,  34, 243,  34, 194,  35,   4,   0,   0,  51,  18,  35, 226,  34, 242,  34, 243,  34, 242,  51,  99,
-  0,   0,   0,   0,  51,  51,  34, 242,  34, 179,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  34,  34,  51,  35,   0,   0,   0,   0,  85,   5,  34,  34,  51,  35,   0,   0,   0,   0,  68,   4,  34,  19,   0,   0,   0,   0,  34,  35,  34,  34,  51,   4,   0,   0,   0,   0,  52,  19,  68,  52,  53,  22,   0,   0,   0,   0,  51,  19,
-135,   8,   0,   0,  35,  18,  34,  35,  51,  19,  86,   6,   0,   0,   0,   0,  68,  35,  51,  19,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 156,  20, 123, 241, 124, 241, 123, 242, 140, 242, 123, 241, 140, 241, 140, 242, 140, 242, 124, 242, 139, 194, 136,   0,   0,   0,   0,   0,   0,   0,  34,  35,  34,  34,  51,  19,
-  0,   0,  68,   4,  34,  50,  35,  35,   0,   0,   0,   0,  34,   5,  52,  52,  67,   3,   0,   0,   0,   0,  51,  20,  51,  19,  51,  19,   0,   0,   0,   0,  51,  34,  86,   5,  51,  35,   0,   0,   0,   0,  36,  20,  68,  52,  68,   4,   0,   0,   0,   0,  51,  35, 255,  15,   0,   0,   0,   0,  85,   5,  68,  51,  68,  20,   0,   0,   0,   0, 102,   7,  52,  36,  51,  20,   0,   0, 118,   6,
- 51,  34,  35,  19,  50,  18,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  34, 147,  34, 242,  34, 210,  35,  19,   0,   0,  67,  20,  68,  20,  50,  35,  34, 226,  34, 242,  18, 242,  34, 242,  34,  98,   0,   0,   0,  16,  35,  67,  51, 163,   8,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  86,   6,  50, 227,
- 34, 194,  35,  51,   0,   0,  51,  35,  34, 226,  35, 194,  68,  36,   0,   0,  85,  36,  34, 163,   0,   0,   0,   0,  34, 178,  51, 179,  50, 131,   0,   0,   0,   0,  35, 163,  51, 162,  35, 131,   0,   0, 255,  15,  35, 195, 119,  22,   0,   0,  51,  83,  34, 194,  51, 163,  51,  18,   0,   0,  35,  35,  34, 211,  35, 194,  85,   5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  15,  16, 140, 130, 124, 242, 123, 242, 140, 242, 140, 241, 124, 241, 123, 242, 123, 241, 124, 226, 140,  51,   0,   0,   0,   0,   0,   0,  68,  20,  34, 130,  34, 226,  51,  82,   0,   0,  69,  36,  34, 226,  34, 131,  51,   4,   0,   0,  34, 114,  34, 179,  50, 146,   0,   0, 136,   8,  51, 211,  51,  83,  50, 131,   0,   0, 103,   6,  34, 226,
- 68,  84,  51, 147,   0,   0,   0,  16,  51, 163,  35, 178,  50, 114,   0,   0,   0,   0,  51, 211, 187,   9,   0,   0,   0,   0,  50,  98,  50, 179,  50, 178,   0,   0,   0,   0,  35, 131,  34, 179,  35, 147,   0,   0,  68,  20,  34, 194,  51, 131,  51,  51,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  85,  22,  51, 114,  50,  18,   0,   0,  50,  20,  35, 178,
- 35, 162,  68,  20,  50,  35,  34, 210,  34, 242,  34, 242,  34, 242,  50,  99,   0,   0,   0,   0,  85,  21,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  53,   5,  50, 211,  35, 162,  50,  68,   0,   0,  51,  19,  34, 194,  51, 163,  51,  68,   0,   0,  69,  37,  34, 162,   0,   0,   0,   0,  34, 179, 119,  39,  50, 178,   0,   0, 136,  23,
- 34, 179,  68,  36,  68,  36,   0,   0, 255,  31,  51, 195, 102,  22,   0,   0,  34,  83,  50, 226,  51, 164,  51,  19,   0,   0,  51,  67,  34, 131,  68,  52,  67,   4,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 143,   8, 140,  67, 140, 146, 139, 194, 124, 194, 140, 194, 140, 162, 140, 114, 124,  19,  15,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,  35,  18,  35, 163,   0,   0,   0,   0,  68,  21,  35, 195,  35,  35,   0,   0,   0,   0,  34, 146,  34,  51,  51,  19,   0,   0, 136,   8,  51, 211,  35, 131,  51, 114,   0,   0, 119,   6,  34, 211,  67, 147,  50, 163,   0,   0, 136,   7,  51, 195,  51,  67,  35, 130,   0,   0,   0,   0,  51, 211, 187,   9,   0,   0,   0,   0,  35, 147,  68,  69,  34, 194,   0,   0,
-  0,   0,  35, 163,  51,  52,  68,  36,   0,   0,   0,   0,  51, 163,  35, 194,  68,  20,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  67,  19,  34, 178,  34, 242,  34, 242,  34, 162,  85,   5,  51,  35,  34, 210,  34, 242,  34, 242,  34, 242,  51,  83,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,  69,  21,  34, 211,  51, 179,  51,  67,   0,   0,  51,  19,  34, 227,  34, 211,  50,  19,   0,   0,  85,  36,  34, 163,   0,   0,   0,   0,  34, 162, 119,  39,  50, 194,   0,   0, 136,   7,  50, 179,  52, 116,  50, 179, 255,  15, 255,  15,  35, 195, 119,  22,   0,   0,  50,  83,  34, 163,  51, 227,  51,  35,   0,   0,  51,  83,  34, 147,  34, 210,  51,  34,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255,   0,   0,   0, 255,   0,   0,   0,  15,   0,  15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  50,  35,  34, 162,   0,   0,   0,   0,  68,  36,  50, 226,  51, 115,   0,   0,   0,   0,  50, 147,  34,  34,   0,   0,   0,   0, 136,   8,
- 51, 227,  51, 163,  35, 115,   0,   0, 118,   6,  35, 179,  52, 179,  51, 163,   0,   0, 136,   8,  51, 195,  51,  67,  34, 146,   0,   0,   0,  16,  51, 211, 188,   9,   0,   0,   0,   0,  34, 147,  69,  53,  34, 210,   0,   0,   0,   0,  34, 146,  51,  99,  50, 178,   0,   0,   0,   0,  50,  83,  34, 147,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,  51,  99,  34, 242,  34, 243,  34, 242,  35, 146,   0,   0,   0,   0,  51,  35,  34, 210,  34, 243,  34, 242,  34, 242,  51,  99,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  85,   5,  34, 211,  51, 147,  35,  99,   0,   0,  35,  18,  34, 178,  35, 179,  67,  36,   0,   0,  69,  36,  34, 162,   0,  16,
-  0,   0,  35, 179,  68, 100,  50, 178,   0,   0,   0,  16,  50, 163,  51,  99,  35, 147,   0,   0, 255,  15,  35, 211, 119,  22,   0,   0,  34,  98,  34, 114,  34, 242,  51,  35,   0,   0,  50,  51,  34, 163,  35, 178,  51,  20,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  51,  35,  34, 163,   0,   0,   0,   0,  68,  21,  50, 195,  51,  52, 136,  24,   0,   0,  34, 146,  34,  99,  51, 115,   0,   0, 136,   8,  51, 211,  35,  83,  51, 131,   0,   0, 118,   7,  35, 178,  34, 147,  34, 147,   0,   0, 101,  22,  34, 195,  51, 115,  50, 130,   0,   0,   0,  16,  50, 211,  68,  68,
- 51,   3,   0,   0,  35, 131,  51, 100,  34, 195,   0,  16,   0,   0,  34, 146,  51,  99,  50, 162,   0,   0,   0,   0,  50,  66,  51, 131,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  67,   4,  34, 146,  34, 242,  35, 146,  68,   4,   0,  15,  52,  31,  68,  14,  51,  19,  34, 210,  34, 243,  34, 242,  34, 243,  35, 115,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  68,   4,  51, 115,  51, 115,  52,   4,   0,   0,  51,  19,  51,  82,  51,  51,  51,  36,   0,   0,  85,  22,  34,  82,   0,   0,   0,   0,  51,  83,  34, 131,  52,  36,   0,   0,   0,   0,  51,  51,  34, 147,  51,  35,   0,   0,   0,   0,  52, 100, 103,  23,   0,   0,  51,  52,  51,  51,  51, 115,
- 51,   3,   0,   0,  34,   3,  50, 115,  50,  99,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  51,  19,  51,  83,   0,   0,   0,   0,  85,  21,  35, 131,  50, 114,  68,   4,
-  0,   0,  51,  36,  51, 131,  50,  51,   0,   0, 255,  15,  68,  99,  51,  36,  51,  67,   0,   0, 187,  11,  67,  84,  52,  52,  51,  67,   0,   0,   0,   0,  51,  68,  35, 146,  51,  19,   0,   0,   0,   0,  51, 115,  51, 131,  51,  35,   0,   0,  51,  19,  50, 130,  35,  51,   0,   0,   0,   0,  51,  35,  51, 131,  51,  51,   0,   0,   0,   0,  51,  35,  51,  67,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  85,   5,  35,  83,   0,  21,   0,  15,  51,  47,  34, 239,  35, 175,  52,  31,  35,  35,  34, 226,  34, 242,  34, 242,  51, 179,   8,  16,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  51,  47,  34, 239,  34, 254,  35, 255,
- 35, 175,   0,  15,  50,  35,  50, 210,  34, 242,  34, 178,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  15,  51, 143,  19, 255,  34, 255,  18, 255,  34,  95,   0,  15,   0,   0,  68,  20,  50, 115,  51,  99,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,  85,  15,  34, 143,  35, 255,  35, 111,   0,  15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 136,  24,  51,  63,   0,  15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0
-};
\ No newline at end of file
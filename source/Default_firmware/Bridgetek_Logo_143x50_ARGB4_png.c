@@ -0,0 +1,273 @@
+/*
+Bridgetek_Logo_143x50_ARGB4 as RGBA PNG, decoded to ARGB4 by CMD_LOADIMAGE
+*/
+
+#include "app.h"
+
+#if LOGO_FORMAT == LOGO_PNG
+
+/* 4157 bytes, zero padded to a multiple of 4 for EVE_Cmd_wrProgMem */
+eve_progmem_const uint8_t Bridgetek_Logo_png[4160] = {
+  137,  80,  78,  71,  13,  10,  26,  10,   0,   0,   0,  13,  73,  72,  68,  82,
+    0,   0,   0, 143,   0,   0,   0,  50,   8,   6,   0,   0,   0, 101,  55, 136,
+   56,   0,   0,  16,   4,  73,  68,  65,  84, 120, 218, 237,  92, 139, 149, 227,
+  168,  18, 117,  10, 164,  64,  10, 164,  64,  10, 164, 160,  20,  72, 129,  20,
+  148, 130,  82,  32,   5,  82,  80,  10,  74,  65,  91,  63, 160, 192, 114, 183,
+  221,  51, 179, 123, 222,  60, 209,  71,  71, 110,  89,  31,  40,  46, 183, 110,
+   21, 200, 143, 199,  93, 238, 114, 151, 187, 252, 207,  20,  31, 194, 195,  89,
+   23, 206, 243, 188, 141, 113, 151, 247, 139, 115, 206,  56, 107, 179,  53, 246,
+  180, 214,  37,  40,  79, 231, 220, 144, 186, 203,  53, 120,   0,  48, 214, 218,
+   19,   0, 116,  90, 218,  92,  84, 192, 178, 112,  60, 121, 231,   0,  81, 233,
+   54, 214,  93, 102, 230, 241,   6,  64, 179,  55,   0,  17,  80,   8,  56, 240,
+  175,  61, 232, 184, 115, 249, 182, 212,  93,   4,  48,  22, 183, 232, 189,  55,
+   10,  64,   5, 182,  21, 255,   7, 186, 113, 157, 137,  16,  60, 246,   6, 207,
+   93,  64,  28,  59, 247, 176, 168, 113,  24,  24, 217, 251, 192, 199, 189, 199,
+  157,  65, 220, 184, 193, 141,  17, 243, 248, 219, 114, 119,   1, 141,  99, 151,
+    1,  24,   4,  32,  95,  25, 169, 185,  42, 181, 221, 192, 185,  75, 103,  30,
+   64, 200, 234, 186,  75,  74,  10,  56,  26,  52, 248, 221, 239,   4, 142, 249,
+  131, 205,  50, 119, 207, 254, 185, 112,  28,  93, 213, 134,  14,  73,  52, 142,
+    0,  72, 196,  49,  73, 156, 198,  68,  79, 192,   1, 102, 178, 239,  62, 107,
+  217, 118,  99,  83,   9, 184, 153,  88, 188, 141, 240, 185, 109,  25,  55, 239,
+   82, 193, 205, 250,  84, 126, 161, 211, 207,   7,  60, 195, 213, 123, 155,  72,
+  207, 116, 223,  93,   5, 231, 194, 112, 193, 122, 101, 174,  19, 124, 254, 107,
+  146,  17, 231, 137, 237, 243,  38,  53, 155, 160, 253, 237, 207, 153,   6,  92,
+   18, 132, 223,  89, 116, 204, 129,  40, 153, 196, 243,  51, 227,  88,  23, 234,
+  136, 134, 111,   3, 156, 179, 189,  59, 186, 195,  90,  12, 116, 204,   9, 149,
+   62, 161,  99,  78, 131, 123, 248, 159, 247,  79, 219, 238, 126, 218, 184, 148,
+  208,  80,   5, 159, 209, 238, 151,  74, 122, 195, 184, 169,  63,  63, 159, 240,
+  252, 242, 183,  36,  71, 125, 162, 246,  29, 221,  30, 212,  15,  17, 218, 253,
+  179,  65,  10,  64, 240,  19,  56, 118, 239, 157,  68,  89, 206, 187,  73, 227,
+  224, 249,  21,  40,   8,  28,  57, 150, 223, 205, 243,  32, 120,  76,  18, 176,
+   80, 229, 241, 115, 110, 159, 169, 179,  83,   7,  23,  28, 203, 143, 159, 116,
+  158, 128, 199,  32,  64, 147, 220, 235,  77, 240,  80, 253,   4, 216,   0, 158,
+  253, 191,   0, 143,  75, 187,   1, 246, 133,  45, 211,  30, 234, 254, 123, 193,
+   67, 118,  33, 123, 199, 199, 175, 180,  15, 152,  39,  40, 128, 164, 165, 231,
+  113,  78, 206,  44,  63,  71,  85, 224, 201, 154, 176, 102, 240,  60, 222,   4,
+   79,  54,  86, 177, 141, 169, 172,  83,  89, 136,   1, 211,  70,  62, 254,  31,
+  214, 253, 243, 145,  17, 133, 121, 100, 148, 153,  58, 202, 222, 100,  30,  19,
+   27,  43, 254, 235, 224,  73, 208, 201,   0, 218, 181, 218,  65,  88,  57, 255,
+  170, 251,  36, 240, 164, 124, 168, 123,  86, 230, 249, 200,  85, 161, 187,  65,
+  141,  19,  20,   3,  33, 128,  68, 227,  92, 137,  99, 117, 174,  48, 142, 250,
+  238,   3, 240,  20, 211,  58, 180,  50,  13, 186, 167, 148, 131,  99,  63, 220,
+   64, 101,  59,  35, 253, 200, 117, 249,  45,  27,  15,  26, 203, 111, 197, 120,
+   24, 201, 254, 187, 209, 123, 146, 113, 147, 173, 207, 102, 118,  44, 255,   1,
+  120, 144, 105,  54, 147, 134,  78,  46, 191,   1,  60, 134, 152,  39, 245, 129,
+  249,  17, 120, 120, 174, 202, 109,  87, 160, 152, 197, 113, 101,  30, 113,  85,
+  245, 250, 197,  90,  51,   3, 107, 251, 196, 109,  49,  19,  12, 126, 183,  80,
+    3, 184, 243, 182, 218, 121, 166, 129, 236, 123, 161, 251, 219,   4, 101,  82,
+  154, 135, 235, 248,  39, 193,  99,  94,  50,  15, 128, 103, 210, 127, 249, 183,
+  128,  39, 149, 125, 210, 151,  31, 129, 199, 206, 185,  26, 148,  54,  10,  56,
+   87,  26, 167,   2, 107, 153,  25, 233, 115, 183, 213, 153,  71, 185, 167, 194,
+  125,  71, 110, 131, 192,  83, 193,  37, 174, 195, 214, 206,   5,  23, 230, 224,
+   30, 142, 246,  16,  61,  97, 244,   6, 134, 118, 192,  90,  11, 236,  23, 140,
+  168, 112, 228, 162, 161,  61, 156,   7, 140, 227,  61, 156,  11, 123,   7, 123,
+  171, 129, 130,  17, 157, 227, 104, 108, 193, 232,   3, 116,   6, 129, 167,  49,
+  226,   5, 120, 128,  33, 241,  28, 140,   6,  35,   0,  29, 159, 105,  23, 144,
+  101,  88,  23, 184, 191, 151, 231, 248, 101,  59,   7,  80, 122, 210,  47, 187,
+  167, 103, 193, 181, 116, 125, 164, 235,  29, 186, 242,  14, 140, 147, 238,   5,
+  199, 115, 117, 229, 204, 194, 165, 240,  51, 160, 205, 249, 232, 246,  92, 224,
+  190,  43, 158, 159,  49,  50, 164, 123, 227,  30, 218, 229,  81,  55, 105,  49,
+   44, 110, 107, 111, 238, 144,  52,  79,  38, 240, 160, 109,   2, 217, 170, 182,
+  227,  69, 160, 162, 231, 165, 244,  92, 149, 123, 214,  56, 161, 142,  14, 167,
+  117, 145,  25,  51, 204, 246, 131, 233,   9,  22, 204,  85, 235, 228, 145, 146,
+   27, 120,  52, 176,  64, 180,  74,  67, 124,  44,  15,  67,  35, 167, 139, 107,
+  215, 152, 162, 187,  26,   4, 209,  35, 197,   7, 234, 149,   1, 132,  77,  48,
+   19, 195, 120,  51, 131,  24, 238, 141, 207,  55,  29,  56, 228,  82,  43, 120,
+  108, 218, 240, 186,  44, 250,  73, 187, 148, 164, 117,  26,  30, 247,   4,   8,
+  121,  22, 167,  32,  14, 163,  34,  63,  35, 236,  43, 247, 192, 231, 114,  74,
+  128,  69, 237,  94, 219, 167, 235,  88,  63,   7, 177,   7,   2, 143, 193, 160,
+  220, 252,  20, 177,  34,  72, 151,  37,  43, 240,  20, 165, 121,  88,  48,   3,
+   96, 228, 153, 131, 148,   8,  95,  49,  16,   6, 225,  26,  56, 175,  25, 199,
+  217,  69, 131, 106, 206, 249, 216,  31, 105,  30,  21, 158, 167,  82, 220, 186,
+  147,  46, 193, 207, 173, 227, 120, 127, 196, 245, 144, 198, 151,  38, 248, 134,
+  112,  63, 117, 129,  43,  32, 217, 184,  19, 114,  25,  68, 103,   5,  15, 187,
+  167,  82,   1, 172, 193,  98,  70, 151,  53, 129, 135, 242,  34, 131, 216, 183,
+  169, 244,  65, 160, 234, 237,  68, 228,   3,  35,  88, 221, 169, 102,  26,  24,
+   70,  61, 211, 161, 123, 230,  14, 222,   7,  16, 180,  54,  86,  96,  22,  80,
+  167, 100, 171, 163,   7,   4,  44,   1, 180,  75,  50,  93, 219, 132, 231,  80,
+  189, 178, 123,  78, 142, 114,  63, 185,  93,   3, 247,  56, 136, 181, 222,   8,
+  213,  59,  11, 153,  43, 224,  64,  84, 117,   1, 156,  49,  18, 251,   0,  60,
+   73,  11, 230, 210, 221,  67, 210,  35,  81, 117,   6, 178, 136,  80, 186, 167,
+  144,  53,  31, 253, 187, 235, 252, 144, 193, 240, 158, 197,  97, 105,  97, 191,
+    6,  15, 135, 241, 135,  26, 125, 167,  85,  64,  48,  10, 112,  45, 207,  51,
+  232, 161,  65,  80,  31,  54, 117,  55,  91, 175, 243, 236,  50, 240,  57, 113,
+   18, 190, 196, 150,  78, 185, 231,  30, 101, 130, 254,  96, 240,  20, 171,  35,
+  209,   1, 156, 249,  68, 151, 226,  56,   1, 170,   0, 204, 131, 198,  41, 205,
+  166,  92,  94, 102, 215,  41, 204, 211, 152, 147, 221,  22, 177, 253, 144,  62,
+   41, 249, 106, 221, 214,  24, 162,  59, 231,  46,  64, 161, 129,  19, 158,  88,
+  230,  74, 243, 124, 232, 182, 244,   8,  55, 115, 103, 244,  78, 219,  49, 211,
+  172, 197, 156, 139,  25, 217, 228, 208, 130,  27, 206,  75,   1, 181, 202,  56,
+  210, 178, 208, 127,  25,  41,  58,  55, 240, 152, 168, 232,  91, 242,  73, 203,
+  134, 244, 157, 183, 193, 184, 145, 163,  45,  17, 177, 153, 141, 156, 155, 145,
+   67, 200, 120, 220,  79,  26,  14,   1,  98,  30,  74, 195, 117, 166, 205, 251,
+    3, 174, 217, 247,  93,  92,  72, 110,  46,  12, 254,  95, 241,  26, 201, 194,
+  111,  53, 160,  48,  12, 184, 140, 237,  92, 192, 197,  72,  93, 130, 157,   6,
+  159,  71, 182, 195, 129,  65,  65, 135, 202, 151,  33, 123, 167, 179,  69,  91,
+    3, 187,  34, 216, 134,  65,  72, 117,  13, 223,  70,  93, 207, 194, 185,  49,
+  142, 161, 220, 143, 121,  13, 152, 105, 170, 226,  67, 240,  60, 105,   6, 149,
+  105, 206, 218, 239,  74,  67,  26, 243,  60, 117, 186,  35, 113, 136, 224,  25,
+  192, 183,  85, 240,  24, 237,   2,  21, 120, 208,  29, 105, 131,  97, 116, 147,
+  146, 176, 139,  98, 192, 154,  36, 148, 239, 178, 118,  77, 244, 156, 199,  41,
+  224, 209, 122,   3, 217,  97, 103,  81,  78, 163, 186, 107,  18, 184, 102, 199,
+  231,  23,   6, 214, 209,  70,  59, 119, 244, 138, 247,  19, 112, 172, 102, 204,
+  188,  15, 161,  58, 137, 227, 193, 189, 230,  51, 108, 197, 176, 198,   2, 221,
+   54, 216, 181, 236,  40, 234, 159, 153, 135, 239, 171,   7, 139,   0, 213, 124,
+  195,  58, 118, 121, 173, 113, 174, 163, 170, 215, 204, 243, 161, 230,  73,  69,
+  101, 150, 121, 100,  56, 238, 180, 181,  53,  66, 233, 152,  38, 152,  73, 243,
+  212, 198, 243, 245,   4, 158,  68, 140, 148, 145,   9, 104, 143,  32,  97, 205,
+  179, 119, 255, 158, 103, 183, 181, 155,  17, 192,  91, 226, 145, 153,  38,  87,
+  168, 152,  39, 231,  46, 116, 169,  14,   4,  30,  95, 197, 119,  82, 204, 179,
+  178, 219, 162, 144,  59,  77, 174, 149, 219, 185,  62,  77, 211, 164,   1,  60,
+  219,  36, 128,   7, 240, 112, 100, 153, 167,  44,  61, 184,  45,   6, 235,  60,
+    5, 113, 132,   6,  30,  16, 238, 195, 224,  85,  66, 159, 207, 221,  48, 216,
+  248, 134, 121, 108, 170,  81,  19, 230, 125, 134,   4, 226,  43, 134, 153, 162,
+   45, 117,  60, 127, 150, 231,  81,  57,  28, 102,   4, 149, 231, 225, 206,  51,
+  210,  24, 113,  97, 139, 132, 187, 205, 109,  85, 170, 118,  85,  19, 157, 106,
+  163, 168,  37, 137,  96, 174, 145,  13,  25, 166, 131,  39, 113,  68,  83, 129,
+   42, 204,  99,  58, 128, 199,  80,  93, 128, 149,  71,  65, 205, 224,  33, 193,
+  217,  53,   4, 237, 149, 230, 201,  54, 149,  11, 193, 156, 135, 108, 186,  48,
+  100,   7,  15, 130,  75, 235, 192,  52, 230, 121,   8,  60, 149, 205, 100, 170,
+   97, 136, 204, 210, 224, 134, 128, 121,  54, 184, 166,  10, 230, 124,  14,  90,
+   80, 107,  43,  28,  96, 223, 229, 125, 106, 232, 205,   0,  48,   8, 160, 165,
+  205,  89,  93, 100, 152, 191, 210,  61,  63, 205,  48,  15,  73, 194,  62, 171,
+   29,  91, 228, 147,  26, 165,  71,  25, 225,   4, 158,  73, 124,  46, 151, 201,
+  179,  58, 183, 213, 163, 138, 145, 121, 146,  10,  77,  69, 108,  70, 102, 151,
+  150, 231, 145, 235,  26, 120,  90, 238,  69,   9, 212,  39, 183,  37, 172, 228,
+  214, 170, 121, 242, 200,  32, 227, 188, 221,  52,  65,  44, 224, 137, 162, 149,
+  134, 121, 190, 140, 224,  49,  35, 243,  12, 153, 226, 243,  41,  66, 107,  46,
+  177, 236,  73, 114,  77, 204, 198,   3, 112, 142, 174, 155,  24, 104, 152, 239,
+  250, 118,  25,   6, 128,  97, 159, 150, 147,  46, 211, 132, 233, 113,  29,  93,
+  253,  74, 146,  48, 155,  49, 148,  44,  35, 120, 192,  40,  83, 246, 185,  25,
+  213, 113, 168,  62, 228,  35, 136, 149, 174, 192,  19, 163,   8, 102,   5,   4,
+    5,  30, 131,  70,  76, 157, 149,  92,  20, 205,  19, 101, 122,  34,  93, 184,
+  173, 166,  95, 138, 238,  80,  37, 152, 251, 119, 138, 121,  54,  59,  68, 117,
+  160,  63, 214, 221, 130,  40, 182,  32, 126, 251,   6, 255, 199, 141, 195,  99,
+  174, 199, 215,  25, 230,   1,  60,  77, 243, 236, 148,  52, 229, 123, 183,  13,
+  254, 103,  13,  35, 161, 250, 110,  20,  59, 193,  96,  89, 237, 148, 106,   0,
+  240, 184, 183, 178, 205,  53, 191, 163,  38,  57,  23, 245, 189, 159, 221, 213,
+   37,  27, 253,  32, 218,  26,  35,  44, 113,  91,  44, 246,  98, 255, 174,  37,
+  253,  82,  99, 158, 164,  66, 236, 175, 153, 135, 115,  70, 163,  97,   6, 205,
+   51, 230, 117, 178,   8, 230, 156, 106, 246,  85, 158,  83, 148,  96, 222, 236,
+  152, 125,  30,  52,  79,  79,  72, 162,  22, 107, 154,  39,  15, 121,  33,  22,
+  204, 166,  38, 249,  36, 203, 205, 123, 209, 118, 253,  89, 122, 142, 175,  12,
+  204,  99, 211, 190, 152, 201, 229, 120, 201,  45,  73,  40,  95,  55, 215,  53,
+  163, 154, 219,  74,  77,   7, 198,  54, 200, 122,  29, 215, 183, 166,  44,  36,
+  234, 218,  71,  80,  60,   3, 232,  43, 247, 229, 126,   4, 158,  97,   2, 116,
+  247, 152, 122, 199,  17,  12, 250, 199, 118, 119,  85,  27, 179,  52, 193,  44,
+   34, 216, 244,  16, 246, 181, 219, 162,  68, 224, 224,  34, 146,   2, 214,  62,
+  210, 125, 222, 150,  13, 167,  30, 242,  58,  37,  12, 123, 180,  21, 107, 135,
+   54, 151, 150,   5,  32, 222,  76, 108, 218, 192,  83,  67, 245, 206, 162,  20,
+  109, 181, 124,  78, 210, 147, 196,  57,  85, 205,  67,  19, 163,  90, 187,  36,
+  153, 255, 235,  83,  43, 193,  76, 118, 244, 232,  42, 185, 221, 201, 170, 213,
+   10, 248, 204,  84, 243,  60,  20, 225,  53, 224, 156,  34,  19, 146, 118, 171,
+  240, 204,   3, 250, 233,  75, 193,  12, 160, 112, 155, 243, 184, 106, 176, 207,
+  119, 185, 171,  89, 116, 107, 253,  12,  30, 103, 230,  80, 253,  61, 193, 140,
+   13, 188, 202, 237, 216, 113,  74,  96,  56,  78, 249,  30,  30, 169, 220, 248,
+  212, 245, 208, 119, 224,  25, 242,  40, 131,  96, 206, 227,   4, 161,  68, 125,
+   83, 114, 141,  58,  13, 193,  83, 231, 221, 170, 155,  51,  93,  35,  32, 237,
+  151, 214,  33, 210, 174,  26, 109, 181, 232, 109,  90, 148, 198, 115,  80, 163,
+  104, 173, 245, 195,   4,  29, 134, 234, 117, 205,  77, 191,  47, 105, 174,  45,
+  228, 243,  81, 147, 132,  45, 193,  42,  26, 140, 153,  68, 233,  66, 190, 182,
+  168,  36, 225,  62, 217,  58, 225, 189, 204, 164, 149, 170, 205,  95,   0, 167,
+  177, 204,  22, 130,  55, 180, 236, 235,  57, 239,  19, 230, 132, 226,  11,  23,
+  246, 153, 230, 153,  50, 174,  61, 186, 209, 238, 170, 135, 241,  97,  61, 132,
+  142,  81,  47, 229, 167,  60, 207,  87, 130, 121,   2,  71,  82, 235, 118, 178,
+   78, 176, 205, 192,  53,  93, 144,  23,  53,  61,  17, 236, 188, 246, 232, 106,
+   90,  35, 229,  62,  61,  17, 107,  39, 103, 149, 130, 152,  51, 227, 109,  17,
+   92,  80, 204, 146, 116, 226,  81,  45, 152, 219,  19,  12,  34, 208,  55,  45,
+  114,  82,  73, 208, 115, 188,  70, 185, 161,  71, 207,  48,  15,  83,  50,  52,
+  183, 181, 227, 156, 225,  49, 106,  40, 112, 201, 179, 235, 146,  89, 245,  57,
+   90, 114, 125, 185, 134, 122, 193, 239, 105,  29, 207, 152, 145, 118, 191,  50,
+  171, 174,  70, 140, 153,  38, 244, 122,  30, 130,  34,   1, 215, 103, 133, 101,
+  110,  75,  39, 241,  24,  60, 230,  53, 243,  92,  45,  67,  37,  97, 236, 205,
+  148, 172, 172,  17, 143, 238,  80,  13,  30,   4,   4, 105, 165,  52,  44,  22,
+   59,  91,  46,  71, 181, 167, 205,  13, 213, 244,  67, 122,  10, 137, 103,  54,
+  218, 252,  86,  84,  54, 189, 216, 190, 246, 102, 200, 132, 239,  49, 181, 100,
+   96, 152, 178, 215, 163,  29, 249,  25, 184, 148,  87,   9, 102,  53,  55, 216,
+  166,  68, 104, 160, 173, 115, 226, 182,  94, 167, 108, 154,  56, 199,  83, 215,
+   44, 171, 213, 129,  41,  69, 252, 206, 186,  73,   3, 193, 255, 225,  74,   3,
+  185, 254,  22, 233, 219, 110, 107, 217, 142,   7,  45, 159, 160, 165,   9, 121,
+  145,  69, 230, 184,  95, 120,  89,  69, 230, 207, 168, 129, 182, 227,  49, 176,
+   10, 211, 121, 144, 239, 233, 252, 151,  75,   7,  88, 111,   4,  73,  34, 242,
+  249, 122,   1, 252, 217,  66, 236,  85, 232, 126, 229, 165,  22,  52, 145, 217,
+  238, 143, 207,  59,  85,  29, 112,  57, 132, 212,   1, 153,  33, 138,  32, 245,
+  115, 206, 100, 152,  88, 228, 122,  59,  14,   6, 106, 130, 144, 244,  19,  62,
+  151, 220,  70,   8, 219, 197,  82,  84,  92, 198,  65, 110, 168, 158, 139, 117,
+   76,  24, 202, 215,  65,  32,  75,  84,  23, 214, 106, 185, 222, 119,  21, 215,
+   24, 172, 176, 182, 244, 189, 113, 213, 222, 178, 145,  77, 208,  22, 180, 172,
+   67, 150, 181, 240, 178, 145, 133,  52, 212, 139, 165, 167,   9, 113,  66,  55,
+  133,  63,  96, 143, 136, 111,  80,   4, 107, 205, 176, 230, 167,  38,   4, 221,
+  235,  40, 204, 125,   0, 158, 218, 232, 139, 205, 140, 159, 223, 189, 246, 147,
+  231,  92, 131, 172,  37,  25, 191, 185,  78, 214,  21, 123,  76,  10,  90,  94,
+  249, 200, 134, 167, 117,  58, 121, 112,  97, 238, 202, 240, 231, 244, 156, 249,
+  255, 175, 234, 247, 213, 249, 231,  69, 253,  37, 162, 251, 204,  38, 159, 216,
+  182,   1, 201,  70, 149,  45, 222, 188, 119,  15, 198, 207,  60, 219,  62, 228,
+  129, 244,  26, 231, 252, 248,  63, 120,  55,  10,  67, 222,  41, 141, 176, 243,
+  107,  68, 121, 204, 229, 192,  22, 213, 136, 255, 123,  13,  82, 221,  80, 143,
+  158,  96,  88, 185,  42, 146, 113, 130, 116, 142, 194, 150,  89,   3,  57, 251,
+  217, 187, 234, 136, 202, 250, 142,  24, 233, 160,  16, 158, 142, 121, 138,   2,
+  173,  81,  17,  31,  21, 239, 156, 170, 187,  55, 112, 158,  91,  92,  48,  58,
+  245, 144, 100, 110,   6, 238, 136,  26,  14, 239, 107, 150, 176, 244, 235, 188,
+  167,  99,  31,  47, 227, 164,  72, 113, 212,  45, 147, 248, 108, 235, 158,  31,
+  211, 146, 134,  90, 255, 250,  92, 126, 229, 201,  82, 166, 173, 217, 193, 218,
+  135, 135, 200,  69,  22, 118, 242,  51,  81, 135, 202, 166, 130,  23,  27, 160,
+   61, 131, 189,  44, 219, 162, 190, 221,  91, 245, 173,  94,   5, 137, 118, 118,
+  124,  78, 187,  87,  92,  22, 124,  38, 218, 149, 142,  45, 113, 121, 112, 173,
+   28, 174, 115, 127, 103,  77, 143,  93, 235, 107,  55, 120,  17,  55, 206,  97,
+  101, 204,  21,   3, 217, 206,  64, 184,  30, 218, 127, 178, 134, 121, 161,  70,
+  211, 253,  10, 178, 215, 184,  52, 214, 149, 250,   2, 161,  15,   1, 181, 215,
+  166,   0, 151, 209,  61, 214,  55,  88, 133, 253,  54, 184, 197,  86,  95,  78,
+   68,  67, 193, 231, 178, 196, 104, 212, 146, 146, 130, 245, 179,  98,  28,  50,
+   11, 105,  58,  87, 208, 152,  31,  46, 114,  54, 195, 154, 158, 105,  13, 146,
+    8, 240, 195,  77,  47,  23, 202, 124,  97, 162,  54,  74,   0, 226, 125, 160,
+   54, 203,  79, 212, 104,  15, 144, 161, 130, 107, 215, 167, 110, 199, 118, 212,
+  118,  47,  75, 196, 243,  14, 184,  39,  28, 115, 107, 235,   7, 108,  35,   4,
+   46, 112, 173, 254,   9, 156, 125, 205, 121, 152,  12, 199, 180, 138,  78, 234,
+   58, 150,  47,  25, 246, 171, 170,  43, 218,  44, 213,  64, 234, 155,  14,  13,
+  128,  50, 208,  60, 130,  52, 136, 218,  13,  85,   4,  58,  71,   1, 104, 183,
+   47, 166,  50, 160,  19, 222,  30, 197,   1, 108,   7, 215, 238, 116, 111, 121,
+  235,  84,  18, 149, 212, 201,  94,   4, 124,  96, 227, 110,  10, 224,  57, 198,
+  104, 107, 195,  35, 138,  63, 126, 143, 222,  86, 192,   1, 120, 208, 136, 101,
+   89,  22,   1, 138,  69,   4,  30,  30,   1, 230, 134, 119, 209,  18, 143, 210,
+  207, 215, 213, 203, 140, 183, 103, 241,  74,  19, 175,  69, 146, 125, 148,  99,
+  225,   8, 229, 188, 210, 152,  70,  79,  64,   7, 180,  43,   0,  88,  51, 143,
+  229, 215, 188,  93, 173, 107,   3,  15, 254,  70, 146, 227, 223,  69, 130, 129,
+  193, 211,  74, 222, 173, 242, 178,  37, 218,   2, 207,  43, 236,  69,  92, 122,
+    5,  30,   4,  72,  64,  99, 129, 173, 245,   0, 196, 209, 175, 223, 250,  21,
+   32,  22, 205,  80, 239, 185,  49,  79,  29, 153,  21,  80,  54, 162,  59,  70,
+  208, 254,  42,  15, 244,  54, 120, 124, 160, 116,   0, 179, 136, 243,  42,  69,
+  112, 240, 113,   1, 240,  51, 243, 108,   2, 158, 210,  13,   6, 224, 113,  62,
+  226, 190,  38, 242,  70, 230, 177, 193, 241, 107, 212,  71, 127, 149, 218,   5,
+   97, 218, 221,  42, 218, 255, 201, 155,  22, 195, 254,  27, 145,  41,   3,  80,
+  175,  94, 192, 182,  96, 189,  20,  83,  80, 189, 236,  24,  25,  83, 221, 145,
+   93,  99, 117,  43, 152,  26,   1, 211, 101, 102, 252, 118, 158, 128, 199, 106,
+   54,   2, 240, 148, 193, 195, 128, 253, 177,  38, 251,   0,  88,  92, 130, 163,
+  217, 136, 237, 182, 254,  68,   3,  45, 211,  47, 129, 173,  83, 142, 104, 154,
+   76, 237,  26, 232,  45, 240, 208, 239,  27,  18, 120, 214,  58, 143, 134, 163,
+  210,  50, 117,   2, 147, 112, 135, 250, 206,  60, 213, 221,  32, 203, 232,  70,
+   34,  35, 110, 180,  76,  86, 234,  40, 224, 217,  43, 120, 208, 189, 162,  43,
+  144, 122,  10, 120,  72, 233,  19, 197, 251,  31, 232, 158,  95, 208, 150, 195,
+   96,   8, 204, 232,   5,  71, 125, 146, 200,  72, 152, 103, 169, 128,  82, 204,
+  131,  46,  42, 241, 124, 239,  82,  95,  15,  95, 107,   7,  47,  11,  13,  72,
+    4,  79, 180, 221, 173, 227, 253, 119, 143,  20,  43, 222,   7,  25, 204, 243,
+  203, 154,  69, 173, 160, 168, 224, 217, 148, 123, 243, 245, 121, 159, 137,  66,
+   79,  63, 122, 176,  86, 224, 160,   0, 163,  49,   5, 226, 244,  64,  17,  43,
+  115,  97, 110, 200, 245, 184, 248, 254, 253, 233,  30,  17,  55, 239, 124, 159,
+   95,  35, 191, 142,  62, 133,  59, 153,  92, 233, 152,  95,  10, 172,  15,   6,
+  122, 117, 142,  27, 223, 133, 163, 243,  48,  56, 163, 184, 223,  86,  98,  55,
+   32, 255, 112, 149, 118, 187, 255,  18, 120, 140, 102, 106, 116, 245, 236, 142,
+  232,  71, 180, 170,  56, 182, 172,  53,  56,  98, 161, 193,   0,   3,  70, 142,
+  211,  73,  25,  23, 117, 121,  23,  72,  88, 171,  28, 157, 103, 151, 181, 106,
+   97,  45, 237,  78, 138, 117,  81,   4, 167, 170,  53,  27, 168,  39, 125, 227,
+  212, 243,  62,  46,  65, 126, 253,  20,  90, 106,  24,  56,  14, 145, 114, 156,
+  224,  31,  17,  68, 122,  46,  76, 229, 121, 238, 159,  49, 185, 203, 228, 218,
+    5,  56, 128, 148,  19, 192, 115,  18, 128, 170,  15, 119,  77,   3, 221,  63,
+   43, 119, 151, 139, 124,  35,  80,  26, 196,  48,   0,  26,   0, 143,  65,   0,
+  217, 112, 170,  16, 148,  93, 128,  91, 110, 107, 221, 229,  25,  64, 224, 188,
+    0,  48,  73,  88, 103, 185, 127, 115, 249,  46,  31, 230,  54, 146,  65,  97,
+  115,   3, 231,  46,  63, 118,  97, 119, 185, 203,  93, 238, 114, 151, 187, 220,
+  229,  46, 119, 185, 203, 223,  92, 254,   1,  37,   4,  10, 169, 189, 221,  36,
+   73,   0,   0,   0,   0,  73,  69,  78,  68, 174,  66,  96, 130,   0,   0,   0
+};
+
+#endif
@@ -0,0 +1,237 @@
+/*
+Bridgetek_Logo_143x50_ARGB4 image data, zlib compressed for CMD_INFLATE
+*/
+
+#include "app.h"
+
+#if LOGO_FORMAT == LOGO_DEFLATE
+
+/* 3574 bytes, zero padded to a multiple of 4 for EVE_Cmd_wrProgMem */
+eve_progmem_const uint8_t Bridgetek_Logo_zlib[3576] = {
+  120, 218, 237,  90,  77, 111,  27, 199,  25,  38,  34,  74,  86, 208,  15,  18,
+   34,  41, 235,  22, 100,  70, 113, 143,  69, 119, 168, 115,  81, 237, 250,   7,
+  132, 180, 114, 104,  14,   5, 184, 105, 114, 104, 129,   2, 100,  17,  23, 216,
+   41,   2, 144,   5,  44, 116, 135,  16,  64,  30,  77,  25, 200, 178, 183,  88,
+    9,  74, 222, 234,  34,   5, 168,  95, 144, 229, 185,   7, 211,  63, 160, 224,
+  234,  94, 246, 253, 152,  37,  41, 153, 148,  19, 163,  53,  16, 148, 187, 160,
+   68,  46, 247,  99, 230, 153, 231, 125, 222, 231, 157,  97,  38, 179, 217,  54,
+  219, 127, 127,  59, 201, 202, 234,  44, 183, 193,  97, 213, 166,  10,  98, 184,
+  151, 200, 230, 233, 238, 252, 208,   6, 169, 249,  38,  91,  34,  17,  87,  34,
+  145, 117, 194,  74, 138, 150, 250, 211, 238,   6,  22, 187, 149,  11,  34,  70,
+  124,  84,  19, 176,  81,  98,  34,  18,  53, 220, 160, 146, 201,  56,  91,  78,
+  195,  43,  18,  62,  35, 209, 129, 207,  14, 114,  72,  36, 206,   6, 157, 140,
+  202, 138,   1,  96,  49, 184, 159, 205, 100, 188, 108,  38,  47,  21,  96,  67,
+  232,  40, 119, 131, 142, 240,  25,  11,  49,   4, 108,  50,  14, 197,  20, 237,
+  199,  27, 108, 136,  59,  93, 196, 199, 105,  17,  54, 140,  76, 226, 124,  59,
+  222, 228, 191, 211, 163, 242, 223,  43,  92, 182,  68, 164,  36, 232, 205, 150,
+  232,  74, 192,  70,  50,  54,  87,  41,  54, 222, 225, 170, 171,  46, 246,  77,
+  197,  84, 244,  47, 116,   5, 247, 160,  18,  28,  27, 215,  72,  83, 188, 237,
+   73, 185, 140, 113, 232, 252, 247, 141, 115, 243,  59, 237, 152, 227,   0, 190,
+   51, 199, 111, 194,  64, 204,  50, 250, 216, 188, 175, 177, 253, 226, 182, 243,
+  188, 172,  28,   0,  18,  47, 132, 180, 218,  60, 231, 141, 172, 226,  56,  59,
+   21, 167, 191, 106, 180, 123, 165,  32, 209, 137,  73, 244,  20, 254,  79, 117,
+   98, 247,  88, 203, 245, 207,  58, 205, 232, 145, 161, 243,  76, 243, 165, 214,
+   54, 241,  56, 220, 235, 242,  77,  56, 209, 179, 172, 158, 224, 243, 194,  68,
+  215, 103, 183, 112,  89, 186,  22, 141, 216, 133, 113,  87,  46, 224, 196, 216,
+  184, 136, 137,  83, 129, 119, 195,  85, 126, 167,  87,  10, 167, 122,  26,  66,
+  127,   2, 250, 107, 240,  73, 240,  55,  24, 204, 110,  71, 103,  10, 251,  74,
+  116,  66, 248,   6, 112,  30, 191,  62,  58, 237, 130,  41, 132, 240,  50, 111,
+  125,  59, 116, 160, 205,  83,  83, 159, 221, 238, 255,  42, 132,  71,  51, 179,
+    3, 254,  38, 217,  75,  22, 121,  74, 213, 200,  23, 174, 204, 232, 143,  75,
+   52, 210, 211,   0, 122, 132,  12,  50, 248, 137,  80,  58,  47, 173, 123, 210,
+   31,   0,  29,  26, 177, 169, 174, 175, 228,  14, 220,  43, 136,  95,  23, 157,
+  179,  93, 221, 197,  54, 192,  93,   6, 185,  87, 162,  19,  78,  52, 115, 126,
+   13,  58,  94, 209, 137,  84, 149, 240, 169,   2,  54,  25,  49, 143,  41,  62,
+  234,  84, 237, 167, 149, 232, 244,  74,  20,   9, 136,  76,  28,  86, 117, 149,
+  122,   6,  81,   6,  60, 186,  37, 146, 191,  40,  94,  20, 159,  22, 219,  69,
+  147, 189, 137,  78, 216,  12,   8, 223, 112, 244, 218, 232,  28, 152, 136, 216,
+  151, 232, 209,  43, 209,  41, 234, 137, 161, 177,  92, 141, 142,  42, 200, 254,
+    2, 137, 185,  22,   3, 119,  36, 243, 198, 127,  55, 197, 170, 191, 187,   6,
+   29, 104,  11, 198, 211, 104, 134, 189, 139, 168, 119, 216, 182, 159, 189, 142,
+   74,  26, 210,  29, 131, 119, 251,  46, 232, 228, 151, 185,  99, 250,  86, 253,
+   94, 205, 157, 162, 137, 173,  90, 174,  70,  71, 166, 142, 166, 172,   8, 155,
+  201,  92, 111,  16,  43,  63, 229, 209, 186, 200, 178, 220, 193, 215,   8, 122,
+  151, 211, 128,  14, 162,   5,  12,  18, 216, 219, 243, 163, 222, 209, 249, 145,
+   57, 130, 220, 166, 180, 111, 124, 227, 156,  29, 228,  50, 189, 114, 219,  59,
+   47, 183, 203, 231, 135,  22,  19,   9, 172, 171, 233,  74, 123, 203,  52, 145,
+  135,  11, 116, 194,  45, 115, 108,  26,  97, 205, 200, 103,  59, 230, 232, 220,
+  131, 107, 188, 175, 118, 236,  85, 197, 182, 171, 107, 166, 110,  26,  65, 205,
+  168, 199, 165,  28, 231, 195,  35,  51,  52,  28, 235,  35, 115, 212,  43, 127,
+   77, 103, 255, 182, 212,  83,  97, 213, 224, 217,  53, 237, 182,  11, 172, 193,
+   16,  89,  49,  49, 117,  26,   2,  58, 231, 135, 237, 251,  61, 184, 191,  89,
+  202, 206, 182, 138, 226, 122, 234, 106,  47, 141, 169,  60,  69,  26, 177, 200,
+   86,  18, 131, 213, 232,  24, 140,  36, 203,  99, 208, 141, 136, 177, 130, 241,
+  135, 172, 165, 179, 230,  27, 140,  51, 232, 111,  11, 143,  83, 126, 243,  31,
+  101, 130, 152,  17,  68,  85, 134, 254,  28, 227, 248, 209, 119, 177, 142,  80,
+  173,  49, 235,  33,  58, 127, 126, 203,  12, 194, 169,  85, 134,  38,  43, 154,
+  158,  62,  46, 226,  85, 224,  30,  38, 134, 199, 157, 117,  60, 214, 224,   2,
+  206,  50,  58, 166,  72, 225,  59, 194,  95, 243,  94,  38,  99,  84,  24,  99,
+  252,   7, 105,  78,  77,  76, 227,  55,  59, 136, 142,  33, 221, 129,  43, 234,
+  189, 172, 142, 173,  70,  84, 174, 241,  71,  57, 140, 205, 139, 101, 222,  56,
+  254, 222, 156,  55, 136, 143,  26, 172, 227, 142, 109, 197, 232, 188,   0,  74,
+   66, 185,  26,  94, 147,  39, 119, 160,  85, 164, 122, 156, 243, 169,   7, 168,
+  221, 209,  89,  38,  24, 177, 110,  34,  58, 192, 129,  17, 226, 107,  81, 153,
+  210, 213,  22,  29, 192, 205, 106,  62, 168, 131, 253,   6, 244, 190,   0, 156,
+  146, 182, 167, 105, 143,  89, 105, 212,  89,   6,  16, 230, 254,  39, 134, 114,
+   69, 239, 176, 189,  71,  24, 192, 231, 208, 186,  14, 131, 120,  84, 210, 156,
+  133, 108,  15, 154, 218, 197, 113, 128,  86,  62, 111,  23,  94, 202,  88, 196,
+  160, 189,  57,  54, 202, 223, 187,  90,  68,  21,  29,  95, 137, 142,  41, 217,
+  209,  75, 140,  69, 192,  98,  81,  67, 158, 155,  98, 200,  25, 115, 201,  11,
+    5, 127,  61, 203, 235,  81,  56, 247,  59, 144, 223,  39,  52, 122, 164, 142,
+  150, 135,  83, 244,  59, 172,  66,  86, 165,  39,  97, 146,  50, 165,  93,   4,
+  142, 214, 173, 242,  34,  43, 251,  20, 205, 136, 110,  29, 208,  25,  33,   3,
+  210, 118, 192,  55, 135,  16, 211, 204,   9,  24,  25, 228, 176, 230, 184,   3,
+  207, 129, 220,   9,  41, 171, 132, 117,  29,  97,  43, 225,  53,  56, 189,  33,
+  176, 202, 153,  35,  65, 245, 148, 170, 166, 140,  89, 236, 206, 122, 221,  97,
+  157,  73, 230, 163,  56,  54,  46, 107,  92, 176,  21,  76,  88, 181, 117, 171,
+  189, 109, 199, 108, 112, 198,  25,  29,  51,  27, 163, 243, 156, 241,  13,   6,
+   79, 119, 130, 136,  91,  27, 128, 238, 128, 190,  14,  67, 242,  81, 122, 240,
+  225, 182, 113, 117, 234,  22,  10,  24, 193, 172, 254,  65, 252,  97, 230, 159,
+   63,  50, 147, 128, 226, 203, 116, 102, 232, 222,  35, 202,  18,  83,  51, 108,
+  111, 247, 118, 224,  46,  85, 205,  99, 151, 156,  23,  79,  33, 111, 208, 183,
+  192, 238, 179,  59, 152, 179, 152, 173, 166,  25, 218, 104,  12,  42,  47, 205,
+    3,  90,  45,  38, 127, 147, 151, 149, 165, 152, 154,  71, 214,  58, 116, 172,
+  183, 176,  44, 167,  24, 193,  62,  84, 136,  59, 217, 180, 231, 198, 255, 227,
+  150,  69, 239, 243,  51, 114, 131, 196,  41,  70,  39, 230, 118, 153,  62, 244,
+  164, 105, 125, 247, 152, 208,  25, 216,  56, 253,  28, 212, 201, 229, 235, 131,
+  164, 157,   5, 116, 250, 134, 117, 228, 155, 211, 204, 236, 135, 216, 199,  16,
+  251, 220, 201,  97, 206, 234,   6, 215,  50,  58, 232,  48, 197, 100, 144,  60,
+    5, 229,   6, 101, 100, 118, 198, 207, 118,  82, 238, 192, 167,  17, 143,  10,
+  180, 245,  70,  92,  57, 181, 101, 189,  81, 190,  72,  86, 237, 235, 252, 142,
+   33, 159, 140,  74,  99,  90, 166,  67,  28, 102, 125, 145, 136,  14,  62, 157,
+  190, 247, 195, 173,  96, 160,   7, 193,  32, 108, 130, 238, 160, 254, 161,  67,
+   93, 160, 131,  45, 142, 206,  14, 192,  13,  50, 210, 196, 157, 112, 136, 140,
+    0,  20,  34,  64, 199,  35, 222, 195, 117, 231, 192,  29, 211,  55, 169, 190,
+  118, 116,  39, 173, 102,  12, 163, 211, 183, 227, 144, 162, 227,  35, 114, 212,
+  138,   8,  80,  77, 107, 135, 201, 179, 109, 116, 131, 193,  52,  85,  47, 108,
+  145, 142,  30, 221, 156, 239, 106,  97,  94, 146, 125, 246, 134, 203, 124, 193,
+   23, 229,  44, 124, 191, 166, 146, 176, 154,  60,  13, 201, 239, 128,  82,  64,
+  111, 176, 186, 208,  62, 124, 202,  82, 100, 225, 238,  99,  70, 195,  61,   7,
+  120,   4,  20,  89, 112,  22, 161,  99,  98, 106, 249,  20, 184, 115, 128, 248,
+  146, 130,  32,  58,   7, 122, 192, 188,  71, 116, 180,  75, 119, 134,  51,  73,
+  119,   6, 102, 174, 202, 172,  89,  20, 193, 132, 142, 238, 178,   2, 154,  65,
+  138,  14, 157, 195, 173,  74, 216, 113, 192, 145, 248, 111,  59, 103,  91, 122,
+   18, 112, 156, 113, 156,  66, 132, 221, 244,  61, 148, 185, 175, 222,  77, 164,
+  143, 121,  92,  56, 215,  35, 234,  85, 220, 225,  17,  68,  55,  72,  53, 118,
+  221, 216, 236,  16, 214, 115, 140,  14, 107, 167, 159, 187,  86, 103,  33,  26,
+  129,  85, 101,  67, 153,  20, 206, 137, 206, 238, 132,  45, 242,  59, 172,  59,
+    7, 232,  92, 168, 159,  81,  26,  89,  24,  79,  61, 224,  78,  16,   5, 233,
+  115,  83, 108, 112, 148,   0, 157, 207, 118, 193,  21, 208, 241, 112, 144, 203,
+   51,  58, 214,  15, 167, 108,  35, 245,  53, 241, 108, 215,  20, 131, 216, 198,
+  235, 196,  80, 246,   8, 226, 246, 214,  75, 115,  23,  99, 235, 105, 124,  91,
+  145,  78,  22, 185, 234, 118,  55, 248, 184, 196,  25,  82,  91, 116, 192, 111,
+   77, 173, 234,  65,  75, 205,  86, 152, 122, 136,  37, 116,  30,  34,  58, 148,
+  225,  24, 157, 224,  27, 195,  76,   2, 221,   9, 154, 182,  31,  20,  89, 168,
+   46, 136,  46, 244,  51, 131, 170, 204,  10,  71, 220, 137, 184, 154, 211, 241,
+  249, 189, 139, 123,  61, 218,  47, 238,  93, 220, 165,  58,  43, 186, 238, 149,
+   25,  29,  60, 255,   2,  92, 233, 197, 189, 115, 220, 247, 159, 238,  83,  70,
+  143, 137,  49, 211, 176, 107,  17,  78, 218, 106, 133,  99, 126,  97, 215,  32,
+    8,  31, 229, 206, 163, 106, 206,  34, 231,  22, 191, 195,  94,  25, 163,  70,
+  215, 131, 212, 245, 181, 114, 164,  59,  54, 183,  46, 115,  39, 111,  70, 182,
+   45, 169, 238,  48,   6,  17,  40,  77, 147, 170, 211,  52, 103,  69, 132,  34,
+   40,  18, 235,  14, 197, 196, 180, 141, 186,  51, 180, 181, 111, 124, 154,  71,
+  183,   7, 110,  27,  94, 168, 117, 120,  21,  59,  63,  99, 185, 211, 174, 241,
+  252,  10,  40,  22, 248,  72, 200, 240, 112,  30,  94, 145, 214,  89,  33, 213,
+  232, 154, 218,   4, 119, 236, 204,  86, 173,  95, 197, 150,  35, 181,  57,  62,
+  215, 162, 203, 185,  45, 178,  80,  57,  99,  83,  54,  94,  56, 162, 167, 225,
+   83, 106, 168, 202, 168, 191, 216, 219, 235, 145,   5, 158, 132, 171, 249,  38,
+   97,  21,  51, 235, 131, 232, 139, 157, 176,  99,  61,  97,  76, 220, 137, 216,
+    9, 227, 124,   8, 112, 135, 221,  90, 130, 232, 160, 199,  33, 134, 198, 167,
+   25, 244,  56, 134,  93,  75, 147,  84,  57, 162, 204,   0, 254, 116, 198,  21,
+   71, 213, 122, 142, 105,  15,  50, 186, 105,   6, 172, 108,  16,  89, 232,   6,
+   81,  37, 209,  41, 113, 133,   7,  17, 247, 188, 183, 125,  77, 149,  93,  25,
+  121,  91, 146,  43, 174, 171, 180,  34,  21,  41,  62,  87, 123,  87, 156, 209,
+   87, 170, 114, 113, 225, 116, 204, 181, 216,  54, 144,   1,  13, 168,  30, 206,
+  228, 132, 201,  77, 116, 216, 159,  48, 119,  66,  91,   9,  98, 222, 179,  78,
+   13, 123, 150, 195, 170,  13,  35,  14, 175,  15,  58, 224, 175, 225, 125,  96,
+  115,  22, 230, 182, 116,   6, 205, 212, 231, 186, 138, 247, 131, 140, 142,  51,
+   54, 120,  46, 104, 119, 244, 143, 109, 116, 131,  38, 177, 110, 176, 206,  74,
+   24,  18, 215,  33, 163, 199, 182, 213,  77,  56, 107, 106,  51, 159, 187, 140,
+   13,  49,  38, 122,  80, 114, 231,  21,  41, 227,  67,  30, 113,  17,  95, 131,
+  213, 186,  99,  22,  62, 152, 103, 193,  88,  15,  38,  79,  74, 224, 247, 139,
+  193,  36, 245,  59, 215,  85,  89, 207,  35, 139, 243, 143,  89, 198,  22,  91,
+   73, 115, 131, 166,  98, 219, 155,  44, 170, 140, 144,  42,   9, 173, 168, 135,
+   83, 174,  22, 180, 157,  83,  10,  43, 196, 149, 150, 245, 141, 216, 158, 216,
+  236,  94, 108, 235,   9,  71,  86, 104,  43, 102,  26,   1, 204, 111,  16, 249,
+   92, 195, 152, 250, 121, 214,  60, 103, 125, 210, 209, 108, 161,  56, 105,  78,
+   82,  20,  95, 227, 101, 254,  40, 181, 136, 174, 245,  53,  58, 143,  75,  96,
+   49, 194, 255, 193, 115, 158,  49, 198,  58, 139, 221,  29, 160, 147, 191,  22,
+   89, 243,  74,   2, 234, 201, 227,  32, 173,  52, 161, 205, 220,  79,  70, 231,
+  188, 160,  99, 195, 179,  97,   9,  58,  28, 126,  14, 214,  65, 232,  29, 140,
+   85, 147,  20,  87,  19,  61, 165, 249,  34,  45,  81,  77, 172, 255, 142, 205,
+   93,  80, 195, 138, 117, 214,  41, 179, 167, 144,  39,  11, 168, 202, 193, 196,
+  170, 123,  29, 198, 172,  51, 247, 181, 214,  17, 158, 238,  58, 184,  38, 252,
+  130, 103,   1,  31, 237,  58, 146, 240, 193, 189, 186, 164,  63,  16,  91, 106,
+  176,  42, 178, 190, 220, 209, 190, 246, 195, 154, 174, 128,  35, 173, 193,  59,
+   95, 215, 140, 250,  50, 155,  75, 113, 168, 194, 103,  56,  99, 121,  86,   0,
+  216,  82,   5, 135, 134, 243,  25, 202, 206,  69, 184,  65,   7,  88, 223,  49,
+  199,  80,  93, 242, 249, 213,  28, 221, 226, 235,  29, 184,  67,  19,  84,  65,
+  113, 206, 194,  62, 114, 149,   8, 247,  86, 186,  14,  61, 234,  64, 252,  69,
+  128, 149, 250, 229,  92,  47,  76, 193,  52,   2,  60, 218,  49, 205, 207, 118,
+  105,  30, 160,  96, 106,  97,  39, 196, 115, 225, 152, 169,  60, 217, 163, 123,
+   28, 104, 156, 213, 192,  93, 205,  50,  61,   5,  45, 194, 246, 215, 122,  75,
+  171,   6, 178,  41, 160, 149, 187, 187, 178,  33,  34,  81, 226,  25,  31, 244,
+  128, 234,  90, 254,  82, 195, 221,  53,  43,  12, 243,  61, 207, 127,  87, 125,
+  187, 250, 154, 101, 196, 208,  45, 222, 252, 174,  93,   0,  76, 220, 176, 162,
+  161, 237, 109, 215, 230, 122, 240,  59, 139, 171, 102, 215, 254,  95, 191, 223,
+  245, 227, 179, 249, 253,  79, 243, 235,  90, 178, 186, 181, 164, 194, 117, 202,
+   78, 125,  55, 235, 164, 248,  36, 194,  79, 231,  11, 247,  80, 119, 222, 248,
+   10, 148, 145, 214,  31, 196, 166,  18,  90, 135,  99, 146,  39, 119, 223, 248,
+  106, 150, 107, 107, 134, 145, 132, 216,  85, 123,  50, 205,  95, 254,  92, 127,
+  214, 172, 163,  11, 161, 104, 117, 230, 100,  59, 125, 231, 101,   5, 141, 174,
+  144, 112,  36, 203, 191,  89, 240, 202,  71, 251, 236,  28,  30,   1,   5, 229,
+  158, 144, 170, 240,   1, 205, 218, 121, 240, 110,  93, 171, 122,  69, 158, 139,
+   48, 137, 213,  78, 154, 113,  62,  77, 159, 140, 247,  47, 208, 243,  28,  73,
+   79,  22, 219, 229, 178,  75,  94,  87,  21,  85, 129, 239, 171, 196,   7, 219,
+  220, 174, 195, 162,  87, 246, 178, 172, 182,  60, 243, 120, 178, 237,  41, 143,
+  162, 232, 227,  59, 229,  67,   5, 239,  62, 221,  81,  66,  22, 156, 189, 151,
+  122, 217, 197, 245,  26,   9, 119, 116, 139,  94, 113, 137,  63,  53, 170, 219,
+  221, 213, 243, 202,  31, 236,  56,  47,   0,  81, 197, 115, 176, 114, 132, 107,
+  130,  39, 135, 130, 106,  54,  49,  80,  67,  92,  83,   5,  52, 250,  42, 194,
+   21, 196,  89,  78,  94,  62, 220, 167,  25, 146, 145, 234,  43, 104,   3, 248,
+  136, 177,  28, 157, 108, 175,  89,  23, 204, 243,  12,  79,  58, 115,   4,  88,
+   77, 140,  74,  87,  11,  68,  83,  76,  20, 100, 169, 251, 135, 208, 214,  22,
+  142,   3, 240, 127, 232, 116,  80,  77, 213,  88,  85, 241, 217, 159, 236, 136,
+  137, 247,  64, 117, 177,  15, 170,  47,   7,  14, 255, 226, 102, 252, 236, 109,
+  174, 191, 157,  33, 187,  92, 217,  18,  67, 217, 165, 187, 142,  84,  75, 189,
+  228, 151,  79, 246,  85,  29,  49, 115, 138, 114,   0, 254,   7, 241, 177, 254,
+  144, 235, 139, 147, 149,  43,  48,  71, 219, 206,  88,  70, 142,  71, 249,  14,
+  123,  12, 239, 238, 191,  39,  34,  66, 103, 248, 240,  39, 248, 236, 211, 187,
+   98, 232,  29,  34, 110, 179, 119, 212, 229, 199, 128, 142, 168,  58,  19, 245,
+   23,  28,  91, 224, 108, 203,  43, 187, 217, 245, 235,  47, 198,  53, 157, 112,
+  164,  71, 224, 248, 192, 173, 232, 194,  66,  21, 228, 158, 173, 156,  75, 242,
+  210, 114, 167,  35,  20, 222,  21, 209, 145,  45,   5,  72,  60, 220,  17,  99,
+  183, 235, 192, 121, 167, 119, 212, 165, 114, 101, 115,  25,  29, 217, 245, 238,
+  139, 145,  29, 191,  50, 175, 246,   2, 134,  35, 111, 205,  90, 174,  91, 160,
+  223,  96,  36,  34,  58,   1,  62, 166, 248, 164,  43,  22,  47, 111, 247,  75,
+   98, 172, 134, 152, 241,   0, 157,  23,  98, 236,  20, 150, 184,  19,   1,  58,
+   35, 108, 151,  51,  44, 255, 222,  25, 162, 191,  99, 238,  56,  85, 209,  87,
+   47, 144, 239, 192, 162, 174, 136, 149, 184, 125, 165, 130,  95,  55, 245,  18,
+  198,  47, 226,  53, 108, 192, 186,  65,  71, 186,  66, 112,  38, 134, 187, 247,
+  101,   3,  35,  69,  14, 203,  67, 213, 167,  99, 128,  14, 254, 230,   6,  88,
+   52, 254, 251, 219,  28,  47, 247, 143,  68, 204, 184,  42, 159,  89,   4, 109,
+  235, 174, 213,  31, 223, 186, 155, 142, 117,  67, 177, 253, 125, 138, 191, 250,
+  124,  80, 155, 177, 234,  98, 117,   6,  90,  50, 144,  67, 247, 144, 152,  30,
+  209, 172, 253, 208, 251, 136, 158, 152, 119, 250, 202,  71, 222,   2,  58,  99,
+   68,  71, 212,  32,   6,  18,  68, 199,  81,   2, 248, 174, 138, 175, 165, 149,
+   82,  88, 238,  56, 151, 170, 124, 122,  64, 220, 241,  17,  39, 226,  78,  85,
+   65, 100, 125, 122,  71,  14,   0, 127, 120, 246, 175, 247, 197, 165, 106, 224,
+   12,  58, 180, 103, 236, 121, 106,  11, 227,  73, 125,  36,  46, 105, 102,   2,
+  209,  33, 172, 157,  99, 213,  90, 247,  68,  55,  11,  79,   0, 108,  64, 189,
+  114, 229, 119, 188,  31,  83, 253,  69,  51,  61, 178, 177, 122, 253,  93,  53,
+   84, 163, 140,  74,  94,  80,  21, 165,  20, 234, 206, 190, 168, 216, 249, 215,
+   86, 249, 208, 170, 122, 151, 149, 177, 252, 209,  39, 144, 113,  84,  25, 206,
+  108,  96, 251, 196, 150, 211, 112, 252, 215, 204,  36,   5, 230, 244,  73,  73,
+  182, 156,  58, 234, 173,  58,  84,  45,  71, 225,  40, 120,  62, 188,   7,  70,
+   63, 251, 129, 251, 160,  92, 182, 107, 186, 158, 236,  88, 165, 110, 128, 182,
+   32, 115,  11,  78,  83,  42,  70,  58,  85,  27, 120, 119, 203,  47,  78,  78,
+  182, 101,  53,  83, 202, 228, 212,  79, 197, 191, 228,  87, 229, 119, 108, 253,
+  133, 126, 231, 123, 245, 155, 146, 255, 105, 134,   7, 108, 196, 191, 229,  76,
+  126, 149, 201,  57, 210, 137, 215, 213,  89, 255, 151,  91,  78, 157,  21, 102,
+   98, 182,  55,  19, 191,  66,  41, 132,  12, 214,  80, 254,   6, 150, 121, 124,
+  229, 196,  25,  48, 231, 119, 155,  95,  41, 175, 249, 149, 205, 129, 250, 249,
+    6, 155,  91, 127, 194, 182, 217,  54, 219, 102, 219, 108, 155, 237,  13, 110,
+  255,   1,  75, 247,  68,  66,   0,   0
+};
+
+#endif
@@ -30,6 +30,7 @@
  */
 
 #include "app.h"
+#include "scheduler.h"
 
 static EVE_HalContext s_halContext;
 static EVE_HalContext* s_pHalContext;
@@ -41,10 +42,13 @@ static uint32_t d;
 static uint32_t e;
 static uint32_t f;
 
-bool cbCmdWait(struct EVE_HalContext* phost) {
-    (void)(phost); // suspress warning on unused
-    return true;
+#ifdef USB_DEBUG
+static void task_usbdbg(void *ctx)
+{
+    (void)(ctx);
+    usbdbg_try_to_send();
 }
+#endif
 
 void Gpu_Init() {
     size_t deviceIdx = -1;
@@ -53,7 +57,8 @@ void Gpu_Init() {
     EVE_Hal_initialize();
 
     EVE_Hal_defaultsEx(&params, deviceIdx);
-    params.CbCmdWait = cbCmdWait;
+    /* Coprocessor waits run the background work */
+    params.CbCmdWait = sched_cmd_wait;
 
     EVE_Hal_open(s_pHalContext, &params);
 
@@ -112,19 +117,14 @@ void Calibration_Save()
 
 void default_fw()
 {
-#include "Bridgetek_Logo_143x50_ARGB4.c"
-    uint32_t filesz = sizeof(data);
-    uint32_t chunksize = 16 * 1024;
-    uint32_t length = 0;
-    uint32_t addr = RAM_G;
-    int offset = 0;
-    while (filesz > 0)
+    /* Only the compressed logo crosses the SPI, the coprocessor expands it into RAM_G */
+#if LOGO_FORMAT == LOGO_PNG
+    if (!EVE_CoCmd_loadImage_progMem(s_pHalContext, RAM_G, Bridgetek_Logo_png, sizeof(Bridgetek_Logo_png), NULL))
+#else
+    if (!EVE_CoCmd_inflate_progMem(s_pHalContext, RAM_G, Bridgetek_Logo_zlib, sizeof(Bridgetek_Logo_zlib)))
+#endif
     {
-        length = filesz > chunksize ? chunksize : filesz;
-        filesz -= length;
-        EVE_Hal_wrMem(s_pHalContext, addr, &data[offset], length);
-        addr += length;
-        offset += length;
+        eve_printf_debug("Failed to load logo\n");
     }
 
     EVE_CoCmd_screenSaver(s_pHalContext); //screen saver command will continuously update the macro0 with vertex2f command
@@ -142,6 +142,7 @@ void default_fw()
     EVE_Cmd_waitFlush(s_pHalContext);
     while (1)
     {
+        sched_run();
     }
 }
 
@@ -150,6 +151,11 @@ int main(int argc, char* argv[])
     s_pHalContext = &s_halContext;
     Gpu_Init();
 
+    sched_init(EVE_millis);
+#ifdef USB_DEBUG
+    sched_add(task_usbdbg, NULL, USBDBG_TASK_MS, 0);
+#endif
+
     // read and store calibration setting
 #if GET_CALIBRATION == 1
     Eve_Calibrate();
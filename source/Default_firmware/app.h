@@ -36,4 +36,20 @@
 
 #define GET_CALIBRATION                     1
 
+/* Period of the USB debug drain task */
+#define USBDBG_TASK_MS                      10
+
+/* Boot logo payload: LOGO_DEFLATE is inflated by the coprocessor, LOGO_PNG is decoded with CMD_LOADIMAGE */
+#define LOGO_DEFLATE                        0
+#define LOGO_PNG                            1
+#ifndef LOGO_FORMAT
+#define LOGO_FORMAT                         LOGO_DEFLATE
+#endif
+
+#if LOGO_FORMAT == LOGO_PNG
+extern eve_progmem_const uint8_t Bridgetek_Logo_png[4160];
+#else
+extern eve_progmem_const uint8_t Bridgetek_Logo_zlib[3576];
+#endif
+
 #endif /* APP_H_ */
@@ -0,0 +1,174 @@
+/**
+ *  @file scheduler.c Cooperative scheduler for BSP background work
+ *
+ *  @brief
+ *   Run-to-completion tasks in fixed priority order
+ **/
+
+#include <stdio.h>
+#include "scheduler.h"
+
+typedef struct {
+	sched_fn_t	   fn;
+	void		  *ctx;
+	uint32_t	   period;
+	uint32_t	   due;
+	uint8_t		   priority;
+	volatile bool  triggered;
+} sched_task_t;
+
+/* Kept sorted by priority, so a pump is one pass over the table */
+static sched_task_t tasks[SCHED_MAX_TASKS];
+static int8_t task_ids[SCHED_MAX_TASKS]; /* id -> table slot */
+static uint8_t task_count = 0;
+static uint32_t (*sched_clock)(void) = NULL;
+static bool running = false;
+
+typedef struct {
+	sched_fn_t fn;
+	void	  *ctx;
+} sched_job_t;
+
+#define JOB_MASK (SCHED_MAX_JOBS - 1)
+
+static sched_job_t jobs[SCHED_MAX_JOBS];
+static volatile uint8_t job_head = 0;
+static volatile uint8_t job_tail = 0;
+
+void sched_init(uint32_t (*clock)(void))
+{
+	sched_clock = clock;
+	task_count = 0;
+	job_head = job_tail = 0;
+}
+
+int8_t sched_add(sched_fn_t fn, void *ctx, uint32_t period_ms, uint8_t priority)
+{
+	uint8_t slot, i;
+
+	if (task_count >= SCHED_MAX_TASKS || running)
+		return -1;
+
+	slot = task_count;
+	while (slot > 0 && tasks[slot - 1].priority > priority) {
+		tasks[slot] = tasks[slot - 1];
+		slot--;
+	}
+	for (i = 0; i < task_count; i++) {
+		if (task_ids[i] >= slot)
+			task_ids[i]++;
+	}
+
+	tasks[slot].fn = fn;
+	tasks[slot].ctx = ctx;
+	tasks[slot].period = period_ms;
+	tasks[slot].due = sched_clock ? sched_clock() : 0;
+	tasks[slot].priority = priority;
+	tasks[slot].triggered = false;
+	task_ids[task_count] = (int8_t)slot;
+
+	return (int8_t)task_count++;
+}
+
+void sched_trigger(int8_t id)
+{
+	if (id >= 0 && id < task_count)
+		tasks[task_ids[id]].triggered = true;
+}
+
+bool sched_post(sched_fn_t fn, void *ctx)
+{
+	if ((uint8_t)(job_head - job_tail) >= SCHED_MAX_JOBS)
+		return false;
+
+	jobs[job_head & JOB_MASK].fn = fn;
+	jobs[job_head & JOB_MASK].ctx = ctx;
+	job_head++;
+	return true;
+}
+
+uint8_t sched_pending(void)
+{
+	return (uint8_t)(job_head - job_tail);
+}
+
+static uint8_t run_tasks(uint32_t now)
+{
+	uint8_t ran = 0;
+	uint8_t i;
+
+	for (i = 0; i < task_count; i++) {
+		sched_task_t *task = &tasks[i];
+		bool due;
+
+		if (task->triggered) {
+			task->triggered = false;
+			due = true;
+		}
+		else if (task->period == SCHED_ON_TRIGGER) {
+			due = false;
+		}
+		else if (task->period == SCHED_EVERY_PUMP) {
+			due = true;
+		}
+		else {
+			due = (int32_t)(now - task->due) >= 0;
+		}
+
+		if (due) {
+			if (task->period != SCHED_EVERY_PUMP && task->period != SCHED_ON_TRIGGER)
+				task->due = now + task->period;
+			task->fn(task->ctx);
+			ran++;
+		}
+	}
+
+	return ran;
+}
+
+static uint8_t run_jobs(uint32_t start, uint32_t budget_ms)
+{
+	uint8_t ran = 0;
+	/* Jobs posted while draining wait for the next pump, a self reposting job cannot hold the pump */
+	uint8_t count = (uint8_t)(job_head - job_tail);
+
+	while (count--) {
+		sched_job_t job = jobs[job_tail & JOB_MASK];
+		job_tail++;
+		job.fn(job.ctx);
+		ran++;
+		if (sched_clock && sched_clock() - start >= budget_ms)
+			break;
+	}
+
+	return ran;
+}
+
+uint8_t sched_run_for(uint32_t budget_ms)
+{
+	uint32_t now;
+	uint8_t ran;
+
+	if (running)
+		return 0;
+	running = true;
+
+	now = sched_clock ? sched_clock() : 0;
+	ran = run_tasks(now);
+	ran += run_jobs(now, budget_ms);
+
+	running = false;
+	return ran;
+}
+
+uint8_t sched_run(void)
+{
+	return sched_run_for(0xFFFFFFFFUL);
+}
+
+bool sched_cmd_wait(struct EVE_HalContext *phost)
+{
+	(void)(phost);
+	sched_run_for(SCHED_WAIT_BUDGET_MS);
+	return true;
+}